@@ -899,7 +899,8 @@ void C3DEngine::RenderWorld(const int nRenderFlags, const SRenderingPassInfo& pa
 	RenderInternal(nRenderFlags, passInfo, szDebugName);
 
 #ifdef SEG_WORLD
-	if (GetISystem()->GetIConsole()->GetCVar("sw_debugInfo")->GetIVal() == 4)
+	static CVarHandle<int> s_swDebugInfo("sw_debugInfo");
+	if (s_swDebugInfo.Get() == 4)
 	{
 		f32 fColor[4] = { 1, 1, 0, 1 };
 
@@ -1254,6 +1255,9 @@ void C3DEngine::PrintDebugInfo(const SRenderingPassInfo& passInfo)
 			//		color = Col_Magenta;
 
 			DrawTextLeftAligned(fTextPosX, fTextPosY += fTextStepY, DISPLAY_INFO_SCALE, color, "%s", szCGFStreaming);
+			DrawTextLeftAligned(fTextPosX, fTextPosY += fTextStepY, DISPLAY_INFO_SCALE, Col_White, "Prediction: Hit:%d Miss:%d Velocity:%.1f m/s Cameras:%d",
+			                    m_pObjManager->m_nStreamPredictionHits, m_pObjManager->m_nStreamPredictionMisses,
+			                    m_pObjManager->m_vStreamCameraVelocity.GetLength(), m_pObjManager->m_vStreamPredictionCameras.Count());
 			fTextPosY += fTextStepY;
 		}
 
@@ -2184,7 +2188,8 @@ void C3DEngine::DisplayInfo(float& fTextPosX, float& fTextPosY, float& fTextStep
 			const float barSizeNorm = barMaxNorm - barMinNorm;
 			const float barSizeRes = barSizeNorm * iDisplayResolutionX;
 
-			float targetFPS = gEnv->pConsole->GetCVar("r_displayinfoTargetFPS")->GetFVal();
+			static CVarHandle<float> s_targetFPS("r_displayinfoTargetFPS");
+			float targetFPS = s_targetFPS.Get();
 			if (targetFPS <= 0)
 			{
 				targetFPS = 30;
@@ -2480,8 +2485,9 @@ void C3DEngine::DisplayInfo(float& fTextPosX, float& fTextPosY, float& fTextStep
 		m_pRenderer->EF_Query(EFQ_GetShaderCacheInfo, stats);
 		{
 
-			DrawTextRightAligned(fTextPosX, fTextPosY += fTextStepY, DISPLAY_INFO_SCALE, Col_White, "ShaderCache: %d GCM | %d Async Reqs | Compile: %s",
-			                     (int)stats.m_nGlobalShaderCacheMisses, (int)stats.m_nNumShaderAsyncCompiles, stats.m_bShaderCompileActive ? "On" : "Off");
+			DrawTextRightAligned(fTextPosX, fTextPosY += fTextStepY, DISPLAY_INFO_SCALE, Col_White, "ShaderCache: %d GCM | %d Async Reqs | %d Sync Reads (%.1fms) | Compile: %s",
+			                     (int)stats.m_nGlobalShaderCacheMisses, (int)stats.m_nNumShaderAsyncCompiles,
+			                     (int)stats.m_nNumShaderCacheSyncReads, stats.m_fShaderCacheSyncReadTime * 1000.0f, stats.m_bShaderCompileActive ? "On" : "Off");
 		}
 	}
 
@@ -2498,6 +2504,15 @@ void C3DEngine::DisplayInfo(float& fTextPosX, float& fTextPosY, float& fTextStep
 			            objectsStreamingStatus.nReady, objectsStreamingStatus.nInProgress, objectsStreamingStatus.nTotal, objectsStreamingStatus.nActive,
 			            (int)m_pObjManager->m_vStreamPreCachePointDefs.size(),
 			            float(objectsStreamingStatus.nAllocatedBytes) / 1024 / 1024, float(objectsStreamingStatus.nMemRequired) / 1024 / 1024, GetCVars()->e_StreamCgfPoolSize);
+
+			const int nPredictionHits = m_pObjManager->m_nStreamPredictionHits;
+			const int nPredictionMisses = m_pObjManager->m_nStreamPredictionMisses;
+			if (nPredictionHits + nPredictionMisses)
+			{
+				const size_t nLen = strlen(szCGFStreaming);
+				cry_sprintf(szCGFStreaming + nLen, sizeof(szCGFStreaming) - nLen, " Hit:%d Miss:%d (%.1f%%)",
+				            nPredictionHits, nPredictionMisses, 100.0f * nPredictionHits / (nPredictionHits + nPredictionMisses));
+			}
 		}
 
 		bool bOutOfMem((float(objectsStreamingStatus.nMemRequired) / 1024 / 1024) > GetCVars()->e_StreamCgfPoolSize);
@@ -3352,6 +3367,12 @@ void C3DEngine::DisplayInfo(float& fTextPosX, float& fTextPosY, float& fTextStep
 		                     "Terrain texture streaming status: waiting=%d, all=%d, pool=(%d+%d)",
 		                     m_pTerrain->GetNotReadyTextureNodesCount(), m_pTerrain->GetActiveTextureNodesCount(),
 		                     nCacheSize[0], nCacheSize[1]);
+
+		int nRequested, nLoads, nEvictions, nReloads;
+		m_pTerrain->GetTextureStreamingStats(nRequested, nLoads, nEvictions, nReloads);
+		DrawTextRightAligned(fTextPosX, fTextPosY += fTextStepY,
+		                     "Terrain texture tiles: requested=%d, loads=%d, evictions=%d, reloads=%d, lod scale=%.2f",
+		                     nRequested, nLoads, nEvictions, nReloads, m_pTerrain->GetTextureStreamingLodScale());
 	}
 
 	if (GetCVars()->e_TerrainBBoxes && m_pTerrain)
@@ -426,6 +426,10 @@ C3DEngine::C3DEngine(ISystem* pSystem)
 	m_bHeightMapAoEnabled = false;
 	m_bIntegrateObjectsIntoTerrain = false;
 
+	m_nBulkRegistrationDepth = 0;
+	m_bFlushingBulkRegistration = false;
+	m_bulkTerrainResetBox.Reset();
+
 	m_nCurrentWindAreaList = 0;
 	m_pLevelStatObjTable = NULL;
 	m_pLevelMaterialsTable = NULL;
@@ -641,6 +645,13 @@ void C3DEngine::Update()
 
 	m_LightConfigSpec = (ESystemConfigSpec)GetCurrentLightSpec();
 
+	if (m_nBulkRegistrationDepth > 0)
+	{
+		Warning("C3DEngine::Update: BeginBulkRegistration was not matched by EndBulkRegistration, flushing %d queued objects", (int)m_pendingRegistrations.size());
+		m_nBulkRegistrationDepth = 0;
+		FlushBulkRegistration();
+	}
+
 	///	if(m_pVisAreaManager)
 	//	m_pVisAreaManager->Preceche(m_pObjManager);
 
@@ -1340,10 +1351,98 @@ IStatObj* C3DEngine::FindStatObjectByFilename(const char* filename)
 void C3DEngine::RegisterEntity(IRenderNode* pEnt, int nSID, int nSIDConsideredSafe)
 {
 	FUNCTION_PROFILER_3DENGINE;
+
+	if (m_nBulkRegistrationDepth > 0 && GetCVars()->e_ObjBulkRegistration)
+	{
+		// sort by segment first, then by a morton code of the box center so neighbouring objects end up
+		// in the same octree branches one after another
+		AABB aabb;
+		pEnt->FillBBox(aabb);
+		const Vec3 vCenter = aabb.GetCenter();
+		const float fScale = 65535.f / max(1.f, (float)GetTerrainSize());
+		uint64 nMorton = 0;
+		const uint32 nX = (uint32)clamp_tpl(vCenter.x * fScale, 0.f, 65535.f);
+		const uint32 nY = (uint32)clamp_tpl(vCenter.y * fScale, 0.f, 65535.f);
+		for (int nBit = 0; nBit < 16; ++nBit)
+			nMorton |= (uint64)(((nX >> nBit) & 1) | (((nY >> nBit) & 1) << 1)) << (nBit * 2);
+
+		const SPendingRegistration pending = { pEnt, nSID, nSIDConsideredSafe, ((uint64)(uint32)(nSID + 1) << 32) | nMorton };
+
+		auto it = m_pendingRegistrationIndices.find(pEnt);
+		if (it != m_pendingRegistrationIndices.end())
+		{
+			// registered again before the flush (e.g. moved right after creation), keep only the latest state
+			m_pendingRegistrations[it->second] = pending;
+		}
+		else
+		{
+			m_pendingRegistrationIndices[pEnt] = m_pendingRegistrations.size();
+			m_pendingRegistrations.push_back(pending);
+		}
+		return;
+	}
+
 	uint32 nFrameID = gEnv->nMainFrameID;
 	AsyncOctreeUpdate(pEnt, nSID, nSIDConsideredSafe, nFrameID, false);
 }
 
+void C3DEngine::BeginBulkRegistration()
+{
+	assert(gEnv->mMainThreadId == CryGetCurrentThreadId());
+	++m_nBulkRegistrationDepth;
+}
+
+void C3DEngine::EndBulkRegistration()
+{
+	assert(gEnv->mMainThreadId == CryGetCurrentThreadId());
+	assert(m_nBulkRegistrationDepth > 0);
+
+	if (m_nBulkRegistrationDepth > 0 && --m_nBulkRegistrationDepth == 0)
+		FlushBulkRegistration();
+}
+
+void C3DEngine::FlushBulkRegistration()
+{
+	FUNCTION_PROFILER_3DENGINE;
+
+	if (m_pendingRegistrations.empty())
+		return;
+
+	// take the queue first, registering a node may unregister other nodes
+	std::vector<SPendingRegistration> pending;
+	pending.swap(m_pendingRegistrations);
+	m_pendingRegistrationIndices.clear();
+
+	std::sort(pending.begin(), pending.end(), [](const SPendingRegistration& a, const SPendingRegistration& b)
+	{
+		return a.nSortKey < b.nSortKey;
+	});
+
+	m_bFlushingBulkRegistration = true;
+	m_bulkTerrainResetBox.Reset();
+
+	const uint32 nFrameID = gEnv->nMainFrameID;
+	for (const SPendingRegistration& registration : pending)
+	{
+		if (registration.pNode)
+			AsyncOctreeUpdate(registration.pNode, registration.nSID, registration.nSIDConsideredSafe, nFrameID, false);
+	}
+
+	m_bFlushingBulkRegistration = false;
+
+	// one terrain mesh reset for all integrated brushes instead of one per object
+	if (!m_bulkTerrainResetBox.IsReset())
+		GetTerrain()->ResetTerrainVertBuffers(&m_bulkTerrainResetBox);
+}
+
+void C3DEngine::ResetIntegratedTerrainVertBuffers(const AABB& nodeBox)
+{
+	if (m_bFlushingBulkRegistration)
+		m_bulkTerrainResetBox.Add(nodeBox);
+	else
+		GetTerrain()->ResetTerrainVertBuffers(&nodeBox);
+}
+
 void C3DEngine::UnRegisterEntityDirect(IRenderNode* pEnt)
 {
 	UnRegisterEntityImpl(pEnt);
@@ -4912,7 +5011,8 @@ void C3DEngine::ObjectsTreeMarkAsUncompiled(const IRenderNode* pRenderNode)
 
 void C3DEngine::OnObjectModified(IRenderNode* pRenderNode, IRenderNode::RenderFlagsType dwFlags)
 {
-	if ((dwFlags & (ERF_CASTSHADOWMAPS | ERF_HAS_CASTSHADOWMAPS)) != 0)
+	// moved casters already invalidated their old area when they got unregistered
+	if ((dwFlags & (ERF_CASTSHADOWMAPS | ERF_HAS_CASTSHADOWMAPS)) != 0 && !GetCVars()->e_ShadowsCacheDirtyRegions)
 		SetRecomputeCachedShadows(ShadowMapFrustum::ShadowCacheData::eFullUpdateTimesliced);
 	if (pRenderNode)
 	{
@@ -6449,8 +6549,7 @@ void C3DEngine::AsyncOctreeUpdate(IRenderNode* pEnt, int nSID, int nSIDConsidere
 	if (m_bIntegrateObjectsIntoTerrain && eERType == eERType_MovableBrush && pEnt->GetGIMode() == IRenderNode::eGM_IntegrateIntoTerrain)
 	{
 		// update meshes integrated into terrain 
-		AABB nodeBox = pEnt->GetBBox();
-		GetTerrain()->ResetTerrainVertBuffers(&nodeBox);
+		ResetIntegratedTerrainVertBuffers(pEnt->GetBBox());
 	}
 
 	if (!(dwRndFlags & ERF_RENDER_ALWAYS) && !(dwRndFlags & ERF_CASTSHADOWMAPS))
@@ -6652,6 +6751,17 @@ bool C3DEngine::UnRegisterEntityImpl(IRenderNode* pEnt)
 	if (nElementID != -1)
 		m_deferredRenderProxyStreamingPriorityUpdates.DeleteFastUnsorted(nElementID);
 
+	// drop a queued bulk registration, the node may be deleted before the flush
+	if (!m_pendingRegistrationIndices.empty())
+	{
+		auto it = m_pendingRegistrationIndices.find(pEnt);
+		if (it != m_pendingRegistrationIndices.end())
+		{
+			m_pendingRegistrations[it->second].pNode = nullptr;
+			m_pendingRegistrationIndices.erase(it);
+		}
+	}
+
 	FUNCTION_PROFILER_3DENGINE;
 
 #ifdef _DEBUG   // crash test basically
@@ -6669,6 +6779,10 @@ bool C3DEngine::UnRegisterEntityImpl(IRenderNode* pEnt)
 	if (pEnt->m_pOcNode)
 		bFound = ((COctreeNode*)pEnt->m_pOcNode)->DeleteObject(pEnt);
 
+	// the bounding box is still the old one here, also when the node is unregistered for a move
+	if (m_pSun && (pEnt->GetRndFlags() & ERF_CASTSHADOWMAPS) && GetCVars()->e_ShadowsCacheDirtyRegions)
+		m_pSun->InvalidateCachedShadowCaster(pEnt);
+
 	if (pEnt->m_dwRndFlags & ERF_RENDER_ALWAYS || (eRenderNodeType == eERType_Light) || (eRenderNodeType == eERType_FogVolume))
 	{
 		m_lstAlwaysVisible.Delete(pEnt);
@@ -6691,8 +6805,7 @@ bool C3DEngine::UnRegisterEntityImpl(IRenderNode* pEnt)
 	if (m_bIntegrateObjectsIntoTerrain && eRenderNodeType == eERType_MovableBrush && pEnt->GetGIMode() == IRenderNode::eGM_IntegrateIntoTerrain)
 	{
 		// update meshes integrated into terrain 
-		AABB nodeBox = pEnt->GetBBox();
-		GetTerrain()->ResetTerrainVertBuffers(&nodeBox);
+		ResetIntegratedTerrainVertBuffers(pEnt->GetBBox());
 	}
 
 	return bFound;
@@ -380,6 +380,8 @@ public:
 	virtual IStatObj* LoadStatObj(const char* szFileName, const char* szGeomName = NULL, /*[Out]*/ IStatObj::SSubObject** ppSubObject = NULL, bool bUseStreaming = true, unsigned long nLoadingFlags = 0);
 	virtual IStatObj* FindStatObjectByFilename(const char* filename);
 	virtual void      RegisterEntity(IRenderNode* pEnt, int nSID = -1, int nSIDConsideredSafe = -1);
+	virtual void      BeginBulkRegistration();
+	virtual void      EndBulkRegistration();
 	virtual void      SelectEntity(IRenderNode* pEnt);
 
 #ifndef _RELEASE
@@ -409,6 +411,8 @@ public:
 
 	void              AsyncOctreeUpdate(IRenderNode* pEnt, int nSID, int nSIDConsideredSafe, uint32 nFrameID, bool bUnRegisterOnly);
 	bool              UnRegisterEntityImpl(IRenderNode* pEnt);
+	void              FlushBulkRegistration();
+	void              ResetIntegratedTerrainVertBuffers(const AABB& nodeBox);
 	virtual void      UpdateObjectsLayerAABB(IRenderNode* pEnt);
 
 	// Fast option - use if just ocean height required
@@ -1230,6 +1234,20 @@ private:
 
 	PodArray<IRenderNode*> m_deferredRenderProxyStreamingPriorityUpdates;     // deferred streaming priority updates for newly seen CRenderProxies
 
+	// registrations queued between BeginBulkRegistration and EndBulkRegistration
+	struct SPendingRegistration
+	{
+		IRenderNode* pNode;
+		int          nSID;
+		int          nSIDConsideredSafe;
+		uint64       nSortKey;
+	};
+	std::vector<SPendingRegistration>            m_pendingRegistrations;
+	std::unordered_map<IRenderNode*, size_t>     m_pendingRegistrationIndices; // node -> index in m_pendingRegistrations
+	int                                          m_nBulkRegistrationDepth;
+	bool                                         m_bFlushingBulkRegistration;
+	AABB                                         m_bulkTerrainResetBox;        // union of integrated brush boxes touched during a flush
+
 	float                  m_fLightsHDRDynamicPowerFactor; // lights hdr exponent/exposure
 
 	int                    m_nBlackTexID;
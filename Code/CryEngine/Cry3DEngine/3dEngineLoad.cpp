@@ -667,6 +667,8 @@ void C3DEngine::UnloadLevel()
 	stl::free_container(m_RenderingPassCameras[0]);
 	stl::free_container(m_RenderingPassCameras[1]);
 	stl::free_container(m_deferredRenderProxyStreamingPriorityUpdates);
+	stl::free_container(m_pendingRegistrations);
+	m_pendingRegistrationIndices.clear();
 
 	for (auto& pFr : m_lstCustomShadowFrustums)
 	{
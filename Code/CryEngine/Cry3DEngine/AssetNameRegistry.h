@@ -0,0 +1,126 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+// -------------------------------------------------------------------------
+//  File name:   AssetNameRegistry.h
+//  Description: Name to asset lookup table for the material and static object managers.
+//               Entries are spread over shards by a case insensitive hash of the name,
+//               each shard has its own read/write lock, so lookups of already loaded
+//               assets from several threads neither contend on the manager lock nor
+//               allocate a temporary string.
+// -------------------------------------------------------------------------
+
+#ifndef __AssetNameRegistry_h__
+#define __AssetNameRegistry_h__
+#pragma once
+
+#include <CryString/StringUtils.h>
+
+template<class T, uint32 NumShards = 16>
+class CAssetNameRegistry
+{
+public:
+	static_assert((NumShards & (NumShards - 1)) == 0, "Shard count must be a power of two");
+
+	static uint32 Hash(const char* szName) { return CryStringUtils::CalculateHashLowerCase(szName); }
+
+	T* Find(const char* szName) const { return Find(szName, Hash(szName)); }
+
+	T* Find(const char* szName, uint32 nHash) const
+	{
+		const SShard& shard = GetShard(nHash);
+		T* pResult = NULL;
+
+		shard.lock.RLock();
+		std::pair<typename Entries::const_iterator, typename Entries::const_iterator> range = shard.entries.equal_range(nHash);
+		for (typename Entries::const_iterator it = range.first; it != range.second; ++it)
+		{
+			if (stricmp(it->second.name.c_str(), szName) == 0)
+			{
+				pResult = it->second.pAsset;
+				break;
+			}
+		}
+		shard.lock.RUnlock();
+
+		return pResult;
+	}
+
+	// Replaces the asset already registered under this name
+	void Insert(const string& name, T* pAsset)
+	{
+		const uint32 nHash = Hash(name.c_str());
+		SShard& shard = GetShard(nHash);
+
+		shard.lock.WLock();
+		typename Entries::iterator it = FindEntry(shard, name.c_str(), nHash);
+		if (it != shard.entries.end())
+			it->second.pAsset = pAsset;
+		else
+			shard.entries.insert(std::make_pair(nHash, SEntry(name, pAsset)));
+		shard.lock.WUnlock();
+	}
+
+	void Erase(const char* szName)
+	{
+		const uint32 nHash = Hash(szName);
+		SShard& shard = GetShard(nHash);
+
+		shard.lock.WLock();
+		typename Entries::iterator it = FindEntry(shard, szName, nHash);
+		if (it != shard.entries.end())
+			shard.entries.erase(it);
+		shard.lock.WUnlock();
+	}
+
+	void Clear()
+	{
+		for (uint32 i = 0; i < NumShards; ++i)
+		{
+			m_shards[i].lock.WLock();
+			stl::free_container(m_shards[i].entries);
+			m_shards[i].lock.WUnlock();
+		}
+	}
+
+	void GetMemoryUsage(ICrySizer* pSizer) const
+	{
+		for (uint32 i = 0; i < NumShards; ++i)
+			pSizer->AddHashMap(m_shards[i].entries);
+	}
+
+private:
+	struct SEntry
+	{
+		SEntry(const string& _name, T* _pAsset) : name(_name), pAsset(_pAsset) {}
+
+		string name;
+		T*     pAsset;
+	};
+
+	// Keyed by the name hash, colliding names are told apart by comparing the stored name
+	typedef std::unordered_multimap<uint32, SEntry> Entries;
+
+	struct SShard
+	{
+		mutable CryRWLock lock;
+		Entries           entries;
+	};
+
+	SShard&       GetShard(uint32 nHash)       { return m_shards[(nHash >> 16) & (NumShards - 1)]; }
+	const SShard& GetShard(uint32 nHash) const { return m_shards[(nHash >> 16) & (NumShards - 1)]; }
+
+	static typename Entries::iterator FindEntry(SShard& shard, const char* szName, uint32 nHash)
+	{
+		std::pair<typename Entries::iterator, typename Entries::iterator> range = shard.entries.equal_range(nHash);
+		for (typename Entries::iterator it = range.first; it != range.second; ++it)
+		{
+			if (stricmp(it->second.name.c_str(), szName) == 0)
+				return it;
+		}
+		return shard.entries.end();
+	}
+
+	SShard m_shards[NumShards];
+};
+
+#endif // __AssetNameRegistry_h__
@@ -11,6 +11,17 @@
 // enable this define to allow ingame debugging of the coverage buffer
 #define CULLING_ENABLE_DEBUG_OVERLAY
 
+// 8 wide span kernels, selected at runtime on CPUs supporting AVX2
+#if CRY_PLATFORM_SSE2 && CRY_PLATFORM_64BIT && (CRY_PLATFORM_WINDOWS || CRY_PLATFORM_LINUX || CRY_PLATFORM_MAC)
+	#define CULL_RENDERER_AVX2
+	#include <immintrin.h>
+	#if defined(__GNUC__) || defined(__clang__)
+		#define CULL_RENDERER_AVX2_TARGET __attribute__((target("avx2")))
+	#else
+		#define CULL_RENDERER_AVX2_TARGET
+	#endif
+#endif
+
 #pragma warning(push)
 #pragma warning(disable:6262)
 
@@ -103,12 +114,16 @@ private:
 
 	uint32 m_DrawCall;
 	uint32 m_PolyCount;
+	bool   m_bAVX2;
 
+	// BandMinY/BandMaxY limit the rasterized lines, so several jobs can rasterize into disjoint bands of the buffer
 	template<bool WRITE, bool CULL, bool CULL_BACKFACES>
 	inline bool Triangle(
 	  const NVMath::vec4& rV0,
 	  const NVMath::vec4& rV1,
-	  const NVMath::vec4& rV2)
+	  const NVMath::vec4& rV2,
+	  uint32 BandMinY = 0,
+	  uint32 BandMaxY = SIZEY)
 	{
 		using namespace NVMath;
 
@@ -136,7 +151,7 @@ private:
 				const vec4 M1 = Div(F0, Sub(F0, F1));
 				const vec4 P0 = Madd(Sub(V2, V0), M0, V0);
 				const vec4 P1 = Madd(Sub(V1, V0), M1, V0);
-				Visible = Triangle2D<WRITE, CULL, true, CULL_BACKFACES>(P0, P1, V1);
+				Visible = Triangle2D<WRITE, CULL, true, CULL_BACKFACES>(P0, P1, V1, 0, 0, 0, 0, Vec4Zero(), Vec4Zero(), BandMinY, BandMaxY);
 				V0 = P0;
 			}
 			break;
@@ -149,7 +164,7 @@ private:
 				const vec4 M1 = Div(F1, Sub(F1, F2));
 				const vec4 P0 = Madd(Sub(V0, V1), M0, V1);
 				const vec4 P1 = Madd(Sub(V2, V1), M1, V1);
-				Visible = Triangle2D<WRITE, CULL, true, CULL_BACKFACES>(P0, P1, V2);
+				Visible = Triangle2D<WRITE, CULL, true, CULL_BACKFACES>(P0, P1, V2, 0, 0, 0, 0, Vec4Zero(), Vec4Zero(), BandMinY, BandMaxY);
 				V1 = P0;
 			}
 			break;
@@ -173,7 +188,7 @@ private:
 				const vec4 M1 = Div(F2, Sub(F2, F0));
 				const vec4 P0 = Madd(Sub(V1, V2), M0, V2);
 				const vec4 P1 = Madd(Sub(V0, V2), M1, V2);
-				Visible = Triangle2D<WRITE, CULL, true, CULL_BACKFACES>(V0, P0, P1);
+				Visible = Triangle2D<WRITE, CULL, true, CULL_BACKFACES>(V0, P0, P1, 0, 0, 0, 0, Vec4Zero(), Vec4Zero(), BandMinY, BandMaxY);
 				V2 = P0;
 			}
 			break;
@@ -207,14 +222,14 @@ private:
 #endif
 		}
 
-		return Visible | Triangle2D<WRITE, CULL, true, CULL_BACKFACES>(V0, V1, V2);
+		return Visible | Triangle2D<WRITE, CULL, true, CULL_BACKFACES>(V0, V1, V2, 0, 0, 0, 0, Vec4Zero(), Vec4Zero(), BandMinY, BandMaxY);
 	}
 
 	template<bool WRITE, bool CULL, bool PROJECT, bool CULL_BACKFACES>
 #if CRY_PLATFORM_WINDOWS && CRY_PLATFORM_32BIT
-	inline bool Triangle2D(NVMath::vec4 rV0, NVMath::vec4 rV1, NVMath::vec4 rV2, uint32 MinX = 0, uint32 MinY = 0, uint32 MaxX = 0, uint32 MaxY = 0, NVMath::vec4& VMinMax = NVMath::Vec4Zero(), NVMath::vec4& V210 = NVMath::Vec4Zero())
+	inline bool Triangle2D(NVMath::vec4 rV0, NVMath::vec4 rV1, NVMath::vec4 rV2, uint32 MinX = 0, uint32 MinY = 0, uint32 MaxX = 0, uint32 MaxY = 0, NVMath::vec4& VMinMax = NVMath::Vec4Zero(), NVMath::vec4& V210 = NVMath::Vec4Zero(), uint32 BandMinY = 0, uint32 BandMaxY = SIZEY)
 #else
-	inline bool Triangle2D(NVMath::vec4 rV0, NVMath::vec4 rV1, NVMath::vec4 rV2, uint32 MinX = 0, uint32 MinY = 0, uint32 MaxX = 0, uint32 MaxY = 0, NVMath::vec4 VMinMax = NVMath::Vec4Zero (), NVMath::vec4 V210 = NVMath::Vec4Zero ())
+	inline bool Triangle2D(NVMath::vec4 rV0, NVMath::vec4 rV1, NVMath::vec4 rV2, uint32 MinX = 0, uint32 MinY = 0, uint32 MaxX = 0, uint32 MaxY = 0, NVMath::vec4 VMinMax = NVMath::Vec4Zero (), NVMath::vec4 V210 = NVMath::Vec4Zero (), uint32 BandMinY = 0, uint32 BandMaxY = SIZEY)
 #endif
 	{
 		using namespace NVMath;
@@ -266,6 +281,24 @@ private:
 			V2 = rV2;
 		}
 
+		if (MinY < BandMinY || MaxY > BandMaxY)
+		{
+			MinY = max(MinY, BandMinY);
+			MaxY = min(MaxY, BandMaxY);
+			if (MinY >= MaxY)
+			{
+				return false;
+			}
+			VMinMax = NVMath::Vec4(MinX, MinY, MaxX, MaxY);
+		}
+
+#ifdef CULL_RENDERER_AVX2
+		if (m_bAVX2)
+		{
+			return Triangle2DSpans_AVX2<WRITE, CULL>(rV0, rV1, rV2, V0, V210, MinX, MinY, MaxX, MaxY);
+		}
+#endif
+
 		MinX &= ~3;
 
 		VMinMax = And(VMinMax, MaskNot3);
@@ -346,6 +379,91 @@ private:
 		return CULL && (SignMask(Visible) & (BitX | BitY | BitZ | BitW)) != (BitX | BitY | BitZ | BitW);
 	}
 
+#ifdef CULL_RENDERER_AVX2
+	// The span loops of Triangle2D 8 pixels at a time, the setup is the same.
+	template<bool WRITE, bool CULL>
+	CULL_RENDERER_AVX2_TARGET bool Triangle2DSpans_AVX2(const NVMath::vec4& rV0, const NVMath::vec4& rV1, const NVMath::vec4& rV2, const NVMath::vec4& V0, const NVMath::vec4& V210, uint32 MinX, uint32 MinY, uint32 MaxX, uint32 MaxY)
+	{
+		CRY_ALIGN(16) float Z0[4], Z1[4], Z2[4], P0[4], E[4];
+		_mm_store_ps(Z0, rV0);
+		_mm_store_ps(Z1, rV1);
+		_mm_store_ps(Z2, rV2);
+		_mm_store_ps(P0, V0);
+		_mm_store_ps(E, V210);
+
+		MinX &= ~7;
+
+		const __m256 Zero = _mm256_setzero_ps();
+#ifdef CULL_RENDERER_MINZ
+		const __m256 VMinZ = _mm256_set1_ps(min(min(Z0[2], Z1[2]), Z2[2]));
+#endif
+		const __m256 V0z = _mm256_set1_ps(Z0[2]);
+		const __m256 Z10 = _mm256_set1_ps(Z1[2] - Z0[2]);
+		const __m256 Z20 = _mm256_set1_ps(Z2[2] - Z0[2]);
+
+		const __m256 X20 = _mm256_set1_ps(E[0]);
+		const __m256 Y20 = _mm256_set1_ps(E[1]);
+		const __m256 X10 = _mm256_set1_ps(-E[2]);
+		const __m256 Y10 = _mm256_set1_ps(E[3]);
+
+		const __m256 dx8 = _mm256_add_ps(_mm256_set1_ps(static_cast<float>(MinX) - P0[0]), _mm256_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f));
+		const __m256 Y1x = _mm256_mul_ps(Y10, dx8);
+		const __m256 Y2x = _mm256_sub_ps(Zero, _mm256_mul_ps(Y20, dx8));
+		const __m256 Y18 = _mm256_mul_ps(Y10, _mm256_set1_ps(8.f));
+		const __m256 Y28 = _mm256_sub_ps(Zero, _mm256_mul_ps(Y20, _mm256_set1_ps(8.f)));
+		const __m256 Y38 = _mm256_add_ps(Y18, Y28);
+
+		__m256 Visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+		float dy = static_cast<float>(MinY) - P0[1];
+		for (uint32 y = MinY; y < MaxY; y++, dy += 1.f)
+		{
+			const __m256 dy8 = _mm256_set1_ps(dy);
+			__m256 Px = _mm256_add_ps(Y1x, _mm256_mul_ps(X10, dy8));
+			__m256 Py = _mm256_add_ps(Y2x, _mm256_mul_ps(X20, dy8));
+			__m256 Pz = _mm256_sub_ps(_mm256_sub_ps(_mm256_set1_ps(1.f), Py), Px);
+
+			float* pDstZ = &m_ZOutput[MinX + y * SIZEX];
+			for (uint32 x = MinX; x < MaxX; x += 8, pDstZ += 8)
+			{
+				__m256 Mask = _mm256_or_ps(_mm256_or_ps(Px, Py), Pz);
+				const __m256 rZ = _mm256_loadu_ps(pDstZ);
+				__m256 Z;
+#ifdef CULL_RENDERER_MINZ
+				if (!WRITE)
+				{
+					Mask = _mm256_or_ps(Mask, _mm256_cmp_ps(rZ, VMinZ, _CMP_LE_OQ));
+				}
+				else
+#endif
+				{
+					Z = _mm256_add_ps(V0z, _mm256_add_ps(_mm256_mul_ps(Z20, Py), _mm256_mul_ps(Z10, Px)));
+					Mask = _mm256_or_ps(Mask, _mm256_cmp_ps(rZ, Z, _CMP_LE_OQ));
+				}
+				Px = _mm256_add_ps(Px, Y18);
+				Py = _mm256_add_ps(Py, Y28);
+				Pz = _mm256_sub_ps(Pz, Y38);
+				if (CULL)
+				{
+					Visible = _mm256_and_ps(Visible, Mask);
+				}
+				if (WRITE)
+				{
+					_mm256_storeu_ps(pDstZ, _mm256_blendv_ps(Z, rZ, Mask));
+				}
+			}
+
+			if (!WRITE && CULL && _mm256_movemask_ps(Visible) != 0xff)
+			{
+				break;
+			}
+		}
+
+		const bool bVisible = CULL && _mm256_movemask_ps(Visible) != 0xff;
+		_mm256_zeroupper(); // avoid the AVX-SSE transition penalty in the calling SSE code
+		return bVisible;
+	}
+#endif
+
 	inline bool Quad2D(const NVMath::vec4& rV0, const NVMath::vec4& rV1, const NVMath::vec4& rV3, const NVMath::vec4& rV2)
 	{
 		using namespace NVMath;
@@ -456,8 +574,25 @@ public:
 		m_DebugRender = 0;
 		m_nNumWorker = 0;
 		m_ZBufferSwap = NULL;
+		m_bAVX2 = false;
+	}
+
+	static bool IsAVX2Supported()
+	{
+#ifdef CULL_RENDERER_AVX2
+		return (gEnv->pSystem->GetCPUFlags() & CPUF_AVX2) != 0;
+#else
+		return false;
+#endif
 	}
 
+	// Selects the AVX2 span kernels if the CPU supports them, must not be called while rasterizing.
+	void SetAVX2(bool bEnable) { m_bAVX2 = bEnable && IsAVX2Supported(); }
+	bool IsAVX2() const        { return m_bAVX2; }
+
+	tdZexel*       ZBuffer()       { return m_ZOutput; }
+	const tdZexel* ZBuffer() const { return m_ZOutput; }
+
 	~CCullRenderer()
 	{
 		for (uint32 i = 0; i < m_nNumWorker; ++i)
@@ -1194,12 +1329,15 @@ public:
 	}
 
 	template<bool NEEDCLIPPING>
-	inline void Rasterize(const NVMath::vec4* pViewProj, const NVMath::vec4* __restrict pTriangles, size_t TriCount)
+	inline void Rasterize(const NVMath::vec4* pViewProj, const NVMath::vec4* __restrict pTriangles, size_t TriCount, uint32 BandMinY = 0, uint32 BandMaxY = SIZEY)
 	{
 		using namespace NVMath;
 		Prefetch<ECL_LVL1>(pTriangles);
-		m_DrawCall++;
-		m_PolyCount += TriCount;
+		if (BandMinY == 0)
+		{
+			m_DrawCall++;
+			m_PolyCount += TriCount;
+		}
 
 		const vec4 M0 = pViewProj[0];
 		const vec4 M1 = pViewProj[1];
@@ -1246,7 +1384,7 @@ public:
 			{
 				for (size_t b = 0; b < VTmpCount; b += 3)
 				{
-					Triangle<true, false, true>(VTmp[b], VTmp[b + 2], VTmp[b + 1]);
+					Triangle<true, false, true>(VTmp[b], VTmp[b + 2], VTmp[b + 1], BandMinY, BandMaxY);
 				}
 			}
 			else
@@ -1388,9 +1526,9 @@ public:
 					const uint16 MinY = pMM[1];
 					const uint16 MaxX = pMM[2];
 					const uint16 MaxY = pMM[3];
-					if (MinX < MaxX && MinY < MaxY)
+					if (MinX < MaxX && MinY < MaxY && MinY < BandMaxY && MaxY > BandMinY)
 					{
-						Triangle2D<true, false, false, true>(VTmp[b], VTmp[b + 2], VTmp[b + 1], MinX, MinY, MaxX, MaxY, pDetTmp[0], pDetTmp[1]);
+						Triangle2D<true, false, false, true>(VTmp[b], VTmp[b + 2], VTmp[b + 1], MinX, MinY, MaxX, MaxY, pDetTmp[0], pDetTmp[1], BandMinY, BandMaxY);
 					}
 				}
 			}
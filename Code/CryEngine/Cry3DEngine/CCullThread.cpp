@@ -12,6 +12,7 @@ DECLARE_JOB("PrepareOcclusion_ReprojectZBuffer", TOcclusionPrepareReprojectJob,
 DECLARE_JOB("PrepareOcclusion_ReprojectZBufferLine", TOcclusionPrepareReprojectLineJob, NAsyncCull::CCullThread::PrepareOcclusion_ReprojectZBufferLine);
 DECLARE_JOB("PrepareOcclusion_ReprojectZBufferLineAfterMerge", TOcclusionPrepareReprojectLineJob2, NAsyncCull::CCullThread::PrepareOcclusion_ReprojectZBufferLineAfterMerge);
 DECLARE_JOB("PrepareOcclusion_RasterizeZBuffer", TOcclusionPrepareRasterizeJob, NAsyncCull::CCullThread::PrepareOcclusion_RasterizeZBuffer);
+DECLARE_JOB("PrepareOcclusion_RasterizeZBufferBand", TOcclusionPrepareRasterizeBandJob, NAsyncCull::CCullThread::PrepareOcclusion_RasterizeZBufferBand);
 
 typedef NAsyncCull::CCullRenderer<CULL_SIZEX, CULL_SIZEY> tdCullRasterizer;
 
@@ -31,6 +32,7 @@ CCullThread::CCullThread()
 	, m_nPrepareState(IDLE)
 	, m_nRunningReprojJobs(0)
 	, m_nRunningReprojJobsAfterMerge(0)
+	, m_nRunningRasterizeJobs(0)
 	, m_bCheckOcclusionRequested(0)
 	, m_pCheckOcclusionJob(nullptr)
 	, m_ViewDir(ZERO)
@@ -42,6 +44,7 @@ CCullThread::CCullThread()
 	, m_OCMMeshCount(0)
 	, m_OCMInstCount(0)
 	, m_OCMOffsetInstances(0)
+	, m_nBenchmarkRuns(0)
 {
 	ZeroArray(m_passInfoForCheckOcclusion);
 
@@ -247,6 +250,10 @@ void CCullThread::UnloadLevel()
 	m_OCMInstCount = 0;
 	m_OCMOffsetInstances = 0;
 
+	stl::free_container(m_Occluders);
+	stl::free_container(m_BenchmarkOccluders);
+	m_nBenchmarkRuns = 0;
+
 	if (m_pCheckOcclusionJob)
 		delete static_cast<TOcclusionCheckJob*>(m_pCheckOcclusionJob);
 	m_pCheckOcclusionJob = NULL;
@@ -411,15 +418,17 @@ float DistToBox(Vec3 Center, Vec3 Extends, Vec3 ViewPos)
 	return Delta.x * Delta.x + Delta.y * Delta.y + Delta.z * Delta.z;
 }
 
-void CCullThread::RasterizeZBuffer(uint32 PolyLimit)
+bool CCullThread::CollectOccluders(uint32 PolyLimit)
 {
 	if (m_OCMInstCount == 0)
 	{
 		float fRed[4] = { 1, 0, 0, 1 };
 		IRenderAuxText::Draw2dLabel(1.0f, 5.0f, 1.6f, fRed, false, "OCM file failed to load -> no occlusion checking possible!");
-		return;
+		return false;
 	}
 
+	m_Occluders.clear();
+
 	uint Tmp[16 * sizeof(float) * 2 + 16];
 	const uint8* pMeshes = m_pOCMBufferAligned; //actually starts at 16, but MeshOffset is zero based
 	uint8* pInstances = &m_pOCMBufferAligned[m_OCMOffsetInstances];
@@ -429,7 +438,6 @@ void CCullThread::RasterizeZBuffer(uint32 PolyLimit)
 	//	Indices[a]	=	a;
 
 	Matrix44A& rTmp0 = *reinterpret_cast<Matrix44A*>((reinterpret_cast<size_t>(Tmp) + 15) & ~15);
-	Matrix44A& rTmp1 = *reinterpret_cast<Matrix44A*>((reinterpret_cast<size_t>(Tmp) + 15 + 64) & ~15);
 	rTmp0 = m_MatScreenViewProj.GetTransposed();
 	//rTmp	=	m_MatScreenViewProjTransposed;
 
@@ -474,48 +482,17 @@ void CCullThread::RasterizeZBuffer(uint32 PolyLimit)
 	//OutputMeshList();
 	//__SetHWThreadPriorityHigh();
 
-	const bool EarlyOut = GetCVars()->e_CoverageBufferEarlyOut == 1;
-	const int64 MaxEarlyOutDelay = (int64)(GetCVars()->e_CoverageBufferEarlyOutDelay * 1000.0f);
-	LastDist = -1.f;
-
-	ITimer* pTimer = gEnv->pTimer;
-	int64 StartTime = -1;
-
 	for (size_t a = 0; a < m_OCMInstCount && (PolyLimit == 0 || Poly < PolyLimit); a++)
 	{
-		// stop if MT need to run check occlusion
-		if (EarlyOut && *const_cast<volatile int*>(&m_bCheckOcclusionRequested))
-		{
-			if (StartTime < 0)
-				StartTime = pTimer->GetAsyncTime().GetMicroSecondsAsInt64();
-
-			int64 CurTime = pTimer->GetAsyncTime().GetMicroSecondsAsInt64();
-			if (CurTime - StartTime > MaxEarlyOutDelay)
-				break;
-		}
-
 		Matrix44 World(IDENTITY);
 		uint8* pInstance = pInstances + a * (sizeof(int) + 12 * sizeof(float));//meshoffset+worldmatrix43
 		const uint32 MeshOffset = *reinterpret_cast<volatile const uint32*>(&pInstance[0]);
 		const float* pWorldMat = reinterpret_cast<const float*>(&pInstance[4]);
 		memcpy(&World, (void*)pWorldMat, 12 * sizeof(float));
-		//World	=	World.GetInverted();
 		Vec3 Pos = World.GetTranslation(), Extend;
 		Extend.x = (fabsf(World.m00) + fabsf(World.m01) + fabsf(World.m02)) * (127.f);
 		Extend.y = (fabsf(World.m10) + fabsf(World.m11) + fabsf(World.m12)) * (127.f);
 		Extend.z = (fabsf(World.m20) + fabsf(World.m21) + fabsf(World.m22)) * (127.f);
-		/*
-		    //simple incremental bubblesort
-		    const float Dist	=	DistToBox(Pos,Extend,m_Position);
-		    if(Dist<LastDist)
-		    {
-		      for(size_t a=0;a<13;a++)
-		        std::swap(reinterpret_cast<uint32*>(pLastInstance)[a],reinterpret_cast<uint32*>(pInstance)[a]);
-		    }
-		    else
-		      LastDist	=	Dist;
-		    pLastInstance	=	pInstance;
-		 */
 		const int InFrustum = RASTERIZER.AABBInFrustum(reinterpret_cast<NVMath::vec4*>(&rTmp0), Pos - Extend, Pos + Extend, m_Position);
 		if (!InFrustum)
 		{
@@ -525,18 +502,111 @@ void CCullThread::RasterizeZBuffer(uint32 PolyLimit)
 		else
 			Visible++;
 
-		rTmp1 = (m_MatScreenViewProj * World).GetTransposed();
 		const uint8* pMesh = pMeshes + MeshOffset;
 		const size_t TriCount = *reinterpret_cast<const uint32*>(pMesh);
 		const size_t Tris16 = (reinterpret_cast<size_t>(pMesh + 4) + 15) & ~15;
-		const int8* pTris = reinterpret_cast<const int8*>(Tris16);
-		if (InFrustum & 2)
-			RASTERIZER.Rasterize<true>(reinterpret_cast<NVMath::vec4*>(&rTmp1), reinterpret_cast<const NVMath::vec4*>(pTris), TriCount);
-		else
-			RASTERIZER.Rasterize<false>(reinterpret_cast<NVMath::vec4*>(&rTmp1), reinterpret_cast<const NVMath::vec4*>(pTris), TriCount);
+
+		m_Occluders.push_back(SOccluder());
+		SOccluder& rOccluder = m_Occluders.back();
+		rOccluder.matScreenViewProjWorldT = (m_MatScreenViewProj * World).GetTransposed();
+		rOccluder.pTris = reinterpret_cast<const int8*>(Tris16);
+		rOccluder.nTriCount = TriCount;
+		rOccluder.bNeedClipping = (InFrustum & 2) != 0;
 		Poly += TriCount;
 	}
 
+	return true;
+}
+
+void CCullThread::RasterizeOccluders(const SOccluder* pOccluders, size_t nCount, uint32 nMinY, uint32 nMaxY, bool bEarlyOut)
+{
+	const bool EarlyOut = bEarlyOut && GetCVars()->e_CoverageBufferEarlyOut == 1;
+	const int64 MaxEarlyOutDelay = (int64)(GetCVars()->e_CoverageBufferEarlyOutDelay * 1000.0f);
+
+	ITimer* pTimer = gEnv->pTimer;
+	int64 StartTime = -1;
+
+	for (size_t a = 0; a < nCount; a++)
+	{
+		// stop if MT need to run check occlusion
+		if (EarlyOut && *const_cast<volatile int*>(&m_bCheckOcclusionRequested))
+		{
+			if (StartTime < 0)
+				StartTime = pTimer->GetAsyncTime().GetMicroSecondsAsInt64();
+
+			int64 CurTime = pTimer->GetAsyncTime().GetMicroSecondsAsInt64();
+			if (CurTime - StartTime > MaxEarlyOutDelay)
+				break;
+		}
+
+		const SOccluder& rOccluder = pOccluders[a];
+		const NVMath::vec4* pMatrix = reinterpret_cast<const NVMath::vec4*>(&rOccluder.matScreenViewProjWorldT);
+		if (rOccluder.bNeedClipping)
+			RASTERIZER.Rasterize<true>(pMatrix, reinterpret_cast<const NVMath::vec4*>(rOccluder.pTris), rOccluder.nTriCount, nMinY, nMaxY);
+		else
+			RASTERIZER.Rasterize<false>(pMatrix, reinterpret_cast<const NVMath::vec4*>(rOccluder.pTris), rOccluder.nTriCount, nMinY, nMaxY);
+	}
+}
+
+void CCullThread::RunRasterizerBenchmark(int nRuns)
+{
+	m_BenchmarkOccluders = m_Occluders;
+
+	size_t nTriCount = 0;
+	for (size_t i = 0; i < m_BenchmarkOccluders.size(); i++)
+		nTriCount += m_BenchmarkOccluders[i].nTriCount;
+
+	// every run starts from the reprojected depth of this frame, which is restored at the end
+	const size_t nZBufferSize = tdCullRasterizer::RESOLUTION_X * tdCullRasterizer::RESOLUTION_Y * sizeof(tdZexel);
+	PodArray<tdZexel> savedZBuffer;
+	savedZBuffer.resize(tdCullRasterizer::RESOLUTION_X * tdCullRasterizer::RESOLUTION_Y);
+	memcpy(savedZBuffer.GetElements(), RASTERIZER.ZBuffer(), nZBufferSize);
+
+	const bool bAVX2 = RASTERIZER.IsAVX2();
+	const int nBands = max(GetCVars()->e_CoverageBufferRastJobs, 1);
+	const uint32 nLinesPerBand = (tdCullRasterizer::RESOLUTION_Y + nBands - 1) / nBands;
+
+	CryLogAlways("Coverage buffer benchmark: %" PRISIZE_T " occluders, %" PRISIZE_T " triangles, %d runs", m_BenchmarkOccluders.size(), nTriCount, nRuns);
+
+	// kernel x (whole buffer, bands rasterized one after another)
+	for (int nTest = 0; nTest < 4; nTest++)
+	{
+		const bool bTestAVX2 = (nTest & 1) != 0;
+		const bool bTestBands = (nTest & 2) != 0;
+		if (bTestAVX2 && !tdCullRasterizer::IsAVX2Supported())
+		{
+			if (!bTestBands)
+				CryLogAlways("    AVX2: not supported by this CPU");
+			continue;
+		}
+
+		RASTERIZER.SetAVX2(bTestAVX2);
+
+		int64 nTime = 0;
+		for (int nRun = 0; nRun < nRuns; nRun++)
+		{
+			memcpy(RASTERIZER.ZBuffer(), savedZBuffer.GetElements(), nZBufferSize);
+
+			const int64 nStart = gEnv->pTimer->GetAsyncTime().GetMicroSecondsAsInt64();
+			if (bTestBands)
+			{
+				for (uint32 nMinY = 0; nMinY < tdCullRasterizer::RESOLUTION_Y; nMinY += nLinesPerBand)
+					RasterizeOccluders(m_BenchmarkOccluders.data(), m_BenchmarkOccluders.size(), nMinY, min(nMinY + nLinesPerBand, (uint32)tdCullRasterizer::RESOLUTION_Y), false);
+			}
+			else
+			{
+				RasterizeOccluders(m_BenchmarkOccluders.data(), m_BenchmarkOccluders.size(), 0, tdCullRasterizer::RESOLUTION_Y, false);
+			}
+			nTime += gEnv->pTimer->GetAsyncTime().GetMicroSecondsAsInt64() - nStart;
+		}
+
+		const float fMsPerRun = (float)nTime / (1000.f * nRuns);
+		CryLogAlways("    %s%s: %.3f ms per run, %.1f triangles/ms", bTestAVX2 ? "AVX2" : "SSE", bTestBands ? string().Format(", %d bands serial", nBands).c_str() : "",
+		             fMsPerRun, fMsPerRun > 0.f ? (float)nTriCount / fMsPerRun : 0.f);
+	}
+
+	memcpy(RASTERIZER.ZBuffer(), savedZBuffer.GetElements(), nZBufferSize);
+	RASTERIZER.SetAVX2(bAVX2);
 }
 
 #if !defined(_RELEASE)
@@ -674,10 +744,61 @@ void CCullThread::PrepareOcclusion_RasterizeZBuffer()
 			CRY_PROFILE_REGION(PROFILE_3DENGINE, "Rasterize Z-Buffer");
 			CRYPROFILE_SCOPE_PROFILE_MARKER("Rasterize Z-Buffer");
 			m_Enabled = true;
-			RasterizeZBuffer((uint32)PolyLimit);
+			RASTERIZER.SetAVX2(GetCVars()->e_CoverageBufferRastAVX2 != 0);
+
+			if (CollectOccluders((uint32)PolyLimit))
+			{
+				const int nBenchmarkRuns = GetCVars()->e_CoverageBufferRastBenchmark;
+				if (nBenchmarkRuns != m_nBenchmarkRuns)
+				{
+					m_nBenchmarkRuns = nBenchmarkRuns;
+					if (nBenchmarkRuns > 0)
+						RunRasterizerBenchmark(nBenchmarkRuns);
+					else
+						stl::free_container(m_BenchmarkOccluders);
+				}
+
+				// split the buffer into bands of lines, the last finished band job finishes the prepare step
+				const int nBands = clamp_tpl(GetCVars()->e_CoverageBufferRastJobs, 1, (int)tdCullRasterizer::RESOLUTION_Y / 8);
+				if (nBands > 1 && !m_Occluders.empty())
+				{
+					m_nRunningRasterizeJobs = nBands;
+					for (int i = 0; i < nBands; i++)
+					{
+						TOcclusionPrepareRasterizeBandJob job(i, nBands);
+						job.SetClassInstance(this);
+						job.SetPriorityLevel(JobManager::eHighPriority);
+						job.Run();
+					}
+					return;
+				}
+
+				RasterizeOccluders(m_Occluders.data(), m_Occluders.size(), 0, tdCullRasterizer::RESOLUTION_Y, true);
+			}
 		}
 	}
 
+	PrepareOcclusion_FinishRasterize();
+}
+
+void CCullThread::PrepareOcclusion_RasterizeZBufferBand(int nBand, int nBands)
+{
+	{
+		CRY_PROFILE_REGION(PROFILE_3DENGINE, "Rasterize Z-Buffer Band");
+		const uint32 nLinesPerBand = (tdCullRasterizer::RESOLUTION_Y + nBands - 1) / nBands;
+		const uint32 nMinY = nBand * nLinesPerBand;
+		const uint32 nMaxY = min(nMinY + nLinesPerBand, (uint32)tdCullRasterizer::RESOLUTION_Y);
+		if (nMinY < nMaxY)
+			RasterizeOccluders(m_Occluders.data(), m_Occluders.size(), nMinY, nMaxY, true);
+	}
+
+	uint32 nRemainingJobs = CryInterlockedDecrement((volatile int*)&m_nRunningRasterizeJobs);
+	if (nRemainingJobs == 0)
+		PrepareOcclusion_FinishRasterize();
+}
+
+void CCullThread::PrepareOcclusion_FinishRasterize()
+{
 	bool bNeedJobStart = false;
 	{
 		AUTO_LOCK(m_FollowUpLock);
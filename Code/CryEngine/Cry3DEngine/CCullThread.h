@@ -21,6 +21,7 @@ public:
 	char m_passInfoForCheckOcclusion[sizeof(SRenderingPassInfo)];
 	uint32 m_nRunningReprojJobs;
 	uint32 m_nRunningReprojJobsAfterMerge;
+	uint32 m_nRunningRasterizeJobs;
 	int m_bCheckOcclusionRequested;
 private:
 	void* m_pCheckOcclusionJob;
@@ -40,6 +41,18 @@ private:
 	uint32 m_OCMInstCount;
 	uint32 m_OCMOffsetInstances;
 
+	// occluder instance in the view frustum, ready to be rasterized
+	struct SOccluder
+	{
+		Matrix44A   matScreenViewProjWorldT;
+		const int8* pTris;
+		uint32      nTriCount;
+		bool        bNeedClipping;
+	};
+	stl::aligned_vector<SOccluder, 16> m_Occluders;
+	stl::aligned_vector<SOccluder, 16> m_BenchmarkOccluders;
+	int m_nBenchmarkRuns;                               // e_CoverageBufferRastBenchmark value the benchmark last ran for
+
 	template<class T>
 	T Swap(T& rData)
 	{
@@ -65,7 +78,9 @@ private:
 		return rData;
 	}
 
-	void RasterizeZBuffer(uint32 PolyLimit);
+	bool CollectOccluders(uint32 PolyLimit);
+	void RasterizeOccluders(const SOccluder* pOccluders, size_t nCount, uint32 nMinY, uint32 nMaxY, bool bEarlyOut);
+	void RunRasterizerBenchmark(int nRuns);
 	void OutputMeshList();
 
 public:
@@ -74,6 +89,8 @@ public:
 	void PrepareOcclusion();
 
 	void PrepareOcclusion_RasterizeZBuffer();
+	void PrepareOcclusion_RasterizeZBufferBand(int nBand, int nBands);
+	void PrepareOcclusion_FinishRasterize();
 	void PrepareOcclusion_ReprojectZBuffer();
 	void PrepareOcclusion_ReprojectZBufferLine(int nStartLine, int nNumLines);
 	void PrepareOcclusion_ReprojectZBufferLineAfterMerge(int nStartLine, int nNumLines);
@@ -798,6 +798,44 @@ void CDecalManager::Update(const float fFrameTime)
 	}
 
 	m_arrTempUpdatedOwners.Clear();
+
+	FadeDecalsOverBudget();
+}
+
+int CDecalManager::GetActiveDecalsCount() const
+{
+	int nActive = 0;
+	for (int i = 0; i < DECAL_COUNT; i++)
+		nActive += m_arrbActiveDecals[i];
+	return nActive;
+}
+
+void CDecalManager::FadeDecalsOverBudget()
+{
+	const int nBudget = GetCVars()->e_DecalsActiveBudget;
+	if (nBudget <= 0 || nBudget >= DECAL_COUNT)
+		return;
+
+	int nExcess = GetActiveDecalsCount() - nBudget;
+	if (nExcess <= 0)
+		return;
+
+	// slots are written in ring order, so the slots ahead of the write position hold the oldest decals;
+	// let them run through the alpha fade of the last half second of their life instead of popping when reused.
+	// Decals already fading count towards the excess, so the same decals are picked again next frame
+	const float fFadeTime = 0.5f;
+	for (int n = 0, i = m_nCurDecal & (DECAL_COUNT - 1); n < DECAL_COUNT && nExcess > 0; n++, i = (i + 1) & (DECAL_COUNT - 1))
+	{
+		if (!m_arrbActiveDecals[i])
+			continue;
+
+		CDecal& decal = m_arrDecals[i];
+		if (decal.m_fLifeTime >= 10000) // decals spawn by cut scenes need to stay
+			continue;
+
+		decal.m_fLifeTime = min(decal.m_fLifeTime, fFadeTime);
+		--nExcess;
+	}
 }
 
 void CDecalManager::Render(const SRenderingPassInfo& passInfo)
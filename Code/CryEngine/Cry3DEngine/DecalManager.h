@@ -150,6 +150,7 @@ public: // ---------------------------------------------------------------
 	_smart_ptr<IRenderMesh> MakeBigDecalRenderMesh(IRenderMesh* pSourceRenderMesh, Vec3 vPos, float fRadius, Vec3 vProjDir, IMaterial* pDecalMat, IMaterial* pSrcMat);
 	void                    MoveToEdge(IRenderMesh* pRM, const float fRadius, Vec3& vPos, Vec3& vOutNorm, const Vec3& vTri0, const Vec3& vTri1, const Vec3& vTri2);
 	void                    GetMemoryUsage(ICrySizer* pSizer) const;
+	int                     GetActiveDecalsCount() const;
 	void                    Reset() { memset(m_arrbActiveDecals, 0, sizeof(m_arrbActiveDecals)); m_nCurDecal = 0; }
 	void                    DeleteDecalsInRange(AABB* pAreaBox, IRenderNode* pEntity);
 	bool                    AdjustDecalPosition(CryEngineDecalInfo& DecalInfo, bool bMakeFatTest);
@@ -159,6 +160,7 @@ public: // ---------------------------------------------------------------
 
 private:
 	IMaterial* GetMaterialForDecalTexture(const char* pTextureName);
+	void       FadeDecalsOverBudget();
 };
 
 #endif // DECAL_MANAGER
@@ -41,6 +41,15 @@ CGeomCacheManager::CGeomCacheManager()
 	, m_numDecompressStreamAborts(0)
 	, m_numReadStreamAborts(0)
 	, m_numFailedAllocs(0)
+	, m_decodeMicroSeconds(0)
+	, m_numDecodedFrames(0)
+	, m_lastDecodeTimeMs(0.0f)
+	, m_lastNumDecodedFrames(0)
+	#ifndef _RELEASE
+	, m_benchmarkPhase(-1)
+	, m_benchmarkPhaseTime(0.0f)
+	, m_benchmarkScrubTime(0.0f)
+	#endif
 {
 	MEMSTAT_CONTEXT(EMemStatContextTypes::MSC_GeomCache, 0, "Geometry cache streaming pool");
 
@@ -302,6 +311,11 @@ void CGeomCacheManager::StreamingUpdate()
 	const bool bCachesActive = GetCVars()->e_GeomCaches != 0;
 
 	RetireRemovedStreams();
+	UpdateDecodeStats();
+
+	#ifndef _RELEASE
+	UpdateBenchmark();
+	#endif
 
 	const uint numStreams = m_streamInfos.size();
 	for (uint i = 0; i < numStreams; ++i)
@@ -321,6 +335,7 @@ void CGeomCacheManager::StreamingUpdate()
 		streamInfo.m_wantedFloorFrame = pGeomCache->GetFloorFrameIndex(streamInfo.m_wantedPlaybackTime);
 		streamInfo.m_wantedCeilFrame = pGeomCache->GetCeilFrameIndex(streamInfo.m_wantedPlaybackTime);
 		streamInfo.m_bLooping = streamInfo.m_pRenderNode->IsLooping();
+		UpdatePlaybackSpeed(streamInfo);
 
 		if (!streamInfo.m_bLooping)
 		{
@@ -394,6 +409,142 @@ void CGeomCacheManager::StreamingUpdate()
 	#endif
 }
 
+void CGeomCacheManager::UpdatePlaybackSpeed(SGeomCacheStreamInfo& streamInfo)
+{
+	const float playbackTime = streamInfo.m_wantedPlaybackTime;
+	const float lastPlaybackTime = streamInfo.m_lastPlaybackTime;
+	const float frameTime = GetTimer()->GetFrameTime();
+	streamInfo.m_lastPlaybackTime = playbackTime;
+
+	if (lastPlaybackTime < 0.0f || frameTime <= 0.0f || !streamInfo.m_pRenderNode->IsStreaming())
+	{
+		return;
+	}
+
+	// Jumps backwards or further than the maximum buffer ahead time are seeks (or loop wraps) and don't tell the speed
+	const float delta = playbackTime - lastPlaybackTime;
+	const float maxBufferAheadTime = std::max(1.0f, GetCVars()->e_GeomCacheMaxBufferAheadTime);
+	if (delta < 0.0f || delta > maxBufferAheadTime)
+	{
+		return;
+	}
+
+	const float speed = delta / frameTime;
+	streamInfo.m_playbackSpeed += (speed - streamInfo.m_playbackSpeed) * std::min(1.0f, frameTime * 4.0f);
+}
+
+float CGeomCacheManager::GetReadAheadScale(const SGeomCacheStreamInfo& streamInfo) const
+{
+	const float maxScale = std::max(1.0f, GetCVars()->e_GeomCacheMaxReadAheadScale);
+	return clamp_tpl(streamInfo.m_playbackSpeed, 1.0f, maxScale);
+}
+
+void CGeomCacheManager::UpdateDecodeStats()
+{
+	const LONG decodeMicroSeconds = CryInterlockedExchange(&m_decodeMicroSeconds, 0);
+	const LONG numDecodedFrames = CryInterlockedExchange(&m_numDecodedFrames, 0);
+
+	m_lastDecodeTimeMs = (float)decodeMicroSeconds / 1000.0f;
+	m_lastNumDecodedFrames = (uint)numDecodedFrames;
+}
+
+	#ifndef _RELEASE
+void CGeomCacheManager::UpdateBenchmark()
+{
+	const int phaseDuration = GetCVars()->e_GeomCacheBenchmark;
+	if (phaseDuration <= 0)
+	{
+		m_benchmarkPhase = -1;
+		return;
+	}
+
+	static const char* s_phaseNames[] = { "1x", "2x", "scrub" };
+	static const float s_phaseSpeeds[] = { 1.0f, 2.0f, 1.0f };
+	const int kNumPhases = CRY_ARRAY_COUNT(s_phaseNames);
+
+	const float frameTime = GetTimer()->GetFrameTime();
+
+	if (m_benchmarkPhase >= 0)
+	{
+		m_benchmarkStats.m_decodeTimeMs += m_lastDecodeTimeMs;
+		m_benchmarkStats.m_numDecodedFrames += m_lastNumDecodedFrames;
+		++m_benchmarkStats.m_numFrames;
+		m_benchmarkPhaseTime += frameTime;
+	}
+
+	if (m_benchmarkPhase < 0 || m_benchmarkPhaseTime >= (float)phaseDuration)
+	{
+		if (m_benchmarkPhase >= 0)
+		{
+			const SBenchmarkPhase& stats = m_benchmarkStats;
+			CryLogAlways("GeomCache benchmark %s: %u frames, decode %.2f ms total, %.3f ms/frame, %u frames decoded, %u frames missed, %u stream aborts",
+			             s_phaseNames[m_benchmarkPhase], stats.m_numFrames, stats.m_decodeTimeMs, stats.m_decodeTimeMs / (float)std::max(1u, stats.m_numFrames),
+			             stats.m_numDecodedFrames, m_numMissedFrames - stats.m_startMissedFrames, m_numStreamAborts - stats.m_startStreamAborts);
+		}
+
+		if (++m_benchmarkPhase >= kNumPhases)
+		{
+			CryLogAlways("GeomCache benchmark finished");
+			GetCVars()->e_GeomCacheBenchmark = 0;
+			m_benchmarkPhase = -1;
+			return;
+		}
+
+		if (m_benchmarkPhase == 0)
+		{
+			CryLogAlways("GeomCache benchmark: %u stream(s), %d seconds per phase", (uint)m_streamInfos.size(), phaseDuration);
+		}
+
+		// Every phase starts from the beginning of the caches
+		const uint numStreams = m_streamInfos.size();
+		for (uint i = 0; i < numStreams; ++i)
+		{
+			m_streamInfos[i]->m_pRenderNode->SetPlaybackTime(0.0f);
+		}
+
+		memset(&m_benchmarkStats, 0, sizeof(m_benchmarkStats));
+		m_benchmarkStats.m_startMissedFrames = m_numMissedFrames;
+		m_benchmarkStats.m_startStreamAborts = m_numStreamAborts;
+		m_benchmarkPhaseTime = 0.0f;
+		m_benchmarkScrubTime = 0.0f;
+		return;
+	}
+
+	// Scrubbing jumps to a random time twice a second and plays normally in between
+	const bool bScrub = (m_benchmarkPhase == kNumPhases - 1);
+	m_benchmarkScrubTime += frameTime;
+	const bool bJump = bScrub && m_benchmarkScrubTime >= 0.5f;
+	if (bJump)
+	{
+		m_benchmarkScrubTime = 0.0f;
+	}
+
+	const uint numStreams = m_streamInfos.size();
+	for (uint i = 0; i < numStreams; ++i)
+	{
+		CGeomCacheRenderNode* pRenderNode = m_streamInfos[i]->m_pRenderNode;
+		const CGeomCache* pGeomCache = m_streamInfos[i]->m_pGeomCache;
+		if (!pGeomCache)
+		{
+			continue;
+		}
+
+		const float duration = pGeomCache->GetDuration();
+		float playbackTime = pRenderNode->GetPlaybackTime() + frameTime * s_phaseSpeeds[m_benchmarkPhase];
+		if (bJump)
+		{
+			playbackTime = cry_random(0.0f, duration);
+		}
+		else if (playbackTime > duration)
+		{
+			playbackTime = 0.0f;
+		}
+
+		pRenderNode->SetPlaybackTime(playbackTime);
+	}
+}
+	#endif
+
 void CGeomCacheManager::LaunchStreamingJobs(const uint numStreams, const CTimeValue currentFrameTime)
 {
 	FUNCTION_PROFILER_3DENGINE;
@@ -699,8 +850,9 @@ bool CGeomCacheManager::IssueDiskReadRequest(SGeomCacheStreamInfo& streamInfo)
 	const float currentCacheStreamingTime = streamInfo.m_pRenderNode->GetStreamingTime();
 	const uint wantedFloorFrame = pGeomCache->GetFloorFrameIndex(currentCacheStreamingTime);
 	const uint wantedCeilFrame = pGeomCache->GetCeilFrameIndex(currentCacheStreamingTime);
-	const float minBufferAheadTime = std::max(0.1f, GetCVars()->e_GeomCacheMinBufferAheadTime);
-	const float maxBufferAheadTime = std::max(1.0f, GetCVars()->e_GeomCacheMaxBufferAheadTime);
+	const float readAheadScale = GetReadAheadScale(streamInfo);
+	const float minBufferAheadTime = std::max(0.1f, GetCVars()->e_GeomCacheMinBufferAheadTime) * readAheadScale;
+	const float maxBufferAheadTime = std::max(1.0f, GetCVars()->e_GeomCacheMaxBufferAheadTime) * readAheadScale;
 	const float cacheMinBufferAhead = currentCacheStreamingTime + minBufferAheadTime;
 	const float cacheMaxBufferAhead = currentCacheStreamingTime + maxBufferAheadTime;
 
@@ -811,7 +963,7 @@ bool CGeomCacheManager::IssueDiskReadRequest(SGeomCacheStreamInfo& streamInfo)
 		}
 
 		const float timeLeft = std::max(pGeomCache->GetFrameTime(frameRangeBegin) - currentCacheStreamingTime
-		                                - static_cast<float>(GetCVars()->e_GeomCacheDecodeAheadTime), 0.0f);
+		                                - GetCVars()->e_GeomCacheDecodeAheadTime * readAheadScale, 0.0f);
 
 		// Fill read request params
 		params.nOffset = static_cast<uint>(pGeomCache->GetFrameOffset(frameRangeBegin));
@@ -896,7 +1048,7 @@ void CGeomCacheManager::LaunchDecompressJobs(SGeomCacheStreamInfo* pStreamInfo,
 
 		// Stop decoding after e_GeomCacheDecodeAheadTime
 		const float blockDeltaFromPlaybackTime = (pGeomCache->GetFrameTime(pReadRequestHandle->m_startFrame) - currentCacheStreamingTime);
-		const float decodeAheadTime = GetCVars()->e_GeomCacheDecodeAheadTime;
+		const float decodeAheadTime = GetCVars()->e_GeomCacheDecodeAheadTime * GetReadAheadScale(*pStreamInfo);
 		if (blockDeltaFromPlaybackTime > decodeAheadTime)
 		{
 			return;
@@ -1075,6 +1227,12 @@ void CGeomCacheManager::LaunchDecodeJob(SDecodeFrameJobData jobData)
 	}
 }
 
+void CGeomCacheManager::AddDecodeTime(const int64 ticks)
+{
+	CryInterlockedAdd(&m_decodeMicroSeconds, (LONG)(gEnv->pTimer->TicksToSeconds(ticks) * 1000000.0f));
+	CryInterlockedAdd(&m_numDecodedFrames, 1);
+}
+
 void CGeomCacheManager::DecodeIFrame_JobEntry(SDecodeFrameJobData jobData)
 {
 	FUNCTION_PROFILER_3DENGINE;
@@ -1082,7 +1240,9 @@ void CGeomCacheManager::DecodeIFrame_JobEntry(SDecodeFrameJobData jobData)
 	if (!jobData.m_pStreamInfo->m_bAbort && !jobData.m_pStreamInfo->m_pDecompressAbortListHead)
 	{
 		char* pFrameData = GetFrameDecompressData(jobData.m_pStreamInfo, jobData.m_frameIndex);
+		const int64 startTicks = CryGetTicks();
 		GeomCacheDecoder::DecodeIFrame(jobData.m_pGeomCache, pFrameData);
+		AddDecodeTime(CryGetTicks() - startTicks);
 
 		SGeomCacheFrameHeader* pHeader = GetFrameDecompressHeader(jobData.m_pStreamInfo, jobData.m_frameIndex);
 
@@ -1177,7 +1337,9 @@ void CGeomCacheManager::DecodeBFrame_JobEntry(SDecodeFrameJobData jobData)
 		char* pFloorIndexFrameData = GetFrameDecompressData(jobData.m_pStreamInfo, prevIFrame);
 		char* pCeilIndexFrameData = GetFrameDecompressData(jobData.m_pStreamInfo, nextIFrame);
 
+		const int64 startTicks = CryGetTicks();
 		GeomCacheDecoder::DecodeBFrame(jobData.m_pGeomCache, pFrameData, pPrevFramesData, pFloorIndexFrameData, pCeilIndexFrameData);
+		AddDecodeTime(CryGetTicks() - startTicks);
 
 		SGeomCacheFrameHeader* pHeader = GetFrameDecompressHeader(jobData.m_pStreamInfo, jobData.m_frameIndex);
 
@@ -1743,8 +1905,9 @@ void CGeomCacheManager::DrawDebugInfo()
 				pCompressionMethod = "LZ4 HC";
 			}
 
-			IRenderAuxText::Draw2dLabel(sideOffset + streamInfoSpacing, currentTop - 5.0f, 1.5f, Col_White, false, "%s - %.3gs %s- %.3g MiB/s - %s - %d frames missed",
-			                             streamInfo.m_pRenderNode->GetName(), pGeomCache->GetDuration(), streamInfo.m_bLooping ? "looping " : "", stats.m_averageAnimationDataRate, pCompressionMethod, streamInfo.m_numFramesMissed);
+			IRenderAuxText::Draw2dLabel(sideOffset + streamInfoSpacing, currentTop - 5.0f, 1.5f, Col_White, false, "%s - %.3gs %s- %.3g MiB/s - %s - %d frames missed - speed %.2f, read ahead x%.2f",
+			                             streamInfo.m_pRenderNode->GetName(), pGeomCache->GetDuration(), streamInfo.m_bLooping ? "looping " : "", stats.m_averageAnimationDataRate, pCompressionMethod, streamInfo.m_numFramesMissed,
+			                             streamInfo.m_playbackSpeed, GetReadAheadScale(streamInfo));
 			IRenderAuxText::Draw2dLabel(sideOffset + streamInfoSpacing, streamInfoSpacing + currentTop - 5.0f, 1.5f, Col_White, false,
 			                             "Frame: [%04u, %04u], Disk Frames: [%04u, %04u], Decompress Frames: [%04u, %04u], Playback time: %g", wantedFloorFrame, wantedCeilFrame,
 			                             oldestDiskFrame, newestDiskFrame, oldestDecompressFrame, newestDecompressFrame, wantedPlaybackTime);
@@ -1761,6 +1924,7 @@ void CGeomCacheManager::DrawDebugInfo()
 	                             m_numStreamAborts, m_numErrorAborts, m_numDecompressStreamAborts, m_numReadStreamAborts);
 	IRenderAuxText::Draw2dLabel(sideOffset + 520.0f, 3.5f * topOffset, 1.5f, (m_numFailedAllocs > 0) ? Col_Yellow : Col_Green, false, "%u Failed alloc(s)", m_numFailedAllocs);
 	IRenderAuxText::Draw2dLabel(sideOffset + 670.0f, 3.5f * topOffset, 1.5f, (numAbortedStreams > 0) ? Col_Yellow : Col_Green, false, "%u Aborted stream(s)", numAbortedStreams);
+	IRenderAuxText::Draw2dLabel(sideOffset + 850.0f, 3.5f * topOffset, 1.5f, Col_White, false, "Decode: %.2f ms, %u frame(s)", m_lastDecodeTimeMs, m_lastNumDecodedFrames);
 
 	IRenderAuxText::Draw2dLabel(sideOffset, 6.0f * topOffset, 1.25f, Col_White, false, "Geom Cache Buffer:");
 	Draw2DBoxOutLine(bufferBoxLeft, bufferBoxTop, bufferBoxWidth, bufferBoxHeight, Col_White, screenHeight, screenWidth, pRenderAuxGeom);
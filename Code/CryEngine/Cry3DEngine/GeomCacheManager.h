@@ -93,6 +93,8 @@ struct SGeomCacheStreamInfo
 		, m_numFrames(numFrames)
 		, m_displayedFrameTime(-1.0f)
 		, m_wantedPlaybackTime(0.0f)
+		, m_lastPlaybackTime(-1.0f)
+		, m_playbackSpeed(1.0f)
 		, m_wantedFloorFrame(0)
 		, m_wantedCeilFrame(0)
 		, m_sameFrameFillCount(0)
@@ -114,6 +116,11 @@ struct SGeomCacheStreamInfo
 
 	volatile float               m_displayedFrameTime;
 	volatile float               m_wantedPlaybackTime;
+
+	// Smoothed playback speed (cache seconds per frame time second), scales the read and decode ahead times
+	float                        m_lastPlaybackTime;
+	float                        m_playbackSpeed;
+
 	volatile uint                m_wantedFloorFrame;
 	volatile uint                m_wantedCeilFrame;
 	volatile int                 m_sameFrameFillCount;
@@ -186,6 +193,9 @@ public:
 	void ResetDebugInfo() { m_numMissedFrames = 0; m_numStreamAborts = 0; m_numFailedAllocs = 0; }
 	#endif
 
+	// Scale of the buffer and decode ahead times for a stream, follows the playback speed
+	float GetReadAheadScale(const SGeomCacheStreamInfo& streamInfo) const;
+
 	void DecompressFrame_JobEntry(SGeomCacheStreamInfo* pStreamInfo, const uint blockIndex,
 	                              SGeomCacheBufferHandle* pDecompressHandle, SGeomCacheReadRequestHandle* pReadRequestHandle);
 
@@ -211,11 +221,19 @@ private:
 
 	void                                                 UnloadGeomCaches();
 
+	void                                                 UpdatePlaybackSpeed(SGeomCacheStreamInfo& streamInfo);
+	void                                                 UpdateDecodeStats();
+
+	#ifndef _RELEASE
+	void                                                 UpdateBenchmark();
+	#endif
+
 	bool                                                 IssueDiskReadRequest(SGeomCacheStreamInfo& pStreamInfo);
 
 	void                                                 LaunchStreamingJobs(const uint numStreams, const CTimeValue currentFrameTime);
 	void                                                 LaunchDecompressJobs(SGeomCacheStreamInfo* pStreamInfo, const CTimeValue currentFrameTime);
 	void                                                 LaunchDecodeJob(SDecodeFrameJobData jobState);
+	void                                                 AddDecodeTime(const int64 ticks);
 
 	template<class TBufferHandleType> TBufferHandleType* NewBufferHandle(const uint32 size, SGeomCacheStreamInfo& streamInfo);
 	SGeomCacheReadRequestHandle*                         NewReadRequestHandle(const uint32 size, SGeomCacheStreamInfo& streamInfo);
@@ -250,6 +268,29 @@ private:
 	uint                m_numReadStreamAborts;
 	uint                m_numFailedAllocs;
 
+	// Decode job time, accumulated by the jobs and harvested once per frame
+	volatile LONG       m_decodeMicroSeconds;
+	volatile LONG       m_numDecodedFrames;
+	float               m_lastDecodeTimeMs;
+	uint                m_lastNumDecodedFrames;
+
+	#ifndef _RELEASE
+	// e_GeomCacheBenchmark state, plays all streams at 1x, 2x and scrubbing for the set number of seconds each
+	struct SBenchmarkPhase
+	{
+		float m_decodeTimeMs;
+		uint  m_numDecodedFrames;
+		uint  m_numFrames;
+		uint  m_startMissedFrames;
+		uint  m_startStreamAborts;
+	};
+
+	int                 m_benchmarkPhase;
+	float               m_benchmarkPhaseTime;
+	float               m_benchmarkScrubTime;
+	SBenchmarkPhase     m_benchmarkStats;
+	#endif
+
 	typedef std::vector<SGeomCacheStreamInfo*>::iterator TStreamInfosIter;
 	std::vector<SGeomCacheStreamInfo*> m_streamInfos;
 	std::vector<SGeomCacheStreamInfo*> m_streamInfosAbortList;
@@ -1815,6 +1815,8 @@ void CLightEntity::OnCasterDeleted(IShadowCaster* pCaster)
 	if (!m_pShadowMapInfo)
 		return;
 
+	InvalidateCachedShadowCaster(pCaster);
+
 	for (int nGsmId = 0; nGsmId < MAX_GSM_LODS_NUM; nGsmId++)
 	{
 		if (ShadowMapFrustum* pFr = m_pShadowMapInfo->pGSM[nGsmId])
@@ -1829,6 +1831,32 @@ void CLightEntity::OnCasterDeleted(IShadowCaster* pCaster)
 	}
 }
 
+void CLightEntity::InvalidateCachedShadowCaster(IShadowCaster* pCaster)
+{
+	if (!m_pShadowMapInfo)
+		return;
+
+	// a caster already rendered into a cached shadow map leaves its old depth behind,
+	// remember its area so the next incremental update clears and re-renders it
+	for (int nGsmId = 0; nGsmId < MAX_GSM_LODS_NUM; nGsmId++)
+	{
+		ShadowMapFrustum* pFr = m_pShadowMapInfo->pGSM[nGsmId];
+		if (!pFr || !pFr->IsCached() || !pFr->pShadowCacheData)
+			continue;
+
+		auto& processedCasters = pFr->pShadowCacheData->mProcessedCasters;
+		auto it = processedCasters.find(pCaster);
+		if (it != processedCasters.end())
+		{
+			processedCasters.erase(it);
+
+			AABB casterBox;
+			pCaster->FillBBox(casterBox);
+			pFr->pShadowCacheData->mDirtyRegions.push_back(casterBox);
+		}
+	}
+}
+
 void CLightEntity::GetMemoryUsage(ICrySizer* pSizer) const
 {
 	SIZER_COMPONENT_NAME(pSizer, "LightEntity");
@@ -63,6 +63,7 @@ public:
 	bool                     GetGsmFrustumBounds(const CCamera& viewFrustum, ShadowMapFrustum* pShadowFrustum);
 	void                     DetectCastersListChanges(ShadowMapFrustum* pFr, const SRenderingPassInfo& passInfo);
 	void                     OnCasterDeleted(IShadowCaster* pCaster);
+	void                     InvalidateCachedShadowCaster(IShadowCaster* pCaster);
 	int                      MakeShadowCastersHull(PodArray<SPlaneObject>& lstCastersHull, const SRenderingPassInfo& passInfo);
 	static Vec3              GSM_GetNextScreenEdge(float fPrevRadius, float fPrevDistanceFromView, const SRenderingPassInfo& passInfo);
 	static float             GSM_GetLODProjectionCenter(const Vec3& vEdgeScreen, float fRadius);
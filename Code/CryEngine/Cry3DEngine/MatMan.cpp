@@ -111,13 +111,22 @@ CMatMan::~CMatMan()
 //////////////////////////////////////////////////////////////////////////
 const char* CMatMan::UnifyName(const char* sMtlName) const
 {
+	// Shared buffer, only valid while m_AccessLock is held
 	static char name[260];
+	return UnifyName(sMtlName, name);
+}
+
+//////////////////////////////////////////////////////////////////////////
+const char* CMatMan::UnifyName(const char* sMtlName, char (&name)[260]) const
+{
 	int n = strlen(sMtlName);
 
-	//TODO: change this code to not use a statically allocated buffer and return it ...
 	//TODO: provide a general name unification function, which can be used in other places as well and remove this thing
 	if (n >= 260)
+	{
 		Error("Static buffer size exceeded by material name!");
+		n = sizeof(name) - 1;
+	}
 
 	for (int i = 0; i < n && i < sizeof(name); i++)
 	{
@@ -149,7 +158,9 @@ IMaterial* CMatMan::CreateMaterial(const char* sMtlName, int nMtlFlags)
 	pMat->SetFlags(nMtlFlags | pMat->GetFlags());
 	if (!(nMtlFlags & MTL_FLAG_PURE_CHILD))
 	{
-		m_mtlNameMap[UnifyName(sMtlName)] = pMat;
+		const char* name = UnifyName(sMtlName);
+		m_mtlNameMap[name] = pMat;
+		m_mtlNameRegistry.Insert(name, pMat);
 	}
 
 	if (nMtlFlags & MTL_FLAG_NON_REMOVABLE)
@@ -233,7 +244,11 @@ void CMatMan::Unregister(CMatInfo* pMat)
 	assert(pMat);
 
 	if (!(pMat->m_Flags & MTL_FLAG_PURE_CHILD))
-		m_mtlNameMap.erase(CONST_TEMP_STRING(UnifyName(pMat->GetName())));
+	{
+		const char* name = UnifyName(pMat->GetName());
+		m_mtlNameMap.erase(CONST_TEMP_STRING(name));
+		m_mtlNameRegistry.Erase(name);
+	}
 
 	if (m_pListener)
 		m_pListener->OnDeleteMaterial(pMat);
@@ -248,33 +263,48 @@ void CMatMan::RenameMaterial(IMaterial* pMtl, const char* sNewName)
 	const char* sName = pMtl->GetName();
 	if (*sName != '\0')
 	{
-		m_mtlNameMap.erase(CONST_TEMP_STRING(UnifyName(pMtl->GetName())));
+		const char* name = UnifyName(pMtl->GetName());
+		m_mtlNameMap.erase(CONST_TEMP_STRING(name));
+		m_mtlNameRegistry.Erase(name);
 	}
 	pMtl->SetName(sNewName);
-	m_mtlNameMap[UnifyName(sNewName)] = pMtl;
+	const char* name = UnifyName(sNewName);
+	m_mtlNameMap[name] = pMtl;
+	m_mtlNameRegistry.Insert(name, pMtl);
 }
 
 //////////////////////////////////////////////////////////////////////////
 IMaterial* CMatMan::FindMaterial(const char* sMtlName) const
 {
-	AUTO_LOCK(m_AccessLock);
+	char name[260];
+	UnifyName(sMtlName, name);
 
-	const char* name = UnifyName(sMtlName);
+	IMaterial* pMtl = m_mtlNameRegistry.Find(name);
 
-	MtlNameMap::const_iterator it = m_mtlNameMap.find(CONST_TEMP_STRING(name));
-
-	if (it == m_mtlNameMap.end())
+	if (!pMtl)
 		return 0;
 
-	if (static_cast<CMatInfo*>(it->second)->m_bDeletePending)
+	if (static_cast<CMatInfo*>(pMtl)->m_bDeletePending)
 		return 0;
 
-	return it->second;
+	return pMtl;
 }
 
 //////////////////////////////////////////////////////////////////////////
 IMaterial* CMatMan::LoadMaterial(const char* sMtlName, bool bMakeIfNotFound, bool bNonremovable, unsigned long nLoadingFlags)
 {
+	// Already loaded materials are returned without taking m_AccessLock. A miss looks the name up again
+	// under the lock below, so concurrent requests for the same material wait for the first load to finish.
+	if (m_bInitialized && GetCVars()->e_StatObjPreload != 2)
+	{
+		char name[260];
+		UnifyName(sMtlName, name);
+
+		IMaterial* pMtl = m_mtlNameRegistry.Find(name);
+		if (pMtl && !static_cast<CMatInfo*>(pMtl)->m_bDeletePending)
+			return pMtl;
+	}
+
 	AUTO_LOCK(m_AccessLock);
 
 	if (!m_bInitialized)
@@ -1060,7 +1090,9 @@ void CMatMan::InitDefaults()
 			si.m_pShader = GetRenderer()->EF_LoadShader(MATERIAL_NODRAW, 0);
 			m_pNoDrawMtl->AssignShaderItem(si);
 		}
-		m_mtlNameMap[UnifyName(m_pNoDrawMtl->GetName())] = m_pNoDrawMtl;
+		const char* name = UnifyName(m_pNoDrawMtl->GetName());
+		m_mtlNameMap[name] = m_pNoDrawMtl;
+		m_mtlNameRegistry.Insert(name, m_pNoDrawMtl);
 	}
 
 	if (!m_pDefaultHelperMtl)
@@ -1235,6 +1267,7 @@ void CMatMan::ShutDown()
 	m_pXmlParser = 0;
 	stl::free_container(m_nonRemovables);
 	m_mtlNameMap.clear();
+	m_mtlNameRegistry.Clear();
 
 	// Free default materials
 	if (m_pDefaultMtl)
@@ -1321,6 +1354,7 @@ void CMatMan::GetMemoryUsage(ICrySizer* pSizer) const
 	pSizer->AddObject(m_pXmlParser);
 
 	pSizer->AddObject(m_mtlNameMap);
+	m_mtlNameRegistry.GetMemoryUsage(pSizer);
 	pSizer->AddObject(m_nonRemovables);
 }
 
@@ -19,6 +19,7 @@
 #include "SurfaceTypeManager.h"
 #include <CryThreading/CryThreadSafeRendererContainer.h>
 #include "MaterialHelpers.h"
+#include "AssetNameRegistry.h"
 
 #define MATERIAL_DELETION_DELAY 3 // Number of frames delay + 1
 
@@ -108,6 +109,7 @@ private: // --------------------------------------------------------------------
 
 	void        ParsePublicParams(SInputShaderResources& sr, XmlNodeRef paramsNode);
 	const char* UnifyName(const char* sMtlName) const;
+	const char* UnifyName(const char* sMtlName, char (&name)[260]) const;
 	// Can be called after material creation and initialization, to inform editor that new material in engine exist.
 	// Only used internally.
 	void       NotifyCreateMaterial(IMaterial* pMtl);
@@ -122,6 +124,7 @@ private:
 	CryCriticalSection                m_AccessLock;
 
 	MtlNameMap                        m_mtlNameMap;                   //
+	CAssetNameRegistry<IMaterial>     m_mtlNameRegistry;              // Mirrors m_mtlNameMap, looked up without m_AccessLock
 
 	IMaterialManagerListener*         m_pListener;                    //
 	_smart_ptr<CMatInfo>              m_pDefaultMtl;                  //
@@ -4219,6 +4219,7 @@ void SMMRMUpdateContext::MergeInstanceMeshesSpines(
   , int flags)
 {
 	MEMORY_SCOPE_CHECK_HEAP();
+	const int64 startTicks = CryGetTicks();
 	SMMRMUpdateContext* update = this;
 	const SMMRMGroupHeader* header = update->group;
 	size_t j = 0;
@@ -4266,6 +4267,7 @@ void SMMRMUpdateContext::MergeInstanceMeshesSpines(
 	}
 	while (j < nsamples);
 
+	update->updateTicks = CryGetTicks() - startTicks;
 	CryInterlockedDecrement(update->updateFlag);
 	mmrm_assert(update->updateFlag >= 0);
 
@@ -4284,6 +4286,7 @@ void SMMRMUpdateContext::MergeInstanceMeshesDeform(
 	MEMORY_SCOPE_CHECK_HEAP();
 	MMRM_PROFILE_FUNCTION(gEnv->pSystem, PROFILE_3DENGINE);
 
+	const int64 startTicks = CryGetTicks();
 	SMMRMUpdateContext* update = this;
 	const SMMRMGroupHeader* header = update->group;
 	size_t j = 0;
@@ -4331,6 +4334,7 @@ void SMMRMUpdateContext::MergeInstanceMeshesDeform(
 	}
 	while (j < nsamples);
 
+	update->updateTicks = CryGetTicks() - startTicks;
 	CryInterlockedDecrement(update->updateFlag);
 	mmrm_assert(update->updateFlag >= 0);
 
@@ -644,6 +644,7 @@ struct SMMRMUpdateContext
 	Vec3*                       wind;
 	int                         use_spines;
 	int                         frame_count;
+	int64                       updateTicks; // time spent by the update job
 #if MMRM_USE_BOUNDS_CHECK
 	SVF_P3S_C4B_T2S*            general_end;
 	SPipTangents*               tangents_end;
@@ -673,6 +674,7 @@ struct SMMRMUpdateContext
 		, wind()
 		, use_spines(1)
 		, frame_count()
+		, updateTicks()
 #if MMRM_USE_BOUNDS_CHECK
 		, general_end()
 		, tangents_end()
@@ -1998,6 +1998,10 @@ SMMRMGroupHeader::~SMMRMGroupHeader()
 CMergedMeshRenderNode::CMergedMeshRenderNode()
 	: m_LastDrawFrame()
 	, m_LastUpdateFrame()
+	, m_LastDeformFrame()
+	, m_fDeformSkippedTime()
+	, m_nDeformUpdateInterval(1)
+	, m_UpdateTicks()
 	, m_DistanceSQ()
 	, m_groups()
 	, m_nGroups()
@@ -2460,8 +2464,15 @@ bool CMergedMeshRenderNode::DeleteRenderMesh(RENDERMESH_UPDATE_TYPE type, bool b
 	}
 	// Clear the rendermesh update structures
 	std::vector<SMMRM>& renderMeshes = m_renderMeshes[type];
+	int64 updateTicks = 0;
 	for (size_t j = 0; j < renderMeshes.size(); ++j)
 	{
+		// All jobs are synced, gather their cost for the debug visualization
+		for (size_t i = 0; i < renderMeshes[j].updates.size(); ++i)
+		{
+			updateTicks += renderMeshes[j].updates[i].updateTicks;
+			renderMeshes[j].updates[i].updateTicks = 0;
+		}
 		if (zap)
 			stl::free_container(renderMeshes[j].updates);
 		else
@@ -2476,6 +2487,8 @@ bool CMergedMeshRenderNode::DeleteRenderMesh(RENDERMESH_UPDATE_TYPE type, bool b
 		renderMeshes[j].vertices = 0;
 		renderMeshes[j].indices = 0;
 	}
+	if (updateTicks)
+		m_UpdateTicks[type] = updateTicks;
 	m_SizeInVRam = 0u;
 
 	if (type == RUT_STATIC)
@@ -2674,7 +2687,7 @@ done:
 				update->projectiles = m_Projectiles;
 				update->nprojectiles = m_nProjectiles;
 				update->max_iter = 1;
-				update->dt = s_mmrm_globals.dt;
+				update->dt = s_mmrm_globals.dt + (type == RUT_DYNAMIC ? m_fDeformSkippedTime : 0.f);
 				update->abstime = s_mmrm_globals.abstime;
 				update->zRotation = m_zRotation;
 				update->rotationOrigin = m_pos;
@@ -2727,6 +2740,8 @@ done:
 	}
 
 	m_LastUpdateFrame = passInfo.GetMainFrameID();
+	if (type == RUT_DYNAMIC)
+		m_fDeformSkippedTime = 0.f;
 
 	if (type == RUT_STATIC)
 		InvalidatePermanentRenderObject();
@@ -2831,7 +2846,7 @@ void CMergedMeshRenderNode::Render(const struct SRendParams& EntDrawParams, cons
 			case DYNAMIC:
 				if (pass == RUT_STATIC)
 					goto static_fallthrough;
-				if (!(s_mmrm_globals.dt > 0.f))
+				if (!(s_mmrm_globals.dt > 0.f) || SkipDeformUpdate(sqDistanceToBox, frameId, switched))
 				{
 					RenderRenderMesh(
 					  RUT_DYNAMIC
@@ -2841,6 +2856,7 @@ void CMergedMeshRenderNode::Render(const struct SRendParams& EntDrawParams, cons
 				else
 				{
 					bool dispatched = false;
+					m_LastDeformFrame = frameId;
 					DeleteRenderMesh(RUT_DYNAMIC);
 					for (i = 0; i < m_nGroups; ++i)
 					{
@@ -2933,6 +2949,24 @@ static_fallthrough:
 		Cry3DEngineBase::m_pMergedMeshesManager->RegisterForPostRender(this);
 }
 
+bool CMergedMeshRenderNode::SkipDeformUpdate(float sqDistanceToBox, uint32 frameId, bool switched)
+{
+	m_nDeformUpdateInterval = 1;
+
+	const float fUpdateDist = GetCVars()->e_MergedMeshesDeformUpdateDist;
+	if (switched || m_nColliders || m_nProjectiles || fUpdateDist <= 0.f || m_renderMeshes[RUT_DYNAMIC].empty())
+		return false;
+
+	// every fUpdateDist meters the interval grows by one frame, up to every 4th frame
+	m_nDeformUpdateInterval = 1 + min((uint32)(sqrt_tpl(sqDistanceToBox) / fUpdateDist), 3u);
+	if (frameId - m_LastDeformFrame >= m_nDeformUpdateInterval)
+		return false;
+
+	// the next update integrates the skipped frames
+	m_fDeformSkippedTime += s_mmrm_globals.dt;
+	return true;
+}
+
 bool CMergedMeshRenderNode::GroupsCastShadows(RENDERMESH_UPDATE_TYPE type)
 {
 	for (size_t i = 0; i < m_nGroups; ++i)
@@ -3425,12 +3459,15 @@ void CMergedMeshRenderNode::DebugRender(int nLod)
 					nVerts += m_renderMeshes[t][i].vertices;
 					nChunks += m_renderMeshes[t][i].chunks;
 				}
-			IRenderAuxText::DrawLabelF(m_pos, 1.2f, "vb %d ib %d\nsize %3.1f kb\nlod %d ch %d"
+			IRenderAuxText::DrawLabelF(m_pos, 1.2f, "vb %d ib %d\nsize %3.1f kb\nlod %d ch %d\nupdate %.3f ms (deform %.3f ms every %d frames)"
 			                           , nVerts
 			                           , nInds
 			                           , (m_SizeInVRam) / 1024.f
 			                           , nLod
-			                           , nChunks);
+			                           , nChunks
+			                           , gEnv->pTimer->TicksToSeconds(m_UpdateTicks[RUT_STATIC] + m_UpdateTicks[RUT_DYNAMIC]) * 1000.f
+			                           , gEnv->pTimer->TicksToSeconds(m_UpdateTicks[RUT_DYNAMIC]) * 1000.f
+			                           , m_nDeformUpdateInterval);
 		}
 	}
 	if (m_State != STREAMED_IN)
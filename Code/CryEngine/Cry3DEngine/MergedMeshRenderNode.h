@@ -198,6 +198,15 @@ class CMergedMeshRenderNode
 	uint32 m_LastDrawFrame;
 	uint32 m_LastUpdateFrame;
 
+	// FrameID of the last deformation update, the simulation time skipped since then and the
+	// current update interval in frames (see SkipDeformUpdate)
+	uint32 m_LastDeformFrame;
+	float  m_fDeformSkippedTime;
+	uint32 m_nDeformUpdateInterval;
+
+	// Time spent by the mesh update jobs of the last update, per rendermesh type
+	int64 m_UpdateTicks[2];
+
 	// The state the rendernode can reside in
 	enum State
 	{
@@ -360,6 +369,10 @@ class CMergedMeshRenderNode
 	// Checks if a member of a group requests to cast shadows
 	bool GroupsCastShadows(RENDERMESH_UPDATE_TYPE type);
 
+	// Far patches without colliders are simulated at a lower frequency, returns true if
+	// the deformation update of this frame can be skipped
+	bool SkipDeformUpdate(float sqDistanceToBox, uint32 frameId, bool switched);
+
 	// Submits the merged rendermesh to the renderer
 	void RenderRenderMesh(
 	  RENDERMESH_UPDATE_TYPE type
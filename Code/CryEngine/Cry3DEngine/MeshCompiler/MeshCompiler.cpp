@@ -130,6 +130,35 @@ void ComputeVertexRemapping(const CMesh& mesh, std::vector<int>& vertexOldToNew,
 	vertexNewToOld.resize(nVertsNew);
 }
 
+// Counts vertex shader invocations of the subsets' index ranges, simulating a FIFO post-transform cache.
+// The cache is flushed between subsets because every subset is a separate draw call.
+int CountVertexCacheMisses(const CMesh& mesh, size_t cacheSize)
+{
+	std::vector<int> cache(cacheSize, -1);
+	int numMisses = 0;
+
+	for (int i = 0; i < mesh.GetSubSetCount(); ++i)
+	{
+		const SMeshSubset& subset = mesh.m_subsets[i];
+
+		std::fill(cache.begin(), cache.end(), -1);
+		size_t cacheHead = 0;
+
+		for (int j = 0; j < subset.nNumIndices; ++j)
+		{
+			const int idx = mesh.m_pIndices[subset.nFirstIndexId + j];
+			if (std::find(cache.begin(), cache.end(), idx) == cache.end())
+			{
+				cache[cacheHead] = idx;
+				cacheHead = (cacheHead + 1) % cacheSize;
+				++numMisses;
+			}
+		}
+	}
+
+	return numMisses;
+}
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////
@@ -918,6 +947,10 @@ bool CMeshCompiler::StripifyMesh_Forsyth(CMesh& mesh)
 		m_pVertexMap->resize(n, -1);
 	}
 
+	m_vertexCacheStats.numIndices = mesh.GetIndexCount();
+	m_vertexCacheStats.numVertices = mesh.GetVertexCount();
+	m_vertexCacheStats.numCacheMissesBefore = CountVertexCacheMisses(mesh, cacheSize);
+
 	CMesh newMesh;
 	newMesh.CopyFrom(mesh);
 
@@ -1071,6 +1104,9 @@ bool CMeshCompiler::StripifyMesh_Forsyth(CMesh& mesh)
 
 	newMesh.SetVertexCount(newVertexCount);
 
+	m_vertexCacheStats.numVertices = newVertexCount;
+	m_vertexCacheStats.numCacheMissesAfter = CountVertexCacheMisses(newMesh, cacheSize);
+
 	mesh.CopyFrom(newMesh);
 
 	return true;
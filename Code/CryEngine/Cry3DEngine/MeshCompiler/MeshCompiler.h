@@ -29,6 +29,32 @@ enum EMeshCompileFlags
 	MESH_COMPILE_VALIDATE                    = BIT(4),
 };
 
+// Post-transform vertex cache efficiency of the index buffer, simulated with a FIFO cache of the size
+// the face reorderer optimizes for. Filled by Compile() when MESH_COMPILE_OPTIMIZE is used.
+struct SVertexCacheStats
+{
+	SVertexCacheStats()
+		: numIndices(0)
+		, numVertices(0)
+		, numCacheMissesBefore(0)
+		, numCacheMissesAfter(0)
+	{
+	}
+
+	// ACMR: average number of vertex shader invocations per triangle (0.5 is ideal, 3.0 is worst)
+	float GetAcmrBefore() const { return numIndices ? 3.0f * numCacheMissesBefore / numIndices : 0.0f; }
+	float GetAcmrAfter() const  { return numIndices ? 3.0f * numCacheMissesAfter / numIndices : 0.0f; }
+
+	// ATVR: average number of vertex shader invocations per vertex (1.0 is ideal)
+	float GetAtvrBefore() const { return numVertices ? float(numCacheMissesBefore) / numVertices : 0.0f; }
+	float GetAtvrAfter() const  { return numVertices ? float(numCacheMissesAfter) / numVertices : 0.0f; }
+
+	int numIndices;
+	int numVertices;
+	int numCacheMissesBefore;
+	int numCacheMissesAfter;
+};
+
 //////////////////////////////////////////////////////////////////////////
 class CMeshCompiler
 {
@@ -186,6 +212,11 @@ public:
 		return m_LastError;
 	}
 
+	const SVertexCacheStats& GetVertexCacheStats() const
+	{
+		return m_vertexCacheStats;
+	}
+
 private:
 #if CRY_PLATFORM_WINDOWS
 	bool        CreateIndicesAndDeleteDuplicateVertices(CMesh& mesh);
@@ -205,6 +236,8 @@ private:
 	std::vector<int>*             m_pVertexMap;
 	std::vector<int>*             m_pIndexMap;
 
+	SVertexCacheStats             m_vertexCacheStats;
+
 	string                        m_LastError;
 };
 
@@ -48,7 +48,7 @@ IStatObj* CObjManager::GetStaticObjectByTypeID(int nTypeID, int nSID)
 
 IStatObj* CObjManager::FindStaticObjectByFilename(const char* filename)
 {
-	return stl::find_in_map(m_nameToObjectMap, CONST_TEMP_STRING(filename), NULL);
+	return m_nameToObjectRegistry.Find(filename);
 }
 
 void CObjManager::UnloadVegetationModels(bool bDeleteAll)
@@ -105,6 +105,7 @@ void CObjManager::UnloadObjects(bool bDeleteAll)
 		m_pDefaultCGF = 0;
 
 		m_nameToObjectMap.clear();
+		m_nameToObjectRegistry.Clear();
 		m_lstLoadedObjects.clear();
 
 		int nNumLeaks = 0;
@@ -152,6 +153,11 @@ void CObjManager::UnloadObjects(bool bDeleteAll)
 #endif
 
 	stl::free_container(m_lstTmpCastingNodes);
+	SAFE_DELETE(m_pShadowCastersGatherer);
+	stl::free_container(m_vStreamPredictionCameras);
+	stl::free_container(m_vStreamCameraHistory);
+	m_nStreamPredictionHits = 0;
+	m_nStreamPredictionMisses = 0;
 	stl::free_container(m_decalsToPrecreate);
 	stl::free_container(m_tmpAreas0);
 	stl::free_container(m_tmpAreas1);
@@ -434,12 +440,24 @@ CStatObj* CObjManager::LoadStatObj(const char* __szFileName
 	// Try to find already loaded object
 	CStatObj* pObject = 0;
 
+	// Held from a lookup miss until the new object is registered, so concurrent loads of the same file
+	// wait for the first one and then return its result
+	CryOptionalAutoLock<CryCriticalSection> loadLock(m_loadStatObjLock, false);
+
 	int flagCloth = 0;
 	if (_szGeomName && !strcmp(_szGeomName, "cloth"))
+	{
 		_szGeomName = 0, flagCloth = STATIC_OBJECT_DYNAMIC | STATIC_OBJECT_CLONE;
+		loadLock.Acquire();
+	}
 	else
 	{
-		pObject = stl::find_in_map(m_nameToObjectMap, CONST_TEMP_STRING(sFilename), NULL);
+		pObject = m_nameToObjectRegistry.Find(sFilename);
+		if (!pObject)
+		{
+			loadLock.Acquire();
+			pObject = m_nameToObjectRegistry.Find(sFilename);
+		}
 		if (pObject)
 		{
 			if (!bUseStreaming && pObject->m_bCanUnload)
@@ -523,6 +541,7 @@ CStatObj* CObjManager::LoadStatObj(const char* __szFileName
 
 	m_lstLoadedObjects.insert(pObject);
 	m_nameToObjectMap[pObject->m_szFileName] = pObject;
+	m_nameToObjectRegistry.Insert(pObject->m_szFileName, pObject);
 
 	if (_szGeomName && _szGeomName[0])
 	{
@@ -553,6 +572,7 @@ bool CObjManager::InternalDeleteObject(CStatObj* pObject)
 		{
 			m_lstLoadedObjects.erase(it);
 			m_nameToObjectMap.erase(pObject->m_szFileName);
+			m_nameToObjectRegistry.Erase(pObject->m_szFileName);
 		}
 		else
 		{
@@ -594,6 +614,7 @@ CObjManager::CObjManager() :
 	m_pDefaultCGF(NULL),
 	m_decalsToPrecreate(),
 	m_bNeedProcessObjectsStreaming_Finish(false),
+	m_pShadowCastersGatherer(NULL),
 	m_CullThread()
 {
 #ifdef POOL_STATOBJ_ALLOCS
@@ -604,6 +625,9 @@ CObjManager::CObjManager() :
 	m_vStreamPreCacheCameras.Add(SObjManPrecacheCamera());
 	m_nNextPrecachePointId = 0;
 	m_bCameraPrecacheOverridden = false;
+	m_vStreamCameraVelocity = Vec3(ZERO);
+	m_nStreamPredictionHits = 0;
+	m_nStreamPredictionMisses = 0;
 
 	m_pObjManager = this;
 
@@ -838,6 +862,12 @@ void CObjManager::GetMemoryUsage(class ICrySizer* pSizer) const
 		pSizer->AddObject(m_lstStaticTypes);
 	}
 
+	if (m_pShadowCastersGatherer)
+	{
+		SIZER_COMPONENT_NAME(pSizer, "ShadowCastersGatherer");
+		m_pShadowCastersGatherer->GetMemoryUsage(pSizer);
+	}
+
 	for (int i = 0; i < MAX_RECURSION_LEVELS; i++)
 	{
 		SIZER_COMPONENT_NAME(pSizer, "VegetationSprites");
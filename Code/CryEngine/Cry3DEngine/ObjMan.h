@@ -25,6 +25,7 @@
 #include <vector>
 
 #include "ObjManCullQueue.h"
+#include "AssetNameRegistry.h"
 
 #define ENTITY_MAX_DIST_FACTOR  100
 #define MAX_VALID_OBJECT_VOLUME (10000000000.f)
@@ -130,6 +131,7 @@ struct SObjManPrecacheCamera
 		, vDirection(ZERO)
 		, bbox(AABB::RESET)
 		, fImportanceFactor(1.0f)
+		, fScreenSizeScale(0.0f)
 	{
 	}
 
@@ -137,6 +139,13 @@ struct SObjManPrecacheCamera
 	Vec3  vDirection;
 	AABB  bbox;
 	float fImportanceFactor;
+	float fScreenSizeScale; // 1/tan(fov/2) of predicted cameras, objects are weighted by their screen size if not 0
+};
+
+struct SObjManCameraSample
+{
+	Vec3  vPosition;
+	float fTime;
 };
 
 struct SObjManPrecachePoint
@@ -173,6 +182,7 @@ public:
 	enum
 	{
 		MaxPrecachePoints = 4,
+		MaxPredictionPoints = 4,
 	};
 
 public:
@@ -254,6 +264,9 @@ public:
 
 	typedef std::map<string, CStatObj*, stl::less_stricmp<string>> ObjectsMap;
 	ObjectsMap m_nameToObjectMap;
+	// Mirrors m_nameToObjectMap for lookups of already loaded objects, a miss is resolved under m_loadStatObjLock
+	CAssetNameRegistry<CStatObj> m_nameToObjectRegistry;
+	CryCriticalSection           m_loadStatObjLock;
 
 	typedef std::set<CStatObj*> LoadedObjects;
 	LoadedObjects m_lstLoadedObjects;
@@ -364,6 +377,7 @@ public:
 	void       UpdateObjectsStreamingPriority(bool bSyncLoad, const SRenderingPassInfo& passInfo);
 	ILINE void SetCurrentTime(float fCurrentTime) { m_fCurrTime = fCurrentTime; }
 	void       ProcessObjectsStreaming(const SRenderingPassInfo& passInfo);
+	void       UpdateStreamPredictionCameras(const CCamera& rCamera);
 
 	// implementation parts of ProcessObjectsStreaming
 	void ProcessObjectsStreaming_Impl(bool bSyncLoad, const SRenderingPassInfo& passInfo);
@@ -372,6 +386,7 @@ public:
 	void ProcessObjectsStreaming_InitLoad(bool bSyncLoad);
 	void ProcessObjectsStreaming_Finish();
 
+	void ProcessObjectsStreaming_PredictionStats(const SRenderingPassInfo& passInfo);
 #ifdef OBJMAN_STREAM_STATS
 	void ProcessObjectsStreaming_Stats(const SRenderingPassInfo& passInfo);
 #endif
@@ -510,10 +525,16 @@ public:
 	PodArray<COctreeNode*>          m_arrStreamingNodeStack;
 	PodArray<SObjManPrecachePoint>  m_vStreamPreCachePointDefs;
 	PodArray<SObjManPrecacheCamera> m_vStreamPreCacheCameras;
+	PodArray<SObjManPrecacheCamera> m_vStreamPredictionCameras; // m_vStreamPreCacheCameras followed by the cameras predicted along the camera path
+	PodArray<SObjManCameraSample>   m_vStreamCameraHistory;
+	Vec3                            m_vStreamCameraVelocity;
+	int                             m_nStreamPredictionHits;   // objects which were ready when they became visible
+	int                             m_nStreamPredictionMisses; // objects which were still streaming when they became visible
 	int                             m_nNextPrecachePointId;
 	bool                            m_bCameraPrecacheOverridden;
 
 	PodArray<CTerrainNode*>         m_lstTmpCastingNodes;
+	class CShadowCastersGatherer*   m_pShadowCastersGatherer;
 
 #ifdef POOL_STATOBJ_ALLOCS
 	stl::PoolAllocator<sizeof(CStatObj), stl::PSyncMultiThread, alignof(CStatObj)>* m_statObjPool;
@@ -37,12 +37,21 @@ void CObjManager::MakeShadowCastersList(CVisArea* pArea, const AABB& aabbReceive
 	pFr->castersList.Clear();
 	pFr->jobExecutedCastersList.Clear();
 
+	// octree subtrees are gathered in jobs, the calling thread continues with the next trees and the terrain
+	CShadowCastersGatherer* pGatherer = NULL;
+	if (GetCVars()->e_ShadowsCastersJobs > 0)
+	{
+		if (!m_pShadowCastersGatherer)
+			m_pShadowCastersGatherer = new CShadowCastersGatherer();
+		pGatherer = m_pShadowCastersGatherer;
+	}
+
 	CVisArea* pLightArea = pLight->m_pOwner ? (CVisArea*)pLight->m_pOwner->GetEntityVisArea() : NULL;
 
 	if (pArea)
 	{
 		if (pArea->m_pObjectsTree)
-			pArea->m_pObjectsTree->FillShadowCastersList(false, pLight, pFr, pShadowHull, nRenderNodeFlags, passInfo);
+			pArea->m_pObjectsTree->FillShadowCastersList(false, pLight, pFr, pShadowHull, nRenderNodeFlags, passInfo, pGatherer);
 
 		if (pLightArea)
 		{
@@ -53,13 +62,13 @@ void CObjManager::MakeShadowCastersList(CVisArea* pArea, const AABB& aabbReceive
 				{
 					CVisArea* pN = pArea->m_lstConnections[pp];
 					if (pN->m_pObjectsTree)
-						pN->m_pObjectsTree->FillShadowCastersList(false, pLight, pFr, pShadowHull, nRenderNodeFlags, passInfo);
+						pN->m_pObjectsTree->FillShadowCastersList(false, pLight, pFr, pShadowHull, nRenderNodeFlags, passInfo, pGatherer);
 
 					for (int p = 0; p < pN->m_lstConnections.Count(); p++)
 					{
 						CVisArea* pNN = pN->m_lstConnections[p];
 						if (pNN != pLightArea && pNN->m_pObjectsTree)
-							pNN->m_pObjectsTree->FillShadowCastersList(false, pLight, pFr, pShadowHull, nRenderNodeFlags, passInfo);
+							pNN->m_pObjectsTree->FillShadowCastersList(false, pLight, pFr, pShadowHull, nRenderNodeFlags, passInfo, pGatherer);
 					}
 				}
 			}
@@ -70,7 +79,7 @@ void CObjManager::MakeShadowCastersList(CVisArea* pArea, const AABB& aabbReceive
 				{
 					CVisArea* pN = pArea->m_lstConnections[p];
 					if (pN->m_pObjectsTree)
-						pN->m_pObjectsTree->FillShadowCastersList(false, pLight, pFr, pShadowHull, nRenderNodeFlags, passInfo);
+						pN->m_pObjectsTree->FillShadowCastersList(false, pLight, pFr, pShadowHull, nRenderNodeFlags, passInfo, pGatherer);
 				}
 			}
 		}
@@ -82,7 +91,7 @@ void CObjManager::MakeShadowCastersList(CVisArea* pArea, const AABB& aabbReceive
 
 		for (int nSID = 0; nSID < Get3DEngine()->m_pObjectsTree.Count(); nSID++)
 			if (Get3DEngine()->IsSegmentSafeToUse(nSID))
-				Get3DEngine()->m_pObjectsTree[nSID]->FillShadowCastersList(false, pLight, pFr, pShadowHull, nRenderNodeFlags, passInfo);
+				Get3DEngine()->m_pObjectsTree[nSID]->FillShadowCastersList(false, pLight, pFr, pShadowHull, nRenderNodeFlags, passInfo, pGatherer);
 
 		// check also visareas effected by sun
 		CVisAreaManager* pVisAreaManager = GetVisAreaManager();
@@ -96,7 +105,7 @@ void CObjManager::MakeShadowCastersList(CVisArea* pArea, const AABB& aabbReceive
 						bool bUnused = false;
 						if (pFr->IntersectAABB(*lstAreas[i]->GetAABBox(), &bUnused))
 							if (!pShadowHull || IsAABBInsideHull(pShadowHull->GetElements(), pShadowHull->Count(), *lstAreas[i]->GetAABBox()))
-								lstAreas[i]->m_pObjectsTree->FillShadowCastersList(false, pLight, pFr, pShadowHull, nRenderNodeFlags, passInfo);
+								lstAreas[i]->m_pObjectsTree->FillShadowCastersList(false, pLight, pFr, pShadowHull, nRenderNodeFlags, passInfo, pGatherer);
 					}
 			}
 			{
@@ -107,7 +116,7 @@ void CObjManager::MakeShadowCastersList(CVisArea* pArea, const AABB& aabbReceive
 						bool bUnused = false;
 						if (pFr->IntersectAABB(*lstAreas[i]->GetAABBox(), &bUnused))
 							if (!pShadowHull || IsAABBInsideHull(pShadowHull->GetElements(), pShadowHull->Count(), *lstAreas[i]->GetAABBox()))
-								lstAreas[i]->m_pObjectsTree->FillShadowCastersList(false, pLight, pFr, pShadowHull, nRenderNodeFlags, passInfo);
+								lstAreas[i]->m_pObjectsTree->FillShadowCastersList(false, pLight, pFr, pShadowHull, nRenderNodeFlags, passInfo, pGatherer);
 					}
 			}
 		}
@@ -121,6 +130,9 @@ void CObjManager::MakeShadowCastersList(CVisArea* pArea, const AABB& aabbReceive
 		}
 	}
 
+	if (pGatherer)
+		pGatherer->Finish(pFr);
+
 	// add casters with per object shadow map for point lights
 	if ((pLight->m_Flags & DLF_SUN) == 0)
 	{
@@ -143,6 +155,68 @@ void CObjManager::MakeShadowCastersList(CVisArea* pArea, const AABB& aabbReceive
 	}
 }
 
+CShadowCastersGatherer::~CShadowCastersGatherer()
+{
+	gEnv->pJobManager->WaitForJob(m_jobState);
+
+	for (size_t i = 0; i < m_jobs.size(); ++i)
+		delete m_jobs[i];
+}
+
+void CShadowCastersGatherer::AddSubtree(COctreeNode* pNode, const COctreeNode::ShadowMapFrustumParams& params, bool bNodeCompletellyInFrustum)
+{
+	if (m_nJobs == m_jobs.size())
+		m_jobs.push_back(new SJob());
+
+	SJob* pJob = m_jobs[m_nJobs++];
+	pJob->pNode = pNode;
+	pJob->bNodeCompletellyInFrustum = bNodeCompletellyInFrustum;
+	pJob->castersList.Clear();
+	pJob->jobExecutedCastersList.Clear();
+	pJob->params = params;
+	pJob->params.pCastersList = &pJob->castersList;
+	pJob->params.pJobExecutedCastersList = &pJob->jobExecutedCastersList;
+	pJob->params.pGatherer = NULL;
+
+	auto lambda = [pJob]
+	{
+		pJob->pNode->FillShadowMapCastersList(pJob->params, pJob->bNodeCompletellyInFrustum);
+	};
+	gEnv->pJobManager->AddLambdaJob("FillShadowMapCastersList", lambda, JobManager::eHighPriority, &m_jobState);
+}
+
+void CShadowCastersGatherer::Finish(ShadowMapFrustum* pFr)
+{
+	if (!m_nJobs)
+		return;
+
+	{
+		FRAME_PROFILER("CShadowCastersGatherer::Finish_Wait", GetSystem(), PROFILE_3DENGINE);
+		gEnv->pJobManager->WaitForJob(m_jobState);
+	}
+
+	for (uint32 i = 0; i < m_nJobs; ++i)
+	{
+		pFr->castersList.AddList(m_jobs[i]->castersList);
+		pFr->jobExecutedCastersList.AddList(m_jobs[i]->jobExecutedCastersList);
+	}
+
+	m_nJobs = 0;
+}
+
+void CShadowCastersGatherer::GetMemoryUsage(ICrySizer* pSizer) const
+{
+	pSizer->AddObject(this, sizeof(*this));
+	pSizer->AddObject(m_jobs.data(), m_jobs.capacity() * sizeof(SJob*));
+	for (size_t i = 0; i < m_jobs.size(); ++i)
+	{
+		const SJob* pJob = m_jobs[i];
+		pSizer->AddObject(pJob, sizeof(SJob));
+		pSizer->AddObject(pJob->castersList.GetElements(), pJob->castersList.capacity() * sizeof(IShadowCaster*));
+		pSizer->AddObject(pJob->jobExecutedCastersList.GetElements(), pJob->jobExecutedCastersList.capacity() * sizeof(IShadowCaster*));
+	}
+}
+
 int CObjManager::MakeStaticShadowCastersList(IRenderNode* pIgnoreNode, ShadowMapFrustum* pFrustum, const PodArray<struct SPlaneObject>* pShadowHull, int renderNodeExcludeFlags, int nMaxNodes, const SRenderingPassInfo& passInfo)
 {
 	int nRemainingNodes = nMaxNodes;
@@ -103,7 +103,9 @@ void CObjManager::UpdateObjectsStreamingPriority(bool bSyncLoad, const SRenderin
 {
 	FUNCTION_PROFILER_3DENGINE;
 
-	const size_t nPrecachePoints = m_vStreamPreCachePointDefs.size();
+	// precache cameras followed by the cameras predicted along the camera path (see UpdateStreamPredictionCameras)
+	const PodArray<SObjManPrecacheCamera>& arrCameras = m_vStreamPredictionCameras.Count() ? m_vStreamPredictionCameras : m_vStreamPreCacheCameras;
+	const size_t nPrecachePoints = arrCameras.size();
 	const bool bNeedsUnique = nPrecachePoints > 1;
 
 	// make sure userData.nWantedLod is updated immediately once instancing is enabled
@@ -115,11 +117,11 @@ void CObjManager::UpdateObjectsStreamingPriority(bool bSyncLoad, const SRenderin
 	if (bSyncLoad)
 	{
 		PrintMessage("Updating level streaming priorities for %" PRISIZE_T " cameras (LevelFrameId = %d)", nPrecachePoints, Get3DEngine()->GetStreamingFramesSinceLevelStart());
-		for (size_t pci = 0; pci < m_vStreamPreCacheCameras.size(); ++pci)
+		for (size_t pci = 0; pci < arrCameras.size(); ++pci)
 			PrintMessage("-- %f %f %f",
-			             m_vStreamPreCacheCameras[pci].vPosition.x,
-			             m_vStreamPreCacheCameras[pci].vPosition.y,
-			             m_vStreamPreCacheCameras[pci].vPosition.z);
+			             arrCameras[pci].vPosition.x,
+			             arrCameras[pci].vPosition.y,
+			             arrCameras[pci].vPosition.z);
 	}
 
 	CVisAreaManager* pVisAreaMgr = GetVisAreaManager();
@@ -144,7 +146,7 @@ void CObjManager::UpdateObjectsStreamingPriority(bool bSyncLoad, const SRenderin
 
 			for (size_t ppIdx = 0, ppCount = nPrecachePoints; ppIdx != ppCount; ++ppIdx)
 			{
-				const Vec3& vPrecachePoint = m_vStreamPreCacheCameras[ppIdx].vPosition;
+				const Vec3& vPrecachePoint = arrCameras[ppIdx].vPosition;
 
 				CVisArea* pCurArea = pVisAreaMgr ? (CVisArea*)pVisAreaMgr->GetVisAreaFromPos(vPrecachePoint) : NULL;
 				if (CVisArea* pRoot0 = pCurArea)
@@ -248,7 +250,7 @@ void CObjManager::UpdateObjectsStreamingPriority(bool bSyncLoad, const SRenderin
 					COctreeNode* pLast = m_arrStreamingNodeStack.Last();
 					m_arrStreamingNodeStack.DeleteLast();
 
-					pLast->UpdateStreamingPriority(m_arrStreamingNodeStack, fMinDist, fMaxViewDistance, false, &m_vStreamPreCacheCameras[0], nPrecachePoints, passInfo);
+					pLast->UpdateStreamingPriority(m_arrStreamingNodeStack, fMinDist, fMaxViewDistance, false, arrCameras.GetElements(), nPrecachePoints, passInfo);
 
 					if (!bSyncLoad && (GetTimer()->GetAsyncTime() - startTime) > maxTimeToSpend)
 						break;
@@ -272,7 +274,7 @@ void CObjManager::UpdateObjectsStreamingPriority(bool bSyncLoad, const SRenderin
 
 		for (size_t ppIdx = 0, ppCount = nPrecachePoints; ppIdx != ppCount; ++ppIdx)
 		{
-			const Vec3& vPrecachePoint = m_vStreamPreCacheCameras[ppIdx].vPosition;
+			const Vec3& vPrecachePoint = arrCameras[ppIdx].vPosition;
 
 			CVisArea* pCurArea = pVisAreaMgr ? (CVisArea*)pVisAreaMgr->GetVisAreaFromPos(vPrecachePoint) : NULL;
 			if (CVisArea* pRoot0 = pCurArea)
@@ -360,7 +362,7 @@ void CObjManager::UpdateObjectsStreamingPriority(bool bSyncLoad, const SRenderin
 			COctreeNode* pLast = fastStreamingNodeStack.Last();
 			fastStreamingNodeStack.DeleteLast();
 
-			pLast->UpdateStreamingPriority(fastStreamingNodeStack, 0.f, fMaxDist, true, &m_vStreamPreCacheCameras[0], nPrecachePoints, passInfo);
+			pLast->UpdateStreamingPriority(fastStreamingNodeStack, 0.f, fMaxDist, true, arrCameras.GetElements(), nPrecachePoints, passInfo);
 		}
 
 		m_nUpdateStreamingPrioriryRoundIdFast++;
@@ -523,6 +525,8 @@ void CObjManager::ProcessObjectsStreaming(const SRenderingPassInfo& passInfo)
 	else if (bSyncLoad)
 		PrintMessage("Pre-caching render meshes for camera position");
 
+	UpdateStreamPredictionCameras(rCamera);
+
 	CTimeValue currentTime = gEnv->pTimer->GetAsyncTime();
 
 	bool bSyncLoadPoints = m_bCameraPrecacheOverridden || Get3DEngine()->IsContentPrecacheRequested() || bSyncLoad || (GetCVars()->e_StreamCgf == 3) || (GetCVars()->e_StreamCgfDebugHeatMap != 0);
@@ -567,8 +571,129 @@ void CObjManager::ProcessObjectsStreaming(const SRenderingPassInfo& passInfo)
 	}
 }
 
+void CObjManager::UpdateStreamPredictionCameras(const CCamera& rCamera)
+{
+	m_vStreamPredictionCameras.Clear();
+
+	if (!GetCVars()->e_StreamPredictionVelocity || m_bCameraPrecacheOverridden)
+	{
+		m_vStreamCameraHistory.Clear();
+		m_vStreamCameraVelocity = Vec3(ZERO);
+		return;
+	}
+
+	const Vec3 vCamPos = rCamera.GetPosition();
+	const float fTime = GetTimer()->GetCurrTime();
+
+	// restart the history on teleports and timer discontinuities, anything faster than this is not a camera movement
+	const float fMaxCameraSpeed = 300.0f;
+	if (m_vStreamCameraHistory.Count())
+	{
+		const SObjManCameraSample& lastSample = m_vStreamCameraHistory.Last();
+		const float fDeltaTime = fTime - lastSample.fTime;
+		if (fDeltaTime < 0.0f || vCamPos.GetSquaredDistance(lastSample.vPosition) > sqr(max(fMaxCameraSpeed * fDeltaTime, 1.0f)))
+			m_vStreamCameraHistory.Clear();
+	}
+
+	if (!m_vStreamCameraHistory.Count() || m_vStreamCameraHistory.Last().fTime != fTime)
+	{
+		SObjManCameraSample sample;
+		sample.vPosition = vCamPos;
+		sample.fTime = fTime;
+		m_vStreamCameraHistory.Add(sample);
+	}
+
+	// keep the samples of the last e_StreamPredictionVelocityWindow seconds
+	const float fWindow = max(GetCVars()->e_StreamPredictionVelocityWindow, 0.01f);
+	int nOutdated = 0;
+	while (nOutdated < m_vStreamCameraHistory.Count() - 2 && m_vStreamCameraHistory[nOutdated + 1].fTime <= fTime - fWindow)
+		nOutdated++;
+	if (nOutdated)
+		m_vStreamCameraHistory.Delete(0, nOutdated);
+
+	const SObjManCameraSample& oldestSample = m_vStreamCameraHistory[0];
+	const float fHistoryTime = fTime - oldestSample.fTime;
+	m_vStreamCameraVelocity = (fHistoryTime > 0.001f) ? (vCamPos - oldestSample.vPosition) / fHistoryTime : Vec3(ZERO);
+
+	m_vStreamPredictionCameras.AddList(m_vStreamPreCacheCameras);
+
+	const int nPoints = clamp_tpl(GetCVars()->e_StreamPredictionPathPoints, 1, (int)MaxPredictionPoints);
+	const float fBoxRadius = GetCVars()->e_StreamPredictionBoxRadius;
+	Vec3 vPath = m_vStreamCameraVelocity * max(GetCVars()->e_StreamPredictionLookAheadTime, 0.0f);
+
+	// the current camera already covers a camera standing still
+	if (vPath.GetLengthSquared() < sqr(max(fBoxRadius, 0.1f)))
+		return;
+
+	// the camera does not pass through the terrain and static geometry
+	ray_hit hit;
+	int rayFlags = geom_colltype_player << rwi_colltype_bit | rwi_stop_at_pierceable;
+	if (m_pPhysicalWorld->RayWorldIntersection(vCamPos, vPath, ent_terrain | ent_static | ent_sleeping_rigid | ent_rigid, rayFlags, &hit, 1))
+		vPath = hit.pt - vCamPos;
+
+	const Vec3 vDirection = m_vStreamCameraVelocity.GetNormalized();
+	const float fScreenSizeScale = 1.0f / max(tan_tpl(rCamera.GetFov() * 0.5f), 0.01f);
+
+	Vec3 vSegmentStart = vCamPos;
+	for (int i = 0; i < nPoints; i++)
+	{
+		const float fPathTime = float(i + 1) / float(nPoints);
+
+		// the box covers the path segment since the previous point, objects close to the path are requested too;
+		// points further ahead become visible later and get lower priority
+		SObjManPrecacheCamera predictedCamera;
+		predictedCamera.vPosition = vCamPos + vPath * fPathTime;
+		predictedCamera.vDirection = vDirection;
+		predictedCamera.bbox = AABB(vSegmentStart, fBoxRadius);
+		predictedCamera.bbox.Add(AABB(predictedCamera.vPosition, fBoxRadius));
+		predictedCamera.fImportanceFactor = 1.0f - 0.5f * fPathTime;
+		predictedCamera.fScreenSizeScale = fScreenSizeScale;
+		m_vStreamPredictionCameras.Add(predictedCamera);
+
+		vSegmentStart = predictedCamera.vPosition;
+
+		if (GetFloatCVar(e_StreamPredictionAheadDebug))
+			DrawSphere(predictedCamera.vPosition, 0.25f);
+	}
+}
+
+void CObjManager::ProcessObjectsStreaming_PredictionStats(const SRenderingPassInfo& passInfo)
+{
+	if (!GetCVars()->e_StreamPredictionVelocity && !GetCVars()->e_StreamCgfDebug)
+		return;
+
+	// objects which were not drawn for this many frames are counted again once they become visible
+	const int nInvisibleFramesToReset = 100;
+	const int nCurrentFrameId = passInfo.GetMainFrameID();
+
+	for (int nObjId = 0; nObjId < m_arrStreamableObjects.Count(); nObjId++)
+	{
+		IStreamable* pObj = m_arrStreamableObjects[nObjId].GetStreamAbleObject();
+
+		const int framesSinceLastUse = nCurrentFrameId - pObj->GetLastDrawMainFrameId();
+
+		if (framesSinceLastUse < 2)
+		{
+			if (!pObj->m_nStatsPredictionVisible)
+			{
+				pObj->m_nStatsPredictionVisible = 1;
+
+				if (pObj->m_eStreamingStatus == ecss_Ready)
+					m_nStreamPredictionHits++;
+				else
+					m_nStreamPredictionMisses++;
+			}
+		}
+		else if (framesSinceLastUse > nInvisibleFramesToReset)
+		{
+			pObj->m_nStatsPredictionVisible = 0;
+		}
+	}
+}
+
 void CObjManager::ProcessObjectsStreaming_Impl(bool bSyncLoad, const SRenderingPassInfo& passInfo)
 {
+	ProcessObjectsStreaming_PredictionStats(passInfo);
 	ProcessObjectsStreaming_Sort(bSyncLoad, passInfo);
 	ProcessObjectsStreaming_Release();
 #ifdef OBJMAN_STREAM_STATS
@@ -2,6 +2,7 @@
 
 #include "StdAfx.h"
 #include "ObjectsTree.h"
+#include "ObjectsTree_Flat.h"
 #include "PolygonClipContext.h"
 #include "RoadRenderNode.h"
 #include "Brush.h"
@@ -53,6 +54,16 @@ COctreeNode::~COctreeNode()
 		m_pReadStream->Abort();
 
 	ResetStaticInstancing();
+
+	if (m_pParent)
+	{
+		if (m_pFlatTree)
+			m_pFlatTree->MarkDirty();
+	}
+	else
+	{
+		SAFE_DELETE(m_pFlatTree);
+	}
 }
 
 void COctreeNode::SetVisArea(CVisArea* pVisArea)
@@ -186,6 +197,15 @@ void COctreeNode::Render_Object_Nodes(bool bNodeCompletelyInFrustum, int nRender
 {
 	assert(nRenderMask & OCTREENODE_RENDER_FLAG_OBJECTS);
 
+	if (!m_pParent && GetCVars()->e_ObjectsTreeFlatCulling)
+	{
+		if (!m_pFlatTree)
+			m_pFlatTree = new COctreeFlatTree(this);
+
+		m_pFlatTree->Render(bNodeCompletelyInFrustum, nRenderMask, vAmbColor, passInfo);
+		return;
+	}
+
 	const CCamera& rCam = passInfo.GetCamera();
 
 	if (m_nOccludedFrameId == passInfo.GetFrameID())
@@ -194,13 +214,20 @@ void COctreeNode::Render_Object_Nodes(bool bNodeCompletelyInFrustum, int nRender
 	if (!bNodeCompletelyInFrustum && !rCam.IsAABBVisible_EH(m_objectsBox, &bNodeCompletelyInFrustum))
 		return;
 
-	const Vec3& vCamPos = rCam.GetPosition();
-
-	float fNodeDistanceSq = Distance::Point_AABBSq(vCamPos, m_objectsBox) * sqr(passInfo.GetZoomFactor());
+	float fNodeDistanceSq = Distance::Point_AABBSq(rCam.GetPosition(), m_objectsBox) * sqr(passInfo.GetZoomFactor());
 
 	if (fNodeDistanceSq > sqr(m_fObjectsMaxViewDist))
 		return;
 
+	if (!Render_Object_Node(bNodeCompletelyInFrustum, fNodeDistanceSq, nRenderMask, vAmbColor, passInfo))
+		return;
+
+	Render_Object_Children(bNodeCompletelyInFrustum, nRenderMask, vAmbColor, passInfo);
+}
+
+// Renders the content of a node which passed the frustum and view distance tests, returns false if the node is occluded.
+bool COctreeNode::Render_Object_Node(bool bNodeCompletelyInFrustum, float fNodeDistanceSq, int nRenderMask, const Vec3& vAmbColor, const SRenderingPassInfo& passInfo)
+{
 	float fNodeDistance = sqrt_tpl(fNodeDistanceSq);
 
 	if (m_nLastVisFrameId != passInfo.GetFrameID() && m_pParent)
@@ -208,7 +235,7 @@ void COctreeNode::Render_Object_Nodes(bool bNodeCompletelyInFrustum, int nRender
 		if (GetObjManager()->IsBoxOccluded(m_objectsBox, fNodeDistance, &m_occlusionTestClient, m_pVisArea != NULL, eoot_OCCELL, passInfo))
 		{
 			m_nOccludedFrameId = passInfo.GetFrameID();
-			return;
+			return false;
 		}
 	}
 
@@ -253,6 +280,13 @@ void COctreeNode::Render_Object_Nodes(bool bNodeCompletelyInFrustum, int nRender
 		passInfo.GetRendItemSorter().IncreaseOctreeCounter();
 	}
 
+	return true;
+}
+
+void COctreeNode::Render_Object_Children(bool bNodeCompletelyInFrustum, int nRenderMask, const Vec3& vAmbColor, const SRenderingPassInfo& passInfo)
+{
+	const Vec3& vCamPos = passInfo.GetCamera().GetPosition();
+
 	int nFirst =
 	  ((vCamPos.x > m_vNodeCenter.x) ? 4 : 0) |
 	  ((vCamPos.y > m_vNodeCenter.y) ? 2 : 0) |
@@ -448,6 +482,7 @@ void COctreeNode::CompileObjects()
 		while (pNode)
 		{
 			pNode->m_fObjectsMaxViewDist = max(pNode->m_fObjectsMaxViewDist, fObjMaxViewDistance);
+			pNode->UpdateFlatCullData();
 			pNode = pNode->m_pParent;
 		}
 	}
@@ -629,7 +664,10 @@ void COctreeNode::AddLightSource(CDLight* pSource, const SRenderingPassInfo& pas
 bool IsAABBInsideHull(const SPlaneObject* pHullPlanes, int nPlanesNum, const AABB& aabbBox);
 bool IsSphereInsideHull(const SPlaneObject* pHullPlanes, int nPlanesNum, const Sphere& objSphere);
 
-void COctreeNode::FillShadowCastersList(bool bNodeCompletellyInFrustum, CDLight* pLight, ShadowMapFrustum* pFr, PodArray<SPlaneObject>* pShadowHull, uint32 nRenderNodeFlags, const SRenderingPassInfo& passInfo)
+// CompileObjects also updates the parent nodes, so nodes reached by several caster gathering jobs are compiled one at a time
+static CryCriticalSection s_shadowCastersCompileLock;
+
+void COctreeNode::FillShadowCastersList(bool bNodeCompletellyInFrustum, CDLight* pLight, ShadowMapFrustum* pFr, PodArray<SPlaneObject>* pShadowHull, uint32 nRenderNodeFlags, const SRenderingPassInfo& passInfo, CShadowCastersGatherer* pGatherer)
 {
 	if (GetCVars()->e_Objects)
 	{
@@ -645,13 +683,16 @@ void COctreeNode::FillShadowCastersList(bool bNodeCompletellyInFrustum, CDLight*
 			params.vCamPos = passInfo.GetCamera().GetPosition();
 			params.bSun = (pLight->m_Flags & DLF_SUN) != 0;
 			params.nRenderNodeFlags = nRenderNodeFlags;
+			params.pCastersList = &pFr->castersList;
+			params.pJobExecutedCastersList = &pFr->jobExecutedCastersList;
+			params.pGatherer = pGatherer;
 
-			FillShadowMapCastersList(params, bNodeCompletellyInFrustum);
+			FillShadowMapCastersList(params, bNodeCompletellyInFrustum, pGatherer ? max(GetCVars()->e_ShadowsCastersJobs - 1, 0) : -1);
 		}
 	}
 }
 
-void COctreeNode::FillShadowMapCastersList(const ShadowMapFrustumParams& params, bool bNodeCompletellyInFrustum)
+void COctreeNode::FillShadowMapCastersList(const ShadowMapFrustumParams& params, bool bNodeCompletellyInFrustum, int nJobSplitDepth)
 {
 	if (!bNodeCompletellyInFrustum && !params.pFr->IntersectAABB(m_objectsBox, &bNodeCompletellyInFrustum))
 		return;
@@ -668,7 +709,9 @@ void COctreeNode::FillShadowMapCastersList(const ShadowMapFrustumParams& params,
 
 	if (!IsCompiled())
 	{
-		CompileObjects();
+		AUTO_LOCK(s_shadowCastersCompileLock);
+		if (!IsCompiled())
+			CompileObjects();
 	}
 
 	PrefetchLine(&m_lstCasters, 0);
@@ -735,10 +778,10 @@ void COctreeNode::FillShadowMapCastersList(const ShadowMapFrustumParams& params,
 
 		if (pCaster->bCanExecuteAsRenderJob)
 		{
-			params.pFr->jobExecutedCastersList.Add(pCaster->pNode);
+			params.pJobExecutedCastersList->Add(pCaster->pNode);
 		}
 		else
-			params.pFr->castersList.Add(pCaster->pNode);
+			params.pCastersList->Add(pCaster->pNode);
 
 		// This code does not exist yet!
 		//if(pCaster->nRType == eERType_ParticleEmitter)
@@ -764,13 +807,21 @@ void COctreeNode::FillShadowMapCastersList(const ShadowMapFrustumParams& params,
 #endif
 
 			if (!params.bSun || !params.pShadowHull || bContinue)
-				m_arrChilds[i]->FillShadowMapCastersList(params, bNodeCompletellyInFrustum);
+			{
+				if (nJobSplitDepth == 0)
+					params.pGatherer->AddSubtree(m_arrChilds[i], params, bNodeCompletellyInFrustum);
+				else
+					m_arrChilds[i]->FillShadowMapCastersList(params, bNodeCompletellyInFrustum, nJobSplitDepth > 0 ? nJobSplitDepth - 1 : -1);
+			}
 		}
 	}
 }
 
 void COctreeNode::MarkAsUncompiled(const IRenderNode* pRenderNode)
 {
+	if (m_pFlatTree)
+		m_pFlatTree->MarkDirty();
+
 	if (pRenderNode)
 	{
 		for (int l = 0; l < eRNListType_ListsNum; l++)
@@ -1144,10 +1195,22 @@ void COctreeNode::GetMemoryUsage(ICrySizer* pSizer) const
 		if (m_arrChilds[i])
 			m_arrChilds[i]->GetMemoryUsage(pSizer);
 
+	if (!m_pParent && m_pFlatTree)
+	{
+		SIZER_COMPONENT_NAME(pSizer, "FlatTree");
+		m_pFlatTree->GetMemoryUsage(pSizer);
+	}
+
 	if (pSizer)
 		pSizer->AddObject(this, sizeof(*this));
 }
 
+void COctreeNode::UpdateFlatCullData()
+{
+	if (m_pFlatTree)
+		m_pFlatTree->UpdateNode(m_nFlatIndex, m_objectsBox, m_fObjectsMaxViewDist);
+}
+
 void COctreeNode::UpdateTerrainNodes(CTerrainNode* pParentNode)
 {
 	if (pParentNode != 0)
@@ -1816,7 +1879,11 @@ bool COctreeNode::UpdateStreamingPriority(PodArray<COctreeNode*>& arrRecursion,
 					  (float)__fsel(
 					    (objBox.GetCenter() - pcPosition).Dot(pPrecacheCams[iPrecacheCam].vDirection),
 					    1.0f,
-					    0.8f));
+					    0.8f)) * pPrecacheCams[iPrecacheCam].fImportanceFactor;
+
+					// predicted cameras prefer objects which are going to cover a large part of the screen
+					if (pPrecacheCams[iPrecacheCam].fScreenSizeScale > 0.0f)
+						fImportanceScale *= clamp_tpl(objBox.GetRadius() * pPrecacheCams[iPrecacheCam].fScreenSizeScale / max(fEntDistance, 1.0f), 0.1f, 1.0f);
 
 					// I replaced fEntDistance with fNoideDistance here because of Timur request! It's suppose to be unified to-node-distance
 					GetObjManager()->UpdateRenderNodeStreamingPriority(pObj, fDist, fImportanceScale, bFullUpdate, passInfo);
@@ -2091,6 +2158,8 @@ bool COctreeNode::CleanUpTree()
 		}
 	}
 
+	UpdateFlatCullData();
+
 	return (bChildObjectsFound || HasObjects());
 }
 
@@ -2110,6 +2179,7 @@ void COctreeNode::OffsetObjects(const Vec3& offset)
 	SetCompiled(false);
 	m_objectsBox.Move(offset);
 	m_vNodeCenter += offset;
+	UpdateFlatCullData();
 
 	for (int l = 0; l < eRNListType_ListsNum; l++)
 	{
@@ -2169,6 +2239,7 @@ int COctreeNode::ReadObjects(T*& f, int& nDataSize, EEndian eEndian, std::vector
 			while (pNode)
 			{
 				pNode->m_fObjectsMaxViewDist = max(pNode->m_fObjectsMaxViewDist, fObjMaxViewDistance);
+				pNode->UpdateFlatCullData();
 				pNode = pNode->m_pParent;
 			}
 		}
@@ -2448,6 +2519,12 @@ COctreeNode::COctreeNode(int nSID, const AABB& box, CVisArea* pVisArea, COctreeN
 	m_pParent = pParent;
 	m_streamComplete = false;
 
+	// a new node invalidates the flattened tree of the root
+	m_pFlatTree = pParent ? pParent->m_pFlatTree : NULL;
+	m_nFlatIndex = COctreeFlatTree::INVALID_INDEX;
+	if (m_pFlatTree)
+		m_pFlatTree->MarkDirty();
+
 	//	for(int n=0; n<2 && m_pTerrainNode && m_pTerrainNode->m_pParent; n++)
 	//	m_pTerrainNode = m_pTerrainNode->m_pParent;
 	m_fpSunDirX = 63;
@@ -2938,6 +3015,8 @@ void COctreeNode::InsertObject(IRenderNode* pObj, const AABB& objBox, const floa
 
 		pCurrentNode->m_fObjectsMaxViewDist = max(pCurrentNode->m_fObjectsMaxViewDist, fWSMaxViewDist);
 
+		pCurrentNode->UpdateFlatCullData();
+
 		pCurrentNode->m_renderFlags |= renderFlags;
 
 		pCurrentNode->m_bHasLights |= (bTypeLight);
@@ -3175,6 +3254,7 @@ void COctreeNode::UpdateObjects(IRenderNode* pObj)
 		if (pNode->m_fObjectsMaxViewDist < fObjMaxViewDistance)
 		{
 			pNode->m_fObjectsMaxViewDist = fObjMaxViewDistance;
+			pNode->UpdateFlatCullData();
 			bContinue = true;
 		}
 
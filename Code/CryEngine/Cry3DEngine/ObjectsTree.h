@@ -329,8 +329,13 @@ struct SOctreeLoadObjectsData
 	byte*                    pEndObjPtr;
 };
 
+class COctreeFlatTree;
+class CShadowCastersGatherer;
+
 class COctreeNode : public IOctreeNode, Cry3DEngineBase, IStreamCallback
 {
+	friend class COctreeFlatTree;
+
 public:
 
 	struct ShadowMapFrustumParams
@@ -342,6 +347,9 @@ public:
 		Vec3                      vCamPos;
 		uint32                    nRenderNodeFlags;
 		bool                      bSun;
+		PodArray<IShadowCaster*>* pCastersList;
+		PodArray<IShadowCaster*>* pJobExecutedCastersList;
+		CShadowCastersGatherer*   pGatherer; // NULL if the whole tree is gathered on the calling thread
 	};
 
 	~COctreeNode();
@@ -351,6 +359,8 @@ public:
 	void                InsertObject(IRenderNode* pObj, const AABB& objBox, const float fObjRadiusSqr, const Vec3& vObjCenter);
 	bool                DeleteObject(IRenderNode* pObj);
 	void                Render_Object_Nodes(bool bNodeCompletelyInFrustum, int nRenderMask, const Vec3& vAmbColor, const SRenderingPassInfo& passInfo);
+	bool                Render_Object_Node(bool bNodeCompletelyInFrustum, float fNodeDistanceSq, int nRenderMask, const Vec3& vAmbColor, const SRenderingPassInfo& passInfo);
+	void                Render_Object_Children(bool bNodeCompletelyInFrustum, int nRenderMask, const Vec3& vAmbColor, const SRenderingPassInfo& passInfo);
 	void                CheckUpdateStaticInstancing();
 	void                RenderDebug();
 	void                RenderContent(int nRenderMask, const Vec3& vAmbColor, const SRenderingPassInfo& passInfo);
@@ -362,8 +372,9 @@ public:
 	PodArray<CDLight*>* GetAffectingLights(const SRenderingPassInfo& passInfo);
 	void                AddLightSource(CDLight* pSource, const SRenderingPassInfo& passInfo);
 	void                CheckInitAffectingLights(const SRenderingPassInfo& passInfo);
-	void                FillShadowCastersList(bool bNodeCompletellyInFrustum, CDLight* pLight, struct ShadowMapFrustum* pFr, PodArray<SPlaneObject>* pShadowHull, uint32 nRenderNodeFlags, const SRenderingPassInfo& passInfo);
-	void                FillShadowMapCastersList(const ShadowMapFrustumParams& params, bool bNodeCompletellyInFrustum);
+	void                FillShadowCastersList(bool bNodeCompletellyInFrustum, CDLight* pLight, struct ShadowMapFrustum* pFr, PodArray<SPlaneObject>* pShadowHull, uint32 nRenderNodeFlags, const SRenderingPassInfo& passInfo, CShadowCastersGatherer* pGatherer = NULL);
+	// nJobSplitDepth is the number of levels below this node that are traversed before the subtrees are handed to params.pGatherer, -1 to not split
+	void                FillShadowMapCastersList(const ShadowMapFrustumParams& params, bool bNodeCompletellyInFrustum, int nJobSplitDepth = -1);
 	void                ActivateObjectsLayer(uint16 nLayerId, bool bActivate, bool bPhys, IGeneralMemoryHeap* pHeap, const AABB& layerBox);
 	void                GetLayerMemoryUsage(uint16 nLayerId, ICrySizer* pSizer, int* pNumBrushes, int* pNumDecals);
 
@@ -474,6 +485,7 @@ private:
 	float        GetNodeRadius2() const { return m_vNodeAxisRadius.Dot(m_vNodeAxisRadius); }
 	COctreeNode* FindChildFor(IRenderNode* pObj, const AABB& objBox, const float fObjRadius, const Vec3& vObjCenter);
 	bool         HasAnyRenderableCandidates(const SRenderingPassInfo& passInfo) const;
+	void         UpdateFlatCullData();
 	void         BuildLoadingDatas(PodArray<SOctreeLoadObjectsData>* pQueue, byte* pOrigData, byte*& pData, int& nDataSize, EEndian eEndian);
 	PodArray<SOctreeLoadObjectsData> m_loadingDatas;
 
@@ -496,6 +508,8 @@ private:
 	PodArray<CDLight*>               m_lstAffectingLights;
 	uint32                           m_nLightMaskFrameId;
 	COctreeNode*                     m_pParent;
+	COctreeFlatTree*                 m_pFlatTree; // owned by the root node
+	uint32                           m_nFlatIndex;
 	uint32                           nFillShadowCastersSkipFrameId;
 	float                            m_fNodeDistance;
 	int                              m_nManageVegetationsFrameId;
@@ -540,4 +554,34 @@ public:
 	volatile int                  m_updateStaticInstancingLock;
 };
 
+//////////////////////////////////////////////////////////////////////////
+// Gathers the shadow casters of octree subtrees in jobs for one call of CObjManager::MakeShadowCastersList.
+// Every job writes into its own lists, Finish waits for the jobs and appends the lists to the frustum in the
+// order the subtrees were added. The job lists are kept between frames to avoid reallocations.
+//////////////////////////////////////////////////////////////////////////
+class CShadowCastersGatherer : public Cry3DEngineBase
+{
+public:
+	CShadowCastersGatherer() : m_nJobs(0) {}
+	~CShadowCastersGatherer();
+
+	void AddSubtree(COctreeNode* pNode, const COctreeNode::ShadowMapFrustumParams& params, bool bNodeCompletellyInFrustum);
+	void Finish(ShadowMapFrustum* pFr);
+	void GetMemoryUsage(ICrySizer* pSizer) const;
+
+private:
+	struct SJob
+	{
+		COctreeNode::ShadowMapFrustumParams params;
+		COctreeNode*                        pNode;
+		bool                                bNodeCompletellyInFrustum;
+		PodArray<IShadowCaster*>            castersList;
+		PodArray<IShadowCaster*>            jobExecutedCastersList;
+	};
+
+	std::vector<SJob*>    m_jobs;
+	uint32                m_nJobs;
+	JobManager::SJobState m_jobState;
+};
+
 #endif
@@ -0,0 +1,315 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "StdAfx.h"
+#include "ObjectsTree.h"
+#include "ObjectsTree_Flat.h"
+
+namespace
+{
+// Visiting order of the child octants relative to the one containing the camera, the same as in the recursive
+// traversal. The permutation is its own inverse, so it also maps an octant to its rank.
+const uint8 s_childOrder[8] = { 0, 1, 2, 4, 3, 5, 6, 7 };
+}
+
+COctreeFlatTree::COctreeFlatTree(COctreeNode* pRoot)
+	: m_pRoot(pRoot)
+	, m_bDirty(true)
+	, m_nNodes(0)
+{
+	assert(pRoot && !pRoot->m_pParent);
+}
+
+void COctreeFlatTree::AddBlock()
+{
+	// unused entries have an empty box and no view distance, they never pass the tests
+	for (int i = 0; i < 4; i++)
+	{
+		m_minX.push_back(FLT_MAX);
+		m_minY.push_back(FLT_MAX);
+		m_minZ.push_back(FLT_MAX);
+		m_maxX.push_back(-FLT_MAX);
+		m_maxY.push_back(-FLT_MAX);
+		m_maxZ.push_back(-FLT_MAX);
+		m_maxViewDist.push_back(0.f);
+		m_nodes.push_back(NULL);
+		m_firstChild.push_back(INVALID_INDEX);
+		m_childCount.push_back(0);
+		m_childSlot.push_back(0);
+	}
+}
+
+void COctreeFlatTree::Rebuild()
+{
+	FUNCTION_PROFILER_3DENGINE;
+
+	m_minX.clear();
+	m_minY.clear();
+	m_minZ.clear();
+	m_maxX.clear();
+	m_maxY.clear();
+	m_maxZ.clear();
+	m_maxViewDist.clear();
+	m_nodes.clear();
+	m_firstChild.clear();
+	m_childCount.clear();
+	m_childSlot.clear();
+	m_nNodes = 0;
+
+	// the root gets a block on its own so every span starts at a multiple of 4
+	AddBlock();
+	m_nodes[0] = m_pRoot;
+
+	for (uint32 nIndex = 0; nIndex < m_nodes.size(); nIndex++)
+	{
+		COctreeNode* pNode = m_nodes[nIndex];
+		if (!pNode)
+			continue;
+
+		pNode->m_pFlatTree = this;
+		pNode->m_nFlatIndex = nIndex;
+		m_nNodes++;
+
+		m_minX[nIndex] = pNode->m_objectsBox.min.x;
+		m_minY[nIndex] = pNode->m_objectsBox.min.y;
+		m_minZ[nIndex] = pNode->m_objectsBox.min.z;
+		m_maxX[nIndex] = pNode->m_objectsBox.max.x;
+		m_maxY[nIndex] = pNode->m_objectsBox.max.y;
+		m_maxZ[nIndex] = pNode->m_objectsBox.max.z;
+		m_maxViewDist[nIndex] = pNode->m_fObjectsMaxViewDist;
+
+		const uint32 nFirstChild = m_nodes.size();
+		uint32 nChildren = 0;
+		for (int nSlot = 0; nSlot < 8; nSlot++)
+		{
+			if (COctreeNode* pChild = pNode->m_arrChilds[nSlot])
+			{
+				if ((nChildren & 3) == 0)
+					AddBlock();
+
+				m_nodes[nFirstChild + nChildren] = pChild;
+				m_childSlot[nFirstChild + nChildren] = nSlot;
+				nChildren++;
+			}
+		}
+
+		// AddBlock() may have reallocated the arrays
+		m_firstChild[nIndex] = nChildren ? nFirstChild : INVALID_INDEX;
+		m_childCount[nIndex] = nChildren;
+	}
+
+	m_bDirty = false;
+}
+
+void COctreeFlatTree::UpdateNode(uint32 nIndex, const AABB& objectsBox, float fObjectsMaxViewDist)
+{
+	if (m_bDirty || nIndex >= m_nodes.size())
+		return;
+
+	m_minX[nIndex] = objectsBox.min.x;
+	m_minY[nIndex] = objectsBox.min.y;
+	m_minZ[nIndex] = objectsBox.min.z;
+	m_maxX[nIndex] = objectsBox.max.x;
+	m_maxY[nIndex] = objectsBox.max.y;
+	m_maxZ[nIndex] = objectsBox.max.z;
+	m_maxViewDist[nIndex] = fObjectsMaxViewDist;
+}
+
+uint32 COctreeFlatTree::CullBlock(uint32 nFirst, uint32 nLaneMask, bool bCompletelyInFrustum, const CCamera& rCam, float fZoomFactorSq, float* pDistanceSq, uint32& nInsideMask) const
+{
+	const Vec3& vCamPos = rCam.GetPosition();
+	uint32 nVisible, nOverlap;
+
+#if CRY_PLATFORM_SSE2
+	const __m128 minX = _mm_load_ps(&m_minX[nFirst]);
+	const __m128 minY = _mm_load_ps(&m_minY[nFirst]);
+	const __m128 minZ = _mm_load_ps(&m_minZ[nFirst]);
+	const __m128 maxX = _mm_load_ps(&m_maxX[nFirst]);
+	const __m128 maxY = _mm_load_ps(&m_maxY[nFirst]);
+	const __m128 maxZ = _mm_load_ps(&m_maxZ[nFirst]);
+	const __m128 zero = _mm_setzero_ps();
+
+	// squared distance from the camera to the boxes, the same as Distance::Point_AABBSq
+	const __m128 camX = _mm_set1_ps(vCamPos.x);
+	const __m128 camY = _mm_set1_ps(vCamPos.y);
+	const __m128 camZ = _mm_set1_ps(vCamPos.z);
+	const __m128 dX = _mm_max_ps(_mm_max_ps(_mm_sub_ps(minX, camX), _mm_sub_ps(camX, maxX)), zero);
+	const __m128 dY = _mm_max_ps(_mm_max_ps(_mm_sub_ps(minY, camY), _mm_sub_ps(camY, maxY)), zero);
+	const __m128 dZ = _mm_max_ps(_mm_max_ps(_mm_sub_ps(minZ, camZ), _mm_sub_ps(camZ, maxZ)), zero);
+	const __m128 distSq = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dX, dX), _mm_mul_ps(dY, dY)), _mm_mul_ps(dZ, dZ)), _mm_set1_ps(fZoomFactorSq));
+	const __m128 viewDist = _mm_load_ps(&m_maxViewDist[nFirst]);
+	_mm_storeu_ps(pDistanceSq, distSq);
+
+	nVisible = nLaneMask & ~_mm_movemask_ps(_mm_cmpgt_ps(distSq, _mm_mul_ps(viewDist, viewDist)));
+	if (!nVisible || bCompletelyInFrustum)
+	{
+		nInsideMask = nVisible;
+		return nVisible;
+	}
+
+	// per plane the corner farthest inside decides if a box is outside, the one farthest outside if it's completely inside
+	__m128 outside = zero;
+	__m128 overlap = zero;
+	for (int p = 0; p < FRUSTUM_PLANES; p++)
+	{
+		const Plane& plane = *rCam.GetFrustumPlane(p);
+		const __m128 nX = _mm_set1_ps(plane.n.x);
+		const __m128 nY = _mm_set1_ps(plane.n.y);
+		const __m128 nZ = _mm_set1_ps(plane.n.z);
+		const __m128 d = _mm_set1_ps(plane.d);
+
+		const __m128 inX = plane.n.x >= 0.f ? minX : maxX;
+		const __m128 inY = plane.n.y >= 0.f ? minY : maxY;
+		const __m128 inZ = plane.n.z >= 0.f ? minZ : maxZ;
+		const __m128 outX = plane.n.x >= 0.f ? maxX : minX;
+		const __m128 outY = plane.n.y >= 0.f ? maxY : minY;
+		const __m128 outZ = plane.n.z >= 0.f ? maxZ : minZ;
+
+		const __m128 distIn = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nX, inX), _mm_mul_ps(nY, inY)), _mm_add_ps(_mm_mul_ps(nZ, inZ), d));
+		const __m128 distOut = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nX, outX), _mm_mul_ps(nY, outY)), _mm_add_ps(_mm_mul_ps(nZ, outZ), d));
+
+		outside = _mm_or_ps(outside, _mm_cmpgt_ps(distIn, zero));
+		overlap = _mm_or_ps(overlap, _mm_cmpgt_ps(distOut, zero));
+	}
+
+	nVisible &= ~_mm_movemask_ps(outside);
+	nOverlap = nVisible & _mm_movemask_ps(overlap);
+#else
+	nVisible = 0;
+	nOverlap = 0;
+	for (uint32 nLane = 0; nLane < 4; nLane++)
+	{
+		if (!(nLaneMask & (1 << nLane)))
+			continue;
+
+		const uint32 i = nFirst + nLane;
+		const AABB box(Vec3(m_minX[i], m_minY[i], m_minZ[i]), Vec3(m_maxX[i], m_maxY[i], m_maxZ[i]));
+		pDistanceSq[nLane] = Distance::Point_AABBSq(vCamPos, box) * fZoomFactorSq;
+		if (pDistanceSq[nLane] > sqr(m_maxViewDist[i]))
+			continue;
+
+		const uint8 nCull = bCompletelyInFrustum ? CULL_INCLUSION : rCam.IsAABBVisible_FH(box);
+		if (nCull == CULL_EXCLUSION)
+			continue;
+
+		nVisible |= 1 << nLane;
+		if (nCull == CULL_OVERLAP)
+			nOverlap |= 1 << nLane;
+	}
+#endif
+
+	nInsideMask = nVisible & ~nOverlap;
+
+	// boxes crossing a plane get the exact test, as in the recursive traversal
+	for (uint32 nLane = 0; nOverlap; nLane++, nOverlap >>= 1)
+	{
+		if (!(nOverlap & 1))
+			continue;
+
+		const uint32 i = nFirst + nLane;
+		bool bAllInside = false;
+		if (!rCam.IsAABBVisible_EH(AABB(Vec3(m_minX[i], m_minY[i], m_minZ[i]), Vec3(m_maxX[i], m_maxY[i], m_maxZ[i])), &bAllInside))
+			nVisible &= ~(1 << nLane);
+	}
+
+	return nVisible;
+}
+
+void COctreeFlatTree::Render(bool bRootCompletelyInFrustum, int nRenderMask, const Vec3& vAmbColor, const SRenderingPassInfo& passInfo)
+{
+	if (m_bDirty)
+		Rebuild();
+
+	const CCamera& rCam = passInfo.GetCamera();
+	const Vec3& vCamPos = rCam.GetPosition();
+	const float fZoomFactorSq = sqr(passInfo.GetZoomFactor());
+
+	float arrDistanceSq[4];
+	uint32 nInsideMask = 0;
+
+	if (!CullBlock(0, 1, bRootCompletelyInFrustum, rCam, fZoomFactorSq, arrDistanceSq, nInsideMask))
+		return;
+
+	m_stack.Clear();
+	SStackEntry root = { 0, nInsideMask & 1, arrDistanceSq[0] };
+	m_stack.Add(root);
+
+	while (m_stack.Count())
+	{
+		const SStackEntry entry = m_stack.Last();
+		m_stack.DeleteLast();
+
+		COctreeNode* pNode = m_nodes[entry.nIndex];
+		const bool bNodeCompletelyInFrustum = entry.bCompletelyInFrustum != 0;
+
+		if (pNode->m_nOccludedFrameId == passInfo.GetFrameID())
+			continue;
+
+		if (!pNode->Render_Object_Node(bNodeCompletelyInFrustum, entry.fDistanceSq, nRenderMask, vAmbColor, passInfo))
+			continue;
+
+		if (m_bDirty)
+		{
+			// rendering the node changed the tree, finish the frame with the recursive traversal
+			pNode->Render_Object_Children(bNodeCompletelyInFrustum, nRenderMask, vAmbColor, passInfo);
+			for (int i = m_stack.Count() - 1; i >= 0; i--)
+				m_nodes[m_stack[i].nIndex]->Render_Object_Nodes(m_stack[i].bCompletelyInFrustum != 0, nRenderMask, vAmbColor, passInfo);
+			m_stack.Clear();
+			return;
+		}
+
+		const uint32 nFirstChild = m_firstChild[entry.nIndex];
+		if (nFirstChild == INVALID_INDEX)
+			continue;
+
+		const Vec3& vNodeCenter = pNode->m_vNodeCenter;
+		const int nFirst =
+		  ((vCamPos.x > vNodeCenter.x) ? 4 : 0) |
+		  ((vCamPos.y > vNodeCenter.y) ? 2 : 0) |
+		  ((vCamPos.z > vNodeCenter.z) ? 1 : 0);
+
+		SStackEntry arrVisible[8];
+		uint32 nVisibleRanks = 0;
+
+		const uint32 nChildren = m_childCount[entry.nIndex];
+		for (uint32 nBlock = 0; nBlock < nChildren; nBlock += 4)
+		{
+			const uint32 nLaneMask = (nChildren - nBlock >= 4) ? 0xf : ((1 << (nChildren - nBlock)) - 1);
+			const uint32 nVisible = CullBlock(nFirstChild + nBlock, nLaneMask, bNodeCompletelyInFrustum, rCam, fZoomFactorSq, arrDistanceSq, nInsideMask);
+
+			for (uint32 nLane = 0; nLane < 4; nLane++)
+			{
+				if (!(nVisible & (1 << nLane)))
+					continue;
+
+				const uint32 nIndex = nFirstChild + nBlock + nLane;
+				const uint32 nRank = s_childOrder[m_childSlot[nIndex] ^ nFirst];
+				arrVisible[nRank].nIndex = nIndex;
+				arrVisible[nRank].bCompletelyInFrustum = (nInsideMask >> nLane) & 1;
+				arrVisible[nRank].fDistanceSq = arrDistanceSq[nLane];
+				nVisibleRanks |= 1 << nRank;
+			}
+		}
+
+		// the first child to visit goes on top of the stack
+		for (int nRank = 7; nRank >= 0; nRank--)
+			if (nVisibleRanks & (1 << nRank))
+				m_stack.Add(arrVisible[nRank]);
+	}
+}
+
+void COctreeFlatTree::GetMemoryUsage(ICrySizer* pSizer) const
+{
+	pSizer->AddObject(this, sizeof(*this));
+	pSizer->AddObject(m_minX.data(), m_minX.capacity() * sizeof(float));
+	pSizer->AddObject(m_minY.data(), m_minY.capacity() * sizeof(float));
+	pSizer->AddObject(m_minZ.data(), m_minZ.capacity() * sizeof(float));
+	pSizer->AddObject(m_maxX.data(), m_maxX.capacity() * sizeof(float));
+	pSizer->AddObject(m_maxY.data(), m_maxY.capacity() * sizeof(float));
+	pSizer->AddObject(m_maxZ.data(), m_maxZ.capacity() * sizeof(float));
+	pSizer->AddObject(m_maxViewDist.data(), m_maxViewDist.capacity() * sizeof(float));
+	pSizer->AddObject(m_nodes);
+	pSizer->AddObject(m_firstChild);
+	pSizer->AddObject(m_childCount);
+	pSizer->AddObject(m_childSlot);
+	pSizer->AddObject(m_stack.GetElements(), m_stack.capacity() * sizeof(SStackEntry));
+}
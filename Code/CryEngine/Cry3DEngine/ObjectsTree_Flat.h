@@ -0,0 +1,56 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#pragma once
+
+class COctreeNode;
+
+//////////////////////////////////////////////////////////////////////////
+// Flattened copy of the hierarchy and the culling data of one objects tree, owned by the root node and
+// used by COctreeNode::Render_Object_Nodes when e_ObjectsTreeFlatCulling is set.
+// Nodes are stored breadth-first in SoA arrays, the children of a node are a contiguous span padded to
+// a multiple of 4 entries, so the frustum and view distance tests of 4 children run at once.
+// The nodes write their bounds through (UpdateNode), adding or removing nodes and MarkAsUncompiled mark
+// the copy dirty and it's rebuilt before the next traversal. Node contents stay in the node lists.
+//////////////////////////////////////////////////////////////////////////
+class COctreeFlatTree : public Cry3DEngineBase
+{
+public:
+	enum { INVALID_INDEX = 0xffffffff };
+
+	explicit COctreeFlatTree(COctreeNode* pRoot);
+
+	void   MarkDirty()     { m_bDirty = true; }
+	bool   IsDirty() const { return m_bDirty; }
+	void   Rebuild();
+	void   UpdateNode(uint32 nIndex, const AABB& objectsBox, float fObjectsMaxViewDist);
+	void   Render(bool bRootCompletelyInFrustum, int nRenderMask, const Vec3& vAmbColor, const SRenderingPassInfo& passInfo);
+
+	uint32 GetNodeCount() const { return m_nNodes; }
+	void   GetMemoryUsage(ICrySizer* pSizer) const;
+
+private:
+	struct SStackEntry
+	{
+		uint32 nIndex;
+		uint32 bCompletelyInFrustum;
+		float  fDistanceSq;
+	};
+
+	void   AddBlock();
+	// Tests the lanes of nLaneMask of the 4 entries at nFirst, returns the mask of the visible ones.
+	uint32 CullBlock(uint32 nFirst, uint32 nLaneMask, bool bCompletelyInFrustum, const CCamera& rCam, float fZoomFactorSq, float* pDistanceSq, uint32& nInsideMask) const;
+
+	COctreeNode*                    m_pRoot;
+	bool                            m_bDirty;
+	uint32                          m_nNodes;
+
+	stl::aligned_vector<float, 16>  m_minX, m_minY, m_minZ;
+	stl::aligned_vector<float, 16>  m_maxX, m_maxY, m_maxZ;
+	stl::aligned_vector<float, 16>  m_maxViewDist;
+	std::vector<COctreeNode*>       m_nodes;
+	std::vector<uint32>             m_firstChild;  // first entry of the child span, INVALID_INDEX if there are no children
+	std::vector<uint8>              m_childCount;  // used entries of the child span
+	std::vector<uint8>              m_childSlot;   // index in the m_arrChilds of the parent
+
+	PodArray<SStackEntry>           m_stack;
+};
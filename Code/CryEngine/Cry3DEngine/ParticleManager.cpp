@@ -978,7 +978,13 @@ bool CParticleManager::LoadPreloadLibList(const cstr filename, const bool bLoadR
 		string sLine;
 		while (!(sLine = sAllText.Tokenize("\r\n", pos)).empty())
 		{
-			if (LoadLibrary(sLine, NULL, bLoadResources))
+			// pfx2 effects are listed by file name, and loaded in jobs
+			if (!stricmp(PathUtil::GetExt(sLine), "pfx"))
+			{
+				if (m_pParticleSystem->PreloadEffect(sLine))
+					nCount++;
+			}
+			else if (LoadLibrary(sLine, NULL, bLoadResources))
 			{
 				nCount++;
 			}
@@ -63,6 +63,8 @@ public:
 	EParticleDataType GetDataType() const;
 	string            GetSourceDescription() const;
 	float             Adjust(float sample) const { return sample * m_domainScale + m_domainBias; }
+	// GPU modifier tables are sampled over the particle's own normalized age
+	bool              IsSampledByAge() const     { return m_domain == EDomain::Age && m_sourceOwner == EDomainOwner::Self && !m_spawnOnly; }
 	void              SerializeInplace(Serialization::IArchive& ar);
 
 protected:
@@ -322,6 +322,9 @@ public:
 			pParams->m_renderStateFlags |= OS_NODEPTH_TEST;
 	}
 
+	// Applied per render object, GPU components get the same emitter visibility
+	virtual bool CanUseGpu(string* pReason) const override { return true; }
+
 	virtual void Serialize(Serialization::IArchive& ar) override
 	{
 		CParticleFeature::Serialize(ar);
@@ -17,21 +17,49 @@ extern EParticleDataType EPVF_PositionPrev;
 // CFeatureCollision
 
 CFeatureCollision::CFeatureCollision()
-	: m_collisionsLimitMode(ECollisionLimitMode::Unlimited), m_rotateToNormal(false)
+	: CParticleFeature(gpu_pfx2::eGpuFeatureType_Collision)
+	, m_collisionsLimitMode(ECollisionLimitMode::Unlimited), m_rotateToNormal(false)
 	, m_terrain(true), m_staticObjects(true), m_dynamicObjects(false)
 {
 }
 
 void CFeatureCollision::AddToComponent(CParticleComponent* pComponent, SComponentParams* pParams)
 {
+	if (auto pInt = GetGpuInterface())
+	{
+		// On the GPU the particles collide as points against the depth buffer
+		gpu_pfx2::SFeatureParametersCollision params;
+		params.offset = 0.0f;
+		params.radius = 0.0f;
+		params.restitution = m_elasticity;
+		pInt->SetParameters(params);
+		pComponent->AddToUpdateList(EUL_Update, this);
+		return;
+	}
+
 	pComponent->AddToUpdateList(EUL_InitUpdate, this);
 	pComponent->AddToUpdateList(EUL_PostUpdate, this);
 	pComponent->AddParticleData(EPVF_PositionPrev);
 	pComponent->AddParticleData(EPDT_ContactPoint);
+	pComponent->AddParticleData(EPDT_SpawnId);
 	if (m_rotateToNormal)
 		pComponent->AddParticleData(EPQF_Orientation);
 }
 
+bool CFeatureCollision::CanUseGpu(string* pReason) const
+{
+	const char* reason = nullptr;
+	if (m_collisionsLimitMode != ECollisionLimitMode::Unlimited)
+		reason = "Collision Limit";
+	else if (m_rotateToNormal)
+		reason = "Rotate to Normal";
+	else if (m_friction != 0.0f)
+		reason = "Friction";
+	if (reason && pReason)
+		*pReason = reason;
+	return !reason;
+}
+
 void CFeatureCollision::Serialize(Serialization::IArchive& ar)
 {
 	CParticleFeature::Serialize(ar);
@@ -119,6 +147,87 @@ static float kExpandBack       = 0.01f,  // Fraction of test distance to expand
 
 static const int kCollisionsFlags = sf_max_pierceable | (geom_colltype_ray | geom_colltype13) << rwi_colltype_bit | rwi_colltype_any | rwi_ignore_noncolliding | rwi_ignore_back_faces;
 
+//////////////////////////////////////////////////////////////////////////
+// CCollisionBatch
+
+CCollisionBatch::CCollisionBatch()
+	: m_numQueuingRays(0)
+	, m_numQueuedRays(0)
+{
+}
+
+CCollisionBatch& CCollisionBatch::Get()
+{
+	static CCollisionBatch batch;
+	return batch;
+}
+
+void CCollisionBatch::BeginFrame()
+{
+	CRY_PFX2_PROFILE_DETAIL;
+
+	m_lock.Lock();
+	m_hits.swap(m_incomingHits);
+	m_incomingHits.clear();
+	m_lock.Unlock();
+
+	std::sort(m_hits.begin(), m_hits.end());
+	m_numQueuedRays = uint(CryInterlockedExchange(&m_numQueuingRays, 0));
+}
+
+void CCollisionBatch::QueueRays(const CParticleComponentRuntime* pRuntime, TConstArray<Vec3> starts, TConstArray<Vec3> rays, TConstArray<int> spawnIds, int objectFilter)
+{
+	CRY_PFX2_PROFILE_DETAIL;
+
+	if (rays.empty())
+		return;
+
+	// all rays of the runtime go to the queue under one lock, iForeignData carries the spawn id
+	IPhysicalWorld::SRWIBatchParams params;
+	params.pOrg = starts.data();
+	params.pDir = rays.data();
+	params.nRays = int(rays.size());
+	params.objtypes = objectFilter;
+	params.flags = kCollisionsFlags | rwi_queue;
+	params.nMaxHits = 1;
+	params.pForeignData = const_cast<CParticleComponentRuntime*>(pRuntime);
+	params.piForeignData = spawnIds.data();
+	params.OnEvent = OnRayResult;
+	gEnv->pPhysicalWorld->RayWorldIntersectionBatch(params);
+
+	CryInterlockedAdd(&m_numQueuingRays, LONG(rays.size()));
+}
+
+const CCollisionBatch::SHit* CCollisionBatch::FindHit(const CParticleComponentRuntime* pRuntime, uint32 spawnId) const
+{
+	SHit key;
+	key.m_pRuntime = pRuntime;
+	key.m_spawnId = spawnId;
+	auto it = std::lower_bound(m_hits.begin(), m_hits.end(), key);
+	if (it != m_hits.end() && it->m_pRuntime == pRuntime && it->m_spawnId == spawnId)
+		return &*it;
+	return nullptr;
+}
+
+int CCollisionBatch::OnRayResult(const EventPhysRWIResult* pEvent)
+{
+	// called by the physics for every queued ray, the hits come from its pool and are only valid here
+	if (pEvent->nHits > 0 && pEvent->pHits[0].dist >= 0.0f)
+	{
+		SHit hit;
+		hit.m_pRuntime = pEvent->pForeignData;
+		hit.m_spawnId = uint32(pEvent->iForeignData);
+		hit.m_point = pEvent->pHits[0].pt;
+		hit.m_normal = pEvent->pHits[0].n;
+
+		CCollisionBatch& batch = Get();
+		batch.m_lock.Lock();
+		batch.m_incomingHits.push_back(hit);
+		batch.m_lock.Unlock();
+	}
+	return 1;
+}
+
 // Quadratic path structure, and utilities
 template<typename T, typename F>
 struct QuadPathT
@@ -439,7 +548,7 @@ bool CFeatureCollision::DoCollision(SContactPoint& contact, QuadPath& path, int
 }
 
 
-void CFeatureCollision::DoCollisions(const SUpdateContext& context) const
+void CFeatureCollision::DoCollisions(const SUpdateContext& context, bool slidingOnly) const
 {
 	// #PFX2_TODO : raytrace caching not implemented yet
 	const int objectFilter = GetRayTraceFilter();
@@ -457,7 +566,7 @@ void CFeatureCollision::DoCollisions(const SUpdateContext& context) const
 	for (auto particleId : context.GetUpdateRange())
 	{
 		SContactPoint contact = contactPoints.Load(particleId);
-		if (contact.m_state.ignore)
+		if (contact.m_state.ignore || (slidingOnly && !contact.m_state.sliding))
 			continue;
 
 		float dT = DeltaTime(context.m_deltaTime, particleId, normAges, lifeTimes);
@@ -510,11 +619,123 @@ void CFeatureCollision::DoCollisions(const SUpdateContext& context) const
 	}
 }
 
+void CFeatureCollision::DoBatchedCollisions(const SUpdateContext& context) const
+{
+	CCollisionBatch& batch = CCollisionBatch::Get();
+	const CParticleComponentRuntime* pRuntime = &context.m_runtime;
+
+	CParticleContainer& container = context.m_container;
+	const IFStream normAges = container.GetIFStream(EPDT_NormalAge);
+	const IFStream lifeTimes = container.GetIFStream(EPDT_LifeTime);
+	const IPidStream spawnIds = container.GetIPidStream(EPDT_SpawnId);
+	IVec3Stream positionsPrev = container.GetIVec3Stream(EPVF_PositionPrev);
+	IOVec3Stream positions = container.GetIOVec3Stream(EPVF_Position);
+	IOQuatStream orientations = container.GetIOQuatStream(EPQF_Orientation);
+	IOVec3Stream velocities = container.GetIOVec3Stream(EPVF_Velocity);
+	IOFStream collideSpeeds = container.GetIOFStream(EPDT_CollideSpeed);
+	TIOStream<SContactPoint> contactPoints = container.GetTIOStream<SContactPoint>(EPDT_ContactPoint);
+
+	const SUpdateRange range = context.GetUpdateRange();
+	THeapArray<Vec3> starts(*context.m_pMemHeap);
+	THeapArray<Vec3> rays(*context.m_pMemHeap);
+	THeapArray<int> rayIds(*context.m_pMemHeap);
+	starts.reserve(range.size());
+	rays.reserve(range.size());
+	rayIds.reserve(range.size());
+
+	for (auto particleId : range)
+	{
+		// sliding particles need the exact contact every frame, they take the immediate path
+		SContactPoint contact = contactPoints.Load(particleId);
+		if (contact.m_state.ignore || contact.m_state.sliding)
+			continue;
+
+		const float dT = DeltaTime(context.m_deltaTime, particleId, normAges, lifeTimes);
+		if (dT == 0.0f)
+			continue;
+
+		const uint32 spawnId = spawnIds.Load(particleId);
+		const Vec3 position0 = positionsPrev.Load(particleId);
+		Vec3 position1 = positions.Load(particleId);
+		contact.m_state.collided = 0;
+
+		// the ray queued last frame hit a surface, move the particle back out if it went through
+		const CCollisionBatch::SHit* pHit = batch.FindHit(pRuntime, spawnId);
+		const float depth = pHit ? (position1 - pHit->m_point) | pHit->m_normal : 0.0f;
+		if (depth < 0.0f)
+		{
+			Vec3 velocity1 = velocities.Load(particleId);
+			QuadPath path;
+			path.FromPos01Vel1(position0, position1, velocity1, dT);
+
+			const float accNorm = path.acc | pHit->m_normal;
+			const float velNorm = min(velocity1 | pHit->m_normal, 0.0f);
+			float velBounce = -velNorm * m_elasticity;
+			if (Bounces(accNorm, velBounce))
+			{
+				position1 -= pHit->m_normal * (depth * (1.0f + m_elasticity));
+			}
+			else
+			{
+				contact.m_state.sliding = 1;
+				velBounce = 0.0f;
+				position1 -= pHit->m_normal * depth;
+			}
+			position1 += pHit->m_normal * kMinBounceDist;
+			velocity1 += pHit->m_normal * (velBounce - velNorm);
+
+			contact.m_point = pHit->m_point;
+			contact.m_normal = pHit->m_normal;
+			contact.m_speedIn = -velNorm;
+			contact.m_time = 0.0f;
+			contact.m_totalCollisions++;
+			contact.m_state.collided = 1;
+
+			positions.Store(particleId, position1);
+			velocities.Store(particleId, velocity1);
+			if (collideSpeeds.IsValid())
+				collideSpeeds.Store(particleId, contact.m_speedIn);
+			if (m_rotateToNormal)
+			{
+				Quat orientation = orientations.Load(particleId);
+				const Quat rotate = Quat::CreateRotationV0V1(orientation.GetColumn2(), contact.m_normal);
+				orientation = rotate * orientation;
+				orientations.Store(particleId, orientation);
+			}
+		}
+		else
+		{
+			const Vec3 ray = position1 - position0;
+			if (!ray.IsZero())
+			{
+				starts.push_back(position0 - ray * kExpandBack);
+				rays.push_back(ray * (1.0f + kExpandBack + kExpandFront));
+				rayIds.push_back(int(spawnId));
+			}
+		}
+
+		contactPoints.Store(particleId, contact);
+	}
+
+	batch.QueueRays(pRuntime, starts, rays, rayIds, GetRayTraceFilter());
+}
+
 void CFeatureCollision::PostUpdate(const SUpdateContext& context)
 {
 	CRY_PFX2_PROFILE_DETAIL;
 
-	DoCollisions(context);
+	if (context.m_runtime.GetEmitter()->GetBudgetLod() >= EBL_NoCollisions)
+		return;
+
+	if (Cry3DEngineBase::GetCVars()->e_ParticlesCollisionBatch)
+	{
+		DoBatchedCollisions(context);
+		DoCollisions(context, true);
+	}
+	else
+	{
+		DoCollisions(context, false);
+	}
 
 	switch (m_collisionsLimitMode)
 	{
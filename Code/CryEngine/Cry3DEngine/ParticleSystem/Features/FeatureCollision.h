@@ -46,6 +46,50 @@ SERIALIZATION_ENUM_DECLARE(ECollisionLimitMode, ,
 	Kill
 	)
 
+//////////////////////////////////////////////////////////////////////////
+// CCollisionBatch
+// With e_ParticlesCollisionBatch the rays of the flying particles are queued to the physics rwi queue
+// instead of being traced inside the update. The hits arrive during the physics frame and are applied
+// at the next particle update, moving the particles back out of the surface they went through.
+
+class CCollisionBatch
+{
+public:
+	struct SHit
+	{
+		const void* m_pRuntime; // key only, never dereferenced
+		uint32      m_spawnId;
+		Vec3        m_point;
+		Vec3        m_normal;
+
+		bool operator<(const SHit& other) const
+		{
+			return m_pRuntime < other.m_pRuntime || (m_pRuntime == other.m_pRuntime && m_spawnId < other.m_spawnId);
+		}
+	};
+
+	static CCollisionBatch& Get();
+
+	// called on the main thread before the update jobs start
+	void        BeginFrame();
+	void        QueueRays(const CParticleComponentRuntime* pRuntime, TConstArray<Vec3> starts, TConstArray<Vec3> rays, TConstArray<int> spawnIds, int objectFilter);
+	const SHit* FindHit(const CParticleComponentRuntime* pRuntime, uint32 spawnId) const;
+
+	uint        GetNumQueuedRays() const { return m_numQueuedRays; }
+	uint        GetNumHits() const       { return uint(m_hits.size()); }
+
+private:
+	CCollisionBatch();
+
+	static int OnRayResult(const EventPhysRWIResult* pEvent);
+
+	CryMutex          m_lock;
+	std::vector<SHit> m_incomingHits;
+	std::vector<SHit> m_hits;
+	volatile LONG     m_numQueuingRays;
+	uint              m_numQueuedRays;
+};
+
 //////////////////////////////////////////////////////////////////////////
 // CFeatureCollision
 
@@ -58,6 +102,7 @@ public:
 	CFeatureCollision();
 
 	virtual void AddToComponent(CParticleComponent* pComponent, SComponentParams* pParams) override;
+	virtual bool CanUseGpu(string* pReason) const override;
 	virtual void Serialize(Serialization::IArchive& ar) override;
 	virtual void InitParticles(const SUpdateContext& context) override;
 	virtual void PostUpdate(const SUpdateContext& context) override;
@@ -67,7 +112,8 @@ public:
 	int   GetRayTraceFilter() const;
 
 private:
-	void DoCollisions(const SUpdateContext& context) const;
+	void DoCollisions(const SUpdateContext& context, bool slidingOnly) const;
+	void DoBatchedCollisions(const SUpdateContext& context) const;
 	bool DoCollision(SContactPoint& contact, QuadPath& path, int objectFilter, bool doSliding = true) const;
 
 	template<typename TCollisionLimit>
@@ -123,6 +123,20 @@ void CFeatureFieldColor::AddToUpdate(IColorModifier* pMod)
 		m_modUpdate.push_back(pMod);
 }
 
+bool CFeatureFieldColor::CanUseGpu(string* pReason) const
+{
+	for (auto& pModifier : m_modifiers)
+	{
+		if (pModifier && pModifier->IsEnabled() && !pModifier->CanSample())
+		{
+			if (pReason)
+				*pReason = "Modifiers other than Color Curve over Age";
+			return false;
+		}
+	}
+	return true;
+}
+
 void CFeatureFieldColor::Sample(Vec3* samples, const int numSamples)
 {
 	Vec3 baseColor(m_color.r / 255.f, m_color.g / 255.f, m_color.b / 255.f);
@@ -210,7 +224,10 @@ public:
 	virtual void AddToParam(CParticleComponent* pComponent, CFeatureFieldColor* pParam)
 	{
 		if (m_spline.HasKeys())
+		{
+			m_spline.Bake(Cry3DEngineBase::GetCVars()->e_ParticlesSplineLUTError);
 			CDomain::AddToParam(pComponent, pParam, this);
+		}
 	}
 
 	virtual void Serialize(Serialization::IArchive& ar)
@@ -248,13 +265,18 @@ public:
 	{
 		for (int i = 0; i < samplePoints; ++i)
 		{
-			const float point = (float) i / samplePoints;
+			const float point = Adjust((float) i / samplePoints);
 			Vec3 color0 = samples[i];
 			ColorF curve = m_spline.Interpolate(point);
 			Vec3 color1(color0.x * curve.r, color0.y * curve.g, color0.z * curve.b);
 			samples[i] = color1;
 		}
 	}
+
+	virtual bool CanSample() const
+	{
+		return IsSampledByAge();
+	}
 private:
 	CParticleColorSpline m_spline;
 };
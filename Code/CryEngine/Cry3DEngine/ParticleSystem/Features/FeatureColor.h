@@ -17,6 +17,7 @@ public:
 	virtual void Serialize(Serialization::IArchive& ar);
 	virtual void Modify(const SUpdateContext& context, const SUpdateRange& range, IOColorStream stream) const {}
 	virtual void Sample(Vec3* samples, int samplePoints) const                                                {}
+	virtual bool CanSample() const                                                                            { return false; }
 private:
 	SEnable m_enabled;
 };
@@ -35,6 +36,7 @@ public:
 	virtual void Serialize(Serialization::IArchive& ar) override;
 	virtual void InitParticles(const SUpdateContext& context) override;
 	virtual void Update(const SUpdateContext& context) override;
+	virtual bool CanUseGpu(string* pReason) const override;
 	virtual void AddToInitParticles(IColorModifier* pMod);
 	virtual void AddToUpdate(IColorModifier* pMod);
 
@@ -65,6 +65,15 @@ public:
 		pComponent->AddToUpdateList(EUL_Update, this);
 	}
 
+	virtual bool CanUseGpu(string* pReason) const override
+	{
+		if (m_opacity.CanSample())
+			return true;
+		if (pReason)
+			*pReason = "Modifiers other than Curve over Age";
+		return false;
+	}
+
 	virtual void Serialize(Serialization::IArchive& ar) override
 	{
 		CParticleFeature::Serialize(ar);
@@ -123,6 +132,15 @@ public:
 		}
 	}
 
+	virtual bool CanUseGpu(string* pReason) const override
+	{
+		if (m_size.CanSample())
+			return true;
+		if (pReason)
+			*pReason = "Modifiers other than Curve over Age";
+		return false;
+	}
+
 	virtual void Serialize(Serialization::IArchive& ar) override
 	{
 		CParticleFeature::Serialize(ar);
@@ -30,6 +30,15 @@ public:
 		return EFT_Life;
 	}
 
+	virtual bool CanUseGpu(string* pReason) const override
+	{
+		if (!m_lifeTime.HasEnabledModifiers())
+			return true;
+		if (pReason)
+			*pReason = "Life Time modifiers";
+		return false;
+	}
+
 	virtual void Serialize(Serialization::IArchive& ar) override
 	{
 		CParticleFeature::Serialize(ar);
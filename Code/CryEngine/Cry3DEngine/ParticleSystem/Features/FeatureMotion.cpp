@@ -3,6 +3,7 @@
 #include "StdAfx.h"
 #include "FeatureMotion.h"
 #include "ParticleSystem/ParticleEmitter.h"
+#include "ParticleSystem/ParticleKernelsAVX2.h"
 #include <CrySerialization/Math.h>
 #include <CrySystem/CryUnitTest.h>
 
@@ -72,6 +73,22 @@ void CFeatureMotionPhysics::AddToComponent(CParticleComponent* pComponent, SComp
 	}
 }
 
+bool CFeatureMotionPhysics::CanUseGpu(string* pReason) const
+{
+	// The GPU integrates the base gravity and drag, with the turbulence, gravity and vortex effectors
+	const char* reason = nullptr;
+	if (m_gravity.HasEnabledModifiers() || m_drag.HasEnabledModifiers())
+		reason = "Gravity or Drag modifiers";
+	for (const PLocalEffector& pEffector : m_localEffectors)
+	{
+		if (pEffector && pEffector->IsEnabled() && !pEffector->CanUseGpu())
+			reason = "Spiral effector";
+	}
+	if (reason && pReason)
+		*pReason = reason;
+	return !reason;
+}
+
 void CFeatureMotionPhysics::Serialize(Serialization::IArchive& ar)
 {
 	CParticleFeature::Serialize(ar);
@@ -184,6 +201,17 @@ void CFeatureMotionPhysics::LinearIntegral(const SUpdateContext& context)
 	IFStream normAges = container.GetIFStream(EPDT_NormalAge);
 	IFStream lifeTimes = container.GetIFStream(EPDT_LifeTime);
 	const floatv deltaTime = ToFloatv(context.m_deltaTime);
+
+	if (ParticleKernelsAVX2::IsEnabled() && container.HasData(EPVF_Velocity) && container.HasData(EPDT_NormalAge) && container.HasData(EPDT_LifeTime))
+	{
+		const SGroupRange range = context.GetUpdateGroupRange();
+		ParticleKernelsAVX2::LinearIntegral(
+		  container.GetData<float>(EPVF_Position), container.GetData<float>(EPVF_Position + 1u), container.GetData<float>(EPVF_Position + 2u),
+		  container.GetData<float>(EPVF_Velocity), container.GetData<float>(EPVF_Velocity + 1u), container.GetData<float>(EPVF_Velocity + 2u),
+		  container.GetData<float>(EPDT_NormalAge), container.GetData<float>(EPDT_LifeTime),
+		  context.m_deltaTime, +range.m_begin, +range.m_end);
+		return;
+	}
 	
 	for (auto particleGroupId : context.GetUpdateGroupRange())
 	{
@@ -20,6 +20,7 @@ public:
 	virtual void ComputeMove(const SUpdateContext& context, IOVec3Stream localMoves, float fTime) {}
 	virtual void Serialize(Serialization::IArchive& ar);
 	virtual void SetParameters(gpu_pfx2::IParticleFeatureGpuInterface* gpuInterface) const {}
+	virtual bool CanUseGpu() const                                                          { return false; }
 private:
 	SEnable m_enabled;
 };
@@ -45,6 +46,7 @@ public:
 	// CParticleFeature
 	virtual EFeatureType GetFeatureType() override { return EFT_Motion; }
 	virtual void         AddToComponent(CParticleComponent* pComponent, SComponentParams* pParams) override;
+	virtual bool         CanUseGpu(string* pReason) const override;
 
 	virtual void Serialize(Serialization::IArchive& ar) override;
 	virtual void InitParticles(const SUpdateContext& context) override;
@@ -174,77 +174,90 @@ void CFeatureRenderRibbon::MakeRibbons(CParticleComponentRuntime* pComponentRunt
 
 	const uint32 threadId = JobManager::GetWorkerThreadId();
 	auto& memHep = GetPSystem()->GetMemHeap(threadId);
-	const SUpdateContext context = SUpdateContext(pComponentRuntime);
 	const CParticleContainer& container = pComponentRuntime->GetContainer();
-	const IUintStream ribbonIds = container.GetIUintStream(EPDT_RibbonId);
-	const IUintStream spawnIds = container.GetIUintStream(EPDT_SpawnId);
-	const TIStream<uint8> states = container.GetTIStream<uint8>(EPDT_State);
+	const TParticleId* pRibbonIds = container.GetData<TParticleId>(EPDT_RibbonId);
+	const uint32* pSpawnIds = container.GetData<uint32>(EPDT_SpawnId);
+	const uint8* pStates = container.GetData<uint8>(EPDT_State);
 	const TParticleId lastParticleId = container.GetLastParticleId();
 	uint numValidParticles = 0;
+	*pNumVertices = 0;
 
+	// sort keys are the ribbon id in the high and the spawn id in the low bits, all bits are set for dead particles
+	const uint64 noKey = uint64(-1);
+	THeapArray<uint64> sortKeys(memHep, lastParticleId);
+	TParticleId particleId = 0;
+#ifdef CRY_PFX2_USE_SSE
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i deadMask = _mm_set1_epi32(ESB_Dead);
+	for (; particleId + 4 <= lastParticleId; particleId += 4)
 	{
-		const uint64 noKey = uint64(-1);
-		THeapArray<uint64> sortEntries(memHep, lastParticleId);
-		for (auto particleId : context.GetUpdateRange())
-		{
-			const TParticleId ribbonId = ribbonIds.Load(particleId);
-			const uint32 spawnId = spawnIds.Load(particleId);
-			const uint64 key = (uint64(ribbonId) << 32) | uint64(spawnId);
-			const uint8 state = states.Load(particleId);
-			const bool valid = (state & ESB_Dead) == 0;
-			numValidParticles += uint(valid);
-			sortEntries[particleId] = valid ? key : noKey;
-		}
-		RadixSort(
-		  pSortEntries->begin(), pSortEntries->end(),
-		  sortEntries.begin(), sortEntries.end(), memHep);
+		const __m128i ribbonIds = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pRibbonIds + particleId));
+		const __m128i spawnIds = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSpawnIds + particleId));
+		int32 states4;
+		memcpy(&states4, pStates + particleId, sizeof(states4));
+		const __m128i states = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(states4), zero), zero);
+		const __m128i invalid = _mm_cmpeq_epi32(_mm_cmpeq_epi32(_mm_and_si128(states, deadMask), zero), zero);
+		const __m128i keys01 = _mm_or_si128(_mm_unpacklo_epi32(spawnIds, ribbonIds), _mm_unpacklo_epi32(invalid, invalid));
+		const __m128i keys23 = _mm_or_si128(_mm_unpackhi_epi32(spawnIds, ribbonIds), _mm_unpackhi_epi32(invalid, invalid));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&sortKeys[particleId]), keys01);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&sortKeys[particleId + 2]), keys23);
+		numValidParticles += 4 - CountBits(uint8(_mm_movemask_ps(_mm_castsi128_ps(invalid))));
+	}
+#endif
+	for (; particleId < lastParticleId; ++particleId)
+	{
+		const uint64 key = (uint64(pRibbonIds[particleId]) << 32) | uint64(pSpawnIds[particleId]);
+		const bool valid = (pStates[particleId] & ESB_Dead) == 0;
+		numValidParticles += uint(valid);
+		sortKeys[particleId] = valid ? key : noKey;
 	}
+	if (numValidParticles == 0)
+		return;
 
-	uint ribbonCount = 0;
-	uint lastRibbonId = ribbonIds.Load((*pSortEntries)[0]);
-	SRibbon ribbon;
-	ribbon.m_firstIdx = 0;
-	ribbon.m_lastIdx = 0;
-	for (; ribbon.m_lastIdx < numValidParticles; ++ribbon.m_lastIdx)
+	RadixSort(
+	  pSortEntries->begin(), pSortEntries->end(),
+	  sortKeys.begin(), sortKeys.end(), memHep);
+
+	// ribbon ids in sorted order followed by a sentinel, a ribbon ends wherever two consecutive ids differ
+	THeapArray<uint32> sortedRibbonIds(memHep, numValidParticles + 1);
+	for (uint idx = 0; idx < numValidParticles; ++idx)
+		sortedRibbonIds[idx] = uint32(sortKeys[(*pSortEntries)[idx]] >> 32);
+	sortedRibbonIds[numValidParticles] = ~sortedRibbonIds[numValidParticles - 1];
+
+	THeapArray<uint> ribbonEnds(memHep, numValidParticles);
+	uint numRibbonEnds = 0;
+	uint idx = 0;
+#ifdef CRY_PFX2_USE_SSE
+	for (; idx + 4 <= numValidParticles; idx += 4)
 	{
-		const TParticleId particleId = (*pSortEntries)[ribbon.m_lastIdx];
-		const TParticleId ribbonId = ribbonIds.Load(particleId);
-		if (ribbonId != lastRibbonId)
-		{
-			if ((ribbon.m_lastIdx - ribbon.m_firstIdx) >= 2)
-				++ribbonCount;
-			ribbon.m_firstIdx = ribbon.m_lastIdx;
-		}
-		lastRibbonId = ribbonId;
+		const __m128i ids0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&sortedRibbonIds[idx]));
+		const __m128i ids1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&sortedRibbonIds[idx + 1]));
+		uint32 endMask = uint32(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(ids0, ids1)))) ^ 0xf;
+		for (; endMask; endMask &= endMask - 1)
+			ribbonEnds[numRibbonEnds++] = idx + countTrailingZeros32(endMask) + 1;
 	}
-	if (ribbon.m_lastIdx - ribbon.m_firstIdx >= 2)
-		++ribbonCount;
-	pRibbons->reserve(ribbonCount);
-	ribbon.m_firstIdx = 0;
-	ribbon.m_lastIdx = 0;
-	for (; ribbon.m_lastIdx < numValidParticles; ++ribbon.m_lastIdx)
+#endif
+	for (; idx < numValidParticles; ++idx)
 	{
-		const TParticleId particleId = (*pSortEntries)[ribbon.m_lastIdx];
-		const TParticleId ribbonId = ribbonIds.Load(particleId);
-		if (ribbonId != lastRibbonId)
-		{
-			if ((ribbon.m_lastIdx - ribbon.m_firstIdx) >= 2)
-				pRibbons->push_back(ribbon);
-			ribbon.m_firstIdx = ribbon.m_lastIdx;
-		}
-		lastRibbonId = ribbonId;
+		if (sortedRibbonIds[idx] != sortedRibbonIds[idx + 1])
+			ribbonEnds[numRibbonEnds++] = idx + 1;
 	}
-	if (ribbon.m_lastIdx - ribbon.m_firstIdx >= 2)
-		pRibbons->push_back(ribbon);
 
-	*pNumVertices = 0;
-	for (uint ribbonId = 0; ribbonId < uint(pRibbons->size()); ++ribbonId)
+	pRibbons->reserve(numRibbonEnds);
+	SRibbon ribbon;
+	ribbon.m_firstIdx = 0;
+	for (uint endIdx = 0; endIdx < numRibbonEnds; ++endIdx)
 	{
-		const SRibbon ribbon = (*pRibbons)[ribbonId];
+		ribbon.m_lastIdx = ribbonEnds[endIdx];
 		const uint numSegments = ribbon.m_lastIdx - ribbon.m_firstIdx;
-		*pNumVertices += numSegments + 1;
-		if (m_connectToOrigin)
-			++*pNumVertices;
+		if (numSegments >= 2)
+		{
+			pRibbons->push_back(ribbon);
+			*pNumVertices += numSegments + 1;
+			if (m_connectToOrigin)
+				++*pNumVertices;
+		}
+		ribbon.m_firstIdx = ribbon.m_lastIdx;
 	}
 }
 
@@ -71,7 +71,9 @@ public:
 
 	CFeatureRenderSprites();
 
+	virtual void ResolveDependency(CParticleComponent* pComponent) override;
 	virtual void AddToComponent(CParticleComponent* pComponent, SComponentParams* pParams) override;
+	virtual bool CanUseGpu(string* pReason) const override;
 	virtual void ComputeVertices(CParticleComponentRuntime* pComponentRuntime, const SCameraInfo& camInfo, CREParticle* pRE, uint64 uRenderFlags, float fMaxPixels) override;
 	virtual void Serialize(Serialization::IArchive& ar) override;
 
@@ -101,7 +103,8 @@ CRY_PFX2_IMPLEMENT_FEATURE(CParticleFeature, CFeatureRenderSprites, "Render", "S
 //////////////////////////////////////////////////////////////////////////
 
 CFeatureRenderSprites::CFeatureRenderSprites()
-	: m_sortMode(ESortMode::None)
+	: BaseClass(gpu_pfx2::eGpuFeatureType_RenderGpu)
+	, m_sortMode(ESortMode::None)
 	, m_facingMode(EFacingMode::Screen)
 	, m_aspectRatio(1.0f)
 	, m_axisScale(0.0f)
@@ -114,10 +117,50 @@ CFeatureRenderSprites::CFeatureRenderSprites()
 {
 }
 
+void CFeatureRenderSprites::ResolveDependency(CParticleComponent* pComponent)
+{
+	// Selected automatically, like CFeatureRenderGpuSprites, when no other feature needs the CPU update.
+	// Buffers are smaller than the GPU sprites defaults, these components were authored for the CPU.
+	if (!GetCVars()->e_ParticlesGpuAutoSelect || !pComponent->CanUseGPU() || pComponent->UsesGPU())
+		return;
+	if (!gEnv->pRenderer || !gEnv->pRenderer->GetGpuParticleManager())
+		return;
+
+	gpu_pfx2::SComponentParams params;
+	params.usesGpuImplementation = true;
+	params.maxParticles = 32 * 1024;
+	params.maxNewBorns = 4 * 1024;
+	params.sortMode = gpu_pfx2::ESortMode(int(m_sortMode));
+	params.facingMode = m_facingMode == EFacingMode::Velocity ? gpu_pfx2::EFacingMode::Velocity : gpu_pfx2::EFacingMode::Screen;
+	params.version = pComponent->GetEffect()->GetEditVersion();
+	pComponent->SetGPUComponentParams(params);
+}
+
+bool CFeatureRenderSprites::CanUseGpu(string* pReason) const
+{
+	// The GPU sprites only face the screen or the velocity and have no per sprite offsets
+	const char* reason = nullptr;
+	if (m_facingMode == EFacingMode::Camera || m_facingMode == EFacingMode::Free)
+		reason = "Facing Mode";
+	else if (m_aspectRatio != 1.0f || m_offset != Vec2(ZERO) || m_cameraOffset != 0.0f)
+		reason = "Aspect Ratio, Offset or Camera Offset";
+	else if (m_flipU || m_flipV)
+		reason = "Flip U, Flip V";
+	if (reason && pReason)
+		*pReason = reason;
+	return !reason;
+}
+
 void CFeatureRenderSprites::AddToComponent(CParticleComponent* pComponent, SComponentParams* pParams)
 {
 	BaseClass::AddToComponent(pComponent, pParams);
 	pParams->m_renderObjectFlags |= FOB_POINT_SPRITE;
+	pParams->m_renderObjectSortBias = m_sortBias;
+	if (pComponent->UsesGPU())
+	{
+		pParams->m_shaderData.m_axisScale = m_axisScale;
+		return;
+	}
 	pParams->m_particleObjFlags |= CREParticle::ePOF_USE_VERTEX_PULL_MODEL;
 	if (m_facingMode == EFacingMode::Velocity)
 		pComponent->AddParticleData(EPVF_Velocity);
@@ -127,7 +170,6 @@ void CFeatureRenderSprites::AddToComponent(CParticleComponent* pComponent, SComp
 		pParams->m_shaderData.m_sphericalApproximation = m_sphericalProjection;
 	else
 		pParams->m_shaderData.m_sphericalApproximation = 0.0f;
-	pParams->m_renderObjectSortBias = m_sortBias;
 }
 
 void CFeatureRenderSprites::Serialize(Serialization::IArchive& ar)
@@ -93,6 +93,14 @@ public:
 
 	virtual bool IsDelayed() const { return false; }
 
+	// GPU child components are spawned from the parent particles, the parent itself stays on the CPU
+	bool CanUseGpu(string* pReason) const override
+	{
+		if (pReason)
+			*pReason = "Parent particles are read on the CPU";
+		return false;
+	}
+
 protected:
 
 	void TriggerParticles(const SUpdateContext& context, const TInstanceArray& triggers)
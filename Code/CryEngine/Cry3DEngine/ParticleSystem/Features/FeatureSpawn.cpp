@@ -141,7 +141,7 @@ protected:
 		else if (m_restart.IsEnabled())
 			StartInstances(context, 0, numInstances, false);
 
-		const float countScale = runtime.GetEmitter()->GetSpawnParams().fCountScale;
+		const float countScale = pEmitter->GetSpawnParams().fCountScale * pEmitter->GetBudgetSpawnScale();
 		const float dT = context.m_deltaTime;
 		const float invDT = dT ? 1.0f / dT : 0.0f;
 		SUpdateRange range(0, numInstances);
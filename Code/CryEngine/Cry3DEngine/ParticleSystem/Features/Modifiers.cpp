@@ -43,7 +43,10 @@ public:
 	virtual void AddToParam(CParticleComponent* pComponent, IParamMod* pParam)
 	{
 		if (m_spline.HasKeys())
+		{
+			m_spline.Bake(Cry3DEngineBase::GetCVars()->e_ParticlesSplineLUTError);
 			CDomain::AddToParam(pComponent, pParam, this);
+		}
 	}
 
 	virtual void Serialize(Serialization::IArchive& ar)
@@ -59,7 +62,7 @@ public:
 	{
 		for (int i = 0; i < numSamples; ++i)
 		{
-			const float point = (float)i / numSamples;
+			const float point = Adjust((float)i / numSamples);
 			float dataIn = samples[i];
 			float spline = m_spline.Interpolate(point);
 			float dataOut = dataIn * spline;
@@ -67,6 +70,11 @@ public:
 		}
 	}
 
+	virtual bool CanSample() const
+	{
+		return IsSampledByAge();
+	}
+
 	virtual void Modify(const SUpdateContext& context, const SUpdateRange& range, IOFStream stream, EParticleDataType streamType, EModDomain domain) const
 	{
 		CRY_PFX2_PROFILE_DETAIL;
@@ -117,6 +125,7 @@ public:
 	{
 		if (m_spline.HasKeys())
 		{
+			m_spline.Bake(Cry3DEngineBase::GetCVars()->e_ParticlesSplineLUTError);
 			CDomain::AddToParam(pComponent, pParam, this);
 			pComponent->AddParticleData(EPDT_Random);
 		}
@@ -58,6 +58,8 @@ public:
 		ar(m_scale, "scale", "Scale");
 	}
 
+	virtual bool CanUseGpu() const override { return true; }
+
 	virtual void SetParameters(gpu_pfx2::IParticleFeatureGpuInterface* gpuInterface) const override
 	{
 
@@ -273,6 +275,8 @@ public:
 			ar(m_axis, "Axis", "Axis");
 	}
 
+	virtual bool CanUseGpu() const override { return true; }
+
 	virtual void SetParameters(gpu_pfx2::IParticleFeatureGpuInterface* gpuInterface) const override
 	{
 		gpu_pfx2::SFeatureParametersMotionPhysicsGravity params;
@@ -388,6 +392,8 @@ public:
 		ar(m_axis, "Axis", "Axis");
 	}
 
+	virtual bool CanUseGpu() const override { return true; }
+
 	virtual void SetParameters(gpu_pfx2::IParticleFeatureGpuInterface* gpuInterface) const override
 	{
 		gpu_pfx2::SFeatureParametersMotionPhysicsVortex params;
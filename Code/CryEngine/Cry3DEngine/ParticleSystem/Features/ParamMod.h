@@ -89,6 +89,7 @@ public:
 	virtual void       AddToParam(CParticleComponent* pComponent, IParamMod* pParam)                                                                             {}
 	virtual void       Modify(const SUpdateContext& context, const SUpdateRange& range, IOFStream stream, EParticleDataType streamType, EModDomain domain) const {}
 	virtual void       Sample(float* samples, const int numSamples) const                                                                                        {}
+	virtual bool       CanSample() const                                                                                                                         { return false; }
 	virtual void       Serialize(Serialization::IArchive& ar);
 	virtual IModifier* VersionFixReplace() const                                                                                                                 { return nullptr; }
 protected:
@@ -154,6 +155,8 @@ public:
 	TRange<TType>                  GetValueRange(const SUpdateContext& context) const;
 	TRange<TType>                  GetValueRange() const;
 	void                           Sample(TType* samples, int numSamples) const;
+	bool                           CanSample() const;
+	bool                           HasEnabledModifiers() const;
 
 	bool                           HasInitModifiers() const   { return !m_modInit.empty(); }
 	bool                           HasUpdateModifiers() const { return !m_modUpdate.empty(); }
@@ -244,4 +244,26 @@ void pfx2::CParamMod<TParamModContext, T >::Sample(TType* samples, int numSample
 	}
 }
 
+template<typename TParamModContext, typename T>
+bool pfx2::CParamMod<TParamModContext, T >::CanSample() const
+{
+	for (auto& pModifier : m_modifiers)
+	{
+		if (pModifier && pModifier->IsEnabled() && !pModifier->CanSample())
+			return false;
+	}
+	return true;
+}
+
+template<typename TParamModContext, typename T>
+bool pfx2::CParamMod<TParamModContext, T >::HasEnabledModifiers() const
+{
+	for (auto& pModifier : m_modifiers)
+	{
+		if (pModifier && pModifier->IsEnabled())
+			return true;
+	}
+	return false;
+}
+
 }
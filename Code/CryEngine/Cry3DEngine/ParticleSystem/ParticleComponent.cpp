@@ -320,7 +320,8 @@ void CParticleComponent::Render(CParticleEmitter* pEmitter, IParticleComponentRu
 		for (auto& it : GetUpdateList(EUL_Render))
 			it->Render(pEmitter, pRuntime, this, renderContext);		
 		
-		if (!GetUpdateList(EUL_RenderDeferred).empty() && !isGpuParticles)
+		const bool hasDeferred = !GetUpdateList(EUL_RenderDeferred).empty() || !GetUpdateList(EUL_RenderDeferredJob).empty();
+		if (hasDeferred && !isGpuParticles)
 		{
 			CParticleJobManager& jobManager = GetPSystem()->GetJobManager();
 			CParticleComponentRuntime* pCpuRuntime = static_cast<CParticleComponentRuntime*>(pRuntime);
@@ -329,12 +330,17 @@ void CParticleComponent::Render(CParticleEmitter* pEmitter, IParticleComponentRu
 	}
 }
 
-void CParticleComponent::RenderDeferred(CParticleEmitter* pEmitter, IParticleComponentRuntime* pRuntime, const SRenderContext& renderContext)
+void CParticleComponent::RenderDeferred(CParticleEmitter* pEmitter, IParticleComponentRuntime* pRuntime, const SRenderContext& renderContext, EUpdateList list)
 {
 	CRY_PROFILE_FUNCTION(PROFILE_PARTICLE);
 
-	for (auto& it : GetUpdateList(EUL_RenderDeferred))
+	CRY_PFX2_ASSERT(list == EUL_RenderDeferred || list == EUL_RenderDeferredJob);
+	CParticleComponentRuntime* pCpuRuntime = pRuntime->GetCpuRuntime();
+	for (auto& it : GetUpdateList(list))
+	{
+		CFeatureTimeProfiler featureProfile(GetPSystem()->GetProfiler(), pCpuRuntime, it);
 		it->Render(pEmitter, pRuntime, this, renderContext);
+	}
 }
 
 bool CParticleComponent::CanMakeRuntime(CParticleEmitter* pEmitter) const
@@ -419,6 +425,22 @@ void CParticleComponent::ResolveDependencies()
 
 	m_GPUComponentParams = gpu_pfx2::SComponentParams();
 
+	m_gpuBlockers.clear();
+	for (auto& it : m_features)
+	{
+		string reason;
+		if (it->IsEnabled() && !it->CanUseGpu(&reason))
+		{
+			const SParticleFeatureParams& featureParams = it->GetFeatureParams();
+			if (!m_gpuBlockers.empty())
+				m_gpuBlockers += ", ";
+			m_gpuBlockers += string(featureParams.m_groupName) + " " + featureParams.m_featureName;
+			if (!reason.empty())
+				m_gpuBlockers += " (" + reason + ")";
+		}
+	}
+	m_gpuBlockersLabel = m_gpuBlockers.empty() ? string() : "!CPU only: " + m_gpuBlockers;
+
 	for (auto& it : m_features)
 	{
 		if (it->IsEnabled())
@@ -478,6 +500,11 @@ void CParticleComponent::Serialize(Serialization::IArchive& ar)
 	}
 	m_componentParams.m_pComponent = this;
 	ar(m_componentParams, "Stats", "Component Statistics");
+	if (ar.isEdit() && ar.isOutput() && !m_gpuBlockersLabel.empty())
+	{
+		const string label;
+		ar(label, "", m_gpuBlockersLabel.c_str());
+	}
 	ar(m_nodePosition, "nodePos", "Node Position");
 	ar(m_features, "Features", "^");
 	if (ar.isInput())
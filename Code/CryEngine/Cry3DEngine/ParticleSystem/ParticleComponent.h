@@ -196,6 +196,9 @@ public:
 	bool                                  UsesGPU() const                                           { return m_GPUComponentParams.usesGpuImplementation; }
 	const gpu_pfx2::SComponentParams&     GetGPUComponentParams() const                             { return m_GPUComponentParams; };
 	void                                  SetGPUComponentParams(gpu_pfx2::SComponentParams& params) { m_GPUComponentParams = params; }
+	// Enabled features preventing the component from running on the GPU, valid after ResolveDependencies
+	bool                                  CanUseGPU() const                                         { return m_gpuBlockers.empty(); }
+	const string&                         GetGPUBlockers() const                                    { return m_gpuBlockers; }
 	
 	const SComponentParams& GetComponentParams() const                          { return m_componentParams; }
 	bool                    UseParticleData(EParticleDataType type) const       { return m_useParticleData[type]; }
@@ -209,7 +212,7 @@ public:
 	void                    PrepareRenderObjects(CParticleEmitter* pEmitter);
 	void                    ResetRenderObjects(CParticleEmitter* pEmitter);
 	void                    Render(CParticleEmitter* pEmitter, IParticleComponentRuntime* pRuntime, const SRenderContext& renderContext);
-	void                    RenderDeferred(CParticleEmitter* pEmitter, IParticleComponentRuntime* pRuntime, const SRenderContext& renderContext);
+	void                    RenderDeferred(CParticleEmitter* pEmitter, IParticleComponentRuntime* pRuntime, const SRenderContext& renderContext, EUpdateList list);
 	bool                    CanMakeRuntime(CParticleEmitter* pEmitter) const;
 
 private:
@@ -230,6 +233,8 @@ private:
 	bool                                                 m_dirty;
 
 	gpu_pfx2::SComponentParams                           m_GPUComponentParams;
+	string                                               m_gpuBlockers;
+	string                                               m_gpuBlockersLabel;
 };
 
 typedef _smart_ptr<CParticleComponent> TComponentPtr;
@@ -11,6 +11,7 @@
 #include "ParticleComponentRuntime.h"
 #include "ParticleEmitter.h"
 #include "ParticleFeature.h"
+#include "ParticleKernelsAVX2.h"
 
 namespace pfx2
 {
@@ -22,6 +23,8 @@ CParticleComponentRuntime::CParticleComponentRuntime(CParticleEmitter* pEmitter,
 	: m_pEmitter(pEmitter)
 	, m_pComponent(pComponent)
 	, m_bounds(AABB::RESET)
+	, m_frameCostMicroSeconds(0)
+	, m_costEstimate(0.0f)
 	, m_active(false)
 {
 }
@@ -86,24 +89,30 @@ void CParticleComponentRuntime::AddRemoveNewBornsParticles(const SUpdateContext&
 {
 	FUNCTION_PROFILER(GetISystem(), PROFILE_PARTICLE);
 	CTimeProfiler profile(GetPSystem()->GetProfiler(), this, EPS_NewBornTime);
+	const int64 startTicks = CryGetTicks();
 
 	m_container.RemoveNewBornFlags();
 	AddRemoveParticles(context);
 	UpdateNewBorns(context);
 	m_container.ResetSpawnedParticles();
 	GetEmitter()->AddUpdatedParticles(uint(m_container.GetLastParticleId()));
+
+	AddFrameCost(startTicks);
 }
 
 void CParticleComponentRuntime::UpdateParticles(const SUpdateContext& context)
 {
 	FUNCTION_PROFILER(GetISystem(), PROFILE_PARTICLE);
 	CTimeProfiler profile(GetPSystem()->GetProfiler(), this, EPS_UpdateTime);
+	const int64 startTicks = CryGetTicks();
 
 	m_container.FillData(EPVF_Acceleration, 0.0f, context.m_updateRange);
 	m_container.FillData(EPVF_VelocityField, 0.0f, context.m_updateRange);
 
 	UpdateFeatures(context);
 	AgeUpdate(context);
+
+	AddFrameCost(startTicks);
 }
 
 void CParticleComponentRuntime::ComputeVertices(const SCameraInfo& camInfo, CREParticle* pRE, uint64 uRenderFlags, float fMaxPixels)
@@ -114,7 +123,10 @@ void CParticleComponentRuntime::ComputeVertices(const SCameraInfo& camInfo, CREP
 		CTimeProfiler profile(GetPSystem()->GetProfiler(), this, EPS_ComputeVerticesTime);
 
 		for (auto& it : GetComponent()->GetUpdateList(EUL_Render))
+		{
+			CFeatureTimeProfiler featureProfile(GetPSystem()->GetProfiler(), this, it);
 			it->ComputeVertices(this, camInfo, pRE, uRenderFlags, fMaxPixels);
+		}
 	}
 }
 
@@ -190,8 +202,22 @@ void CParticleComponentRuntime::OrphanAllParticles()
 
 void CParticleComponentRuntime::MainPreUpdate()
 {
+	// fold the time measured by the jobs of the last update into the estimate used by the particle budget
+	const float frameCost = float(CryInterlockedExchange(&m_frameCostMicroSeconds, 0)) * 0.001f;
+	m_costEstimate += (frameCost - m_costEstimate) * 0.25f;
+
 	for (auto& it : GetComponent()->GetUpdateList(EUL_MainPreUpdate))
+	{
+		CFeatureTimeProfiler featureProfile(GetPSystem()->GetProfiler(), this, it);
 		it->MainPreUpdate(this);
+	}
+}
+
+void CParticleComponentRuntime::AddFrameCost(int64 startTicks)
+{
+	// UpdateParticles can run in several jobs at once
+	const LONG microSeconds = LONG(gEnv->pTimer->TicksToSeconds(CryGetTicks() - startTicks) * 1000000.0f);
+	CryInterlockedAdd(&m_frameCostMicroSeconds, microSeconds);
 }
 
 void CParticleComponentRuntime::GetSpatialExtents(const SUpdateContext& context, TConstArray<float> scales, TVarArray<float> extents)
@@ -236,7 +262,10 @@ void CParticleComponentRuntime::AddRemoveParticles(const SUpdateContext& context
 		if (!particleIds.empty())
 		{
 			for (auto& it : GetComponent()->GetUpdateList(EUL_KillUpdate))
+			{
+				CFeatureTimeProfiler featureProfile(GetPSystem()->GetProfiler(), this, it);
 				it->KillParticles(context, particleIds);
+			}
 		}
 	}
 
@@ -245,7 +274,10 @@ void CParticleComponentRuntime::AddRemoveParticles(const SUpdateContext& context
 	if (isActive)
 	{
 		for (auto& it : GetComponent()->GetUpdateList(EUL_Spawn))
+		{
+			CFeatureTimeProfiler featureProfile(GetPSystem()->GetProfiler(), this, it);
 			it->SpawnParticles(context);
+		}
 	}
 
 	TParticleIdArray particleIds(*context.m_pMemHeap);
@@ -266,6 +298,7 @@ void CParticleComponentRuntime::AddRemoveParticles(const SUpdateContext& context
 		swapIds.resize(hasSwapIds ? numParticles : 0);
 
 		m_container.AddRemoveParticles(m_spawnEntries, particleIds, swapIds);
+		m_container.Shrink();
 
 		if (hasSwapIds)
 		{
@@ -351,7 +384,10 @@ void CParticleComponentRuntime::UpdateNewBorns(const SUpdateContext& context)
 	// feature init particles
 	m_container.FillData(EPDT_State, uint8(ES_NewBorn), m_container.GetSpawnedRange());
 	for (auto& it : GetComponent()->GetUpdateList(EUL_InitUpdate))
+	{
+		CFeatureTimeProfiler featureProfile(GetPSystem()->GetProfiler(), this, it);
 		it->InitParticles(context);
+	}
 
 	// modify with spawn params
 	const SpawnParams& spawnParams = GetEmitter()->GetSpawnParams();
@@ -383,7 +419,10 @@ void CParticleComponentRuntime::UpdateNewBorns(const SUpdateContext& context)
 
 	// feature post init particles
 	for (auto& it : GetComponent()->GetUpdateList(EUL_PostInitUpdate))
+	{
+		CFeatureTimeProfiler featureProfile(GetPSystem()->GetProfiler(), this, it);
 		it->PostInitParticles(context);
+	}
 }
 
 void CParticleComponentRuntime::UpdateFeatures(const SUpdateContext& context)
@@ -397,13 +436,22 @@ void CParticleComponentRuntime::UpdateFeatures(const SUpdateContext& context)
 	}
 
 	for (auto& it : GetComponent()->GetUpdateList(EUL_PreUpdate))
+	{
+		CFeatureTimeProfiler featureProfile(GetPSystem()->GetProfiler(), this, it);
 		it->PreUpdate(context);
+	}
 	
 	for (auto& it : GetComponent()->GetUpdateList(EUL_Update))
+	{
+		CFeatureTimeProfiler featureProfile(GetPSystem()->GetProfiler(), this, it);
 		it->Update(context);
+	}
 
 	for (auto& it : GetComponent()->GetUpdateList(EUL_PostUpdate))
+	{
+		CFeatureTimeProfiler featureProfile(GetPSystem()->GetProfiler(), this, it);
 		it->PostUpdate(context);
+	}
 	
 	UpdateLocalSpace(context.m_updateRange);
 }
@@ -458,7 +506,10 @@ void CParticleComponentRuntime::CalculateBounds()
 
 	// augment bounds from features
 	for (auto& it : GetComponent()->GetUpdateList(EUL_ComputeBounds))
+	{
+		CFeatureTimeProfiler featureProfile(GetPSystem()->GetProfiler(), this, it);
 		it->ComputeBounds(this, m_bounds);
+	}
 }
 
 void CParticleComponentRuntime::AgeUpdate(const SUpdateContext& context)
@@ -469,15 +520,25 @@ void CParticleComponentRuntime::AgeUpdate(const SUpdateContext& context)
 	IOFStream normAges = m_container.GetIOFStream(EPDT_NormalAge);
 	const floatv frameTime = ToFloatv(context.m_deltaTime);
 
-	for (auto particleGroupId : context.GetUpdateGroupRange())
+	if (ParticleKernelsAVX2::IsEnabled() && m_container.HasData(EPDT_InvLifeTime))
 	{
-		const floatv invLifeTime = invLifeTimes.Load(particleGroupId);
-		const floatv normAge0 = normAges.Load(particleGroupId);
-		const floatv normalAge1 = __fsel(normAge0,
-			normAge0 + frameTime * invLifeTime,
-			-normAge0 * frameTime * invLifeTime
-		);
-		normAges.Store(particleGroupId, normalAge1);
+		const SGroupRange range = context.GetUpdateGroupRange();
+		ParticleKernelsAVX2::AgeUpdate(
+		  m_container.GetData<float>(EPDT_NormalAge), m_container.GetData<float>(EPDT_InvLifeTime),
+		  context.m_deltaTime, +range.m_begin, +range.m_end);
+	}
+	else
+	{
+		for (auto particleGroupId : context.GetUpdateGroupRange())
+		{
+			const floatv invLifeTime = invLifeTimes.Load(particleGroupId);
+			const floatv normAge0 = normAges.Load(particleGroupId);
+			const floatv normalAge1 = __fsel(normAge0,
+				normAge0 + frameTime * invLifeTime,
+				-normAge0 * frameTime * invLifeTime
+			);
+			normAges.Store(particleGroupId, normalAge1);
+		}
 	}
 
 	TIOStream<uint8> states = m_container.GetTIOStream<uint8>(EPDT_State);
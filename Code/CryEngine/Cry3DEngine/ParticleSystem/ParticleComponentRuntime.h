@@ -68,6 +68,7 @@ public:
 	void                      GetSpatialExtents(const SUpdateContext& context, TConstArray<float> scales, TVarArray<float> extents);
 	void                      AccumStatsNonVirtual(SParticleStats& counts);
 	const AABB&               GetBoundsNonVirtual() const { return m_bounds; }
+	float                     GetCostEstimate() const     { return m_costEstimate; }
 
 private:
 	void AddRemoveParticles(const SUpdateContext& context);
@@ -81,6 +82,8 @@ private:
 
 	void DebugStabilityCheck();
 
+	void AddFrameCost(int64 startTicks);
+
 	CParticleComponent*                          m_pComponent;
 	CParticleEmitter*                            m_pEmitter;
 	CParticleContainer                           m_container;
@@ -88,6 +91,8 @@ private:
 	TDynArray<byte>                              m_subInstanceData;
 	TDynArray<CParticleContainer::SSpawnEntry>   m_spawnEntries;
 	AABB                                         m_bounds;
+	volatile LONG                                m_frameCostMicroSeconds;
+	float                                        m_costEstimate; // smoothed update time in ms, used by the particle budget
 	bool                                         m_active;
 };
 
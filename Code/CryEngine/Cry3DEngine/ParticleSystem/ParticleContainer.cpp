@@ -15,18 +15,14 @@ CRY_PFX2_DBG
 namespace
 {
 
-static std::set<void*> g_allocMems;
-
 void* ParticleAlloc(size_t sz)
 {
-	void* ptr = CryModuleMemalign(sz, CRY_PFX2_PARTICLES_ALIGNMENT);
-	memset(ptr, 0, sz);
-	return ptr;
+	return pfx2::CParticleStreamPool::Get().Allocate(sz);
 }
 
-void ParticleFree(void* ptr)
+void ParticleFree(void* ptr, size_t sz)
 {
-	CryModuleMemalignFree(ptr);
+	pfx2::CParticleStreamPool::Get().Free(ptr, sz);
 }
 
 }
@@ -34,6 +30,103 @@ void ParticleFree(void* ptr)
 namespace pfx2
 {
 
+CParticleStreamPool& CParticleStreamPool::Get()
+{
+	static CParticleStreamPool pool;
+	return pool;
+}
+
+CParticleStreamPool::CParticleStreamPool()
+{
+	memset(&m_stats, 0, sizeof(m_stats));
+}
+
+CParticleStreamPool::~CParticleStreamPool()
+{
+	ReleaseCache();
+}
+
+uint CParticleStreamPool::GetSizeClass(size_t size)
+{
+	uint sizeClass = 0;
+	while (sizeClass < kNumClasses && GetClassSize(sizeClass) < size)
+		++sizeClass;
+	return sizeClass;
+}
+
+void* CParticleStreamPool::Allocate(size_t size)
+{
+	const uint sizeClass = GetSizeClass(size);
+	const size_t blockSize = sizeClass < kNumClasses ? GetClassSize(sizeClass) : size;
+	void* ptr = nullptr;
+
+	m_lock.Lock();
+	if (sizeClass < kNumClasses && !m_freeBlocks[sizeClass].empty())
+	{
+		ptr = m_freeBlocks[sizeClass].back();
+		m_freeBlocks[sizeClass].pop_back();
+		m_stats.m_cached -= blockSize;
+	}
+	m_stats.m_requested += size;
+	m_stats.m_used += blockSize;
+	m_stats.m_peak = max(m_stats.m_peak, m_stats.m_used + m_stats.m_cached);
+	m_lock.Unlock();
+
+	if (!ptr)
+		ptr = CryModuleMemalign(blockSize, CRY_PFX2_PARTICLES_ALIGNMENT);
+	memset(ptr, 0, size);
+	return ptr;
+}
+
+void CParticleStreamPool::Free(void* ptr, size_t size)
+{
+	const uint sizeClass = GetSizeClass(size);
+	const size_t blockSize = sizeClass < kNumClasses ? GetClassSize(sizeClass) : size;
+	const size_t maxCached = size_t(max(Cry3DEngineBase::GetCVars()->e_ParticlesStreamPoolCacheKB, 0)) << 10;
+
+	m_lock.Lock();
+	m_stats.m_requested -= size;
+	m_stats.m_used -= blockSize;
+	const bool cache = sizeClass < kNumClasses && m_stats.m_cached + blockSize <= maxCached;
+	if (cache)
+	{
+		m_freeBlocks[sizeClass].push_back(ptr);
+		m_stats.m_cached += blockSize;
+	}
+	m_lock.Unlock();
+
+	if (!cache)
+		CryModuleMemalignFree(ptr);
+}
+
+void CParticleStreamPool::ReleaseCache()
+{
+	m_lock.Lock();
+	for (auto& freeBlocks : m_freeBlocks)
+	{
+		for (void* ptr : freeBlocks)
+			CryModuleMemalignFree(ptr);
+		stl::free_container(freeBlocks);
+	}
+	m_stats.m_cached = 0;
+	m_lock.Unlock();
+}
+
+CParticleStreamPool::SStats CParticleStreamPool::GetStats() const
+{
+	m_lock.Lock();
+	const SStats stats = m_stats;
+	m_lock.Unlock();
+	return stats;
+}
+
+void CParticleStreamPool::GetMemoryUsage(ICrySizer* pSizer) const
+{
+	// the requested bytes are reported by the containers
+	const SStats stats = GetStats();
+	pSizer->AddObject(this, sizeof(*this) + stats.m_used - stats.m_requested + stats.m_cached);
+}
+
 CParticleContainer::CParticleContainer()
 {
 	Clear();
@@ -57,8 +150,35 @@ void CParticleContainer::Resize(size_t newSize)
 		return;
 
 	const size_t newMaxParticles = CRY_PFX2_PARTICLESGROUP_UPPER(newSize + (newSize >> 1)) + 1;
+	Reallocate(newMaxParticles, m_lastId);
+	m_lowUsageFrames = 0;
+}
+
+void CParticleContainer::Shrink()
+{
+	// Only shrink after the container used less than a quarter of its capacity for e_ParticlesContainerShrinkFrames
+	// updates in a row, so short bursts keep their memory. The new capacity leaves the same headroom as Resize.
+	const uint shrinkFrames = uint(max(Cry3DEngineBase::GetCVars()->e_ParticlesContainerShrinkFrames, 0));
+	const uint32 minShrinkParticles = 64;
+	if (!shrinkFrames || m_maxParticles <= minShrinkParticles || m_lastSpawnId * 4 >= m_maxParticles)
+	{
+		m_lowUsageFrames = 0;
+		return;
+	}
+	if (++m_lowUsageFrames < shrinkFrames)
+		return;
+
+	const size_t newSize = CRY_PFX2_PARTICLESGROUP_UPPER(m_lastSpawnId) + CRY_PFX2_PARTICLESGROUP_STRIDE + 1;
+	const size_t newMaxParticles = CRY_PFX2_PARTICLESGROUP_UPPER(newSize + (newSize >> 1)) + 1;
+	if (newMaxParticles < m_maxParticles)
+		Reallocate(newMaxParticles, m_lastSpawnId);
+	m_lowUsageFrames = 0;
+}
+
+void CParticleContainer::Reallocate(size_t newMaxParticles, size_t numParticlesToCopy)
+{
+	CRY_PFX2_PROFILE_DETAIL;
 
-	auto prevBuffers = m_pData;
 	for (auto type : EParticleDataType::indices())
 	{
 		const size_t stride = type.info().typeSize();
@@ -67,15 +187,15 @@ void CParticleContainer::Resize(size_t newSize)
 			void* pNew = ParticleAlloc(newMaxParticles * stride);
 			if (m_pData[type])
 			{
-				memcpy(pNew, m_pData[type], m_lastId * stride);
-				ParticleFree(m_pData[type]);
+				memcpy(pNew, m_pData[type], numParticlesToCopy * stride);
+				ParticleFree(m_pData[type], m_maxParticles * stride);
 			}
 			m_pData[type] = pNew;
 		}
 		else
 		{
 			if (m_pData[type])
-				ParticleFree(m_pData[type]);
+				ParticleFree(m_pData[type], m_maxParticles * stride);
 			m_pData[type] = 0;
 		}
 	}
@@ -108,12 +228,21 @@ void CParticleContainer::Trim()
 	{
 		if (!m_useData[type] && m_pData[type] != 0)
 		{
-			ParticleFree(m_pData[type]);
+			ParticleFree(m_pData[type], m_maxParticles * type.info().typeSize());
 			m_pData[type] = 0;
 		}
 	}
 }
 
+void CParticleContainer::GetMemoryUsage(ICrySizer* pSizer) const
+{
+	for (auto type : EParticleDataType::indices())
+	{
+		if (m_pData[type])
+			pSizer->AddObject(m_pData[type], m_maxParticles * type.info().typeSize());
+	}
+}
+
 void CParticleContainer::Clear()
 {
 	CRY_PFX2_PROFILE_DETAIL;
@@ -121,11 +250,12 @@ void CParticleContainer::Clear()
 	for (auto i : EParticleDataType::indices())
 	{
 		if (m_pData[i] != 0)
-			ParticleFree(m_pData[i]);
+			ParticleFree(m_pData[i], m_maxParticles * i.info().typeSize());
 		m_pData[i] = 0;
 		m_useData[i] = false;
 	}
 	m_maxParticles = CRY_PFX2_PARTICLESGROUP_STRIDE;
+	m_lowUsageFrames = 0;
 	m_lastId = 0;
 	m_firstSpawnId = 0;
 	m_lastSpawnId = 0;
@@ -23,6 +23,44 @@ namespace pfx2
 
 class CParticleContainer;
 
+// Allocator of the particle data streams of all containers. Blocks are rounded up to power of 2 size classes
+// and freed blocks are cached for reuse, up to e_ParticlesStreamPoolCacheKB, so growing and shrinking containers
+// don't go through the general heap every time.
+class CParticleStreamPool
+{
+public:
+	struct SStats
+	{
+		size_t m_requested; // bytes requested by the containers
+		size_t m_used;      // bytes of the blocks in use
+		size_t m_cached;    // bytes of the free blocks kept for reuse
+		size_t m_peak;      // maximum of used + cached
+	};
+
+public:
+	static CParticleStreamPool& Get();
+
+	CParticleStreamPool();
+	~CParticleStreamPool();
+
+	void*  Allocate(size_t size);
+	void   Free(void* ptr, size_t size);
+	void   ReleaseCache();
+
+	SStats GetStats() const;
+	void   GetMemoryUsage(ICrySizer* pSizer) const;
+
+private:
+	enum { kMinClassShift = 6, kNumClasses = 15 }; // 64 bytes to 1 MB, larger blocks are not cached
+
+	static uint   GetSizeClass(size_t size);
+	static size_t GetClassSize(uint sizeClass) { return size_t(1) << (sizeClass + kMinClassShift); }
+
+	mutable CryMutex   m_lock;
+	std::vector<void*> m_freeBlocks[kNumClasses];
+	SStats             m_stats;
+};
+
 typedef TIStream<UCol>         IColorStream;
 typedef TIStream<uint32>       IUintStream;
 typedef TIOStream<uint32>      IOUintStream;
@@ -56,7 +94,9 @@ public:
 	void                              AddParticle();
 	void                              AddRemoveParticles(TConstArray<SSpawnEntry> spawnEntries, TVarArray<TParticleId> toRemove, TVarArray<TParticleId> swapIds);
 	void                              Trim();
+	void                              Shrink();
 	void                              Clear();
+	void                              GetMemoryUsage(ICrySizer* pSizer) const;
 
 	template<typename T> T*           GetData(EParticleDataType type);
 	template<typename T> const T*     GetData(EParticleDataType type) const;
@@ -96,11 +136,13 @@ private:
 	void AddParticles(TConstArray<SSpawnEntry> spawnEntries);
 	void RemoveParticles(TConstArray<TParticleId> toRemove);
 	void MakeSwapIds(TVarArray<TParticleId> toRemove, TVarArray<TParticleId> swapIds);
+	void Reallocate(size_t newMaxParticles, size_t numParticlesToCopy);
 
 	StaticEnumArray<void*, EParticleDataType> m_pData;
 	StaticEnumArray<bool, EParticleDataType>  m_useData;
 	uint32 m_nextSpawnId;
 	uint32 m_maxParticles;
+	uint32 m_lowUsageFrames;
 
 	uint32 m_lastId;
 	uint32 m_firstSpawnId;
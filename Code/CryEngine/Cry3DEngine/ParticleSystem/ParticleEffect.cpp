@@ -28,6 +28,7 @@ CParticleEffect::CParticleEffect()
 	: m_editVersion(0)
 	, m_dirty(true)
 	, m_substitutedPfx1(false)
+	, m_loading(false)
 	, m_numRenderObjects(0)
 {
 	m_pAttributes = TAttributeTablePtr(new CAttributeTable);
@@ -210,7 +211,9 @@ void CParticleEffect::Serialize(Serialization::IArchive& ar)
 		SetChanged();
 		for (auto& component : m_components)
 			component->SetChanged();
-		Compile();
+		// Effects loaded in a job are compiled on the main thread, compiling loads materials and meshes
+		if (!m_loading)
+			Compile();
 	}
 }
 
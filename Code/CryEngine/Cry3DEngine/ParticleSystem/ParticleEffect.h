@@ -80,6 +80,8 @@ public:
 	uint                      GetNumRenderObjectIds() const;
 	float                     GetEquilibriumTime() const;
 	int                       GetEditVersion() const;
+	bool                      IsLoading() const                                             { return m_loading; }
+	void                      SetLoading(bool loading)                                      { m_loading = loading; }
 
 private:
 	string             m_name;
@@ -90,6 +92,7 @@ private:
 	int                m_editVersion;
 	bool               m_dirty;
 	bool               m_substitutedPfx1;
+	bool               m_loading;
 
 	void               Sort();
 };
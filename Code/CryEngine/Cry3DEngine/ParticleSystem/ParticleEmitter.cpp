@@ -38,10 +38,13 @@ CParticleEmitter::CParticleEmitter(uint emitterId)
 	, m_emitterGeometrySlot(-1)
 	, m_time(0.0f)
 	, m_deltaTime(0.0f)
+	, m_skippedTime(0.0f)
+	, m_budgetLod(EBL_Full)
 	, m_primeTime(0.0f)
 	, m_lastTimeRendered(0.0f)
 	, m_initialSeed(0)
 	, m_emitterId(emitterId)
+	, m_culled(false)
 {
 	m_currentSeed = m_initialSeed;
 	m_nInternalFlags |= IRenderNode::REQUIRES_FORWARD_RENDERING;
@@ -124,7 +127,8 @@ void CParticleEmitter::Update()
 {
 	FUNCTION_PROFILER(GetISystem(), PROFILE_PARTICLE);
 
-	m_deltaTime = gEnv->pTimer->GetFrameTime() * GetTimeScale();
+	m_deltaTime = (gEnv->pTimer->GetFrameTime() + m_skippedTime) * GetTimeScale();
+	m_skippedTime = 0.0f;
 	m_deltaTime = max(m_deltaTime, m_primeTime);
 	m_primeTime = 0.0f;
 	m_time += m_deltaTime;
@@ -215,6 +219,29 @@ void CParticleEmitter::DebugRender() const
 	IRenderAuxText::DrawLabelEx(m_bounds.GetCenter(), 1.5f, (float*)&labelColor, true, true, label);
 }
 
+bool CParticleEmitter::SkipBudgetUpdate()
+{
+	// the skipped frame time is caught up by the next update
+	if (m_budgetLod >= EBL_HalfUpdateRate && m_skippedTime == 0.0f)
+	{
+		m_skippedTime = gEnv->pTimer->GetFrameTime();
+		return true;
+	}
+	return false;
+}
+
+bool CParticleEmitter::SkipCulledUpdate(float maxSkipTime)
+{
+	// off-screen emitters only advance their time, the next update fast-forwards by all of it in one step
+	const float frameTime = gEnv->pTimer->GetFrameTime();
+	if (m_culled && m_skippedTime + frameTime < maxSkipTime)
+	{
+		m_skippedTime += frameTime;
+		return true;
+	}
+	return false;
+}
+
 void CParticleEmitter::PostUpdate()
 {
 	m_parentContainer.GetIOVec3Stream(EPVF_Velocity).Store(0, Vec3(ZERO));
@@ -271,6 +298,11 @@ void CParticleEmitter::Precache()
 
 void CParticleEmitter::GetMemoryUsage(ICrySizer* pSizer) const
 {
+	for (auto& ref : m_componentRuntimes)
+	{
+		if (const CParticleComponentRuntime* pCpuRuntime = ref.pRuntime->GetCpuRuntime())
+			pCpuRuntime->GetContainer().GetMemoryUsage(pSizer);
+	}
 }
 
 const AABB CParticleEmitter::GetBBox() const
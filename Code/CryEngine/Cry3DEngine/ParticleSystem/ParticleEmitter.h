@@ -19,6 +19,15 @@
 namespace pfx2
 {
 
+// Degradation applied to an emitter by CParticleJobManager::ApplyBudget, each level includes the previous ones
+enum EBudgetLod
+{
+	EBL_Full,
+	EBL_NoCollisions,
+	EBL_HalfSpawnRate,
+	EBL_HalfUpdateRate,
+};
+
 class CParticleEmitter : public IParticleEmitter, public Cry3DEngineBase
 {
 private:
@@ -135,6 +144,13 @@ public:
 	void                      AddUpdatedParticles(uint updatedParticles);
 	void                      AddDrawCallCounts(uint numRendererdParticles, uint numClippedParticles);
 
+	EBudgetLod                GetBudgetLod() const         { return m_budgetLod; }
+	void                      SetBudgetLod(EBudgetLod lod) { m_budgetLod = lod; }
+	float                     GetBudgetSpawnScale() const  { return m_budgetLod >= EBL_HalfSpawnRate ? 0.5f : 1.0f; }
+	bool                      SkipBudgetUpdate();
+	void                      SetCulled(bool culled)       { m_culled = culled; }
+	bool                      SkipCulledUpdate(float maxSkipTime);
+
 private:
 	void     UpdateBoundingBox(const float frameTime);
 	void     UpdateRuntimeRefs();
@@ -171,12 +187,15 @@ private:
 	float                       m_deltaTime;
 	float                       m_primeTime;
 	float                       m_lastTimeRendered;
+	float                       m_skippedTime;
+	EBudgetLod                  m_budgetLod;
 	int                         m_editVersion;
 	uint                        m_initialSeed;
 	uint                        m_currentSeed;
 	uint                        m_emitterId;
 	bool                        m_registered;
 	bool                        m_active;
+	bool                        m_culled;
 };
 
 }
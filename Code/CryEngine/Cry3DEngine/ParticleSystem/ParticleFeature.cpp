@@ -52,6 +52,8 @@ public:
 		ar(m_text, "Text", "Text");
 	}
 
+	virtual bool CanUseGpu(string* pReason) const override { return true; }
+
 private:
 	string m_text;
 };
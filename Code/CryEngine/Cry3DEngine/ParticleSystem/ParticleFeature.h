@@ -36,8 +36,8 @@ struct SGpuInterfaceRef
 class CParticleFeature : public IParticleFeature, public _i_reference_target_t
 {
 public:
-	CParticleFeature() : m_gpuInterfaceRef(gpu_pfx2::eGpuFeatureType_None) {}
-	CParticleFeature(gpu_pfx2::EGpuFeatureType feature) : m_gpuInterfaceRef(feature) {}
+	CParticleFeature() : m_gpuInterfaceRef(gpu_pfx2::eGpuFeatureType_None), m_gpuInterfaceNeeded(false) {}
+	CParticleFeature(gpu_pfx2::EGpuFeatureType feature) : m_gpuInterfaceRef(feature), m_gpuInterfaceNeeded(false) {}
 
 	// IParticleFeature
 	void                                    SetEnabled(bool enabled) override                 { m_enabled.Set(enabled); }
@@ -60,6 +60,9 @@ public:
 	virtual EFeatureType      GetFeatureType()                                                          { return EFT_Generic; }
 	virtual bool              CanMakeRuntime(CParticleEmitter* pEmitter) const                          { return true; }
 
+	// GPU implementation, pReason optionally receives why a feature with a GPU version can't run on the GPU
+	virtual bool              CanUseGpu(string* pReason) const { return m_gpuInterfaceRef.feature != gpu_pfx2::eGpuFeatureType_None; }
+
 	// EUL_MainPreUpdate
 	virtual void MainPreUpdate(CParticleComponentRuntime* pComponentRuntime) {}
 
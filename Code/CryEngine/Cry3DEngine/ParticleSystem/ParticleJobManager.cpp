@@ -22,6 +22,7 @@ DECLARE_JOB("Particles : AddRemoveParticles", TAddRemoveJob, pfx2::CParticleJobM
 DECLARE_JOB("Particles : UpdateParticles", TUpdateParticlesJob_, pfx2::CParticleJobManager::Job_UpdateParticles);
 DECLARE_JOB("Particles : PostUpdateParticles", TPostUpdateParticlesJob, pfx2::CParticleJobManager::Job_PostUpdateParticles);
 DECLARE_JOB("Particles : CalculateBounds", TCalculateBoundsJob, pfx2::CParticleJobManager::Job_CalculateBounds);
+DECLARE_JOB("Particles : DeferredRender", TDeferredRenderJob, pfx2::CParticleJobManager::Job_DeferredRender);
 
 namespace pfx2
 {
@@ -32,6 +33,74 @@ stl::TPoolAllocator<TPostUpdateParticlesJob>& GetPostJobPool()
 	return pool;
 }
 
+void CParticleJobManager::ApplyBudget(const std::vector<_smart_ptr<CParticleEmitter>>& emitters)
+{
+	CRY_PROFILE_FUNCTION(PROFILE_PARTICLE);
+
+	CVars* pCVars = static_cast<C3DEngine*>(gEnv->p3DEngine)->GetCVars();
+	const float budgetTime = pCVars->e_ParticlesBudgetMs;
+	const uint budgetCount = uint(max(pCVars->e_ParticlesBudgetCount, 0));
+
+	if (budgetTime <= 0.0f && budgetCount == 0)
+	{
+		for (auto& pEmitter : emitters)
+			pEmitter->SetBudgetLod(EBL_Full);
+		return;
+	}
+
+	// estimate the cost of each emitter from the update times of its runtimes in the last frames
+	const CCamera& camera = gEnv->p3DEngine->GetRenderingCamera();
+	const float invTanHalfFovSq = sqr(1.0f / tan(camera.GetFov() * 0.5f));
+
+	m_budgetEntries.clear();
+	for (auto& pEmitter : emitters)
+	{
+		SBudgetEntry entry;
+		entry.m_pEmitter = pEmitter;
+		entry.m_cost = 0.0f;
+		entry.m_count = 0;
+		entry.m_coverage = 0.0f;
+		for (auto& ref : pEmitter->GetRuntimes())
+		{
+			if (auto pCpuRuntime = ref.pRuntime->GetCpuRuntime())
+			{
+				entry.m_cost += pCpuRuntime->GetCostEstimate();
+				entry.m_count += uint(pCpuRuntime->GetContainer().GetLastParticleId());
+			}
+		}
+		if (pEmitter->WasRenderedLastFrame())
+		{
+			const AABB bounds = pEmitter->GetBBox();
+			const float distanceSq = max(camera.GetPosition().GetSquaredDistance(bounds.GetCenter()), 1.0f / 1024.0f);
+			entry.m_coverage = min(bounds.GetRadiusSqr() * invTanHalfFovSq / distanceSq, 1.0f);
+		}
+		m_budgetEntries.push_back(entry);
+	}
+
+	// emitters covering the most of the screen keep full quality, the rest degrade the further they are over budget
+	std::sort(m_budgetEntries.begin(), m_budgetEntries.end(), [](const SBudgetEntry& a, const SBudgetEntry& b)
+	{
+		return a.m_coverage > b.m_coverage;
+	});
+
+	float totalCost = 0.0f;
+	uint totalCount = 0;
+	for (const SBudgetEntry& entry : m_budgetEntries)
+	{
+		totalCost += entry.m_cost;
+		totalCount += entry.m_count;
+		const float timeRatio = budgetTime > 0.0f ? totalCost / budgetTime : 0.0f;
+		const float countRatio = budgetCount ? float(totalCount) / float(budgetCount) : 0.0f;
+		const float ratio = max(timeRatio, countRatio);
+		const EBudgetLod lod =
+		  ratio <= 1.0f ? EBL_Full :
+		  ratio <= 1.25f ? EBL_NoCollisions :
+		  ratio <= 1.5f ? EBL_HalfSpawnRate :
+		  EBL_HalfUpdateRate;
+		entry.m_pEmitter->SetBudgetLod(lod);
+	}
+}
+
 void CParticleJobManager::AddEmitter(CParticleEmitter* pEmitter)
 {
 	CRY_PFX2_ASSERT(!m_updateState.IsRunning());
@@ -183,21 +252,55 @@ void CParticleJobManager::DeferredRender()
 {
 	CRY_PROFILE_FUNCTION(PROFILE_PARTICLE);
 
-	for (const SDeferredRender& render : m_deferredRenders)
+	CVars* pCVars = static_cast<C3DEngine*>(gEnv->p3DEngine)->GetCVars();
+	const bool renderJobs = pCVars->e_ParticlesDeferredRenderJobs && pCVars->e_ParticlesThread;
+
+	// thread safe features render in one job per component while the others render here
+	if (renderJobs)
 	{
-		CParticleComponentRuntime* pRuntime = render.m_pRuntime;
-		CParticleComponent* pComponent = pRuntime->GetComponent();
-		CParticleEmitter* pEmitter = pRuntime->GetEmitter();
-		SRenderContext renderContext(render.m_rParam, render.m_passInfo);
-		renderContext.m_distance = render.m_distance;
-		renderContext.m_lightVolumeId = render.m_lightVolumeId;
-		renderContext.m_fogVolumeId = render.m_fogVolumeId;
-		pComponent->RenderDeferred(pEmitter, pRuntime, renderContext);
+		for (uint deferredRenderIdx = 0; deferredRenderIdx < m_deferredRenders.size(); ++deferredRenderIdx)
+		{
+			const CParticleComponent* pComponent = m_deferredRenders[deferredRenderIdx].m_pRuntime->GetComponent();
+			if (pComponent->GetUpdateList(EUL_RenderDeferredJob).empty())
+				continue;
+			TDeferredRenderJob job(deferredRenderIdx);
+			job.SetClassInstance(this);
+			job.RegisterJobState(&m_deferredRenderState);
+			job.Run();
+		}
 	}
 
+	for (uint deferredRenderIdx = 0; deferredRenderIdx < m_deferredRenders.size(); ++deferredRenderIdx)
+	{
+		RenderDeferred(m_deferredRenders[deferredRenderIdx], EUL_RenderDeferred);
+		if (!renderJobs)
+			RenderDeferred(m_deferredRenders[deferredRenderIdx], EUL_RenderDeferredJob);
+	}
+
+	gEnv->pJobManager->WaitForJob(m_deferredRenderState);
+
 	ClearAll();
 }
 
+void CParticleJobManager::RenderDeferred(const SDeferredRender& render, EUpdateList list)
+{
+	CParticleComponentRuntime* pRuntime = render.m_pRuntime;
+	CParticleComponent* pComponent = pRuntime->GetComponent();
+	if (pComponent->GetUpdateList(list).empty())
+		return;
+	CParticleEmitter* pEmitter = pRuntime->GetEmitter();
+	SRenderContext renderContext(render.m_rParam, render.m_passInfo);
+	renderContext.m_distance = render.m_distance;
+	renderContext.m_lightVolumeId = render.m_lightVolumeId;
+	renderContext.m_fogVolumeId = render.m_fogVolumeId;
+	pComponent->RenderDeferred(pEmitter, pRuntime, renderContext, list);
+}
+
+void CParticleJobManager::Job_DeferredRender(uint deferredRenderIdx)
+{
+	RenderDeferred(m_deferredRenders[deferredRenderIdx], EUL_RenderDeferredJob);
+}
+
 void CParticleJobManager::Job_UpdateEmitter(uint emitterRefIdx)
 {
 	auto& profiler = GetPSystem()->GetProfiler();
@@ -314,6 +417,7 @@ void CParticleJobManager::ClearAll()
 	CRY_PROFILE_FUNCTION(PROFILE_PARTICLE);
 
 	CRY_PFX2_ASSERT(!m_updateState.IsRunning());
+	CRY_PFX2_ASSERT(!m_deferredRenderState.IsRunning());
 	for (auto& componentRef : m_componentRefs)
 		GetPostJobPool().Delete(componentRef.m_pPostSubUpdates);
 	m_deferredRenders.clear();
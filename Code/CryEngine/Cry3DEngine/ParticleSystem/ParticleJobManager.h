@@ -71,6 +71,7 @@ public:
 	};
 
 public:
+	void ApplyBudget(const std::vector<_smart_ptr<CParticleEmitter>>& emitters);
 	void AddEmitter(CParticleEmitter* pEmitter);
 	void AddDeferredRender(CParticleComponentRuntime* pRuntime, const SRenderContext& renderContext);
 	void ScheduleComputeVertices(IParticleComponentRuntime* pComponentRuntime, CRenderObject* pRenderObject, const SRenderContext& renderContext);
@@ -85,12 +86,22 @@ public:
 	void Job_UpdateParticles(uint componentRefIdx, SUpdateRange updateRange);
 	void Job_PostUpdateParticles(uint componentRefIdx);
 	void Job_CalculateBounds(uint componentRefIdx);
+	void Job_DeferredRender(uint deferredRenderIdx);
 	// ~job entry points
 
 private:
+	struct SBudgetEntry
+	{
+		CParticleEmitter* m_pEmitter;
+		float             m_coverage;
+		float             m_cost;
+		uint              m_count;
+	};
+
 	void AddComponentRecursive(CParticleEmitter* pEmitter, size_t parentRefIdx);
 
 	void ScheduleUpdateParticles(uint componentRefIdx);
+	void RenderDeferred(const SDeferredRender& render, EUpdateList list);
 
 	void ClearAll();
 
@@ -98,7 +109,9 @@ private:
 	std::vector<size_t>            m_firstGenComponentsRef;
 	std::vector<CParticleEmitter*> m_emitterRefs;
 	std::vector<SDeferredRender>   m_deferredRenders;
+	std::vector<SBudgetEntry>      m_budgetEntries;
 	JobManager::SJobState          m_updateState;
+	JobManager::SJobState          m_deferredRenderState;
 };
 
 }
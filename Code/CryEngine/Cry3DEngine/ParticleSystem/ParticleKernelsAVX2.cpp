@@ -0,0 +1,142 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+// -------------------------------------------------------------------------
+//  Description: 8 wide versions of the hottest per particle update loops,
+//               selected at runtime on CPUs supporting AVX2
+// -------------------------------------------------------------------------
+//
+////////////////////////////////////////////////////////////////////////////
+
+#include "StdAfx.h"
+#include "ParticleKernelsAVX2.h"
+#include "ParticleMath.h"
+
+#ifdef CRY_PFX2_USE_AVX2
+	#include <immintrin.h>
+	#if defined(__GNUC__) || defined(__clang__)
+		#define CRY_PFX2_AVX2_TARGET __attribute__((target("avx2")))
+	#else
+		#define CRY_PFX2_AVX2_TARGET
+	#endif
+#endif
+
+CRY_PFX2_DBG
+
+namespace pfx2
+{
+
+namespace ParticleKernelsAVX2
+{
+
+bool IsSupported()
+{
+#ifdef CRY_PFX2_USE_AVX2
+	static const bool bSupported = (gEnv->pSystem->GetCPUFlags() & CPUF_AVX2) != 0;
+	return bSupported;
+#else
+	return false;
+#endif
+}
+
+bool IsEnabled()
+{
+	return Cry3DEngineBase::GetCVars()->e_ParticlesAVX2 != 0 && IsSupported();
+}
+
+#ifdef CRY_PFX2_USE_AVX2
+
+namespace
+{
+
+// __fsel(a, b, c) == a >= 0 ? b : c, same ordered compare as the f32v4 version
+CRY_PFX2_AVX2_TARGET ILINE __m256 Select(__m256 a, __m256 b, __m256 c)
+{
+	return _mm256_blendv_ps(c, b, _mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_GE_OS));
+}
+
+// DeltaTime() in ParticleMathImpl.h
+CRY_PFX2_AVX2_TARGET ILINE __m256 DeltaTime8(__m256 frameTime, __m256 normAge, __m256 lifeTime)
+{
+	const __m256 zero = _mm256_setzero_ps();
+	const __m256 negNormAge = _mm256_sub_ps(zero, normAge);
+	const __m256 timeAlive = _mm256_min_ps(frameTime, _mm256_max_ps(_mm256_sub_ps(lifeTime, _mm256_mul_ps(normAge, lifeTime)), zero));
+	const __m256 timeSpawning = _mm256_min_ps(_mm256_mul_ps(negNormAge, frameTime), lifeTime);
+	return Select(normAge, timeAlive, timeSpawning);
+}
+
+CRY_PFX2_AVX2_TARGET uint32 AgeUpdate8(float* pNormAges, const float* pInvLifeTimes, float frameTime, uint32 begin, uint32 end)
+{
+	const __m256 frameTimev = _mm256_set1_ps(frameTime);
+	const __m256 zero = _mm256_setzero_ps();
+
+	uint32 i = begin;
+	for (; i + 8 <= end; i += 8)
+	{
+		const __m256 invLifeTime = _mm256_loadu_ps(pInvLifeTimes + i);
+		const __m256 normAge0 = _mm256_loadu_ps(pNormAges + i);
+		const __m256 frameTimeInvLife = _mm256_mul_ps(frameTimev, invLifeTime);
+		const __m256 normAge1 = Select(normAge0,
+		                               _mm256_add_ps(normAge0, frameTimeInvLife),
+		                               _mm256_mul_ps(_mm256_mul_ps(_mm256_sub_ps(zero, normAge0), frameTimev), invLifeTime));
+		_mm256_storeu_ps(pNormAges + i, normAge1);
+	}
+	return i;
+}
+
+CRY_PFX2_AVX2_TARGET uint32 LinearIntegral8(float* pPosX, float* pPosY, float* pPosZ, const float* pVelX, const float* pVelY, const float* pVelZ,
+                                            const float* pNormAges, const float* pLifeTimes, float deltaTime, uint32 begin, uint32 end)
+{
+	const __m256 deltaTimev = _mm256_set1_ps(deltaTime);
+
+	uint32 i = begin;
+	for (; i + 8 <= end; i += 8)
+	{
+		const __m256 dT = DeltaTime8(deltaTimev, _mm256_loadu_ps(pNormAges + i), _mm256_loadu_ps(pLifeTimes + i));
+		_mm256_storeu_ps(pPosX + i, _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(pVelX + i), dT), _mm256_loadu_ps(pPosX + i)));
+		_mm256_storeu_ps(pPosY + i, _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(pVelY + i), dT), _mm256_loadu_ps(pPosY + i)));
+		_mm256_storeu_ps(pPosZ + i, _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(pVelZ + i), dT), _mm256_loadu_ps(pPosZ + i)));
+	}
+	return i;
+}
+
+}
+
+void AgeUpdate(float* pNormAges, const float* pInvLifeTimes, float frameTime, uint32 begin, uint32 end)
+{
+	for (uint32 i = AgeUpdate8(pNormAges, pInvLifeTimes, frameTime, begin, end); i < end; ++i)
+	{
+		const float normAge0 = pNormAges[i];
+		pNormAges[i] = __fsel(normAge0, normAge0 + frameTime * pInvLifeTimes[i], -normAge0 * frameTime * pInvLifeTimes[i]);
+	}
+}
+
+void LinearIntegral(float* pPosX, float* pPosY, float* pPosZ, const float* pVelX, const float* pVelY, const float* pVelZ,
+                    const float* pNormAges, const float* pLifeTimes, float deltaTime, uint32 begin, uint32 end)
+{
+	for (uint32 i = LinearIntegral8(pPosX, pPosY, pPosZ, pVelX, pVelY, pVelZ, pNormAges, pLifeTimes, deltaTime, begin, end); i < end; ++i)
+	{
+		const float dT = DeltaTime(deltaTime, pNormAges[i], pLifeTimes[i]);
+		pPosX[i] = pVelX[i] * dT + pPosX[i];
+		pPosY[i] = pVelY[i] * dT + pPosY[i];
+		pPosZ[i] = pVelZ[i] * dT + pPosZ[i];
+	}
+}
+
+#else
+
+void AgeUpdate(float* pNormAges, const float* pInvLifeTimes, float frameTime, uint32 begin, uint32 end)
+{
+	CRY_PFX2_ASSERT(0);
+}
+
+void LinearIntegral(float* pPosX, float* pPosY, float* pPosZ, const float* pVelX, const float* pVelY, const float* pVelZ,
+                    const float* pNormAges, const float* pLifeTimes, float deltaTime, uint32 begin, uint32 end)
+{
+	CRY_PFX2_ASSERT(0);
+}
+
+#endif
+
+}
+
+}
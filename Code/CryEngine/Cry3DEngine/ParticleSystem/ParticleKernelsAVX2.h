@@ -0,0 +1,45 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+// -------------------------------------------------------------------------
+//  Description: 8 wide versions of the hottest per particle update loops,
+//               selected at runtime on CPUs supporting AVX2
+// -------------------------------------------------------------------------
+//
+////////////////////////////////////////////////////////////////////////////
+
+#ifndef PARTICLEKERNELSAVX2_H
+#define PARTICLEKERNELSAVX2_H
+
+#pragma once
+
+#include "ParticleCommon.h"
+
+#if defined(CRY_PFX2_USE_SSE) && CRY_PLATFORM_64BIT && (CRY_PLATFORM_WINDOWS || CRY_PLATFORM_LINUX || CRY_PLATFORM_MAC)
+	#define CRY_PFX2_USE_AVX2
+#endif
+
+namespace pfx2
+{
+
+// The kernels work on the raw SoA streams of a container. Ranges are particle ids and may end at any
+// group boundary, the groups not filling 8 lanes are processed with scalar code.
+// Results are bit exact with the 4 wide floatv loops they replace (no FMA contraction).
+namespace ParticleKernelsAVX2
+{
+
+// True if the kernels are compiled in, the CPU supports AVX2 and e_ParticlesAVX2 is set
+bool IsEnabled();
+bool IsSupported();
+
+// CParticleComponentRuntime::AgeUpdate
+void AgeUpdate(float* pNormAges, const float* pInvLifeTimes, float frameTime, uint32 begin, uint32 end);
+
+// CFeatureMotionPhysics::LinearIntegral
+void LinearIntegral(float* pPosX, float* pPosY, float* pPosZ, const float* pVelX, const float* pVelY, const float* pVelZ,
+                    const float* pNormAges, const float* pLifeTimes, float deltaTime, uint32 begin, uint32 end);
+
+}
+
+}
+
+#endif // PARTICLEKERNELSAVX2_H
@@ -6,6 +6,7 @@
 #include "ParticleProfiler.h"
 #include "ParticleComponentRuntime.h"
 #include "ParticleEmitter.h"
+#include "ParticleFeature.h"
 #include "ParticleSystem.h"
 
 CRY_PFX2_DBG
@@ -37,12 +38,49 @@ const SStatDisplay statisticsOutput[] =
 	{ EPS_RendereredParticles, "Rendered",              0 },
 	{ EPS_ActiveParticles,     "Active",                0 },
 	{ EPS_AllocatedParticles,  "Alloc",                 0 },
-	{ EPS_NewBornTime,         "New Borns (ns)",        0 },
-	{ EPS_UpdateTime,          "Update (ns)",           0 },
-	{ EPS_ComputeVerticesTime, "Compute Vertices (ns)", 0 },
-	{ EPS_TotalTiming,         "Total Timing (ns)",     0 },
+	{ EPS_NewBornTime,         "New Borns (us)",        0 },
+	{ EPS_UpdateTime,          "Update (us)",           0 },
+	{ EPS_ComputeVerticesTime, "Compute Vertices (us)", 0 },
+	{ EPS_TotalTiming,         "Total Timing (us)",     0 },
 };
 
+cstr GetFeatureName(const CParticleFeature* pFeature, string& name)
+{
+	const SParticleFeatureParams& params = pFeature->GetFeatureParams();
+	name.Format("%s %s", params.m_groupName, params.m_featureName);
+	return name.c_str();
+}
+
+bool GetOutputFileName(string& genName, cstr suffix, cstr extension)
+{
+	string folderName = Cry3DEngineBase::GetCVars()->e_ParticlesProfilerOutputFolder->GetString();
+	string fileName = Cry3DEngineBase::GetCVars()->e_ParticlesProfilerOutputName->GetString();
+	if (folderName.empty() || fileName.empty())
+		return false;
+	if (folderName[folderName.size() - 1] != '\\' || folderName[folderName.size() - 1] != '/')
+		folderName += '/';
+	static int fileIndex = 0;
+	do
+	{
+		genName.Format("%s%s%s%06d.%s", folderName.c_str(), fileName.c_str(), suffix, fileIndex, extension);
+		++fileIndex;
+	} while (gEnv->pCryPak->IsFileExist(genName));
+	return true;
+}
+
+void WriteJSONString(FILE* pFile, cstr text)
+{
+	fputc('"', pFile);
+	for (; *text; ++text)
+	{
+		if (*text == '"' || *text == '\\')
+			fputc('\\', pFile);
+		if (uint8(*text) >= ' ')
+			fputc(*text, pFile);
+	}
+	fputc('"', pFile);
+}
+
 class CParticleProfiler::CCSVFileOutput
 {
 public:
@@ -193,6 +231,9 @@ SStatistics::SStatistics()
 
 CParticleProfiler::CParticleProfiler()
 	: m_entries(gEnv->pJobManager->GetNumWorkerThreads() + 1)
+	, m_captureFrames(0)
+	, m_capturedFrames(0)
+	, m_featureTiming(false)
 {
 }
 
@@ -201,13 +242,17 @@ void CParticleProfiler::Display()
 	CRY_PROFILE_FUNCTION(PROFILE_PARTICLE);
 
 	const int anyProfilerFlags = 3 | AlphaBits('f');
-	if (GetCVars()->e_ParticlesProfiler & anyProfilerFlags)
+	const bool display = (GetCVars()->e_ParticlesProfiler & anyProfilerFlags) != 0;
+	const bool capture = m_captureFrames != 0;
+	if (display || capture)
 	{
 		SortEntries();
 
 		if (!m_entries[0].empty())
 		{
 #ifndef _RELEASE
+			if (capture)
+				AddToCapture();
 			if (GetCVars()->e_ParticlesProfiler & AlphaBit('f'))
 				SaveToFile();
 #endif
@@ -219,29 +264,169 @@ void CParticleProfiler::Display()
 	}
 	for (auto& entries : m_entries)
 		entries.clear();
+
+#ifndef _RELEASE
+	UpdateCapture();
+#endif
+	m_featureTiming = display || m_captureFrames != 0;
 }
 
 void CParticleProfiler::SaveToFile()
 {
 	string genName;
-	string folderName = GetCVars()->e_ParticlesProfilerOutputFolder->GetString();
-	string fileName = GetCVars()->e_ParticlesProfilerOutputName->GetString();
-	if (folderName.empty() || fileName.empty())
+	if (!GetOutputFileName(genName, "", "csv"))
 		return;
-	if (folderName[folderName.size() - 1] != '\\' || folderName[folderName.size() - 1] != '/')
-		folderName += '/';
-	static int fileIndex = 0;
-	do
-	{
-		genName.Format("%s%s%06d.csv", folderName.c_str(), fileName.c_str(), fileIndex);
-		++fileIndex;
-	} while (gEnv->pCryPak->IsFileExist(genName));
 
 	CCSVFileOutput output(genName.c_str());
 	if (output)
 		WriteEntries(output);
 }
 
+void CParticleProfiler::UpdateCapture()
+{
+	if (m_captureFrames != 0)
+	{
+		if (++m_capturedFrames >= m_captureFrames)
+		{
+			SaveCapture();
+			m_captureFrames = 0;
+			m_capture.clear();
+		}
+	}
+	else if (GetCVars()->e_ParticlesProfilerCapture > 0)
+	{
+		// the capture starts with the next frame, the first one measuring the features
+		m_captureFrames = GetCVars()->e_ParticlesProfilerCapture;
+		m_capturedFrames = 0;
+		m_capture.clear();
+		GetCVars()->e_ParticlesProfilerCapture = 0;
+	}
+}
+
+void CParticleProfiler::AddToCapture()
+{
+	const CParticleComponentRuntime* pCurrentRuntime = nullptr;
+	SCaptureComponent* pCapture = nullptr;
+	string name;
+
+	for (const SEntry& entry : m_entries[0])
+	{
+		if (entry.m_pRuntime != pCurrentRuntime)
+		{
+			pCurrentRuntime = entry.m_pRuntime;
+			const CParticleComponent* pComponent = pCurrentRuntime->GetComponent();
+			const cstr effectName = pComponent->GetEffect()->GetFullName();
+			pCapture = &m_capture[name.Format("%s:%d", effectName, pComponent->GetComponentId())];
+			if (pCapture->m_runtimeFrames == 0)
+			{
+				pCapture->m_effectName = effectName;
+				pCapture->m_componentName = pComponent->GetName();
+			}
+			++pCapture->m_runtimeFrames;
+		}
+		pCapture->m_values[entry.m_type] += entry.m_value;
+
+		if (entry.m_pFeature)
+		{
+			GetFeatureName(entry.m_pFeature, name);
+			auto it = std::find_if(pCapture->m_features.begin(), pCapture->m_features.end(), [&name](const SCaptureFeature& feature)
+			{
+				return feature.m_name == name;
+			});
+			if (it == pCapture->m_features.end())
+			{
+				SCaptureFeature feature;
+				feature.m_name = name;
+				feature.m_time = 0;
+				it = pCapture->m_features.insert(it, feature);
+			}
+			it->m_time += entry.m_value;
+		}
+	}
+}
+
+void CParticleProfiler::SaveCapture() const
+{
+	string csvName;
+	string jsonName;
+	if (!GetOutputFileName(csvName, "_capture", "csv") || !GetOutputFileName(jsonName, "_capture", "json"))
+		return;
+
+	if (FILE* pFile = fxopen(csvName.c_str(), "w"))
+	{
+		WriteCaptureCSV(pFile);
+		fclose(pFile);
+	}
+	if (FILE* pFile = fxopen(jsonName.c_str(), "w"))
+	{
+		WriteCaptureJSON(pFile);
+		fclose(pFile);
+	}
+	CryLogAlways("Particle profiler capture of %d frames saved to %s and %s", m_capturedFrames, csvName.c_str(), jsonName.c_str());
+}
+
+// Values are averages per captured frame, summed over all emitters of the effect ("Instances" is the average emitter count)
+void CParticleProfiler::WriteCaptureCSV(FILE* pFile) const
+{
+	const float invFrames = 1.0f / float(m_capturedFrames);
+
+	fprintf(pFile, "Effect, Component, Feature, Instances, ");
+	for (const auto& stat : statisticsOutput)
+		fprintf(pFile, "%s, ", stat.m_statName);
+	fprintf(pFile, "Feature Time (us), \n");
+
+	for (const auto& it : m_capture)
+	{
+		const SCaptureComponent& capture = it.second;
+		const float instances = capture.m_runtimeFrames * invFrames;
+		fprintf(pFile, "%s, %s, -, %.2f, ", capture.m_effectName.c_str(), capture.m_componentName.c_str(), instances);
+		for (const auto& stat : statisticsOutput)
+			fprintf(pFile, "%.1f, ", capture.m_values[stat.m_stat] * invFrames);
+		fprintf(pFile, "%.1f, \n", capture.m_values[EPS_FeatureTime] * invFrames);
+
+		for (const SCaptureFeature& feature : capture.m_features)
+		{
+			fprintf(pFile, "%s, %s, %s, %.2f, ", capture.m_effectName.c_str(), capture.m_componentName.c_str(), feature.m_name.c_str(), instances);
+			for (uint i = 0; i < CRY_ARRAY_COUNT(statisticsOutput); ++i)
+				fprintf(pFile, ", ");
+			fprintf(pFile, "%.1f, \n", feature.m_time * invFrames);
+		}
+	}
+}
+
+void CParticleProfiler::WriteCaptureJSON(FILE* pFile) const
+{
+	const float invFrames = 1.0f / float(m_capturedFrames);
+
+	fprintf(pFile, "{\n\t\"frames\": %d,\n\t\"components\": [", m_capturedFrames);
+	bool firstComponent = true;
+	for (const auto& it : m_capture)
+	{
+		const SCaptureComponent& capture = it.second;
+		fprintf(pFile, firstComponent ? "\n\t\t{\n\t\t\t\"effect\": " : ",\n\t\t{\n\t\t\t\"effect\": ");
+		firstComponent = false;
+		WriteJSONString(pFile, capture.m_effectName.c_str());
+		fprintf(pFile, ",\n\t\t\t\"component\": ");
+		WriteJSONString(pFile, capture.m_componentName.c_str());
+		fprintf(pFile, ",\n\t\t\t\"instances\": %.2f,\n\t\t\t\"stats\": {", capture.m_runtimeFrames * invFrames);
+		for (uint i = 0; i < CRY_ARRAY_COUNT(statisticsOutput); ++i)
+		{
+			fprintf(pFile, i ? ", " : " ");
+			WriteJSONString(pFile, statisticsOutput[i].m_statName);
+			fprintf(pFile, ": %.1f", capture.m_values[statisticsOutput[i].m_stat] * invFrames);
+		}
+		fprintf(pFile, " },\n\t\t\t\"features\": [");
+		for (uint i = 0; i < capture.m_features.size(); ++i)
+		{
+			fprintf(pFile, i ? ",\n\t\t\t\t{ \"name\": " : "\n\t\t\t\t{ \"name\": ");
+			WriteJSONString(pFile, capture.m_features[i].m_name.c_str());
+			fprintf(pFile, ", \"time\": %.1f }", capture.m_features[i].m_time * invFrames);
+		}
+		fprintf(pFile, capture.m_features.empty() ? "]\n\t\t}" : "\n\t\t\t]\n\t\t}");
+	}
+	fprintf(pFile, "\n\t]\n}\n");
+}
+
 void CParticleProfiler::SortEntries()
 {
 	auto& finalElements = m_entries[0];
@@ -276,7 +461,7 @@ void CParticleProfiler::WriteEntries(CCSVFileOutput& output) const
 	{
 		if (entry.m_pRuntime != pCurrentRuntime)
 		{
-			output.WriteStatistics(entry.m_pRuntime, runtimeStats);
+			output.WriteStatistics(pCurrentRuntime, runtimeStats);
 			runtimeStats = SStatistics();
 			pCurrentRuntime = entry.m_pRuntime;
 		}
@@ -294,7 +479,7 @@ void CParticleProfiler::DrawPerfomanceStats()
 	{
 		{ EPS_ActiveParticles,     "Active",            countsBudget },
 		{ EPS_RendereredParticles, "Rendered",          countsBudget },
-		{ EPS_TotalTiming,         "Total Timing (ns)", timingBudget },
+		{ EPS_TotalTiming,         "Total Timing (us)", timingBudget },
 	};
 
 	CStatisticsDisplay output;
@@ -306,6 +491,7 @@ void CParticleProfiler::DrawPerfomanceStats()
 		DrawStats(output, statPos, stat.m_stat, stat.m_budget, stat.m_statName);
 		statPos.y += gDisplayBarSize.y + gDisplayLineGap * (gDisplayMaxNumComponents + 3);
 	}
+	DrawFeatureStats(output, statPos, timingBudget);
 }
 
 void CParticleProfiler::DrawStatsCounts(CStatisticsDisplay& output, Vec2 pos, uint budget)
@@ -432,6 +618,72 @@ void CParticleProfiler::DrawStats(CStatisticsDisplay& output, Vec2 pos, EProfile
 	output.DrawBudgetBar(barPosition, maxValue, budget);
 }
 
+void CParticleProfiler::DrawFeatureStats(CStatisticsDisplay& output, Vec2 pos, uint budget)
+{
+	// time per feature type, summed over all components using it
+	struct SStatEntry
+	{
+		const SParticleFeatureParams* pParams;
+		uint value;
+	};
+
+	std::vector<SStatEntry> statEntries;
+	uint statTotal = 0;
+
+	for (const SEntry& entry : m_entries[0])
+	{
+		if (entry.m_type != EPS_FeatureTime)
+			continue;
+
+		const SParticleFeatureParams* pParams = &entry.m_pFeature->GetFeatureParams();
+		auto it = std::find_if(statEntries.begin(), statEntries.end(), [pParams](const SStatEntry& statEntry)
+		{
+			return statEntry.pParams == pParams;
+		});
+		if (it == statEntries.end())
+		{
+			SStatEntry statEntry = { pParams, 0 };
+			it = statEntries.insert(it, statEntry);
+		}
+		it->value += entry.m_value;
+		statTotal += entry.m_value;
+	}
+
+	std::sort(statEntries.begin(), statEntries.end(), [](const SStatEntry& v0, const SStatEntry& v1)
+	{
+		return v0.value > v1.value;
+	});
+
+	const Vec2 barPosition = Vec2(pos.x, pos.y + gDisplayLineGap);
+	const uint maxValue = max(statTotal, budget);
+	Vec2 textPos = pos;
+	uint lastStat = 0;
+
+	output.DrawText(textPos, ColorF(1.0f, 1.0f, 1.0f), "Feature Timing (us) Total (%d)", statTotal);
+	textPos.y += gDisplayLineGap + gDisplayBarSize.y;
+
+	uint statCount = min(uint(statEntries.size()), gDisplayMaxNumComponents);
+	for (uint i = 0; i < statCount; ++i)
+	{
+		const SParticleFeatureParams* pParams = statEntries[i].pParams;
+		const ColorF color = ColorF(pParams->m_color);
+		const uint value = statEntries[i].value;
+
+		output.DrawBar(barPosition, maxValue, lastStat, lastStat + value, pParams->m_color);
+		output.DrawText(textPos, color, "%s %s (%d)", pParams->m_groupName, pParams->m_featureName, value);
+		textPos.y += gDisplayLineGap;
+
+		lastStat += value;
+	}
+	if ((statTotal - lastStat) != 0)
+	{
+		output.DrawBar(barPosition, maxValue, lastStat, statTotal, ColorB(92, 92, 92));
+		output.DrawText(textPos, ColorF(0.35f, 0.35f, 0.35f), "other (%d)", statTotal - lastStat);
+	}
+
+	output.DrawBudgetBar(barPosition, maxValue, budget);
+}
+
 void CParticleProfiler::DrawMemoryStats()
 {	
 	IRenderAuxGeom* pRenderAux = gEnv->pRenderer->GetIRenderAuxGeom();
@@ -9,6 +9,7 @@ namespace pfx2
 
 class CParticleProfiler;
 class CParticleComponentRuntime;
+class CParticleFeature;
 
 enum EProfileStat
 {
@@ -20,6 +21,7 @@ enum EProfileStat
 	EPS_UpdateTime,
 	EPS_ComputeVerticesTime,
 	EPS_TotalTiming,
+	EPS_FeatureTime,
 
 	EPST_Count,
 };
@@ -37,6 +39,20 @@ private:
 	EProfileStat               m_stat;
 };
 
+// Time of one feature call, only measured while the profiler is displayed or capturing
+class CFeatureTimeProfiler
+{
+public:
+	CFeatureTimeProfiler(CParticleProfiler& profiler, CParticleComponentRuntime* pRuntime, const CParticleFeature* pFeature);
+	~CFeatureTimeProfiler();
+
+private:
+	CParticleProfiler&         m_profiler;
+	CParticleComponentRuntime* m_pRuntime;
+	const CParticleFeature*    m_pFeature;
+	int64                      m_startTicks;
+};
+
 struct SStatistics
 {
 	SStatistics();
@@ -52,11 +68,27 @@ public:
 	struct SEntry
 	{
 		CParticleComponentRuntime* m_pRuntime;
+		const CParticleFeature*    m_pFeature;
 		EProfileStat               m_type;
 		uint                       m_value;
 	};
 	typedef std::vector<SEntry> TEntries;
 
+	// Totals of one effect component over all its emitters during a capture
+	struct SCaptureFeature
+	{
+		string m_name;
+		uint64 m_time;
+	};
+	struct SCaptureComponent
+	{
+		string                       m_effectName;
+		string                       m_componentName;
+		uint                         m_runtimeFrames;
+		uint64                       m_values[EPST_Count];
+		std::vector<SCaptureFeature> m_features;
+	};
+
 public:
 	CParticleProfiler();
 
@@ -65,6 +97,8 @@ public:
 	void SaveToFile();
 
 	void AddEntry(CParticleComponentRuntime* pRuntime, EProfileStat type, uint value = 1);
+	void AddFeatureEntry(CParticleComponentRuntime* pRuntime, const CParticleFeature* pFeature, uint value);
+	bool IsFeatureTiming() const { return m_featureTiming; }
 
 private:
 	static CVars* GetCVars() { return Cry3DEngineBase::GetCVars(); }
@@ -74,9 +108,20 @@ private:
 	void DrawPerfomanceStats();
 	void DrawStatsCounts(CStatisticsDisplay& output, Vec2 pos, uint budget);
 	void DrawStats(CStatisticsDisplay& output, Vec2 pos, EProfileStat stat, uint budget, cstr statName);
+	void DrawFeatureStats(CStatisticsDisplay& output, Vec2 pos, uint budget);
 	void DrawMemoryStats();
 
-	std::vector<TEntries> m_entries;
+	void UpdateCapture();
+	void AddToCapture();
+	void SaveCapture() const;
+	void WriteCaptureCSV(FILE* pFile) const;
+	void WriteCaptureJSON(FILE* pFile) const;
+
+	std::vector<TEntries>                    m_entries;
+	std::map<string, SCaptureComponent>      m_capture;
+	uint                                     m_captureFrames;
+	uint                                     m_capturedFrames;
+	bool                                     m_featureTiming;
 };
 
 }
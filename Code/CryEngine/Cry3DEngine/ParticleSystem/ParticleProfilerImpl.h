@@ -10,11 +10,23 @@ ILINE void CParticleProfiler::AddEntry(CParticleComponentRuntime* pRuntime, EPro
 	const uint32 threadId = JobManager::GetWorkerThreadId();
 	SEntry entry;
 	entry.m_pRuntime = pRuntime;
+	entry.m_pFeature = nullptr;
 	entry.m_type = type;
 	entry.m_value = value;
 	m_entries[threadId + 1].push_back(entry);
 }
 
+ILINE void CParticleProfiler::AddFeatureEntry(CParticleComponentRuntime* pRuntime, const CParticleFeature* pFeature, uint value)
+{
+	const uint32 threadId = JobManager::GetWorkerThreadId();
+	SEntry entry;
+	entry.m_pRuntime = pRuntime;
+	entry.m_pFeature = pFeature;
+	entry.m_type = EPS_FeatureTime;
+	entry.m_value = value;
+	m_entries[threadId + 1].push_back(entry);
+}
+
 ILINE CTimeProfiler::CTimeProfiler(CParticleProfiler& profiler, CParticleComponentRuntime* pRuntime, EProfileStat stat)
 	: m_profiler(profiler)
 	, m_pRuntime(pRuntime)
@@ -31,9 +43,29 @@ ILINE CTimeProfiler::~CTimeProfiler()
 	m_profiler.AddEntry(m_pRuntime, EPS_TotalTiming, time);
 }
 
+ILINE CFeatureTimeProfiler::CFeatureTimeProfiler(CParticleProfiler& profiler, CParticleComponentRuntime* pRuntime, const CParticleFeature* pFeature)
+	: m_profiler(profiler)
+	, m_pRuntime(pRuntime)
+	, m_pFeature(pFeature)
+	, m_startTicks(profiler.IsFeatureTiming() ? CryGetTicks() : 0)
+{
+}
+
+ILINE CFeatureTimeProfiler::~CFeatureTimeProfiler()
+{
+	if (!m_startTicks)
+		return;
+	const int64 endTicks = CryGetTicks();
+	const uint time = uint(gEnv->pTimer->TicksToSeconds(endTicks - m_startTicks) * 1000000.0f);
+	m_profiler.AddFeatureEntry(m_pRuntime, m_pFeature, time);
+}
+
 #else
 
 ILINE void CParticleProfiler::AddEntry(CParticleComponentRuntime* pRuntime, EProfileStat type, uint value)  {}
+ILINE void CParticleProfiler::AddFeatureEntry(CParticleComponentRuntime* pRuntime, const CParticleFeature* pFeature, uint value) {}
+ILINE CFeatureTimeProfiler::CFeatureTimeProfiler(CParticleProfiler& profiler, CParticleComponentRuntime* pRuntime, const CParticleFeature* pFeature) : m_profiler(profiler) {}
+ILINE CFeatureTimeProfiler::~CFeatureTimeProfiler() {}
 ILINE CTimeProfiler::CTimeProfiler(CParticleProfiler& profiler, CParticleComponentRuntime* pRuntime, EProfileStat stat) : m_profiler(profiler) {}
 ILINE CTimeProfiler::~CTimeProfiler() {}
 
@@ -20,6 +20,9 @@ namespace pfx2
 
 	CParticleSpline::CParticleSpline()
 		: m_valueRange(1.0f)
+		, m_lutScale(0.0f)
+		, m_lutBias(0.0f)
+		, m_lutMax(0.0f)
 	{
 		MakeFlatLine(1.0f);
 	}
@@ -36,6 +39,58 @@ namespace pfx2
 		m_keys[0].coeff0   = m_keys[0].coeff1 = 0.0f;
 
 		m_valueRange = Range(Range::EMPTY) | v0 | v1;
+		m_lut.clear();
+	}
+
+
+	bool CParticleSpline::Bake(float maxError)
+	{
+		const uint kMinResolution = 16;
+		const uint kMaxResolution = 256;
+		const uint kErrorSamples = 4;
+
+		m_lut.clear();
+
+		// a single linear segment is evaluated exactly faster than through the table
+		const size_t numKeys = GetNumKeys();
+		if (maxError <= 0.0f || numKeys < 2 || (numKeys == 2 && m_keys[0].coeff0 == 0.0f && m_keys[0].coeff1 == 0.0f))
+			return false;
+
+		const float startTime = m_keys.front().time;
+		const float timeRange = max(m_keys.back().time - startTime, FLT_EPSILON);
+		const float tolerance = maxError * max(m_valueRange.Length(), FLT_EPSILON);
+
+		std::vector<float> lut;
+		for (uint resolution = kMinResolution; resolution <= kMaxResolution; resolution *= 2)
+		{
+			const float timeStep = timeRange / float(resolution);
+			lut.resize(resolution + 2);
+			for (uint i = 0; i <= resolution; ++i)
+				lut[i] = Interpolate(min(startTime + timeStep * float(i), m_keys.back().time));
+			lut[resolution + 1] = lut[resolution];
+
+			float error = 0.0f;
+			for (uint i = 0; i < resolution; ++i)
+			{
+				for (uint j = 1; j < kErrorSamples; ++j)
+				{
+					const float t = float(j) / float(kErrorSamples);
+					const float exact = Interpolate(startTime + timeStep * (float(i) + t));
+					error = max(error, abs(exact - ::Lerp(lut[i], lut[i + 1], t)));
+				}
+			}
+
+			if (error <= tolerance)
+			{
+				m_lut.swap(lut);
+				m_lutScale = float(resolution) / timeRange;
+				m_lutBias = -startTime * m_lutScale;
+				m_lutMax = float(resolution);
+				return true;
+			}
+		}
+
+		return false;
 	}
 
 
@@ -70,6 +125,7 @@ namespace pfx2
 		const size_t subNKeys = nKeys == 0 ? 0 : nKeys - 1;
 
 		KeyType key;
+		m_lut.clear();
 		if (nKeys >= 2)
 		{
 			Resize(nKeys);
@@ -36,6 +36,11 @@ public:
 #endif
 	const Range& GetValueRange() const { return m_valueRange; }
 
+	// Samples the curve into a lookup table used by the vectorized Interpolate, at the lowest resolution
+	// where linear interpolation stays within maxError of the value range. Keeps the exact curve if none does.
+	bool         Bake(float maxError);
+	bool         IsBaked() const { return !m_lut.empty(); }
+
 	// ISplineEvaluator
 	virtual int        GetKeyCount() const override { return GetNumKeys(); }
 	virtual void       GetKey(int i, KeyType& key) const override;
@@ -57,6 +62,9 @@ public:
 
 private:
 	void  Resize(size_t size);
+#ifdef CRY_PFX2_USE_SSE
+	floatv InterpolateBaked(const floatv time) const;
+#endif
 	float DefaultSlope(size_t keyIdx) const;
 	float StartSlope(size_t keyIdx) const;
 	float EndSlope(size_t keyIdx) const;
@@ -73,6 +81,10 @@ private:
 	std::vector<SplineKey>     m_keys;
 	std::vector<spline::Flags> m_keyFlags;
 	Range                      m_valueRange;
+	std::vector<float>         m_lut;
+	float                      m_lutScale;
+	float                      m_lutBias;
+	float                      m_lutMax;
 };
 
 // Automatically creates a global Serialize() for Type, which invokes Type.Serialize
@@ -103,6 +115,11 @@ public:
 			range |= spline.GetValueRange();
 		return range;
 	}
+	void Bake(float maxError)
+	{
+		for (auto& spline : m_splines)
+			spline.Bake(maxError);
+	}
 	float GetMaxValue() const { return GetValueRange().start; }
 	float GetMinValue() const { return GetValueRange().end; }
 
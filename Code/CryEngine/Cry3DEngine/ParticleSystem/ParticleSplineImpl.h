@@ -41,6 +41,9 @@ ILINE float CParticleSpline::Interpolate(float time) const
 #ifdef CRY_PFX2_USE_SSE
 ILINE floatv CParticleSpline::Interpolate(const floatv time) const
 {
+	if (IsBaked())
+		return InterpolateBaked(time);
+
 	const SplineKey* __restrict pKey = &*m_keys.begin();
 	const SplineKey* __restrict pEndKey = &*(m_keys.end() - 1);
 
@@ -80,6 +83,22 @@ ILINE floatv CParticleSpline::Interpolate(const floatv time) const
 
 	return v;
 }
+
+ILINE floatv CParticleSpline::InterpolateBaked(const floatv time) const
+{
+	const floatv x = clamp(MAdd(time, ToFloatv(m_lutScale), ToFloatv(m_lutBias)), ToFloatv(0.0f), ToFloatv(m_lutMax));
+	const __m128i index = _mm_cvttps_epi32(x);
+	const floatv t = x - _mm_cvtepi32_ps(index);
+
+	// the table has one extra sample at the end, so index + 1 is valid at the last key
+	CRY_ALIGN(16) int32 indices[4];
+	_mm_store_si128((__m128i*)indices, index);
+	const float* __restrict pLut = m_lut.data();
+	const floatv v0 = _mm_setr_ps(pLut[indices[0]], pLut[indices[1]], pLut[indices[2]], pLut[indices[3]]);
+	const floatv v1 = _mm_setr_ps(pLut[indices[0] + 1], pLut[indices[1] + 1], pLut[indices[2] + 1], pLut[indices[3] + 1]);
+
+	return Lerp(v0, v1, t);
+}
 #endif
 
 ILINE void CParticleSpline::Interpolate(float time, ValueType& value)
@@ -15,9 +15,12 @@
 #include "ParticleSystem.h"
 #include "ParticleEffect.h"
 #include "ParticleEmitter.h"
+#include "Features/FeatureCollision.h"
 
 CRY_PFX2_DBG
 
+DECLARE_JOB("Particles : LoadEffect", TLoadEffectJob, pfx2::CParticleSystem::Job_LoadEffect);
+
 namespace pfx2
 {
 
@@ -51,12 +54,75 @@ PParticleEffect CParticleSystem::FindEffect(cstr name, bool bAllowLoad)
 {
 	auto it = m_effects.find(name);
 	if (it != m_effects.end())
+	{
+		if (it->second && it->second->IsLoading())
+		{
+			FinishEffectLoads(it->second, false);
+			it = m_effects.find(name);
+		}
 		return it->second;
+	}
 	if (bAllowLoad)
 		return LoadEffect(name);
 	return nullptr;
 }
 
+PParticleEffect CParticleSystem::PreloadEffect(cstr name)
+{
+	auto it = m_effects.find(name);
+	if (it != m_effects.end())
+		return it->second;
+	if (!GetCVars()->e_ParticlesAsyncLoad)
+		return LoadEffect(name);
+
+	MEMSTAT_CONTEXT(EMemStatContextTypes::MSC_Other, 0, "pfx2::PreloadEffect");
+
+	_smart_ptr<CParticleEffect> pEffect = new CParticleEffect();
+	pEffect->SetLoading(true);
+	RenameEffect(pEffect, name);
+
+	m_effectLoads.emplace_back(new SEffectLoad(pEffect));
+	TLoadEffectJob job(m_effectLoads.back().get());
+	job.SetClassInstance(this);
+	job.RegisterJobState(&m_effectLoads.back()->m_state);
+	job.Run();
+
+	return pEffect;
+}
+
+void CParticleSystem::Job_LoadEffect(SEffectLoad* pLoad)
+{
+	pLoad->m_loaded = ReadEffect(*pLoad->m_pEffect, pLoad->m_pEffect->GetName());
+}
+
+void CParticleSystem::FinishEffectLoads(const CParticleEffect* pWaitForEffect, bool waitForAll)
+{
+	// Loaded effects are compiled here, on the main thread. Loads still running are left
+	// for the next update, unless they are waited for.
+	for (auto it = m_effectLoads.begin(); it != m_effectLoads.end(); )
+	{
+		SEffectLoad& load = **it;
+		const bool wait = waitForAll || load.m_pEffect == pWaitForEffect;
+		if (!wait && load.m_state.IsRunning())
+		{
+			++it;
+			continue;
+		}
+
+		gEnv->pJobManager->WaitForJob(load.m_state);
+		load.m_pEffect->SetLoading(false);
+		if (load.m_loaded)
+			load.m_pEffect->Compile();
+		else
+		{
+			auto found = m_effects.find(load.m_pEffect->GetName());
+			if (found != m_effects.end() && found->second == load.m_pEffect)
+				found->second = nullptr;
+		}
+		it = m_effectLoads.erase(it);
+	}
+}
+
 PParticleEmitter CParticleSystem::CreateEmitter(PParticleEffect pEffect)
 {
 	MEMSTAT_CONTEXT(EMemStatContextTypes::MSC_Other, 0, "pfx2::ParticleEmitter");
@@ -64,6 +130,8 @@ PParticleEmitter CParticleSystem::CreateEmitter(PParticleEffect pEffect)
 
 	CRY_PFX2_ASSERT(pEffect.get());
 	CParticleEffect* pCEffect = CastEffect(pEffect);
+	if (pCEffect->IsLoading())
+		FinishEffectLoads(pCEffect, false);
 	pCEffect->Compile();
 
 	_smart_ptr<CParticleEmitter> pEmitter = new CParticleEmitter(m_nextEmitterId++);
@@ -138,6 +206,8 @@ void CParticleSystem::Update()
 		m_cameraMotion.q = currentCameraPose.q * m_lastCameraPose.q.GetInverted();
 	}
 
+	FinishEffectLoads(nullptr, false);
+
 	if (GetCVars()->e_Particles)
 	{
 		auto gpuMan = gEnv->pRenderer->GetGpuParticleManager();
@@ -152,6 +222,10 @@ void CParticleSystem::Update()
 		m_newEmitters.clear();
 
 		InvalidateCachedRenderObjects();
+		CCollisionBatch::Get().BeginFrame();
+#if !defined(_RELEASE)
+		UpdateCollisionBenchmark();
+#endif
 
 		m_statsCPU = SParticleStats();
 		m_statsGPU = SParticleStats();
@@ -159,8 +233,13 @@ void CParticleSystem::Update()
 		for (auto& pEmitter : m_emitters)
 			pEmitter->AccumStats(m_statsCPU, m_statsGPU);
 
+		CullEmitters(camera);
+		m_jobManager.ApplyBudget(m_emitters);
+		const float maxSkipTime = GetCVars()->e_ParticlesCullMaxSkipTime;
 		for (auto& pEmitter : m_emitters)
 		{
+			if (pEmitter->SkipBudgetUpdate() || pEmitter->SkipCulledUpdate(maxSkipTime))
+				continue;
 			pEmitter->Update();
 			m_jobManager.AddEmitter(pEmitter);
 		}
@@ -172,6 +251,145 @@ void CParticleSystem::Update()
 	}
 }
 
+#if !defined(_RELEASE)
+void CParticleSystem::UpdateCollisionBenchmark()
+{
+	// runs the effect for kPhaseFrames with e_ParticlesCollisionBatch 0, then 1, measuring after kWarmupFrames
+	const int kWarmupFrames = 60;
+	const int kPhaseFrames = 180;
+
+	CVars* pCVars = GetCVars();
+	SCollisionBenchmark& bench = m_collisionBenchmark;
+
+	if (bench.m_emitters.empty())
+	{
+		if (pCVars->e_ParticlesCollisionBenchmark <= 0)
+			return;
+
+		const char* effectName = pCVars->e_ParticlesCollisionBenchmarkEffect->GetString();
+		PParticleEffect pEffect = FindEffect(effectName);
+		if (!pEffect)
+		{
+			CryWarning(VALIDATOR_MODULE_3DENGINE, VALIDATOR_WARNING, "Particle collision benchmark: effect \"%s\" not found", effectName);
+			pCVars->e_ParticlesCollisionBenchmark = 0;
+			return;
+		}
+
+		const CCamera& camera = gEnv->p3DEngine->GetRenderingCamera();
+		const int numEmitters = pCVars->e_ParticlesCollisionBenchmark;
+		const int gridSize = int(ceil(sqrt(float(numEmitters))));
+		const Vec3 center = camera.GetPosition() + camera.GetViewdir() * 10.0f;
+		for (int i = 0; i < numEmitters; ++i)
+		{
+			const Vec3 offset(float(i % gridSize) - gridSize * 0.5f, float(i / gridSize) - gridSize * 0.5f, 0.0f);
+			PParticleEmitter pEmitter = CreateEmitter(pEffect);
+			pEmitter->SetLocation(QuatTS(IDENTITY, center + offset * 2.0f, 1.0f));
+			pEmitter->Activate(true);
+			bench.m_emitters.push_back(pEmitter);
+		}
+
+		bench.m_frame = 0;
+		bench.m_prevBatch = pCVars->e_ParticlesCollisionBatch;
+		CryLogAlways("Particle collision benchmark: %d emitters of %s", numEmitters, effectName);
+	}
+
+	const int phase = bench.m_frame / kPhaseFrames;
+	if (phase < 2)
+	{
+		pCVars->e_ParticlesCollisionBatch = phase;
+		if (bench.m_frame % kPhaseFrames >= kWarmupFrames)
+		{
+			for (auto& pEmitter : bench.m_emitters)
+			{
+				for (auto& ref : CastEmitter(pEmitter)->GetRuntimes())
+				{
+					if (auto pCpuRuntime = ref.pRuntime->GetCpuRuntime())
+					{
+						bench.m_updateTime[phase] += pCpuRuntime->GetCostEstimate();
+						bench.m_particles[phase] += uint(pCpuRuntime->GetContainer().GetLastParticleId());
+					}
+				}
+			}
+			if (phase == 1)
+			{
+				bench.m_queuedRays += CCollisionBatch::Get().GetNumQueuedRays();
+				bench.m_hits += CCollisionBatch::Get().GetNumHits();
+			}
+		}
+		++bench.m_frame;
+		return;
+	}
+
+	const float invFrames = 1.0f / float(kPhaseFrames - kWarmupFrames);
+	for (int i = 0; i < 2; ++i)
+	{
+		CryLogAlways("Particle collision benchmark, e_ParticlesCollisionBatch %d: %.2f ms update, %u particles per frame",
+		             i, bench.m_updateTime[i] * invFrames, uint(bench.m_particles[i] * invFrames));
+	}
+	CryLogAlways("Particle collision benchmark: %u rays queued and %u hits per frame",
+	             uint(bench.m_queuedRays * invFrames), uint(bench.m_hits * invFrames));
+
+	for (auto& pEmitter : bench.m_emitters)
+		pEmitter->Kill();
+	pCVars->e_ParticlesCollisionBatch = bench.m_prevBatch;
+	pCVars->e_ParticlesCollisionBenchmark = 0;
+	bench = SCollisionBenchmark();
+}
+#endif
+
+void CParticleSystem::CullEmitters(const CCamera& camera)
+{
+	FUNCTION_PROFILER_3DENGINE;
+
+	const bool cullOffscreen = GetCVars()->e_ParticlesCullOffscreen != 0;
+	const float invCellSize = 1.0f / max(GetCVars()->e_ParticlesCullCellSize, 1.0f);
+
+	// hash the emitters by the cell of their bounds center, so whole cells outside of the frustum are rejected at once
+	m_cullEntries.clear();
+	for (uint i = 0; i < m_emitters.size(); ++i)
+	{
+		CParticleEmitter* pEmitter = m_emitters[i];
+		pEmitter->SetCulled(false);
+		if (!cullOffscreen || pEmitter->WasRenderedLastFrame())
+			continue;
+
+		// emitters without bounds yet or with gpu runtimes are always updated
+		const AABB bounds = pEmitter->GetBBox();
+		if (bounds.IsReset() || bounds.IsEmpty())
+			continue;
+		bool hasGpuRuntimes = false;
+		for (auto& ref : pEmitter->GetRuntimes())
+			hasGpuRuntimes |= ref.pRuntime->GetGpuRuntime() != nullptr;
+		if (hasGpuRuntimes)
+			continue;
+
+		const Vec3 center = bounds.GetCenter() * invCellSize;
+		const uint64 x = uint64(int64(floor(center.x))) & 0x1fffff;
+		const uint64 y = uint64(int64(floor(center.y))) & 0x1fffff;
+		const uint64 z = uint64(int64(floor(center.z))) & 0x1fffff;
+		SCullEntry entry;
+		entry.m_cell = (x << 42) | (y << 21) | z;
+		entry.m_emitterIdx = i;
+		m_cullEntries.push_back(entry);
+	}
+	std::sort(m_cullEntries.begin(), m_cullEntries.end());
+
+	for (auto first = m_cullEntries.begin(); first != m_cullEntries.end(); )
+	{
+		auto last = first;
+		AABB cellBounds(AABB::RESET);
+		for (; last != m_cullEntries.end() && last->m_cell == first->m_cell; ++last)
+			cellBounds.Add(m_emitters[last->m_emitterIdx]->GetBBox());
+
+		const bool cellVisible = camera.IsAABBVisible_F(cellBounds);
+		for (; first != last; ++first)
+		{
+			CParticleEmitter* pEmitter = m_emitters[first->m_emitterIdx];
+			pEmitter->SetCulled(!cellVisible || !camera.IsAABBVisible_F(pEmitter->GetBBox()));
+		}
+	}
+}
+
 void CParticleSystem::SyncronizeUpdateKernels()
 {
 	FUNCTION_PROFILER_3DENGINE;
@@ -247,6 +465,16 @@ float CParticleSystem::DisplayDebugStats(Vec2 displayLocation, float lineHeight)
 	if (statsGPUAvg.components.alive)
 		DisplayParticleStats(displayLocation, lineHeight, "Wavicle GPU", statsGPUAvg);
 
+	const CParticleStreamPool::SStats poolStats = CParticleStreamPool::Get().GetStats();
+	if (poolStats.m_used)
+	{
+		gEnv->p3DEngine->DrawTextRightAligned(
+			displayLocation.x, displayLocation.y,
+			"Wavicle Mem : %6d KB used / %6d KB wasted / %6d KB peak",
+			int(poolStats.m_requested >> 10), int((poolStats.m_used - poolStats.m_requested + poolStats.m_cached) >> 10), int(poolStats.m_peak >> 10));
+		displayLocation.y += lineHeight;
+	}
+
 	if (m_pPartManager)
 	{
 		static SParticleCounts countsAvg;
@@ -280,6 +508,7 @@ void CParticleSystem::ClearRenderResources()
 #endif
 
 	m_emitters.clear();
+	FinishEffectLoads(nullptr, true);
 
 	for (auto it = m_effects.begin(); it != m_effects.end(); )
 	{
@@ -318,18 +547,54 @@ PParticleEffect CParticleSystem::LoadEffect(cstr effectName)
 	MEMSTAT_CONTEXT(EMemStatContextTypes::MSC_Other, 0, "pfx2::LoadEffect");
 	MEMSTAT_CONTEXT_FMT(EMemStatContextTypes::MSC_ParticleLibrary, 0, "Particle effect (%s)", effectName);
 
-	if (gEnv->pCryPak->IsFileExist(effectName))
-	{
-		PParticleEffect pEffect = CreateEffect();
-		RenameEffect(pEffect, effectName);
-		if (Serialization::LoadJsonFile(*CastEffect(pEffect), effectName))
-			return pEffect;
-	}
+	PParticleEffect pEffect = CreateEffect();
+	RenameEffect(pEffect, effectName);
+	if (ReadEffect(*CastEffect(pEffect), effectName))
+		return pEffect;
 
 	m_effects[effectName] = _smart_ptr<CParticleEffect>();
 	return PParticleEffect();
 }
 
+// Binary copy of an effect, saved next to the .pfx as .pfxb. The version rejects caches of older documents.
+struct SBinaryEffect
+{
+	SBinaryEffect(CParticleEffect& effect) : m_effect(effect), m_version(gCurrentVersion) {}
+
+	void Serialize(Serialization::IArchive& ar)
+	{
+		ar(m_version, "Version");
+		if (m_version == gCurrentVersion)
+			ar(m_effect, "Effect");
+	}
+
+	CParticleEffect& m_effect;
+	uint             m_version;
+};
+
+bool CParticleSystem::ReadEffect(CParticleEffect& effect, cstr effectName)
+{
+	// The editor saves the .pfx only, its .pfxb would be out of date
+	const int binaryCache = gEnv->IsEditor() ? 0 : GetCVars()->e_ParticlesBinaryCache;
+	const string binaryName = PathUtil::ReplaceExtension(effectName, "pfxb");
+	if (binaryCache && gEnv->pCryPak->IsFileExist(binaryName))
+	{
+		SBinaryEffect binaryEffect(effect);
+		if (Serialization::LoadBinaryFile(binaryEffect, binaryName) && binaryEffect.m_version == gCurrentVersion)
+			return true;
+	}
+
+	if (!gEnv->pCryPak->IsFileExist(effectName) || !Serialization::LoadJsonFile(effect, effectName))
+		return false;
+
+	if (binaryCache == 2)
+	{
+		SBinaryEffect binaryEffect(effect);
+		Serialization::SaveBinaryFile(binaryName, binaryEffect);
+	}
+	return true;
+}
+
 const SParticleFeatureParams* CParticleSystem::GetDefaultFeatureParam(EFeatureType type)
 {
 	for (const auto& feature : GetFeatureParams())
@@ -366,6 +631,15 @@ void CParticleSystem::GetStats(SParticleStats& stats)
 
 void CParticleSystem::GetMemoryUsage(ICrySizer* pSizer) const
 {
+	{
+		SIZER_COMPONENT_NAME(pSizer, "Emitters");
+		for (auto& pEmitter : m_emitters)
+			pEmitter->GetMemoryUsage(pSizer);
+	}
+	{
+		SIZER_COMPONENT_NAME(pSizer, "StreamPoolOverhead");
+		CParticleStreamPool::Get().GetMemoryUsage(pSizer);
+	}
 }
 
 ILINE CParticleEffect* CParticleSystem::CastEffect(const PParticleEffect& pEffect) const
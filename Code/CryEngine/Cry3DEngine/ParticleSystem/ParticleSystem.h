@@ -33,12 +33,22 @@ private:
 	typedef std::vector<_smart_ptr<CParticleEmitter>>                                                                     TParticleEmitters;
 	typedef std::unordered_map<string, _smart_ptr<CParticleEffect>, stl::hash_stricmp<string>, stl::hash_stricmp<string>> TEffectNameMap;
 
+	struct SEffectLoad
+	{
+		SEffectLoad(CParticleEffect* pEffect) : m_pEffect(pEffect), m_loaded(false) {}
+		_smart_ptr<CParticleEffect> m_pEffect;
+		JobManager::SJobState       m_state;
+		bool                        m_loaded;
+	};
+	typedef std::vector<std::unique_ptr<SEffectLoad>> TEffectLoads;
+
 public:
 	// IParticleSystem
 	PParticleEffect         CreateEffect() override;
 	PParticleEffect         ConvertEffect(const ::IParticleEffect* pOldEffect, bool bReplace) override;
 	void                    RenameEffect(PParticleEffect pEffect, cstr name) override;
 	PParticleEffect         FindEffect(cstr name, bool bAllowLoad = true) override;
+	PParticleEffect         PreloadEffect(cstr name) override;
 	PParticleEmitter        CreateEmitter(PParticleEffect pEffect) override;
 	uint                    GetNumFeatureParams() const override { return uint(GetFeatureParams().size()); }
 	SParticleFeatureParams& GetFeatureParam(uint featureIdx) const override { return GetFeatureParams()[featureIdx]; }
@@ -55,6 +65,7 @@ public:
 	// ~IParticleSystem
 
 	PParticleEffect      LoadEffect(cstr effectName);
+	void                 Job_LoadEffect(SEffectLoad* pLoad);
 	TParticleHeap&       GetMemHeap(uint32 threadId = ~0) { return m_memHeap[threadId + 1]; }
 	CParticleJobManager& GetJobManager()                  { return m_jobManager; }
 	CParticleProfiler&   GetProfiler()                    { return m_profiler; }
@@ -79,6 +90,9 @@ private:
 	void              UpdateGpuRuntimesForEmitter(CParticleEmitter* pEmitter);
 	void              TrimEmitters();
 	void              InvalidateCachedRenderObjects();
+	void              CullEmitters(const CCamera& camera);
+	void              FinishEffectLoads(const CParticleEffect* pWaitForEffect, bool waitForAll);
+	static bool       ReadEffect(CParticleEffect& effect, cstr effectName);
 	CParticleEffect*  CastEffect(const PParticleEffect& pEffect) const;
 	CParticleEmitter* CastEmitter(const PParticleEmitter& pEmitter) const;
 
@@ -86,6 +100,27 @@ private:
 	string ConvertPfx1Name(cstr oldEffectName);
 	// ~PFX1 to PFX2
 
+#if !defined(_RELEASE)
+	struct SCollisionBenchmark
+	{
+		std::vector<PParticleEmitter> m_emitters;
+		int                           m_frame = 0;
+		int                           m_prevBatch = 0;
+		float                         m_updateTime[2] = {};
+		uint                          m_particles[2] = {};
+		uint                          m_queuedRays = 0;
+		uint                          m_hits = 0;
+	};
+	void UpdateCollisionBenchmark();
+#endif
+
+	struct SCullEntry
+	{
+		uint64 m_cell;
+		uint   m_emitterIdx;
+		bool operator<(const SCullEntry& other) const { return m_cell < other.m_cell; }
+	};
+
 private:
 	SParticleStats             m_statsCPU;
 	SParticleStats             m_statsGPU;
@@ -95,11 +130,16 @@ private:
 	TParticleEmitters          m_emitters;
 	TParticleEmitters          m_newEmitters;
 	std::vector<TParticleHeap> m_memHeap;
+	std::vector<SCullEntry>    m_cullEntries;
+	TEffectLoads               m_effectLoads;
 	_smart_ptr<IMaterial>      m_pFlareMaterial;
 	QuatT                      m_lastCameraPose = ZERO;
 	QuatT                      m_cameraMotion = ZERO;
 	uint                       m_nextEmitterId;
 	int32                      m_lastSysSpec;
+#if !defined(_RELEASE)
+	SCollisionBenchmark        m_collisionBenchmark;
+#endif
 };
 
 ILINE CParticleSystem*               GetPSystem()
@@ -262,6 +262,27 @@ CRY_UNIT_TEST_SUITE(CryParticleSystemTest)
 		CRY_PFX2_UNIT_TEST_ASSERT(result);
 	}
 
+	CRY_UNIT_TEST(CParticleContainer_StreamPool)
+	{
+		pfx2::CParticleStreamPool pool;
+		void* pData0 = pool.Allocate(1000);
+		CRY_PFX2_UNIT_TEST_ASSERT(pool.GetStats().m_requested == 1000);
+		CRY_PFX2_UNIT_TEST_ASSERT(pool.GetStats().m_used == 1024);
+
+		// a freed block is reused by the next allocation of the same size class
+		pool.Free(pData0, 1000);
+		CRY_PFX2_UNIT_TEST_ASSERT(pool.GetStats().m_used == 0);
+		void* pData1 = pool.Allocate(600);
+		CRY_PFX2_UNIT_TEST_ASSERT(pData1 == pData0);
+		CRY_PFX2_UNIT_TEST_ASSERT(static_cast<uint8*>(pData1)[599] == 0);
+		CRY_PFX2_UNIT_TEST_ASSERT(pool.GetStats().m_cached == 0);
+		CRY_PFX2_UNIT_TEST_ASSERT(pool.GetStats().m_peak == 1024);
+
+		pool.Free(pData1, 600);
+		pool.ReleaseCache();
+		CRY_PFX2_UNIT_TEST_ASSERT(pool.GetStats().m_cached == 0);
+	}
+
 	CRY_UNIT_TEST_FIXTURE(CParticleEffectTests)
 	{
 	public:
@@ -396,6 +417,27 @@ CRY_UNIT_TEST_SUITE(CryParticleSystemTest)
 		CRY_PFX2_UNIT_TEST_ASSERT(All(got == expected));
 	}
 
+	CRY_UNIT_TEST(ParticleSplineBakeTest)
+	{
+		CParticleSpline spline;
+		CRY_PFX2_UNIT_TEST_ASSERT(spline.FromString("0,0;0.3,1;0.6,0.25;1,0.8"));
+
+		const float maxError = 0.002f;
+		CParticleSpline baked = spline;
+		CRY_PFX2_UNIT_TEST_ASSERT(baked.Bake(maxError));
+		CRY_PFX2_UNIT_TEST_ASSERT(baked.IsBaked() && !spline.IsBaked());
+
+		// the error is measured at quarter steps while baking, leave some slack in between
+		const float tolerance = maxError * spline.GetValueRange().Length() * 2.0f;
+		for (uint i = 0; i <= 64; ++i)
+		{
+			const floatv time = ToFloatv(float(i) / 64.0f * 1.2f - 0.1f);
+			const float exact = get_element<0>(spline.Interpolate(time));
+			const float lut = get_element<0>(baked.Interpolate(time));
+			CRY_PFX2_UNIT_TEST_ASSERT(abs(exact - lut) <= tolerance);
+		}
+	}
+
 #endif
 
 }
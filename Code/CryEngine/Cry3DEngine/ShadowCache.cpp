@@ -36,6 +36,12 @@ void ShadowCache::InitShadowFrustum(ShadowMapFrustumPtr& pFr, int nLod, int nFir
 		}
 	}
 
+	if (nUpdateStrategy == ShadowMapFrustum::ShadowCacheData::eIncrementalUpdate &&
+	    pFr->pShadowCacheData->mDirtyRegions.size() > ShadowMapFrustum::ShadowCacheData::MAX_DIRTY_REGIONS)
+	{
+		nUpdateStrategy = ShadowMapFrustum::ShadowCacheData::eFullUpdateTimesliced;
+	}
+
 	AABB projectionBoundsLS(AABB::RESET);
 	const int nTexRes = GetRenderer()->GetCachedShadowsResolution()[nLod - nFirstStaticLod];
 
@@ -113,6 +119,9 @@ void ShadowCache::InitCachedFrustum(ShadowMapFrustumPtr& pFr, ShadowMapFrustum::
 		pFr->fBlurS = pFr->fBlurT = 0.0f;
 	}
 
+	if (nUpdateStrategy == ShadowMapFrustum::ShadowCacheData::eIncrementalUpdate)
+		InvalidateDirtyRegions(pFr, passInfo);
+
 	const bool bExcludeDynamicDistanceShadows = GetCVars()->e_DynamicDistanceShadows != 0;
 	const bool bUseCastersHull = (nUpdateStrategy == ShadowMapFrustum::ShadowCacheData::eFullUpdateTimesliced);
 	const int maxNodesPerFrame = (nUpdateStrategy == ShadowMapFrustum::ShadowCacheData::eIncrementalUpdate)
@@ -130,6 +139,76 @@ void ShadowCache::InitCachedFrustum(ShadowMapFrustumPtr& pFr, ShadowMapFrustum::
 	pFr->bIncrementalUpdate = nUpdateStrategy == ShadowMapFrustum::ShadowCacheData::eIncrementalUpdate && !pFr->pShadowCacheData->mProcessedCasters.empty();
 }
 
+void ShadowCache::InvalidateDirtyRegions(ShadowMapFrustum* pFr, const SRenderingPassInfo& passInfo)
+{
+	FUNCTION_PROFILER_3DENGINE;
+
+	ShadowMapFrustum::ShadowCacheData& cacheData = *pFr->pShadowCacheData;
+	if (cacheData.mDirtyRegions.empty())
+		return;
+
+	// the renderer clears whole tiles along the light direction, so every caster whose light space
+	// footprint overlaps a dirty region grown by one tile has to be rendered again
+	const Matrix34 matView = pFr->m_eFrustumType == ShadowMapFrustum::e_HeightMapAO
+	                         ? Matrix34(IDENTITY) // top down view
+	                         : Matrix34(GetViewMatrix(passInfo).GetTransposed());
+	const AABB frustumBoxLS = AABB::CreateTransformedAABB(matView, pFr->aabbCasters);
+	const float fTileSizeLS = max(frustumBoxLS.GetSize().x, frustumBoxLS.GetSize().y) * ShadowMapFrustum::ShadowCacheData::DIRTY_REGION_TILE_SIZE / max(pFr->nTexSize, 1);
+
+	PodArray<AABB> dirtyRegionsLS;
+	for (const AABB& dirtyRegion : cacheData.mDirtyRegions)
+	{
+		if (!Overlap::AABB_AABB(dirtyRegion, pFr->aabbCasters))
+			continue;
+
+		AABB regionLS = AABB::CreateTransformedAABB(matView, dirtyRegion);
+		regionLS.Expand(Vec3(fTileSizeLS, fTileSizeLS, 0.0f));
+		dirtyRegionsLS.Add(regionLS);
+		pFr->dirtyRegions.push_back(dirtyRegion);
+	}
+	cacheData.mDirtyRegions.clear();
+
+	if (dirtyRegionsLS.IsEmpty())
+		return;
+
+	auto overlapsDirtyRegion = [&](const AABB& boxWS)
+	{
+		const AABB boxLS = AABB::CreateTransformedAABB(matView, boxWS);
+		for (int i = 0; i < dirtyRegionsLS.Count(); ++i)
+		{
+			if (Overlap::AABB_AABB2D(boxLS, dirtyRegionsLS[i]))
+				return true;
+		}
+		return false;
+	};
+
+	for (auto it = cacheData.mProcessedCasters.begin(); it != cacheData.mProcessedCasters.end(); )
+	{
+		AABB casterBox;
+		(*it)->FillBBox(casterBox);
+
+		if (overlapsDirtyRegion(casterBox))
+			it = cacheData.mProcessedCasters.erase(it);
+		else
+			++it;
+	}
+
+	if (!cacheData.mProcessedTerrainCasters.empty())
+	{
+		PodArray<CTerrainNode*> lstTerrainNodes;
+		GetTerrain()->IntersectWithBox(pFr->aabbCasters, &lstTerrainNodes, GetDefSID());
+
+		for (int s = 0; s < lstTerrainNodes.Count(); s++)
+		{
+			CTerrainNode* pNode = lstTerrainNodes[s];
+
+			int nLod = pNode->GetAreaLOD(passInfo);
+			if (nLod != MML_NOT_SET && overlapsDirtyRegion(pNode->GetBBox()))
+				cacheData.mProcessedTerrainCasters.erase(HashTerrainNode(pNode, nLod));
+		}
+	}
+}
+
 void ShadowCache::InitHeightMapAOFrustum(ShadowMapFrustumPtr& pFr, int nLod, const SRenderingPassInfo& passInfo)
 {
 	FUNCTION_PROFILER_3DENGINE;
@@ -24,6 +24,7 @@ private:
 
 	void         InitCachedFrustum(ShadowMapFrustumPtr& pFr, ShadowMapFrustum::ShadowCacheData::eUpdateStrategy nUpdateStrategy, int nLod, int nTexSize, const Vec3& vLightPos, const AABB& projectionBoundsLS, const SRenderingPassInfo& passInfo);
 	void         AddTerrainCastersToFrustum(ShadowMapFrustum* pFr, const SRenderingPassInfo& passInfo);
+	void         InvalidateDirtyRegions(ShadowMapFrustum* pFr, const SRenderingPassInfo& passInfo);
 
 	void         GetCasterBox(AABB& BBoxWS, AABB& BBoxLS, float fRadius, const Matrix34& matView, const SRenderingPassInfo& passInfo);
 	Matrix44     GetViewMatrix(const SRenderingPassInfo& passInfo);
@@ -162,7 +162,7 @@ CStatObj* CStatObj::LoadLowLODS_Load(int nLodLevel, bool bUseStreaming, unsigned
 	// try to load
 	bool bRes = false;
 
-	pLodStatObj = stl::find_in_map(m_pObjManager->m_nameToObjectMap, CONST_TEMP_STRING(sLodFileName), NULL);
+	pLodStatObj = m_pObjManager->m_nameToObjectRegistry.Find(sLodFileName);
 
 	if (pLodStatObj)
 	{
@@ -175,6 +175,7 @@ CStatObj* CStatObj::LoadLowLODS_Load(int nLodLevel, bool bUseStreaming, unsigned
 		{
 			m_pObjManager->m_lstLoadedObjects.erase(it);
 			m_pObjManager->m_nameToObjectMap.erase(CONST_TEMP_STRING(sLodFileName));
+			m_pObjManager->m_nameToObjectRegistry.Erase(sLodFileName);
 		}
 	}
 	else if (pData || IsValidFile(sLodFileName))
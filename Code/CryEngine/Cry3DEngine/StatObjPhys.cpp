@@ -186,6 +186,8 @@ bool CStatObj::PhysicalizeGeomType(int nGeomType, CMesh& mesh, float tolerance,
 		int flags = mesh_multicontact1;
 		//float tol = 0.05f;
 		flags |= indices.size() <= SMALL_MESH_NUM_INDEX ? mesh_SingleBB : mesh_OBB | mesh_AABB;
+		if (GetCVars()->e_PhysAABBSAH && !(flags & mesh_SingleBB))
+			flags |= mesh_AABB_SAH;
 		flags |= mesh_approx_box | mesh_approx_sphere | mesh_approx_cylinder | mesh_approx_capsule;
 		flags |= mesh_shared_foreign_idx; // when this flags is set and pForeignIdx is 0, the physics assumes an array of fidx[i]==i
 
@@ -47,7 +47,8 @@ void CStatObj::Render(const SRendParams& rParams, const SRenderingPassInfo& pass
 	FillRenderObject(rParams, rParams.pRenderNode, m_pMaterial, NULL, pObj, passInfo);
 
 #ifdef SEG_WORLD
-	if (GetISystem()->GetIConsole()->GetCVar("sw_debugInfo")->GetIVal() == 4)
+	static CVarHandle<int> s_swDebugInfo("sw_debugInfo");
+	if (s_swDebugInfo.Get() == 4)
 	{
 		//////////////////////////////////////////////////////////////////////////
 		// Show colored sw object.
@@ -1028,7 +1029,8 @@ void CStatObj::RenderInternal(CRenderObject* pRenderObject, hidemask nSubObjectH
 	}
 
 #ifdef SEG_WORLD
-	if (GetISystem()->GetIConsole()->GetCVar("sw_debugInfo")->GetIVal() == 4)
+	static CVarHandle<int> s_swDebugInfo("sw_debugInfo");
+	if (s_swDebugInfo.Get() == 4)
 	{
 		pRenderObject->m_ObjFlags |= FOB_SELECTED;
 	}
@@ -236,6 +236,7 @@ int CVisArea::LoadHeader_T(T*& f, int& nDataSizeLeft, EEndian eEndian, int& objB
 	m_vAmbientColor = chunk.vAmbColor;
 	m_fViewDistRatio = chunk.fViewDistRatio;
 	m_fPortalBlending = chunk.fPortalBlending;
+	InvalidatePortalQuads();
 
 	if (chunk.dwFlags == uint32(-1))
 		chunk.dwFlags = 0;
@@ -971,6 +971,8 @@ void CVisAreaManager::UpdateVisArea(CVisArea* pArea, const Vec3* pPoints, int nC
 
 void CVisAreaManager::UpdateConnections()
 {
+	CVisArea::InvalidatePortalQuads();
+
 	// Reset connectivity
 	for (int p = 0; p < m_lstPortals.Count(); p++)
 		m_lstPortals[p]->m_lstConnections.Clear();
@@ -26,6 +26,7 @@ PodArray<CTerrainNode*> CVisArea::s_tmpLstTerrainNodeResult;
 CPolygonClipContext CVisArea::s_tmpClipContext;
 PodArray<CCamera> CVisArea::s_tmpCameras;
 int CVisArea::s_nGetDistanceThruVisAreasCallCounter = 0;
+int CVisArea::s_nPortalQuadsRevision = 0;
 
 void CVisArea::Update(const Vec3* pPoints, int nCount, const char* szName, const SVisAreaInfo& info)
 {
@@ -70,6 +71,7 @@ void CVisArea::Update(const Vec3* pPoints, int nCount, const char* szName, const
 
 	UpdateGeometryBBox();
 	UpdateClipVolume();
+	InvalidatePortalQuads();
 }
 
 void CVisArea::StaticReset()
@@ -314,6 +316,88 @@ void CVisArea::UpdatePortalCameraPlanes(CCamera& cam, Vec3* pVerts, bool NotForc
 	}
 }
 
+bool CVisArea::ComputeBasicPortalQuad(CVisArea* pParent, Vec3* pVerts, Vec3* pVertsOtherSide)
+{
+	Vec3 arrInAreaPoint[2] = { Vec3(0, 0, 0), Vec3(0, 0, 0) };
+	int arrInAreaPointId[2] = { -1, -1 };
+	int nInAreaPointCounter = 0;
+
+	Vec3 arrOutAreaPoint[2] = { Vec3(0, 0, 0), Vec3(0, 0, 0) };
+	int nOutAreaPointCounter = 0;
+
+	// find 2 points of portal in this area (or in this outdoors) and 2 points not in this area (or not in this outdoors)
+	CVisArea* pAnotherArea = m_lstConnections[0];
+	for (int i = 0; i < m_lstShapePoints.Count() && (nInAreaPointCounter < 2 || nOutAreaPointCounter < 2); i++)
+	{
+		Vec3 vTestPoint = m_lstShapePoints[i] + Vec3(0, 0, m_fHeight * 0.5f);
+		if ((pParent && (pParent->IsPointInsideVisArea(vTestPoint))) ||
+		    (!pParent && (!pAnotherArea->IsPointInsideVisArea(vTestPoint))))
+		{
+			if (nInAreaPointCounter < 2)
+			{
+				arrInAreaPointId[nInAreaPointCounter] = i;
+				arrInAreaPoint[nInAreaPointCounter++] = m_lstShapePoints[i];
+			}
+		}
+		else if (nOutAreaPointCounter < 2)
+		{
+			arrOutAreaPoint[nOutAreaPointCounter++] = m_lstShapePoints[i];
+		}
+	}
+
+	if (nInAreaPointCounter != 2)
+		return false;
+
+	// success, take into account volume and portal shape versts order
+	int nEven = IsShapeClockwise();
+	if (arrInAreaPointId[1] - arrInAreaPointId[0] != 1)
+		nEven = !nEven;
+
+	pVerts[0] = arrInAreaPoint[nEven];
+	pVerts[1] = arrInAreaPoint[nEven] + Vec3(0, 0, m_fHeight);
+	pVerts[2] = arrInAreaPoint[!nEven] + Vec3(0, 0, m_fHeight);
+	pVerts[3] = arrInAreaPoint[!nEven];
+
+	nEven = !nEven;
+
+	pVertsOtherSide[0] = arrOutAreaPoint[nEven];
+	pVertsOtherSide[1] = arrOutAreaPoint[nEven] + Vec3(0, 0, m_fHeight);
+	pVertsOtherSide[2] = arrOutAreaPoint[!nEven] + Vec3(0, 0, m_fHeight);
+	pVertsOtherSide[3] = arrOutAreaPoint[!nEven];
+
+	return true;
+}
+
+bool CVisArea::GetBasicPortalQuad(CVisArea* pParent, Vec3* pVerts, Vec3* pVertsOtherSide)
+{
+	// the face only depends on the shape and the side it's seen from, so it's cached per connection
+	// in the portal cold data until areas are edited, moved or reconnected
+	int nSlot = -1;
+	if (!pParent)
+		nSlot = 2;
+	else if (pParent == m_lstConnections[0])
+		nSlot = 0;
+	else if (m_lstConnections.Count() > 1 && pParent == m_lstConnections[1])
+		nSlot = 1;
+
+	if (nSlot < 0 || !m_pVisAreaColdData || m_pVisAreaColdData->m_dataType != eCDT_Portal || GetCVars()->e_PortalsQuadCache == 0)
+		return ComputeBasicPortalQuad(pParent, pVerts, pVertsOtherSide);
+
+	SPortalColdData::SPortalQuad& quad = static_cast<SPortalColdData*>(m_pVisAreaColdData)->m_arrPortalQuads[nSlot];
+	if (quad.nRevision != s_nPortalQuadsRevision)
+	{
+		quad.bValid = ComputeBasicPortalQuad(pParent, quad.arrVerts, quad.arrVertsOtherSide);
+		quad.nRevision = s_nPortalQuadsRevision;
+	}
+
+	if (!quad.bValid)
+		return false;
+
+	memcpy(pVerts, quad.arrVerts, sizeof(quad.arrVerts));
+	memcpy(pVertsOtherSide, quad.arrVertsOtherSide, sizeof(quad.arrVertsOtherSide));
+	return true;
+}
+
 int __cdecl CVisAreaManager__CmpDistToPortal(const void* v1, const void* v2);
 
 void        CVisArea::PreRender(int nReqursionLevel,
@@ -418,59 +502,8 @@ void        CVisArea::PreRender(int nReqursionLevel,
 		else if (!vPortNorm.IsEquivalent(Vec3(0, 0, 0), VEC_EPSILON) && vPortNorm.z == 0)
 		{
 			// basic portal
-			Vec3 arrInAreaPoint[2] = { Vec3(0, 0, 0), Vec3(0, 0, 0) };
-			int arrInAreaPointId[2] = { -1, -1 };
-			int nInAreaPointCounter = 0;
-
-			Vec3 arrOutAreaPoint[2] = { Vec3(0, 0, 0), Vec3(0, 0, 0) };
-			int nOutAreaPointCounter = 0;
-
-			// find 2 points of portal in this area (or in this outdoors)
-			for (int i = 0; i < m_lstShapePoints.Count() && nInAreaPointCounter < 2; i++)
-			{
-				Vec3 vTestPoint = m_lstShapePoints[i] + Vec3(0, 0, m_fHeight * 0.5f);
-				CVisArea* pAnotherArea = m_lstConnections[0];
-				if ((pParent && (pParent->IsPointInsideVisArea(vTestPoint))) ||
-				    (!pParent && (!pAnotherArea->IsPointInsideVisArea(vTestPoint))))
-				{
-					arrInAreaPointId[nInAreaPointCounter] = i;
-					arrInAreaPoint[nInAreaPointCounter++] = m_lstShapePoints[i];
-				}
-			}
-
-			// find 2 points of portal not in this area (or not in this outdoors)
-			for (int i = 0; i < m_lstShapePoints.Count() && nOutAreaPointCounter < 2; i++)
+			if (GetBasicPortalQuad(pParent, arrPortVerts, arrPortVertsOtherSide))
 			{
-				Vec3 vTestPoint = m_lstShapePoints[i] + Vec3(0, 0, m_fHeight * 0.5f);
-				CVisArea* pAnotherArea = m_lstConnections[0];
-				if ((pParent && (pParent->IsPointInsideVisArea(vTestPoint))) ||
-				    (!pParent && (!pAnotherArea->IsPointInsideVisArea(vTestPoint))))
-				{
-				}
-				else
-				{
-					arrOutAreaPoint[nOutAreaPointCounter++] = m_lstShapePoints[i];
-				}
-			}
-
-			if (nInAreaPointCounter == 2)
-			{
-				// success, take into account volume and portal shape versts order
-				int nEven = IsShapeClockwise();
-				if (arrInAreaPointId[1] - arrInAreaPointId[0] != 1)
-					nEven = !nEven;
-
-				arrPortVerts[0] = arrInAreaPoint[nEven];
-				arrPortVerts[1] = arrInAreaPoint[nEven] + Vec3(0, 0, m_fHeight);
-				arrPortVerts[2] = arrInAreaPoint[!nEven] + Vec3(0, 0, m_fHeight);
-				arrPortVerts[3] = arrInAreaPoint[!nEven];
-
-				nEven = !nEven;
-
-				arrPortVertsOtherSide[0] = arrOutAreaPoint[nEven];
-				arrPortVertsOtherSide[1] = arrOutAreaPoint[nEven] + Vec3(0, 0, m_fHeight);
-				arrPortVertsOtherSide[2] = arrOutAreaPoint[!nEven] + Vec3(0, 0, m_fHeight);
-				arrPortVertsOtherSide[3] = arrOutAreaPoint[!nEven];
 				barrPortVertsOtherSideValid = true;
 			}
 			else
@@ -1029,6 +1062,7 @@ void CVisArea::OffsetPosition(const Vec3& delta)
 	}
 	if (m_pObjectsTree)
 		m_pObjectsTree->OffsetObjects(delta);
+	InvalidatePortalQuads();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -53,14 +53,32 @@ struct SPortalColdData : public SGenericColdData
 	SPortalColdData()
 	{
 		m_dataType = eCDT_Portal;
+		ResetPortalQuads();
 	}
 
 	ILINE void ResetPortalData()
 	{
 		m_dataType = eCDT_Portal;
+		ResetPortalQuads();
 	}
 
+	ILINE void ResetPortalQuads()
+	{
+		for (int i = 0; i < CRY_ARRAY_COUNT(m_arrPortalQuads); i++)
+			m_arrPortalQuads[i].nRevision = -1;
+	}
+
+	// Portal face as seen from one of the two connected areas (or from outdoors), see CVisArea::GetBasicPortalQuad
+	struct SPortalQuad
+	{
+		Vec3 arrVerts[4];
+		Vec3 arrVertsOtherSide[4];
+		int  nRevision;
+		bool bValid;
+	};
+
 	OcclusionTestClient m_occlusionTestClient;
+	SPortalQuad         m_arrPortalQuads[3];
 };
 
 struct CVisArea : public IVisArea, public CBasicArea
@@ -93,6 +111,9 @@ struct CVisArea : public IVisArea, public CBasicArea
 	Vec3                    GetConnectionNormal(CVisArea* pPortal);
 	void                    PreRender(int nReqursionLevel, CCamera CurCamera, CVisArea* pParent, CVisArea* pCurPortal, bool* pbOutdoorVisible, PodArray<CCamera>* plstOutPortCameras, bool* pbSkyVisible, bool* pbOceanVisible, PodArray<CVisArea*>& lstVisibleAreas, const SRenderingPassInfo& passInfo);
 	void                    UpdatePortalCameraPlanes(CCamera& cam, Vec3* pVerts, bool bMergeFrustums, const SRenderingPassInfo& passInfo);
+	bool                    GetBasicPortalQuad(CVisArea* pParent, Vec3* pVerts, Vec3* pVertsOtherSide);
+	bool                    ComputeBasicPortalQuad(CVisArea* pParent, Vec3* pVerts, Vec3* pVertsOtherSide);
+	static void             InvalidatePortalQuads() { ++s_nPortalQuadsRevision; }
 	int                     GetVisAreaConnections(IVisArea** pAreas, int nMaxConnNum, bool bSkipDisabledPortals = false);
 	int                     GetRealConnections(IVisArea** pAreas, int nMaxConnNum, bool bSkipDisabledPortals = false);
 	bool                    IsPortalValid();
@@ -156,6 +177,7 @@ struct CVisArea : public IVisArea, public CBasicArea
 	static CPolygonClipContext     s_tmpClipContext;
 	static PodArray<CCamera>       s_tmpCameras;
 	static int                     s_nGetDistanceThruVisAreasCallCounter;
+	static int                     s_nPortalQuadsRevision;
 
 	VisAreaGUID                    m_nVisGUID;
 	PodArray<CVisArea*>            m_lstConnections;
@@ -206,6 +206,48 @@ void CVars::Init()
 	REGISTER_CVAR(e_ParticlesSortQuality, 1, VF_NULL,
 	              "Minimum sort quality for new particle insertion:\n"
 	              "  0 = basic, 1 = better, 2 = best");
+	REGISTER_CVAR(e_ParticlesAVX2, 1, VF_NULL,
+	              "Use the 8 wide AVX2 kernels for particle age update and linear motion if the CPU supports them");
+	REGISTER_CVAR(e_ParticlesBudgetMs, 0.0f, VF_NULL,
+	              "Worker time budget in ms for updating pfx2 particles per frame, 0 = no limit\n"
+	              "Emitters with the least screen coverage are degraded first when over budget:\n"
+	              "  skipped collisions, then half spawn rate, then updated every other frame");
+	REGISTER_CVAR(e_ParticlesBudgetCount, 0, VF_NULL,
+	              "Number of updated pfx2 particles per frame above which emitters are degraded as for e_ParticlesBudgetMs, 0 = no limit");
+	REGISTER_CVAR(e_ParticlesCollisionBatch, 0, VF_NULL,
+	              "Queue the collision rays of flying pfx2 particles to the physics instead of tracing them during the update.\n"
+	              "The hits are applied one frame later by moving the particles back out of the surface");
+	REGISTER_CVAR_DEV_ONLY(e_ParticlesCollisionBenchmark, 0, VF_NULL,
+	                       "Spawns the given number of emitters of e_ParticlesCollisionBenchmarkEffect in front of the camera\n"
+	                       "and logs the particle update time with e_ParticlesCollisionBatch 0 and 1");
+	e_ParticlesCollisionBenchmarkEffect = REGISTER_STRING("e_ParticlesCollisionBenchmarkEffect", "", VF_NULL,
+	                                                      "pfx2 effect used by e_ParticlesCollisionBenchmark, should emit colliding sparks");
+	REGISTER_CVAR(e_ParticlesCullOffscreen, 1, VF_NULL,
+	              "Skip the update of pfx2 emitters outside of the camera frustum that were not rendered last frame.\n"
+	              "Their time keeps advancing and is caught up in one step when they become visible or after e_ParticlesCullMaxSkipTime");
+	REGISTER_CVAR(e_ParticlesCullCellSize, 32.0f, VF_NULL,
+	              "Size in meters of the spatial hash cells used to cull the pfx2 emitters in bulk");
+	REGISTER_CVAR(e_ParticlesCullMaxSkipTime, 1.0f, VF_NULL,
+	              "Maximum time in seconds an off-screen pfx2 emitter goes without update");
+	REGISTER_CVAR(e_ParticlesSplineLUTError, 0.002f, VF_NULL,
+	              "Maximum error, relative to the value range, of the lookup tables baked for pfx2 curve modifiers\n"
+	              "when effects compile. 0 = always evaluate the curves exactly");
+	REGISTER_CVAR(e_ParticlesDeferredRenderJobs, 1, VF_NULL,
+	              "Render the mesh particles of each pfx2 component in its own job after the particle update,\n"
+	              "instead of serially on the main thread");
+	REGISTER_CVAR(e_ParticlesStreamPoolCacheKB, 16384, VF_NULL,
+	              "Maximum size in KB of the freed pfx2 particle data streams kept for reuse by other containers");
+	REGISTER_CVAR(e_ParticlesContainerShrinkFrames, 120, VF_NULL,
+	              "Number of updates a pfx2 container must use less than a quarter of its capacity before it shrinks, 0 = never shrink");
+	REGISTER_CVAR(e_ParticlesGpuAutoSelect, 0, VF_NULL,
+	              "Run pfx2 components rendering sprites on the GPU when all their features have a GPU implementation");
+	REGISTER_CVAR(e_ParticlesAsyncLoad, 1, VF_NULL,
+	              "Load the pfx2 effects requested with PreloadEffect in jobs, and compile them on the main thread once loaded");
+	REGISTER_CVAR(e_ParticlesBinaryCache, 1, VF_NULL,
+	              "Binary cache of pfx2 effects, .pfxb files next to the .pfx\n"
+	              "0 = always parse the .pfx\n"
+	              "1 = load the .pfxb when present\n"
+	              "2 = also write the .pfxb of every effect parsed from its .pfx");
 	REGISTER_CVAR(e_ParticlesPreload, 0, VF_NULL,
 	              "Enable preloading of all particle effects at the beginning");
 	REGISTER_CVAR(e_ParticlesAllowRuntimeLoad, 1, VF_NULL,
@@ -249,7 +291,8 @@ void CVars::Init()
 		          "Wavicle only:\n"
                   "1 - Display performance profiler on screen\n"
                   "2 - Display memory profiler on screen\n"
-		          "f - Output statistics to a csv file");
+		          "f - Output statistics to a csv file\n"
+		          "The on screen performance profiler also shows the timing of each feature type");
 	e_ParticlesProfilerOutputFolder = REGISTER_STRING("e_ParticlesProfilerOutputFolder", "%USER%/ParticlesProfiler/", VF_NULL,
 		"Folder to output particle profiler");
 	e_ParticlesProfilerOutputName = REGISTER_STRING("e_ParticlesProfilerOutputName", "frame", VF_NULL,
@@ -257,7 +300,10 @@ void CVars::Init()
 	REGISTER_CVAR(e_ParticlesProfilerCountBudget, 80000, VF_NULL,
 		"Particle counts budget to be shown during profiling");
 	REGISTER_CVAR(e_ParticlesProfilerTimingBudget, 10000, VF_NULL,
-		"Particle processing time budget (in nanoseconds) to be shown during profiling");
+		"Particle processing time budget (in microseconds) to be shown during profiling");
+	REGISTER_CVAR(e_ParticlesProfilerCapture, 0, VF_NULL,
+		"Wavicle only: capture the particle statistics of the given number of frames, including the time of every feature,\n"
+		"and save the averages per effect component to a csv and a json file in e_ParticlesProfilerOutputFolder");
 
 	REGISTER_CVAR(e_ParticlesForceSeed, 0, VF_NULL,
 		"0 - every emitter is random unless a seed is specified\n"
@@ -300,6 +346,9 @@ void CVars::Init()
 	                     "Less precision for decals outside this range");
 	REGISTER_CVAR(e_DecalsLifeTimeScale, 1.f, VF_NULL,
 	              "Allows to increase or reduce decals life time for different specs");
+	REGISTER_CVAR(e_DecalsActiveBudget, 448, VF_NULL,
+	              "Maximum number of active decals owned by the decal manager, the oldest decals above it fade out\n"
+	              "instead of popping when their slot gets reused. 0 = off");
 	REGISTER_CVAR(e_DecalsNeighborMaxLifeTime, 4.f, VF_NULL,
 	              "If not zero - new decals will force old decals to fade in X seconds");
 	REGISTER_CVAR(e_DecalsOverlapping, 0, VF_NULL,
@@ -396,6 +445,9 @@ void CVars::Init()
 	              "Trigger updates of the shadow cache: 0=no update, 1=one update, 2=continuous updates");
 	REGISTER_CVAR(e_ShadowsCacheObjectLod, 0, VF_NULL,
 	              "The lod used for rendering objects into the shadow cache. Set to -1 to disable");
+	REGISTER_CVAR(e_ShadowsCacheDirtyRegions, 1, VF_NULL,
+	              "Removed or moved shadow casters only invalidate the tiles of the shadow cache they covered.\n"
+	              "0=any modified caster triggers a full time sliced update of the cache, 1=re-render touched tiles only");
 	REGISTER_CVAR_CB(e_ShadowsCacheRenderCharacters, 0, VF_NULL,
 	                 "Render characters into the shadow cache. 0=disabled, 1=enabled", OnDynamicDistanceShadowsVarChange);
 	REGISTER_CVAR_CB(e_DynamicDistanceShadows, 1, VF_NULL,
@@ -446,6 +498,10 @@ void CVars::Init()
 	                     "View dist ratio for shadow maps casting for light sources");
 	REGISTER_CVAR(e_ShadowsCastViewDistRatio, 0.8f, VF_NULL,
 	              "View dist ratio for shadow maps casting from objects");
+	REGISTER_CVAR(e_ShadowsCastersJobs, 2, VF_NULL,
+	              "Gather shadow casters of octree subtrees in parallel jobs\n"
+	              "0 = gather on the calling thread\n"
+	              "N = every subtree N levels below the octree roots is gathered in its own job");
 	REGISTER_CVAR(e_GsmRange, 3.0f, VF_NULL,
 	              "Size of LOD 0 GSM area (in meters)");
 	REGISTER_CVAR(e_GsmRangeStep, 3.0f, VF_NULL,
@@ -511,6 +567,9 @@ void CVars::Init()
 	                   "Debug");
 	REGISTER_CVAR(e_TerrainTextureStreamingPoolItemsNum, 256, VF_REQUIRE_LEVEL_RELOAD,
 	              "Specifies number of textures in terrain base texture streaming pool");
+	REGISTER_CVAR(e_TerrainTextureStreamingAdaptiveLod, 1, VF_NULL,
+	              "Lower the terrain texture LOD while the requested tiles do not fit into the streaming pool,\n"
+	              "instead of evicting and reloading the same tiles every frame");
 	DefineConstIntCVar(e_TerrainDrawThisSectorOnly, 0, VF_CHEAT,
 	                   "1 - render only sector where camera is and objects registered in sector 00\n"
 	                   "2 - render only sector where camera is");
@@ -567,6 +626,14 @@ void CVars::Init()
 	              "  6 - Reprojection and occlusion meshes");
 	REGISTER_CVAR(e_CoverageBufferRastPolyLimit, 60000, VF_NULL,
 	              "maximum amount of polys to rasterize cap, 0 means no limit\ndefault is 500000");
+	REGISTER_CVAR(e_CoverageBufferRastAVX2, 1, VF_NULL,
+	              "Use the 8 wide AVX2 kernels for occluder rasterization and depth tests if the CPU supports them");
+	REGISTER_CVAR(e_CoverageBufferRastJobs, 4, VF_NULL,
+	              "Number of jobs rasterizing the occluders, each job rasterizes a band of lines of the coverage buffer\n"
+	              "1 rasterizes all occluders in the prepare job");
+	REGISTER_CVAR(e_CoverageBufferRastBenchmark, 0, VF_NULL,
+	              "Captures the current occluder set and rasterizes it the given number of times with each rasterizer\n"
+	              "implementation, reports triangles/ms to the log. Set to 0 and back to rerun with a new capture");
 	REGISTER_CVAR(e_CoverageBufferShowOccluder, 0, VF_NULL,
 	              "1 show only meshes used as occluder, 2 show only meshes not used as occluder");
 	REGISTER_CVAR(e_CoverageBufferOccludersViewDistRatio, 1.0f, VF_CHEAT,
@@ -593,6 +660,8 @@ void CVars::Init()
 	                   "Enables special processing of big entities like vehicles intersecting portals");
 	DefineConstIntCVar(e_PortalsBlend, 1, VF_CHEAT,
 	                   "Blend lights and cubemaps of vis areas connected to portals 0=off, 1=on");
+	DefineConstIntCVar(e_PortalsQuadCache, 1, VF_CHEAT,
+	                   "Cache the portal faces seen from each connected area instead of finding them every traversal 0=off, 1=on");
 	REGISTER_CVAR(e_PortalsMaxRecursion, 8, VF_NULL,
 	              "Maximum number of visareas and portals to traverse for indoor rendering");
 	REGISTER_CVAR(e_DynamicLightsMaxEntityLights, 16, VF_NULL,
@@ -655,6 +724,17 @@ void CVars::Init()
 	REGISTER_CVAR(e_StreamPredictionMaxVisAreaRecursion, 9, VF_CHEAT,
 	              "Maximum number visareas and portals to traverse.");
 	REGISTER_CVAR(e_StreamPredictionBoxRadius, 1, VF_CHEAT, "Radius of stream prediction box");
+	REGISTER_CVAR(e_StreamPredictionVelocity, 0, VF_CHEAT,
+	              "Request meshes along the path predicted from the camera velocity\n"
+	              " 0: Off, only the e_StreamPredictionAhead offset is used\n"
+	              " 1: Add e_StreamPredictionPathPoints cameras along the next e_StreamPredictionLookAheadTime seconds,\n"
+	              "    weighted by time to visibility and predicted screen size");
+	REGISTER_CVAR(e_StreamPredictionLookAheadTime, 2.f, VF_CHEAT,
+	              "Time in seconds the camera path is predicted ahead for e_StreamPredictionVelocity");
+	REGISTER_CVAR(e_StreamPredictionPathPoints, 2, VF_CHEAT,
+	              "Number of predicted cameras placed along the camera path (1..4)");
+	REGISTER_CVAR(e_StreamPredictionVelocityWindow, 0.5f, VF_CHEAT,
+	              "Time window in seconds of camera history used to estimate the camera velocity");
 	REGISTER_CVAR(e_StreamPredictionTexelDensity, 1, VF_CHEAT,
 	              "Use mesh texture mapping density info for textures streaming");
 	REGISTER_CVAR(e_StreamPredictionAlwaysIncludeOutside, 0, VF_CHEAT,
@@ -746,6 +826,9 @@ void CVars::Init()
 	                   "Enable engine rendering");
 	DefineConstIntCVar(e_ObjectsTreeBBoxes, 0, VF_CHEAT,
 	                   "Debug draw of object tree bboxes");
+	DefineConstIntCVar(e_ObjectsTreeFlatCulling, 1, VF_CHEAT,
+	                   "Cull the object tree nodes on a flattened copy of the tree, testing 4 nodes at once\n"
+	                   "0 = recursive traversal of the nodes, 1 = flattened traversal");
 	REGISTER_CVAR(e_ObjectsTreeNodeMinSize, 8.f, VF_CHEAT,
 	              "Controls objects tree balancing");
 	REGISTER_CVAR(e_ObjectsTreeNodeSizeRatio, 1.f / 8.f, VF_CHEAT,
@@ -776,6 +859,8 @@ void CVars::Init()
 	                   "Show instances count");
 	DefineConstIntCVar(e_ObjFastRegister, 1, VF_CHEAT,
 	                   "Debug");
+	DefineConstIntCVar(e_ObjBulkRegistration, 1, VF_CHEAT,
+	                   "Queue objects registered during batch creation (level load, paste, prefabs) and insert them into the octree in one sorted pass");
 
 	DefineConstIntCVar(e_OcclusionLazyHideFrames, 0, VF_CHEAT,
 	                   "Makes less occluson tests, but it takes more frames to detect invisible objects");
@@ -873,6 +958,9 @@ void CVars::Init()
 	              "Min size of cell in physical entity grid");
 	REGISTER_CVAR(e_PhysProxyTriLimit, 5000, VF_NULL,
 	              "Maximum allowed triangle count for phys proxies");
+	REGISTER_CVAR(e_PhysAABBSAH, 0, VF_NULL,
+	              "Build AABB trees of physicalized meshes with the surface area heuristic\n"
+	              "Slower to physicalize, cheaper ray and collision queries against large static meshes");
 	DefineConstIntCVar(e_PhysFoliage, 2, VF_NULL,
 	                   "Enables physicalized foliage\n"
 	                   "1 - only for dynamic objects\n"
@@ -1143,6 +1231,8 @@ void CVars::Init()
 	REGISTER_CVAR(e_MergedMeshesViewDistRatio, 30.f, VF_NULL, "merged meshes view dist ratio");
 	REGISTER_CVAR(e_MergedMeshesLodRatio, 3.f, VF_NULL, "merged meshes lod ratio");
 	REGISTER_CVAR(e_MergedMeshesDeformViewDistMod, 0.45f, VF_NULL, "distance modifier applied to view dist ratios after which deformables stop updating");
+	REGISTER_CVAR(e_MergedMeshesDeformUpdateDist, 10.f, VF_NULL,
+	              "Distance step after which the simulation of merged mesh patches without colliders runs one frame less often (up to every 4th frame), 0 updates every frame");
 	REGISTER_CVAR(e_MergedMeshesInstanceDist, 4.5f, VF_NULL, "Distance fudge factor at which merged meshes turn off animation");
 	REGISTER_CVAR(e_MergedMeshesActiveDist, 250.f, VF_NULL, "Active distance up until merged mesh patches will be streamed in");
 	REGISTER_CVAR(e_MergedMeshesUseSpines, 1, VF_NULL, "MergedMeshes use touchbending");
@@ -1165,8 +1255,14 @@ void CVars::Init()
 	              "Time in seconds maximum that data will be buffered ahead for geom cache streaming. Default: 5.0");
 	REGISTER_CVAR(e_GeomCacheDecodeAheadTime, 0.5f, VF_CHEAT,
 	              "Time in seconds that data will be decoded ahead for geom cache streaming. Default: 0.5");
+	REGISTER_CVAR(e_GeomCacheMaxReadAheadScale, 4.0f, VF_CHEAT,
+	              "Maximum scale of the buffer and decode ahead times of geom cache streams played faster than real time.\n"
+	              "The times are scaled by the measured playback speed of each stream. Default: 4.0");
 #ifndef _RELEASE
 	DefineConstIntCVar(e_GeomCacheDebug, 0, VF_CHEAT, "Show geometry cache debug overlay. Default: 0");
+	REGISTER_CVAR_DEV_ONLY(e_GeomCacheBenchmark, 0, VF_NULL,
+	                       "Plays all streaming geometry caches at 1x, 2x and scrubbing speed for the given number of seconds each\n"
+	                       "and reports the decode time, missed frames and stream aborts of each phase to the log");
 	e_GeomCacheDebugFilter = REGISTER_STRING("e_GeomCacheDebugFilter", "", VF_CHEAT, "Set name filter for e_geomCacheDebug");
 	DefineConstIntCVar(e_GeomCacheDebugDrawMode, 0, VF_CHEAT, "Geometry cache debug draw mode\n"
 	                                                          " 0 = normal\n"
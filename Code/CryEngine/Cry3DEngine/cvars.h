@@ -121,6 +121,7 @@ struct CVars : public Cry3DEngineBase
 
 	int    e_PermanentRenderObjects;
 	int    e_TerrainTextureStreamingPoolItemsNum;
+	int    e_TerrainTextureStreamingAdaptiveLod;
 	int    e_ParticlesPoolSize;
 	int    e_ParticlesVertexPoolSize;
 	int    e_ParticlesIndexPoolSize;
@@ -130,12 +131,14 @@ struct CVars : public Cry3DEngineBase
 	ICVar* e_ParticlesProfilerOutputName;
 	int    e_ParticlesProfilerCountBudget;
 	int    e_ParticlesProfilerTimingBudget;
+	int    e_ParticlesProfilerCapture;
 	int    e_ParticlesForceSeed;
 	float  e_VegetationSpritesDistanceRatio;
 	int    e_Decals;
 	int    e_DecalsAllowGameDecals;
 	DeclareConstFloatCVar(e_FoliageBrokenBranchesDamping);
 	float  e_ShadowsCastViewDistRatio;
+	int    e_ShadowsCastersJobs;
 	int    e_WaterTessellationAmountY;
 	float  e_OnDemandMaxSize;
 	float  e_MaxViewDistSpecLerp;
@@ -161,10 +164,14 @@ struct CVars : public Cry3DEngineBase
 	DeclareConstIntCVar(e_ShadowsTessellateDLights, 0);
 	int e_CoverageBufferReproj;
 	int e_CoverageBufferRastPolyLimit;
+	int e_CoverageBufferRastAVX2;
+	int e_CoverageBufferRastJobs;
+	int e_CoverageBufferRastBenchmark;
 	int e_CoverageBufferShowOccluder;
 	DeclareConstFloatCVar(e_ViewDistRatioPortals);
 	DeclareConstIntCVar(e_ParticlesLights, 1);
 	DeclareConstIntCVar(e_ObjFastRegister, 1);
+	DeclareConstIntCVar(e_ObjBulkRegistration, 1);
 	float  e_ViewDistRatioLights;
 	float  e_LightIlluminanceThreshold;
 	DeclareConstIntCVar(e_DebugDraw, 0);
@@ -178,6 +185,10 @@ struct CVars : public Cry3DEngineBase
 	DeclareConstIntCVar(e_AutoPrecacheTexturesAndShaders, 0);
 	int   e_StreamPredictionMaxVisAreaRecursion;
 	float e_StreamPredictionBoxRadius;
+	int   e_StreamPredictionVelocity;
+	float e_StreamPredictionLookAheadTime;
+	int   e_StreamPredictionPathPoints;
+	float e_StreamPredictionVelocityWindow;
 	int   e_Clouds;
 	int   e_VegetationBillboards;
 	int   e_VegetationUseTerrainColor;
@@ -188,11 +199,13 @@ struct CVars : public Cry3DEngineBase
 	DeclareConstFloatCVar(e_SunAngleSnapDot);
 	DeclareConstIntCVar(e_PreloadDecals, 1);
 	float e_DecalsLifeTimeScale;
+	int   e_DecalsActiveBudget;
 	int   e_DecalsForceDeferred;
 	DeclareConstIntCVar(e_CoverageBufferDebugFreeze, 0);
 	DeclareConstFloatCVar(e_TerrainLodRatioHolesMin);
 	DeclareConstIntCVar(e_TerrainOcclusionCulling, 1);
 	int    e_PhysProxyTriLimit;
+	int    e_PhysAABBSAH;
 	float  e_FoliageWindActivationDist;
 	ICVar* e_SQTestTextureName;
 	int    e_ShadowsClouds;
@@ -251,6 +264,7 @@ struct CVars : public Cry3DEngineBase
 	DeclareConstIntCVar(e_LightVolumesDebug, 0);
 	DeclareConstIntCVar(e_Portals, 1);
 	DeclareConstIntCVar(e_PortalsBlend, 1);
+	DeclareConstIntCVar(e_PortalsQuadCache, 1);
 	int   e_PortalsMaxRecursion;
 	float e_StreamAutoMipFactorMaxDVD;
 	DeclareConstIntCVar(e_CameraFreeze, 0);
@@ -334,6 +348,7 @@ struct CVars : public Cry3DEngineBase
 	float e_ObjectsTreeNodeSizeRatio;
 	DeclareConstIntCVar(e_CoverageBufferDrawOccluders, 0);
 	DeclareConstIntCVar(e_ObjectsTreeBBoxes, 0);
+	DeclareConstIntCVar(e_ObjectsTreeFlatCulling, 1);
 	DeclareConstIntCVar(e_PrepareDeformableObjectsAtLoadTime, 0);
 	DeclareConstIntCVar(e_3dEngineTempPoolSize, 1024);
 	DeclareConstFloatCVar(e_MaxViewDistFullDistCamHeight);
@@ -410,6 +425,7 @@ struct CVars : public Cry3DEngineBase
 	DeclareConstIntCVar(e_ShadowsMasksLimit, 0);
 	int   e_ShadowsCacheUpdate;
 	int   e_ShadowsCacheObjectLod;
+	int   e_ShadowsCacheDirtyRegions;
 	int   e_ShadowsCacheRenderCharacters;
 	int   e_ShadowsPerObject;
 	int   e_DynamicDistanceShadows;
@@ -441,6 +457,22 @@ struct CVars : public Cry3DEngineBase
 	int   e_ParticlesObjectCollisions;
 	int   e_ParticlesMinPhysicsDynamicBounds;
 	int   e_ParticlesSortQuality;
+	int   e_ParticlesAVX2;
+	float e_ParticlesBudgetMs;
+	int   e_ParticlesBudgetCount;
+	int   e_ParticlesCollisionBatch;
+	int   e_ParticlesCollisionBenchmark;
+	ICVar* e_ParticlesCollisionBenchmarkEffect;
+	int   e_ParticlesCullOffscreen;
+	float e_ParticlesCullCellSize;
+	float e_ParticlesCullMaxSkipTime;
+	float e_ParticlesSplineLUTError;
+	int   e_ParticlesDeferredRenderJobs;
+	int   e_ParticlesStreamPoolCacheKB;
+	int   e_ParticlesContainerShrinkFrames;
+	int   e_ParticlesGpuAutoSelect;
+	int   e_ParticlesAsyncLoad;
+	int   e_ParticlesBinaryCache;
 	DeclareConstIntCVar(e_Ropes, 1);
 	int   e_ShadowsPoolSize;
 	int   e_ShadowsMaxTexRes;
@@ -515,6 +547,7 @@ struct CVars : public Cry3DEngineBase
 	float  e_MergedMeshesInstanceDist;
 	float  e_MergedMeshesActiveDist;
 	float  e_MergedMeshesDeformViewDistMod;
+	float  e_MergedMeshesDeformUpdateDist;
 	int    e_MergedMeshesUseSpines;
 	float  e_MergedMeshesBulletSpeedFactor;
 	float  e_MergedMeshesBulletScale;
@@ -529,6 +562,8 @@ struct CVars : public Cry3DEngineBase
 	float  e_GeomCacheMinBufferAheadTime;
 	float  e_GeomCacheMaxBufferAheadTime;
 	float  e_GeomCacheDecodeAheadTime;
+	float  e_GeomCacheMaxReadAheadScale;
+	int    e_GeomCacheBenchmark;
 	DeclareConstIntCVar(e_GeomCacheDebug, 0);
 	ICVar* e_GeomCacheDebugFilter;
 	DeclareConstIntCVar(e_GeomCacheDebugDrawMode, 0);
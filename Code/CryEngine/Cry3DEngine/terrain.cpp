@@ -131,6 +131,7 @@ void CTerrain::ActivateNodeTexture(CTerrainNode* pNode, const SRenderingPassInfo
 		return;
 
 	pNode->m_nNodeTextureLastUsedSec4 = (uint16)(GetCurTimeSec() / 4.f);
+	pNode->m_nNodeTextureRequestFrameId = passInfo.GetMainFrameID();
 
 	if (m_lstActiveTextureNodes.Find(pNode) < 0)
 	{
@@ -149,6 +150,31 @@ void CTerrain::ActivateNodeProcObj(CTerrainNode* pNode)
 	}
 }
 
+void CTerrain::UpdateTextureStreamingLodScale(int nRequestedNodes)
+{
+	m_nTexStreamingRequestedNodes = nRequestedNodes;
+
+	if (!GetCVars()->e_TerrainTextureStreamingAdaptiveLod)
+	{
+		m_fTexStreamingLodScale = 1.f;
+		return;
+	}
+
+	// adjust a few times per second only, requests of the new LOD need some frames to settle
+	const float fCurTime = GetCurTimeSec();
+	if (fabs_tpl(fCurTime - m_fTexStreamingLodScaleUpdateTime) < 0.25f)
+		return;
+	m_fTexStreamingLodScaleUpdateTime = fCurTime;
+
+	// if the requested tiles don't fit into the pool (one item is kept free for loading) they are evicted and loaded
+	// again every frame, use coarser tiles until they fit. Go back slowly once there is enough space again
+	const int nPoolItems = m_texCache[0].GetPoolItemsNum() - 1;
+	if (nRequestedNodes > nPoolItems)
+		m_fTexStreamingLodScale = min(m_fTexStreamingLodScale * 1.25f, 8.f);
+	else if (nRequestedNodes < nPoolItems * 3 / 4)
+		m_fTexStreamingLodScale = max(m_fTexStreamingLodScale * 0.9f, 1.f);
+}
+
 int CTerrain::GetNotReadyTextureNodesCount()
 {
 	int nRes = 0;
@@ -214,9 +240,19 @@ void CTerrain::UpdateNodesIncrementaly(const SRenderingPassInfo& passInfo)
 		m_texCache[1].Update();
 		m_texCache[2].Update();
 
+		// nodes requested by the last frames are the tiles needed to texture the visible terrain
+		int nRequestedNodes = 0;
+
 		for (int i = 0; i < m_lstActiveTextureNodes.Count(); i++)
+		{
 			m_lstActiveTextureNodes[i]->UpdateDistance(passInfo);
 
+			if (m_lstActiveTextureNodes[i]->m_nNodeTextureRequestFrameId >= passInfo.GetMainFrameID() - 1)
+				nRequestedNodes++;
+		}
+
+		UpdateTextureStreamingLodScale(nRequestedNodes);
+
 		// sort by importance
 		qsort(m_lstActiveTextureNodes.GetElements(), m_lstActiveTextureNodes.Count(),
 		      sizeof(m_lstActiveTextureNodes[0]), CmpTerrainNodesImportance);
@@ -224,7 +260,13 @@ void CTerrain::UpdateNodesIncrementaly(const SRenderingPassInfo& passInfo)
 		// release unimportant textures and make sure at least one texture is free for possible loading
 		while (m_lstActiveTextureNodes.Count() > m_texCache[0].GetPoolItemsNum() - 1)
 		{
-			m_lstActiveTextureNodes.Last()->UnloadNodeTexture(false);
+			CTerrainNode* pEvictedNode = m_lstActiveTextureNodes.Last();
+			if (pEvictedNode->m_nNodeTexSet.nTex0)
+			{
+				pEvictedNode->m_fNodeTextureEvictTime = GetCurTimeSec();
+				m_nTexStreamingEvictions++;
+			}
+			pEvictedNode->UnloadNodeTexture(false);
 			m_lstActiveTextureNodes.DeleteLast();
 		}
 
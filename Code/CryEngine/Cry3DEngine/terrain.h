@@ -501,6 +501,10 @@ public:
 	int           GetNotReadyTextureNodesCount();
 	void          GetTextureCachesStatus(int& nCount0, int& nCount1)
 	{ nCount0 = m_texCache[0].GetPoolSize(); nCount1 = m_texCache[1].GetPoolSize(); }
+	void          GetTextureStreamingStats(int& nRequested, int& nLoads, int& nEvictions, int& nReloads)
+	{ nRequested = m_nTexStreamingRequestedNodes; nLoads = m_nTexStreamingLoads; nEvictions = m_nTexStreamingEvictions; nReloads = m_nTexStreamingReloads; }
+	float         GetTextureStreamingLodScale() const { return m_fTexStreamingLodScale; }
+	void          UpdateTextureStreamingLodScale(int nRequestedNodes);
 
 	void CheckVis(const SRenderingPassInfo& passInfo);
 	int  UpdateOcean(const SRenderingPassInfo& passInfo);
@@ -730,6 +734,14 @@ protected: // ------------------------------------------------------------------
 
 	CTextureCache m_texCache[3]; // RGB, Normal and Height
 
+	// texture streaming pressure, see UpdateTextureStreamingLodScale
+	float                     m_fTexStreamingLodScale;
+	float                     m_fTexStreamingLodScaleUpdateTime;
+	int                       m_nTexStreamingRequestedNodes;
+	int                       m_nTexStreamingLoads;
+	int                       m_nTexStreamingEvictions;
+	int                       m_nTexStreamingReloads; // tiles loaded again shortly after being evicted
+
 	EEndian                   m_eEndianOfTexture;
 
 	static bool               m_bOpenTerrainTextureFileNoLog;
@@ -34,6 +34,12 @@ CTerrain::CTerrain(const STerrainInfo& TerrainInfo)
 	//	ZeroStruct(m_SSurfaceType); // staic
 	m_pOcean = 0;
 	m_eEndianOfTexture = eLittleEndian;
+	m_fTexStreamingLodScale = 1.f;
+	m_fTexStreamingLodScaleUpdateTime = 0;
+	m_nTexStreamingRequestedNodes = 0;
+	m_nTexStreamingLoads = 0;
+	m_nTexStreamingEvictions = 0;
+	m_nTexStreamingReloads = 0;
 
 	// load default textures
 	m_nWhiteTexId = Get3DEngine()->GetWhiteTexID();
@@ -79,7 +79,7 @@ uint8 CTerrainNode::GetTextureLOD(float fDistance, const SRenderingPassInfo& pas
 		nMinLod++; // limit amount of texture data if in fall-back mode
 	}
 
-	uint8 cNodeNewTexMML = GetMML(int(fTexSizeK * 0.05f * (fDistance * passInfo.GetZoomFactor()) * GetFloatCVar(e_TerrainTextureLodRatio)), nMinLod,
+	uint8 cNodeNewTexMML = GetMML(int(fTexSizeK * 0.05f * (fDistance * passInfo.GetZoomFactor() * GetTerrain()->GetTextureStreamingLodScale()) * GetFloatCVar(e_TerrainTextureLodRatio)), nMinLod,
 	                              m_bMergeNotAllowed ? 0 : GetTerrain()->GetParentNode(m_nSID)->m_nTreeLevel);
 
 	return cNodeNewTexMML;
@@ -564,6 +564,8 @@ public:
 	SSectorTextureSet          m_nNodeTexSet, m_nTexSet; // texture id's
 
 	uint16                     m_nNodeTextureLastUsedSec4;
+	int                        m_nNodeTextureRequestFrameId;
+	float                      m_fNodeTextureEvictTime;
 	uint16                     m_nSID;
 
 	AABB                       m_boxHeigtmapLocal;
@@ -209,6 +209,10 @@ void CTerrainNode::StartSectorTexturesStreaming(bool bFinishNow)
 
 	m_eTexStreamingStatus = ecss_InProgress;
 
+	pT->m_nTexStreamingLoads++;
+	if (m_fNodeTextureEvictTime >= 0 && GetCurTimeSec() - m_fNodeTextureEvictTime < 2.f)
+		pT->m_nTexStreamingReloads++;
+
 	if (GetCVars()->e_TerrainTextureStreamingDebug == 2)
 		PrintMessage("CTerrainNode::StartSectorTexturesStreaming: sector %d, level=%d", GetSecIndex(), m_nTreeLevel);
 
@@ -797,6 +797,8 @@ void AIConsoleVars::Init()
 	DefineConstIntCVarName("ai_MNMPathfinderMT", MNMPathfinderMT, 1, VF_CHEAT | VF_CHEAT_NOCHECK, "Enable/Disable Multi Threading for the pathfinder.");
 	DefineConstIntCVarName("ai_MNMPathfinderConcurrentRequests", MNMPathfinderConcurrentRequests, 4, VF_CHEAT | VF_CHEAT_NOCHECK,
 	                       "Defines the amount of concurrent pathfinder requests that can be served at the same time.");
+	DefineConstIntCVarName("ai_MNMPathfinderIslandCheck", MNMPathfinderIslandCheck, 1, VF_CHEAT | VF_CHEAT_NOCHECK,
+	                       "Enable/Disable the island connectivity test, which completes requests between unconnected islands without running A* over the whole start island.");
 
 	DefineConstIntCVarName("ai_MNMRaycastImplementation", MNMRaycastImplementation, 2, VF_CHEAT | VF_CHEAT_NOCHECK,
 	                       "Defines which type of raycast implementation to use on the MNM meshes."
@@ -829,6 +831,8 @@ void AIConsoleVars::Init()
 
 	DefineConstIntCVarName("ai_VisionMapNumberOfPVSUpdatesPerFrame", VisionMapNumberOfPVSUpdatesPerFrame, 1, VF_CHEAT | VF_CHEAT_NOCHECK, "");
 	DefineConstIntCVarName("ai_VisionMapNumberOfVisibilityUpdatesPerFrame", VisionMapNumberOfVisibilityUpdatesPerFrame, 1, VF_CHEAT | VF_CHEAT_NOCHECK, "");
+	DefineConstIntCVarName("ai_VisionMapCacheStaticPairs", VisionMapCacheStaticPairs, 1, VF_CHEAT | VF_CHEAT_NOCHECK,
+	                       "Keep the visibility results of an observer when only its orientation, FOV or filters change, and only re-cast the rays when it moves.");
 
 	DefineConstIntCVarName("ai_DebugDrawVisionMap", DebugDrawVisionMap, 0, VF_CHEAT | VF_CHEAT_NOCHECK,
 	                       "Toggles the debug drawing of the AI VisionMap.");
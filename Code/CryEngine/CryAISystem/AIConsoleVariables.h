@@ -142,6 +142,7 @@ struct AIConsoleVars
 
 	DeclareConstIntCVar(MNMPathfinderMT, 1);
 	DeclareConstIntCVar(MNMPathfinderConcurrentRequests, 4);
+	DeclareConstIntCVar(MNMPathfinderIslandCheck, 1);
 	DeclareConstIntCVar(MNMRaycastImplementation, 2);
 
 	DeclareConstIntCVar(LogConsoleVerbosity, 0);
@@ -153,6 +154,7 @@ struct AIConsoleVars
 
 	DeclareConstIntCVar(VisionMapNumberOfPVSUpdatesPerFrame, 1);
 	DeclareConstIntCVar(VisionMapNumberOfVisibilityUpdatesPerFrame, 1);
+	DeclareConstIntCVar(VisionMapCacheStaticPairs, 1);
 
 	DeclareConstIntCVar(DebugDrawVisionMap, 0);
 	DeclareConstIntCVar(DebugDrawVisionMapStats, 1);
@@ -432,7 +432,32 @@ void CRecorderUnit::StreamStr::AddValue(const IAIRecordable::RecorderEventData*
 		GetOrMakeStringIndex(pEventData->pString);
 	}
 
-	m_Stream.push_back(new StreamUnit(t, pEventData->pString));
+	m_Stream.push_back(new StreamUnit(t, InternString(pEventData->pString)));
+}
+
+//
+//----------------------------------------------------------------------------------------------
+const string& CRecorderUnit::StreamStr::InternString(const char* szString)
+{
+	if (!szString)
+		szString = "";
+
+	const uint32 hash = CryStringUtils::HashString(szString);
+	std::pair<TInternedStrings::iterator, bool> result = m_InternedStrings.insert(TInternedStrings::value_type(hash, string()));
+	string& interned = result.first->second;
+
+	if (result.second)
+	{
+		interned = szString;
+	}
+	else if (interned != szString)
+	{
+		// Hash collision, keep the first string and store a new copy for this one
+		m_CollisionString = szString;
+		return m_CollisionString;
+	}
+
+	return interned;
 }
 
 //
@@ -497,6 +522,8 @@ void CRecorderUnit::StreamStr::Clear()
 
 	m_StrIndexLookup.clear();
 	m_uIndexGen = INVALID_INDEX;
+
+	m_InternedStrings.clear();
 }
 
 //
@@ -113,6 +113,7 @@ protected:
 		{
 			string m_String;
 			StreamUnit(float time, const char* pStr) : StreamUnitBase(time), m_String(pStr){}
+			StreamUnit(float time, const string& str) : StreamUnitBase(time), m_String(str){}
 		};
 		StreamStr(char const* name, bool bUseIndex = false);
 		bool  SaveStream(FILE* pFile);
@@ -134,6 +135,14 @@ protected:
 		uint32       GetOrMakeStringIndex(const char* szString);
 		bool         GetStringFromIndex(uint32 uIndex, string& sOut) const;
 
+		// Events mostly repeat the same few strings (goal pipes, signals...), share one ref-counted copy of each
+		// between all units of the stream instead of allocating a copy per recorded event
+		const string& InternString(const char* szString);
+
+		typedef std::unordered_map<uint32, string> TInternedStrings;
+		TInternedStrings m_InternedStrings;
+		string           m_CollisionString;
+
 		typedef std::unordered_map<string, uint32, stl::hash_strcmp<string>, stl::hash_strcmp<string>> TStrIndexLookup;
 		TStrIndexLookup m_StrIndexLookup;
 		uint32          m_uIndexGen;
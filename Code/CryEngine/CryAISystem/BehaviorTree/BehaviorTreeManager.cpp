@@ -193,7 +193,9 @@ bool BehaviorTreeManager::LoadBehaviorTreeTemplate(const char* behaviorTreeName,
 	}
 
 	LoadContext context(GetNodeFactory(), behaviorTreeName, behaviorTreeTemplate.variableDeclarations);
+	behaviorTreeTemplate.firstNodeID = m_nodeFactory->GetNextNodeID();
 	behaviorTreeTemplate.rootNode = XmlLoader().CreateBehaviorTreeRootNodeFromBehaviorTreeXml(behaviorTreeXmlNode, context);
+	behaviorTreeTemplate.endNodeID = m_nodeFactory->GetNextNodeID();
 
 	if (!behaviorTreeTemplate.rootNode)
 		return false;
@@ -283,6 +285,7 @@ void BehaviorTreeManager::StopAllBehaviorTreeInstances()
 		  , instance.behaviorLog
 #endif
 		  );
+		context.runtimeDataTable = &instance.runtimeDataTable;
 
 		instance.behaviorTreeTemplate->rootNode->Terminate(context);
 	}
@@ -368,6 +371,7 @@ void BehaviorTreeManager::StopModularBehaviorTree(const EntityId entityId)
 		  , instance.behaviorLog
 #endif
 		  );
+		context.runtimeDataTable = &instance.runtimeDataTable;
 
 		instance.behaviorTreeTemplate->rootNode->Terminate(context);
 		m_instances.erase(it);
@@ -420,6 +424,7 @@ void BehaviorTreeManager::Update()
 		  , &debugTree
 #endif // DEBUG_MODULAR_BEHAVIOR_TREE
 		  );
+		updateContext.runtimeDataTable = &instance.runtimeDataTable;
 
 		const Status behaviorStatus = instance.behaviorTreeTemplate->rootNode->Tick(updateContext);
 		const bool bExecutionError = (behaviorStatus == Success) || (behaviorStatus == Failure);
@@ -623,6 +628,7 @@ void BehaviorTreeManager::HandleEvent(const EntityId entityId, Event& event)
 		behaviorTreeInstance->behaviorTreeTemplate->signalHandler.ProcessSignal(event.GetCRC(), behaviorTreeInstance->variables);
 		behaviorTreeInstance->timestampCollection.HandleEvent(event.GetCRC());
 		BehaviorTree::EventContext context(entityId);
+		context.runtimeDataTable = &behaviorTreeInstance->runtimeDataTable;
 		behaviorTreeInstance->behaviorTreeTemplate->rootNode->SendEvent(context, event);
 #ifdef USING_BEHAVIOR_TREE_EVENT_DEBUGGING
 		behaviorTreeInstance->eventsLog.AddMessage(event.GetName());
@@ -0,0 +1,227 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "StdAfx.h"
+#include "BehaviorTreeManager.h"
+#include <CrySystem/CryUnitTest.h>
+
+#if defined(CRY_UNIT_TESTING)
+
+CRY_UNIT_TEST_SUITE(BehaviorTreeTick)
+{
+	using namespace BehaviorTree;
+
+	enum
+	{
+		kAgentCount   = 1000,
+		kFirstAgentId = 0x7f000000, // the nodes below never look the entity up, so the agents only need distinct ids
+	};
+
+	// an idle/alert switch over a few levels of running composites, like the top of a game tree
+	const char* k_treeXml =
+	  "<BehaviorTree>"
+	  "<Variables><Variable name='Alerted' default='false'/></Variables>"
+	  "<Root>"
+	  "<Priority>"
+	  "<Case condition='Alerted'><Loop><Sequence><Wait duration='0.5'/><Wait duration='1000'/></Sequence></Loop></Case>"
+	  "<Case><Loop><Sequence><Sequence><Sequence><Wait duration='1000'/></Sequence></Sequence><Wait duration='1'/></Sequence></Loop></Case>"
+	  "</Priority>"
+	  "</Root>"
+	  "</BehaviorTree>";
+
+	// nodes holding runtime data while the tree runs: Priority, Loop, Sequence(s) and the running Wait
+	const size_t k_idleRunningNodeCount = 6;
+	const size_t k_alertedRunningNodeCount = 4;
+
+	// one template shared by all agents, the way BehaviorTreeManager instantiates cached trees
+	struct SAgents
+	{
+		SAgents()
+			: pEntity(nullptr)
+		{
+			SEntitySpawnParams params;
+			params.sName = "BehaviorTreeTickAgent";
+			params.nFlags = ENTITY_FLAG_CLIENT_ONLY | ENTITY_FLAG_NO_SAVE;
+			params.pClass = gEnv->pEntitySystem->GetClassRegistry()->GetDefaultClass();
+			pEntity = gEnv->pEntitySystem->SpawnEntity(params);
+
+			XmlNodeRef xml = gEnv->pSystem->LoadXmlFromBuffer(k_treeXml, strlen(k_treeXml));
+			BehaviorTreeInstancePtr firstInstance = xml ? gAIEnv.pBehaviorTreeManager->CreateBehaviorTreeInstanceFromXml("UnitTestAgents", xml) : BehaviorTreeInstancePtr();
+			if (!firstInstance)
+				return;
+
+			pTemplate = firstInstance->behaviorTreeTemplate;
+			instances.push_back(firstInstance);
+			while (instances.size() < kAgentCount)
+			{
+				instances.push_back(BehaviorTreeInstancePtr(new BehaviorTreeInstance(
+				                                              pTemplate->defaultTimestampCollection,
+				                                              pTemplate->variableDeclarations.GetDefaults(),
+				                                              pTemplate,
+				                                              gAIEnv.pBehaviorTreeManager->GetNodeFactory())));
+			}
+		}
+
+		~SAgents()
+		{
+			if (!IsValid())
+				return;
+			// every agent is terminated the same way it was ticked
+			for (size_t i = 0; i < instances.size(); ++i)
+				Terminate(i, UsesTable(i));
+			gEnv->pEntitySystem->RemoveEntity(pEntity->GetId(), true);
+		}
+
+		bool IsValid() const { return pEntity && pTemplate; }
+
+		// set up by the tests, the instance's table has to be used for all its ticks or for none
+		bool UsesTable(size_t i) const { return i < usesTable.size() ? usesTable[i] : bUseTableForAll; }
+
+		Status Tick(size_t i, bool bUseTable)
+		{
+			BehaviorTreeInstance& instance = *instances[i];
+			BehaviorVariablesContext variables(instance.variables, pTemplate->variableDeclarations, instance.variables.Changed());
+			instance.variables.ResetChanged();
+
+			UpdateContext context(
+			  kFirstAgentId + (EntityId)i
+			  , *pEntity
+			  , variables
+			  , instance.timestampCollection
+			  , instance.blackboard
+#ifdef USING_BEHAVIOR_TREE_LOG
+			  , instance.behaviorLog
+#endif // USING_BEHAVIOR_TREE_LOG
+			  );
+			context.runtimeDataTable = bUseTable ? &instance.runtimeDataTable : NULL;
+
+			return pTemplate->rootNode->Tick(context);
+		}
+
+		void Terminate(size_t i, bool bUseTable)
+		{
+			BehaviorTreeInstance& instance = *instances[i];
+			BehaviorVariablesContext variables(instance.variables, pTemplate->variableDeclarations, instance.variables.Changed());
+
+			UpdateContext context(
+			  kFirstAgentId + (EntityId)i
+			  , *pEntity
+			  , variables
+			  , instance.timestampCollection
+			  , instance.blackboard
+#ifdef USING_BEHAVIOR_TREE_LOG
+			  , instance.behaviorLog
+#endif // USING_BEHAVIOR_TREE_LOG
+			  );
+			context.runtimeDataTable = bUseTable ? &instance.runtimeDataTable : NULL;
+
+			pTemplate->rootNode->Terminate(context);
+		}
+
+		size_t GetUsedSlotCount(size_t i) const
+		{
+			const std::vector<void*>& slots = instances[i]->runtimeDataTable.slots;
+			return slots.size() - (size_t)std::count(slots.begin(), slots.end(), (void*)NULL);
+		}
+
+		IEntity*                             pEntity;
+		BehaviorTreeTemplatePtr              pTemplate;
+		std::vector<BehaviorTreeInstancePtr> instances;
+		std::vector<bool>                    usesTable;
+		bool                                 bUseTableForAll = true;
+	};
+
+	CRY_UNIT_TEST(CUT_BehaviorTreeRuntimeDataTable)
+	{
+		INodeFactory& nodeFactory = gAIEnv.pBehaviorTreeManager->GetNodeFactory();
+		const size_t runtimeSizeBefore = nodeFactory.GetSizeOfRuntimeDataForAllAllocatedNodes();
+		{
+			SAgents agents;
+			CRY_UNIT_TEST_ASSERT(agents.IsValid());
+			CRY_UNIT_TEST_CHECK_EQUAL(agents.pTemplate->endNodeID - agents.pTemplate->firstNodeID, (NodeID)agents.instances[0]->runtimeDataTable.slots.size());
+			CRY_UNIT_TEST_ASSERT(agents.instances[0]->runtimeDataTable.slots.size() >= k_idleRunningNodeCount);
+
+			// half of the agents go through the table, the other half through the node creators only
+			for (size_t i = 0; i < agents.instances.size(); ++i)
+				agents.usesTable.push_back((i & 1) == 0);
+
+			for (int nTick = 0; nTick < 3; ++nTick)
+			{
+				for (size_t i = 0; i < agents.instances.size(); ++i)
+					CRY_UNIT_TEST_ASSERT(agents.Tick(i, agents.UsesTable(i)) == Running);
+			}
+			CRY_UNIT_TEST_ASSERT(nodeFactory.GetSizeOfRuntimeDataForAllAllocatedNodes() > runtimeSizeBefore);
+			CRY_UNIT_TEST_CHECK_EQUAL(agents.GetUsedSlotCount(0), k_idleRunningNodeCount);
+			CRY_UNIT_TEST_CHECK_EQUAL(agents.GetUsedSlotCount(1), (size_t)0);
+
+			// switching the case terminates the idle branch, its slots have to be cleared with it
+			const Variables::VariableID alerted = Variables::GetVariableID("Alerted");
+			for (size_t i = 0; i < agents.instances.size(); ++i)
+			{
+				agents.instances[i]->variables.SetVariable(alerted, true);
+				CRY_UNIT_TEST_ASSERT(agents.Tick(i, agents.UsesTable(i)) == Running);
+			}
+			CRY_UNIT_TEST_CHECK_EQUAL(agents.GetUsedSlotCount(0), k_alertedRunningNodeCount);
+			CRY_UNIT_TEST_CHECK_EQUAL(agents.GetUsedSlotCount(1), (size_t)0);
+
+			agents.Terminate(0, true);
+			CRY_UNIT_TEST_CHECK_EQUAL(agents.GetUsedSlotCount(0), (size_t)0);
+			CRY_UNIT_TEST_ASSERT(agents.Tick(0, true) == Running);
+			CRY_UNIT_TEST_CHECK_EQUAL(agents.GetUsedSlotCount(0), k_alertedRunningNodeCount);
+		}
+		// the destructor terminated all agents, no runtime data may be left behind in either path
+		CRY_UNIT_TEST_CHECK_EQUAL(nodeFactory.GetSizeOfRuntimeDataForAllAllocatedNodes(), runtimeSizeBefore);
+	}
+
+	// One update of 1000 agents running the same tree. The runtime data is found through the instance's
+	// table, or through the hash map of the node creators as every tick did before the table.
+	struct SAgentsBenchmark : public CryUnitTest::SBenchmark
+	{
+		SAgentsBenchmark(bool bUseTable) : m_bUseTable(bUseTable), m_pAgents(nullptr) {}
+
+		virtual void Init() override
+		{
+			m_pAgents = new SAgents();
+			m_pAgents->bUseTableForAll = m_bUseTable;
+			if (!m_pAgents->IsValid())
+				return;
+			for (size_t i = 0; i < m_pAgents->instances.size(); ++i)
+				m_pAgents->Tick(i, m_bUseTable);
+		}
+		virtual void Done() override { SAFE_DELETE(m_pAgents); }
+
+		void TickAll()
+		{
+			if (!m_pAgents->IsValid())
+				return;
+			int runningCount = 0;
+			for (size_t i = 0; i < m_pAgents->instances.size(); ++i)
+				runningCount += m_pAgents->Tick(i, m_bUseTable) == Running;
+			CRY_UNIT_BENCHMARK_KEEP(runningCount);
+		}
+
+		bool     m_bUseTable;
+		SAgents* m_pAgents;
+	};
+
+	struct SAgentsBenchmarkTable : public SAgentsBenchmark
+	{
+		SAgentsBenchmarkTable() : SAgentsBenchmark(true) {}
+	};
+
+	struct SAgentsBenchmarkCreatorMap : public SAgentsBenchmark
+	{
+		SAgentsBenchmarkCreatorMap() : SAgentsBenchmark(false) {}
+	};
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_BehaviorTreeTick1000Table, SAgentsBenchmarkTable)
+	{
+		TickAll();
+	}
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_BehaviorTreeTick1000CreatorMap, SAgentsBenchmarkCreatorMap)
+	{
+		TickAll();
+	}
+}
+
+#endif // CRY_UNIT_TESTING
@@ -10,6 +10,7 @@
 //#pragma inline_depth(0)
 
 CollisionAvoidanceSystem::CollisionAvoidanceSystem()
+	: m_agentGridInvCellSize(0.0f)
 {
 }
 
@@ -84,6 +85,8 @@ void CollisionAvoidanceSystem::Reset(bool bUnload)
 		stl::free_container(m_agentObjectIDs);
 		stl::free_container(m_agentNames);
 
+		stl::free_container(m_agentGrid);
+
 		stl::free_container(m_constraintLines);
 		stl::free_container(m_nearbyAgents);
 		stl::free_container(m_nearbyObstacles);
@@ -96,6 +99,8 @@ void CollisionAvoidanceSystem::Reset(bool bUnload)
 
 		m_agentObjectIDs.clear();
 		m_agentNames.clear();
+
+		m_agentGrid.clear();
 	}
 }
 
@@ -382,6 +387,8 @@ void CollisionAvoidanceSystem::Update(float updateTime)
 	const float Epsilon = 0.00001f;
 	const size_t MaxAgentsConsidered = 8;
 
+	BuildAgentGrid(gAIEnv.CVars.CollisionAvoidanceRange);
+
 	for (; it != end; ++it, ++index)
 	{
 		Agent& agent = *it;
@@ -527,23 +534,45 @@ void CollisionAvoidanceSystem::Update(float updateTime)
 	}
 }
 
-size_t CollisionAvoidanceSystem::ComputeNearbyAgents(const Agent& agent, size_t agentIndex, float range,
-                                                     NearbyAgents& nearbyAgents) const
+void CollisionAvoidanceSystem::BuildAgentGrid(float range)
 {
-	const float Epsilon = 0.00001f;
+	FUNCTION_PROFILER(gEnv->pSystem, PROFILE_AI);
+
+	m_agentGrid.clear();
+
+	float maxRadius = 0.0f;
+	for (Agents::const_iterator it = m_agents.begin(), end = m_agents.end(); it != end; ++it)
+		maxRadius = max(maxRadius, it->radius);
+
+	m_agentGridInvCellSize = 1.0f / max(range + maxRadius, 0.1f);
 
-	Agents::const_iterator ait = m_agents.begin();
-	Agents::const_iterator aend = m_agents.end();
-	size_t nearbyAgentIndex = 0;
+	m_agentGrid.reserve(m_agents.size());
+	for (size_t index = 0, count = m_agents.size(); index < count; ++index)
+	{
+		const Vec3& location = m_agents[index].currentLocation;
+		const uint32 hash = GetAgentGridCellHash(GetAgentGridCellCoord(location.x), GetAgentGridCellCoord(location.y));
+
+		m_agentGrid.push_back(AgentGridEntry(hash, static_cast<uint16>(index)));
+	}
+
+	std::sort(m_agentGrid.begin(), m_agentGrid.end());
+}
+
+void CollisionAvoidanceSystem::AddAgentGridCell(const AgentGrid::const_iterator& begin, const AgentGrid::const_iterator& end,
+                                                const Agent& agent, size_t agentIndex, float range, NearbyAgents& nearbyAgents) const
+{
+	const float Epsilon = 0.00001f;
 
 	Vec3 agentLocation = agent.currentLocation;
 	Vec2 agentLookDirection = agent.currentLookDirection;
 
-	for (; ait != aend; ++ait, ++nearbyAgentIndex)
+	for (AgentGrid::const_iterator it = begin; it != end; ++it)
 	{
+		const size_t nearbyAgentIndex = it->second;
+
 		if (agentIndex != nearbyAgentIndex)
 		{
-			const Agent& otherAgent = *ait;
+			const Agent& otherAgent = m_agents[nearbyAgentIndex];
 
 			const Vec2 relativePosition = Vec2(otherAgent.currentLocation) - Vec2(agentLocation);
 			const float distanceSq = relativePosition.GetLength2();
@@ -572,6 +601,38 @@ size_t CollisionAvoidanceSystem::ComputeNearbyAgents(const Agent& agent, size_t
 			}
 		}
 	}
+}
+
+size_t CollisionAvoidanceSystem::ComputeNearbyAgents(const Agent& agent, size_t agentIndex, float range,
+                                                     NearbyAgents& nearbyAgents) const
+{
+	const int cellX = GetAgentGridCellCoord(agent.currentLocation.x);
+	const int cellY = GetAgentGridCellCoord(agent.currentLocation.y);
+
+	// Different cells can share a hash, make sure each bucket is only visited once
+	uint32 cellHashes[9];
+	size_t cellHashCount = 0;
+
+	for (int y = cellY - 1; y <= cellY + 1; ++y)
+	{
+		for (int x = cellX - 1; x <= cellX + 1; ++x)
+			cellHashes[cellHashCount++] = GetAgentGridCellHash(x, y);
+	}
+
+	std::sort(cellHashes, cellHashes + cellHashCount);
+	cellHashCount = std::unique(cellHashes, cellHashes + cellHashCount) - cellHashes;
+
+	for (size_t i = 0; i < cellHashCount; ++i)
+	{
+		const AgentGridEntry key(cellHashes[i], 0);
+		const AgentGrid::const_iterator begin = std::lower_bound(m_agentGrid.begin(), m_agentGrid.end(), key);
+
+		AgentGrid::const_iterator end = begin;
+		while ((end != m_agentGrid.end()) && (end->first == cellHashes[i]))
+			++end;
+
+		AddAgentGridCell(begin, end, agent, agentIndex, range, nearbyAgents);
+	}
 
 	std::sort(nearbyAgents.begin(), nearbyAgents.end());
 
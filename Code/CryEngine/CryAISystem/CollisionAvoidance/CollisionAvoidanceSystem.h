@@ -122,7 +122,8 @@ private:
 
 		bool operator<(const NearbyAgent& other) const
 		{
-			return distanceSq < other.distanceSq;
+			// Ties are broken by ID, so the order doesn't depend on the order in which agents were gathered
+			return (distanceSq < other.distanceSq) || ((distanceSq == other.distanceSq) && (agentID < other.agentID));
 		};
 
 		float  distanceSq;
@@ -168,6 +169,25 @@ private:
 	typedef std::vector<NearbyObstacle> NearbyObstacles;
 	typedef std::vector<ConstraintLine> ConstraintLines;
 
+	// Uniform grid over the agents, rebuilt every update. Cells are at least as large as the query range, so the
+	// neighbours of an agent are always within its own cell and the 8 cells around it.
+	typedef std::pair<uint32, uint16> AgentGridEntry; // cell hash, agent index
+	typedef std::vector<AgentGridEntry> AgentGrid;
+
+	ILINE int GetAgentGridCellCoord(float value) const
+	{
+		return int_round(floor_tpl(value * m_agentGridInvCellSize));
+	}
+
+	ILINE uint32 GetAgentGridCellHash(int x, int y) const
+	{
+		return (uint32(x) * 73856093u) ^ (uint32(y) * 19349663u);
+	}
+
+	void   BuildAgentGrid(float range);
+	void   AddAgentGridCell(const AgentGrid::const_iterator& begin, const AgentGrid::const_iterator& end, const Agent& agent,
+	                        size_t agentIndex, float range, NearbyAgents& nearbyAgents) const;
+
 	size_t ComputeNearbyAgents(const Agent& agent, size_t agentIndex, float range, NearbyAgents& nearbyAgents) const;
 	size_t ComputeNearbyObstacles(const Agent& agent, size_t agentIndex, float range, NearbyObstacles& nearbyObstacles) const;
 
@@ -210,6 +230,9 @@ private:
 	typedef std::vector<Agent> Agents;
 	Agents m_agents;
 
+	AgentGrid m_agentGrid;
+	float     m_agentGridInvCellSize;
+
 	typedef std::vector<Vec2> AgentAvoidanceVelocities;
 	AgentAvoidanceVelocities m_agentAvoidanceVelocities;
 
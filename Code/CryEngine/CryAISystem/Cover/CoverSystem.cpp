@@ -731,6 +731,11 @@ void CCoverSystem::RemoveLocations(const CoverSurfaceID& surfaceID, const CoverS
 		if (it != m_locations.end())
 			m_locations.erase(it);
 	}
+
+	// Cached locations of a surface are contiguous in the cache, drop them so a changed or reused surface is resampled
+	CoverLocationCache::iterator cacheBegin = m_coverLocationCache.lower_bound(CoverID(surfaceID << CoverIDSurfaceIDShift));
+	CoverLocationCache::iterator cacheEnd = m_coverLocationCache.upper_bound(CoverID((surfaceID << CoverIDSurfaceIDShift) | CoverIDLocationIDMask));
+	m_coverLocationCache.erase(cacheBegin, cacheEnd);
 }
 
 void CCoverSystem::AddDynamicSurface(const CoverSurfaceID& surfaceID, const CoverSurface& surface)
@@ -820,14 +825,15 @@ void CCoverSystem::NotifyCoverUsers(const CoverSurfaceID& surfaceID)
 Vec3 CCoverSystem::GetAndCacheCoverLocation(const CoverID& coverID, float offset /* = 0.0f */, float* height /* = 0 */, Vec3* normal /* = 0 */) const
 {
 	CachedCoverLocationValues cachedValue;
-	if (m_coverLocationCache.find(coverID) != m_coverLocationCache.end())
+	CoverLocationCache::const_iterator cacheIt = m_coverLocationCache.find(coverID);
+	if (cacheIt != m_coverLocationCache.end())
 	{
-		cachedValue = m_coverLocationCache[coverID];
+		cachedValue = cacheIt->second;
 	}
 	else
 	{
 		CoverSurfaceID surfaceID(coverID >> CoverIDSurfaceIDShift);
-		if (surfaceID <= m_surfaces.size())
+		if ((surfaceID > 0) && (surfaceID <= m_surfaces.size()))
 		{
 			if (m_coverLocationCache.size() == MAX_CACHED_COVERS)
 				m_coverLocationCache.clear();
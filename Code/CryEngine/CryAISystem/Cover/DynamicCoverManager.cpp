@@ -21,6 +21,7 @@ void DynamicCoverManager::OnEntityEvent(IEntity* entity, SEntityEvent& event)
 
 DynamicCoverManager::DynamicCoverManager()
 	: m_segmentsGrid(20.0f, 20.0f, 20.0f, segment_position(m_segments))
+	, m_movingEntityCount(0)
 {
 }
 
@@ -98,7 +99,8 @@ void DynamicCoverManager::AddEntity(EntityId entityID)
 	gEnv->pEntitySystem->AddEntityEventListener(entityID, ENTITY_EVENT_XFORM, this);
 	gEnv->pEntitySystem->AddEntityEventListener(entityID, ENTITY_EVENT_DONE, this);
 
-	m_entityCover.insert(EntityCover::value_type(entityID, EntityCoverState(gEnv->pTimer->GetFrameStartTime())));
+	if (m_entityCover.insert(EntityCover::value_type(entityID, EntityCoverState(gEnv->pTimer->GetFrameStartTime()))).second)
+		++m_movingEntityCount;
 }
 
 void DynamicCoverManager::RemoveEntity(EntityId entityID)
@@ -122,6 +124,12 @@ void DynamicCoverManager::RemoveEntity(EntityId entityID, EntityCoverState& stat
 
 	m_entityCoverSampler.Cancel(entityID);
 
+	if (state.state == EntityCoverState::Moving)
+	{
+		assert(m_movingEntityCount > 0);
+		--m_movingEntityCount;
+	}
+
 	RemoveEntityCoverSurfaces(state);
 }
 
@@ -146,6 +154,7 @@ void DynamicCoverManager::Clear()
 
 	m_entityCoverSampler.Clear();
 	m_entityCover.clear();
+	m_movingEntityCount = 0;
 }
 
 void DynamicCoverManager::ClearValidationSegments()
@@ -162,22 +171,26 @@ void DynamicCoverManager::Update(float updateTime)
 	if (!DynamicCoverDeferred && !m_validationQueue.empty())
 		ValidateOne();
 
-	EntityCover::iterator it = m_entityCover.begin();
-	EntityCover::iterator end = m_entityCover.end();
-
-	CTimeValue now = gEnv->pTimer->GetFrameStartTime();
-
-	for (; it != end; ++it)
+	if (m_movingEntityCount > 0)
 	{
-		EntityCoverState& state = it->second;
+		EntityCover::iterator it = m_entityCover.begin();
+		EntityCover::iterator end = m_entityCover.end();
 
-		if (state.state == EntityCoverState::Moving)
+		CTimeValue now = gEnv->pTimer->GetFrameStartTime();
+
+		for (; it != end; ++it)
 		{
-			if ((now - state.lastMovement).GetMilliSecondsAsInt64() >= 150)
+			EntityCoverState& state = it->second;
+
+			if (state.state == EntityCoverState::Moving)
 			{
-				state.state = EntityCoverState::Sampling;
+				if ((now - state.lastMovement).GetMilliSecondsAsInt64() >= 150)
+				{
+					state.state = EntityCoverState::Sampling;
+					--m_movingEntityCount;
 
-				m_entityCoverSampler.Queue(it->first, functor(*this, &DynamicCoverManager::EntityCoverSampled));
+					m_entityCoverSampler.Queue(it->first, functor(*this, &DynamicCoverManager::EntityCoverSampled));
+				}
 			}
 		}
 	}
@@ -250,6 +263,9 @@ void DynamicCoverManager::MoveEvent(EntityId entityID, const Matrix34& worldTM)
 		{
 			m_entityCoverSampler.Cancel(entityID);
 
+			if (state.state != EntityCoverState::Moving)
+				++m_movingEntityCount;
+
 			state.state = EntityCoverState::Moving;
 			state.lastMovement = gEnv->pTimer->GetFrameStartTime();
 			state.lastWorldTM = worldTM;
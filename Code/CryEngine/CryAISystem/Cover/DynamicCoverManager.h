@@ -165,6 +165,7 @@ private:
 
 	typedef VectorMap<EntityId, EntityCoverState> EntityCover;
 	EntityCover        m_entityCover;
+	uint32             m_movingEntityCount; // Entities in the Moving state, only those need to be looked at every update
 
 	EntityCoverSampler m_entityCoverSampler;
 };
@@ -168,6 +168,7 @@ void ConstructPathIfWayWasFoundJob(MNM::PathfinderUtils::ProcessingContext* pPro
 DECLARE_JOB("PathConstruction", PathConstructionJob, ConstructPathIfWayWasFoundJob);
 
 CMNMPathfinder::CMNMPathfinder()
+	: m_requestLatenciesCount(0)
 {
 	m_pathfindingFailedEventsToDispatch.reserve(gAIEnv.CVars.MNMPathfinderConcurrentRequests);
 	m_pathfindingCompletedEventsToDispatch.reserve(gAIEnv.CVars.MNMPathfinderConcurrentRequests);
@@ -311,6 +312,12 @@ void CMNMPathfinder::SetupNewValidPathRequests()
 				MNM::PathfinderUtils::PathfindingFailedEvent failedEvent(idQueuedRequest, requestToServe);
 				m_pathfindingFailedEventsToDispatch.push_back(failedEvent);
 			}
+			else if (!AreRequestIslandsConnected(processingContext.processingRequest))
+			{
+				// skip the triangle search, the request is completed as 'no path found'
+				processingContext.queryResult.SetWaySize(0);
+				processingContext.status = MNM::PathfinderUtils::ProcessingContext::FindWayCompleted;
+			}
 			else
 			{
 				processingContext.status = MNM::PathfinderUtils::ProcessingContext::InProgress;
@@ -399,6 +406,7 @@ void CMNMPathfinder::DispatchResults()
 		MNM::PathfinderUtils::PathfindingFailedEvent failedEvent;
 		while (m_pathfindingFailedEventsToDispatch.try_pop_back(failedEvent))
 		{
+			RecordRequestLatency(failedEvent.request.requestTime);
 			PathRequestFailed(failedEvent.requestId, failedEvent.request);
 		}
 	}
@@ -407,11 +415,19 @@ void CMNMPathfinder::DispatchResults()
 		MNM::PathfinderUtils::PathfindingCompletedEvent succeeded;
 		while (m_pathfindingCompletedEventsToDispatch.try_pop_back(succeeded))
 		{
+			RecordRequestLatency(succeeded.requestTime);
 			succeeded.callback(succeeded.requestId, succeeded.eventData);
 		}
 	}
 }
 
+void CMNMPathfinder::RecordRequestLatency(const CTimeValue& requestTime)
+{
+	const float latency = gEnv->pTimer->GetFrameStartTime().GetDifferenceInSeconds(requestTime) * 1000.0f;
+	m_requestLatencies[m_requestLatenciesCount % kRequestLatencyHistorySize] = latency;
+	++m_requestLatenciesCount;
+}
+
 void CMNMPathfinder::Update()
 {
 	FUNCTION_PROFILER(gEnv->pSystem, PROFILE_AI);
@@ -432,17 +448,24 @@ void CMNMPathfinder::Update()
 
 void CMNMPathfinder::OnNavigationMeshChanged(const NavigationMeshID meshId, const MNM::TileID tileId)
 {
-	const size_t maximumAmountOfSlotsToUpdate = m_processingContextsPool.GetOccupiedSlotsCount();
+	const size_t maximumAmountOfSlotsToUpdate = m_processingContextsPool.GetMaxSlots();
 	for (size_t i = 0; i < maximumAmountOfSlotsToUpdate; ++i)
 	{
 		MNM::PathfinderUtils::ProcessingContext& processingContext = m_processingContextsPool.GetContextAtPosition(i);
 		MNM::PathfinderUtils::ProcessingRequest& processingRequest = processingContext.processingRequest;
 
+		if (processingContext.status != MNM::PathfinderUtils::ProcessingContext::InProgress &&
+		    processingContext.status != MNM::PathfinderUtils::ProcessingContext::FindWayCompleted)
+			continue;
+
+		// the request may be processed by a job right now
+		WaitForJobToFinish(processingContext);
+
 		if (!processingRequest.IsValid())
-			return;
+			continue;
 
 		if (processingRequest.meshID != meshId)
-			return;
+			continue;
 
 		if (!processingContext.workingSet.aStarOpenList.TileWasVisited(tileId))
 		{
@@ -463,7 +486,7 @@ void CMNMPathfinder::OnNavigationMeshChanged(const NavigationMeshID meshId, cons
 			}
 
 			if (!neighbourTileWasVisited)
-				return;
+				continue;
 		}
 
 		//////////////////////////////////////////////////////////////////////////
@@ -473,9 +496,14 @@ void CMNMPathfinder::OnNavigationMeshChanged(const NavigationMeshID meshId, cons
 		MNM::QueuedPathID requestId = processingRequest.queuedID;
 		MNM::PathfinderUtils::QueuedRequest requestParams = processingRequest.data;
 
-		if (!SetupForNextPathRequest(requestId, requestParams, processingContext))
+		if (SetupForNextPathRequest(requestId, requestParams, processingContext))
+		{
+			processingContext.status = MNM::PathfinderUtils::ProcessingContext::InProgress;
+		}
+		else
 		{
-			PathRequestFailed(requestId, requestParams);
+			processingContext.Reset();
+			m_pathfindingFailedEventsToDispatch.push_back(MNM::PathfinderUtils::PathfindingFailedEvent(requestId, requestParams));
 		}
 	}
 }
@@ -575,6 +603,30 @@ bool CMNMPathfinder::SetupForNextPathRequest(MNM::QueuedPathID requestID, MNM::P
 	return true;
 }
 
+bool CMNMPathfinder::AreRequestIslandsConnected(const MNM::PathfinderUtils::ProcessingRequest& processingRequest) const
+{
+	// The islands and their connections are the coarse level of the search: without a connection between them, A* would
+	// expand every triangle reachable from the start before failing. They are recomputed once the navigation system
+	// finished regenerating tiles, so they are only trusted while it is idle.
+	if (!gAIEnv.CVars.MNMPathfinderIslandCheck || gAIEnv.pNavigationSystem->GetState() != INavigationSystem::Idle)
+		return true;
+
+	const MNM::CNavMesh& navMesh = gAIEnv.pNavigationSystem->GetMesh(processingRequest.meshID).navMesh;
+
+	MNM::Tile::STriangle startTriangle;
+	MNM::Tile::STriangle endTriangle;
+	if (!navMesh.GetTriangle(processingRequest.fromTriangleID, startTriangle) || !navMesh.GetTriangle(processingRequest.toTriangleID, endTriangle))
+		return true;
+
+	if (startTriangle.islandID == MNM::Constants::eStaticIsland_InvalidIslandID || endTriangle.islandID == MNM::Constants::eStaticIsland_InvalidIslandID)
+		return true;
+
+	const IEntity* pEntity = gEnv->pEntitySystem->GetEntity(processingRequest.requesterEntityId);
+	return gAIEnv.pNavigationSystem->GetIslandConnectionsManager()->AreIslandsConnected(pEntity,
+	                                                                                     MNM::GlobalIslandID(processingRequest.meshID, startTriangle.islandID),
+	                                                                                     MNM::GlobalIslandID(processingRequest.meshID, endTriangle.islandID));
+}
+
 void CMNMPathfinder::ProcessPathRequest(MNM::PathfinderUtils::ProcessingContext& processingContext)
 {
 	if (processingContext.status != MNM::PathfinderUtils::ProcessingContext::InProgress)
@@ -740,6 +792,7 @@ void CMNMPathfinder::ConstructPathIfWayWasFound(MNM::PathfinderUtils::Processing
 
 	successEvent.callback = processingRequest.data.requestParams.resultCallback;
 	successEvent.requestId = processingRequest.queuedID;
+	successEvent.requestTime = processingRequest.data.requestTime;
 
 	processingRequest.Reset();
 	processingContext.workingSet.aStarOpenList.PathSolvingDone();
@@ -773,6 +826,17 @@ void CMNMPathfinder::DebugAllStatistics()
 	float y = 40.0f;
 	IRenderAuxText::Draw2dLabel(100.f, y, 1.4f, Col_White, false, "Currently we have %" PRISIZE_T " queued requests in the MNMPathfinder", m_requestedPathsQueue.size());
 
+	const size_t latenciesCount = std::min(m_requestLatenciesCount, (size_t)kRequestLatencyHistorySize);
+	if (latenciesCount)
+	{
+		float latencies[kRequestLatencyHistorySize];
+		std::copy(m_requestLatencies, m_requestLatencies + latenciesCount, latencies);
+		std::sort(latencies, latencies + latenciesCount);
+
+		IRenderAuxText::Draw2dLabel(100.f, y + 20.0f, 1.4f, Col_White, false, "Request latency (last %" PRISIZE_T "): 50%% - %.1f ms / 90%% - %.1f ms / 99%% - %.1f ms / Maximum - %.1f ms",
+		                            latenciesCount, latencies[latenciesCount * 50 / 100], latencies[latenciesCount * 90 / 100], latencies[latenciesCount * 99 / 100], latencies[latenciesCount - 1]);
+	}
+
 	y += 100.0f;
 	const size_t maximumAmountOfSlotsToUpdate = m_processingContextsPool.GetMaxSlots();
 	for (size_t i = 0; i < maximumAmountOfSlotsToUpdate; ++i)
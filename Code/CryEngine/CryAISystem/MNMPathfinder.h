@@ -42,6 +42,7 @@ struct QueuedRequest
 		: requesterEntityId(_requesterEntityId)
 		, agentTypeID(_agentTypeID)
 		, requestParams(_request)
+		, requestTime(gEnv->pTimer->GetFrameStartTime())
 	{
 		SetupDangerousLocationsData();
 	}
@@ -49,6 +50,7 @@ struct QueuedRequest
 	EntityId                 requesterEntityId;
 	NavigationAgentTypeID    agentTypeID;
 	MNMPathRequest           requestParams;
+	CTimeValue               requestTime; // used to measure the latency until the result is dispatched
 
 	const MNM::DangerousAreasList& GetDangersInfos() { return dangerousAreas; }
 
@@ -314,6 +316,7 @@ struct PathfindingCompletedEvent
 	MNMPathRequestResult     eventData;
 	MNMPathRequest::Callback callback;
 	MNM::QueuedPathID        requestId;
+	CTimeValue               requestTime;
 };
 
 struct IsPathfindingCompletedEventRelatedToRequest
@@ -378,10 +381,13 @@ private:
 	void              ConstructPathIfWayWasFound(MNM::PathfinderUtils::ProcessingContext& processingContext);
 
 	bool              SetupForNextPathRequest(MNM::QueuedPathID requestID, MNM::PathfinderUtils::QueuedRequest& request, MNM::PathfinderUtils::ProcessingContext& processingContext);
+	bool              AreRequestIslandsConnected(const MNM::PathfinderUtils::ProcessingRequest& processingRequest) const;
 	void              PathRequestFailed(MNM::QueuedPathID requestID, const MNM::PathfinderUtils::QueuedRequest& request);
 
 	void              CancelResultDispatchingForRequest(MNM::QueuedPathID requestId);
 
+	void              RecordRequestLatency(const CTimeValue& requestTime);
+
 	void              DebugAllStatistics();
 	void              DebugStatistics(MNM::PathfinderUtils::ProcessingContext& processingContext, const float textY);
 
@@ -394,6 +400,11 @@ private:
 	MNM::PathfinderUtils::ProcessingContextsPool        m_processingContextsPool;
 	MNM::PathfinderUtils::PathfinderFailedEventQueue    m_pathfindingFailedEventsToDispatch;
 	MNM::PathfinderUtils::PathfinderCompletedEventQueue m_pathfindingCompletedEventsToDispatch;
+
+	// Latencies (ms) from request to dispatched result of the most recent requests, for the debug statistics.
+	enum { kRequestLatencyHistorySize = 256 };
+	float  m_requestLatencies[kRequestLatencyHistorySize];
+	size_t m_requestLatenciesCount;
 };
 
 #endif // _MNMPATHFINDER_H_
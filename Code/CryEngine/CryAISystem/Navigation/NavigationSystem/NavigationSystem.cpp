@@ -985,8 +985,14 @@ void NavigationSystem::UpdateMeshes(const float frameTime, const bool blocking,
 			}
 		}
 
-		m_throughput = completed / frameTime;
-		m_cacheHitRate = cacheHit / frameTime;
+		// tiles complete in bursts, so the rates are smoothed over roughly half a second to stay readable in the debug draw.
+		// Paused frames have no duration and would turn the rates into NaN for good.
+		if (frameTime > 0.0f)
+		{
+			const float rateSmoothing = std::min(1.0f, frameTime * 2.0f);
+			m_throughput += (completed / frameTime - m_throughput) * rateSmoothing;
+			m_cacheHitRate += (cacheHit / frameTime - m_cacheHitRate) * rateSmoothing;
+		}
 
 		if (!m_updatesManager.HasUpdateRequests() && m_runningTasks.empty())
 		{
@@ -2209,7 +2215,8 @@ void NavigationSystem::SetupTasks()
 	// will ever,ever,ever make that efficient.
 	// PeteB: Optimized the tile job time enough to make it viable to do more than one per frame. Added CVar
 	//        multiplier to allow people to control it based on the speed of their machine.
-	m_maxRunningTaskCount = (gEnv->pJobManager->GetNumWorkerThreads() * 3 / 4) * gAIEnv.CVars.NavGenThreadJobs;
+	//        At least one task is kept, otherwise machines with a single worker thread would never process any tile.
+	m_maxRunningTaskCount = std::max(1, (int)(gEnv->pJobManager->GetNumWorkerThreads() * 3 / 4)) * std::max(1, (int)gAIEnv.CVars.NavGenThreadJobs);
 	m_results.resize(m_maxRunningTaskCount);
 
 	for (uint16 i = 0; i < m_results.size(); ++i)
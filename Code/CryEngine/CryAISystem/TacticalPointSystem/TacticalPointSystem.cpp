@@ -672,8 +672,17 @@ bool CTacticalPointSystem::SetupQueryEvaluation(const SQueryInstance& instance,
 
 	// Hmm. Will this actually be correctly set?
 
+	evaluation.queryInstance.nOptionsEvaluated++;
+	const CTimeValue timeGenerationStart = gEnv->pTimer->GetAsyncTime();
+
 	TTacticalPoints points;
-	if (!GeneratePoints(pOption->GetAllGeneration(), instance.queryContext, pOption, points))
+	const bool bGenerated = GeneratePoints(pOption->GetAllGeneration(), instance.queryContext, pOption, points);
+
+	const CTimeValue timeGenerationEnd = gEnv->pTimer->GetAsyncTime();
+	evaluation.queryInstance.timeGeneration += timeGenerationEnd - timeGenerationStart;
+	evaluation.queryInstance.nPointsGenerated += (int)points.size();
+
+	if (!bGenerated)
 	{
 		if (CVars.TacticalPointsWarnings > 0)
 		{
@@ -685,7 +694,10 @@ bool CTacticalPointSystem::SetupQueryEvaluation(const SQueryInstance& instance,
 		return false;
 	}
 
-	if (!SetupHeapEvaluation(pOption->GetAllConditions(), pOption->GetAllWeights(), instance.queryContext, points, instance.nPoints, evaluation))
+	const bool bSetup = SetupHeapEvaluation(pOption->GetAllConditions(), pOption->GetAllWeights(), instance.queryContext, points, instance.nPoints, evaluation);
+	evaluation.queryInstance.timeCheapEvaluation += gEnv->pTimer->GetAsyncTime() - timeGenerationEnd;
+
+	if (!bSetup)
 	{
 		if (CVars.TacticalPointsWarnings > 0)
 		{
@@ -747,7 +759,11 @@ bool CTacticalPointSystem::ContinueQueryEvaluation(SQueryEvaluation& eval, CTime
 		case SQueryEvaluation::eWaitingForDeferred:
 		case SQueryEvaluation::eHeapEvaluation:
 			// Continue evaluation of heap
-			bOk = ContinueHeapEvaluation(eval, timeLimit);
+			{
+				const CTimeValue timeHeapStart = gEnv->pTimer->GetAsyncTime();
+				bOk = ContinueHeapEvaluation(eval, timeLimit);
+				eval.queryInstance.timeHeapEvaluation += gEnv->pTimer->GetAsyncTime() - timeHeapStart;
+			}
 			break;
 
 		case SQueryEvaluation::eError:
@@ -889,6 +905,7 @@ bool CTacticalPointSystem::SetupHeapEvaluation(const std::vector<CCriterion>& vC
 			// Perhaps assertion to check for the overlap that shouldn't be possible
 			SPointEvaluation evalPt(inputPoint, -100.0f, -100.0f, SPointEvaluation::eRejected);   // Is that everything?
 			*(--itRejectedBegin) = evalPt;
+			++eval.queryInstance.nPointsRejectedCheap;
 			continue; // On point failed test
 		}
 
@@ -907,10 +924,12 @@ bool CTacticalPointSystem::SetupHeapEvaluation(const std::vector<CCriterion>& vC
 		// (MATT) fMinExpWeight is -ve, fMaxExpWeight is +ve, they represent the extremes we might reach from this initial value {2009/11/20}
 		SPointEvaluation evalPt(*itInputPoints, fWeight + fMinExpWeight, fWeight + fMaxExpWeight, initialEvalState);
 		(*itHeapEnd++) = evalPt;
-		std::push_heap(itHeapBegin, itHeapEnd);
 		// assert here too
 	}
 
+	// Heapify all the surviving points at once, which is linear rather than a push per point
+	std::make_heap(itHeapBegin, itHeapEnd);
+
 	// Ensure we met in the middle
 	assert(itHeapEnd == itRejectedBegin);
 
@@ -3541,8 +3560,12 @@ void CTacticalPointSystem::Update(float fBudgetSeconds)
 				const CTacticalPointQuery* pQuery = GetQuery(evaluation.queryInstance.nQueryID);
 				CAIActor* pAIActor = static_cast<CAIActor*>(evaluation.queryInstance.queryContext.pAIActor);
 				const char* sName = pAIActor ? pAIActor->GetName() : "NoActor";
+				const SQueryInstance& instance = evaluation.queryInstance;
 				gEnv->pLog->Log("TPS Query: %s Actor: %s Frame completed: %d Frames processed: %d\n",
-				                pQuery->GetName(), sName, gEnv->pRenderer->GetFrameID(), evaluation.queryInstance.nFramesProcessed);
+				                pQuery->GetName(), sName, gEnv->pRenderer->GetFrameID(), instance.nFramesProcessed);
+				gEnv->pLog->Log("TPS Query: %s Options: %d Points: %d (%d rejected cheaply) Generation: %.3fms Cheap: %.3fms Heap: %.3fms\n",
+				                pQuery->GetName(), instance.nOptionsEvaluated, instance.nPointsGenerated, instance.nPointsRejectedCheap,
+				                instance.timeGeneration.GetMilliSeconds(), instance.timeCheapEvaluation.GetMilliSeconds(), instance.timeHeapEvaluation.GetMilliSeconds());
 			}
 #endif
 
@@ -4000,6 +4023,16 @@ void CTacticalPointSystem::DebugDraw() const
 			}
 		}
 
+		// Cost breakdown of the query, above the actor
+		{
+			const SQueryInstance& instance = sEntry.queryInstance;
+			const CTacticalPointQuery* pQuery = GetQuery(instance.nQueryID);
+			dc->Draw3dLabel(instance.queryContext.actorPos + Vec3(0.0f, 0.0f, 2.5f), 1.3f,
+			                "%s\nframes %d, options %d, points %d (%d cheap rejects)\ngen %.2fms, cheap %.2fms, heap %.2fms",
+			                pQuery ? pQuery->GetName() : "?", instance.nFramesProcessed, instance.nOptionsEvaluated, instance.nPointsGenerated, instance.nPointsRejectedCheap,
+			                instance.timeGeneration.GetMilliSeconds(), instance.timeCheapEvaluation.GetMilliSeconds(), instance.timeHeapEvaluation.GetMilliSeconds());
+		}
+
 		// Iterate through point vector
 		int iFirstN = 0;
 		std::vector<SPointEvaluation>::const_iterator pointIter;
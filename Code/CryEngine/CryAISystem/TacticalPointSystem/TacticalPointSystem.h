@@ -387,12 +387,24 @@ private:
 		// Performance monitoring, for latency and throughput
 		CTimeValue timeRequested;
 		int        nFramesProcessed;
+
+		// Cost breakdown, accumulated over all the options evaluated
+		CTimeValue timeGeneration;                           // Generating the points
+		CTimeValue timeCheapEvaluation;                      // Cheap conditions and weights, applied to every point
+		CTimeValue timeHeapEvaluation;                       // Expensive/deferred conditions and weights, applied lazily through the heap
+		int        nOptionsEvaluated;
+		int        nPointsGenerated;
+		int        nPointsRejectedCheap;
+
 		SQueryInstance()
 		{
 			flags = 0;
 			nPoints = 0;
 			pReceiver = NULL;
 			nFramesProcessed = 0;
+			nOptionsEvaluated = 0;
+			nPointsGenerated = 0;
+			nPointsRejectedCheap = 0;
 		}
 	};
 
@@ -204,6 +204,7 @@ void CVisionMap::ObserverChanged(const ObserverID& observerID, const ObserverPar
 		return;
 
 	bool needsUpdate = false;
+	bool needsRayCastUpdate = false;
 	ObserverInfo& observerInfo = it->second;
 	ObserverParams& currentObserverParams = observerInfo.observerParams;
 
@@ -241,6 +242,7 @@ void CVisionMap::ObserverChanged(const ObserverID& observerID, const ObserverPar
 		{
 			currentObserverParams.eyePosition = newObserverParams.eyePosition;
 			needsUpdate = true;
+			needsRayCastUpdate = true;
 		}
 	}
 
@@ -295,6 +297,7 @@ void CVisionMap::ObserverChanged(const ObserverID& observerID, const ObserverPar
 	{
 		currentObserverParams.raycastFlags = newObserverParams.raycastFlags;
 		needsUpdate = true;
+		needsRayCastUpdate = true;
 	}
 
 	if (hint & eChangedEntityId)
@@ -317,7 +320,11 @@ void CVisionMap::ObserverChanged(const ObserverID& observerID, const ObserverPar
 	{
 		observerInfo.needsPVSUpdate = true;
 		observerInfo.needsVisibilityUpdate = true;
-		observerInfo.updateAllVisibilityStatus = true;
+
+		// Only a change of the rays themselves invalidates the results cached in the PVS. Other changes (orientation,
+		// FOV, factions...) just change which observables are in the PVS, and new entries are queued on their own.
+		if (needsRayCastUpdate || !gAIEnv.CVars.VisionMapCacheStaticPairs)
+			observerInfo.updateAllVisibilityStatus = true;
 	}
 }
 
@@ -919,12 +926,27 @@ void CVisionMap::ClearPriorityMap()
 	m_priorityMap.clear();
 }
 
+float CVisionMap::GetVisibilityUpdateWeight(const ObserverInfo& observerInfo, const ObservableInfo& observableInfo) const
+{
+	const ObserverParams& observerParams = observerInfo.observerParams;
+	const Vec3 observerToObservable = observableInfo.observableParams.observablePositions[0] - observerParams.eyePosition;
+	const float distanceSq = observerToObservable.GetLengthSquared();
+
+	// Observables closer to the center of the view come first: the weight is the squared distance scaled from 1 (straight
+	// ahead) to 2 (at the edge of the FOV or behind).
+	const float viewDot = (distanceSq > 0.0f) ? observerParams.eyeDirection.Dot(observerToObservable) * isqrt_tpl(distanceSq) : 1.0f;
+
+	return distanceSq * (2.0f - clamp_tpl(viewDot, 0.0f, 1.0f));
+}
+
 void CVisionMap::UpdateVisibilityStatus(ObserverInfo& observerInfo)
 {
 #if VISIONMAP_DEBUG
 	++m_numberOfVisibilityUpdatesThisFrame;
 #endif
 
+	m_visibilityUpdateEntries.clear();
+
 	for (PVS::iterator pvsIt = observerInfo.pvs.begin(), end = observerInfo.pvs.end(); pvsIt != end; ++pvsIt)
 	{
 		PVSEntry& pvsEntry = pvsIt->second;
@@ -936,10 +958,17 @@ void CVisionMap::UpdateVisibilityStatus(ObserverInfo& observerInfo)
 			if (pvsEntry.pendingRayID != 0)
 				DeletePendingRay(pvsEntry);
 
-			QueueRay(observerInfo, pvsEntry);
+			m_visibilityUpdateEntries.push_back(VisibilityUpdateEntries::value_type(GetVisibilityUpdateWeight(observerInfo, pvsEntry.observableInfo), &pvsEntry));
 		}
 	}
 
+	// Requests of the same priority and age are served roughly in queue order, so queue the most relevant pairs first
+	std::sort(m_visibilityUpdateEntries.begin(), m_visibilityUpdateEntries.end(),
+	          [](const VisibilityUpdateEntries::value_type& lhs, const VisibilityUpdateEntries::value_type& rhs) { return lhs.first < rhs.first; });
+
+	for (VisibilityUpdateEntries::iterator it = m_visibilityUpdateEntries.begin(), end = m_visibilityUpdateEntries.end(); it != end; ++it)
+		QueueRay(observerInfo, *it->second);
+
 	observerInfo.updateAllVisibilityStatus = false;
 }
 
@@ -189,6 +189,7 @@ private:
 	bool                     ShouldBeAddedToObserverPVS(const ObserverInfo& observerInfo, const ObservableInfo& observableInfo) const;
 
 	void                     UpdateVisibilityStatus(ObserverInfo& observerInfo);
+	float                    GetVisibilityUpdateWeight(const ObserverInfo& observerInfo, const ObservableInfo& observableInfo) const;
 
 	bool                     ShouldObserve(const ObserverInfo& observerInfo, const ObservableInfo& observableInfo) const;
 	bool                     IsInSightRange(const ObserverInfo& observerInfo, const ObservableInfo& observableInfo) const;
@@ -217,6 +218,9 @@ private:
 	typedef std::vector<std::pair<float, ObservableInfo*>> QueryObservables;
 	QueryObservables m_queryObservables;
 
+	typedef std::vector<std::pair<float, PVSEntry*>> VisibilityUpdateEntries;
+	VisibilityUpdateEntries m_visibilityUpdateEntries;
+
 	typedef std::map<QueuedRayID, PendingRayInfo> PendingRays;
 	PendingRays m_pendingRays;
 
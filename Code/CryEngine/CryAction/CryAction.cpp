@@ -256,6 +256,34 @@ void CCryAction::DumpMemInfo(const char* format, ...)
 	gEnv->pLog->LogWithType(ILog::eAlways, "Alloc=%" PRIu64 "d kb  String=%" PRIu64 " kb  STL-alloc=%" PRIu64 " kb  STL-wasted=%" PRIu64 " kb", (memInfo.allocated - memInfo.freed) >> 10, memInfo.CryString_allocated >> 10, memInfo.STL_allocated >> 10, memInfo.STL_wasted >> 10);
 }
 
+#if ENABLE_STATOSCOPE
+class CFixedLogicTickDG : public IStatoscopeDataGroup
+{
+public:
+	CFixedLogicTickDG(const int& ticks, const int& droppedTicks, const float& tickTimeMs, const float& alpha)
+		: m_ticks(ticks), m_droppedTicks(droppedTicks), m_tickTimeMs(tickTimeMs), m_alpha(alpha) {}
+
+	virtual SDescription GetDescription() const
+	{
+		return SDescription('K', "Fixed logic tick", "['/LogicTick/' (int ticks) (int droppedTicks) (float tickTimeMs) (float alpha)]");
+	}
+
+	virtual void Write(IStatoscopeFrameRecord& fr)
+	{
+		fr.AddValue(m_ticks);
+		fr.AddValue(m_droppedTicks);
+		fr.AddValue(m_tickTimeMs);
+		fr.AddValue(m_alpha);
+	}
+
+private:
+	const int&   m_ticks;
+	const int&   m_droppedTicks;
+	const float& m_tickTimeMs;
+	const float& m_alpha;
+};
+#endif
+
 // no dot use iterators in first part because of calls of some listners may modify array of listeners (add new)
 #define CALL_FRAMEWORK_LISTENERS(func)                                  \
   {                                                                     \
@@ -368,6 +396,7 @@ CCryAction::CCryAction()
 	m_pCustomEventManager(0),
 	m_pPhysicsQueues(0),
 	m_PreUpdateTicks(0),
+	m_pFixedLogicTickStatoscopeDG(nullptr),
 	m_pGameVolumesManager(NULL),
 	m_pNetMsgDispatcher(nullptr),
 	m_pManualFrameStepController(nullptr),
@@ -2372,6 +2401,14 @@ bool CCryAction::CompleteInit()
 	if (gEnv->pFlashUI)
 		gEnv->pFlashUI->Init();
 
+#if ENABLE_STATOSCOPE
+	if (gEnv->pStatoscope && !m_pFixedLogicTickStatoscopeDG)
+	{
+		m_pFixedLogicTickStatoscopeDG = new CFixedLogicTickDG(m_fixedLogicTick.ticks, m_fixedLogicTick.droppedTicks, m_fixedLogicTick.tickTimeMs, m_fixedLogicTick.alpha);
+		gEnv->pStatoscope->RegisterDataGroup(m_pFixedLogicTickStatoscopeDG);
+	}
+#endif
+
 	m_pSystem->SetIDialogSystem(m_pDialogSystem);
 
 	InlineInitializationProcessing("CCryAction::CompleteInit SetDialogSystem");
@@ -2580,6 +2617,15 @@ void CCryAction::ShutdownEngine()
 
 	XMLCPB::ShutdownCompressorThread();
 
+#if ENABLE_STATOSCOPE
+	if (m_pFixedLogicTickStatoscopeDG)
+	{
+		if (gEnv->pStatoscope)
+			gEnv->pStatoscope->UnregisterDataGroup(m_pFixedLogicTickStatoscopeDG);
+		SAFE_DELETE(m_pFixedLogicTickStatoscopeDG);
+	}
+#endif
+
 	SAFE_DELETE(m_pAIDebugRenderer);
 	SAFE_DELETE(m_pAINetworkDebugRenderer);
 
@@ -2907,6 +2953,8 @@ bool CCryAction::PreUpdate(bool haveFocus, unsigned int updateFlags)
 		m_pColorGradientManager->UpdateForThisFrame(gEnv->pTimer->GetFrameTime());
 	}
 
+	UpdateFixedLogicTicks(frameTime, bGameIsPaused);
+
 	CRConServerListener::GetSingleton().Update();
 	CSimpleHttpServerListener::GetSingleton().Update();
 
@@ -2925,6 +2973,52 @@ bool CCryAction::PreUpdate(bool haveFocus, unsigned int updateFlags)
 	return bRetRun;
 }
 
+void CCryAction::UpdateFixedLogicTicks(float frameTime, bool bGameIsPaused)
+{
+	SFixedLogicTick& tick = m_fixedLogicTick;
+	tick.ticks = 0;
+	tick.droppedTicks = 0;
+	tick.tickTimeMs = 0.0f;
+
+	const int tickRate = CCryActionCVars::Get().g_fixedLogicTickRate;
+	if (tickRate <= 0 || bGameIsPaused || IsInLevelLoad())
+	{
+		tick.accumulator = 0.0f;
+		tick.alpha = 1.0f;
+		return;
+	}
+
+	CRY_PROFILE_REGION(PROFILE_GAME, "CCryAction::UpdateFixedLogicTicks");
+
+	const float tickStep = 1.0f / (float)tickRate;
+	tick.accumulator += frameTime;
+
+	// Dedicated servers catch up on every tick, the frame time is already capped by t_MaxStep.
+	// Clients drop ticks beyond the limit so a frame spike does not cause a spiral of ever longer frames.
+	int numTicks = (int)(tick.accumulator / tickStep);
+	const int maxTicks = CCryActionCVars::Get().g_fixedLogicMaxTicksPerFrame;
+	if (!gEnv->IsDedicated() && maxTicks > 0 && numTicks > maxTicks)
+	{
+		tick.droppedTicks = numTicks - maxTicks;
+		tick.accumulator -= tick.droppedTicks * tickStep;
+		numTicks = maxTicks;
+	}
+
+	if (numTicks > 0)
+	{
+		const CTimeValue startTime = gEnv->pTimer->GetAsyncTime();
+		for (int i = 0; i < numTicks; ++i)
+		{
+			CALL_FRAMEWORK_LISTENERS(OnFixedLogicUpdate(tickStep));
+		}
+		tick.tickTimeMs = (gEnv->pTimer->GetAsyncTime() - startTime).GetMilliSeconds();
+		tick.accumulator -= numTicks * tickStep;
+		tick.ticks = numTicks;
+	}
+
+	tick.alpha = clamp_tpl(tick.accumulator / tickStep, 0.0f, 1.0f);
+}
+
 uint32 CCryAction::GetPreUpdateTicks()
 {
 	uint32 ticks = m_PreUpdateTicks;
@@ -34,6 +34,7 @@ struct IEffectSystem;
 struct IBreakableGlassSystem;
 struct IForceFeedbackSystem;
 struct IGameVolumes;
+struct IStatoscopeDataGroup;
 
 class CAIDebugRenderer;
 class CAINetworkDebugRenderer;
@@ -145,6 +146,7 @@ public:
 	virtual void                          PauseGame(bool pause, bool force, unsigned int nFadeOutInMS = 0);
 	virtual bool                          IsGamePaused();
 	virtual bool                          IsGameStarted();
+	virtual float                         GetFixedLogicTickAlpha() const { return m_fixedLogicTick.alpha; }
 	virtual bool                          IsInLevelLoad();
 	virtual bool                          IsLoadingSaveGame();
 	virtual const char*                   GetLevelName();
@@ -378,6 +380,7 @@ public:
 	bool                    PreUpdate(bool haveFocus, unsigned int updateFlags);
 	int                     Update(bool haveFocus, unsigned int updateFlags);
 	void                    PostUpdate(bool haveFocus, unsigned int updateFlags);
+	void                    UpdateFixedLogicTicks(float frameTime, bool bGameIsPaused);
 
 	const std::vector<INetworkedClientListener*>& GetNetworkClientListeners() const { return m_networkClientListeners; }
 
@@ -679,6 +682,19 @@ private:
 	float  m_lastSaveLoad;
 	float  m_lastFrameTimeUI;
 
+	// Fixed rate logic ticks driven from PreUpdate, see g_fixedLogicTickRate.
+	struct SFixedLogicTick
+	{
+		SFixedLogicTick() : accumulator(0.0f), alpha(1.0f), ticks(0), droppedTicks(0), tickTimeMs(0.0f) {}
+
+		float accumulator;
+		float alpha;
+		int   ticks;        // ticks run this frame
+		int   droppedTicks; // ticks discarded this frame because of g_fixedLogicMaxTicksPerFrame
+		float tickTimeMs;   // time spent in OnFixedLogicUpdate listeners this frame
+	} m_fixedLogicTick;
+	IStatoscopeDataGroup* m_pFixedLogicTickStatoscopeDG;
+
 	bool   m_pbSvEnabled;
 	bool   m_pbClEnabled;
 	uint32 m_PreUpdateTicks;
@@ -73,6 +73,14 @@ CCryActionCVars::CCryActionCVars()
 
 	REGISTER_CVAR(g_allowDisconnectIfUpdateFails, 1, VF_INVISIBLE, "");
 
+	REGISTER_CVAR(g_fixedLogicTickRate, 0, VF_NULL, "Rate in Hz at which IGameFrameworkListener::OnFixedLogicUpdate is called, independent of the frame rate.\n"
+	              "Usage: g_fixedLogicTickRate [0..]\n"
+	              "Default is 0 (disabled)");
+	REGISTER_CVAR(g_fixedLogicMaxTicksPerFrame, 4, VF_NULL, "Maximum number of fixed logic ticks run in a single frame on clients, excess ticks are dropped.\n"
+	              "Dedicated servers always catch up.\n"
+	              "Usage: g_fixedLogicMaxTicksPerFrame [0..] (0 = no limit)\n"
+	              "Default is 4");
+
 	REGISTER_CVAR(g_useSinglePosition, 1, VF_NULL, "Activates the new Single Position update order");
 	REGISTER_CVAR(g_handleEvents, 1, VF_NULL, "Activates the registration requirement for GameObjectEvents");
 
@@ -81,6 +89,8 @@ CCryActionCVars::CCryActionCVars()
 
 	REGISTER_CVAR(sw_gridSize, 6, 0, "Number of active grids in both column and line for segmented world");
 	REGISTER_CVAR(sw_debugInfo, 1, 0, "Segmented World Debug Info (0=disable, 1=grid, 2=position, 3=memory, 4=color-coded object, 5=seg index, 6=seg index with layer info)");
+	REGISTER_CVAR(sw_unloadMargin, 1, 0, "Number of segments outside the active grid that are kept loaded to avoid reloading them when moving back and forth along a segment border");
+	REGISTER_CVAR(sw_segmentUpdatesPerFrame, 1, 0, "Maximum number of segments that are loaded, streamed or unloaded per frame for segmented world");
 	REGISTER_INT("sw_draw_bbox", 1, 0, "Draw bounding box for segments.\nDefault is 1.\n");
 
 	REGISTER_CVAR2("g_enableMergedMeshRuntimeAreas", &g_enableMergedMeshRuntimeAreas, 0, VF_CHEAT | VF_REQUIRE_APP_RESTART, "Enables the Merged Mesh cluster generation and density precalculations at game/level load");
@@ -115,9 +125,13 @@ CCryActionCVars::~CCryActionCVars()
 	pConsole->UnregisterVariable("co_usenewcoopanimsystem", true);
 
 	pConsole->UnregisterVariable("g_allowDisconnectIfUpdateFails", true);
+	pConsole->UnregisterVariable("g_fixedLogicTickRate", true);
+	pConsole->UnregisterVariable("g_fixedLogicMaxTicksPerFrame", true);
 
 	pConsole->UnregisterVariable("sw_gridSize");
 	pConsole->UnregisterVariable("sw_debugInfo");
+	pConsole->UnregisterVariable("sw_unloadMargin");
+	pConsole->UnregisterVariable("sw_segmentUpdatesPerFrame");
 	pConsole->UnregisterVariable("sw_draw_bbox");
 	pConsole->UnregisterVariable("g_enableMergedMeshRuntimeAreas", true);
 }
@@ -65,6 +65,9 @@ public:
 
 	int g_allowDisconnectIfUpdateFails;
 
+	int g_fixedLogicTickRate;
+	int g_fixedLogicMaxTicksPerFrame;
+
 	int g_useSinglePosition;
 	int g_handleEvents;
 
@@ -75,6 +78,8 @@ public:
 
 	int    sw_gridSize;
 	int    sw_debugInfo;
+	int    sw_unloadMargin;
+	int    sw_segmentUpdatesPerFrame;
 
 	static ILINE CCryActionCVars& Get()
 	{
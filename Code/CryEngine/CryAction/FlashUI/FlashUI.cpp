@@ -72,7 +72,7 @@ CFlashUI::CFlashUI()
 	DefineConstIntCVarName("gfx_draw", CV_gfx_draw, 1, VF_NULL, "Draw UI Elements");
 	DefineConstIntCVarName("gfx_debugdraw", CV_gfx_debugdraw, 0, VF_NULL, "Display UI Elements debug info.\n" \
 	  "0=Disabled"                                                                                            \
-	  "1=UIElements"                                                                                          \
+	  "1=UIElements (with smoothed update/render time per instance)"                                         \
 	  "2=UIActions"                                                                                           \
 	  "4=UIActions"                                                                                           \
 	  "12=UIStack per UI FG");
@@ -1977,6 +1977,7 @@ void RenderDebugInfo()
 			const float col4 = 600;
 			const float col5 = 700;
 			const float col6 = 800;
+			const float col7 = 920;
 
 			DrawTextLabel(col1, py, colorWhite, "UIElement");
 			DrawTextLabel(col2, py, colorWhite, "Refs");
@@ -1984,6 +1985,7 @@ void RenderDebugInfo()
 			DrawTextLabel(col4, py, colorWhite, "Init");
 			DrawTextLabel(col5, py, colorWhite, "Visible");
 			DrawTextLabel(col6, py, colorWhite, "Memory/Textures");
+			DrawTextLabel(col7, py, colorWhite, "Update/Render ms");
 			py += dy + dy_space;
 
 			std::map<IUIElement*, bool> m_collectedMap;
@@ -2011,6 +2013,7 @@ void RenderDebugInfo()
 					DrawTextLabel(col4, py, color, "%s ", pInstance->IsInit() ? "true" : "false");
 					DrawTextLabel(col5, py, color, "%s ", pInstance->IsVisible() ? "true" : "false");
 					DrawTextLabel(col6, py, color, "DynTex: %i ", pInstance->GetNumExtTextures());
+					DrawTextLabel(col7, py, color, "%.2f / %.2f", ((CFlashUIElement*)pInstance)->m_fDebugUpdateTimeMs, ((CFlashUIElement*)pInstance)->m_fDebugRenderTimeMs);
 					py += dy;
 					m_collectedMap[pInstance] = true;
 				}
@@ -100,6 +100,7 @@ struct SUIElementSerializer
 		{
 			node->getAttr("alpha", pElement->m_fAlpha);
 			node->getAttr("layer", pElement->m_iLayer);
+			node->getAttr("update_interval", pElement->m_fUpdateInterval);
 			pElement->m_sFlashFile = node->getAttr("file");
 
 			const XmlNodeRef& constraintsnode = node->findChild("Constraints");
@@ -348,6 +349,8 @@ CFlashUIElement::CFlashUIElement(CFlashUI* pFlashUI, CFlashUIElement* pBaseInsta
 	, m_eventListener(4)
 	, m_bNeedLazyUpdate(false)
 	, m_bNeedLazyRender(false)
+	, m_fUpdateInterval(0.0f)
+	, m_fPendingDeltaTime(0.0f)
 	, m_firstDynamicDisplObjIndex(0)
 	, m_bIsHideRequest(false)
 	, m_bUnloadRequest(false)
@@ -357,6 +360,8 @@ CFlashUIElement::CFlashUIElement(CFlashUI* pFlashUI, CFlashUIElement* pBaseInsta
 		m_instances.push_back(this);
 
 #if !defined (_RELEASE)
+	m_fDebugUpdateTimeMs = 0.0f;
+	m_fDebugRenderTimeMs = 0.0f;
 	s_ElementDebugList.push_back(this);
 #endif
 }
@@ -848,7 +853,25 @@ void CFlashUIElement::Update(float fDeltaTime)
 	FUNCTION_PROFILER(GetISystem(), PROFILE_ACTION);
 	if (m_pFlashplayer == NULL || ((m_iFlags & (uint64) eFUI_LAZY_UPDATE) != 0 && !m_bNeedLazyUpdate)) return;
 
+	// Elements with an update interval only advance once enough time has accumulated,
+	// the last advanced frame is rendered in between. Pending unloads are never delayed.
+	if (m_fUpdateInterval > 0.0f && !m_bUnloadRequest)
+	{
+		m_fPendingDeltaTime += fDeltaTime;
+		if (m_fPendingDeltaTime < m_fUpdateInterval)
+			return;
+		fDeltaTime = m_fPendingDeltaTime;
+		m_fPendingDeltaTime = 0.0f;
+	}
+
+#if !defined (_RELEASE)
+	const CTimeValue startTime = CFlashUI::CV_gfx_debugdraw & 1 ? gEnv->pTimer->GetAsyncTime() : CTimeValue();
+	m_pFlashplayer->Advance(fDeltaTime);
+	if (CFlashUI::CV_gfx_debugdraw & 1)
+		m_fDebugUpdateTimeMs = Lerp(m_fDebugUpdateTimeMs, (gEnv->pTimer->GetAsyncTime() - startTime).GetMilliSeconds(), 0.1f);
+#else
 	m_pFlashplayer->Advance(fDeltaTime);
+#endif
 	m_bNeedLazyUpdate = false;
 
 	if (m_bUnloadRequest)
@@ -870,7 +893,14 @@ void CFlashUIElement::Render()
 
 	if (!HasExtTexture())
 	{
+#if !defined (_RELEASE)
+		const CTimeValue startTime = CFlashUI::CV_gfx_debugdraw & 1 ? gEnv->pTimer->GetAsyncTime() : CTimeValue();
 		m_pFlashplayer->Render(gEnv->pRenderer->IsStereoEnabled());
+		if (CFlashUI::CV_gfx_debugdraw & 1)
+			m_fDebugRenderTimeMs = Lerp(m_fDebugRenderTimeMs, (gEnv->pTimer->GetAsyncTime() - startTime).GetMilliSeconds(), 0.1f);
+#else
+		m_pFlashplayer->Render(gEnv->pRenderer->IsStereoEnabled());
+#endif
 	}
 }
 
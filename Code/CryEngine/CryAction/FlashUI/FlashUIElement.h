@@ -241,6 +241,8 @@ private:
 	bool                      m_bCursorVisible;
 	bool                      m_bNeedLazyUpdate;
 	bool                      m_bNeedLazyRender;
+	float                     m_fUpdateInterval;  // seconds between Advance calls, 0 = every frame
+	float                     m_fPendingDeltaTime; // time accumulated since the last Advance
 	SUIConstraints            m_constraints;
 	XmlNodeRef                m_baseInfo;
 	typedef std::set<string> TStringBuffer;
@@ -317,6 +319,10 @@ private:
 	friend void RenderDebugInfo();
 	typedef std::vector<CFlashUIElement*> TElementInstanceList;
 	static TElementInstanceList s_ElementDebugList;
+
+	// Smoothed per-instance cost shown by gfx_debugdraw 1.
+	float m_fDebugUpdateTimeMs;
+	float m_fDebugRenderTimeMs;
 #endif
 };
 
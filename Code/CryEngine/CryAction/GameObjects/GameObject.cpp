@@ -554,8 +554,26 @@ void CGameObject::Update(SEntityUpdateContext& ctx)
 			iter->forceEnables[i] -= iter->forceEnables[i] != 0;
 			if (ShouldUpdateSlot(&*iter, i, slotbit, checkAIDisableOnSlots))
 			{
-				iter->pExtension->Update(ctx, i);
 				keepUpdating = true;
+
+				if (iter->updateIntervals[i] > 0.0f)
+				{
+					iter->pendingUpdateTimes[i] += ctx.fFrameTime;
+					if (iter->pendingUpdateTimes[i] < iter->updateIntervals[i])
+					{
+						slotbit <<= 1;
+						continue;
+					}
+
+					SEntityUpdateContext throttledCtx = ctx;
+					throttledCtx.fFrameTime = iter->pendingUpdateTimes[i];
+					iter->pendingUpdateTimes[i] = 0.0f;
+					iter->pExtension->Update(throttledCtx, i);
+				}
+				else
+				{
+					iter->pExtension->Update(ctx, i);
+				}
 			}
 
 			slotbit <<= 1;
@@ -1512,6 +1530,18 @@ void CGameObject::PostUpdate(float frameTime)
 	}
 }
 
+void CGameObject::SetUpdateSlotInterval(IGameObjectExtension* pExtension, int slot, float interval)
+{
+	CRY_ASSERT(slot >= 0 && slot < MAX_UPDATE_SLOTS_PER_EXTENSION);
+
+	SExtension* pExt = GetExtensionInfo(pExtension);
+	if (pExt)
+	{
+		pExt->updateIntervals[slot] = max(interval, 0.0f);
+		pExt->pendingUpdateTimes[slot] = 0.0f;
+	}
+}
+
 void CGameObject::SetUpdateSlotEnableCondition(IGameObjectExtension* pExtension, int slot, EUpdateEnableCondition condition)
 {
 	bool whenVisible = false;
@@ -184,6 +184,7 @@ public:
 	virtual void                  FullSerialize(TSerialize ser) override;
 	virtual void                  PostSerialize() override;
 	virtual void                  SetUpdateSlotEnableCondition(IGameObjectExtension* pExtension, int slot, EUpdateEnableCondition condition) override;
+	virtual void                  SetUpdateSlotInterval(IGameObjectExtension* pExtension, int slot, float interval) override;
 	virtual bool                  IsProbablyVisible() override;
 	virtual bool                  IsProbablyDistant() override;
 	virtual bool                  SetAspectProfile(EEntityAspects aspect, uint8 profile, bool fromNetwork) override;
@@ -308,6 +309,7 @@ private:
 			for (uint32 i = 0; i < MAX_UPDATE_SLOTS_PER_EXTENSION; ++i)
 			{
 				updateEnables[i] = forceEnables[i] = 0;
+				updateIntervals[i] = pendingUpdateTimes[i] = 0.0f;
 				flagDisableWithAI += slotbit;
 				slotbit <<= 1;
 			}
@@ -321,6 +323,9 @@ private:
 		uint8                          refCount;
 		uint8                          updateEnables[MAX_UPDATE_SLOTS_PER_EXTENSION];
 		uint8                          forceEnables[MAX_UPDATE_SLOTS_PER_EXTENSION];
+		// minimum time between two updates of a slot, and the frame time accumulated since its last update
+		float                          updateIntervals[MAX_UPDATE_SLOTS_PER_EXTENSION];
+		float                          pendingUpdateTimes[MAX_UPDATE_SLOTS_PER_EXTENSION];
 		// upper layers only get to activate/deactivate extensions
 		uint8                          flagUpdateWhenVisible: MAX_UPDATE_SLOTS_PER_EXTENSION;
 		uint8                          flagUpdateWhenInRange: MAX_UPDATE_SLOTS_PER_EXTENSION;
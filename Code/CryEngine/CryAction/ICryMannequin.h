@@ -988,6 +988,8 @@ public:
 	virtual bool                  ClearSubADBFilter(const string& sADBFileName) = 0;
 
 	virtual void                  QueryUsedTags(const FragmentID fragmentID, const SFragTagState& filter, SFragTagState& usedTags) const = 0;
+	//! Lists the fragments that have a transition authored from fragmentIDFrom, i.e. the fragments that can follow it.
+	virtual void                  QueryBlendTargets(const FragmentID fragmentIDFrom, DynArray<FragmentID>& targets) const = 0;
 };
 
 class IAnimationDatabaseManager
@@ -2275,6 +2277,67 @@ private:
 	TAnimsCached m_animsCached;
 };
 
+// Keeps the animations of all fragments that can follow the fragment currently playing on a scope cached,
+// so that their CAFs and DBAs are streamed in before the action controller installs them.
+// Call Update() once per frame (or whenever the scope may have changed fragment); the cache is only rebuilt
+// when the fragment changes.
+class CReachableFragmentCache
+{
+public:
+	CReachableFragmentCache()
+		: m_fragmentID(FRAGMENT_ID_INVALID)
+	{
+	}
+
+	void Update(const IActionController& actionController, uint32 scopeID)
+	{
+		const IScope* piScope = actionController.GetScope(scopeID);
+		const FragmentID fragmentID = (piScope && piScope->HasDatabase()) ? piScope->GetLastFragmentID() : FRAGMENT_ID_INVALID;
+		if (fragmentID == m_fragmentID)
+			return;
+		m_fragmentID = fragmentID;
+
+		// build the new set before releasing the old one, so animations shared by both stay referenced
+		TFragmentCaches fragmentCaches;
+		if (fragmentID != FRAGMENT_ID_INVALID)
+		{
+			DynArray<FragmentID> targets;
+			piScope->GetDatabase().QueryBlendTargets(fragmentID, targets);
+
+			const SFragTagState tagState(actionController.GetContext().state.GetMask(), TAG_STATE_EMPTY);
+			fragmentCaches.reserve(targets.size());
+			for (int i = 0; i < targets.size(); ++i)
+			{
+				fragmentCaches.push_back(CFragmentCache(SFragmentQuery(targets[i], tagState)));
+				fragmentCaches.back().PrecacheAnimsFromAllDatabases(&actionController);
+			}
+		}
+		m_fragmentCaches.swap(fragmentCaches);
+	}
+
+	void Release()
+	{
+		m_fragmentID = FRAGMENT_ID_INVALID;
+		stl::free_container(m_fragmentCaches);
+	}
+
+	bool IsLoaded() const
+	{
+		for (size_t i = 0; i < m_fragmentCaches.size(); ++i)
+		{
+			if (!m_fragmentCaches[i].IsLoaded())
+				return false;
+		}
+		return true;
+	}
+
+private:
+	typedef std::vector<CFragmentCache> TFragmentCaches;
+
+	FragmentID      m_fragmentID;
+	TFragmentCaches m_fragmentCaches;
+};
+
 #include "ICryMannequinUserParams.h"
 
 #endif //__I_CRY_MANNEQUIN_H__
@@ -1697,12 +1697,14 @@ public:
 		m_keySize(stride)
 	{
 		m_keys = new uint8[size * stride];
+		m_comparisonMasks = new uint8[size * stride];
 		m_values = new T[size];
 	}
 
 	~TOptimisedTagSortedList()
 	{
 		delete[] m_keys;
+		delete[] m_comparisonMasks;
 		delete[] m_values;
 		delete m_pDefData;
 	}
@@ -1816,11 +1818,16 @@ public:
 
 		STagStateBase globalTags(m_keys, numBytesGlobal);
 		STagStateBase fragmentTags(m_keys + numBytesGlobal, numBytesFrag);
+		STagStateBase globalMasks(m_comparisonMasks, numBytesGlobal);
+		STagStateBase fragmentMasks(m_comparisonMasks + numBytesGlobal, numBytesFrag);
+
+		const STagStateBase queryGlobalTags(compressedGlobalTags);
+		const STagStateBase queryFragmentTags(fragTags.fragmentTags);
 
 		for (uint32 i = 0; i < numEntries; i++)
 		{
-			if (m_pDefData->Contains(compressedGlobalTags, globalTags)
-			    && (!m_pFragDefData || m_pFragDefData->Contains(fragTags.fragmentTags, fragmentTags)))
+			if (queryGlobalTags.Contains(globalTags, globalMasks, numBytesGlobal)
+			    && (!m_pFragDefData || queryFragmentTags.Contains(fragmentTags, fragmentMasks, numBytesFrag)))
 			{
 				if (pFragTagsMatched)
 				{
@@ -1837,6 +1844,8 @@ public:
 
 			globalTags.state += m_keySize;
 			fragmentTags.state += m_keySize;
+			globalMasks.state += m_keySize;
+			fragmentMasks.state += m_keySize;
 		}
 
 		return NULL;
@@ -1856,14 +1865,19 @@ public:
 
 			STagStateBase globalTags(m_keys, numBytesGlobal);
 			STagStateBase fragmentTags(m_keys + numBytesGlobal, numBytesFrag);
+			STagStateBase globalMasks(m_comparisonMasks, numBytesGlobal);
+			STagStateBase fragmentMasks(m_comparisonMasks + numBytesGlobal, numBytesFrag);
+
+			const STagStateBase queryGlobalTags(compressedGlobalTags);
+			const STagStateBase queryFragmentTags(fragTags.fragmentTags);
 
 			const TagState requiredComparisonMask = m_pDefData->GenerateMask(compressedReqTags);
 
 			for (uint32 i = 0; i < numEntries; i++)
 			{
 				if (m_pDefData->Contains(globalTags, compressedReqTags, requiredComparisonMask)
-				    && m_pDefData->Contains(compressedGlobalTags, globalTags)
-				    && (!m_pFragDefData || m_pFragDefData->Contains(fragTags.fragmentTags, fragmentTags)))
+				    && queryGlobalTags.Contains(globalTags, globalMasks, numBytesGlobal)
+				    && (!m_pFragDefData || queryFragmentTags.Contains(fragmentTags, fragmentMasks, numBytesFrag)))
 				{
 					if (pFragTagsMatched)
 					{
@@ -1880,6 +1894,8 @@ public:
 
 				globalTags.state += m_keySize;
 				fragmentTags.state += m_keySize;
+				globalMasks.state += m_keySize;
+				fragmentMasks.state += m_keySize;
 			}
 		}
 
@@ -1903,6 +1919,7 @@ private:
 	const CTagDefinition::STagDefData* m_pFragDefData;
 
 	uint8*                             m_keys;
+	uint8*                             m_comparisonMasks;                  // per key GenerateMask() result, laid out like m_keys
 	T* m_values;
 	uint32                             m_size;
 	uint32                             m_keySize;
@@ -2134,6 +2151,22 @@ public:
 			}
 		}
 
+		//--- Precompute the group comparison masks so queries don't regenerate them per key
+		for (uint32 i = 0; i < size; i++)
+		{
+			uint8* pKey = pOptimisedList->m_keys + (i * bytesTotal);
+			uint8* pMask = pOptimisedList->m_comparisonMasks + (i * bytesTotal);
+
+			const TagState globalMask = pTagDefData->GenerateMask(STagStateBase(pKey, bytesGlobal));
+			memcpy(pMask, static_cast<const STagStateBase>(globalMask).state, bytesGlobal);
+
+			if (pFragData)
+			{
+				const TagState fragMask = pFragData->GenerateMask(STagStateBase(pKey + bytesGlobal, bytesFrag));
+				memcpy(pMask + bytesGlobal, static_cast<const STagStateBase>(fragMask).state, bytesFrag);
+			}
+		}
+
 		return pOptimisedList;
 	}
 
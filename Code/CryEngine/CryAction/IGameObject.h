@@ -251,6 +251,8 @@ public:
 	virtual void                       EnablePostUpdates(IGameObjectExtension* pExtension) = 0;
 	virtual void                       DisablePostUpdates(IGameObjectExtension* pExtension) = 0;
 	virtual void                       SetUpdateSlotEnableCondition(IGameObjectExtension* pExtension, int slot, EUpdateEnableCondition condition) = 0;
+	// throttle an update slot to run at most once per interval (in seconds, 0 updates every frame); the accumulated frame time is passed on
+	virtual void                       SetUpdateSlotInterval(IGameObjectExtension* pExtension, int slot, float interval) = 0;
 	virtual void                       PostUpdate(float frameTime) = 0;
 	virtual IWorldQuery*               GetWorldQuery() = 0;
 
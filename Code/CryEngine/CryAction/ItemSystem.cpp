@@ -22,6 +22,7 @@
 
 #include <CryEntitySystem/IEntitySystem.h>
 #include <CryAnimation/ICryAnimation.h>
+#include <CryParticleSystem/IParticlesPfx2.h>
 #include <IVehicleSystem.h>
 #include "ItemParams.h"
 #include "EquipmentManager.h"
@@ -889,6 +890,44 @@ void CItemSystem::CacheItemGeometry(const char* className)
 	}
 }
 
+//------------------------------------------------------------------------
+namespace
+{
+void PreloadParticleEffects(pfx2::IParticleSystem* pParticleSystem, const IItemParamsNode* node)
+{
+	for (int i = 0, n = node->GetAttributeCount(); i < n; ++i)
+	{
+		const char* value = node->GetAttribute(i);
+		if (value && !stricmp(PathUtil::GetExt(value), "pfx"))
+			pParticleSystem->PreloadEffect(value);
+	}
+	for (int i = 0, n = node->GetChildCount(); i < n; ++i)
+		PreloadParticleEffects(pParticleSystem, node->GetChild(i));
+}
+}
+
+void CItemSystem::CacheItemParticles(const char* className)
+{
+	LOADING_TIME_PROFILE_SECTION(gEnv->pSystem);
+	if (m_itemParamsFlushed)
+		return;
+
+	TItemParamsMap::iterator it = m_params.find(CONST_TEMP_STRING(className));
+	if (it == m_params.end())
+		return;
+
+	if ((it->second.precacheFlags & SItemParamsDesc::eIF_PreCached_Particles) == 0)
+	{
+		// Only pfx2 effects are referenced by file name
+		std::shared_ptr<pfx2::IParticleSystem> pParticleSystem = pfx2::GetIParticleSystem();
+		const IItemParamsNode* root = GetItemParams(className);
+		if (pParticleSystem && root)
+			PreloadParticleEffects(pParticleSystem.get(), root);
+
+		it->second.precacheFlags |= SItemParamsDesc::eIF_PreCached_Particles;
+	}
+}
+
 //------------------------------------------------------------------------
 void CItemSystem::CacheItemSound(const char* className)
 {
@@ -1045,6 +1084,7 @@ void CItemSystem::PrecacheLevel()
 		{
 			CacheItemGeometry(pEntity->GetClass()->GetName());
 			CacheItemSound(pEntity->GetClass()->GetName());
+			CacheItemParticles(pEntity->GetClass()->GetName());
 		}
 	}
 
@@ -80,6 +80,8 @@ public:
 	virtual void                   CacheItemSound(const char* className);
 	virtual void                   ClearSoundCache();
 
+	void                           CacheItemParticles(const char* className);
+
 	virtual EntityId               GiveItem(IActor* pActor, const char* item, bool sound, bool select = true, bool keepHistory = true, const char* setup = NULL, EEntityFlags entityFlags = (EEntityFlags)0);
 	virtual void                   SetActorItem(IActor* pActor, EntityId itemId, bool keepHistory);
 	virtual void                   SetActorItem(IActor* pActor, const char* name, bool keepHistory);
@@ -183,8 +185,9 @@ private:
 	{
 		enum ItemFlags
 		{
-			eIF_PreCached_Sound    = 1 << 0,
-			eIF_PreCached_Geometry = 1 << 1
+			eIF_PreCached_Sound     = 1 << 0,
+			eIF_PreCached_Geometry  = 1 << 1,
+			eIF_PreCached_Particles = 1 << 2
 		};
 
 		SItemParamsDesc() : precacheFlags(0), params(0) {};
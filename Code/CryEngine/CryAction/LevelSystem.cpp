@@ -1365,12 +1365,19 @@ ILevelInfo* CLevelSystem::LoadLevel(const char* _levelName)
 			pCustomActionManager->LoadLibraryActions(CUSTOM_ACTIONS_PATH);
 		}
 
-		CCryAction::GetCryAction()->GetIGameRulesSystem()->CreateGameRules(CCryAction::GetCryAction()->GetGameContext()->GetRequestedGameRules());
+		{
+			LOADING_TIME_PROFILE_SECTION_NAMED("CLevelSystem::LoadLevel create game rules");
+			CCryAction::GetCryAction()->GetIGameRulesSystem()->CreateGameRules(CCryAction::GetCryAction()->GetGameContext()->GetRequestedGameRules());
+		}
 
 		string missionXml = pLevelInfo->GetDefaultGameType()->xmlFile;
 		string xmlFile = string(pLevelInfo->GetPath()) + "/" + missionXml;
 
-		XmlNodeRef rootNode = m_pSystem->LoadXmlFromFile(xmlFile.c_str());
+		XmlNodeRef rootNode;
+		{
+			LOADING_TIME_PROFILE_SECTION_NAMED_ARGS("CLevelSystem::LoadLevel mission xml", xmlFile.c_str());
+			rootNode = m_pSystem->LoadXmlFromFile(xmlFile.c_str());
+		}
 		if (rootNode)
 		{
 			INDENT_LOG_DURING_SCOPE(true, "Reading '%s'", xmlFile.c_str());
@@ -1415,7 +1422,10 @@ ILevelInfo* CLevelSystem::LoadLevel(const char* _levelName)
 
 		CCryAction::GetCryAction()->GetIMaterialEffects()->PreLoadAssets();
 
-		gEnv->pFlowSystem->Reset(false);
+		{
+			LOADING_TIME_PROFILE_SECTION_NAMED("CLevelSystem::LoadLevel flow system reset");
+			gEnv->pFlowSystem->Reset(false);
+		}
 
 		{
 #if LEVEL_SYSTEM_SPAWN_ENTITIES_DURING_LOADING_COMPLETE_NOTIFICATION
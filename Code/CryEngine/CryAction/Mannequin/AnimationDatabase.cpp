@@ -1811,3 +1811,18 @@ void CAnimationDatabase::QueryUsedTags(const FragmentID fragmentID, const SFragT
 		fragmentEntry.tagSetList.QueryUsedTags(usedTags, filter, m_pTagDef, pFragTagDef);
 	}
 }
+
+void CAnimationDatabase::QueryBlendTargets(const FragmentID fragmentIDFrom, DynArray<FragmentID>& targets) const
+{
+	targets.clear();
+
+	// the blends are sorted by source fragment, so all transitions out of fragmentIDFrom are adjacent
+	const SFragmentBlendID firstBlendID = { fragmentIDFrom, FRAGMENT_ID_INVALID };
+	for (TFragmentBlendDatabase::const_iterator iter = m_fragmentBlendDB.lower_bound(firstBlendID); (iter != m_fragmentBlendDB.end()) && (iter->first.fragFrom == fragmentIDFrom); ++iter)
+	{
+		if (iter->first.fragTo != FRAGMENT_ID_INVALID)
+		{
+			targets.push_back(iter->first.fragTo);
+		}
+	}
+}
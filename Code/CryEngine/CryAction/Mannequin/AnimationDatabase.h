@@ -259,6 +259,7 @@ public:
 	}
 
 	virtual void QueryUsedTags(const FragmentID fragmentID, const SFragTagState& filter, SFragTagState& usedTags) const;
+	virtual void QueryBlendTargets(const FragmentID fragmentIDFrom, DynArray<FragmentID>& targets) const;
 
 	void         DeleteFragmentID(FragmentID fragmentID);
 
@@ -0,0 +1,162 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "StdAfx.h"
+#include <ICryMannequin.h>
+#include <CrySystem/CryUnitTest.h>
+
+#if defined(CRY_UNIT_TESTING)
+
+CRY_UNIT_TEST_SUITE(MannequinFragmentSelection)
+{
+	enum
+	{
+		kGroupCount         = 10,  // stance, weapon, item, pose, ... each with a handful of exclusive tags
+		kTagsPerGroup       = 5,
+		kLooseTagCount      = 30,
+		kFragmentCount      = 120, // fragment ids of a full player controller
+		kTagSetsPerFragment = 24,
+		kQueryCount         = 64,  // tag states the controller runs through while playing
+	};
+
+	// deterministic value in [0,1)
+	float Hash01(uint32 n)
+	{
+		n = (n ^ 61) ^ (n >> 16);
+		n *= 9;
+		n ^= n >> 4;
+		n *= 0x27d4eb2d;
+		n ^= n >> 15;
+		return (n & 0xffffff) * (1.0f / 0x1000000);
+	}
+
+	typedef TTagSortedList<uint32>          TTagSetList;
+	typedef TOptimisedTagSortedList<uint32> TCompiledTagSetList;
+
+	// The tag sets of every fragment, once as edited and once compiled the way CAnimationDatabase::CompressFragmentID does it
+	struct SPlayerDatabase
+	{
+		SPlayerDatabase()
+			: lists(kFragmentCount)
+			, compiledLists(kFragmentCount)
+		{
+			for (int g = 0; g < kGroupCount; ++g)
+			{
+				stack_string groupName;
+				groupName.Format("Group%d", g);
+				for (int t = 0; t < kTagsPerGroup; ++t)
+					tagDef.AddTag(stack_string().Format("Group%dTag%d", g, t).c_str(), groupName.c_str(), t % 3);
+			}
+			for (int t = 0; t < kLooseTagCount; ++t)
+				tagDef.AddTag(stack_string().Format("Tag%d", t).c_str(), NULL, t % 4);
+			tagDef.AssignBits();
+
+			for (int f = 0; f < kFragmentCount; ++f)
+			{
+				// the tag sets only use a few tags each, the empty one is the fallback
+				for (int s = 0; s + 1 < kTagSetsPerFragment; ++s)
+					lists[f].Insert(SFragTagState(MakeTagState(f * 1000 + s, 0.15f, 0.05f)), s);
+				lists[f].Insert(SFragTagState(), kTagSetsPerFragment - 1);
+				lists[f].Sort(tagDef, NULL);
+				compiledLists[f] = lists[f].Compress(tagDef, NULL);
+			}
+
+			for (int q = 0; q < kQueryCount; ++q)
+				queries.push_back(SFragTagState(MakeTagState(500000 + q, 0.6f, 0.3f)));
+		}
+
+		~SPlayerDatabase()
+		{
+			for (TCompiledTagSetList* pCompiledList : compiledLists)
+				delete pCompiledList;
+		}
+
+		TagState MakeTagState(uint32 seed, float groupChance, float looseChance) const
+		{
+			TagState tagState(TAG_STATE_EMPTY);
+			TagID tagID = 0;
+			for (int g = 0; g < kGroupCount; ++g, tagID += kTagsPerGroup)
+			{
+				if (Hash01(seed * 131 + g) < groupChance)
+					tagDef.Set(tagState, tagID + (TagID)(Hash01(seed * 131 + g + 64) * kTagsPerGroup), true);
+			}
+			for (int t = 0; t < kLooseTagCount; ++t, ++tagID)
+			{
+				if (Hash01(seed * 131 + t + 128) < looseChance)
+					tagDef.Set(tagState, tagID, true);
+			}
+			return tagState;
+		}
+
+		CTagDefinition                    tagDef;
+		std::vector<TTagSetList>          lists;
+		std::vector<TCompiledTagSetList*> compiledLists;
+		std::vector<SFragTagState>        queries;
+	};
+
+	CRY_UNIT_TEST(CUT_CompiledTagSetsMatchEditedTagSets)
+	{
+		SPlayerDatabase database;
+		const TagState requiredTags = database.MakeTagState(7, 0.0f, 0.1f);
+
+		int nMatches = 0;
+		for (int f = 0; f < kFragmentCount; ++f)
+		{
+			for (const SFragTagState& query : database.queries)
+			{
+				uint32 tagSetIdx = TAG_SET_IDX_INVALID, compiledTagSetIdx = TAG_SET_IDX_INVALID;
+				const uint32* pValue = database.lists[f].GetBestMatch(query, &database.tagDef, NULL, NULL, &tagSetIdx);
+				const uint32* pCompiledValue = database.compiledLists[f]->GetBestMatch(query, NULL, &compiledTagSetIdx);
+				CRY_UNIT_TEST_ASSERT(pValue && pCompiledValue);
+				CRY_UNIT_TEST_CHECK_EQUAL(*pValue, *pCompiledValue);
+				CRY_UNIT_TEST_CHECK_EQUAL(tagSetIdx, compiledTagSetIdx);
+				nMatches += *pValue != kTagSetsPerFragment - 1;
+
+				// with required tags the fallback may not qualify any more
+				pValue = database.lists[f].GetBestMatch(query, requiredTags, &database.tagDef, NULL);
+				pCompiledValue = database.compiledLists[f]->GetBestMatch(query, requiredTags);
+				CRY_UNIT_TEST_CHECK_EQUAL(pValue != NULL, pCompiledValue != NULL);
+				if (pValue && pCompiledValue)
+					CRY_UNIT_TEST_CHECK_EQUAL(*pValue, *pCompiledValue);
+			}
+		}
+		// most queries have to pick a specific tag set, otherwise only the fallback is tested
+		CRY_UNIT_TEST_ASSERT(nMatches > kFragmentCount * kQueryCount / 4);
+	}
+
+	// Fragment selection of one player controller: every fragment id queried with every tag state.
+	// The compiled lists are what CAnimationDatabase queries at runtime, the edited lists compare full tag states
+	// and regenerate the group masks per key, like the compiled lists did before the masks were stored.
+	struct SFragmentSelectionBenchmark : public CryUnitTest::SBenchmark
+	{
+		SFragmentSelectionBenchmark() : m_pDatabase(nullptr) {}
+
+		virtual void Init() override { m_pDatabase = new SPlayerDatabase(); }
+		virtual void Done() override { SAFE_DELETE(m_pDatabase); }
+
+		SPlayerDatabase* m_pDatabase;
+	};
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_FragmentSelectionCompiled, SFragmentSelectionBenchmark)
+	{
+		uint32 sum = 0;
+		for (const TCompiledTagSetList* pCompiledList : m_pDatabase->compiledLists)
+		{
+			for (const SFragTagState& query : m_pDatabase->queries)
+				sum += *pCompiledList->GetBestMatch(query);
+		}
+		CRY_UNIT_BENCHMARK_KEEP(sum);
+	}
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_FragmentSelectionEdited, SFragmentSelectionBenchmark)
+	{
+		uint32 sum = 0;
+		for (const TTagSetList& list : m_pDatabase->lists)
+		{
+			for (const SFragTagState& query : m_pDatabase->queries)
+				sum += *list.GetBestMatch(query, &m_pDatabase->tagDef, NULL);
+		}
+		CRY_UNIT_BENCHMARK_KEEP(sum);
+	}
+}
+
+#endif // CRY_UNIT_TESTING
@@ -65,6 +65,7 @@ CMaterialEffects::CMaterialEffects()
 	: m_bDataInitialized(false)
 	, m_listeners(4)
 	, m_pAnimFXEvents(nullptr)
+	, m_nextRecentEffect(0)
 {
 	m_bUpdateMode = false;
 	m_defaultSurfaceId = MaterialEffectsUtils::FindSurfaceIdByName(MATERIAL_EFFECTS_SURFACE_TYPE_DEFAULT);
@@ -171,6 +172,9 @@ bool CMaterialEffects::ExecuteEffect(TMFXEffectId effectId, SMFXRunTimeEffectPar
 	if (!CMaterialEffectsCVars::Get().mfx_Enable)
 		return false;
 
+	if (CoalesceEffect(effectId, params.pos))
+		return false;
+
 	bool success = false;
 	TMFXContainerPtr pEffectContainer = InternalGetEffect(effectId);
 	if (pEffectContainer)
@@ -201,6 +205,30 @@ bool CMaterialEffects::ExecuteEffect(TMFXEffectId effectId, SMFXRunTimeEffectPar
 	return success;
 }
 
+bool CMaterialEffects::CoalesceEffect(TMFXEffectId effectId, const Vec3& pos)
+{
+	const CMaterialEffectsCVars& cvars = CMaterialEffectsCVars::Get();
+	if (cvars.mfx_CoalesceRadius <= 0.0f || cvars.mfx_CoalesceTime <= 0.0f || effectId == InvalidEffectId || pos.IsZero())
+		return false;
+
+	const float currTime = gEnv->pTimer->GetCurrTime();
+	const float radiusSq = sqr(cvars.mfx_CoalesceRadius);
+
+	for (const SRecentEffect& recent : m_recentEffects)
+	{
+		if (recent.effectId == effectId && (currTime - recent.time) <= cvars.mfx_CoalesceTime && recent.pos.GetSquaredDistance(pos) <= radiusSq)
+			return true;
+	}
+
+	SRecentEffect& slot = m_recentEffects[m_nextRecentEffect];
+	slot.effectId = effectId;
+	slot.pos = pos;
+	slot.time = currTime;
+	m_nextRecentEffect = (m_nextRecentEffect + 1) % kNumRecentEffects;
+
+	return false;
+}
+
 void CMaterialEffects::StopEffect(TMFXEffectId effectId)
 {
 	TMFXContainerPtr pEffectContainer = InternalGetEffect(effectId);
@@ -665,20 +693,25 @@ void CMaterialEffects::FullReload()
 void CMaterialEffects::Update(float frameTime)
 {
 	SetUpdateMode(true);
-	std::vector<SDelayedEffect>::iterator it = m_delayedEffects.begin();
-	std::vector<SDelayedEffect>::iterator next = it;
-	while (it != m_delayedEffects.end())
+
+	// Execute expired effects and compact the remaining ones in a single pass
+	size_t numRemaining = 0;
+	for (size_t i = 0, numDelayed = m_delayedEffects.size(); i < numDelayed; ++i)
 	{
-		++next;
-		SDelayedEffect& cur = *it;
+		SDelayedEffect& cur = m_delayedEffects[i];
 		cur.m_delay -= frameTime;
 		if (cur.m_delay <= 0.0f)
 		{
 			cur.m_pEffectContainer->Execute(cur.m_effectRuntimeParams);
-			next = m_delayedEffects.erase(it);
 		}
-		it = next;
+		else
+		{
+			if (numRemaining != i)
+				m_delayedEffects[numRemaining] = cur;
+			++numRemaining;
+		}
 	}
+	m_delayedEffects.resize(numRemaining);
 
 #ifdef MATERIAL_EFFECTS_DEBUG
 	if (CMaterialEffectsCVars::Get().mfx_DebugVisual)
@@ -60,6 +60,22 @@ private:
 
 	typedef std::vector<SDelayedEffect> TDelayedEffects;
 
+	struct SRecentEffect
+	{
+		SRecentEffect()
+			: effectId(InvalidEffectId)
+			, pos(ZERO)
+			, time(-1.0f)
+		{
+		}
+
+		TMFXEffectId effectId;
+		Vec3         pos;
+		float        time;
+	};
+
+	enum { kNumRecentEffects = 32 };
+
 public:
 	CMaterialEffects();
 	virtual ~CMaterialEffects();
@@ -117,6 +133,9 @@ private:
 	void LoadSpreadSheet();
 	void LoadFXLibrary(const char* name);
 
+	// returns true if the same effect was recently executed close to the given position
+	bool CoalesceEffect(TMFXEffectId effectId, const Vec3& pos);
+
 	// schedule effect
 	void TimedEffect(TMFXContainerPtr pEffectContainer, const SMFXRunTimeEffectParams& params);
 
@@ -184,6 +203,10 @@ private:
 	// runtime effects which are delayed
 	TDelayedEffects m_delayedEffects;
 
+	// ring buffer of recently executed positional effects, used for coalescing
+	SRecentEffect m_recentEffects[kNumRecentEffects];
+	int           m_nextRecentEffect;
+
 #ifdef MATERIAL_EFFECTS_DEBUG
 	friend class MaterialEffectsUtils::CVisualDebug;
 
@@ -61,6 +61,8 @@ CMaterialEffectsCVars::CMaterialEffectsCVars()
 	REGISTER_CVAR(mfx_pfx_maxScale, 1.5f, 0, "Max scale (when particle is far)");
 	REGISTER_CVAR(mfx_pfx_maxDist, 35.0f, 0, "Max dist (how far away before scale is clamped)");
 	REGISTER_CVAR(mfx_Timeout, 0.01f, 0, "Timeout (in seconds) to avoid playing effects too often");
+	REGISTER_CVAR(mfx_CoalesceRadius, 0.25f, 0, "Radius (in meters) within which repeated executions of the same effect are coalesced. 0 = Off");
+	REGISTER_CVAR(mfx_CoalesceTime, 0.05f, 0, "Time window (in seconds) within which repeated executions of the same effect are coalesced. 0 = Off");
 	REGISTER_CVAR(mfx_EnableFGEffects, 1, VF_CHEAT, "Enabled Flowgraph based Material effects. Default: On");
 	REGISTER_CVAR(mfx_EnableAttachedEffects, 1, VF_CHEAT, "Enable attached effects (characters, entities...)");
 	REGISTER_CVAR(mfx_SerializeFGEffects, 1, VF_CHEAT, "Serialize Flowgraph based effects. Default: On");
@@ -92,6 +94,8 @@ CMaterialEffectsCVars::~CMaterialEffectsCVars()
 	pConsole->UnregisterVariable("mfx_pfx_maxScale", true);
 	pConsole->UnregisterVariable("mfx_pfx_maxDist", true);
 	pConsole->UnregisterVariable("mfx_Timeout", true);
+	pConsole->UnregisterVariable("mfx_CoalesceRadius", true);
+	pConsole->UnregisterVariable("mfx_CoalesceTime", true);
 	pConsole->UnregisterVariable("mfx_EnableFGEffects", true);
 	pConsole->UnregisterVariable("mfx_EnableAttachedEffects", true);
 	pConsole->UnregisterVariable("mfx_SerializeFGEffects", true);
@@ -43,6 +43,11 @@ public:
 	// Therefore a tweakeable timeout
 	float mfx_Timeout;
 
+	// Repeated executions of the same effect within mfx_CoalesceRadius meters and
+	// mfx_CoalesceTime seconds of each other are merged into the first one.
+	float mfx_CoalesceRadius;
+	float mfx_CoalesceTime;
+
 	static inline CMaterialEffectsCVars& Get()
 	{
 		assert(s_pThis != 0);
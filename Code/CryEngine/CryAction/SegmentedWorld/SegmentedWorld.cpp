@@ -310,10 +310,9 @@ bool CSegmentedWorld::MoveToSegment(int x, int y)
 	return true;
 }
 
-Vec2i CSegmentedWorld::SelectSegmentToUpdate(const Vec2i& focalPointWC)
+bool CSegmentedWorld::SelectSegmentToUpdate(const Vec2i& focalPointWC, Vec2i& segmentToUpdateWC)
 {
 	// Select the segment closest to the player to update
-	Vec2i segmentToUpdateWC = Vec2i(0, 0);
 	int segmentToUpdateDistance = INT_MAX;
 	for (int x = m_neededSegmentsMin.x; x < m_neededSegmentsMax.x; ++x)
 	{
@@ -328,23 +327,29 @@ Vec2i CSegmentedWorld::SelectSegmentToUpdate(const Vec2i& focalPointWC)
 				segmentToUpdateDistance = distance;
 			}
 		}
-		// Also consider all segments outside the boundaries
-		for (int i = 0; i < m_arrSegments.size(); ++i)
+	}
+
+	// Also consider all segments outside the boundaries for unloading.
+	// Segments within the unload margin are kept around unless the pool budget is exceeded,
+	// so that moving back and forth along a segment border does not reload them every time.
+	const int gridSize = CCryActionCVars::Get().sw_gridSize;
+	const int unloadMargin = (int)m_arrSegments.size() > gridSize * gridSize * 2 ? 0 : max(CCryActionCVars::Get().sw_unloadMargin, 0);
+	for (int i = 0; i < m_arrSegments.size(); ++i)
+	{
+		Vec2i wc = Vec2i(m_arrSegments[i]->m_wx, m_arrSegments[i]->m_wy);
+		if (wc.x < m_neededSegmentsMin.x - unloadMargin || wc.x >= m_neededSegmentsMax.x + unloadMargin ||
+		    wc.y < m_neededSegmentsMin.y - unloadMargin || wc.y >= m_neededSegmentsMax.y + unloadMargin)
 		{
-			Vec2i wc = Vec2i(m_arrSegments[i]->m_wx, m_arrSegments[i]->m_wy);
-			if (wc.x < m_neededSegmentsMin.x || wc.x >= m_neededSegmentsMax.x ||
-			    wc.y < m_neededSegmentsMin.y || wc.y >= m_neededSegmentsMax.y)
+			int distance = (focalPointWC - wc).GetLength2();
+			if (distance < segmentToUpdateDistance)
 			{
-				int distance = (focalPointWC - wc).GetLength2();
-				if (distance < segmentToUpdateDistance)
-				{
-					segmentToUpdateWC = wc;
-					segmentToUpdateDistance = distance;
-				}
+				segmentToUpdateWC = wc;
+				segmentToUpdateDistance = distance;
 			}
 		}
 	}
-	return segmentToUpdateWC;
+
+	return segmentToUpdateDistance != INT_MAX;
 }
 
 void CSegmentedWorld::AdjustGlobalObjects()
@@ -482,8 +487,14 @@ void CSegmentedWorld::Update()
 	}
 
 	gEnv->p3DEngine->SetSegmentOperationInProgress(true);
-	Vec2i wc = SelectSegmentToUpdate(m_gridFocalPointWC);
-	UpdateSegment(wc.x, wc.y);
+	Vec2i wc;
+	for (int i = 0, numUpdates = max(CCryActionCVars::Get().sw_segmentUpdatesPerFrame, 1); i < numUpdates; ++i)
+	{
+		if (!SelectSegmentToUpdate(m_gridFocalPointWC, wc))
+			break;
+
+		UpdateSegment(wc.x, wc.y);
+	}
 	gEnv->p3DEngine->SetSegmentOperationInProgress(false);
 
 	// display debug info on screen
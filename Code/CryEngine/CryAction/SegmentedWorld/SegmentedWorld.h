@@ -175,8 +175,9 @@ protected:
 	// Determine whether a segment needs to be updated with the given coordinate
 	bool NeedToUpdateSegment(int wx, int wy);
 
-	// Select a segment to update with the highest priority according to the focal point
-	Vec2i SelectSegmentToUpdate(const Vec2i& focalPointWC);
+	// Select a segment to update with the highest priority according to the focal point.
+	// Returns false if no segment needs to be loaded, streamed or unloaded.
+	bool SelectSegmentToUpdate(const Vec2i& focalPointWC, Vec2i& segmentToUpdateWC);
 
 	//adjust Entity position with GlobalInSW.
 	void AdjustGlobalObjects();
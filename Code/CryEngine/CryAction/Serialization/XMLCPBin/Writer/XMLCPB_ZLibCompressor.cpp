@@ -133,6 +133,7 @@ public:
 	{
 		SignalStopWork();
 		gEnv->pThreadManager->JoinThread(this, eJM_Join);
+		ReleaseFreeBuffers();
 	}
 
 	// Start accepting work on thread
@@ -142,7 +143,7 @@ public:
 		{
 			m_event.Wait();
 
-			uint8* pZLibCompressedBuffer = AllocateBlock();
+			uint8* pZLibCompressedBuffer = AllocateBuffer();
 
 			while (!m_files.empty())
 			{
@@ -154,7 +155,8 @@ public:
 				{
 					if (pFile->m_blocks.empty())
 					{
-						CrySleep(1); // yield to give other threads a chance to do some work
+						// AddBlock and Close both signal the event, so sleep until the writer has produced more work.
+						m_event.Wait();
 					}
 
 					while (!pFile->m_blocks.empty())
@@ -192,7 +194,7 @@ public:
 				delete pFile;
 			}
 
-			FreeBlock(pZLibCompressedBuffer);
+			FreeBuffer(pZLibCompressedBuffer);
 		}
 	}
 
@@ -240,14 +242,35 @@ public:
 		m_bufferAvailableLock.Unlock();
 	}
 
-	static uint8* AllocateBlock()
+	// Buffers are recycled between blocks, a save streams many blocks of the same size through the queue.
+	uint8* AllocateBuffer()
 	{
+		{
+			CryAutoCriticalSection lock(m_freeBuffersLock);
+			if (!m_freeBuffers.empty())
+			{
+				uint8* pBuffer = m_freeBuffers.back();
+				m_freeBuffers.pop_back();
+				return pBuffer;
+			}
+		}
 		return new uint8[XMLCPB_ZLIB_BUFFER_SIZE];
 	}
 
-	static void FreeBlock(uint8* pBlock)
+	void FreeBuffer(uint8* pBuffer)
 	{
-		delete[] pBlock;
+		CryAutoCriticalSection lock(m_freeBuffersLock);
+		m_freeBuffers.push_back(pBuffer);
+	}
+
+	void ReleaseFreeBuffers()
+	{
+		CryAutoCriticalSection lock(m_freeBuffersLock);
+		for (uint8* pBuffer : m_freeBuffers)
+		{
+			delete[] pBuffer;
+		}
+		stl::free_container(m_freeBuffers);
 	}
 
 private:
@@ -256,6 +279,8 @@ private:
 	CryEvent                            m_event;
 	CryConditionVariable                m_bufferAvailableCond;
 	CryMutex                            m_bufferAvailableLock;
+	CryCriticalSection                  m_freeBuffersLock;
+	std::vector<uint8*>                 m_freeBuffers;
 	const int                           m_nMaxQueuedBlocks;
 	int m_nBlockCount;
 	bool                                m_bCancelled;
@@ -297,12 +322,12 @@ SZLibBlock::SZLibBlock(CZLibCompressor* pCompressor)
 	, m_ZLibBufferSizeUsed(0)
 {
 	s_pCompressorThread->IncreaseBlockCount();
-	m_pZLibBuffer = CCompressorThread::AllocateBlock();
+	m_pZLibBuffer = s_pCompressorThread->AllocateBuffer();
 }
 
 SZLibBlock::~SZLibBlock()
 {
-	CCompressorThread::FreeBlock(m_pZLibBuffer);
+	s_pCompressorThread->FreeBuffer(m_pZLibBuffer);
 	s_pCompressorThread->DecreaseBlockCount();
 }
 
@@ -459,6 +459,7 @@ CTimeDemoRecorder::CTimeDemoRecorder()
 	, m_prevGodMode(0)
 	, m_nCurrentDemoLevel(0)
 	, m_lastChainDemoTime(0.0f)
+	, m_perfRunPeakMemory(0)
 {
 	s_pTimeDemoRecorder = this;
 
@@ -514,6 +515,11 @@ CTimeDemoRecorder::CTimeDemoRecorder()
 
 	REGISTER_STRING("demo_finish_cmd", "", 0, "Console command to run when demo is finished");
 
+	REGISTER_CVAR2("demo_perf_run", &m_demo_perf_run, 0, 0, "Collect frame time, draw call, job and memory percentiles per level during playback\n"
+	               "and write them to %USER%/TestResults/PerfRun.xml. Info display is suppressed while enabled");
+	REGISTER_STRING("demo_perf_baseline", "", 0, "PerfRun.xml of a previous run to compare the perf run against");
+	REGISTER_CVAR2("demo_perf_threshold", &m_demo_perf_threshold, 10.0f, 0, "Percentage a perf run metric may exceed the baseline before it is reported as a regression");
+
 	REGISTER_CVAR2_CB("demo_num_orientations", &m_numOrientations, 1, 0, "Number of horizontal orientations to play the demo using\n"
 	                                                                     "e.g. 3 will play: looking ahead, 120deg left, 120deg right\n"
 	                                                                     "default/min: 1",
@@ -692,6 +698,7 @@ void CTimeDemoRecorder::Play(bool bEnable)
 		// Start demo playback.
 		m_lastPlayedTotalTime = 0;
 		StartSession();
+		BeginPerfRun();
 	}
 	else
 	{
@@ -701,6 +708,7 @@ void CTimeDemoRecorder::Play(bool bEnable)
 		// End demo playback.
 		m_lastPlayedTotalTime = m_totalDemoTime.GetSeconds();
 		StopSession();
+		EndPerfRun();
 	}
 	m_bRecording = false;
 	m_currentFrame = 0;
@@ -1466,7 +1474,7 @@ void CTimeDemoRecorder::PostUpdate()
 		}
 	}
 
-	if ((m_bPlaying || m_bRecording) && m_demo_noinfo <= 0)
+	if ((m_bPlaying || m_bRecording) && m_demo_noinfo <= 0 && !(m_bPlaying && m_demo_perf_run))
 		RenderInfo(1);
 }
 
@@ -1667,6 +1675,9 @@ bool CTimeDemoRecorder::PlayFrame()
 		m_currFPS = (float)(1.0 / deltaFrameTime.GetSeconds());
 		m_sumFPS += m_currFPS;
 
+		if (m_demo_perf_run)
+			SamplePerfRunFrame(deltaFrameTime.GetMilliSeconds());
+
 		if (m_currFPS > m_maxFPS)
 		{
 			m_maxFPS_Frame = m_currentFrame;
@@ -2351,6 +2362,7 @@ void CTimeDemoRecorder::StartChainDemo(const char* levelsListFilename, bool bAut
 	m_bChainloadingDemo = true;
 	EraseLogFile();
 	m_demoLevels.clear();
+	m_perfRunLevels.clear();
 	if (levelsListFilename && *levelsListFilename)
 	{
 		// Open file with list of levels for autotest.
@@ -2405,6 +2417,7 @@ void CTimeDemoRecorder::StartDemoLevel(const char** levelNames, int levelCount)
 	m_bChainloadingDemo = true;
 	EraseLogFile();
 	m_demoLevels.clear();
+	m_perfRunLevels.clear();
 
 	if (levelNames && levelCount > 0)
 	{
@@ -2523,6 +2536,190 @@ void CTimeDemoRecorder::SaveChainloadingJUnitResults()
 	testsuit->saveToFile("%USER%/TestResults/ChainLoadingJUnit.xml");
 }
 
+//////////////////////////////////////////////////////////////////////////
+namespace
+{
+// Nearest rank percentile, values must be sorted.
+float PerfRunPercentile(const std::vector<float>& sorted, float percentile)
+{
+	if (sorted.empty())
+		return 0.0f;
+	const size_t rank = (size_t)ceilf(percentile * 0.01f * (float)sorted.size());
+	return sorted[rank > 0 ? min(rank, sorted.size()) - 1 : 0];
+}
+
+void PerfRunPercentiles(std::vector<float>& values, float (&out)[3])
+{
+	std::sort(values.begin(), values.end());
+	out[0] = PerfRunPercentile(values, 50.0f);
+	out[1] = PerfRunPercentile(values, 95.0f);
+	out[2] = PerfRunPercentile(values, 99.0f);
+}
+
+const char* const s_perfRunPercentileNames[3] = { "p50", "p95", "p99" };
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CTimeDemoRecorder::BeginPerfRun()
+{
+	m_perfRunFrames.clear();
+	m_perfRunPeakMemory = 0;
+	if (m_demo_perf_run)
+		m_perfRunFrames.reserve(m_records.size() * m_maxLoops * m_numOrientations);
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CTimeDemoRecorder::SamplePerfRunFrame(float frameTime)
+{
+	SPerfRunFrame frame;
+	frame.frameTime = frameTime;
+	frame.drawCalls = gEnv->pRenderer ? gEnv->pRenderer->GetCurrentNumberOfDrawCalls() : 0;
+	frame.jobTime = 0.0f;
+#if defined(JOBMANAGER_SUPPORT_FRAMEPROFILER)
+	if (JobManager::IBackend* pBackend = gEnv->GetJobManager()->GetBackEnd(JobManager::eBET_Thread))
+	{
+		if (JobManager::IWorkerBackEndProfiler* pProfiler = pBackend->GetBackEndWorkerProfiler())
+		{
+			JobManager::SJobFrameStatsSummary summary;
+			pProfiler->GetFrameStatsSummary(summary);
+			frame.jobTime = (float)summary.nTotalExecutionTime * 0.001f;
+		}
+	}
+#endif
+	m_perfRunFrames.push_back(frame);
+
+	// Querying process memory is a system call, a few times per second is enough to catch the peak.
+	if ((m_currentFrame & 31) == 0)
+	{
+		IMemoryManager::SProcessMemInfo meminfo;
+		if (GetISystem()->GetIMemoryManager()->GetProcessMemInfo(meminfo))
+			m_perfRunPeakMemory = max(m_perfRunPeakMemory, (uint64)meminfo.WorkingSetSize);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CTimeDemoRecorder::EndPerfRun()
+{
+	if (!m_demo_perf_run || m_perfRunFrames.empty())
+		return;
+
+	SPerfRunLevel result;
+	result.level = GetCurrentLevelName();
+	result.numFrames = (int)m_perfRunFrames.size();
+	result.peakMemory = (float)m_perfRunPeakMemory / (1024.0f * 1024.0f);
+	result.numRegressions = 0;
+
+	std::vector<float> values(m_perfRunFrames.size());
+	for (size_t i = 0; i < m_perfRunFrames.size(); ++i)
+		values[i] = m_perfRunFrames[i].frameTime;
+	PerfRunPercentiles(values, result.frameTime);
+	for (size_t i = 0; i < m_perfRunFrames.size(); ++i)
+		values[i] = (float)m_perfRunFrames[i].drawCalls;
+	PerfRunPercentiles(values, result.drawCalls);
+	for (size_t i = 0; i < m_perfRunFrames.size(); ++i)
+		values[i] = m_perfRunFrames[i].jobTime;
+	PerfRunPercentiles(values, result.jobTime);
+	m_perfRunFrames.clear();
+
+	LogInfo(" Perf Run: FrameTime p50/p95/p99 %.2f/%.2f/%.2fms, DrawCalls p95 %d, Jobs p95 %.2fms, Peak Memory %.0fMb",
+	        result.frameTime[0], result.frameTime[1], result.frameTime[2], (int)result.drawCalls[1], result.jobTime[1], result.peakMemory);
+
+	// Replaying the same level again overwrites its previous result.
+	for (size_t i = 0; i < m_perfRunLevels.size(); ++i)
+	{
+		if (m_perfRunLevels[i].level == result.level)
+		{
+			m_perfRunLevels[i] = result;
+			SavePerfRunReport();
+			return;
+		}
+	}
+	m_perfRunLevels.push_back(result);
+	SavePerfRunReport();
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CTimeDemoRecorder::SavePerfRunReport()
+{
+	XmlNodeRef baseline;
+	ICVar* pBaseline = gEnv->pConsole->GetCVar("demo_perf_baseline");
+	if (pBaseline && pBaseline->GetString()[0] != '\0')
+	{
+		baseline = GetISystem()->LoadXmlFromFile(pBaseline->GetString());
+		if (!baseline)
+			CryWarning(VALIDATOR_MODULE_GAME, VALIDATOR_WARNING, "demo_perf_baseline: Failed to load %s", pBaseline->GetString());
+	}
+	const float threshold = 1.0f + max(m_demo_perf_threshold, 0.0f) * 0.01f;
+
+	int totalRegressions = 0;
+	XmlNodeRef root = GetISystem()->CreateXmlNode("perfrun");
+	for (size_t i = 0; i < m_perfRunLevels.size(); ++i)
+	{
+		SPerfRunLevel& result = m_perfRunLevels[i];
+		XmlNodeRef levelNode = root->newChild("level");
+		levelNode->setAttr("name", result.level.c_str());
+		levelNode->setAttr("frames", result.numFrames);
+
+		struct SMetric
+		{
+			const char*  name;
+			const float* values;
+			int          count;
+		};
+		const SMetric metrics[] =
+		{
+			{ "frameTime",  result.frameTime,   3 },
+			{ "drawCalls",  result.drawCalls,   3 },
+			{ "jobTime",    result.jobTime,     3 },
+			{ "peakMemory", &result.peakMemory, 1 },
+		};
+
+		XmlNodeRef baselineLevel;
+		for (int j = 0; baseline && j < baseline->getChildCount(); ++j)
+		{
+			XmlNodeRef child = baseline->getChild(j);
+			if (child->isTag("level") && stricmp(result.level.c_str(), child->getAttr("name")) == 0)
+			{
+				baselineLevel = child;
+				break;
+			}
+		}
+
+		result.numRegressions = 0;
+		for (const SMetric& metric : metrics)
+		{
+			XmlNodeRef metricNode = levelNode->newChild(metric.name);
+			XmlNodeRef baselineMetric = baselineLevel ? baselineLevel->findChild(metric.name) : XmlNodeRef();
+			for (int j = 0; j < metric.count; ++j)
+			{
+				const char* const szAttr = metric.count > 1 ? s_perfRunPercentileNames[j] : "value";
+				metricNode->setAttr(szAttr, metric.values[j]);
+
+				float baselineValue = 0.0f;
+				if (baselineMetric && baselineMetric->getAttr(szAttr, baselineValue) && baselineValue > 0.0f && metric.values[j] > baselineValue * threshold)
+				{
+					XmlNodeRef regression = levelNode->newChild("regression");
+					regression->setAttr("metric", metric.name);
+					regression->setAttr("stat", szAttr);
+					regression->setAttr("baseline", baselineValue);
+					regression->setAttr("current", metric.values[j]);
+					++result.numRegressions;
+					CryWarning(VALIDATOR_MODULE_GAME, VALIDATOR_WARNING, "Perf run regression in %s: %s %s %.2f (baseline %.2f)",
+					           result.level.c_str(), metric.name, szAttr, metric.values[j], baselineValue);
+				}
+			}
+		}
+		levelNode->setAttr("regressions", result.numRegressions);
+		totalRegressions += result.numRegressions;
+	}
+	root->setAttr("baseline", baseline ? pBaseline->GetString() : "");
+	root->setAttr("threshold", m_demo_perf_threshold);
+	root->setAttr("regressions", totalRegressions);
+
+	gEnv->pCryPak->MakeDir("%USER%/TestResults");
+	root->saveToFile("%USER%/TestResults/PerfRun.xml");
+}
+
 //////////////////////////////////////////////////////////////////////////
 void CTimeDemoRecorder::EndDemo()
 {
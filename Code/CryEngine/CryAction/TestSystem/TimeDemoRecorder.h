@@ -231,6 +231,10 @@ private:
 
 	void               StartNextChainedLevel();
 	void               SaveChainloadingJUnitResults();
+	void               BeginPerfRun();
+	void               SamplePerfRunFrame(float frameTime);
+	void               EndPerfRun();
+	void               SavePerfRunReport();
 	void               EndDemo();
 	void               QuitGame();
 	void               ProcessKeysInput();
@@ -348,6 +352,8 @@ private:
 	int                       m_demo_noinfo;
 	int                       m_demo_save_every_frame;
 	int                       m_demo_use_hmd_rotation;
+	int                       m_demo_perf_run;
+	float                     m_demo_perf_threshold;
 
 	bool                      m_bAIEnabled;
 
@@ -364,6 +370,28 @@ private:
 	std::vector<SChainDemoLevel> m_demoLevels;
 	int                          m_nCurrentDemoLevel;
 	float                        m_lastChainDemoTime;
+
+	// Perf run (demo_perf_run): raw per frame samples of the level being played.
+	struct SPerfRunFrame
+	{
+		float  frameTime; // ms
+		uint32 drawCalls;
+		float  jobTime;   // ms, total execution time of the thread back end jobs
+	};
+	// Percentile summary of one level, written to the perf run report.
+	struct SPerfRunLevel
+	{
+		string level;
+		int    numFrames;
+		float  frameTime[3];   // p50, p95, p99 in ms
+		float  drawCalls[3];   // p50, p95, p99
+		float  jobTime[3];     // p50, p95, p99 in ms
+		float  peakMemory;     // Peak working set in Mb
+		int    numRegressions; // Metrics above baseline + demo_perf_threshold
+	};
+	std::vector<SPerfRunFrame>   m_perfRunFrames;
+	std::vector<SPerfRunLevel>   m_perfRunLevels;
+	uint64                       m_perfRunPeakMemory;
 };
 
 #endif // __timedemorecorder_h__
@@ -1794,7 +1794,8 @@ void CVehicleSeat::UpdateView(SViewParams& viewParams)
 					viewParams.position = worldTM.GetTranslation();
 					viewParams.rotation = Quat(Matrix33(worldTM)).GetNormalized() * Quat::CreateRotationY(gf_PI * 0.5f);
 
-					if (ICVar* pVar = gEnv->pConsole->GetCVar("cl_fov"))
+					static CVarHandle<float> s_fov("cl_fov");
+					if (ICVar* pVar = s_fov.GetCVar())
 						viewParams.fov = DEG2RAD(pVar->GetFVal());
 					else
 						viewParams.fov = 0.0f;
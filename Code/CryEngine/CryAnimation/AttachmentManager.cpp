@@ -2002,7 +2002,8 @@ void CAttachmentManager::DrawMergedAttachments(SRendParams& rParams, const Matri
 	const bool bDrawMergedAttachments = Console::GetInst().ca_DrawAttachmentsMergedForShadows != 0;
 	if (bDrawMergedAttachments)
 	{
-		if (m_attachmentMergingRequired)
+		// merging is spread over several frames when many characters request it at once, e.g. when players join
+		if (m_attachmentMergingRequired && CAttachmentMerger::Instance().ReserveMergeThisFrame())
 			MergeCharacterAttachments();
 
 		if (passInfo.IsShadowPass())
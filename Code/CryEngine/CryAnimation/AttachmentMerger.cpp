@@ -374,6 +374,23 @@ void CAttachmentMerger::OnDeleteMergedAttachment(CAttachmentMerged* pAttachment)
 	m_bOutOfMemory = false;
 }
 
+bool CAttachmentMerger::ReserveMergeThisFrame()
+{
+	const uint32 nFrameId = g_pCharacterManager->m_nUpdateCounter;
+	if (m_nMergeFrameId != nFrameId)
+	{
+		m_nMergeFrameId = nFrameId;
+		m_nMergesThisFrame = 0;
+	}
+
+	const int nMaxMergesPerFrame = Console::GetInst().ca_AttachmentMergingMaxPerFrame;
+	if (nMaxMergesPerFrame > 0 && m_nMergesThisFrame >= uint(nMaxMergesPerFrame))
+		return false;
+
+	++m_nMergesThisFrame;
+	return true;
+}
+
 inline Vec3 toVec3(const Vec3& v)    { return v; }
 inline Vec3 toVec3(const Vec3f16& v) { return v.ToVec3(); }
 
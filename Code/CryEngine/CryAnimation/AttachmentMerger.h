@@ -127,6 +127,8 @@ public:
 		: m_nBytesAllocated(0)
 		, m_nMergedSkinCount(0)
 		, m_bOutOfMemory(false)
+		, m_nMergeFrameId(0)
+		, m_nMergesThisFrame(0)
 	{}
 
 	static CAttachmentMerger& Instance()                                 { static CAttachmentMerger instance; return instance; }
@@ -139,6 +141,10 @@ public:
 	void                      UpdateIndices(CAttachmentMerged* pAttachment, int lod, const DynArray<std::pair<uint32, uint32>>& srcRanges);
 	void                      OnDeleteMergedAttachment(CAttachmentMerged* pAttachment);
 
+	//! Returns false if ca_AttachmentMergingMaxPerFrame characters have already been merged this frame.
+	//! Characters which are denied keep rendering their attachments unmerged and retry in a later frame.
+	bool                      ReserveMergeThisFrame();
+
 	static bool               CanMerge(IAttachment* pAttachment1, IAttachment* pAttachment2);
 
 private:
@@ -153,7 +159,10 @@ private:
 	static bool       CanMerge(const MergeContext& context1, const MergeContext& context2);
 	static IMaterial* GetAttachmentMaterial(const IAttachment* pAttachment, int lod);
 
-	uint m_nMergedSkinCount;
-	uint m_nBytesAllocated;
-	bool m_bOutOfMemory;
+	uint   m_nMergedSkinCount;
+	uint   m_nBytesAllocated;
+	bool   m_bOutOfMemory;
+
+	uint32 m_nMergeFrameId;
+	uint   m_nMergesThisFrame;
 };
@@ -903,8 +903,10 @@ void CAttachmentVCLOTH::DrawAttachment(SRendParams& RendParams, const SRendering
 
 			pVertexAnimation->pRenderMeshSyncVariable = pRenderMesh->SetAsyncUpdateState();
 
+			// a simulated cloth is expensive, thus it runs in its own job instead of being appended to the
+			// character's skinning job list, where it would be processed serially after the other skins
 			SSkinningData *pCurrentJobSkinningData = *pD->m_pSkinningData->pMasterSkinningDataList;
-			if (pCurrentJobSkinningData == NULL)
+			if (pCurrentJobSkinningData == NULL || !m_clothPiece.GetSimulator().IsGpuSkinning())
 			{
 				pVertexAnimation->Begin(pD->m_pSkinningData->pAsyncJobs);
 			}
@@ -2067,8 +2069,17 @@ void CClothSimulator::PositionsProjectToProxySurface(f32 t01)
 void CClothSimulator::HandleCameraDistance()
 {
 	const f32 disableSimAtDist = m_config.disableSimulationAtDistance;
+	const f32 distSqr = GetCameraDistanceSqr();
 
-	if (CheckCameraDistanceLessThan(disableSimAtDist))
+	// reduce the solver iterations linearly from half of the disable distance on
+	m_iterationsScale = 1.0f;
+	if (Console::GetInst().ca_ClothIterationLod && disableSimAtDist > 0.0f)
+	{
+		const f32 dist01 = sqrt_tpl(distSqr) / disableSimAtDist;
+		m_iterationsScale = clamp_tpl(2.0f * (1.0f - dist01), 0.0f, 1.0f);
+	}
+
+	if (distSqr < disableSimAtDist * disableSimAtDist)
 	{
 		if (!IsSimulationEnabled() || IsFadingOut())
 		{
@@ -2128,12 +2139,23 @@ void CClothSimulator::DecreaseFadeInOutTimer(float dt)
 	}
 }
 
-bool CClothSimulator::CheckCameraDistanceLessThan(float dist) const
+float CClothSimulator::GetCameraDistanceSqr() const
 {
 	Vec3 distV = gEnv->p3DEngine->GetRenderingCamera().GetPosition() - m_pAttachmentManager->m_pSkelInstance->m_location.t; // distance vector to camera (animation pivot)
 	distV -= m_pAttachmentManager->m_pSkelInstance->GetAABB().GetCenter();                                                  // use center of actual position (determined by BB), not of pivot
-	float distSqr = distV.dot(distV);
-	return distSqr < dist * dist;
+	return distV.dot(distV);
+}
+
+bool CClothSimulator::CheckCameraDistanceLessThan(float dist) const
+{
+	return GetCameraDistanceSqr() < dist * dist;
+}
+
+int CClothSimulator::GetNumIterations() const
+{
+	if (m_config.numIterations <= 1)
+		return m_config.numIterations;
+	return max(1, int_round(m_config.numIterations * m_iterationsScale));
 }
 
 bool CClothSimulator::CheckForceSkinningByFpsThreshold()
@@ -2391,7 +2413,8 @@ int CClothSimulator::Step()
 		UpdateCollidablesLerp(stepTime01);
 
 		// constraint solver
-		for (int iter = 0; iter < m_config.numIterations; iter++)
+		const int numIterations = GetNumIterations();
+		for (int iter = 0; iter < numIterations; iter++)
 		{
 			// long range attachments
 			if (m_config.longRangeAttachments) LongRangeAttachmentsSolve();
@@ -2433,7 +2456,7 @@ int CClothSimulator::Step()
 			// collision handling - project particles lying inside collision proxies onto collision proxies surfaces
 			if (m_config.collideEveryNthStep)   // ==0 means no collision
 			{
-				if ((iter % m_config.collideEveryNthStep == 0) || (iter == m_config.numIterations - 1)) { PositionsProjectToProxySurface(stepTime01); }
+				if ((iter % m_config.collideEveryNthStep == 0) || (iter == numIterations - 1)) { PositionsProjectToProxySurface(stepTime01); }
 			}
 		}
 
@@ -3252,7 +3275,10 @@ void CClothPiece::UpdateSimulation(const DualQuat* pTransformations, const uint
 			m_simulator.SetGpuSkinning(false);
 			m_simulator.StartStep(dt, m_charLocation);
 
-			while (!m_simulator.Step()) {};
+			{
+				DEFINE_PROFILER_SECTION("CClothSimulator::Step");
+				while (!m_simulator.Step()) {};
+			}
 
 			// get the result back
 			if (m_simulator.IsFading())
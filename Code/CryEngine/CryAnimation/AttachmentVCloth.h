@@ -290,6 +290,7 @@ public:
 		, m_doSkinningForNSteps(0)
 		, m_fadeInOutPhysicsDirection(0)
 		, m_fadeTimeActual(0) // physical fade time
+		, m_iterationsScale(1.0f)
 		, m_bUseDijkstraForLRA(true)
 		, m_bIsInitialized(false)
 		, m_bIsGpuSkinning(false)
@@ -390,6 +391,12 @@ private:
 	 * @return True, if distance to camera is les than value; false, otherwise.
 	 */
 	bool CheckCameraDistanceLessThan(float dist) const;
+	float GetCameraDistanceSqr() const;
+
+	/**
+	 * Number of solver iterations for the actual substep, reduced by m_iterationsScale on distant characters.
+	 */
+	int GetNumIterations() const;
 
 	/**
 	 * Check framerate.
@@ -445,6 +452,7 @@ private:
 	float                     m_fadeTimeActual;            //!< actual fade time
 	int                       m_fadeInOutPhysicsDirection; //!< -1 fade out, 1 fade in
 	int                       m_doSkinningForNSteps;       //!< use skinning if any position change has occured, to keep simulation stable
+	float                     m_iterationsScale;           //!< scale of m_config.numIterations according to camera distance (see ca_ClothIterationLod)
 
 	Vec3                      m_externalDeltaTranslation;  //!< delta translation of locator per timestep; is used to determine external influence according to velocity
 	Vec3                      m_permCollidables0Old;       //!< to determine above m_externalDeltaTranslation per step
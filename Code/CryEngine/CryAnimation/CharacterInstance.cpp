@@ -851,11 +851,19 @@ void CCharInstance::SetupThroughParams(const SAnimationProcessParams* pParams)
 	m_SkeletonPose.m_bFullSkeletonUpdate = false;
 	int nCurrentFrameID = g_pCharacterManager->m_nUpdateCounter; // g_pIRenderer->GetFrameID(false);
 	uint32 dif = nCurrentFrameID - m_LastRenderedFrameID;
+	const bool bWasVisible = m_SkeletonPose.m_bInstanceVisible;
 	m_SkeletonPose.m_bInstanceVisible =
 	  (dif < 5) || m_SkeletonAnim.GetTrackViewStatus();
 
 	if (m_SkeletonPose.m_bInstanceVisible)
-		m_SkeletonPose.m_bFullSkeletonUpdate = true;
+	{
+		// Distant characters keep their last pose in between reduced-rate updates. The updates are staggered over
+		// the frames per instance, and a character that just became visible is always updated.
+		const uint32 nLod = bWasVisible ? GetAnimationUpdateLod(pParams->zoomAdjustedDistanceFromCamera) : 0;
+		const uint32 nPhase = uint32(UINT_PTR(this) >> 6);
+		m_SkeletonPose.m_bFullSkeletonUpdate = ((nCurrentFrameID + nPhase) & ((1 << nLod) - 1)) == 0;
+		g_pCharacterManager->m_arrAnimationUpdateLods[m_SkeletonPose.m_bFullSkeletonUpdate ? nLod : CharacterManager::NumAnimationUpdateLods]++;
+	}
 	if (m_SkeletonAnim.m_TrackViewExclusive)
 		m_SkeletonPose.m_bFullSkeletonUpdate = true;
 	if (m_SkeletonPose.m_nForceSkeletonUpdate)
@@ -864,6 +872,18 @@ void CCharInstance::SetupThroughParams(const SAnimationProcessParams* pParams)
 		m_SkeletonPose.m_bFullSkeletonUpdate = true;
 }
 
+uint32 CCharInstance::GetAnimationUpdateLod(f32 fDistance) const
+{
+	const f32 fLodDistance = Console::GetInst().ca_AnimationUpdateLodDistance * g_pCharacterManager->m_fAnimationUpdateLodScale;
+	if (fLodDistance <= 0.0f)
+		return 0;
+
+	uint32 nLod = 0;
+	for (f32 d = fLodDistance; fDistance >= d && nLod < CharacterManager::NumAnimationUpdateLods - 1; d += d)
+		nLod++;
+	return nLod;
+}
+
 //////////////////////////////////////////////////////////////////////////
 void CCharInstance::PerFrameUpdate()
 {
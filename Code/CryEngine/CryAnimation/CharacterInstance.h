@@ -145,6 +145,7 @@ private:
 	// Functions that are called from Character Instance Processing
 	void SetupThroughParent(const CCharInstance * pParent);
 	void SetupThroughParams(const SAnimationProcessParams * pParams);
+	uint32 GetAnimationUpdateLod(f32 fDistance) const;
 
 	CCharInstance(const CCharInstance &) /*= delete*/;
 	void operator=(const CCharInstance&) /*= delete*/;
@@ -53,6 +53,8 @@ CharacterManager::CharacterManager()
 	m_arrModelCacheSKIN.reserve(100);
 	g_SkeletonUpdates = 0;
 	g_AnimationUpdates = 0;
+	memset(m_arrAnimationUpdateLods, 0, sizeof(m_arrAnimationUpdateLods));
+	m_fAnimationUpdateLodScale = 1.0f;
 	m_nFrameSyncTicks = 0;
 	m_nFrameTicks = 0;
 	m_nActiveCharactersLastFrame = 0;
@@ -1775,6 +1777,22 @@ void CharacterManager::Update(bool bPaused)
 			g_YLine += 14.0f;
 		}
 	}
+	if (Console::GetInst().ca_DebugText || Console::GetInst().ca_DebugAnimUpdates)
+	{
+		float fColor[4] = { 0, 1, 1, 1 };
+		g_pAuxGeom->Draw2dLabel(1, g_YLine, 1.3f, fColor, false, "Skeleton update LODs: 1/1:%d  1/2:%d  1/4:%d  1/8:%d  skipped:%d  distance scale:%.2f", m_arrAnimationUpdateLods[0], m_arrAnimationUpdateLods[1], m_arrAnimationUpdateLods[2], m_arrAnimationUpdateLods[3], m_arrAnimationUpdateLods[NumAnimationUpdateLods], m_fAnimationUpdateLodScale);
+		g_YLine += 16.0f;
+	}
+
+	// adapt the LOD distance so that the number of visible skeleton updates per frame stays within the budget
+	const uint32 nUpdateBudget = Console::GetInst().ca_AnimationUpdateBudget;
+	const uint32 nLodUpdates = m_arrAnimationUpdateLods[0] + m_arrAnimationUpdateLods[1] + m_arrAnimationUpdateLods[2] + m_arrAnimationUpdateLods[3];
+	if (nUpdateBudget && nLodUpdates > nUpdateBudget)
+		m_fAnimationUpdateLodScale = max(m_fAnimationUpdateLodScale * 0.8f, 1.0f / 64);
+	else if (!nUpdateBudget || nLodUpdates * 10 < nUpdateBudget * 9)
+		m_fAnimationUpdateLodScale = min(m_fAnimationUpdateLodScale * 1.1f, 1.0f);
+	memset(m_arrAnimationUpdateLods, 0, sizeof(m_arrAnimationUpdateLods));
+
 	g_AnimationUpdates = 0;
 	g_SkeletonUpdates = 0;
 
@@ -223,6 +223,11 @@ public:
 	uint32                       g_SkeletonUpdates;
 	uint32                       g_AnimationUpdates;
 
+	//skeleton update rate LOD of visible instances (see ca_AnimationUpdateLodDistance)
+	enum { NumAnimationUpdateLods = 4 };
+	uint32                       m_arrAnimationUpdateLods[NumAnimationUpdateLods + 1]; //updates per LOD, the last entry counts skipped updates
+	f32                          m_fAnimationUpdateLodScale;                           //scales the LOD distance to hold ca_AnimationUpdateBudget
+
 	IAnimationStreamingListener* m_pStreamingListener;
 
 	//methods to handle animation assets
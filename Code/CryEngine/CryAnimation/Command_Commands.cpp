@@ -111,6 +111,64 @@ void LoadControllers(const GlobalAnimationHeaderCAF& rGAH, const Command::CState
 	}
 }
 
+#if CRY_PLATFORM_SSE2 && !defined(_DEBUG)
+	#define USE_POSE_BLENDING_SSE
+
+// The pose buffers are AoS arrays of QuatT. For the per-joint quaternion math of the blend commands
+// four joints at a time are transposed into x/y/z/w registers, processed, and transposed back.
+// Only the quaternion part is written, so translations and scales are left to the scalar code.
+struct SQuat4
+{
+	__m128 x, y, z, w;
+};
+
+static ILINE SQuat4 LoadQuat4(const QuatT* p)
+{
+	SQuat4 r;
+	r.x = _mm_loadu_ps(&p[0].q.v.x);
+	r.y = _mm_loadu_ps(&p[1].q.v.x);
+	r.z = _mm_loadu_ps(&p[2].q.v.x);
+	r.w = _mm_loadu_ps(&p[3].q.v.x);
+	_MM_TRANSPOSE4_PS(r.x, r.y, r.z, r.w);
+	return r;
+}
+
+//! Writes back the joints whose bit is set in storeMask.
+static ILINE void StoreQuat4(QuatT* p, SQuat4 q, uint32 storeMask)
+{
+	_MM_TRANSPOSE4_PS(q.x, q.y, q.z, q.w);
+	if (storeMask & 1) _mm_storeu_ps(&p[0].q.v.x, q.x);
+	if (storeMask & 2) _mm_storeu_ps(&p[1].q.v.x, q.y);
+	if (storeMask & 4) _mm_storeu_ps(&p[2].q.v.x, q.z);
+	if (storeMask & 8) _mm_storeu_ps(&p[3].q.v.x, q.w);
+}
+
+static ILINE __m128 Dot4(const SQuat4& a, const SQuat4& b)
+{
+	return _mm_add_ps(_mm_add_ps(_mm_mul_ps(a.x, b.x), _mm_mul_ps(a.y, b.y)), _mm_add_ps(_mm_mul_ps(a.z, b.z), _mm_mul_ps(a.w, b.w)));
+}
+
+static ILINE SQuat4 Scale4(const SQuat4& a, __m128 s)
+{
+	SQuat4 r = { _mm_mul_ps(a.x, s), _mm_mul_ps(a.y, s), _mm_mul_ps(a.z, s), _mm_mul_ps(a.w, s) };
+	return r;
+}
+
+//! Same as Quat::GetNormalized(), i.e. uses the safe reciprocal square root.
+static ILINE SQuat4 Normalize4(const SQuat4& a)
+{
+	const __m128 len2 = _mm_max_ps(Dot4(a, a), _mm_set1_ps(FLT_MIN));
+	return Scale4(a, _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(len2)));
+}
+
+//! Bit j is set when joint j of the block has the given state flag.
+static ILINE uint32 StateMask4(const JointState* pState, JointState flag)
+{
+	return ((pState[0] & flag) ? 1 : 0) | ((pState[1] & flag) ? 2 : 0) | ((pState[2] & flag) ? 4 : 0) | ((pState[3] & flag) ? 8 : 0);
+}
+
+#endif
+
 void ClearPoseBuffer::Execute(const CState& state, CEvaluationContext& context) const
 {
 	assert(m_TargetBuffer <= Command::TargetBuffer);
@@ -364,12 +422,28 @@ void AddPoseBuffer::Execute(const CState& state, CEvaluationContext& context) co
 	f32 t = ac.m_fWeight;
 
 	uint32 numJoints = state.m_jointCount;
+#ifdef USE_POSE_BLENDING_SSE
+	// QuatT is seven tightly packed floats, so the weighted add runs over the buffer as one flat float array.
+	static_assert(sizeof(QuatT) == 7 * sizeof(f32), "Invalid assumption on the layout of QuatT!");
+	f32* pDst = &parrRelPoseDst[0].q.v.x;
+	const f32* pSrc = &parrRelPoseSrc[0].q.v.x;
+	const uint32 numFloats = numJoints * 7;
+	const __m128 weight = _mm_set1_ps(t);
+	uint32 f = 0;
+	for (; f + 4 <= numFloats; f += 4)
+		_mm_storeu_ps(pDst + f, _mm_add_ps(_mm_loadu_ps(pDst + f), _mm_mul_ps(_mm_loadu_ps(pSrc + f), weight)));
+	for (; f < numFloats; f++)
+		pDst[f] += pSrc[f] * t;
+	for (uint32 i = 0; i < numJoints; i++)
+		parrStatusDst[i] |= parrStatusSrc[i];
+#else
 	for (uint32 i = 0; i < numJoints; i++)
 	{
 		parrRelPoseDst[i].q += parrRelPoseSrc[i].q * t;
 		parrRelPoseDst[i].t += parrRelPoseSrc[i].t * t;
 		parrStatusDst[i] |= parrStatusSrc[i];
 	}
+#endif
 #ifdef _DEBUG
 	for (uint32 j = 0; j < numJoints; j++)
 	{
@@ -395,7 +469,21 @@ void NormalizeFull::Execute(const CState& state, CEvaluationContext& context) co
 		parrRelPoseDst[0].q.SetIdentity();
 
 	uint32 numJoints = state.m_jointCount;
-	for (uint32 i = 1; i < numJoints; i++)
+	uint32 i = 1;
+#ifdef USE_POSE_BLENDING_SSE
+	const __m128 minDot = _mm_set1_ps(0.0001f);
+	const __m128 one = _mm_set1_ps(1.0f);
+	for (; i + 4 <= numJoints; i += 4)
+	{
+		SQuat4 q = LoadQuat4(parrRelPoseDst + i);
+		const __m128 dot = Dot4(q, q);
+		const __m128 valid = _mm_cmpgt_ps(dot, minDot);
+		q = Scale4(q, _mm_and_ps(valid, _mm_div_ps(one, _mm_sqrt_ps(dot))));
+		q.w = _mm_or_ps(q.w, _mm_andnot_ps(valid, one)); // degenerate quaternions become identity
+		StoreQuat4(parrRelPoseDst + i, q, 0xf);
+	}
+#endif
+	for (; i < numJoints; i++)
 	{
 		f32 dot = fabsf(parrRelPoseDst[i].q | parrRelPoseDst[i].q);
 		if (dot > 0.0001f)
@@ -588,12 +676,42 @@ void PerJointBlending::Execute(const CState& state, CEvaluationContext& context)
 	const auto parrRelPoseBase = static_cast<QuatT*>(context.m_buffers[m_TargetBuffer + 0]);
 	const auto parrScalingBase = static_cast<float*>(context.m_buffers[m_TargetBuffer + 3]);
 
+	// Joints below jointStartScalar already had their orientation blended by the SIMD path.
+	uint32 jointStartScalar = 0;
+
 	if (m_BlendMode)
 	{
+#ifdef USE_POSE_BLENDING_SSE
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		for (; jointStartScalar + 4 <= state.m_jointCount; jointStartScalar += 4)
+		{
+			const uint32 j = jointStartScalar;
+			const uint32 storeMask = StateMask4(parrStatusLayer + j, eJS_Orientation);
+			if (!storeMask)
+				continue;
+
+			const __m128 weight = _mm_setr_ps(parrWeightsLayer[j].x, parrWeightsLayer[j + 1].x, parrWeightsLayer[j + 2].x, parrWeightsLayer[j + 3].x);
+			const SQuat4 base = LoadQuat4(parrRelPoseBase + j);
+			SQuat4 layer = LoadQuat4(parrRelPoseLayer + j);
+
+			// Quat::CreateNlerp(IDENTITY, layer, weight): flip layer into the hemisphere of identity (layer.w >= 0).
+			layer = Scale4(layer, _mm_xor_ps(weight, _mm_and_ps(_mm_cmplt_ps(layer.w, _mm_setzero_ps()), signMask)));
+			layer.w = _mm_add_ps(layer.w, _mm_sub_ps(one, weight));
+			const SQuat4 n = Normalize4(layer);
+
+			SQuat4 q;
+			q.w = _mm_sub_ps(_mm_mul_ps(n.w, base.w), _mm_add_ps(_mm_add_ps(_mm_mul_ps(n.x, base.x), _mm_mul_ps(n.y, base.y)), _mm_mul_ps(n.z, base.z)));
+			q.x = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(n.y, base.z), _mm_mul_ps(n.z, base.y)), _mm_add_ps(_mm_mul_ps(n.w, base.x), _mm_mul_ps(n.x, base.w)));
+			q.y = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(n.z, base.x), _mm_mul_ps(n.x, base.z)), _mm_add_ps(_mm_mul_ps(n.w, base.y), _mm_mul_ps(n.y, base.w)));
+			q.z = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(n.x, base.y), _mm_mul_ps(n.y, base.x)), _mm_add_ps(_mm_mul_ps(n.w, base.z), _mm_mul_ps(n.z, base.w)));
+			StoreQuat4(parrRelPoseBase + j, q, storeMask);
+		}
+#endif
 		for (uint32 j = 0; j < state.m_jointCount; ++j)
 		{
 			// Additive Blending
-			if (parrStatusLayer[j] & eJS_Orientation)
+			if (j >= jointStartScalar && (parrStatusLayer[j] & eJS_Orientation))
 			{
 				parrRelPoseBase[j].q = Quat::CreateNlerp(IDENTITY, parrRelPoseLayer[j].q, parrWeightsLayer[j].x) * parrRelPoseBase[j].q;
 			}
@@ -609,10 +727,35 @@ void PerJointBlending::Execute(const CState& state, CEvaluationContext& context)
 	}
 	else
 	{
+#ifdef USE_POSE_BLENDING_SSE
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		for (; jointStartScalar + 4 <= state.m_jointCount; jointStartScalar += 4)
+		{
+			const uint32 j = jointStartScalar;
+			const uint32 storeMask = StateMask4(parrStatusLayer + j, eJS_Orientation);
+			if (!storeMask)
+				continue;
+
+			const __m128 weight = _mm_setr_ps(parrWeightsLayer[j].x, parrWeightsLayer[j + 1].x, parrWeightsLayer[j + 2].x, parrWeightsLayer[j + 3].x);
+			const SQuat4 base = LoadQuat4(parrRelPoseBase + j);
+			const SQuat4 layer = LoadQuat4(parrRelPoseLayer + j);
+
+			// Quaternion LERP; the layer is premultiplied by its weight and flipped into the hemisphere of the base.
+			const __m128 flip = _mm_and_ps(_mm_cmplt_ps(Dot4(base, layer), _mm_setzero_ps()), signMask);
+			const __m128 baseWeight = _mm_sub_ps(one, weight);
+			SQuat4 q;
+			q.x = _mm_add_ps(_mm_mul_ps(base.x, baseWeight), _mm_xor_ps(layer.x, flip));
+			q.y = _mm_add_ps(_mm_mul_ps(base.y, baseWeight), _mm_xor_ps(layer.y, flip));
+			q.z = _mm_add_ps(_mm_mul_ps(base.z, baseWeight), _mm_xor_ps(layer.z, flip));
+			q.w = _mm_add_ps(_mm_mul_ps(base.w, baseWeight), _mm_xor_ps(layer.w, flip));
+			StoreQuat4(parrRelPoseBase + j, Normalize4(q), storeMask);
+		}
+#endif
 		for (uint32 j = 0; j < state.m_jointCount; ++j)
 		{
 			// Override Blending
-			if (parrStatusLayer[j] & eJS_Orientation)
+			if (j >= jointStartScalar && (parrStatusLayer[j] & eJS_Orientation))
 			{
 				parrRelPoseBase[j].q = (parrRelPoseBase[j].q * (1.0f - parrWeightsLayer[j].x) + parrRelPoseLayer[j].q * fsgnnz(parrRelPoseBase[j].q | parrRelPoseLayer[j].q)).GetNormalized(); // Quaternion LERP
 			}
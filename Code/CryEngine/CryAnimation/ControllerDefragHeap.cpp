@@ -5,6 +5,39 @@
 
 #include "ControllerPQ.h"
 
+#include <CrySystem/Profilers/IStatoscope.h>
+
+#if ENABLE_STATOSCOPE
+class CControllerDefragHeapDG : public IStatoscopeDataGroup
+{
+public:
+	CControllerDefragHeapDG(CControllerDefragHeap* pHeap) : m_pHeap(pHeap) {}
+
+	virtual SDescription GetDescription() const
+	{
+		return SDescription('H', "animation defrag heap", "['/AnimDefragHeap/' (float inUseKB) (float fixedKB) (float largestFreeBlockKB) "
+		                                                  "(float fragmentationPercent) (int numAllocs) (int numMovesInFlight) (float bytesInFlightKB)]");
+	}
+
+	virtual void Write(IStatoscopeFrameRecord& fr)
+	{
+		const CControllerDefragHeap::Stats stats = m_pHeap->GetStats();
+		const size_t moveableFree = stats.defragStats.nCapacity - stats.defragStats.nInUseSize;
+
+		fr.AddValue(stats.defragStats.nInUseSize / 1024.0f);
+		fr.AddValue(stats.bytesInFixedAllocs / 1024.0f);
+		fr.AddValue(stats.defragStats.nLargestFreeBlockSize / 1024.0f);
+		fr.AddValue(stats.defragStats.nCapacity ? 100.0f * (moveableFree - stats.defragStats.nLargestFreeBlockSize) / (float)stats.defragStats.nCapacity : 0.0f);
+		fr.AddValue((int)stats.defragStats.nInUseBlocks);
+		fr.AddValue((int)stats.numCopiesInFlight);
+		fr.AddValue(stats.bytesInFlight / 1024.0f);
+	}
+
+private:
+	CControllerDefragHeap* m_pHeap;
+};
+#endif
+
 CControllerDefragHeap::CControllerDefragHeap()
 	: m_pAddressRange(NULL)
 	, m_pAllocator(NULL)
@@ -48,9 +81,15 @@ void CControllerDefragHeap::Init(size_t capacity)
 	IDefragAllocator::Policy pol;
 	pol.pDefragPolicy = this;
 	pol.maxAllocs = MaxAllocs;
+	pol.szName = "Anim Defrag Heap";
 	m_pAllocator->Init(capacity, MinAlignment, pol);
 
 	m_numAllocsPerPage.resize(capacity >> m_nLogPageSize);
+
+#if ENABLE_STATOSCOPE
+	if (gEnv->pStatoscope)
+		gEnv->pStatoscope->RegisterDataGroup(new CControllerDefragHeapDG(this));
+#endif
 }
 
 CControllerDefragHeap::Stats CControllerDefragHeap::GetStats()
@@ -59,6 +98,8 @@ CControllerDefragHeap::Stats CControllerDefragHeap::GetStats()
 
 	stats.defragStats = m_pAllocator->GetStats();
 	stats.bytesInFixedAllocs = (size_t)m_nBytesInFixedAllocs;
+	stats.numCopiesInFlight = MaxInFlightCopies - m_numAvailableCopiesInFlight;
+	stats.bytesInFlight = m_bytesInFlight;
 
 	return stats;
 }
@@ -71,9 +112,10 @@ void CControllerDefragHeap::Update()
 
 	if (m_pAllocator != nullptr)
 	{
+		const int maxScheduledBytesPerUpdate = max(0, Console::GetInst().ca_MemoryDefragMaxBytesPerUpdate);
 		m_pAllocator->DefragmentTick(
 			(size_t)min((int)MaxScheduledCopiesPerUpdate, (int)m_numAvailableCopiesInFlight),
-			(size_t)min((int)max(0, (int)MinFixedAllocSize - (int)m_bytesInFlight), (int)MaxScheduledBytesPerUpdate));
+			(size_t)min((int)max(0, (int)MinFixedAllocSize - (int)m_bytesInFlight), maxScheduledBytesPerUpdate));
 	}
 
 	++m_tickId;
@@ -55,6 +55,8 @@ public:
 	{
 		IDefragAllocatorStats defragStats;
 		size_t                bytesInFixedAllocs;
+		size_t                numCopiesInFlight;
+		size_t                bytesInFlight;
 	};
 
 public:
@@ -152,7 +154,6 @@ private:
 		CompletionLatencyFrames     = 2,
 		MaxInFlightCopies           = 32,
 		MaxScheduledCopiesPerUpdate = 4,
-		MaxScheduledBytesPerUpdate  = 128 * 1024,
 		MinJobCopySize              = 4096,
 		MinFixedAllocSize           = 384 * 1024,
 		MinAlignment                = 16,
@@ -441,7 +441,12 @@ public:
 		}
 		else
 		{
-			IF (key < m_position.GetNumCount(), true)
+			IF (key < m_position.GetNumCount() && t == 0.0f, false)
+			{
+				// sampled exactly on a key, no need to decode the neighbour
+				GetPosValueFromKey(key - 1, pos);
+			}
+			else IF (key < m_position.GetNumCount(), true)
 			{
 				// assume that the 48bit(6byte) encodings are used(can be wrong but should be right the most time)
 				const char* pKeys = m_position.GetKeys();
@@ -483,7 +488,13 @@ public:
 		}
 		else
 		{
-			IF (key < m_rotation.GetNumCount(), true)
+			IF (key < m_rotation.GetNumCount() && t == 0.0f, false)
+			{
+				CRY_ALIGN(16) Quat p1;
+				GetRotValueFromKey(key - 1, p1);
+				pos = p1;
+			}
+			else IF (key < m_rotation.GetNumCount(), true)
 			{
 				// assume that the 48bit(6byte) encodings are used(can be wrong but should be right the most time)
 				const char* pKeys = m_rotation.GetKeys();
@@ -158,6 +158,7 @@ public:
 		: m_pKeys(nullptr)
 		, m_numKeys(0)
 		, m_lastTime(-1)
+		, m_lastKey(0)
 	{
 	}
 
@@ -165,6 +166,7 @@ public:
 		: m_pKeys(pKeys)
 		, m_numKeys(numKeys | (numKeys > 0 ? kKeysConstantMask : 0))
 		, m_lastTime(-1)
+		, m_lastKey(0)
 	{
 	}
 
@@ -216,28 +218,50 @@ public:
 			return numKey;
 		}
 
-		int nPos = numKey >> 1;
-		int nStep = numKey >> 2;
+		// Playback mostly advances monotonically, so try the interval of the previous lookup and the one after it
+		// before falling back to the binary search. The controller is shared between instances and threads, hence
+		// the cursor is only a hint that gets validated against the key times.
+		int nPos = m_lastKey;
+		if (uint32(nPos - 1) < numKey - 1 && realtime >= pKeys[nPos - 1])
+		{
+			if (realtime > pKeys[nPos])
+			{
+				if (uint32(nPos + 1) < numKey && realtime <= pKeys[nPos + 1])
+					nPos++;
+				else
+					nPos = 0;
+			}
+		}
+		else
+		{
+			nPos = 0;
+		}
 
-		// use binary search
-		while (nStep)
+		if (nPos == 0)
 		{
-			if (realtime < pKeys[nPos])
-				nPos = nPos - nStep;
-			else if (realtime > pKeys[nPos])
-				nPos = nPos + nStep;
-			else
-				break;
+			nPos = numKey >> 1;
+			int nStep = numKey >> 2;
 
-			nStep = nStep >> 1;
-		}
+			// use binary search
+			while (nStep)
+			{
+				if (realtime < pKeys[nPos])
+					nPos = nPos - nStep;
+				else if (realtime > pKeys[nPos])
+					nPos = nPos + nStep;
+				else
+					break;
+
+				nStep = nStep >> 1;
+			}
 
-		// fine-tuning needed since time is not linear
-		while (realtime > pKeys[nPos])
-			nPos++;
+			// fine-tuning needed since time is not linear
+			while (realtime > pKeys[nPos])
+				nPos++;
 
-		while (realtime < pKeys[nPos - 1])
-			nPos--;
+			while (realtime < pKeys[nPos - 1])
+				nPos--;
+		}
 
 		m_lastKey = nPos;
 
@@ -1069,6 +1093,13 @@ public:
 				TBase::GetValueFromKey(key - 1, p1);
 				pos = p1;
 			}
+			else if (t == 0.0f)
+			{
+				// sampled exactly on a key, no need to decode the neighbour
+				CRY_ALIGN(16) TData p1;
+				TBase::GetValueFromKey(key - 1, p1);
+				pos = p1;
+			}
 			else
 			{
 				//TData p1, p2;
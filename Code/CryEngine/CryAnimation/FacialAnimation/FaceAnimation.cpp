@@ -22,6 +22,7 @@ CFacialAnimationContext::CFacialAnimationContext(CFacialInstance* pFace)
 	, m_pFace(pFace)
 	, m_nLastChannelId(0)
 	, m_bForceLastUpdate(false)
+	, m_lastStaticChannelsHash(0)
 	, m_fBoneRotationSmoothingRemainingTime(0.0f)
 {
 	m_pFacialModel = pFace->GetModel();
@@ -139,6 +140,22 @@ void CFacialAnimationContext::SetChannelWeight(uint32 nChannelId, float fWeight)
 		ch->fWeight = fWeight;
 }
 
+//////////////////////////////////////////////////////////////////////////
+uint32 CFacialAnimationContext::GetStaticChannelsHash() const
+{
+	uint32 hash = 2166136261u;
+	for (const SFacialEffectorChannel& channel : m_channels)
+	{
+		if (channel.status != SFacialEffectorChannel::STATUS_ONE || channel.bTemporary || (!channel.bIgnoreLifeTime && channel.fLifeTime != 0))
+			return 0;
+
+		const uint32 values[] = { channel.nChannelId, (uint32)(UINT_PTR)channel.pEffector.get(), alias_cast<uint32>(channel.fWeight), alias_cast<uint32>(channel.fBalance), channel.bLipSync };
+		for (uint32 value : values)
+			hash = (hash ^ value) * 16777619u;
+	}
+	return hash ? hash : 1;
+}
+
 //////////////////////////////////////////////////////////////////////////
 bool CFacialAnimationContext::Update(CFaceState& faceState, const QuatTS& rAnimLocationNext)
 {
@@ -150,6 +167,13 @@ bool CFacialAnimationContext::Update(CFaceState& faceState, const QuatTS& rAnimL
 	if (nChannels <= 0 && !m_bForceLastUpdate && m_sequences.empty())
 		return false;
 
+	// When no sequence plays and the channels are at a constant level and unchanged since the last evaluation,
+	// the face state and the displacement info filled from it are still valid.
+	const uint32 staticChannelsHash = m_sequences.empty() ? GetStaticChannelsHash() : 0;
+	if (staticChannelsHash && staticChannelsHash == m_lastStaticChannelsHash && !m_bForceLastUpdate && m_fBoneRotationSmoothingRemainingTime <= 0.0f && Console::GetInst().ca_DebugFacial != 2)
+		return false;
+	m_lastStaticChannelsHash = staticChannelsHash;
+
 	m_bForceLastUpdate = false;
 
 	ResetFaceState(faceState);
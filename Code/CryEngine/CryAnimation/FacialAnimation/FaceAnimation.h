@@ -106,7 +106,10 @@ public:
 
 	// Set the multiplier for a morph target when the target is used in lipsyncing
 	// (should only be called by CFacialAnimSequence).
-	void SetLipsyncStrength(int index, float lipsyncStrength) { m_lipsyncStrength[index] = lipsyncStrength; }
+	void SetLipsyncStrength(int index, float lipsyncStrength) { m_lipsyncStrength[index] = lipsyncStrength; m_bForceLastUpdate = true; }
+
+	// Forces an evaluation in the next Update, e.g. when inputs other than the channels have changed.
+	void ForceUpdate() { m_bForceLastUpdate = true; }
 
 	void UpdatePlayingSequences(const QuatTS& rAnimLocationNext);
 	bool Update(CFaceState& faceState, const QuatTS& rAnimLocationNext);
@@ -138,6 +141,9 @@ private:
 	void AverageFaceState(CFaceState& faceState);
 	void AnimatePlayingSequences(const QuatTS& rAnimLocationNext);
 
+	// Returns a hash of the channels if all of them are at a constant level, or 0 if any is animated.
+	uint32 GetStaticChannelsHash() const;
+
 private:
 	CTimeValue m_time; // Current animation time.
 
@@ -182,6 +188,7 @@ private:
 	string                        m_debugText;
 
 	bool                          m_bForceLastUpdate;
+	uint32                        m_lastStaticChannelsHash;
 
 	float                         m_fBoneRotationSmoothingRemainingTime;
 };
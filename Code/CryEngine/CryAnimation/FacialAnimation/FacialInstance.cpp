@@ -567,6 +567,8 @@ void CFacialInstance::SetForcedRotations(int numForcedRotations, CFacialAnimForc
 	m_forcedRotations.resize(numForcedRotations);
 	if (forcedRotations && numForcedRotations)
 		memcpy(&m_forcedRotations[0], forcedRotations, numForcedRotations * sizeof(forcedRotations[0]));
+	if (m_pAnimContext)
+		m_pAnimContext->ForceUpdate();
 }
 
 //////////////////////////////////////////////////////////////////////////
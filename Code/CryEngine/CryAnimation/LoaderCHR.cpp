@@ -413,7 +413,8 @@ bool CDefaultSkeleton::LoadNewSKEL(const char* szFilePath, uint32 nLoadingFlags)
 	cgfs.m_pContentCGF = g_pI3DEngine->CreateChunkfileContent(szFilePath);
 	if (cgfs.m_pContentCGF == 0)
 		CryFatalError("CryAnimation error: issue in Chunk-Loader");
-	bool bLoaded = g_pI3DEngine->LoadChunkFileContent(cgfs.m_pContentCGF, szFilePath, 0);
+	// The content (and its chunk file) lives until the end of this function, so the mesh streams can point into the pak's file data directly.
+	bool bLoaded = g_pI3DEngine->LoadChunkFileContent(cgfs.m_pContentCGF, szFilePath, false, false);
 	if (bLoaded == 0)
 	{
 		g_pISystem->Warning(VALIDATOR_MODULE_ANIMATION, VALIDATOR_WARNING, VALIDATOR_FLAG_FILE, szFilePath, "CryAnimation: The Chunk-Loader failed to load the file.");
@@ -427,7 +428,7 @@ bool CDefaultSkeleton::LoadNewSKEL(const char* szFilePath, uint32 nLoadingFlags)
 		if (bHasMeshFile)
 		{
 			cgfs.m_pContentMeshCGF = g_pI3DEngine->CreateChunkfileContent(lodmName);
-			g_pI3DEngine->LoadChunkFileContent(cgfs.m_pContentMeshCGF, lodmName.c_str());
+			g_pI3DEngine->LoadChunkFileContent(cgfs.m_pContentMeshCGF, lodmName.c_str(), false, false);
 		}
 	}
 
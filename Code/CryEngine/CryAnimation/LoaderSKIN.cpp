@@ -477,6 +477,8 @@ bool CSkin::LoadNewSKIN(const char* szFilePath, uint32 nLoadingFlags)
 	static ICVar* p_e_lod_min = gEnv->pConsole->GetCVar("e_CharLodMin");
 	if (p_e_lod_min)
 		baseLOD = max(0, p_e_lod_min->GetIVal()); //use this as the new LOD0 (but only if possible)
+	if (gEnv->IsDedicated())
+		baseLOD = g_nMaxGeomLodLevels - 1;            //a dedicated server never renders skins, the smallest LOD is enough for the bone mapping
 	//if (baseLOD)
 	//	CryFatalError("CryAnimation: m_nBaseLOD should be 0");
 
@@ -501,7 +503,8 @@ bool CSkin::LoadNewSKIN(const char* szFilePath, uint32 nLoadingFlags)
 		cgfs.m_arrContentCGF[ml] = pChunkFile; //cleanup automatically when we leave the function-scope
 		cgfs.m_cgfNames[ml] = lodName;
 
-		const bool bLoaded = g_pI3DEngine->LoadChunkFileContent(pChunkFile, lodName, 0);
+		// The content (and its chunk file) lives until the end of this function, so the mesh streams can point into the pak's file data directly.
+		const bool bLoaded = g_pI3DEngine->LoadChunkFileContent(pChunkFile, lodName, false, false);
 
 		if (!bLoaded)
 		{
@@ -515,7 +518,7 @@ bool CSkin::LoadNewSKIN(const char* szFilePath, uint32 nLoadingFlags)
 			if (gEnv->pCryPak->IsFileExist(lodmName.c_str()))
 			{
 				cgfs.m_arrContentMeshCGF[ml] = g_pI3DEngine->CreateChunkfileContent(lodmName);
-				const bool bLoaded = g_pI3DEngine->LoadChunkFileContent(cgfs.m_arrContentMeshCGF[ml], lodmName.c_str(), false);
+				const bool bLoaded = g_pI3DEngine->LoadChunkFileContent(cgfs.m_arrContentMeshCGF[ml], lodmName.c_str(), false, false);
 				if (!bLoaded)
 				{
 					g_pISystem->Warning(VALIDATOR_MODULE_ANIMATION, VALIDATOR_ERROR, VALIDATOR_FLAG_FILE, szFilePath, "CryAnimation (%s): Failed to load SKIN (Invalid file contents) '%s'", __FUNCTION__, lodmName.c_str());
@@ -530,19 +533,20 @@ bool CSkin::LoadNewSKIN(const char* szFilePath, uint32 nLoadingFlags)
 
 	if (lodCount > 0)
 	{
-		bool isVCloth = cgfs.m_arrContentCGF[0]->GetVClothInfo()->m_vertices.size() > 0;
+		CContentCGF* pVClothContent = cgfs.m_arrContentCGF[baseLOD]; //LODs are shifted down to baseLOD further below
+		bool isVCloth = pVClothContent->GetVClothInfo()->m_vertices.size() > 0;
 
 		// fill vcloth data
 		if (isVCloth)
 		{
-			m_VClothData.m_lra.resize(cgfs.m_arrContentCGF[0]->GetVClothInfo()->m_vertices.size());
-			m_VClothData.m_listBendTriangles.resize(cgfs.m_arrContentCGF[0]->GetVClothInfo()->m_triangles.size());
-			m_VClothData.m_listBendTrianglePairs.resize(cgfs.m_arrContentCGF[0]->GetVClothInfo()->m_trianglePairs.size());
-			m_VClothData.m_lraNotAttachedOrderedIdx.resize(cgfs.m_arrContentCGF[0]->GetVClothInfo()->m_lraNotAttachedOrderedIdx.size());
+			m_VClothData.m_lra.resize(pVClothContent->GetVClothInfo()->m_vertices.size());
+			m_VClothData.m_listBendTriangles.resize(pVClothContent->GetVClothInfo()->m_triangles.size());
+			m_VClothData.m_listBendTrianglePairs.resize(pVClothContent->GetVClothInfo()->m_trianglePairs.size());
+			m_VClothData.m_lraNotAttachedOrderedIdx.resize(pVClothContent->GetVClothInfo()->m_lraNotAttachedOrderedIdx.size());
 
 			{
 				auto itLra = m_VClothData.m_lra.begin();
-				for (auto it = cgfs.m_arrContentCGF[0]->GetVClothInfo()->m_vertices.begin(); it != cgfs.m_arrContentCGF[0]->GetVClothInfo()->m_vertices.end(); it++, itLra++)
+				for (auto it = pVClothContent->GetVClothInfo()->m_vertices.begin(); it != pVClothContent->GetVClothInfo()->m_vertices.end(); it++, itLra++)
 				{
 					itLra->lraDist = it->attributes.lraDist;
 					itLra->lraIdx = it->attributes.lraIdx;
@@ -552,7 +556,7 @@ bool CSkin::LoadNewSKIN(const char* szFilePath, uint32 nLoadingFlags)
 
 			{
 				auto itLBT = m_VClothData.m_listBendTriangles.begin();
-				for (auto it = cgfs.m_arrContentCGF[0]->GetVClothInfo()->m_triangles.begin(); it != cgfs.m_arrContentCGF[0]->GetVClothInfo()->m_triangles.end(); it++, itLBT++)
+				for (auto it = pVClothContent->GetVClothInfo()->m_triangles.begin(); it != pVClothContent->GetVClothInfo()->m_triangles.end(); it++, itLBT++)
 				{
 					itLBT->p0 = it->p0;
 					itLBT->p1 = it->p1;
@@ -562,7 +566,7 @@ bool CSkin::LoadNewSKIN(const char* szFilePath, uint32 nLoadingFlags)
 
 			{
 				auto itLBTP = m_VClothData.m_listBendTrianglePairs.begin();
-				for (auto it = cgfs.m_arrContentCGF[0]->GetVClothInfo()->m_trianglePairs.begin(); it != cgfs.m_arrContentCGF[0]->GetVClothInfo()->m_trianglePairs.end(); it++, itLBTP++)
+				for (auto it = pVClothContent->GetVClothInfo()->m_trianglePairs.begin(); it != pVClothContent->GetVClothInfo()->m_trianglePairs.end(); it++, itLBTP++)
 				{
 					itLBTP->phi0 = it->angle;
 					itLBTP->p0 = it->p0;
@@ -576,7 +580,7 @@ bool CSkin::LoadNewSKIN(const char* szFilePath, uint32 nLoadingFlags)
 
 			{
 				auto itL = m_VClothData.m_lraNotAttachedOrderedIdx.begin();
-				for (auto it = cgfs.m_arrContentCGF[0]->GetVClothInfo()->m_lraNotAttachedOrderedIdx.begin(); it != cgfs.m_arrContentCGF[0]->GetVClothInfo()->m_lraNotAttachedOrderedIdx.end(); it++, itL++)
+				for (auto it = pVClothContent->GetVClothInfo()->m_lraNotAttachedOrderedIdx.begin(); it != pVClothContent->GetVClothInfo()->m_lraNotAttachedOrderedIdx.end(); it++, itL++)
 				{
 					*itL = it->lraNotAttachedOrderedIdx;
 				}
@@ -586,9 +590,9 @@ bool CSkin::LoadNewSKIN(const char* szFilePath, uint32 nLoadingFlags)
 			{
 				for (int i = 0; i < eVClothLink_COUNT; i++)
 				{
-					m_VClothData.m_links[i].resize(cgfs.m_arrContentCGF[0]->GetVClothInfo()->m_links[i].size());
+					m_VClothData.m_links[i].resize(pVClothContent->GetVClothInfo()->m_links[i].size());
 					auto itL = m_VClothData.m_links[i].begin();
-					for (auto it = cgfs.m_arrContentCGF[0]->GetVClothInfo()->m_links[i].begin(); it != cgfs.m_arrContentCGF[0]->GetVClothInfo()->m_links[i].end(); it++, itL++)
+					for (auto it = pVClothContent->GetVClothInfo()->m_links[i].begin(); it != pVClothContent->GetVClothInfo()->m_links[i].end(); it++, itL++)
 					{
 						itL->i1 = it->i1;
 						itL->i2 = it->i2;
@@ -0,0 +1,224 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "stdafx.h"
+#include "Command_Buffer.h"
+#include "Command_Commands.h"
+#include <CrySystem/CryUnitTest.h>
+
+#if defined(CRY_UNIT_TESTING)
+
+CRY_UNIT_TEST_SUITE(PoseBlending)
+{
+	enum
+	{
+		kJointCount     = 103, // not a multiple of four, so the scalar tail is covered as well
+		kCrowdSize      = 100,
+		kCrowdJoints    = 128,
+	};
+
+	// deterministic value in [-1,1)
+	float HashSigned(uint32 n)
+	{
+		n = (n ^ 61) ^ (n >> 16);
+		n *= 9;
+		n ^= n >> 4;
+		n *= 0x27d4eb2d;
+		n ^= n >> 15;
+		return (n & 0xffffff) * (2.0f / 0x1000000) - 1.0f;
+	}
+
+	// the buffers of one pose, laid out like the ones Command::CBuffer::Execute hands to the commands
+	struct SPose
+	{
+		SPose(uint32 jointCount, uint32 seed)
+			: relPose(jointCount)
+			, status(jointCount)
+			, weights(jointCount)
+			, scaling(jointCount)
+		{
+			for (uint32 i = 0; i < jointCount; ++i)
+			{
+				const uint32 n = seed * 7919 + i * 16;
+				relPose[i].q = Quat(HashSigned(n), HashSigned(n + 1), HashSigned(n + 2), HashSigned(n + 3));
+				relPose[i].t = Vec3(HashSigned(n + 4), HashSigned(n + 5), HashSigned(n + 6));
+				// most joints are animated, a few carry only some of the channels
+				status[i] = (n % 11 == 3) ? eJS_Position : (n % 13 == 5) ? 0 : eJS_Orientation | eJS_Position;
+				weights[i] = Vec3(HashSigned(n + 7) * 0.5f + 0.5f, HashSigned(n + 8) * 0.5f + 0.5f, 0.0f);
+				scaling[i] = 1.0f;
+			}
+			// a degenerate rotation, the normalization turns it into identity
+			if (jointCount > 9)
+				relPose[9].q = Quat(0.0f, 0.0f, 0.0f, 0.001f);
+		}
+
+		void Bind(Command::CEvaluationContext& context, int buffer)
+		{
+			context.m_buffers[buffer + 0] = &relPose[0];
+			context.m_buffers[buffer + 1] = &status[0];
+			context.m_buffers[buffer + 2] = &weights[0];
+			context.m_buffers[buffer + 3] = &scaling[0];
+		}
+
+		std::vector<QuatT>      relPose;
+		std::vector<JointState> status;
+		std::vector<Vec3>       weights;
+		std::vector<float>      scaling;
+	};
+
+	// scalar versions of the blend commands, the way they were written before the SSE kernels
+	void AddPoseReference(SPose& dst, const SPose& src, float weight)
+	{
+		for (size_t i = 0; i < dst.relPose.size(); ++i)
+		{
+			dst.relPose[i].q += src.relPose[i].q * weight;
+			dst.relPose[i].t += src.relPose[i].t * weight;
+			dst.status[i] |= src.status[i];
+		}
+	}
+
+	void NormalizeReference(SPose& dst)
+	{
+		for (size_t i = 0; i < dst.relPose.size(); ++i)
+		{
+			const f32 dot = fabsf(dst.relPose[i].q | dst.relPose[i].q);
+			if (dot > 0.0001f)
+				dst.relPose[i].q *= isqrt_tpl(dot);
+			else
+				dst.relPose[i].q.SetIdentity();
+		}
+	}
+
+	void PerJointBlendingReference(SPose& base, const SPose& layer, bool bAdditive)
+	{
+		for (size_t j = 0; j < base.relPose.size(); ++j)
+		{
+			if (!(layer.status[j] & eJS_Orientation))
+				continue;
+			if (bAdditive)
+				base.relPose[j].q = Quat::CreateNlerp(IDENTITY, layer.relPose[j].q, layer.weights[j].x) * base.relPose[j].q;
+			else
+				base.relPose[j].q = (base.relPose[j].q * (1.0f - layer.weights[j].x) + layer.relPose[j].q * fsgnnz(base.relPose[j].q | layer.relPose[j].q)).GetNormalized();
+		}
+	}
+
+	// component-wise, the poses are not normalized after the add
+	bool IsPoseClose(const SPose& a, const SPose& b)
+	{
+		const float epsilon = 0.0001f;
+		for (size_t i = 0; i < a.relPose.size(); ++i)
+		{
+			const QuatT& qa = a.relPose[i];
+			const QuatT& qb = b.relPose[i];
+			if (!IsEquivalent(qa.q.v, qb.q.v, epsilon) || fabsf(qa.q.w - qb.q.w) > epsilon || !IsEquivalent(qa.t, qb.t, epsilon) || a.status[i] != b.status[i])
+				return false;
+		}
+		return true;
+	}
+
+	template<class TCommand>
+	TCommand CreateCommand()
+	{
+		TCommand command;
+		memset(&command, 0, sizeof(command));
+		command.m_nCommand = TCommand::ID;
+		return command;
+	}
+
+	CRY_UNIT_TEST(CUT_PoseBlendingMatchesScalar)
+	{
+		Command::CState state;
+		state.m_jointCount = kJointCount;
+		Command::CEvaluationContext context;
+		memset(&context, 0, sizeof(context));
+
+		SPose target(kJointCount, 1), layer(kJointCount, 2);
+		target.Bind(context, Command::TargetBuffer);
+		layer.Bind(context, Command::TmpBuffer);
+		SPose expected = target;
+
+		Command::AddPoseBuffer add = CreateCommand<Command::AddPoseBuffer>();
+		add.m_SourceBuffer = Command::TmpBuffer;
+		add.m_TargetBuffer = Command::TargetBuffer;
+		add.m_fWeight = 0.35f;
+		add.Execute(state, context);
+		AddPoseReference(expected, layer, 0.35f);
+		CRY_UNIT_TEST_ASSERT(IsPoseClose(target, expected));
+
+		target.relPose[9].q = expected.relPose[9].q = Quat(0.0f, 0.0f, 0.0f, 0.001f);
+		Command::NormalizeFull normalize = CreateCommand<Command::NormalizeFull>();
+		normalize.m_TargetBuffer = Command::TargetBuffer;
+		normalize.Execute(state, context);
+		NormalizeReference(expected);
+		CRY_UNIT_TEST_ASSERT(IsPoseClose(target, expected));
+		CRY_UNIT_TEST_ASSERT(target.relPose[9].q.IsIdentity());
+
+		for (int bAdditive = 0; bAdditive < 2; ++bAdditive)
+		{
+			Command::PerJointBlending blend = CreateCommand<Command::PerJointBlending>();
+			blend.m_SourceBuffer = Command::TmpBuffer;
+			blend.m_TargetBuffer = Command::TargetBuffer;
+			blend.m_BlendMode = bAdditive;
+			blend.Execute(state, context);
+			PerJointBlendingReference(expected, layer, bAdditive != 0);
+			// translations are blended by the same scalar code on both sides
+			for (uint32 i = 0; i < kJointCount; ++i)
+				expected.relPose[i].t = target.relPose[i].t;
+			CRY_UNIT_TEST_ASSERT(IsPoseClose(target, expected));
+		}
+	}
+
+	// two layers of a crowd: blended, normalized and combined with a partial body layer per character.
+	// The benchmark runner reports the time per iteration, divide it by kCrowdSize * kCrowdJoints for the cost per joint.
+	struct SCrowdBenchmark : public CryUnitTest::SBenchmark
+	{
+		virtual void Init() override
+		{
+			for (int i = 0; i < kCrowdSize; ++i)
+			{
+				m_targets.push_back(SPose(kCrowdJoints, i * 3));
+				m_layers.push_back(SPose(kCrowdJoints, i * 3 + 1));
+				m_partials.push_back(SPose(kCrowdJoints, i * 3 + 2));
+			}
+			m_state.m_jointCount = kCrowdJoints;
+		}
+		virtual void Done() override
+		{
+			stl::free_container(m_targets);
+			stl::free_container(m_layers);
+			stl::free_container(m_partials);
+		}
+
+		std::vector<SPose> m_targets, m_layers, m_partials;
+		Command::CState    m_state;
+	};
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_PoseBlendingCrowd, SCrowdBenchmark)
+	{
+		Command::AddPoseBuffer add = CreateCommand<Command::AddPoseBuffer>();
+		add.m_SourceBuffer = Command::TmpBuffer;
+		add.m_TargetBuffer = Command::TargetBuffer;
+		add.m_fWeight = 0.5f;
+		Command::NormalizeFull normalize = CreateCommand<Command::NormalizeFull>();
+		normalize.m_TargetBuffer = Command::TargetBuffer;
+		Command::PerJointBlending blend = CreateCommand<Command::PerJointBlending>();
+		blend.m_SourceBuffer = Command::TmpBuffer;
+		blend.m_TargetBuffer = Command::TargetBuffer;
+
+		Command::CEvaluationContext context;
+		memset(&context, 0, sizeof(context));
+		for (int i = 0; i < kCrowdSize; ++i)
+		{
+			m_targets[i].Bind(context, Command::TargetBuffer);
+			m_layers[i].Bind(context, Command::TmpBuffer);
+			add.Execute(m_state, context);
+			normalize.Execute(m_state, context);
+
+			m_partials[i].Bind(context, Command::TmpBuffer);
+			blend.m_BlendMode = i & 1;
+			blend.Execute(m_state, context);
+		}
+		CRY_UNIT_BENCHMARK_KEEP(m_targets[0].relPose[0]);
+	}
+}
+
+#endif // CRY_UNIT_TESTING
@@ -0,0 +1,167 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "stdafx.h"
+#include "VertexData.h"
+#include "VertexCommand.h"
+#include "VertexCommandBuffer.h"
+#include <CryRenderer/VertexFormats.h>
+#include <CrySystem/CryUnitTest.h>
+
+#if defined(CRY_UNIT_TESTING)
+
+CRY_UNIT_TEST_SUITE(BlendShapes)
+{
+	enum
+	{
+		kVertexCount      = 20000, // a hero head
+		kFrameCount       = 48,    // active facial blend shapes
+		kFrameVertexCount = 3000,  // vertices moved by one blend shape
+	};
+
+	// deterministic value in [-1,1)
+	float HashSigned(uint32 n)
+	{
+		n = (n ^ 61) ^ (n >> 16);
+		n *= 9;
+		n ^= n >> 4;
+		n *= 0x27d4eb2d;
+		n ^= n >> 15;
+		return (n & 0xffffff) * (2.0f / 0x1000000) - 1.0f;
+	}
+
+	// blend shapes laid out like CSoftwareVertexFrames creates them, compiled into adds like CVertexAnimation::CompileAdds does
+	struct SBlendShapes
+	{
+		SBlendShapes()
+			: frames(kFrameCount)
+			, commandMemory(kFrameCount * sizeof(VertexCommandAdd))
+			, vertices(kVertexCount)
+		{
+			for (int i = 0; i < kFrameCount; ++i)
+			{
+				// every frame covers a window of the mesh, the windows overlap
+				const uint first = (i * 397) % (kVertexCount - kFrameVertexCount * 2);
+				for (uint j = 0; j < kFrameVertexCount; ++j)
+				{
+					SSoftwareVertexFrameFormat vertex;
+					vertex.index = vtx_idx(first + j * 2 + (j & 1));
+					vertex.position = Vec3(HashSigned(i * 100003 + j * 3), HashSigned(i * 100003 + j * 3 + 1), HashSigned(i * 100003 + j * 3 + 2));
+					frames[i].push_back(vertex);
+				}
+			}
+
+			CVertexCommandBufferAllocatorStatic allocator(&commandMemory[0], uint(commandMemory.size()));
+			commandBuffer.Initialize(allocator);
+			for (int i = 0; i < kFrameCount; ++i)
+			{
+				VertexCommandAdd* pCommand = commandBuffer.AddCommand<VertexCommandAdd>();
+				pCommand->pVectors.data = &frames[i][0].position;
+				pCommand->pVectors.iStride = sizeof(frames[i][0]);
+				pCommand->pIndices.data = &frames[i][0].index;
+				pCommand->pIndices.iStride = sizeof(frames[i][0]);
+				pCommand->count = kFrameVertexCount;
+				pCommand->weight = HashSigned(i + 777) * 0.5f + 0.5f;
+			}
+
+			// the SSE add writes 16 bytes per position, the render mesh stream has the color behind it
+			vertexData.pPositions = strided_pointer<Vec3>(&vertices[0].xyz, sizeof(vertices[0]));
+			vertexData.m_vertexCount = kVertexCount;
+			Reset();
+		}
+
+		void Reset()
+		{
+			for (uint i = 0; i < kVertexCount; ++i)
+			{
+				vertices[i].xyz = Vec3(float(i), 0.0f, 1.0f);
+				vertices[i].color.dcolor = i;
+			}
+		}
+
+		bool IsEqual(const std::vector<SVF_P3F_C4B_T2F>& other) const
+		{
+			for (uint i = 0; i < kVertexCount; ++i)
+			{
+				if (memcmp(&vertices[i].xyz, &other[i].xyz, sizeof(Vec3)) != 0 || vertices[i].color.dcolor != i)
+					return false;
+			}
+			return true;
+		}
+
+		void ProcessSequential()
+		{
+			commandBuffer.Process(vertexData);
+		}
+
+		void ProcessRanges()
+		{
+			JobManager::SJobState jobState;
+			SVertexAddRanges addRanges;
+			addRanges.pJobState = &jobState;
+			addRanges.Process(vertexData, &commandMemory[0], kFrameCount);
+			gEnv->pJobManager->WaitForJob(jobState);
+		}
+
+		std::vector<std::vector<SSoftwareVertexFrameFormat>> frames;
+		std::vector<uint8>   commandMemory;
+		CVertexCommandBuffer commandBuffer;
+		std::vector<SVF_P3F_C4B_T2F> vertices;
+		CVertexData          vertexData;
+	};
+
+	CRY_UNIT_TEST(CUT_BlendShapeRangesMatchSequential)
+	{
+		SBlendShapes shapes;
+		shapes.ProcessSequential();
+		const std::vector<SVF_P3F_C4B_T2F> expected = shapes.vertices;
+
+		// per vertex the deltas are added in the same order, so the result is bit exact
+		shapes.Reset();
+		shapes.ProcessRanges();
+		CRY_UNIT_TEST_ASSERT(shapes.IsEqual(expected));
+
+		// uneven ranges, including empty ones and ones past the end of the mesh
+		shapes.Reset();
+		const uint bounds[] = { 0, 1, 1, 4095, 4096, 12345, kVertexCount - 1, kVertexCount, kVertexCount + 100 };
+		for (uint i = 0; i + 1 < CRY_ARRAY_COUNT(bounds); ++i)
+		{
+			for (std::vector<SSoftwareVertexFrameFormat>& frame : shapes.frames)
+			{
+				VertexCommandAdd command;
+				command.pVectors.data = &frame[0].position;
+				command.pVectors.iStride = sizeof(frame[0]);
+				command.pIndices.data = &frame[0].index;
+				command.pIndices.iStride = sizeof(frame[0]);
+				command.count = kFrameVertexCount;
+				command.weight = HashSigned(uint32(&frame - &shapes.frames[0]) + 777) * 0.5f + 0.5f;
+				VertexCommandAdd::ExecuteRange(command, shapes.vertexData, bounds[i], bounds[i + 1]);
+			}
+		}
+		CRY_UNIT_TEST_ASSERT(shapes.IsEqual(expected));
+	}
+
+	// The add run of one character on one job, and spread over the workers as ca_vaBlendJobDeltaCount does it.
+	struct SBlendShapeBenchmark : public CryUnitTest::SBenchmark
+	{
+		SBlendShapeBenchmark() : m_pShapes(nullptr) {}
+
+		virtual void Init() override { m_pShapes = new SBlendShapes(); }
+		virtual void Done() override { SAFE_DELETE(m_pShapes); }
+
+		SBlendShapes* m_pShapes;
+	};
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_BlendShapesSequential, SBlendShapeBenchmark)
+	{
+		m_pShapes->ProcessSequential();
+		CRY_UNIT_BENCHMARK_KEEP(m_pShapes->vertices[0].xyz);
+	}
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_BlendShapesRanges, SBlendShapeBenchmark)
+	{
+		m_pShapes->ProcessRanges();
+		CRY_UNIT_BENCHMARK_KEEP(m_pShapes->vertices[0].xyz);
+	}
+}
+
+#endif // CRY_UNIT_TESTING
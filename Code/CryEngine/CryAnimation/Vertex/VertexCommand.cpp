@@ -272,14 +272,11 @@ void VertexCommandTangents::Execute(VertexCommandTangents& command, CVertexData&
 	}
 }
 
-void VertexCommandAdd::Execute(VertexCommandAdd& command, CVertexData& vertexData)
+void VertexCommandAdd::ExecuteInternal(VertexCommandAdd& command, CVertexData& vertexData, uint first, uint last)
 {
-	FUNCTION_PROFILER(GetISystem(), PROFILE_ANIMATION);
-
 	strided_pointer<Vec3> pPositions = vertexData.GetPositions();
 	const float weight = command.weight;
-	const uint count = command.count;
-	for (uint i = 0; i < count; ++i)
+	for (uint i = first; i < last; ++i)
 	{
 		const uint index = command.pIndices[i];
 
@@ -292,6 +289,45 @@ void VertexCommandAdd::Execute(VertexCommandAdd& command, CVertexData& vertexDat
 
 #endif
 
+/*
+   VertexCommandAdd
+ */
+
+void VertexCommandAdd::Execute(VertexCommandAdd& command, CVertexData& vertexData)
+{
+	FUNCTION_PROFILER(GetISystem(), PROFILE_ANIMATION);
+
+	ExecuteInternal(command, vertexData, 0, command.count);
+}
+
+void VertexCommandAdd::ExecuteRange(VertexCommandAdd& command, CVertexData& vertexData, uint vertexBegin, uint vertexEnd)
+{
+	FUNCTION_PROFILER(GetISystem(), PROFILE_ANIMATION);
+
+	// lower bound of vertexBegin in the sorted vertex indices
+	uint first = 0;
+	uint count = command.count;
+	while (count > 0)
+	{
+		const uint step = count / 2;
+		if (uint(command.pIndices[first + step]) < vertexBegin)
+		{
+			first += step + 1;
+			count -= step + 1;
+		}
+		else
+		{
+			count = step;
+		}
+	}
+
+	uint last = first;
+	while (last < command.count && uint(command.pIndices[last]) < vertexEnd)
+		++last;
+
+	ExecuteInternal(command, vertexData, first, last);
+}
+
 /*
    VertexCommandCopy
  */
@@ -724,10 +760,8 @@ void VertexCommandSkin::ExecuteInternal(VertexCommandSkin& command, CVertexData&
    VertexCommandAdd
  */
 
-void VertexCommandAdd::Execute(VertexCommandAdd& command, CVertexData& vertexData)
+void VertexCommandAdd::ExecuteInternal(VertexCommandAdd& command, CVertexData& vertexData, uint first, uint last)
 {
-	FUNCTION_PROFILER(GetISystem(), PROFILE_ANIMATION);
-
 	strided_pointer<Vec3> pPositions = vertexData.GetPositions();
 	const float weight = command.weight;
 	const __m128 _weight = _mm_setr_ps(weight, weight, weight, 0.f);
@@ -737,11 +771,15 @@ void VertexCommandAdd::Execute(VertexCommandAdd& command, CVertexData& vertexDat
 	const __m128 _xyzMask = _mm_castsi128_ps(_mm_set_epi32(0, 0xffffffff, 0xffffffff, 0xffffffff));
 	const __m128 _wMask = _mm_castsi128_ps(_mm_set_epi32(0xffffffff, 0, 0, 0));
 
-	const uint count = command.count;
-	for (uint i = 0; i < count; ++i)
+	// The frame deltas are streamed linearly, but the positions they scatter into are not, so fetch those ahead.
+	const uint prefetchDistance = 8;
+	for (uint i = first; i < last; ++i)
 	{
 		const uint index = command.pIndices[i];
 
+		if (i + prefetchDistance < last)
+			_mm_prefetch((const char*)&pPositions[command.pIndices[i + prefetchDistance]], _MM_HINT_T0);
+
 		float* __restrict pPosition = (float*)&pPositions[index];
 
 		__m128 _loadPos = _mm_loadu_ps(pPosition);
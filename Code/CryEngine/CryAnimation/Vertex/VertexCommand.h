@@ -26,6 +26,7 @@ struct VertexCommand
 {
 private:
 	friend class CVertexCommandBuffer;
+	friend struct SVertexAddRanges;
 
 public:
 	VertexCommand(VertexCommandFunction function) : Execute((VertexCommandFunction)function) {}
@@ -75,6 +76,11 @@ public:
 
 public:
 	static void Execute(VertexCommandAdd& command, CVertexData& vertexData);
+	// Applies only the deltas of the vertices in [vertexBegin, vertexEnd), relies on the deltas being sorted by vertex index.
+	static void ExecuteRange(VertexCommandAdd& command, CVertexData& vertexData, uint vertexBegin, uint vertexEnd);
+
+private:
+	static void ExecuteInternal(VertexCommandAdd& command, CVertexData& vertexData, uint first, uint last);
 
 public:
 	strided_pointer<const Vec3>    pVectors;
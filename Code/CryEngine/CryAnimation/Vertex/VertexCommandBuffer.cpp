@@ -60,22 +60,117 @@ void* CVertexCommandBufferAllocatorStatic::Allocate(const uint length)
    CVertexCommandBuffer
  */
 
-void CVertexCommandBuffer::Process(CVertexData& vertexData)
+void CVertexCommandBuffer::Process(CVertexData& vertexData, SVertexAddRanges* pAddRanges)
 {
 	int length = m_commandsLength;
 	if (!length)
 		return;
 
+	const VertexCommandFunction addFunction = (VertexCommandFunction)VertexCommandAdd::Execute;
+	const uint minDeltaCount = uint(max(Console::GetInst().ca_vaBlendJobDeltaCount, 0));
+
 	const uint8* pCommands = m_pCommands;
 	while (length > sizeof(VertexCommand))
 	{
 		VertexCommand* pCommand = (VertexCommand*)pCommands;
+
+		if (pAddRanges && minDeltaCount && pCommand->Execute == addFunction)
+		{
+			// Only worth the jobs if the whole run touches enough vertices.
+			const uint8* pRunEnd = pCommands;
+			int runLength = 0;
+			uint commandCount = 0;
+			uint deltaCount = 0;
+			while (length - runLength > sizeof(VertexCommand) && ((VertexCommand*)pRunEnd)->Execute == addFunction)
+			{
+				deltaCount += ((VertexCommandAdd*)pRunEnd)->count;
+				runLength += ((VertexCommand*)pRunEnd)->length;
+				pRunEnd += ((VertexCommand*)pRunEnd)->length;
+				++commandCount;
+			}
+
+			if (deltaCount >= minDeltaCount)
+			{
+				pAddRanges->Process(vertexData, pCommands, commandCount);
+				pCommands = pRunEnd;
+				length -= runLength;
+				pAddRanges = NULL;
+				continue;
+			}
+		}
+
 		pCommands += pCommand->length;
 		length -= int(pCommand->length);
 		pCommand->Execute(*pCommand, vertexData);
 	}
 }
 
+/*
+   SVertexAddRanges
+ */
+
+DECLARE_JOB("VertexAnimationAdds", TVertexAnimationAdds, SVertexAddRanges::Execute);
+
+void SVertexAddRanges::Process(CVertexData& vertexData, const uint8* pCommands, uint commandCount)
+{
+	FUNCTION_PROFILER(GetISystem(), PROFILE_ANIMATION);
+
+	const uint vertexCount = vertexData.GetVertexCount();
+	const uint rangeCount = pJobState ? min(uint(kMaxRangeCount), gEnv->pJobManager->GetNumWorkerThreads() + 1) : 1;
+
+	m_pVertexData = &vertexData;
+	m_pCommands = pCommands;
+	m_commandCount = commandCount;
+	m_rangeCount = rangeCount;
+	m_rangeLength = (vertexCount + rangeCount - 1) / rangeCount;
+	m_nextRange = 0;
+	m_finishedRanges = 0;
+
+	for (uint i = 1; i < rangeCount; ++i)
+	{
+		TVertexAnimationAdds job(0);
+		job.SetClassInstance(this);
+		job.SetPriorityLevel(JobManager::eRegularPriority);
+		job.RegisterJobState(pJobState);
+		job.Run();
+	}
+
+	while (ProcessNextRange())
+		;
+
+	// Every range left is being worked on by a running helper.
+	while (m_finishedRanges < int(rangeCount))
+		CryMT::CryYieldThread();
+}
+
+void SVertexAddRanges::Execute(int)
+{
+	// A helper that starts after all ranges were claimed has nothing left to do.
+	while (ProcessNextRange())
+		;
+}
+
+bool SVertexAddRanges::ProcessNextRange()
+{
+	const int range = CryInterlockedIncrement(&m_nextRange) - 1;
+	if (range >= int(m_rangeCount))
+		return false;
+
+	const uint vertexBegin = uint(range) * m_rangeLength;
+	const uint vertexEnd = min(vertexBegin + m_rangeLength, m_pVertexData->GetVertexCount());
+
+	const uint8* pCommands = m_pCommands;
+	for (uint i = 0; i < m_commandCount; ++i)
+	{
+		VertexCommandAdd* pCommand = (VertexCommandAdd*)pCommands;
+		pCommands += pCommand->length;
+		VertexCommandAdd::ExecuteRange(*pCommand, *m_pVertexData, vertexBegin, vertexEnd);
+	}
+
+	CryInterlockedIncrement(&m_finishedRanges);
+	return true;
+}
+
 /*
    SVertexAnimationJobData
  */
@@ -85,7 +180,7 @@ DECLARE_JOB("VertexAnimation", TVertexAnimation, SVertexAnimationJob::Execute);
 void SVertexAnimationJob::Execute(int)
 {
 	if (commandBufferLength)
-		commandBuffer.Process(vertexData);
+		commandBuffer.Process(vertexData, &addRanges);
 
 	if (m_previousRenderMesh)
 	{
@@ -100,6 +195,8 @@ void SVertexAnimationJob::Execute(int)
 
 void SVertexAnimationJob::Begin(JobManager::SJobState* pJob)
 {
+	addRanges.pJobState = pJob;
+
 	TVertexAnimation job(0);
 	job.SetClassInstance(this);
 	job.SetPriorityLevel(JobManager::eRegularPriority);
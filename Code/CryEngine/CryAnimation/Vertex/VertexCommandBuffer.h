@@ -67,7 +67,8 @@ public:
 	template<class Type>
 	Type* AddCommand();
 
-	void  Process(CVertexData& vertexData);
+	// With pAddRanges, the first run of adds that is large enough gets spread over jobs in vertex ranges.
+	void  Process(CVertexData& vertexData, struct SVertexAddRanges* pAddRanges = NULL);
 
 private:
 	CVertexCommandBufferAllocator* m_pAllocator;
@@ -96,11 +97,47 @@ Type* CVertexCommandBuffer::AddCommand()
 	return pCommand;
 }
 
+// Applies a run of add commands range by range. Helper jobs and the owning job claim the ranges, the owning
+// job only waits for ranges another job is already working on, so it never depends on a free worker.
+struct SVertexAddRanges
+{
+	enum { kMaxRangeCount = 8 };
+
+	SVertexAddRanges() :
+		pJobState(NULL),
+		m_pVertexData(NULL),
+		m_pCommands(NULL),
+		m_commandCount(0),
+		m_rangeCount(0),
+		m_rangeLength(0),
+		m_nextRange(0),
+		m_finishedRanges(0)
+	{}
+
+	void                   Process(CVertexData& vertexData, const uint8* pCommands, uint commandCount);
+	void                   Execute(int);
+
+	// The helper jobs are registered with it, so waiting for it covers them as well.
+	JobManager::SJobState* pJobState;
+
+private:
+	bool ProcessNextRange();
+
+	CVertexData*  m_pVertexData;
+	const uint8*  m_pCommands;
+	uint          m_commandCount;
+	uint          m_rangeCount;
+	uint          m_rangeLength;
+	volatile int  m_nextRange;
+	volatile int  m_finishedRanges;
+};
+
 struct SVertexAnimationJob
 {
 	CVertexData             vertexData;
 	CVertexCommandBuffer    commandBuffer;
 	uint                    commandBufferLength;
+	SVertexAddRanges        addRanges;
 
 	volatile int*           pRenderMeshSyncVariable;
 	_smart_ptr<IRenderMesh> m_previousRenderMesh;
@@ -327,6 +327,8 @@ bool CSoftwareVertexFrames::Create(const CSkinningInfo& skinningInfo, const Vec3
 
 			++m_numVertexDeltas;
 		}
+		// Sorted by vertex, so that the adds can be split into vertex ranges (see VertexCommandAdd::ExecuteRange).
+		std::stable_sort(frame.vertices.begin(), frame.vertices.end(), [](const SSoftwareVertexFrameFormat& a, const SSoftwareVertexFrameFormat& b) { return a.index < b.index; });
 		frame.vertexMaxLength = sqrt(maxLengthSquared);
 	}
 	return true;
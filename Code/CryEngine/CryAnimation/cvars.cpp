@@ -139,6 +139,7 @@ void Console::Init()
 	DefineConstIntCVar(ca_DrawAttachments, 1, VF_CHEAT, "if this is 0, will not draw the attachments objects");
 	DefineConstIntCVar(ca_DrawAttachmentsMergedForShadows, 1, VF_REQUIRE_APP_RESTART, "if this is 1 we merge attachments for shadow generation");
 	REGISTER_CVAR(ca_AttachmentMergingMemoryBudget, 25 * 1024 * 1024, VF_NULL, "amount of memory (in bytes) dedicated to merged character attachments");
+	REGISTER_CVAR(ca_AttachmentMergingMaxPerFrame, 2, VF_NULL, "max number of characters whose attachments are merged per frame (0 = unlimited); the others are drawn unmerged until their turn");
 	DefineConstIntCVar(ca_DrawAttachmentOBB, 0, VF_CHEAT, "if this is 0, will not draw the attachments objects");
 	DefineConstIntCVar(ca_DrawAttachmentProjection, 0, VF_CHEAT, "if this is 0, will not draw the attachment projections");
 	DefineConstIntCVar(ca_DrawBaseMesh, 1, VF_CHEAT, "if this is 0, will not draw the characters");
@@ -246,6 +247,7 @@ void Console::Init()
 	const int32 defaultDefragPoolSize = 64 * 1024 * 1024;
 	REGISTER_CVAR(ca_MemoryDefragPoolSize, defaultDefragPoolSize, 0, "Sets the upper limit on the defrag pool size");
 	REGISTER_CVAR(ca_MemoryDefragEnabled, 1, 0, "Enables defragmentation of anim data");
+	REGISTER_CVAR(ca_MemoryDefragMaxBytesPerUpdate, 128 * 1024, 0, "Maximum number of bytes of anim data moved by the defragmentation per update");
 
 	REGISTER_CVAR(ca_ParametricPoolSize, 64, 0, "Size of the parametric pool");
 
@@ -259,6 +261,7 @@ void Console::Init()
 	REGISTER_CVAR(ca_vaBlendPostSkinning, 0, 0, "Perform Vertex Animation blends post skinning");
 	REGISTER_CVAR(ca_vaBlendCullingDebug, 0, 0, "Show Blend Shapes culling difference");
 	REGISTER_CVAR(ca_vaBlendCullingThreshold, 1.f, 0, "Blend Shapes culling threshold");
+	REGISTER_CVAR(ca_vaBlendJobDeltaCount, 8192, 0, "Minimum number of vertex deltas of the blends of one attachment that get spread over several jobs in vertex ranges. 0 = always apply on a single job");
 	REGISTER_CVAR(ca_vaScaleFactor, 1.0f, 0, "Vertex Animation Weight Scale Factor");
 	REGISTER_CVAR(ca_vaUpdateTangents, 1, 0, "Update Tangents on SKIN attachments that have the vertex color blue channel set to 255 and 8 weights");
 	REGISTER_CVAR(ca_vaSkipVertexAnimationLOD, 0, 0, "Skip LOD 0 for characters using vertex animation");
@@ -283,6 +286,8 @@ void Console::Init()
 	REGISTER_CVAR(ca_cloth_damping, 0.0f, 0, "");
 	REGISTER_CVAR(ca_cloth_air_resistance, 0.0f, 0, "\"advanced\" (more correct) version of damping");
 	REGISTER_CVAR(ca_FacialAnimationRadius, 30.f, VF_CHEAT, "Maximum distance at which facial animations are updated - handles zooming correctly");
+	REGISTER_CVAR(ca_AnimationUpdateLodDistance, 0.0f, 0, "Zoom-adjusted camera distance beyond which visible characters update their skeleton only every 2nd frame.\nThe interval doubles with every doubling of the distance, up to every 8th frame. 0 disables the update rate LOD.");
+	REGISTER_CVAR(ca_AnimationUpdateBudget, 0, 0, "Maximum number of visible characters whose skeleton is updated per frame. When exceeded, ca_AnimationUpdateLodDistance is scaled down until the budget holds. 0 means no budget.");
 
 	//sampling
 	DefineConstIntCVar(ca_SampleQuatHemisphereFromCurrentPose, 0, VF_NULL, "For override animation sampling, use current pose for quat hemisphere sign");
@@ -291,6 +296,7 @@ void Console::Init()
 	DefineConstIntCVar(ca_ClothBlending, 1, VF_CHEAT, "if this is 0 blending with animation is disabled");
 	DefineConstIntCVar(ca_ClothBypassSimulation, 0, VF_CHEAT, "if this is 0 actual cloth simulation is disabled (wrap skinning still works)");
 	DefineConstIntCVar(ca_ClothMaxChars, 20, VF_CHEAT, "max characters with cloth on screen");
+	DefineConstIntCVar(ca_ClothIterationLod, 1, VF_CHEAT, "if this is 1 the cloth solver iterations are reduced from half of disableSimulationAtDistance on, down to a single iteration at that distance");
 
 }
 
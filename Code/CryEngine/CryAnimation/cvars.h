@@ -153,6 +153,7 @@ struct CRY_ALIGN(128) Console
 	int32 ca_MemoryUsageLog;
 	int32 ca_MemoryDefragPoolSize;
 	int32 ca_MemoryDefragEnabled;
+	int32 ca_MemoryDefragMaxBytesPerUpdate;
 	int32 ca_ParametricPoolSize;
 
 	int32 ca_StreamCHR;
@@ -162,6 +163,8 @@ struct CRY_ALIGN(128) Console
 	f32 ca_lipsync_phoneme_strength;
 	f32 ca_DeathBlendTime;
 	f32 ca_FacialAnimationRadius;
+	f32 ca_AnimationUpdateLodDistance;
+	int32 ca_AnimationUpdateBudget;
 	f32 ca_AttachmentCullingRation;
 	f32 ca_AttachmentCullingRationMP;
 	f32 ca_cloth_max_timestep;
@@ -181,17 +184,20 @@ struct CRY_ALIGN(128) Console
 	int32 ca_vaBlendEnable;
 	int32 ca_vaBlendPostSkinning;
 	int32 ca_vaBlendCullingDebug;
+	int32 ca_vaBlendJobDeltaCount;
 	f32 ca_vaScaleFactor;
 	f32 ca_vaBlendCullingThreshold;
 
 	int32 ca_vaUpdateTangents;
 	int32 ca_vaSkipVertexAnimationLOD;
 	int32 ca_AttachmentMergingMemoryBudget;
+	int32 ca_AttachmentMergingMaxPerFrame;
 
 	DeclareConstIntCVar(ca_DrawCloth, 1);
 	DeclareConstIntCVar(ca_ClothBlending, 1);
 	DeclareConstIntCVar(ca_ClothBypassSimulation, 0);
 	DeclareConstIntCVar(ca_ClothMaxChars, 20);
+	DeclareConstIntCVar(ca_ClothIterationLod, 1);
 	bool DrawPose(const char mode);
 
 private:
@@ -1530,6 +1530,15 @@ void CAudioTranslationLayer::DrawAudioSystemDebugInfo()
 		}
 		posX -= indentation;
 
+		{
+			CProfileData::SRequestStats const& requestStats = m_pProfileData->GetRequestStats();
+			float const averageLatency = requestStats.numRequests > 0 ? requestStats.totalLatency / static_cast<float>(requestStats.numRequests) : 0.0f;
+			float const averageBatchSize = requestStats.numBatches > 0 ? static_cast<float>(requestStats.numRequests) / static_cast<float>(requestStats.numBatches) : 0.0f;
+			posY += lineHeightClause;
+			pAuxGeom->Draw2dLabel(posX, posY, textSize, s_colorWhite, false, "[Requests] Per Second: %u | Latency Avg: %.2fms Max: %.2fms | Avg Batch: %.1f | Overflow: %u",
+			                      requestStats.numRequests, averageLatency, requestStats.maxLatency, averageBatchSize, requestStats.numOverflowRequests);
+		}
+
 		if (m_pIImpl != nullptr)
 		{
 			Impl::SMemoryInfo memoryInfo;
@@ -1642,6 +1651,8 @@ void CAudioTranslationLayer::DrawAudioSystemDebugInfo()
 		static float const SMOOTHING_ALPHA = 0.2f;
 		static float syncRays = 0;
 		static float asyncRays = 0;
+		static float skippedQueries = 0;
+		static float syncRaysTime = 0;
 		Vec3 const& listenerPosition = m_audioListenerMgr.GetActiveListenerAttributes().transformation.GetPosition();
 		Vec3 const& listenerDirection = m_audioListenerMgr.GetActiveListenerAttributes().transformation.GetForward();
 		float const listenerVelocity = m_audioListenerMgr.GetActiveListenerAttributes().velocity.GetLength();
@@ -1652,6 +1663,8 @@ void CAudioTranslationLayer::DrawAudioSystemDebugInfo()
 		size_t const numEventListeners = m_audioEventListenerMgr.GetNumEventListeners();
 		syncRays += (CPropagationProcessor::s_totalSyncPhysRays - syncRays) * SMOOTHING_ALPHA;
 		asyncRays += (CPropagationProcessor::s_totalAsyncPhysRays - asyncRays) * SMOOTHING_ALPHA * 0.1f;
+		skippedQueries += (CPropagationProcessor::s_totalSkippedQueries - skippedQueries) * SMOOTHING_ALPHA;
+		syncRaysTime += (CPropagationProcessor::s_totalSyncPhysRaysTime - syncRaysTime) * SMOOTHING_ALPHA;
 
 		bool const bActive = true;
 		float const* colorListener = bActive ? s_colorGreen : s_colorRed;
@@ -1669,6 +1682,11 @@ void CAudioTranslationLayer::DrawAudioSystemDebugInfo()
 		                      "Objects: %3" PRISIZE_T "/%3" PRISIZE_T " Events: %3" PRISIZE_T " EventListeners %3" PRISIZE_T " Listeners: %" PRISIZE_T " | SyncRays: %3.1f AsyncRays: %3.1f",
 		                      numActiveObjects, numObjects, numEvents, numEventListeners, numListeners, syncRays, asyncRays);
 
+		posY += lineHeight;
+		pAuxGeom->Draw2dLabel(posX, posY, textSize, s_colorBlue, false,
+		                      "Occlusion SyncRays Cost: %.3f ms | Skipped Queries: %3.1f",
+		                      syncRaysTime, skippedQueries);
+
 		posY += lineHeightClause;
 		DrawATLComponentDebugInfo(*pAuxGeom, posX, posY);
 
@@ -449,6 +449,7 @@ public:
 	_smart_ptr<ICustomMemoryBlock>     m_pMemoryBlock;
 	IReadStreamPtr                     m_pReadStream;
 	Impl::IFile*                       m_pImplData;
+	CTimeValue                         m_timeLastUsed; // Removable entries are evicted least recently used first.
 
 #if defined(INCLUDE_AUDIO_PRODUCTION_CODE)
 	CTimeValue m_timeCached;
@@ -149,6 +149,16 @@ void CCVars::RegisterVariables()
 	               "Usage: s_OcclusionRayLengthOffset [0/...]\n"
 	               "Default: 0.1 (10 cm)\n");
 
+	REGISTER_CVAR2("s_OcclusionMaxUpdateInterval", &m_occlusionMaxUpdateInterval, m_occlusionMaxUpdateInterval, VF_CHEAT | VF_CHEAT_NOCHECK,
+	               "Occlusion rays of an audio object are cast at most this often at s_OcclusionMaxDistance, closer objects are updated proportionally more often.\n"
+	               "Usage: s_OcclusionMaxUpdateInterval [0/...]\n"
+	               "Default: 250 ms\n");
+
+	REGISTER_CVAR2("s_OcclusionStaticRefreshInterval", &m_occlusionStaticRefreshInterval, m_occlusionStaticRefreshInterval, VF_CHEAT | VF_CHEAT_NOCHECK,
+	               "Once all sample points of an audio object have been cast while neither the object nor the listener moved, the cached occlusion is only refreshed at this interval.\n"
+	               "Usage: s_OcclusionStaticRefreshInterval [0/...]\n"
+	               "Default: 1000 ms\n");
+
 	REGISTER_CVAR2("s_FileCacheManagerSize", &m_fileCacheManagerSize, m_fileCacheManagerSize, VF_REQUIRE_APP_RESTART,
 	               "Sets the size in KiB the AFCM will allocate on the heap.\n"
 	               "Usage: s_FileCacheManagerSize [0/...]\n"
@@ -308,6 +318,8 @@ void CCVars::UnregisterVariables()
 		pConsole->UnregisterVariable("s_PositionUpdateThresholdMultiplier");
 		pConsole->UnregisterVariable("s_VelocityTrackingThreshold");
 		pConsole->UnregisterVariable("s_OcclusionRayLengthOffset");
+		pConsole->UnregisterVariable("s_OcclusionMaxUpdateInterval");
+		pConsole->UnregisterVariable("s_OcclusionStaticRefreshInterval");
 		pConsole->UnregisterVariable("s_FileCacheManagerSize");
 		pConsole->UnregisterVariable("s_AudioObjectPoolSize");
 		pConsole->UnregisterVariable("s_AudioEventPoolSize");
@@ -36,6 +36,8 @@ public:
 	float m_positionUpdateThresholdMultiplier = 0.02f;
 	float m_velocityTrackingThreshold = 0.0f;
 	float m_occlusionRayLengthOffset = 0.0f;
+	float m_occlusionMaxUpdateInterval = 250.0f;
+	float m_occlusionStaticRefreshInterval = 1000.0f;
 
 #if defined(INCLUDE_AUDIO_PRODUCTION_CODE)
 	int    m_ignoreWindowFocus = 0;
@@ -127,6 +127,10 @@ struct SAudioRequestData : public _i_multithread_reference_target_t
 	SAudioRequestData& operator=(SAudioRequestData const&) = delete;
 	SAudioRequestData& operator=(SAudioRequestData&&) = delete;
 
+	// Request payloads are short lived and allocated from many threads, small ones are served from a shared pool.
+	static void* operator new(std::size_t const size);
+	static void  operator delete(void* const pData, std::size_t const size);
+
 	EAudioRequestType const type;
 };
 
@@ -1096,6 +1100,10 @@ public:
 	void*            pUserDataOwner = nullptr;
 	ERequestStatus   status = ERequestStatus::None;
 
+#if defined(INCLUDE_AUDIO_PRODUCTION_CODE)
+	int64 queueTicks = 0; // Set when the request is pushed, used to measure the request latency.
+#endif // INCLUDE_AUDIO_PRODUCTION_CODE
+
 private:
 
 	// Must be private as it needs "AllocateRequestData"!
@@ -80,6 +80,8 @@ void CAudioObjectManager::Update(float const deltaTime, Impl::SObject3DAttribute
 #if defined(INCLUDE_AUDIO_PRODUCTION_CODE)
 	CPropagationProcessor::s_totalAsyncPhysRays = 0;
 	CPropagationProcessor::s_totalSyncPhysRays = 0;
+	CPropagationProcessor::s_totalSkippedQueries = 0;
+	CPropagationProcessor::s_totalSyncPhysRaysTime = 0.0f;
 #endif // INCLUDE_AUDIO_PRODUCTION_CODE
 
 	m_timeSinceLastControlsUpdate += deltaTime;
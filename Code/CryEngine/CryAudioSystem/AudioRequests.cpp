@@ -2,9 +2,47 @@
 
 #include "stdafx.h"
 #include "AudioInternalInterfaces.h"
+#include <CryMemory/PoolAllocator.h>
 
 namespace CryAudio
 {
+// Payloads up to this size come from the pool, larger ones (e.g. requests carrying file paths) from the heap.
+constexpr std::size_t g_pooledRequestDataSize = 128;
+constexpr std::size_t g_pooledRequestDataPageSize = 256;
+
+using RequestDataAllocator = stl::SizePoolAllocator<stl::HeapAllocator<stl::PSyncMultiThread>>;
+
+//////////////////////////////////////////////////////////////////////////
+static RequestDataAllocator& GetRequestDataAllocator()
+{
+	static RequestDataAllocator s_allocator(g_pooledRequestDataSize, alignof(std::max_align_t), stl::FHeap().PageSize(g_pooledRequestDataPageSize));
+	return s_allocator;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void* SAudioRequestData::operator new(std::size_t const size)
+{
+	if (size <= g_pooledRequestDataSize)
+	{
+		return GetRequestDataAllocator().Allocate();
+	}
+
+	return ::operator new(size);
+}
+
+//////////////////////////////////////////////////////////////////////////
+void SAudioRequestData::operator delete(void* const pData, std::size_t const size)
+{
+	if (size <= g_pooledRequestDataSize)
+	{
+		GetRequestDataAllocator().Deallocate(pData);
+	}
+	else
+	{
+		::operator delete(pData);
+	}
+}
+
 #define REQUEST_CASE_BLOCK(CLASS, ENUM, P_SOURCE, P_RESULT)                        \
   case ENUM:                                                                       \
     {                                                                              \
@@ -63,6 +63,7 @@ CSystem::CSystem()
 	, m_lastUpdateTime()
 	, m_deltaTime(0.0f)
 	, m_atl()
+	, m_numOverflowRequests(0)
 {
 	gEnv->pSystem->GetISystemEventDispatcher()->RegisterListener(this, "CryAudio::CSystem");
 	m_mainThread.Init(this);
@@ -72,6 +73,10 @@ CSystem::CSystem()
 CSystem::~CSystem()
 {
 	gEnv->pSystem->GetISystemEventDispatcher()->RemoveListener(this);
+
+	// The ring does not destruct requests left in it.
+	CAudioRequest request;
+	while (m_requestQueue.dequeue(request)) {}
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -127,7 +132,13 @@ void CSystem::PushRequest(CAudioRequest const& request)
 
 	if (m_atl.CanProcessRequests())
 	{
-		m_requestQueue.enqueue(request);
+#if defined(INCLUDE_AUDIO_PRODUCTION_CODE)
+		CAudioRequest queuedRequest(request);
+		queuedRequest.queueTicks = CryGetTicks();
+		EnqueueRequest(queuedRequest);
+#else
+		EnqueueRequest(request);
+#endif // INCLUDE_AUDIO_PRODUCTION_CODE
 
 		if ((request.flags & ERequestFlags::ExecuteBlocking) > 0)
 		{
@@ -149,6 +160,18 @@ void CSystem::PushRequest(CAudioRequest const& request)
 	}
 }
 
+//////////////////////////////////////////////////////////////////////////
+void CSystem::EnqueueRequest(CAudioRequest const& request)
+{
+	// Once a request spilled into the overflow queue all following ones go there as well until it is drained,
+	// otherwise requests of the same producer could overtake each other.
+	if (m_numOverflowRequests.load(std::memory_order_acquire) > 0 || !m_requestQueue.enqueue(request))
+	{
+		m_numOverflowRequests.fetch_add(1, std::memory_order_acq_rel);
+		m_requestOverflowQueue.enqueue(request);
+	}
+}
+
 //////////////////////////////////////////////////////////////////////////
 void CSystem::UpdateTime()
 {
@@ -230,7 +253,7 @@ void CSystem::InternalUpdate()
 		m_atl.Update(m_deltaTime);
 		m_deltaTime = 0.0f;
 
-		bWorkDone = ProcessRequests(m_requestQueue);
+		bWorkDone = ProcessRequests();
 	}
 
 	if (bWorkDone == false)
@@ -746,64 +769,107 @@ IProfileData* CSystem::GetProfileData() const
 }
 
 //////////////////////////////////////////////////////////////////////////
-bool CSystem::ProcessRequests(AudioRequests& requestQueue)
+bool CSystem::ProcessRequests()
 {
 	bool bSuccess = false;
-	CAudioRequest request;
+	uint32 numRequests = 0;
 
-	while (requestQueue.dequeue(request))
+	do
 	{
-		if (request.status == ERequestStatus::None)
+		// Fetch a whole batch before processing so the ring slots are released early for the producers.
+		// The overflow queue is only looked at once the ring has been drained to keep the requests in order.
+		numRequests = 0;
+		uint32 numOverflowRequests = 0;
+
+		while (numRequests < s_maxRequestBatchSize && m_requestQueue.dequeue(m_requestBatch[numRequests]))
 		{
-			request.status = ERequestStatus::Pending;
-			m_atl.ProcessRequest(request);
+			++numRequests;
 		}
-		else
+
+		while (numRequests < s_maxRequestBatchSize && m_requestOverflowQueue.dequeue(m_requestBatch[numRequests]))
 		{
-			// TODO: handle pending requests!
+			++numRequests;
+			++numOverflowRequests;
 		}
 
-		if (request.status != ERequestStatus::Pending)
+		if (numOverflowRequests > 0)
 		{
-			if ((request.flags & ERequestFlags::CallbackOnAudioThread) > 0)
-			{
-				m_atl.NotifyListener(request);
+			m_numOverflowRequests.fetch_sub(numOverflowRequests, std::memory_order_acq_rel);
+		}
 
-				if ((request.flags & ERequestFlags::ExecuteBlocking) > 0)
-				{
-					m_mainEvent.Set();
-				}
+		for (uint32 i = 0; i < numRequests; ++i)
+		{
+			ProcessRequest(m_requestBatch[i]);
+			m_requestBatch[i] = CAudioRequest();
+		}
+
+#if defined(INCLUDE_AUDIO_PRODUCTION_CODE)
+		if (numRequests > 0)
+		{
+			m_atl.GetProfileData()->AddRequestBatch(numRequests, numOverflowRequests);
+		}
+#endif // INCLUDE_AUDIO_PRODUCTION_CODE
+
+		bSuccess |= (numRequests > 0);
+	}
+	while (numRequests > 0);
+
+	return bSuccess;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CSystem::ProcessRequest(CAudioRequest& request)
+{
+#if defined(INCLUDE_AUDIO_PRODUCTION_CODE)
+	m_atl.GetProfileData()->AddRequestLatency(gEnv->pTimer->TicksToSeconds(CryGetTicks() - request.queueTicks) * 1000.0f);
+#endif // INCLUDE_AUDIO_PRODUCTION_CODE
+
+	if (request.status == ERequestStatus::None)
+	{
+		request.status = ERequestStatus::Pending;
+		m_atl.ProcessRequest(request);
+	}
+	else
+	{
+		// TODO: handle pending requests!
+	}
+
+	if (request.status != ERequestStatus::Pending)
+	{
+		if ((request.flags & ERequestFlags::CallbackOnAudioThread) > 0)
+		{
+			m_atl.NotifyListener(request);
+
+			if ((request.flags & ERequestFlags::ExecuteBlocking) > 0)
+			{
+				m_mainEvent.Set();
+			}
+		}
+		else if ((request.flags & ERequestFlags::CallbackOnExternalOrCallingThread) > 0)
+		{
+			if ((request.flags & ERequestFlags::ExecuteBlocking) > 0)
+			{
+				m_syncRequest = request;
+				m_mainEvent.Set();
 			}
-			else if ((request.flags & ERequestFlags::CallbackOnExternalOrCallingThread) > 0)
+			else
 			{
-				if ((request.flags & ERequestFlags::ExecuteBlocking) > 0)
+				if (request.pObject == nullptr)
 				{
-					m_syncRequest = request;
-					m_mainEvent.Set();
+					m_atl.IncrementGlobalObjectSyncCallbackCounter();
 				}
 				else
 				{
-					if (request.pObject == nullptr)
-					{
-						m_atl.IncrementGlobalObjectSyncCallbackCounter();
-					}
-					else
-					{
-						request.pObject->IncrementSyncCallbackCounter();
-					}
-					m_syncCallbacks.enqueue(request);
+					request.pObject->IncrementSyncCallbackCounter();
 				}
-			}
-			else if ((request.flags & ERequestFlags::ExecuteBlocking) > 0)
-			{
-				m_mainEvent.Set();
+				m_syncCallbacks.enqueue(request);
 			}
 		}
-
-		bSuccess = true;
+		else if ((request.flags & ERequestFlags::ExecuteBlocking) > 0)
+		{
+			m_mainEvent.Set();
+		}
 	}
-
-	return bSuccess;
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -107,11 +107,18 @@ public:
 
 private:
 
-	using AudioRequests = ConcQueue<UnboundMPSC, CAudioRequest>;
+	// Requests are pushed into a preallocated lock-free ring. Only when the ring is full they spill into the
+	// node based overflow queue, which producers keep using until the audio thread has drained it to preserve order.
+	using AudioRequests = ConcQueue<BoundMPMC, CAudioRequest>;
+	using AudioRequestsOverflow = ConcQueue<UnboundMPSC, CAudioRequest>;
 	using AudioRequestsSyncCallbacks = ConcQueue<UnboundSPSC, CAudioRequest>;
 
+	static constexpr size_t s_maxRequestBatchSize = 64;
+
 	void        UpdateTime();
-	bool        ProcessRequests(AudioRequests& requestQueue);
+	void        EnqueueRequest(CAudioRequest const& request);
+	bool        ProcessRequests();
+	void        ProcessRequest(CAudioRequest& request);
 	static void OnCallback(SRequestInfo const* const pRequestInfo);
 
 	bool                               m_bSystemInitialized;
@@ -121,6 +128,9 @@ private:
 
 	CAudioTranslationLayer             m_atl;
 	AudioRequests                      m_requestQueue;
+	AudioRequestsOverflow              m_requestOverflowQueue;
+	std::atomic<uint32>                m_numOverflowRequests;
+	CAudioRequest                      m_requestBatch[s_maxRequestBatchSize];
 	AudioRequestsSyncCallbacks         m_syncCallbacks;
 	CAudioRequest                      m_syncRequest;
 	CryEvent                           m_mainEvent;
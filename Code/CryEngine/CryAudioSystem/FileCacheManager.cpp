@@ -7,6 +7,7 @@
 #include <CryRenderer/IRenderer.h>
 #include <CryMemory/IMemory.h>
 #include <CryString/CryPath.h>
+#include <CrySystem/ITimer.h>
 
 #if defined(INCLUDE_AUDIO_PRODUCTION_CODE)
 	#include <CryRenderer/IRenderAuxGeom.h>
@@ -276,6 +277,8 @@ bool CFileCacheManager::UncacheFileCacheEntryInternal(CATLAudioFileEntry* const
 		--pAudioFileEntry->m_useCount;
 	}
 
+	pAudioFileEntry->m_timeLastUsed = gEnv->pTimer->GetAsyncTime();
+
 	if (pAudioFileEntry->m_useCount < 1 || bIgnoreUsedCount)
 	{
 		// Must be cached to proceed.
@@ -348,6 +351,12 @@ void CFileCacheManager::DrawDebugInfo(IRenderAuxGeom& auxGeom, float const posX,
 		auxGeom.Draw2dLabel(posX, posY, 1.5f, orange, false, "FileCacheManager (%d of %d KiB) [Entries: %d]", static_cast<int>(m_currentByteTotal >> 10), static_cast<int>(m_maxByteTotal >> 10), static_cast<int>(m_audioFileEntries.size()));
 		posY += 16.0f;
 
+		uint32 const numRequests = m_stats.numHits + m_stats.numDelayedHits + m_stats.numMisses;
+		float const hitRate = numRequests > 0 ? 100.0f * static_cast<float>(m_stats.numHits) / static_cast<float>(numRequests) : 0.0f;
+		auxGeom.Draw2dLabel(posX, posY, 1.25f, white, false, "Hit Rate: %.1f%% [Hits: %u | Misses: %u | Delayed: %u] Evicted: %u (%d KiB)",
+		                    hitRate, m_stats.numHits, m_stats.numMisses, m_stats.numDelayedHits, m_stats.numEvictions, static_cast<int>(m_stats.evictedBytes >> 10));
+		posY += 16.0f;
+
 		if (!m_audioFileEntries.empty())
 		{
 			CryFixedStringT<MaxControlNameLength> lowerCaseSearchString(g_cvars.m_pDebugFilter->GetString());
@@ -497,7 +506,7 @@ bool CFileCacheManager::DoesRequestFitInternal(size_t const requestSize)
 		if (requestSize <= maxAvailableSize)
 		{
 			// Here we need to cleanup first before allowing the new request to be allocated.
-			TryToUncacheFiles();
+			TryToUncacheFiles(requestSize);
 
 			// We should only indicate success if there's actually really enough room for the new entry!
 			bSuccess = (m_maxByteTotal - m_currentByteTotal) >= requestSize;
@@ -568,7 +577,7 @@ bool CFileCacheManager::AllocateMemoryBlockInternal(CATLAudioFileEntry* const __
 	if (pAudioFileEntry->m_pMemoryBlock == nullptr)
 	{
 		// Memory block is either full or too fragmented, let's try to throw everything out that can be removed and allocate again.
-		TryToUncacheFiles();
+		TryToUncacheFiles(m_maxByteTotal);
 
 		// And try again!
 		if (m_pMemoryHeap != nullptr)
@@ -614,8 +623,11 @@ void CFileCacheManager::UncacheFile(CATLAudioFileEntry* const pAudioFileEntry)
 }
 
 //////////////////////////////////////////////////////////////////////////
-void CFileCacheManager::TryToUncacheFiles()
+void CFileCacheManager::TryToUncacheFiles(size_t const requiredSize)
 {
+	// Removable entries stay cached until their memory is needed, then the least recently used ones go first.
+	std::vector<CATLAudioFileEntry*> removableEntries;
+
 	for (auto const& audioFileEntryPair : m_audioFileEntries)
 	{
 		CATLAudioFileEntry* const pAudioFileEntry = audioFileEntryPair.second;
@@ -624,9 +636,29 @@ void CFileCacheManager::TryToUncacheFiles()
 		    (pAudioFileEntry->m_flags & EFileFlags::Cached) > 0 &&
 		    (pAudioFileEntry->m_flags & EFileFlags::Removable) > 0)
 		{
-			UncacheFileCacheEntryInternal(pAudioFileEntry, true);
+			removableEntries.push_back(pAudioFileEntry);
 		}
 	}
+
+	std::sort(removableEntries.begin(), removableEntries.end(), [](CATLAudioFileEntry const* const pLeft, CATLAudioFileEntry const* const pRight)
+		{
+			return pLeft->m_timeLastUsed < pRight->m_timeLastUsed;
+		});
+
+	for (CATLAudioFileEntry* const pAudioFileEntry : removableEntries)
+	{
+		if ((m_maxByteTotal - m_currentByteTotal) >= requiredSize)
+		{
+			break;
+		}
+
+#if defined(INCLUDE_AUDIO_PRODUCTION_CODE)
+		++m_stats.numEvictions;
+		m_stats.evictedBytes += pAudioFileEntry->m_size;
+#endif // INCLUDE_AUDIO_PRODUCTION_CODE
+
+		UncacheFileCacheEntryInternal(pAudioFileEntry, true);
+	}
 }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -660,6 +692,7 @@ bool CFileCacheManager::TryCacheFileCacheEntryInternal(
   size_t const useCount /*= 0*/)
 {
 	bool bSuccess = false;
+	pAudioFileEntry->m_timeLastUsed = gEnv->pTimer->GetAsyncTime();
 
 	if (!pAudioFileEntry->m_path.empty() &&
 	    (pAudioFileEntry->m_flags & EFileFlags::NotCached) > 0 &&
@@ -688,6 +721,10 @@ bool CFileCacheManager::TryCacheFileCacheEntryInternal(
 			// Always add to the total size.
 			m_currentByteTotal += pAudioFileEntry->m_size;
 			bSuccess = true;
+
+#if defined(INCLUDE_AUDIO_PRODUCTION_CODE)
+			++m_stats.numMisses;
+#endif // INCLUDE_AUDIO_PRODUCTION_CODE
 		}
 		else
 		{
@@ -707,8 +744,13 @@ bool CFileCacheManager::TryCacheFileCacheEntryInternal(
 #if defined(INCLUDE_AUDIO_PRODUCTION_CODE)
 		if ((pAudioFileEntry->m_flags & EFileFlags::Loading) > 0)
 		{
+			++m_stats.numDelayedHits;
 			g_logger.Log(ELogType::Warning, "AFCM: could not cache \"%s\" as it's already loading!", pAudioFileEntry->m_path.c_str());
 		}
+		else
+		{
+			++m_stats.numHits;
+		}
 #endif // INCLUDE_AUDIO_PRODUCTION_CODE
 
 		bSuccess = true;
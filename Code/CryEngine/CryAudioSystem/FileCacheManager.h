@@ -67,7 +67,7 @@ private:
 	bool FinishStreamInternal(IReadStreamPtr const pStream, int unsigned const error);
 	bool AllocateMemoryBlockInternal(CATLAudioFileEntry* const __restrict pAudioFileEntry);
 	void UncacheFile(CATLAudioFileEntry* const pAudioFileEntry);
-	void TryToUncacheFiles();
+	void TryToUncacheFiles(size_t const requiredSize);
 	void UpdateLocalizedFileEntryData(CATLAudioFileEntry* const pAudioFileEntry);
 	bool TryCacheFileCacheEntryInternal(CATLAudioFileEntry* const pAudioFileEntry, FileEntryId const audioFileEntryId, bool const bLoadSynchronously, bool const bOverrideUseCount = false, size_t const useCount = 0);
 
@@ -78,5 +78,18 @@ private:
 	_smart_ptr<::ICustomMemoryHeap> m_pMemoryHeap;
 	size_t                          m_currentByteTotal;
 	size_t                          m_maxByteTotal;
+
+#if defined(INCLUDE_AUDIO_PRODUCTION_CODE)
+	struct SStats
+	{
+		uint32 numHits = 0;         // Requested entry was already cached.
+		uint32 numDelayedHits = 0;  // Requested entry was still streaming in, sounds using it start late.
+		uint32 numMisses = 0;       // Requested entry had to be streamed in.
+		uint32 numEvictions = 0;
+		size_t evictedBytes = 0;
+	};
+
+	SStats m_stats;
+#endif // INCLUDE_AUDIO_PRODUCTION_CODE
 };
 } // namespace CryAudio
@@ -2,6 +2,7 @@
 
 #include "stdafx.h"
 #include "ProfileData.h"
+#include <CrySystem/ITimer.h>
 
 namespace CryAudio
 {
@@ -16,4 +17,28 @@ void CProfileData::SetImplName(char const* const szName)
 {
 	m_implName = szName;
 }
+
+//////////////////////////////////////////////////////////////////////////
+void CProfileData::AddRequestBatch(uint32 const numRequests, uint32 const numOverflowRequests)
+{
+	m_requestStats.numRequests += numRequests;
+	m_requestStats.numOverflowRequests += numOverflowRequests;
+	++m_requestStats.numBatches;
+
+	float const currentTime = gEnv->pTimer->GetAsyncCurTime();
+
+	if (currentTime - m_requestStatsStartTime >= 1.0f)
+	{
+		m_lastRequestStats = m_requestStats;
+		m_requestStats = SRequestStats();
+		m_requestStatsStartTime = currentTime;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CProfileData::AddRequestLatency(float const latency)
+{
+	m_requestStats.totalLatency += latency;
+	m_requestStats.maxLatency = std::max(m_requestStats.maxLatency, latency);
+}
 } // namespace CryAudio
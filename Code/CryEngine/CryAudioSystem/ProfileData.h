@@ -23,8 +23,25 @@ public:
 
 	void SetImplName(char const* const szName);
 
+	struct SRequestStats
+	{
+		uint32 numRequests = 0;
+		uint32 numBatches = 0;
+		uint32 numOverflowRequests = 0;
+		float  totalLatency = 0.0f; // ms
+		float  maxLatency = 0.0f;   // ms
+	};
+
+	// Only called on the audio thread, the stats of the last completed second are drawn in the debug draw.
+	void                 AddRequestBatch(uint32 const numRequests, uint32 const numOverflowRequests);
+	void                 AddRequestLatency(float const latency);
+	SRequestStats const& GetRequestStats() const { return m_lastRequestStats; }
+
 private:
 
 	CryFixedStringT<MaxMiscStringLength> m_implName;
+	SRequestStats                        m_requestStats;
+	SRequestStats                        m_lastRequestStats;
+	float                                m_requestStatsStartTime = 0.0f;
 };
 } // namespace CryAudio
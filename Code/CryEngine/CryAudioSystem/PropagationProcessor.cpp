@@ -7,6 +7,7 @@
 #include "AudioSystem.h"
 #include <Cry3DEngine/I3DEngine.h>
 #include <Cry3DEngine/ISurfaceType.h>
+#include <CrySystem/ITimer.h>
 
 #if defined(INCLUDE_AUDIO_PRODUCTION_CODE)
 	#include <CryRenderer/IRenderAuxGeom.h>
@@ -21,6 +22,7 @@ static size_t const s_numConcurrentRaysLow = 1;
 static size_t const s_numConcurrentRaysMedium = 2;
 static size_t const s_numConcurrentRaysHigh = 4;
 static float const s_listenerHeadSize = 0.15f; // Slightly bigger than the average size of a human head (15 cm)
+static float const s_staticPositionTolerance = 0.01f;
 
 struct SAudioRayOffset
 {
@@ -89,6 +91,10 @@ CPropagationProcessor::CPropagationProcessor(CObjectTransformation const& transf
 	, m_occlusionMultiplier(1.0f)
 	, m_remainingRays(0)
 	, m_rayIndex(0)
+	, m_timeSinceLastQuery(0.0f)
+	, m_numStaticRays(0)
+	, m_lastQueryListenerPosition(ZERO)
+	, m_lastQuerySourcePosition(ZERO)
 	, m_transformation(transformation)
 	, m_currentListenerDistance(0.0f)
 	, m_occlusionType(EOcclusionType::None)
@@ -205,6 +211,7 @@ void CPropagationProcessor::Update(
 #endif // INCLUDE_AUDIO_PRODUCTION_CODE
 
 	m_currentListenerDistance = distance;
+	m_timeSinceLastQuery += deltaTime;
 
 	if (CanRunObstructionOcclusion() && (objectFlags& EObjectFlags::Virtual) == 0)
 	{
@@ -481,6 +488,10 @@ void CPropagationProcessor::CastObstructionRay(
 	directionNormalized.Normalize();
 	Vec3 const finalDirection(direction - (directionNormalized * g_cvars.m_occlusionRayLengthOffset));
 
+#if defined(INCLUDE_AUDIO_PRODUCTION_CODE)
+	int64 const startTicks = bSynch ? CryGetTicks() : 0;
+#endif // INCLUDE_AUDIO_PRODUCTION_CODE
+
 	int const numHits = gEnv->pPhysicalWorld->RayWorldIntersection(
 	  origin,
 	  finalDirection, physicsFlags,
@@ -507,6 +518,7 @@ void CPropagationProcessor::CastObstructionRay(
 	if (bSynch)
 	{
 		++s_totalSyncPhysRays;
+		s_totalSyncPhysRaysTime += gEnv->pTimer->TicksToSeconds(CryGetTicks() - startTicks) * 1000.0f;
 	}
 	else
 	{
@@ -522,6 +534,36 @@ void CPropagationProcessor::RunObstructionQuery(Vec3 const& audioListenerPositio
 
 	if (m_remainingRays == 0)
 	{
+		Vec3 const& sourcePosition = m_transformation.GetPosition();
+		bool const bStatic =
+		  m_lastQueryListenerPosition.IsEquivalent(audioListenerPosition, s_staticPositionTolerance) &&
+		  m_lastQuerySourcePosition.IsEquivalent(sourcePosition, s_staticPositionTolerance);
+
+		if (!bStatic)
+		{
+			m_numStaticRays = 0;
+		}
+
+		// Near objects are queried every update, far ones less often. Once every sample point of a static
+		// source-listener pair has been cast, the cached result is only refreshed occasionally to catch moving occluders.
+		float const updateInterval = (bStatic && m_numStaticRays >= GetNumSamplePositions())
+		                             ? g_cvars.m_occlusionStaticRefreshInterval
+		                             : g_cvars.m_occlusionMaxUpdateInterval * clamp_tpl(m_currentListenerDistance / max(g_cvars.m_occlusionMaxDistance, FloatEpsilon), 0.0f, 1.0f);
+
+		if (m_timeSinceLastQuery < updateInterval)
+		{
+#if defined(INCLUDE_AUDIO_PRODUCTION_CODE)
+			++s_totalSkippedQueries;
+#endif  // INCLUDE_AUDIO_PRODUCTION_CODE
+
+			return;
+		}
+
+		m_timeSinceLastQuery = 0.0f;
+		m_numStaticRays += GetNumConcurrentRays();
+		m_lastQueryListenerPosition = audioListenerPosition;
+		m_lastQuerySourcePosition = sourcePosition;
+
 		// Make the physics ray cast call synchronous or asynchronous depending on the distance to the listener.
 		bool const bSynch = (m_currentListenerDistance <= g_cvars.m_occlusionMaxSyncDistance);
 		Vec3 const side((audioListenerPosition - m_transformation.GetPosition()).Cross(worldUp).normalize());
@@ -705,6 +747,8 @@ size_t CPropagationProcessor::GetNumSamplePositions() const
 
 size_t CPropagationProcessor::s_totalSyncPhysRays = 0;
 size_t CPropagationProcessor::s_totalAsyncPhysRays = 0;
+size_t CPropagationProcessor::s_totalSkippedQueries = 0;
+float CPropagationProcessor::s_totalSyncPhysRaysTime = 0.0f;
 
 ///////////////////////////////////////////////////////////////////////////
 void CPropagationProcessor::DrawObstructionRays(IRenderAuxGeom& auxGeom, EObjectFlags const objectFlags) const
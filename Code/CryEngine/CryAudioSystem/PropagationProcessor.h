@@ -115,6 +115,12 @@ private:
 	size_t                       m_remainingRays;
 	size_t                       m_rayIndex;
 
+	// Queries are spread over frames by distance and skipped for a static source-listener pair once all sample points are known.
+	float                        m_timeSinceLastQuery;
+	size_t                       m_numStaticRays;
+	Vec3                         m_lastQueryListenerPosition;
+	Vec3                         m_lastQuerySourcePosition;
+
 	CObjectTransformation const& m_transformation;
 
 	RayInfoVec                   m_raysInfo;
@@ -127,6 +133,8 @@ public:
 
 	static size_t s_totalSyncPhysRays;
 	static size_t s_totalAsyncPhysRays;
+	static size_t s_totalSkippedQueries;
+	static float  s_totalSyncPhysRaysTime;
 
 	void           DrawObstructionRays(IRenderAuxGeom& auxGeom, EObjectFlags const objectFlags) const;
 	void           DrawRay(IRenderAuxGeom& auxGeom, size_t const rayIndex) const;
@@ -1490,6 +1490,15 @@ struct I3DEngine : public IProcess
 	//! \param pEntity The entity to render.
 	virtual void RegisterEntity(IRenderNode* pEntity, int nSID = -1, int nSIDConsideredSafe = -1) = 0;
 
+	//! Starts a bulk registration scope, used when creating many objects at once (level load, paste, prefab instancing).
+	//! Until the matching EndBulkRegistration, RegisterEntity calls are queued and inserted into the octree in one spatially sorted pass.
+	//! Scopes can be nested, the queue is flushed when the outermost scope ends.
+	//! \note Queued nodes are not returned by octree queries until the scope ends.
+	virtual void BeginBulkRegistration() = 0;
+
+	//! Ends a bulk registration scope started with BeginBulkRegistration.
+	virtual void EndBulkRegistration() = 0;
+
 	//! Selects an entity for debugging.
 	//! \param pEntity - The entity to render.
 	virtual void SelectEntity(IRenderNode* pEntity) = 0;
@@ -153,6 +153,7 @@ struct IStreamable
 		fCurImportance = 0;
 		m_nSelectedFrameId = 0;
 		m_nStatsInUse = 0;
+		m_nStatsPredictionVisible = 0;
 	}
 
 	bool UpdateStreamingPrioriryLowLevel(float fImportance, int nRoundId, bool bFullUpdate)
@@ -196,8 +197,9 @@ struct IStreamable
 	SInstancePriorityInfo m_arrUpdateStreamingPrioriryRoundInfo[2];
 	float                 fCurImportance;
 	EFileStreamingStatus  m_eStreamingStatus;
-	uint32                m_nSelectedFrameId : 31;
-	uint32                m_nStatsInUse      : 1;
+	uint32                m_nSelectedFrameId        : 30;
+	uint32                m_nStatsInUse             : 1;
+	uint32                m_nStatsPredictionVisible : 1; //!< Used by the streaming prediction hit/miss statistics.
 };
 
 // Summary:
@@ -566,6 +566,32 @@ private:
 	IMetaExtensionPtrArray m_extensions;
 };
 
+//! The runtime data pointers of one behavior tree instance, indexed by node id.
+//! The nodes of a template are created one after another, so their ids form the range [firstNodeID, firstNodeID + slots.size()).
+//! Nodes outside of that range, like the ones of a grafted tree, fall back to the lookup in their node creator.
+struct RuntimeDataTable
+{
+	RuntimeDataTable()
+		: firstNodeID(0)
+	{
+	}
+
+	void Reset(const NodeID _firstNodeID, const NodeID endNodeID)
+	{
+		firstNodeID = _firstNodeID;
+		slots.assign(endNodeID - _firstNodeID, (void*)NULL);
+	}
+
+	void** Find(const NodeID nodeID)
+	{
+		const size_t index = (NodeID)(nodeID - firstNodeID);
+		return index < slots.size() ? &slots[index] : NULL;
+	}
+
+	NodeID             firstNodeID;
+	std::vector<void*> slots;
+};
+
 struct UpdateContext
 {
 	UpdateContext(
@@ -585,6 +611,7 @@ struct UpdateContext
 		: entityId(_id)
 		, entity(_entity)
 		, runtimeData(NULL)
+		, runtimeDataTable(NULL)
 		, variables(_variables)
 		, timestamps(_timestamps)
 		, blackboard(_blackboard)
@@ -600,6 +627,7 @@ struct UpdateContext
 	EntityId                  entityId;
 	IEntity&                  entity;
 	void*                     runtimeData;
+	RuntimeDataTable*         runtimeDataTable; //!< Optional. When set, every context of the instance must carry it.
 	BehaviorVariablesContext& variables;
 	TimestampCollection&      timestamps;
 	Blackboard&               blackboard;
@@ -619,11 +647,13 @@ struct EventContext
 	EventContext(const EntityId _id)
 		: entityId(_id)
 		, runtimeData(NULL)
+		, runtimeDataTable(NULL)
 	{
 	}
 
-	EntityId entityId;
-	void*    runtimeData;
+	EntityId          entityId;
+	void*             runtimeData;
+	RuntimeDataTable* runtimeDataTable;
 };
 
 struct INode
@@ -666,7 +696,11 @@ DECLARE_SHARED_POINTERS(INode);
 //! You can create a behavior tree instance from a template.
 struct BehaviorTreeTemplate
 {
-	BehaviorTreeTemplate() {}
+	BehaviorTreeTemplate()
+		: firstNodeID(0)
+		, endNodeID(0)
+	{
+	}
 
 	BehaviorTreeTemplate(
 	  INodePtr& _rootNode,
@@ -677,6 +711,8 @@ struct BehaviorTreeTemplate
 		, defaultTimestampCollection(_timestampCollection)
 		, variableDeclarations(_variableDeclarations)
 		, signalHandler(_signals)
+		, firstNodeID(0)
+		, endNodeID(0)
 	{
 	}
 
@@ -685,6 +721,8 @@ struct BehaviorTreeTemplate
 	TimestampCollection      defaultTimestampCollection;
 	Variables::Declarations  variableDeclarations;
 	Variables::SignalHandler signalHandler;
+	NodeID                   firstNodeID; //!< The ids of the nodes created for this template are [firstNodeID, endNodeID).
+	NodeID                   endNodeID;
 
 #if defined(DEBUG_MODULAR_BEHAVIOR_TREE)
 	CryFixedStringT<64> mbtFilename;
@@ -708,12 +746,14 @@ struct BehaviorTreeInstance
 		, variables(_variables)
 		, behaviorTreeTemplate(_behaviorTreeTemplate)
 	{
+		runtimeDataTable.Reset(_behaviorTreeTemplate->firstNodeID, _behaviorTreeTemplate->endNodeID);
 	}
 
 	TimestampCollection           timestampCollection;
 	Variables::Collection         variables;
 	const BehaviorTreeTemplatePtr behaviorTreeTemplate;
 	Blackboard                    blackboard;
+	RuntimeDataTable              runtimeDataTable;
 
 #ifdef USING_BEHAVIOR_TREE_LOG
 	MessageQueue behaviorLog;
@@ -828,7 +868,9 @@ template<typename NodeType> class NodeCreator : public INodeCreator
 {
 	typedef NodeCreator<NodeType>           ThisNodeCreatorType;
 	typedef typename NodeType::RuntimeData  RuntimeDataType;
-	typedef VectorMap<RuntimeDataID, void*> RuntimeDataCollection;
+	// Looked up on every tick of every node and changed whenever a node starts or stops, for all agents.
+	// A hash map keeps all three constant time, a sorted vector shifts the whole collection on insert/erase.
+	typedef std::unordered_map<RuntimeDataID, void*> RuntimeDataCollection;
 
 	friend class NodeDeleter<NodeType, ThisNodeCreatorType>;
 
@@ -31,12 +31,16 @@ public:
 
 		UpdateContext context = unmodifiedContext;
 
+		// The instance's table saves the hash map lookup in the creator, the creator still owns the data.
 		const RuntimeDataID runtimeDataID = MakeRuntimeDataID(context.entityId, m_id);
-		context.runtimeData = GetCreator()->GetRuntimeData(runtimeDataID);
+		void** runtimeDataSlot = context.runtimeDataTable ? context.runtimeDataTable->Find(m_id) : NULL;
+		context.runtimeData = runtimeDataSlot ? *runtimeDataSlot : GetCreator()->GetRuntimeData(runtimeDataID);
 		const bool nodeNeedsToBeInitialized = (context.runtimeData == NULL);
 		if (nodeNeedsToBeInitialized)
 		{
 			context.runtimeData = GetCreator()->AllocateRuntimeData(runtimeDataID);
+			if (runtimeDataSlot)
+				*runtimeDataSlot = context.runtimeData;
 		}
 
 		if (nodeNeedsToBeInitialized)
@@ -55,6 +59,8 @@ public:
 			OnTerminate(context);
 			GetCreator()->FreeRuntimeData(runtimeDataID);
 			context.runtimeData = NULL;
+			if (runtimeDataSlot)
+				*runtimeDataSlot = NULL;
 
 	#ifdef USING_BEHAVIOR_TREE_LOG
 			if (status == Success && !m_successLog.empty())
@@ -79,12 +85,15 @@ public:
 	{
 		UpdateContext context = unmodifiedContext;
 		const RuntimeDataID runtimeDataID = MakeRuntimeDataID(context.entityId, m_id);
-		context.runtimeData = GetCreator()->GetRuntimeData(runtimeDataID);
+		void** runtimeDataSlot = context.runtimeDataTable ? context.runtimeDataTable->Find(m_id) : NULL;
+		context.runtimeData = runtimeDataSlot ? *runtimeDataSlot : GetCreator()->GetRuntimeData(runtimeDataID);
 		if (context.runtimeData != NULL)
 		{
 			OnTerminate(context);
 			GetCreator()->FreeRuntimeData(runtimeDataID);
 			context.runtimeData = NULL;
+			if (runtimeDataSlot)
+				*runtimeDataSlot = NULL;
 		}
 	}
 
@@ -93,7 +102,8 @@ public:
 	//! Never override this!
 	virtual void SendEvent(const EventContext& unmodifiedContext, const Event& event) override
 	{
-		void* runtimeData = GetCreator()->GetRuntimeData(MakeRuntimeDataID(unmodifiedContext.entityId, m_id));
+		void** runtimeDataSlot = unmodifiedContext.runtimeDataTable ? unmodifiedContext.runtimeDataTable->Find(m_id) : NULL;
+		void* runtimeData = runtimeDataSlot ? *runtimeDataSlot : GetCreator()->GetRuntimeData(MakeRuntimeDataID(unmodifiedContext.entityId, m_id));
 		if (runtimeData)
 		{
 			EventContext context = unmodifiedContext;
@@ -14,13 +14,19 @@ namespace BehaviorTree
 class NodeFactory : public INodeFactory
 {
 public:
-	NodeFactory() : m_nextNodeID(0)
+	NodeFactory() : m_nextNodeID(0), m_currentNodePage(NULL)
 	{
 #ifdef USE_GLOBAL_BUCKET_ALLOCATOR
 		s_bucketAllocator.EnableExpandCleanups(false);
 #endif
 	}
 
+	~NodeFactory()
+	{
+		if (m_currentNodePage && m_currentNodePage->liveCount == 0)
+			CryModuleMemalignFree(m_currentNodePage);
+	}
+
 	void CleanUpBucketAllocator()
 	{
 		s_bucketAllocator.cleanup();
@@ -138,20 +144,67 @@ public:
 		}
 	}
 
+	//! The id the next created node will get. The nodes of a tree loaded in one go have consecutive ids.
+	NodeID GetNextNodeID() const { return m_nextNodeID; }
+
 	//! This will be called while loading a level or jumping into game in the editor.
 	//! The memory will remain until the level is unloaded or we exit the game in the editor.
+	//! Nodes are packed into pages in creation order, so a tree is laid out depth first in a few contiguous blocks.
 	virtual void* AllocateNodeMemory(const size_t size) override
 	{
-		return new char[size];
+		const size_t blockSize = kNodeAlignment + Align(size, kNodeAlignment);
+		if (!m_currentNodePage || m_currentNodePage->used + blockSize > m_currentNodePage->capacity)
+		{
+			const size_t capacity = max((size_t)kNodePageSize, kNodePageHeaderSize + blockSize);
+			NodePage* page = static_cast<NodePage*>(CryModuleMemalign(capacity, kNodeAlignment));
+			page->capacity = capacity;
+			page->used = kNodePageHeaderSize;
+			page->liveCount = 0;
+
+			// The rest of the previous page is given up, it is freed together with its last node.
+			if (m_currentNodePage && m_currentNodePage->liveCount == 0)
+				CryModuleMemalignFree(m_currentNodePage);
+			m_currentNodePage = page;
+		}
+
+		char* block = reinterpret_cast<char*>(m_currentNodePage) + m_currentNodePage->used;
+		*reinterpret_cast<NodePage**>(block) = m_currentNodePage;
+		m_currentNodePage->used += blockSize;
+		++m_currentNodePage->liveCount;
+		return block + kNodeAlignment;
 	}
 
 	//! This will be called while unloading a level or exiting game in the editor.
 	virtual void FreeNodeMemory(void* pointer) override
 	{
-		delete[] (char*)pointer;
+		NodePage* page = *reinterpret_cast<NodePage**>(static_cast<char*>(pointer) - kNodeAlignment);
+		assert(page->liveCount > 0);
+		if (--page->liveCount == 0)
+		{
+			if (page == m_currentNodePage)
+				page->used = kNodePageHeaderSize;
+			else
+				CryModuleMemalignFree(page);
+		}
 	}
 
 private:
+	struct NodePage
+	{
+		size_t capacity;
+		size_t used;
+		size_t liveCount;
+	};
+
+	enum
+	{
+		kNodePageSize       = 16 * 1024,
+		kNodeAlignment      = 16, //!< Every node is preceded by one such block that points to its page.
+		kNodePageHeaderSize = (sizeof(NodePage) + kNodeAlignment - 1) & ~(kNodeAlignment - 1),
+	};
+
+	static size_t Align(const size_t size, const size_t alignment) { return (size + alignment - 1) & ~(alignment - 1); }
+
 	typedef VectorMap<stack_string, INodeCreator*>                                                                                 NodeCreators;
 #ifdef USE_GLOBAL_BUCKET_ALLOCATOR
 	typedef BucketAllocator<BucketAllocatorDetail::DefaultTraits<(2*1024*1024), BucketAllocatorDetail::SyncPolicyUnlocked, false>> BehaviorTreeBucketAllocator;
@@ -161,6 +214,7 @@ private:
 
 	NodeCreators                       m_nodeCreators;
 	NodeID                             m_nextNodeID;
+	NodePage*                          m_currentNodePage;
 	static BehaviorTreeBucketAllocator s_bucketAllocator;
 };
 }
@@ -494,6 +494,10 @@ struct IGameFrameworkListener
 	virtual void OnActionEvent(const SActionEvent& event) = 0;
 	virtual void OnPreRender() {}
 
+	//! Called zero or more times per frame at the fixed rate set by g_fixedLogicTickRate, before the game is updated.
+	//! Use IGameFramework::GetFixedLogicTickAlpha() to interpolate the simulated state for rendering.
+	virtual void OnFixedLogicUpdate(float fFixedDeltaTime) {}
+
 	//! Called when the savegame data is in memory, but before the procesing of it starts.
 	virtual void OnSavegameFileLoadedInMemory(const char* pLevelName) {}
 	virtual void OnForceLoadingWithFlash()                            {}
@@ -571,6 +575,10 @@ struct IGameFramework
 	//! Are we completely into game mode?
 	virtual bool IsGameStarted() = 0;
 
+	//! Returns how far the current frame is between the last fixed logic tick and the next one, in the range [0..1].
+	//! Always 1 when fixed logic ticks are disabled (g_fixedLogicTickRate 0).
+	virtual float GetFixedLogicTickAlpha() const = 0;
+
 	//! \return Pointer to the ISystem interface.
 	virtual ISystem* GetISystem() = 0;
 
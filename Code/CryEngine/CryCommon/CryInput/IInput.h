@@ -403,6 +403,7 @@ struct SInputEvent
 	SInputSymbol*    pSymbol;          //!< Input symbol the event originated from.
 	uint8            deviceIndex;      //!< Local index of this particular controller type.
 	uint8            deviceUniqueID;   //!< Process wide unique controller ID.
+	int64            timestamp;        //!< CryGetTicks() when the device reported the input, set on posting if the device does not provide one.
 
 	SInputEvent()
 		: deviceType(eIDT_Unknown)
@@ -414,6 +415,7 @@ struct SInputEvent
 		, pSymbol(nullptr)
 		, deviceIndex(0)
 		, deviceUniqueID(0)
+		, timestamp(0)
 	{}
 
 	void GetMemoryUsage(ICrySizer* pSizer) const {}
@@ -1308,6 +1310,11 @@ struct IInput
 	//! Returns EInputPlatformFlags.
 	virtual uint32 GetPlatformFlags() const = 0;
 
+	//! Gets the timestamp (CryGetTicks) of the oldest press, release or change event dispatched by the last Update.
+	//! Comparing it with the present time of the frame gives the input-to-present latency.
+	//! \return 0 if no such event was dispatched.
+	virtual int64 GetFrameInputTimestamp() const = 0;
+
 	//! Adds or updates blocking input if SInputBlockData::fBlockDuration exceeds previously blocking time.
 	//! \return true if successfully added inputBlocker or updated existed input blocker's remaining blocking time.
 	virtual bool SetBlockingInput(const SInputBlockData& inputBlockData) = 0;
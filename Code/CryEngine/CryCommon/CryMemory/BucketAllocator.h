@@ -3,6 +3,19 @@
 #ifndef BUCKETALLOCATOR_H
 #define BUCKETALLOCATOR_H
 
+//! Statistics of the per thread caches of a bucket allocator, see IMemoryManager::GetBucketThreadCacheStats.
+struct SBucketThreadCacheStats
+{
+	uint32 numThreadCaches;  //!< Threads currently owning a cache.
+	uint64 numAllocs;        //!< Bucket allocations made through a thread cache, since startup.
+	uint64 numAllocHits;     //!< Allocations served by the thread cache without touching the shared free lists.
+	uint64 numFrees;         //!< Bucket frees made through a thread cache.
+	uint64 numRefills;       //!< Batched refills of a thread cache from the shared free lists.
+	uint64 numFlushes;       //!< Batched returns of cached items to the shared free lists.
+	uint64 numRemoteFrees;   //!< Lower bound of frees of memory allocated on another thread (frees in excess of allocs, per thread).
+	size_t cachedBytes;      //!< Free memory currently held by the thread caches.
+};
+
 #ifdef USE_GLOBAL_BUCKET_ALLOCATOR
 
 	#if CRY_PLATFORM_DURANGO
@@ -63,9 +76,27 @@ struct SystemAllocator
 
 	static UINT_PTR Map(UINT_PTR base, size_t len);
 	static void     UnMap(UINT_PTR addr);
+
+	#if CRY_PLATFORM_WINAPI
+	typedef void (WINAPI * ThreadExitCallback)(void*);
+	#else
+	typedef void (* ThreadExitCallback)(void*);
+	#endif
+
+	//! Thread local slot, onThreadExit is called with the value of the slot when a thread with a non null value exits.
+	//! Returns false if the platform doesn't support it.
+	static bool  CreateThreadSlot(UINT_PTR& slot, ThreadExitCallback onThreadExit);
+	static void* GetThreadSlotValue(UINT_PTR slot);
+	static void  SetThreadSlotValue(UINT_PTR slot, void* value);
 };
 }
 
+	#if CRY_PLATFORM_WINAPI
+		#define BUCKET_ALLOCATOR_THREAD_EXIT_CALLBACK WINAPI
+	#else
+		#define BUCKET_ALLOCATOR_THREAD_EXIT_CALLBACK
+	#endif
+
 	#if CRY_PLATFORM_WINDOWS && CRY_PLATFORM_64BIT
 		#define BUCKET_ALLOCATOR_DEFAULT_SIZE (256 * 1024 * 1024)
 	#else
@@ -216,8 +247,15 @@ public:
 			CryInterlockedAdd(&m_consumed, -(int)sz);
 	#endif
 
-			this->PushOnto(m_freeLists[bucket * NumGenerations + generation], reinterpret_cast<AllocHeader*>(ptr));
-			m_bucketTouched[bucket] = 1;
+			if (ThreadCache* cache = GetThreadCache())
+			{
+				PushOntoThreadCache(*cache, bucket, reinterpret_cast<AllocHeader*>(ptr));
+			}
+			else
+			{
+				this->PushOnto(m_freeLists[bucket * NumGenerations + generation], reinterpret_cast<AllocHeader*>(ptr));
+				m_bucketTouched[bucket] = 1;
+			}
 		}
 		else if (TraitsT::FallbackOnCRTAllowed)
 		{
@@ -288,6 +326,8 @@ public:
 	size_t GetBucketStoragePages();
 	size_t GetBucketConsumedSize();
 
+	void   GetThreadCacheStats(SBucketThreadCacheStats& stats);
+
 	void   cleanup();
 
 	void   EnableExpandCleanups(bool enable)
@@ -329,6 +369,17 @@ private:
 		MaxSegments        = TraitsT::MaxNumSegments,
 
 		AllocFillMagic     = 0xde,
+
+		// a thread cache holds up to this many bytes per bucket (within the item count limits below),
+		// it refills and flushes half of that at once
+		ThreadCacheMagazineBytes    = 2048,
+		ThreadCacheMagazineMinItems = 4,
+		ThreadCacheMagazineMaxItems = 64,
+
+		ThreadCacheSlot_Uninitialized = 0,
+		ThreadCacheSlot_Initializing,
+		ThreadCacheSlot_Ready,
+		ThreadCacheSlot_Unavailable,
 	};
 
 	static const UINT_PTR SmallBlockAlignMask = ~(SmallBlockLength - 1);
@@ -447,6 +498,34 @@ private:
 		uint32   m_lastPageMapped;
 	};
 
+	struct ThreadCacheMagazine
+	{
+		BucketAllocatorDetail::AllocHeader* head;
+		uint32                              count;
+	};
+
+	// Only touched by the owning thread, except for the statistics which are read without synchronization.
+	// Caches are never freed, the one of an exited thread is reused by the next new thread.
+	struct ThreadCache
+	{
+		BucketAllocator*          owner;
+		ThreadCache*              nextCache;
+		volatile LONG             inUse;
+
+		ThreadCacheMagazine       magazines[NumBuckets];
+
+		uint64                    numAllocs;
+		uint64                    numAllocHits;
+		uint64                    numFrees;
+		uint64                    numRefills;
+		uint64                    numFlushes;
+
+		// allocs and frees of previous owners, to estimate the remote frees per thread
+		uint64                    numAllocsAtClaim;
+		uint64                    numFreesAtClaim;
+		uint64                    numRetiredRemoteFrees;
+	};
+
 private:
 	BucketAllocatorDetail::AllocHeader* AllocateFromBucket(size_t sz)
 	{
@@ -461,12 +540,19 @@ private:
 
 		AllocHeader* ptr = NULL;
 
-		do
+		if (ThreadCache* cache = GetThreadCache())
 		{
-			for (int fl = bucket * NumGenerations, flEnd = fl + NumGenerations; !ptr && fl != flEnd; ++fl)
-				ptr = this->PopOff(m_freeLists[fl]);
+			ptr = PopOffThreadCache(*cache, bucket);
+		}
+		else
+		{
+			do
+			{
+				for (int fl = bucket * NumGenerations, flEnd = fl + NumGenerations; !ptr && fl != flEnd; ++fl)
+					ptr = this->PopOff(m_freeLists[fl]);
+			}
+			while (!ptr && Refill(bucket));
 		}
-		while (!ptr && Refill(bucket));
 
 	#ifdef BUCKET_ALLOCATOR_TRAP_FREELIST_TRAMPLING
 		if (ptr)
@@ -518,6 +604,58 @@ private:
 		return ptr;
 	}
 
+	ILINE ThreadCache* GetThreadCache()
+	{
+		if (!SyncingPolicy::ThreadCacheAllowed)
+			return NULL;
+
+		IF_UNLIKELY (m_threadCacheSlotState != ThreadCacheSlot_Ready)
+		{
+			if (!InitThreadCacheSlot())
+				return NULL;
+		}
+
+		ThreadCache* cache = reinterpret_cast<ThreadCache*>(this->GetThreadSlotValue(m_threadCacheSlot));
+		IF_UNLIKELY (!cache)
+			cache = ClaimThreadCache();
+		return cache;
+	}
+
+	ILINE BucketAllocatorDetail::AllocHeader* PopOffThreadCache(ThreadCache& cache, uint8 bucket)
+	{
+		using namespace BucketAllocatorDetail;
+
+		++cache.numAllocs;
+
+		ThreadCacheMagazine& magazine = cache.magazines[bucket];
+		IF_LIKELY (magazine.head)
+			++cache.numAllocHits;
+		else if (!RefillThreadCache(cache, bucket))
+			return NULL;
+
+		AllocHeader* ptr = magazine.head;
+		magazine.head = ptr->next;
+		--magazine.count;
+		return ptr;
+	}
+
+	ILINE void PushOntoThreadCache(ThreadCache& cache, uint8 bucket, BucketAllocatorDetail::AllocHeader* ptr)
+	{
+		++cache.numFrees;
+
+		ThreadCacheMagazine& magazine = cache.magazines[bucket];
+		ptr->next = magazine.head;
+		magazine.head = ptr;
+		IF_UNLIKELY (++magazine.count >= GetThreadCacheCapacity(bucket))
+			FlushThreadCache(cache, bucket, magazine.count / 2);
+	}
+
+	static ILINE uint32 GetThreadCacheCapacity(uint8 bucket)
+	{
+		const size_t numItems = ThreadCacheMagazineBytes / TraitsT::GetSizeForBucket(bucket);
+		return (uint32)min(max(numItems, (size_t)ThreadCacheMagazineMinItems), (size_t)ThreadCacheMagazineMaxItems);
+	}
+
 	FreeBlockHeader* InsertFreeBlock(FreeBlockHeader* after, UINT_PTR start, UINT_PTR end)
 	{
 		bool isFreeBlockDone = (start & SmallBlockAlignMask) == (end & SmallBlockAlignMask) || (start > end - (SmallBlockLength / 2));
@@ -562,6 +700,15 @@ private:
 		return page->hdr.GetBucketId(index);
 	}
 
+	static size_t GetGenerationInternal(void* ptr)
+	{
+		UINT_PTR uptr = reinterpret_cast<UINT_PTR>(ptr);
+		Page* page = reinterpret_cast<Page*>(uptr & PageAlignMask);
+
+		size_t index = (uptr & PageOffsetMask) / SmallBlockLength;
+		return TraitsT::GetGenerationForStability(page->hdr.GetStability(index));
+	}
+
 	static size_t GetSizeInternal(void* ptr)
 	{
 		return TraitsT::GetSizeForBucket(GetBucketInternal(ptr));
@@ -618,6 +765,12 @@ private:
 	void             CleanupInternal(bool sortFreeLists);
 	static void      FreeCleanupInfo(SystemAllocator::CleanupAllocator& alloc, SmallBlockCleanupInfo** infos, size_t infoCapacity);
 
+	bool             InitThreadCacheSlot();
+	ThreadCache*     ClaimThreadCache();
+	bool             RefillThreadCache(ThreadCache& cache, uint8 bucket);
+	void             FlushThreadCache(ThreadCache& cache, uint8 bucket, uint32 numKept);
+	static void BUCKET_ALLOCATOR_THREAD_EXIT_CALLBACK ReleaseThreadCache(void* cache);
+
 private:
 	void* AllocatePageStorage();
 	bool  DeallocatePageStorage(void* ptr);
@@ -638,6 +791,11 @@ private:
 
 	int m_disableExpandCleanups;
 	int m_cleanupOnDestruction;
+
+	// zero initialized for the global allocator, which can be used before its constructor ran
+	volatile LONG             m_threadCacheSlotState;
+	UINT_PTR                  m_threadCacheSlot;
+	ThreadCache* volatile     m_threadCaches;
 };
 
 #else
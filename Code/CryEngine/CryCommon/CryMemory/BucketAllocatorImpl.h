@@ -10,6 +10,7 @@
 
 	#if CRY_PLATFORM_LINUX || CRY_PLATFORM_ANDROID || CRY_PLATFORM_APPLE
 		#include <sys/mman.h> //mmap, munmap
+		#include <pthread.h>  //pthread_key_create
 	#endif
 
 	#define PROFILE_BUCKET_CLEANUP 0
@@ -103,6 +104,9 @@ template<typename TraitsT>
 BucketAllocator<TraitsT>::BucketAllocator(void* baseAddress, bool allowExpandCleanups, bool cleanupOnDestruction)
 	: m_disableExpandCleanups(allowExpandCleanups == false)
 	, m_cleanupOnDestruction(cleanupOnDestruction)
+	, m_threadCacheSlotState(ThreadCacheSlot_Uninitialized)
+	, m_threadCacheSlot(0)
+	, m_threadCaches(NULL)
 {
 	if (baseAddress)
 	{
@@ -873,10 +877,235 @@ void BucketAllocator<TraitsT >::FreeCleanupInfo(CleanupAllocator& alloc, SmallBl
 template<typename TraitsT>
 void BucketAllocator<TraitsT >::cleanup()
 {
+	// Items cached by other threads keep their small blocks alive, only the calling thread's cache can be emptied here
+	if (m_threadCacheSlotState == ThreadCacheSlot_Ready)
+	{
+		if (ThreadCache* cache = reinterpret_cast<ThreadCache*>(this->GetThreadSlotValue(m_threadCacheSlot)))
+		{
+			for (size_t bucket = 0; bucket != NumBuckets; ++bucket)
+			{
+				if (cache->magazines[bucket].head)
+					FlushThreadCache(*cache, (uint8)bucket, 0);
+			}
+		}
+	}
+
 	typename SyncingPolicy::RefillLock lock(*this);
 	CleanupInternal(true);
 }
 
+template<typename TraitsT>
+bool BucketAllocator<TraitsT >::InitThreadCacheSlot()
+{
+	LONG state = m_threadCacheSlotState;
+	if (state == ThreadCacheSlot_Uninitialized &&
+	    CryInterlockedCompareExchange(&m_threadCacheSlotState, ThreadCacheSlot_Initializing, ThreadCacheSlot_Uninitialized) == ThreadCacheSlot_Uninitialized)
+	{
+		UINT_PTR slot;
+		if (this->CreateThreadSlot(slot, &ReleaseThreadCache))
+		{
+			m_threadCacheSlot = slot;
+			MemoryBarrier();
+			m_threadCacheSlotState = ThreadCacheSlot_Ready;
+		}
+		else
+		{
+			m_threadCacheSlotState = ThreadCacheSlot_Unavailable;
+		}
+		state = m_threadCacheSlotState;
+	}
+
+	// Other threads keep using the shared free lists while the slot is being created
+	return state == ThreadCacheSlot_Ready;
+}
+
+template<typename TraitsT>
+typename BucketAllocator<TraitsT>::ThreadCache * BucketAllocator<TraitsT>::ClaimThreadCache()
+{
+	ThreadCache* cache = NULL;
+	for (ThreadCache* it = m_threadCaches; it && !cache; it = it->nextCache)
+	{
+		if (!it->inUse && CryInterlockedCompareExchange(&it->inUse, 1, 0) == 0)
+			cache = it;
+	}
+
+	if (!cache)
+	{
+	#ifdef BUCKET_SIMULATOR
+		cache = reinterpret_cast<ThreadCache*>(malloc(sizeof(ThreadCache)));
+	#else
+		cache = reinterpret_cast<ThreadCache*>(CryCrtMalloc(sizeof(ThreadCache)));
+	#endif
+		if (!cache)
+			return NULL;
+
+		memset(cache, 0, sizeof(ThreadCache));
+		cache->owner = this;
+		cache->inUse = 1;
+
+		ThreadCache* head;
+		do
+		{
+			head = m_threadCaches;
+			cache->nextCache = head;
+		}
+		while (CryInterlockedCompareExchangePointer(reinterpret_cast<void* volatile*>(&m_threadCaches), cache, head) != head);
+	}
+
+	cache->numAllocsAtClaim = cache->numAllocs;
+	cache->numFreesAtClaim = cache->numFrees;
+
+	this->SetThreadSlotValue(m_threadCacheSlot, cache);
+	return cache;
+}
+
+template<typename TraitsT>
+bool BucketAllocator<TraitsT >::RefillThreadCache(ThreadCache& cache, uint8 bucket)
+{
+	using namespace BucketAllocatorDetail;
+
+	ThreadCacheMagazine& magazine = cache.magazines[bucket];
+	BucketAssert(!magazine.head && !magazine.count);
+
+	++cache.numRefills;
+
+	// Take half a magazine at once, in the same generation order as a single allocation would
+	const uint32 numWanted = GetThreadCacheCapacity(bucket) / 2;
+	AllocHeader* tail = NULL;
+
+	do
+	{
+		for (size_t fl = bucket * NumGenerations, flEnd = fl + NumGenerations; fl != flEnd && magazine.count != numWanted; )
+		{
+			AllocHeader* item = this->PopOff(m_freeLists[fl]);
+			if (!item)
+			{
+				++fl;
+				continue;
+			}
+
+			if (tail)
+				tail->next = item;
+			else
+				magazine.head = item;
+			tail = item;
+			++magazine.count;
+		}
+	}
+	while (!tail && Refill(bucket));
+
+	if (tail)
+		tail->next = NULL;
+
+	return tail != NULL;
+}
+
+template<typename TraitsT>
+void BucketAllocator<TraitsT >::FlushThreadCache(ThreadCache& cache, uint8 bucket, uint32 numKept)
+{
+	using namespace BucketAllocatorDetail;
+
+	ThreadCacheMagazine& magazine = cache.magazines[bucket];
+	BucketAssert(numKept < magazine.count);
+
+	++cache.numFlushes;
+
+	// Keep the most recently freed items, they are the most likely to still be in the CPU cache
+	AllocHeader* item = magazine.head;
+	if (numKept)
+	{
+		AllocHeader* last = magazine.head;
+		for (uint32 i = 1; i != numKept; ++i)
+			last = last->next;
+
+		item = last->next;
+		last->next = NULL;
+	}
+	else
+	{
+		magazine.head = NULL;
+	}
+	magazine.count = numKept;
+
+	// Sort the rest by generation, and return each generation to the shared free lists in one go
+	AllocHeader* heads[NumGenerations] = { 0 };
+	AllocHeader* tails[NumGenerations] = { 0 };
+	size_t counts[NumGenerations] = { 0 };
+
+	while (item)
+	{
+		AllocHeader* next = item->next;
+		size_t generation = GetGenerationInternal(item);
+
+		item->next = heads[generation];
+		if (!heads[generation])
+			tails[generation] = item;
+		heads[generation] = item;
+		++counts[generation];
+
+		item = next;
+	}
+
+	for (size_t generation = 0; generation != NumGenerations; ++generation)
+	{
+		if (heads[generation])
+			this->PushListOnto(m_freeLists[bucket * NumGenerations + generation], heads[generation], tails[generation], counts[generation]);
+	}
+
+	m_bucketTouched[bucket] = 1;
+}
+
+template<typename TraitsT>
+void BUCKET_ALLOCATOR_THREAD_EXIT_CALLBACK BucketAllocator<TraitsT >::ReleaseThreadCache(void* pCache)
+{
+	ThreadCache* cache = reinterpret_cast<ThreadCache*>(pCache);
+	BucketAllocator* allocator = cache->owner;
+
+	for (size_t bucket = 0; bucket != NumBuckets; ++bucket)
+	{
+		if (cache->magazines[bucket].head)
+			allocator->FlushThreadCache(*cache, (uint8)bucket, 0);
+	}
+
+	const uint64 numAllocs = cache->numAllocs - cache->numAllocsAtClaim;
+	const uint64 numFrees = cache->numFrees - cache->numFreesAtClaim;
+	if (numFrees > numAllocs)
+		cache->numRetiredRemoteFrees += numFrees - numAllocs;
+	cache->numAllocsAtClaim = cache->numAllocs;
+	cache->numFreesAtClaim = cache->numFrees;
+
+	CryInterlockedExchange(&cache->inUse, 0);
+}
+
+template<typename TraitsT>
+void BucketAllocator<TraitsT >::GetThreadCacheStats(SBucketThreadCacheStats& stats)
+{
+	memset(&stats, 0, sizeof(stats));
+
+	for (ThreadCache* cache = m_threadCaches; cache; cache = cache->nextCache)
+	{
+		stats.numAllocs += cache->numAllocs;
+		stats.numAllocHits += cache->numAllocHits;
+		stats.numFrees += cache->numFrees;
+		stats.numRefills += cache->numRefills;
+		stats.numFlushes += cache->numFlushes;
+		stats.numRemoteFrees += cache->numRetiredRemoteFrees;
+
+		if (cache->inUse)
+		{
+			++stats.numThreadCaches;
+
+			const uint64 numAllocs = cache->numAllocs - cache->numAllocsAtClaim;
+			const uint64 numFrees = cache->numFrees - cache->numFreesAtClaim;
+			if (numFrees > numAllocs)
+				stats.numRemoteFrees += numFrees - numAllocs;
+
+			for (size_t bucket = 0; bucket != NumBuckets; ++bucket)
+				stats.cachedBytes += cache->magazines[bucket].count * TraitsT::GetSizeForBucket((uint8)bucket);
+		}
+	}
+}
+
 template<typename TraitsT>
 void* BucketAllocator<TraitsT >::AllocatePageStorage()
 {
@@ -1131,6 +1360,27 @@ inline void BucketAllocatorDetail::SystemAllocator::CleanupAllocator::Free(void*
 	// Will be freed automatically when the allocator is destroyed
 }
 
+inline bool BucketAllocatorDetail::SystemAllocator::CreateThreadSlot(UINT_PTR& slot, ThreadExitCallback onThreadExit)
+{
+	// Fiber local storage rather than TlsAlloc, for the callback on thread exit
+	DWORD index = FlsAlloc(onThreadExit);
+	if (index == FLS_OUT_OF_INDEXES)
+		return false;
+
+	slot = index;
+	return true;
+}
+
+inline void* BucketAllocatorDetail::SystemAllocator::GetThreadSlotValue(UINT_PTR slot)
+{
+	return FlsGetValue(static_cast<DWORD>(slot));
+}
+
+inline void BucketAllocatorDetail::SystemAllocator::SetThreadSlotValue(UINT_PTR slot, void* value)
+{
+	FlsSetValue(static_cast<DWORD>(slot), value);
+}
+
 	#elif CRY_PLATFORM_ORBIS
 
 		#define BUCKET_ALLOCATOR_PAGE_SIZE (64 * 1024)
@@ -1210,6 +1460,23 @@ inline bool BucketAllocatorDetail::SystemAllocator::CleanupAllocator::IsValid()
 	return m_base != NULL;
 }
 
+inline bool BucketAllocatorDetail::SystemAllocator::CreateThreadSlot(UINT_PTR& slot, ThreadExitCallback onThreadExit)
+{
+	// No thread caches, all threads use the shared free lists
+	(void) slot;
+	(void) onThreadExit;
+	return false;
+}
+
+inline void* BucketAllocatorDetail::SystemAllocator::GetThreadSlotValue(UINT_PTR slot)
+{
+	return NULL;
+}
+
+inline void BucketAllocatorDetail::SystemAllocator::SetThreadSlotValue(UINT_PTR slot, void* value)
+{
+}
+
 	#elif CRY_PLATFORM_LINUX || CRY_PLATFORM_ANDROID || CRY_PLATFORM_APPLE
 inline UINT_PTR BucketAllocatorDetail::SystemAllocator::ReserveAddressSpace(size_t numPages, size_t pageLen)
 {
@@ -1348,6 +1615,26 @@ inline void BucketAllocatorDetail::SystemAllocator::CleanupAllocator::Free(void*
 {
 	// Will be freed automatically when the allocator is destroyed
 }
+
+inline bool BucketAllocatorDetail::SystemAllocator::CreateThreadSlot(UINT_PTR& slot, ThreadExitCallback onThreadExit)
+{
+	pthread_key_t key;
+	if (pthread_key_create(&key, onThreadExit) != 0)
+		return false;
+
+	slot = static_cast<UINT_PTR>(key);
+	return true;
+}
+
+inline void* BucketAllocatorDetail::SystemAllocator::GetThreadSlotValue(UINT_PTR slot)
+{
+	return pthread_getspecific(static_cast<pthread_key_t>(slot));
+}
+
+inline void BucketAllocatorDetail::SystemAllocator::SetThreadSlotValue(UINT_PTR slot, void* value)
+{
+	pthread_setspecific(static_cast<pthread_key_t>(slot), value);
+}
 	#endif
 
 #endif
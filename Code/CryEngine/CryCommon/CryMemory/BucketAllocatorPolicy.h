@@ -26,6 +26,9 @@ struct SyncPolicyLocked
 {
 	typedef SLockFreeSingleLinkedListHeader FreeListHeader;
 
+	//! Each thread keeps a small cache of free items per bucket in front of the shared free lists.
+	enum { ThreadCacheAllowed = 1 };
+
 	typedef CryCriticalSectionNonRecursive  Lock;
 
 	Lock& GetRefillLock()
@@ -73,6 +76,8 @@ struct SyncPolicyUnlocked
 {
 	typedef AllocHeader* FreeListHeader;
 
+	enum { ThreadCacheAllowed = 0 };
+
 	struct RefillLock
 	{
 		RefillLock(SyncPolicyUnlocked&) {}
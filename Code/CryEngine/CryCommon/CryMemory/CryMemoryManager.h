@@ -354,6 +354,9 @@ class IGeneralMemoryHeap;
 class IPageMappingHeap;
 class IDefragAllocator;
 class IMemoryAddressRange;
+class IFrameArena;
+struct SFrameArenaStats;
+struct SBucketThreadCacheStats;
 
 //! Interfaces that allow access to the CryEngine memory manager.
 struct IMemoryManager
@@ -423,6 +426,16 @@ struct IMemoryManager
 
 	virtual void*                    AllocPages(size_t size) = 0;
 	virtual void                     FreePages(void* p, size_t size) = 0;
+
+	//! Frame arena of the calling thread (created on first use), see FrameArena.h.
+	virtual IFrameArena*             GetThreadFrameArena() = 0;
+	//! Called once per frame by the system, allocations from two frames ago become invalid.
+	virtual void                     AdvanceFrameArenas() = 0;
+	//! Accumulated usage and overflow statistics of all frame arenas.
+	virtual void                     GetFrameArenaStats(SFrameArenaStats& stats) = 0;
+
+	//! Hit rate and cross thread free statistics of the per thread caches of the global bucket allocator, see BucketAllocator.h.
+	virtual void                     GetBucketThreadCacheStats(SBucketThreadCacheStats& stats) = 0;
 };
 
 //! Global function implemented in CryMemoryManager_impl.h.
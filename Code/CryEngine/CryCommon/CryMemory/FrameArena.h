@@ -0,0 +1,191 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#pragma once
+
+//---------------------------------------------------------------------------
+// Per thread, frame scoped linear (bump pointer) allocator.
+//
+// Each thread owns two buffers which are used in alternating frames, so an
+// allocation stays valid for the frame it was made in and the following one
+// (e.g. while the render thread consumes the previous frame). The frame
+// boundary is advanced by CSystem::Update, a thread resets its older buffer
+// lazily on its next allocation, so no thread ever touches another thread's
+// arena. Memory is never freed individually. Allocations which don't fit into
+// the buffer go to the heap and are counted as overflow
+// (see IMemoryManager::GetFrameArenaStats and sys_frame_arena_dump). The
+// arena of a thread spawned through IThreadManager is freed two frames after
+// the thread exited.
+//
+// Only use this for transient data which is guaranteed to die within one
+// frame, e.g.:
+//
+// std::vector<int, stl::STLFrameArenaAllocator<int>> scratch;
+//---------------------------------------------------------------------------
+
+#include "CryMemoryManager.h"
+#include <CryCore/StlUtils.h>
+
+#include <climits>
+
+// the per module arena cache needs native thread local storage
+#if !defined(USE_PTHREAD_TLS)
+	#define CRY_FRAME_ARENA 1
+#else
+	#define CRY_FRAME_ARENA 0
+#endif
+
+struct SFrameArenaStats
+{
+	uint32 numArenas;       //!< Number of threads which allocated from a frame arena.
+	size_t capacity;        //!< Bytes per buffer (summed up over all arenas).
+	size_t used;            //!< Bytes allocated from the current buffers.
+	size_t peakUsed;        //!< Highest number of bytes a single frame needed, including overflow (max over all arenas).
+	uint32 numOverflows;    //!< Allocations which didn't fit into the buffer, since startup.
+	size_t overflowBytes;   //!< Bytes which went to the heap because the buffer was full, since startup.
+};
+
+class IFrameArena
+{
+public:
+	//! Returns memory valid until the end of the next frame, never returns nullptr.
+	ILINE void* Allocate(size_t size, size_t alignment = 16)
+	{
+		IF_UNLIKELY (*m_pFrameId != m_frameId)
+			BeginFrame();
+
+		uint8* p = Align(m_pCursor, alignment);
+		IF_LIKELY (size <= (size_t)(m_pEnd - p))
+		{
+			m_pCursor = p + size;
+			return p;
+		}
+		return AllocateOverflow(size, alignment);
+	}
+
+	virtual void        GetStats(SFrameArenaStats& stats) const = 0;
+	virtual const char* GetThreadName() const = 0;
+
+protected:
+	IFrameArena() : m_pCursor(nullptr), m_pEnd(nullptr), m_frameId(0), m_pFrameId(nullptr) {}
+	virtual ~IFrameArena() {}
+
+	//! Switches to the other buffer and resets it.
+	virtual void  BeginFrame() = 0;
+	virtual void* AllocateOverflow(size_t size, size_t alignment) = 0;
+
+	static ILINE uint8* Align(uint8* p, size_t alignment) { return (uint8*)(((UINT_PTR)p + alignment - 1) & ~(UINT_PTR)(alignment - 1)); }
+
+	uint8*              m_pCursor;
+	uint8*              m_pEnd;
+	int                 m_frameId;
+	const volatile int* m_pFrameId;
+};
+
+//! Frame arena of the calling thread, nullptr if not supported on this platform.
+ILINE IFrameArena* CryGetThreadFrameArena()
+{
+#if CRY_FRAME_ARENA
+	// per module cache, the arenas live in CrySystem
+	static THREADLOCAL IFrameArena* s_pArena = nullptr;
+	IF_UNLIKELY (!s_pArena)
+		s_pArena = CryGetIMemoryManager()->GetThreadFrameArena();
+	return s_pArena;
+#else
+	return nullptr;
+#endif
+}
+
+//! Allocates from the frame arena of the calling thread, falls back to the module heap if there is none.
+//! Memory from the heap fallback is leaked unless it is released with CryFrameArenaFree.
+ILINE void* CryFrameArenaAlloc(size_t size, size_t alignment = 16)
+{
+	if (IFrameArena* pArena = CryGetThreadFrameArena())
+		return pArena->Allocate(size, alignment);
+	return CryModuleMemalign(size, alignment);
+}
+
+ILINE void CryFrameArenaFree(void* p)
+{
+	if (!CryGetThreadFrameArena())
+		CryModuleMemalignFree(p);
+}
+
+namespace stl
+{
+//! STL allocator for transient containers, deallocate is a no-op, the memory is reclaimed two frames later.
+//! The container has to be filled on a single thread, but may be read from any thread until the end of the next frame.
+template<class T>
+class STLFrameArenaAllocator : public SAllocatorConstruct
+{
+public:
+	typedef size_t    size_type;
+	typedef ptrdiff_t difference_type;
+	typedef T*        pointer;
+	typedef const T*  const_pointer;
+	typedef T&        reference;
+	typedef const T&  const_reference;
+	typedef T         value_type;
+
+	template<class U> struct rebind
+	{
+		typedef STLFrameArenaAllocator<U> other;
+	};
+
+	STLFrameArenaAllocator() throw()
+	{
+	}
+
+	STLFrameArenaAllocator(const STLFrameArenaAllocator&) throw()
+	{
+	}
+
+	template<class U> STLFrameArenaAllocator(const STLFrameArenaAllocator<U>&) throw()
+	{
+	}
+
+	pointer address(reference x) const
+	{
+		return &x;
+	}
+
+	const_pointer address(const_reference x) const
+	{
+		return &x;
+	}
+
+	pointer allocate(size_type n = 1, const void* hint = 0)
+	{
+		(void)hint;
+		return static_cast<pointer>(CryFrameArenaAlloc(n * sizeof(T), max((size_t)alignof(T), (size_t)16)));
+	}
+
+	void deallocate(pointer p, size_type n = 1)
+	{
+		CryFrameArenaFree(p);
+	}
+
+	size_type max_size() const throw()
+	{
+		return INT_MAX;
+	}
+
+	template<class U>
+	void destroy(U* p)
+	{
+		p->~U();
+	}
+
+	bool operator==(const STLFrameArenaAllocator&) const { return true; }
+	bool operator!=(const STLFrameArenaAllocator&) const { return false; }
+};
+
+template<> class STLFrameArenaAllocator<void>
+{
+public:
+	typedef void*       pointer;
+	typedef const void* const_pointer;
+	typedef void        value_type;
+	template<class U>
+	struct rebind { typedef STLFrameArenaAllocator<U> other; };
+};
+}
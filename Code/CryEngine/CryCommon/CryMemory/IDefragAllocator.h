@@ -87,6 +87,7 @@ public:
 			, maxAllocs(0)
 			, maxSegments(1)
 			, blockSearchKind(eBSK_BestFit)
+			, szName("")
 		{
 		}
 
@@ -94,6 +95,9 @@ public:
 		size_t                  maxAllocs;
 		size_t                  maxSegments;
 		EBlockSearchKind        blockSearchKind;
+
+		//! Shown in the defrag statistics (sys_defrag_dump, Statoscope), must stay valid while the allocator is alive.
+		const char* szName;
 	};
 
 public:
@@ -117,6 +121,7 @@ public:
 	virtual size_t                GetAllocated() const = 0;
 	virtual IDefragAllocatorStats GetStats() = 0;
 
+	//! Moves are also limited by the heap's share of the per frame budget in sys_defrag_budget, unless bForce is set.
 	virtual size_t                DefragmentTick(size_t maxMoves, size_t maxAmount, bool bForce = false) = 0;
 
 	virtual UINT_PTR              UsableSize(Hdl hdl) = 0;
@@ -641,7 +641,9 @@ struct SBandwidthStatsSubset
 		m_lobbyPacketsSent(0),
 		m_seqPacketsSent(0),
 		m_fragmentPacketsSent(0),
-		m_totalPacketsRecvd(0)
+		m_totalPacketsRecvd(0),
+		m_sendSyscalls(0),
+		m_recvSyscalls(0)
 	{
 	}
 
@@ -655,6 +657,8 @@ struct SBandwidthStatsSubset
 	int    m_seqPacketsSent;
 	int    m_fragmentPacketsSent;
 	int    m_totalPacketsRecvd;
+	int    m_sendSyscalls; //!< Socket send calls, a single call can send several packets when batched.
+	int    m_recvSyscalls; //!< Socket receive calls, a single call can receive several packets when batched.
 };
 
 struct SBandwidthStats
@@ -677,6 +681,8 @@ struct SBandwidthStats
 		ret.m_seqPacketsSent = m_total.m_seqPacketsSent - m_prev.m_seqPacketsSent;
 		ret.m_fragmentPacketsSent = m_total.m_fragmentPacketsSent - m_prev.m_fragmentPacketsSent;
 		ret.m_totalPacketsRecvd = m_total.m_totalPacketsRecvd - m_prev.m_totalPacketsRecvd;
+		ret.m_sendSyscalls = m_total.m_sendSyscalls - m_prev.m_sendSyscalls;
+		ret.m_recvSyscalls = m_total.m_recvSyscalls - m_prev.m_recvSyscalls;
 		return ret;
 	}
 
@@ -708,6 +714,7 @@ struct SProfileInfoStat
 		: m_name(""),
 		m_totalBits(0),
 		m_calls(0),
+		m_timeMs(0.f),
 		m_rmi(false)
 	{
 	}
@@ -715,6 +722,7 @@ struct SProfileInfoStat
 	string m_name;
 	uint32 m_totalBits;
 	uint32 m_calls;
+	float  m_timeMs; //!< CPU time spent in this entry this frame, children included.
 	bool   m_rmi;
 };
 
@@ -2293,6 +2301,7 @@ struct SNetProfileCount
 	CCyclicStatsBuffer<uint32, NET_PROFILE_AVERAGE_SECS> m_rmibitsAv;
 	CCyclicStatsBuffer<float, NET_PROFILE_AVERAGE_SECS>  m_payloadAv;
 	CCyclicStatsBuffer<float, NET_PROFILE_AVERAGE_SECS>  m_onWireAv;
+	CCyclicStatsBuffer<float, NET_PROFILE_AVERAGE_SECS>  m_timeAv; //!< CPU time in milliseconds.
 
 	float m_worst;
 	float m_worstAv;
@@ -2311,6 +2320,8 @@ struct SNetProfileCount
 		m_payloadAv.AddSample(.0f);
 		m_onWireAv.Clear();
 		m_onWireAv.AddSample(.0f);
+		m_timeAv.Clear();
+		m_timeAv.AddSample(.0f);
 
 		m_worst = 0.f;
 		m_worstAv = 0.f;
@@ -2328,6 +2339,9 @@ struct SNetProfileStackEntry
 	uint32                 m_bits;      //!< Number of estimated bits sent over the last second (for seq bits it only counts them once, i.e. num clients doesn't affect the count. For rmis all clients are included).
 	uint32                 m_rmibits;   //!< Number of bits sent over the last second (all clients included).
 	uint32                 m_calls;     //!< Number of calls over the last second.
+	int64                  m_tickTicks; //!< CPU ticks spent in this entry this frame, children included.
+	int64                  m_ticks;     //!< CPU ticks spent in this entry over the last second, children included.
+	int64                  m_startTicks;
 
 	float                  m_budget;
 	SNetProfileStackEntry* m_parent;
@@ -2346,6 +2360,7 @@ struct SNetProfileStackEntry
 	{
 		m_tickBits = 0;
 		m_tickCalls = 0;
+		m_tickTicks = 0;
 	}
 
 	void ClearStatistics()
@@ -2353,6 +2368,7 @@ struct SNetProfileStackEntry
 		m_calls = 0;
 		m_bits = 0;
 		m_rmibits = 0;
+		m_ticks = 0;
 		m_budget = 0.f;
 		ClearTickBits();
 	}
@@ -2365,6 +2381,7 @@ struct SNetProfileStackEntry
 		m_child = NULL;
 		m_rmi = false;
 		m_untouchedCounter = 0;
+		m_startTicks = 0;
 		counts.Clear();
 		ClearStatistics();
 	}
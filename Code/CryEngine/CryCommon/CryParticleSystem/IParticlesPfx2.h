@@ -87,6 +87,7 @@ enum EUpdateList
 	EUL_ComputeBounds,    // this feature augments the bounding box for rendering
 	EUL_Render,           // this feature has geometry to render
 	EUL_RenderDeferred,   // this feature has geometry to render but can only render after all updates are done
+	EUL_RenderDeferredJob, // same as EUL_RenderDeferred, but the rendering is thread safe and can run in a job
 
 	EUL_Count,
 };
@@ -162,6 +163,8 @@ struct IParticleSystem : public ICryUnknown
 	virtual PParticleEffect         ConvertEffect(const IParticleEffect* pOldEffect, bool bReplace = false) = 0;
 	virtual void                    RenameEffect(PParticleEffect pEffect, cstr name) = 0;
 	virtual PParticleEffect         FindEffect(cstr name, bool bAllowLoad = true) = 0;
+	//! Loads the effect in a job, FindEffect and CreateEmitter wait for the load if it is still running.
+	virtual PParticleEffect         PreloadEffect(cstr name) = 0;
 	virtual PParticleEmitter        CreateEmitter(PParticleEffect pEffect) = 0;
 	virtual uint                    GetNumFeatureParams() const = 0;
 	virtual SParticleFeatureParams& GetFeatureParam(uint featureIdx) const = 0;
@@ -2361,7 +2361,8 @@ enum meshflags
 	mesh_transient              = 0x800000,  //!< all mesh allocations will go to a flushable pool
 	mesh_no_booleans            = 0x1000000, //!< disables boolean operations on the mesh
 	mesh_AABB_plane_optimise    = 0x4000,    //!< aabb generation is faster since it assumes the tri's are in a plane and distributed uniformly
-	mesh_no_filter              = 0x2000000  //!< doesn't attempt to filter away degenerate triangles
+	mesh_no_filter              = 0x2000000, //!< doesn't attempt to filter away degenerate triangles
+	mesh_AABB_SAH               = 0x4000000  //!< aabb tree splits are chosen with a binned surface area heuristic (slower to build, faster queries)
 };
 enum meshAuxData { mesh_data_materials = 1, mesh_data_foreign_idx = 2, mesh_data_vtxmap = 4 }; //!< used in DestroyAuxiliaryMeshData
 
@@ -2880,6 +2881,10 @@ struct PhysicsVars : SolverSettings
 	float timeScalePlayers;
 	float threadLag;
 	int   numThreads;
+	int   nIslandBatchEnts; //!< islands of up to this many entities in total are taken by a physics thread in one go
+	float lodDist;          //!< islands farther than this from all LOD observers step at half rate, twice as far - at quarter rate (0 - off)
+	float lodSleepScale;    //!< sleep energy threshold multiplier per LOD level
+	int   bAsyncStep;       //!< PhysX: the last substep of TimeStep keeps simulating until the next TimeStep
 	int   physCPU;
 	int   physWorkerCPU;
 	Vec3  helperOffset;
@@ -3262,6 +3267,30 @@ struct IPhysicalWorld
 		int               nMaxPortals; // max amount of returned portals (= list size - 1)
 	};
 
+	//! SRWIBatchParams - independent rays that share the filters of one RayWorldIntersection call
+	//! hits has nMaxHits entries per ray, the hits of ray i start at hits[i*nMaxHits]
+	//! pnHits (optional) receives the number of hits of each ray
+	//! with rwi_queue each ray is queued with iForeignData from piForeignData (or its index in the batch), and hits may be 0 to use the hits pool
+	struct SRWIBatchParams
+	{
+		SRWIBatchParams() { memset(this, 0, sizeof(*this)); objtypes = ent_all; flags = rwi_stop_at_pierceable; }
+
+		const Vec3*       pOrg;
+		const Vec3*       pDir;
+		int               nRays;
+		void*             pForeignData;
+		const int*        piForeignData;
+		int               (* OnEvent)(const EventPhysRWIResult*);
+		int               objtypes;
+		unsigned int      flags;
+		ray_hit*          hits;
+		int               nMaxHits;
+		int*              pnHits;
+		int               nSkipEnts;
+		IPhysicalEntity** pSkipEnts;
+		SCollisionClass   collclass;
+	};
+
 	//! PrimitiveWorldIntersection  - similar to RayWorldIntersection, but does a primitive sweep (or overlap) check
 	//! unlike RWI, it doesn't trace enitity cells along the path, but checks all of them in the swept volume's bounding box,
 	//! so long PWIs are not recommended
@@ -3372,6 +3401,10 @@ struct IPhysicalWorld
 	//! flags - entity types to update (ent_..; ent_deleted to purge deletion physics-on-demand state monitoring)
 	virtual void  TimeStep(float time_interval, int flags = ent_all | ent_deleted) = 0;
 
+	//! SetLODObserver - sets or clears (pPos==0) one of the 8 physics LOD observer positions, see PhysicsVars::lodDist
+	//! the system keeps the view camera in slot 0, other slots are free for players
+	virtual void  SetLODObserver(int iSlot, const Vec3* pPos) = 0;
+
 	virtual float GetPhysicsTime() = 0;
 	virtual int   GetiPhysicsTime() = 0; //!< physics time, quantized with PhysVars->timeGranularity
 	virtual void  SetPhysicsTime(float time) = 0;
@@ -3387,6 +3420,9 @@ struct IPhysicalWorld
 	virtual int GetEntitiesInBox(Vec3 ptmin, Vec3 ptmax, IPhysicalEntity**& pList, int objtypes, int szListPrealloc = 0) = 0;
 
 	virtual int RayWorldIntersection(const SRWIParams& rp, const char* pNameTag = RWI_NAME_TAG, int iCaller = MAX_PHYS_THREADS) = 0;
+	//! Traces a batch of rays with the locks and filter setup shared, in an order that keeps neighbouring rays together
+	//! returns the total amount of hits detected (or the amount of queued rays with rwi_queue)
+	virtual int RayWorldIntersectionBatch(const SRWIBatchParams& bp, const char* pNameTag = RWI_NAME_TAG, int iCaller = MAX_PHYS_THREADS) = 0;
 	//! Traces ray requests (rwi calls with rwi_queue set); logs and calls EventPhysRWIResult for each
 	//! returns the number of rays traced
 	virtual int  TracePendingRays(int bDoActualTracing = 1) = 0;
@@ -3448,6 +3484,9 @@ struct IPhysicalWorld
 	virtual int   GetEntityProfileInfo(phys_profile_info*& pList) = 0;
 	virtual int   GetFuncProfileInfo(phys_profile_info*& pList) = 0;
 	virtual int   GetGroupProfileInfo(phys_profile_info*& pList) = 0;
+	//! returns the most expensive islands of the last step (with p_profile 2), in decreasing order
+	//! nTicksLast is the solver time, nCallsLast the number of entities and nCalls the number of contacts
+	virtual int   GetIslandProfileInfo(phys_profile_info*& pList) = 0;
 	virtual int   GetJobProfileInfo(phys_job_info*& pList) = 0;
 
 	//! AddEventClient - adds a phyisics event listener
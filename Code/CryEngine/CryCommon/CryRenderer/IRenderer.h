@@ -2469,11 +2469,14 @@ struct SShaderCacheStatistics
 	size_t m_nTotalLevelShaderCacheMisses;
 	size_t m_nGlobalShaderCacheMisses;
 	size_t m_nNumShaderAsyncCompiles;
+	size_t m_nNumShaderCacheSyncReads; //!< Cache entries read on the calling thread, each one a potential frame hitch.
+	float  m_fShaderCacheSyncReadTime; //!< Total time spent in those reads, in seconds.
 	bool   m_bShaderCompileActive;
 
 	SShaderCacheStatistics() : m_nTotalLevelShaderCacheMisses(0),
 		m_nGlobalShaderCacheMisses(0),
-		m_nNumShaderAsyncCompiles(0), m_bShaderCompileActive(false)
+		m_nNumShaderAsyncCompiles(0), m_nNumShaderCacheSyncReads(0),
+		m_fShaderCacheSyncReadTime(0.0f), m_bShaderCompileActive(false)
 	{}
 };
 
@@ -28,6 +28,7 @@ namespace EnvFunctionUtils
 {
 
 struct SBinding;
+struct SStubParams;
 
 enum class EParamFlags
 {
@@ -39,7 +40,7 @@ enum class EParamFlags
 
 typedef CEnumFlags<EParamFlags> ParamFlags;
 
-typedef void (* StubPtr)(const SBinding&, CRuntimeParamMap& params, void* pObject);
+typedef void (* StubPtr)(const SBinding&, const SStubParams& params, void* pObject);
 
 enum : uint32
 {
@@ -142,6 +143,37 @@ struct SBinding
 	uint32                 outputs[MaxParams];
 };
 
+// Parameters of a stub call, either looked up by id in a runtime parameter map or pre-bound by the caller
+// as arrays in input and output order.
+struct SStubParams
+{
+	inline explicit SStubParams(CRuntimeParamMap& _map)
+		: pMap(&_map)
+		, pInputs(nullptr)
+		, pOutputs(nullptr)
+	{}
+
+	inline SStubParams(const CAnyConstPtr* _pInputs, const CAnyPtr* _pOutputs)
+		: pMap(nullptr)
+		, pInputs(_pInputs)
+		, pOutputs(_pOutputs)
+	{}
+
+	inline CAnyConstPtr GetInput(const SParamBinding& param) const
+	{
+		return pMap ? pMap->GetInput(CUniqueId::FromUInt32(param.id)) : pInputs[param.idx];
+	}
+
+	inline CAnyPtr GetOutput(const SParamBinding& param) const
+	{
+		return pMap ? pMap->GetOutput(CUniqueId::FromUInt32(param.id)) : pOutputs[param.idx];
+	}
+
+	CRuntimeParamMap*   pMap;
+	const CAnyConstPtr* pInputs;
+	const CAnyPtr*      pOutputs;
+};
+
 template<typename TYPE> inline void InitParamBinding(SParamBinding& paramBinding)
 {
 	typedef SParamTraits<TYPE> Traits;
@@ -238,11 +270,11 @@ template<typename TYPE> struct SParamReader
 {
 	typedef const TYPE& ReturnType;
 
-	static inline ReturnType ReadParam(const SBinding& binding, uint32 paramIdx, CRuntimeParamMap& params)
+	static inline ReturnType ReadParam(const SBinding& binding, uint32 paramIdx, const SStubParams& params)
 	{
 		const SParamBinding& param = binding.params[paramIdx];
 		SCHEMATYC_CORE_ASSERT_FATAL(param.flags.Check(EParamFlags::BoundToInput));
-		return DynamicCast<TYPE>(*params.GetInput(CUniqueId::FromUInt32(param.id)));
+		return DynamicCast<TYPE>(*params.GetInput(param));
 	}
 };
 
@@ -250,11 +282,11 @@ template<typename TYPE> struct SParamReader<TYPE&>
 {
 	typedef TYPE& ReturnType;
 
-	static inline ReturnType ReadParam(const SBinding& binding, uint32 paramIdx, CRuntimeParamMap& params)
+	static inline ReturnType ReadParam(const SBinding& binding, uint32 paramIdx, const SStubParams& params)
 	{
 		const SParamBinding& param = binding.params[paramIdx];
 		SCHEMATYC_CORE_ASSERT_FATAL(param.flags.Check(EParamFlags::BoundToOutput));
-		return DynamicCast<TYPE>(*params.GetOutput(CUniqueId::FromUInt32(param.id)));
+		return DynamicCast<TYPE>(*params.GetOutput(param));
 	}
 };
 
@@ -262,24 +294,24 @@ template<typename TYPE> struct SParamReader<const TYPE&>
 {
 	typedef const TYPE& ReturnType;
 
-	static inline ReturnType ReadParam(const SBinding& binding, uint32 paramIdx, CRuntimeParamMap& params)
+	static inline ReturnType ReadParam(const SBinding& binding, uint32 paramIdx, const SStubParams& params)
 	{
 		const SParamBinding& param = binding.params[paramIdx];
 		SCHEMATYC_CORE_ASSERT_FATAL(param.flags.Check(EParamFlags::BoundToInput));
-		return DynamicCast<TYPE>(*params.GetInput(CUniqueId::FromUInt32(param.id)));
+		return DynamicCast<TYPE>(*params.GetInput(param));
 	}
 };
 
-template<typename TYPE> inline typename SParamReader<TYPE>::ReturnType ReadParam(const SBinding& binding, uint32 paramIdx, CRuntimeParamMap& params)
+template<typename TYPE> inline typename SParamReader<TYPE>::ReturnType ReadParam(const SBinding& binding, uint32 paramIdx, const SStubParams& params)
 {
 	return SParamReader<TYPE>::ReadParam(binding, paramIdx, params);
 }
 
-template<typename TYPE> inline void WriteParam(const SBinding& binding, uint32 paramIdx, CRuntimeParamMap& params, const TYPE& value)
+template<typename TYPE> inline void WriteParam(const SBinding& binding, uint32 paramIdx, const SStubParams& params, const TYPE& value)
 {
 	const SParamBinding& param = binding.params[paramIdx];
 	SCHEMATYC_CORE_ASSERT_FATAL(param.flags.Check(EParamFlags::BoundToOutput));
-	DynamicCast<typename SParamTraits<TYPE>::UnqualifiedType>(*params.GetOutput(CUniqueId::FromUInt32(param.id))) = value;
+	DynamicCast<typename SParamTraits<TYPE>::UnqualifiedType>(*params.GetOutput(param)) = value;
 }
 
 template<typename FUNCTION_PTR_TYPE> struct SBinder
@@ -301,7 +333,7 @@ struct SBinder<void (*)()>
 		*reinterpret_cast<FunctionPtr*>(binding.pFunction) = pFunction;
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		FunctionPtr pFunction = *reinterpret_cast<const FunctionPtr*>(binding.pFunction);
 		(*pFunction)();
@@ -327,7 +359,7 @@ struct SBinder<void (OBJECT::*)()>
 		binding.pObjectTypeDesc = &GetTypeDesc<OBJECT>();
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		FunctionPtr pFunction = *reinterpret_cast<const FunctionPtr*>(binding.pFunction);
 		(static_cast<OBJECT*>(pObject)->*pFunction)();
@@ -353,7 +385,7 @@ struct SBinder<void (OBJECT::*)() const>
 		binding.pObjectTypeDesc = &GetTypeDesc<OBJECT>();
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		FunctionPtr pFunction = *reinterpret_cast<const FunctionPtr*>(binding.pFunction);
 		(static_cast<const OBJECT*>(pObject)->*pFunction)();
@@ -379,7 +411,7 @@ struct SBinder<PARAM0 (*)()>
 		InitReturnParamBinding<PARAM0>(binding.params[0]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		FunctionPtr pFunction = *reinterpret_cast<const FunctionPtr*>(binding.pFunction);
 		WriteParam<PARAM0>(binding, 0, params, (*pFunction)());
@@ -407,7 +439,7 @@ struct SBinder<PARAM0 (OBJECT::*)()>
 		InitReturnParamBinding<PARAM0>(binding.params[0]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		FunctionPtr pFunction = *reinterpret_cast<const FunctionPtr*>(binding.pFunction);
 		WriteParam<PARAM0>(binding, 0, params, (static_cast<OBJECT*>(pObject)->*pFunction)());
@@ -435,7 +467,7 @@ struct SBinder<PARAM0 (OBJECT::*)() const>
 		InitReturnParamBinding<PARAM0>(binding.params[0]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		FunctionPtr pFunction = *reinterpret_cast<const FunctionPtr*>(binding.pFunction);
 		WriteParam<PARAM0>(binding, 0, params, (static_cast<const OBJECT*>(pObject)->*pFunction)());
@@ -461,7 +493,7 @@ struct SBinder<void (*)(PARAM1)>
 		InitParamBinding<PARAM1>(binding.params[1]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 
@@ -491,7 +523,7 @@ struct SBinder<void (OBJECT::*)(PARAM1)>
 		InitParamBinding<PARAM1>(binding.params[1]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 
@@ -523,7 +555,7 @@ struct SBinder<void (OBJECT::*)(PARAM1) const>
 		InitParamBinding<PARAM1>(binding.params[1]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 
@@ -553,7 +585,7 @@ struct SBinder<PARAM0 (*)(PARAM1)>
 		InitParamBinding<PARAM1>(binding.params[1]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 
@@ -585,7 +617,7 @@ struct SBinder<PARAM0 (OBJECT::*)(PARAM1)>
 		InitParamBinding<PARAM1>(binding.params[1]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 
@@ -617,7 +649,7 @@ struct SBinder<PARAM0 (OBJECT::*)(PARAM1) const>
 		InitParamBinding<PARAM1>(binding.params[1]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 
@@ -646,7 +678,7 @@ struct SBinder<void (*)(PARAM1, PARAM2)>
 		InitParamBinding<PARAM2>(binding.params[2]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -678,7 +710,7 @@ struct SBinder<void (OBJECT::*)(PARAM1, PARAM2)>
 		InitParamBinding<PARAM2>(binding.params[2]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -710,7 +742,7 @@ struct SBinder<void (OBJECT::*)(PARAM1, PARAM2) const>
 		InitParamBinding<PARAM2>(binding.params[2]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -742,7 +774,7 @@ struct SBinder<PARAM0 (*)(PARAM1, PARAM2)>
 		InitParamBinding<PARAM2>(binding.params[2]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -776,7 +808,7 @@ struct SBinder<PARAM0 (OBJECT::*)(PARAM1, PARAM2)>
 		InitParamBinding<PARAM2>(binding.params[2]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -810,7 +842,7 @@ struct SBinder<PARAM0 (OBJECT::*)(PARAM1, PARAM2) const>
 		InitParamBinding<PARAM2>(binding.params[2]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -841,7 +873,7 @@ struct SBinder<void (*)(PARAM1, PARAM2, PARAM3)>
 		InitParamBinding<PARAM3>(binding.params[3]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -875,7 +907,7 @@ struct SBinder<void (OBJECT::*)(PARAM1, PARAM2, PARAM3)>
 		InitParamBinding<PARAM3>(binding.params[3]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -909,7 +941,7 @@ struct SBinder<void (OBJECT::*)(PARAM1, PARAM2, PARAM3) const>
 		InitParamBinding<PARAM3>(binding.params[3]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -943,7 +975,7 @@ struct SBinder<PARAM0 (*)(PARAM1, PARAM2, PARAM3)>
 		InitParamBinding<PARAM3>(binding.params[3]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -979,7 +1011,7 @@ struct SBinder<PARAM0 (OBJECT::*)(PARAM1, PARAM2, PARAM3)>
 		InitParamBinding<PARAM3>(binding.params[3]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1015,7 +1047,7 @@ struct SBinder<PARAM0 (OBJECT::*)(PARAM1, PARAM2, PARAM3) const>
 		InitParamBinding<PARAM3>(binding.params[3]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1048,7 +1080,7 @@ struct SBinder<void (*)(PARAM1, PARAM2, PARAM3, PARAM4)>
 		InitParamBinding<PARAM4>(binding.params[4]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1084,7 +1116,7 @@ struct SBinder<void (OBJECT::*)(PARAM1, PARAM2, PARAM3, PARAM4)>
 		InitParamBinding<PARAM4>(binding.params[4]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1120,7 +1152,7 @@ struct SBinder<void (OBJECT::*)(PARAM1, PARAM2, PARAM3, PARAM4) const>
 		InitParamBinding<PARAM4>(binding.params[4]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1156,7 +1188,7 @@ struct SBinder<PARAM0 (*)(PARAM1, PARAM2, PARAM3, PARAM4)>
 		InitParamBinding<PARAM4>(binding.params[4]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1194,7 +1226,7 @@ struct SBinder<PARAM0 (OBJECT::*)(PARAM1, PARAM2, PARAM3, PARAM4)>
 		InitParamBinding<PARAM4>(binding.params[4]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1232,7 +1264,7 @@ struct SBinder<PARAM0 (OBJECT::*)(PARAM1, PARAM2, PARAM3, PARAM4) const>
 		InitParamBinding<PARAM4>(binding.params[4]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1267,7 +1299,7 @@ struct SBinder<void (*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5)>
 		InitParamBinding<PARAM5>(binding.params[5]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1305,7 +1337,7 @@ struct SBinder<void (OBJECT::*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5)>
 		InitParamBinding<PARAM5>(binding.params[5]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1343,7 +1375,7 @@ struct SBinder<void (OBJECT::*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5) const>
 		InitParamBinding<PARAM5>(binding.params[5]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1381,7 +1413,7 @@ struct SBinder<PARAM0 (*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5)>
 		InitParamBinding<PARAM5>(binding.params[5]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1421,7 +1453,7 @@ struct SBinder<PARAM0 (OBJECT::*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5)>
 		InitParamBinding<PARAM5>(binding.params[5]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1461,7 +1493,7 @@ struct SBinder<PARAM0 (OBJECT::*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5) const>
 		InitParamBinding<PARAM5>(binding.params[5]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1498,7 +1530,7 @@ struct SBinder<void (*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5, PARAM6)>
 		InitParamBinding<PARAM6>(binding.params[6]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1538,7 +1570,7 @@ struct SBinder<void (OBJECT::*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5, PARAM6)>
 		InitParamBinding<PARAM6>(binding.params[6]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1578,7 +1610,7 @@ struct SBinder<void (OBJECT::*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5, PARAM6)
 		InitParamBinding<PARAM6>(binding.params[6]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1618,7 +1650,7 @@ struct SBinder<PARAM0 (*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5, PARAM6)>
 		InitParamBinding<PARAM6>(binding.params[6]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1660,7 +1692,7 @@ struct SBinder<PARAM0 (OBJECT::*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5, PARAM6
 		InitParamBinding<PARAM6>(binding.params[6]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1702,7 +1734,7 @@ struct SBinder<PARAM0 (OBJECT::*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5, PARAM6
 		InitParamBinding<PARAM6>(binding.params[6]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1741,7 +1773,7 @@ struct SBinder<void (*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5, PARAM6, PARAM7)>
 		InitParamBinding<PARAM7>(binding.params[7]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1783,7 +1815,7 @@ struct SBinder<void (OBJECT::*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5, PARAM6,
 		InitParamBinding<PARAM7>(binding.params[7]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1825,7 +1857,7 @@ struct SBinder<void (OBJECT::*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5, PARAM6,
 		InitParamBinding<PARAM7>(binding.params[7]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1867,7 +1899,7 @@ struct SBinder<PARAM0 (*)(PARAM0, PARAM1, PARAM2, PARAM3, PARAM4, PARAM5, PARAM6
 		InitParamBinding<PARAM7>(binding.params[7]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1911,7 +1943,7 @@ struct SBinder<PARAM0 (OBJECT::*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5, PARAM6
 		InitParamBinding<PARAM7>(binding.params[7]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1955,7 +1987,7 @@ struct SBinder<PARAM0 (OBJECT::*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5, PARAM6
 		InitParamBinding<PARAM7>(binding.params[7]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -1996,7 +2028,7 @@ struct SBinder<void (*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5, PARAM6, PARAM7,
 		InitParamBinding<PARAM8>(binding.params[8]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -2040,7 +2072,7 @@ struct SBinder<void (OBJECT::*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5, PARAM6,
 		InitParamBinding<PARAM8>(binding.params[8]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -2084,7 +2116,7 @@ struct SBinder<void (OBJECT::*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5, PARAM6,
 		InitParamBinding<PARAM8>(binding.params[8]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -2128,7 +2160,7 @@ struct SBinder<PARAM0 (*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5, PARAM6, PARAM7
 		InitParamBinding<PARAM8>(binding.params[8]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -2174,7 +2206,7 @@ struct SBinder<PARAM0 (OBJECT::*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5, PARAM6
 		InitParamBinding<PARAM8>(binding.params[8]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -2220,7 +2252,7 @@ struct SBinder<PARAM0 (OBJECT::*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5, PARAM6
 		InitParamBinding<PARAM8>(binding.params[8]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -2263,7 +2295,7 @@ struct SBinder<void (*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5, PARAM6, PARAM7,
 		InitParamBinding<PARAM9>(binding.params[9]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -2309,7 +2341,7 @@ struct SBinder<void (OBJECT::*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5, PARAM6,
 		InitParamBinding<PARAM9>(binding.params[9]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -2355,7 +2387,7 @@ struct SBinder<void (OBJECT::*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5, PARAM6,
 		InitParamBinding<PARAM9>(binding.params[9]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -2401,7 +2433,7 @@ struct SBinder<PARAM0 (*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5, PARAM6, PARAM7
 		InitParamBinding<PARAM9>(binding.params[9]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -2449,7 +2481,7 @@ struct SBinder<PARAM0 (OBJECT::*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5, PARAM6
 		InitParamBinding<PARAM9>(binding.params[9]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -2497,7 +2529,7 @@ struct SBinder<PARAM0 (OBJECT::*)(PARAM1, PARAM2, PARAM3, PARAM4, PARAM5, PARAM6
 		InitParamBinding<PARAM9>(binding.params[9]);
 	}
 
-	static void Stub(const SBinding& binding, CRuntimeParamMap& params, void* pObject)
+	static void Stub(const SBinding& binding, const SStubParams& params, void* pObject)
 	{
 		typename SParamTraits<PARAM1>::ProxyType param1 = ReadParam<PARAM1>(binding, 1, params);
 		typename SParamTraits<PARAM2>::ProxyType param2 = ReadParam<PARAM2>(binding, 2, params);
@@ -2626,7 +2658,15 @@ public:
 	{
 		if (m_binding.pStub)
 		{
-			(*m_binding.pStub)(m_binding, params, pObject);
+			(*m_binding.pStub)(m_binding, EnvFunctionUtils::SStubParams(params), pObject);
+		}
+	}
+
+	virtual void Execute(const CAnyConstPtr* pInputs, const CAnyPtr* pOutputs, void* pObject) const override
+	{
+		if (m_binding.pStub)
+		{
+			(*m_binding.pStub)(m_binding, EnvFunctionUtils::SStubParams(pInputs, pOutputs), pObject);
 		}
 	}
 
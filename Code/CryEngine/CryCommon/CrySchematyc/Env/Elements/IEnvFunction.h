@@ -11,6 +11,7 @@ namespace Schematyc
 
 // Forward declare classes.
 class CAnyConstPtr;
+class CAnyPtr;
 class CCommonTypeDesc;
 class CRuntimeParamMap;
 
@@ -43,6 +44,8 @@ struct IEnvFunction : public IEnvElementBase<EEnvElementType::Function>
 	virtual const char*            GetOutputDescription(uint32 outputIdx) const = 0;
 	virtual CAnyConstPtr           GetOutputData(uint32 outputIdx) const = 0;
 	virtual void                   Execute(CRuntimeParamMap& params, void* pObject) const = 0;
+	// Inputs and outputs in the order of GetInputId() and GetOutputId(), bound by the caller without id lookups.
+	virtual void                   Execute(const CAnyConstPtr* pInputs, const CAnyPtr* pOutputs, void* pObject) const = 0;
 };
 
 DECLARE_SHARED_POINTERS(IEnvFunction)
@@ -598,7 +598,8 @@ private:
 		Invalid
 	};
 
-	typedef DynArray<SRuntimeActivationParams> Bookmarks;
+	// Bookmarks live on the stack, only deeply nested loops spill to the heap.
+	typedef LocalDynArray<SRuntimeActivationParams, 32> Bookmarks;
 
 public:
 
@@ -662,7 +663,6 @@ inline bool CRuntimeGraphInstance::Execute(void* pObject, CRuntimeParamMap& para
 	}
 
 	Bookmarks bookmarks;
-	bookmarks.reserve(32);
 
 	do
 	{
@@ -680,11 +680,13 @@ inline bool CRuntimeGraphInstance::Execute(void* pObject, CRuntimeParamMap& para
 		RuntimeGraphNodeCallbackPtr pCallback = pNode->GetCallback();
 		if (pCallback)
 		{
+#if SCHEMATYC_LOGGING_ENABLED
 			CLogMetaData logMetaData;
 			logMetaData.Set(ELogMetaField::LinkCommand, CryLinkUtils::ECommand::Show);
 			logMetaData.Set(ELogMetaField::ElementGUID, m_graph.GetGUID());
 			logMetaData.Set(ELogMetaField::DetailGUID, pNode->GetGUID());
 			SCHEMATYC_LOG_SCOPE(logMetaData);
+#endif
 
 			CRuntimeGraphNodeInstance nodeInstance(*pNode, m_scratchpad);
 			SRuntimeContext context(pObject, params, *this, nodeInstance);
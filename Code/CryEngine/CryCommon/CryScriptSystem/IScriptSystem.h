@@ -456,6 +456,15 @@ struct IScriptSystem
 	//! Push a parameter during a function call.
 	virtual void PushFuncParamAny(const ScriptAnyValue& any) = 0;
 
+	//! Push a parameter during a function call without going through ScriptAnyValue.
+	//! Used by PushFuncParam for the most common callback parameter types.
+	//! @{.
+	virtual void PushFuncParamNumber(float value) = 0;
+	virtual void PushFuncParamBool(bool value) = 0;
+	virtual void PushFuncParamHandle(ScriptHandle value) = 0;
+	virtual void PushFuncParamTable(IScriptTable* pTable) = 0;
+	//! @}.
+
 	//! Set Global value.
 	virtual void SetGlobalAny(const char* sKey, const ScriptAnyValue& any) = 0;
 
@@ -553,6 +562,10 @@ struct IScriptSystem
 	}
 
 	template<class T> void PushFuncParam(const T& value)                    { PushFuncParamAny(value); }
+	void                   PushFuncParam(float value)                       { PushFuncParamNumber(value); }
+	void                   PushFuncParam(bool value)                        { PushFuncParamBool(value); }
+	void                   PushFuncParam(ScriptHandle value)                { PushFuncParamHandle(value); }
+	void                   PushFuncParam(IScriptTable* pTable)              { PushFuncParamTable(pTable); }
 
 	template<class T> void SetGlobalValue(const char* sKey, const T& value) { SetGlobalAny(sKey, ScriptAnyValue(value)); }
 	template<class T> bool GetGlobalValue(const char* sKey, T& value)
@@ -9,6 +9,8 @@
 //! CRY_UNIT_TEST_CHECK_CLOSE:     Fails and reports if the specified floating point values are not equal with respect to epsilon.
 //! CRY_UNIT_TEST_CHECK_EQUAL:     Fails and reports if the specified values are not equal.
 //! CRY_UNIT_TEST_CHECK_DIFFERENT: Fails and reports if the specified values are not different.
+//! CRY_UNIT_BENCHMARK:            A benchmark block, timed repeatedly by the benchmark runner.
+//! CRY_UNIT_BENCHMARK_KEEP:       Keeps the compiler from optimizing away a value computed in a benchmark.
 //!
 //! Usage of comparison checks should be favored over the generic CRY_UNIT_TEST_ASSERT because of detailed output in the report.
 
@@ -123,6 +125,31 @@ struct IUnitTest
 	virtual void                 Done() = 0;
 };
 
+//! Describes a benchmark, filled in by the registration macro.
+struct SBenchmarkInfo
+{
+	string suite;
+	string name;
+	string fileName;
+	int    lineNumber = 0;
+	string module;
+};
+
+//! Base class for all user benchmarks expanded through macros.
+//! Run() executes one iteration of the measured work, the runner batches iterations so that a sample is long enough to time.
+struct SBenchmark
+{
+	virtual ~SBenchmark() {}
+
+	virtual void Run() = 0;
+
+	//! Optional setup and teardown, not included in the timing.
+	virtual void Init() {}
+	virtual void Done() {}
+
+	SBenchmarkInfo m_benchmarkInfo;
+};
+
 struct IUnitTestReporter
 {
 	virtual ~IUnitTestReporter(){}
@@ -156,6 +183,13 @@ struct IUnitTestManager
 	//! 'callback' for failed tests, to prevent storing information in the exception, allowing use of setjmp/longjmp.
 	virtual void SetExceptionCause(const char* expression, const char* file, int line) = 0;
 
+	virtual void RegisterBenchmark(SBenchmark& benchmark) = 0;
+
+	//! Runs all benchmarks whose "Module:Suite:Name" contains szFilter (all when empty).
+	//! Results are written as json to szOutputFile and compared against szBaselineFile, both are optional.
+	//! \return Number of benchmarks that regressed against the baseline.
+	virtual int  RunAllBenchmarks(const char* szFilter, const char* szOutputFile, const char* szBaselineFile) = 0;
+
 	//! Helper called on module initialization. Do not use directly.
 	void CreateTests(const char* moduleName);
 };
@@ -196,6 +230,21 @@ struct SUnitTestRegistrar : public CStaticInstanceList<SUnitTestRegistrar>
 	STest& test;
 };
 
+//! Same as SUnitTestRegistrar, for benchmarks.
+struct SBenchmarkRegistrar : public CStaticInstanceList<SBenchmarkRegistrar>
+{
+	SBenchmarkRegistrar(SBenchmark& benchmark, const char* suite, const char* name, const char* filename, int line)
+		: benchmark(benchmark)
+	{
+		benchmark.m_benchmarkInfo.suite = suite;
+		benchmark.m_benchmarkInfo.name = name;
+		benchmark.m_benchmarkInfo.fileName = filename;
+		benchmark.m_benchmarkInfo.lineNumber = line;
+	}
+
+	SBenchmark& benchmark;
+};
+
 inline void IUnitTestManager::CreateTests(const char* moduleName)
 {
 	for (SUnitTestRegistrar* pTestRegistrar = SUnitTestRegistrar::GetFirstInstance();
@@ -205,6 +254,14 @@ inline void IUnitTestManager::CreateTests(const char* moduleName)
 		pTestRegistrar->test.m_unitTestInfo.SetModule(moduleName);
 		GetTestInstance(pTestRegistrar->test.m_unitTestInfo);
 	}
+
+	for (SBenchmarkRegistrar* pBenchmarkRegistrar = SBenchmarkRegistrar::GetFirstInstance();
+	     pBenchmarkRegistrar != nullptr;
+	     pBenchmarkRegistrar = pBenchmarkRegistrar->GetNextInstance())
+	{
+		pBenchmarkRegistrar->benchmark.m_benchmarkInfo.module = moduleName;
+		RegisterBenchmark(pBenchmarkRegistrar->benchmark);
+	}
 }
 
 } // namespace CryUnitTest
@@ -268,6 +325,14 @@ ILINE bool AreInequal(const char* str1, const char* str2)       { return strcmp(
 template<std::size_t M, std::size_t N>
 ILINE bool AreInequal(const char(&str1)[M], const char(&str2)[N]) { return strcmp(str1, str2) != 0; }
 
+//! Publishes the address of a value through a volatile, so its computation can't be removed as dead code.
+template<typename T>
+ILINE void KeepValue(const T& value)
+{
+	static const void* volatile s_pSink;
+	s_pSink = std::addressof(value);
+}
+
 }
 
 //! Specifies a new test.
@@ -294,6 +359,29 @@ ILINE bool AreInequal(const char(&str1)[M], const char(&str2)[N]) { return strcm
   CryUnitTest::SUnitTestRegistrar autoreg_unittest_ ## ClassName(auto_unittest_instance_ ## ClassName, CryUnitTestSuite::GetSuiteName(), # ClassName, __FILE__, __LINE__); \
   void ClassName::Run()
 
+//! Specifies a new benchmark. The block is one iteration of the measured work.
+#define CRY_UNIT_BENCHMARK(ClassName)                                                                                                                                         \
+  class ClassName : public CryUnitTest::SBenchmark                                                                                                                            \
+  {                                                                                                                                                                           \
+    virtual void Run();                                                                                                                                                       \
+  };                                                                                                                                                                          \
+  ClassName auto_unitbenchmark_instance_ ## ClassName;                                                                                                                        \
+  CryUnitTest::SBenchmarkRegistrar autoreg_unitbenchmark_ ## ClassName(auto_unitbenchmark_instance_ ## ClassName, CryUnitTestSuite::GetSuiteName(), # ClassName, __FILE__, __LINE__); \
+  void ClassName::Run()
+
+//! Specifies a new benchmark with a fixture as the base class, the fixture must derive from CryUnitTest::SBenchmark.
+#define CRY_UNIT_BENCHMARK_WITH_FIXTURE(ClassName, FixtureName)                                                                                                               \
+  class ClassName : public FixtureName                                                                                                                                        \
+  {                                                                                                                                                                           \
+    virtual void Run();                                                                                                                                                       \
+  };                                                                                                                                                                          \
+  ClassName auto_unitbenchmark_instance_ ## ClassName;                                                                                                                        \
+  CryUnitTest::SBenchmarkRegistrar autoreg_unitbenchmark_ ## ClassName(auto_unitbenchmark_instance_ ## ClassName, CryUnitTestSuite::GetSuiteName(), # ClassName, __FILE__, __LINE__); \
+  void ClassName::Run()
+
+//! Keeps the compiler from optimizing away a value computed in a benchmark.
+#define CRY_UNIT_BENCHMARK_KEEP(value) CryUnitTestImpl::KeepValue(value)
+
 //! Specifies a suite name to group tests locally together.
 #define CRY_UNIT_TEST_SUITE(SuiteName)                      \
   namespace SuiteName {                                     \
@@ -234,6 +234,10 @@ struct IConsole
 	//! \see ICVar.
 	virtual ICVar* GetCVar(const char* name) = 0;
 
+	//! Incremented whenever a variable is unregistered, lets cached ICVar pointers notice that they may be stale.
+	//! \see CVarHandle.
+	virtual uint32 GetUnregisterCount() const = 0;
+
 	//! Read a value from a configuration file (.ini) and return the value.
 	//! \param szVarName Variable name.
 	//! \param szFileName Source configuration file.
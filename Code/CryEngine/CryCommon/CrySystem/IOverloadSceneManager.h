@@ -13,6 +13,30 @@
 
 #pragma once
 
+//! Frame budgets the overload scene manager tracks separately.
+enum EOverloadBudget
+{
+	eOverloadBudget_MainThread   = BIT(0),
+	eOverloadBudget_RenderThread = BIT(1),
+	eOverloadBudget_Workers      = BIT(2),
+	eOverloadBudget_GPU          = BIT(3),
+};
+
+//! Subsystem quality control driven by the overload scene manager.
+//! Hooks are lowered one step at a time while a budget they are registered for is exceeded, in registration order,
+//! and raised again in reverse order once all their budgets have headroom.
+struct IOverloadScalabilityHook
+{
+	// <interfuscator:shuffle>
+	virtual ~IOverloadScalabilityHook() {}
+
+	virtual const char* GetName() const = 0;
+
+	//! \param level 1.0 = full quality, down to the minimum level given on registration.
+	virtual void SetQualityLevel(float level) = 0;
+	// </interfuscator:shuffle>
+};
+
 //! Manages overload values (eg CPU,GPU etc).
 //! 1.0="everything is ok"  0.0="very bad frame rate".
 //! Various systems can use this information and control what is currently in the scene.
@@ -32,5 +56,12 @@ public:
 
 	//! Go back to auto-calculated scale from an overridden scale.
 	virtual void ResetScale(float dt) = 0;
+
+	//! Register a hook that is scaled down when any of the budgets in budgetMask (EOverloadBudget) is exceeded.
+	//! \param minLevel Lowest quality level the hook will be set to.
+	virtual void RegisterScalabilityHook(IOverloadScalabilityHook* pHook, uint32 budgetMask, float minLevel) = 0;
+
+	//! Unregister a hook, it is restored to full quality first.
+	virtual void UnregisterScalabilityHook(IOverloadScalabilityHook* pHook) = 0;
 	// </interfuscator:shuffle>
 };
@@ -106,6 +106,8 @@ struct SStreamEngineStatistics
 
 		uint32 nActualReadBandwidth;        //!< Bytes/second for last second - only taking actual reading into account.
 		uint32 nAverageActualReadBandwidth; //!< Average read bandwidth in total from reset - only taking actual read time into account.
+
+		float  fQueueDepthLastSecond;       //!< Average number of reads in flight during last second.
 	};
 
 	SMediaTypeInfo hddInfo;
@@ -1917,6 +1917,62 @@ struct ConsoleRegistrationHelper
 #undef MODULE_REGISTER_COMMAND
 #undef MODULE_REGISTER_CVAR
 
+//! Looks a console variable up once and reads it through the cached ICVar pointer afterwards,
+//! instead of a GetCVar() name lookup on every read. Usable before the variable is registered,
+//! it is looked up again until it exists, and after any variable was unregistered.
+//! Example: static CVarHandle<float> s_targetFPS("r_displayinfoTargetFPS"); float fps = s_targetFPS.Get(30.0f);
+template<typename T>
+class CVarHandle
+{
+public:
+	explicit CVarHandle(const char* szName)
+		: m_szName(szName)
+		, m_pCVar(nullptr)
+		, m_nUnregisterCount(0)
+	{
+	}
+
+	//! \return NULL if the variable isn't registered.
+	ICVar* GetCVar() const
+	{
+		IConsole* const pConsole = gEnv ? gEnv->pConsole : nullptr;
+		if (!pConsole)
+			return nullptr;
+
+		const uint32 nUnregisterCount = pConsole->GetUnregisterCount();
+		ICVar* pCVar = m_pCVar;
+		if (!pCVar || m_nUnregisterCount != nUnregisterCount)
+		{
+			pCVar = pConsole->GetCVar(m_szName);
+			m_pCVar = pCVar;
+			m_nUnregisterCount = nUnregisterCount;
+		}
+		return pCVar;
+	}
+
+	T Get(T defaultValue = T()) const
+	{
+		ICVar* const pCVar = GetCVar();
+		return pCVar ? Read(pCVar, defaultValue) : defaultValue;
+	}
+
+	void Set(T value) const
+	{
+		if (ICVar* const pCVar = GetCVar())
+			pCVar->Set(value);
+	}
+
+private:
+	static int         Read(ICVar* pCVar, int)         { return pCVar->GetIVal(); }
+	static int64       Read(ICVar* pCVar, int64)       { return pCVar->GetI64Val(); }
+	static float       Read(ICVar* pCVar, float)       { return pCVar->GetFVal(); }
+	static const char* Read(ICVar* pCVar, const char*) { return pCVar->GetString(); }
+
+	const char*             m_szName;
+	mutable ICVar* volatile m_pCVar;
+	mutable volatile uint32 m_nUnregisterCount;
+};
+
 #if defined(_RELEASE) && !CRY_PLATFORM_DESKTOP
 	#ifndef LOG_CONST_CVAR_ACCESS
 		#error LOG_CONST_CVAR_ACCESS should be defined in ProjectDefines.h
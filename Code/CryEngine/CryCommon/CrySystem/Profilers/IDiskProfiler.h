@@ -140,6 +140,7 @@ protected:
 #define PROFILE_DISK_WRITE      PROFILE_DISK(edotWrite, 0, 0)
 #define PROFILE_DISK_COMPRESS   PROFILE_DISK(edotCompress, 0, 0)
 #define PROFILE_DISK_OPEN       PROFILE_DISK(edotOpen, 0, 0)
+#define PROFILE_DISK_OPEN_WITHNAME(name) PROFILE_DISK(edotOpen, 0, name)
 #define PROFILE_DISK_CLOSE      PROFILE_DISK(edotClose, 0, 0)
 
 #endif // __diskprofile_h__
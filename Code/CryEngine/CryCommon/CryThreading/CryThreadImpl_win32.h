@@ -369,6 +369,21 @@ void CryFastSemaphore::Release()
 		m_Semaphore.Release();
 }
 
+//////////////////////////////////////////////////////////////////////////
+bool CryFastSemaphore::TryAcquire()
+{
+	int nCount = ~0;
+	do
+	{
+		nCount = *const_cast<volatile int*>(&m_nCounter);
+		if (nCount <= 0)
+			return false;
+	}
+	while (CryInterlockedCompareExchange(alias_cast<volatile LONG*>(&m_nCounter), nCount - 1, nCount) != nCount);
+
+	return true;
+}
+
 //////////////////////////////////////////////////////////////////////////
 void CryRWLock::RLock()
 {
@@ -288,6 +288,8 @@ public:
 	~CryFastSemaphore();
 	void Acquire();
 	void Release();
+	//! Takes one count without blocking, returns false if none is available.
+	bool TryAcquire();
 
 private:
 	CrySemaphore   m_Semaphore;
@@ -337,6 +339,21 @@ inline void CryFastSemaphore::Release()
 		m_Semaphore.Release();
 }
 
+//////////////////////////////////////////////////////////////////////////
+inline bool CryFastSemaphore::TryAcquire()
+{
+	int nCount = ~0;
+	do
+	{
+		nCount = *const_cast<volatile int*>(&m_nCounter);
+		if (nCount <= 0)
+			return false;
+	}
+	while (CryInterlockedCompareExchange(alias_cast<volatile LONG*>(&m_nCounter), nCount - 1, nCount) != nCount);
+
+	return true;
+}
+
 //////////////////////////////////////////////////////////////////////////
 class CryRWLock
 {
@@ -273,6 +273,8 @@ public:
 	~CryFastSemaphore();
 	void Acquire();
 	void Release();
+	//! Takes one count without blocking, returns false if none is available.
+	bool TryAcquire();
 
 private:
 	CrySemaphore   m_Semaphore;
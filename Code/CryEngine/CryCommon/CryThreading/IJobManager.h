@@ -235,6 +235,7 @@ struct CRY_ALIGN(16) SJobProfilingData
 	TJobHandle jobHandle;
 	threadID nThreadId;
 	uint32 nWorkerThread;
+	uint16 nParentProfilerIndex;    //!< Profiler index of the job which added this job, ~0 if it was added outside of a job.
 
 };
 
@@ -375,6 +376,7 @@ public:
 		float  nUtilPerc;             //!< Utilization percentage this frame [0.f..100.f].
 		uint32 nExecutionPeriod;      //!< Total execution time on this worker in usec.
 		uint32 nNumJobsExecuted;      //!< Number of jobs executed contributing to nExecutionPeriod.
+		uint8  nClusterId;            //!< Cache cluster or NUMA node the worker is placed on, 0 if not placed.
 	};
 
 public:
@@ -397,6 +399,7 @@ public:
 			workerStats[i].nUtilPerc = 0.f;
 			workerStats[i].nExecutionPeriod = 0;
 			workerStats[i].nNumJobsExecuted = 0;
+			workerStats[i].nClusterId = 0;
 		}
 
 		nSamplePeriod = 0;
@@ -1005,6 +1008,15 @@ struct IJobManager
 
 	virtual void                           DumpJobList() = 0;
 
+	//! Writes the job profiling data of the next nFrames frames as a Chrome trace event file (chrome://tracing, ui.perfetto.dev).
+	virtual void                           StartTraceCapture(uint32 nFrames, const char* szFileName) = 0;
+
+	//! True while a trace capture started with StartTraceCapture is recording.
+	virtual bool                           IsTraceCaptureRunning() const = 0;
+
+	//! Adds an externally measured interval, e.g. renderer GPU timings, to the running trace capture on the named track.
+	virtual void                           AddTraceEvent(const char* szTrack, const char* szName, const char* szCategory, const CTimeValue& startTime, const CTimeValue& endTime) = 0;
+
 	virtual void                           SetFrameStartTime(const CTimeValue& rFrameStartTime) = 0;
 };
 
@@ -1210,6 +1222,10 @@ public:
 	//! Get the number of workers tracked.
 	virtual uint32 GetNumWorkers() const = 0;
 
+	//! Cache cluster or NUMA node a worker is placed on, used to group the worker stats.
+	virtual void  SetWorkerClusterId(const uint8 workerId, const uint8 clusterId) = 0;
+	virtual uint8 GetWorkerClusterId(const uint8 workerId) const = 0;
+
 public:
 	//! Returns a microsecond sample.
 	static uint32 GetTimeSample()
@@ -1411,6 +1427,7 @@ inline void JobManager::CProdConsQueue<TJobType, Size >::AddPacket
 #if defined(JOBMANAGER_SUPPORT_PROFILING)
 	SJobProfilingData* pJobProfilingData = gEnv->GetJobManager()->GetProfilingData(crPacket.GetProfilerIndex());
 	pJobProfilingData->jobHandle = pJobParam->GetJobProgramData();
+	pJobProfilingData->nParentProfilerIndex = (uint16)~0;
 	pAddPacketData->profilerIndex = crPacket.GetProfilerIndex();
 	if (pAddPacketData->pJobState) // also store profilerindex in syncvar, so be able to record wait times
 	{
@@ -11,6 +11,15 @@ struct SThreadConfig
 		eThreadParamFlag_Affinity      = BIT(2),
 		eThreadParamFlag_Priority      = BIT(3),
 		eThreadParamFlag_PriorityBoost = BIT(4),
+		eThreadParamFlag_AffinityGroup = BIT(5),
+	};
+
+	//! CPU topology group a thread pool is distributed over, each thread is pinned to all logical cores of its group.
+	enum EAffinityGroup
+	{
+		eAffinityGroup_None = 0,      //!< Use the plain Affinity mask.
+		eAffinityGroup_CacheCluster,  //!< Logical cores sharing the same last level (L3) cache.
+		eAffinityGroup_NumaNode,      //!< Logical cores of the same NUMA node / socket.
 	};
 
 	typedef uint32 TThreadParamFlag;
@@ -20,6 +29,7 @@ struct SThreadConfig
 	uint32           affinityFlag;
 	int32            priority;
 	bool             bDisablePriorityBoost;
+	uint8            affinityGroup; //!< EAffinityGroup, only evaluated by thread pools which know their thread index (e.g. the job system).
 
 	TThreadParamFlag paramActivityFlag;
 };
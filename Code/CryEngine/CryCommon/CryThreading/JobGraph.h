@@ -0,0 +1,241 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+// -------------------------------------------------------------------------
+//  File name:   JobGraph.h
+//  Version:     v1.00
+//  Description: Job graph with predecessor edges and continuations,
+//               built on top of IJobManager::AddLambdaJob
+// -------------------------------------------------------------------------
+//  History:
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <CryThreading/IJobManager.h>
+#include <CryThreading/CryAtomics.h>
+#include <CryCore/Containers/CryArray.h>
+
+namespace JobManager
+{
+
+//! Graph of lambda jobs connected by predecessor edges.
+//! A job is added to the job manager as soon as all of its predecessors finished, so no thread has to block in between.
+//! An optional continuation is run as a job once every job of the graph finished.
+//! Usage:
+//!   graph.Reset();
+//!   TNodeId cull = graph.AddJob("Cull", ...);
+//!   TNodeId sort = graph.AddJob("Sort", ...);
+//!   graph.AddDependency(cull, sort);
+//!   graph.SetContinuation("Submit", ...);
+//!   graph.Run(&frameState);
+//! The graph must not be modified or destroyed while it is running.
+class CJobGraph
+{
+public:
+	typedef uint32 TNodeId;
+	static const TNodeId InvalidNodeId = ~0u;
+
+	CJobGraph()
+		: m_nPendingNodes(0)
+		, m_pExternalState(nullptr)
+		, m_continuationName(nullptr)
+		, m_continuationPriority(eRegularPriority)
+	{
+	}
+
+	~CJobGraph()
+	{
+		CRY_ASSERT_MESSAGE(!IsRunning(), "CJobGraph destroyed while jobs are still in flight");
+	}
+
+	//! Removes all jobs, edges and the continuation so the graph can be rebuilt (e.g. once per frame).
+	void Reset()
+	{
+		CRY_ASSERT(!IsRunning());
+		m_nodes.clear();
+		m_continuation = nullptr;
+		m_continuationName = nullptr;
+		m_pExternalState = nullptr;
+	}
+
+	//! Adds a job without any dependencies, its id is used to declare edges.
+	TNodeId AddJob(const char* szJobName, const std::function<void()>& job, TPriorityLevel priority = eRegularPriority)
+	{
+		CRY_ASSERT(!IsRunning());
+		m_nodes.emplace_back();
+		SNode& node = m_nodes.back();
+		node.szName = szJobName;
+		node.job = job;
+		node.priority = priority;
+		return static_cast<TNodeId>(m_nodes.size() - 1);
+	}
+
+	//! The successor is not started before the predecessor finished.
+	void AddDependency(TNodeId predecessor, TNodeId successor)
+	{
+		CRY_ASSERT(!IsRunning());
+		CRY_ASSERT(predecessor < m_nodes.size() && successor < m_nodes.size() && predecessor != successor);
+		m_nodes[predecessor].successors.push_back(successor);
+		++m_nodes[successor].nNumPredecessors;
+	}
+
+	//! Job which is started after all jobs of the graph finished.
+	void SetContinuation(const char* szJobName, const std::function<void()>& continuation, TPriorityLevel priority = eRegularPriority)
+	{
+		CRY_ASSERT(!IsRunning());
+		m_continuationName = szJobName;
+		m_continuation = continuation;
+		m_continuationPriority = priority;
+	}
+
+	//! Starts all jobs without predecessors. pGraphState (optional) is set to running and stopped after the continuation finished,
+	//! it allows legacy code to keep a single WaitForJob on the whole graph.
+	void Run(SJobState* pGraphState = nullptr)
+	{
+		CRY_ASSERT(!IsRunning());
+		CRY_ASSERT_MESSAGE(IsAcyclic(), "CJobGraph contains a cycle, it would never finish");
+
+		m_pExternalState = pGraphState;
+		m_state.SetRunning();
+		if (m_pExternalState)
+			m_pExternalState->SetRunning();
+
+		if (m_nodes.empty())
+		{
+			OnAllNodesFinished();
+			return;
+		}
+
+		for (SNode& node : m_nodes)
+			node.nPendingPredecessors = node.nNumPredecessors;
+		m_nPendingNodes = static_cast<int>(m_nodes.size());
+		MemoryBarrier();
+
+		// collect the roots first, a fast root could finish and start a successor while we are still iterating
+		LocalDynArray<TNodeId, 64> roots;
+		for (size_t i = 0, numNodes = m_nodes.size(); i < numNodes; ++i)
+		{
+			if (m_nodes[i].nNumPredecessors == 0)
+				roots.push_back(static_cast<TNodeId>(i));
+		}
+
+		for (TNodeId root : roots)
+			StartNode(root);
+	}
+
+	//! True until the continuation (or the last job if there is none) finished.
+	bool IsRunning() const
+	{
+		return m_state.IsRunning();
+	}
+
+	//! Blocks until the graph finished, only meant for sync points which can't be expressed as continuation yet.
+	void Wait()
+	{
+		if (IsRunning())
+			gEnv->GetJobManager()->WaitForJob(m_state);
+	}
+
+	size_t GetNumJobs() const { return m_nodes.size(); }
+
+private:
+	struct SNode
+	{
+		SNode() : szName(nullptr), priority(eRegularPriority), nNumPredecessors(0), nPendingPredecessors(0) {}
+
+		const char*           szName;
+		std::function<void()> job;
+		TPriorityLevel        priority;
+		std::vector<TNodeId>  successors;
+		int                   nNumPredecessors;
+		volatile int          nPendingPredecessors;
+	};
+
+	void StartNode(TNodeId nodeId)
+	{
+		SNode& node = m_nodes[nodeId];
+		gEnv->GetJobManager()->AddLambdaJob(node.szName, [this, nodeId]()
+		{
+			m_nodes[nodeId].job();
+			OnNodeFinished(nodeId);
+		}, node.priority);
+	}
+
+	void OnNodeFinished(TNodeId nodeId)
+	{
+		// start each successor from the job which resolved its last dependency
+		const SNode& node = m_nodes[nodeId];
+		for (TNodeId successor : node.successors)
+		{
+			if (CryInterlockedDecrement(&m_nodes[successor].nPendingPredecessors) == 0)
+				StartNode(successor);
+		}
+
+		if (CryInterlockedDecrement(&m_nPendingNodes) == 0)
+			OnAllNodesFinished();
+	}
+
+	void OnAllNodesFinished()
+	{
+		if (m_continuation)
+		{
+			gEnv->GetJobManager()->AddLambdaJob(m_continuationName ? m_continuationName : "JobGraph_Continuation", [this]()
+			{
+				m_continuation();
+				Finish();
+			}, m_continuationPriority);
+		}
+		else
+		{
+			Finish();
+		}
+	}
+
+	void Finish()
+	{
+		// the external state is stopped last: whoever waits on it may destroy or rebuild the graph right away
+		SJobState* pExternalState = m_pExternalState;
+		m_state.SetStopped();
+		if (pExternalState)
+			pExternalState->SetStopped();
+	}
+
+	bool IsAcyclic() const
+	{
+		// Kahn's algorithm, only used for validation
+		std::vector<int> numPredecessors(m_nodes.size());
+		std::vector<TNodeId> ready;
+		for (size_t i = 0; i < m_nodes.size(); ++i)
+		{
+			numPredecessors[i] = m_nodes[i].nNumPredecessors;
+			if (numPredecessors[i] == 0)
+				ready.push_back(static_cast<TNodeId>(i));
+		}
+
+		size_t numVisited = 0;
+		while (!ready.empty())
+		{
+			const TNodeId nodeId = ready.back();
+			ready.pop_back();
+			++numVisited;
+			for (TNodeId successor : m_nodes[nodeId].successors)
+			{
+				if (--numPredecessors[successor] == 0)
+					ready.push_back(successor);
+			}
+		}
+		return numVisited == m_nodes.size();
+	}
+
+	std::vector<SNode>    m_nodes;
+	volatile int          m_nPendingNodes;
+	SJobState             m_state;
+	SJobState*            m_pExternalState;
+
+	const char*           m_continuationName;
+	std::function<void()> m_continuation;
+	TPriorityLevel        m_continuationPriority;
+};
+
+} // namespace JobManager
@@ -18,8 +18,11 @@ DRS::IResponseActor* CConditionsCollection::s_pActorForEvaluation = nullptr;
 //--------------------------------------------------------------------------------------------------
 bool CConditionsCollection::IsMet(CResponseInstance* pResponseInstance)
 {
-	for (SConditionInfo& current : m_conditions)
+	CRY_ASSERT(m_evaluationOrder.size() == m_conditions.size());
+
+	for (const uint32 conditionIndex : m_evaluationOrder)
 	{
+		SConditionInfo& current = m_conditions[conditionIndex];
 		CRY_ASSERT(current.m_pCondition);
 
 		if (!current.m_bNegated)
@@ -59,7 +62,53 @@ void CConditionsCollection::AddCondition(DRS::IConditionSharedPtr pCondition, bo
 		newCondition.m_bNegated = Negated;
 		newCondition.m_pCondition = pCondition;
 		m_conditions.push_back(newCondition);
+		UpdateEvaluationOrder();
+	}
+}
+
+//--------------------------------------------------------------------------------------------------
+namespace
+{
+//rough relative cost of a condition, all conditions of a collection need to be met, so the cheap ones are checked first to bail out early
+int GetConditionEvaluationCost(const DRS::IResponseCondition* pCondition)
+{
+	const char* szType = pCondition->GetType();
+
+	//no lookup at all, and random/execution limits are usually the most selective ones
+	if (!strcmp(szType, "Random") || !strcmp(szType, "Execution Limit") || !strcmp(szType, "Placeholder"))
+	{
+		return 0;
+	}
+	//a single variable lookup
+	if (!strcmp(szType, "LessCheck") || !strcmp(szType, "GreaterCheck") || !strcmp(szType, "EqualCheck") || !strcmp(szType, "InRangeCheck")
+	    || !strcmp(szType, "TimeSince") || !strcmp(szType, "TimeSinceResponse"))
+	{
+		return 1;
+	}
+	//evaluates the conditions of other responses
+	if (!strcmp(szType, "Inherit Conditions"))
+	{
+		return 3;
+	}
+	//variable to variable checks, game tokens and game specific conditions
+	return 2;
+}
+}
+
+//--------------------------------------------------------------------------------------------------
+void CConditionsCollection::UpdateEvaluationOrder()
+{
+	const uint32 numConditions = (uint32)m_conditions.size();
+	m_evaluationOrder.resize(numConditions);
+	for (uint32 i = 0; i < numConditions; ++i)
+	{
+		m_evaluationOrder[i] = i;
 	}
+
+	std::stable_sort(m_evaluationOrder.begin(), m_evaluationOrder.end(), [this](uint32 lhs, uint32 rhs)
+	{
+		return GetConditionEvaluationCost(m_conditions[lhs].m_pCondition.get()) < GetConditionEvaluationCost(m_conditions[rhs].m_pCondition.get());
+	});
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -102,6 +151,10 @@ void CConditionsCollection::Serialize(Serialization::IArchive& ar)
 	if (ar.openBlock("Conditions", "Conditions"))
 	{
 		ar(m_conditions, "Conditions", "^+");
+		if (ar.isInput())
+		{
+			UpdateEvaluationOrder();
+		}
 		if (m_conditions.empty())
 		{
 			ar(m_bNegated, "Negated", "");
@@ -27,8 +27,8 @@ public:
 
 	~CConditionsCollection();
 	CConditionsCollection() : m_bNegated(false) {}
-	CConditionsCollection(CConditionsCollection&& other) : m_conditions(std::move(other.m_conditions)), m_bNegated(other.m_bNegated) {}
-	CConditionsCollection&   operator=(CConditionsCollection&& other) { m_conditions = std::move(other.m_conditions); m_bNegated = other.m_bNegated; return *this; }
+	CConditionsCollection(CConditionsCollection&& other) : m_conditions(std::move(other.m_conditions)), m_evaluationOrder(std::move(other.m_evaluationOrder)), m_bNegated(other.m_bNegated) {}
+	CConditionsCollection&   operator=(CConditionsCollection&& other) { m_conditions = std::move(other.m_conditions); m_evaluationOrder = std::move(other.m_evaluationOrder); m_bNegated = other.m_bNegated; return *this; }
 	void                     SetNegated(bool value)                   { m_bNegated = value; } //negates the whole collection.
 	bool                     IsNegated()                              { return m_bNegated; }
 	void                     AddCondition(DRS::IConditionSharedPtr pCondition, bool Negated);
@@ -39,9 +39,12 @@ public:
 	bool                     IsConditionNegated(int index) { CRY_ASSERT(index < m_conditions.size());  return m_conditions[index].m_bNegated; }
 
 private:
+	void UpdateEvaluationOrder();
+
 	typedef std::vector<SConditionInfo> ConditionsList;
-	ConditionsList m_conditions;
-	bool           m_bNegated;
+	ConditionsList      m_conditions;
+	std::vector<uint32> m_evaluationOrder; //indices into m_conditions, cheapest and most selective conditions first. m_conditions itself keeps the authored order
+	bool                m_bNegated;
 };
 
 } // namespace CryDRS
@@ -233,7 +233,11 @@ void CResponseManager::Update()
 
 			if (mappedResponse != m_mappedSignals.end())
 			{
+#if defined(DRS_COLLECT_DEBUG_DATA)
+				const CTimeValue startTime = gEnv->pTimer->GetAsyncTime();
+#endif
 				CResponseInstance* pResponseInstance = mappedResponse->second->StartExecution(currentSignal);
+				DRS_DEBUG_DATA_ACTION(AddSignalProcessingTime((gEnv->pTimer->GetAsyncTime() - startTime).GetMilliSeconds()));
 				InformListenerAboutSignalProcessingStarted(currentSignal, pResponseInstance);
 				if (!pResponseInstance) //no instance = conditions not met, we are done
 				{
@@ -140,6 +140,15 @@ void CResponseSystemDebugDataProvider::AddResponseStarted(const string& signalNa
 	}
 }
 
+//--------------------------------------------------------------------------------------------------
+void CResponseSystemDebugDataProvider::AddSignalProcessingTime(float timeMs)
+{
+	if (m_currentResponse < m_executedResponses.size())
+	{
+		m_executedResponses[m_currentResponse].processingTimeMs += timeMs;
+	}
+}
+
 //--------------------------------------------------------------------------------------------------
 bool CResponseSystemDebugDataProvider::AddResponseSegmentEvaluated(CResponseSegment* pResponseSegment)
 {
@@ -369,6 +378,7 @@ void CResponseSystemDebugDataProvider::SStartedResponses::Serialize(Serializatio
 		ar(senderName, "sender", "^^>200> Actor:");
 		ar(contextVariables, "ContextVariables", "^^ ContextVariables");
 		ar(drsUserName, "source", "Source:");
+		ar(processingTimeMs, "processingTime", "Processing time (ms):");
 		ar.closeBlock();
 	}
 
@@ -557,6 +567,7 @@ void CResponseSystemDebugDataProvider::AddSignalFired(const string& signalName,
 	newResponse.id = static_cast<ResponseInstanceID>(m_executedResponses.size());
 	newResponse.currentlevelInHierarchy = 0;
 	newResponse.timeOfEvent = CResponseSystem::GetInstance()->GetCurrentDrsTime();
+	newResponse.processingTimeMs = 0.0f;
 
 	m_executedResponses.push_back(newResponse);
 
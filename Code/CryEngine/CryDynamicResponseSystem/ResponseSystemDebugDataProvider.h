@@ -56,6 +56,7 @@ public:
 	void SetCurrentResponseInstance(CResponseInstance* pInstanceForCurrentID);    // tells the debugDataProvider which Response is the active one for all the add-x- methods
 	void AddSignalFired(const string& signalName, const string& senderName, const string& contextVariables);
 	void AddResponseStarted(const string& signalName);
+	void AddSignalProcessingTime(float timeMs);     // time spent on matching the current response and evaluating its conditions
 	bool IncrementSegmentHierarchyLevel();
 	bool AddResponseSegmentEvaluated(CResponseSegment* pResponseSegment);
 	bool AddResponseSegmentStarted(CResponseSegment* pResponseSegment);
@@ -116,6 +117,7 @@ private:
 		EStatus                               currentState;
 		int                                   currentlevelInHierarchy;
 		float                                 timeOfEvent;
+		float                                 processingTimeMs;
 		std::vector<SStartedResponsesSegment> responseSegments;
 		SStartedResponsesSegment*             currentSegment;
 
@@ -4,6 +4,7 @@
 #include "AreaGrid.h"
 #include "Area.h"
 #include <CryRenderer/IRenderAuxGeom.h>
+#include <CryCore/BitFiddling.h>
 
 static constexpr int GridCellSize = 4;
 static constexpr float GridCellSizeR = 1.0f / GridCellSize;
@@ -33,16 +34,19 @@ bool CAreaGrid::GetAreas(uint32 const x, uint32 const y, TAreaPointers& outAreas
 	uint32 const* const pBitsLHS = m_pbitFieldX + (m_bitFieldSizeU32 * x);
 	uint32 const* const pBitsRHS = m_pbitFieldY + (m_bitFieldSizeU32 * y);
 
+	TAreaPointers const& areas = *m_pAreas;
+
 	for (uint32 i = 0, offset = 0; i < m_bitFieldSizeU32; ++i, offset += 32)
 	{
 		uint32 currentBitField = pBitsLHS[i] & pBitsRHS[i];
 
-		for (uint32 j = 0; currentBitField != 0; ++j, currentBitField >>= 1)
+		// Jump straight to the set bits, most words of a cell are sparse.
+		while (currentBitField != 0)
 		{
-			if (currentBitField & 1)
-			{
-				outAreas.push_back(m_pAreas->at(offset + j));
-			}
+			uint32 const j = countTrailingZeros32(currentBitField);
+			CRY_ASSERT(offset + j < areas.size());
+			outAreas.push_back(areas[offset + j]);
+			currentBitField &= currentBitField - 1;
 		}
 	}
 
@@ -92,6 +92,10 @@ public:
 	// Called by EntitySystem before entity is destroyed.
 	void ShutDown();
 
+	// Custom new/delete, entities are allocated from a pool owned by the entity system.
+	void* operator new(size_t nSize);
+	void  operator delete(void* ptr);
+
 	//////////////////////////////////////////////////////////////////////////
 	// IEntity interface implementation.
 	//////////////////////////////////////////////////////////////////////////
@@ -627,3 +631,20 @@ private:
 	int                              m_cloneLayerId;
 	uint32                           m_objectID;
 };
+
+//////////////////////////////////////////////////////////////////////////
+extern stl::PoolAllocatorNoMT<sizeof(CEntity), 16>* g_Alloc_Entity;
+
+//////////////////////////////////////////////////////////////////////////
+inline void* CEntity::operator new(size_t nSize)
+{
+	static_assert(alignof(CEntity) <= 16, "Entity pool alignment is too small for CEntity");
+	return g_Alloc_Entity->Allocate();
+}
+
+//////////////////////////////////////////////////////////////////////////
+inline void CEntity::operator delete(void* ptr)
+{
+	if (ptr)
+		g_Alloc_Entity->Deallocate(ptr);
+}
@@ -175,6 +175,7 @@ void CVar::Init()
 	                              "Default is 0 (off). Set to 1 to display entity helpers.");
 	pProfileEntities = REGISTER_INT("es_profileentities", 0, VF_CHEAT,
 	                                "Usage: es_profileentities 1,2,3\n"
+	                                "Shows entity update times, including the accumulated time per entity class.\n"
 	                                "Default is 0 (off).");
 	/*	pUpdateInvisibleCharacter = REGISTER_INT("es_UpdateInvisibleCharacter",0,VF_CHEAT,
 	    "Usage: \n"
@@ -49,10 +49,12 @@ bool CEntityLoadManager::LoadEntities(XmlNodeRef& entitiesNode, bool bIsLoadingL
 	if (entitiesNode && ReserveEntityIds(entitiesNode))
 	{
 		PrepareBatchCreation(entitiesNode->getChildCount());
+		gEnv->p3DEngine->BeginBulkRegistration();
 
 		bResult = ParseEntities(entitiesNode, bIsLoadingLevelFile, segmentOffset, outGlobalEntityIds, outLocalEntityIds);
 
 		OnBatchCreationCompleted();
+		gEnv->p3DEngine->EndBulkRegistration();
 	}
 
 	return bResult;
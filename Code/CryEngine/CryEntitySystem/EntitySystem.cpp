@@ -64,6 +64,7 @@
 #pragma warning(disable: 6255)  // _alloca indicates failure by raising a stack overflow exception. Consider using _malloca instead. (Note: _malloca requires _freea.)
 
 stl::PoolAllocatorNoMT<sizeof(CEntitySlot), 16>* g_Alloc_EntitySlot = 0;
+stl::PoolAllocatorNoMT<sizeof(CEntity), 16>* g_Alloc_Entity = 0;
 
 namespace
 {
@@ -189,6 +190,7 @@ CEntitySystem::CEntitySystem(ISystem* pSystem)
 {
 	// Assign allocators.
 	g_Alloc_EntitySlot = new stl::PoolAllocatorNoMT<sizeof(CEntitySlot), 16>(stl::FHeap().FreeWhenEmpty(true));
+	g_Alloc_Entity = new stl::PoolAllocatorNoMT<sizeof(CEntity), 16>(stl::FHeap().FreeWhenEmpty(true));
 
 	m_onEventSinks.reserve(5);
 	for (size_t i = 0; i < SinkMaxEventSubscriptionCount; ++i)
@@ -264,6 +266,7 @@ CEntitySystem::~CEntitySystem()
 	SAFE_DELETE(m_pBreakableManager);
 
 	SAFE_DELETE(g_Alloc_EntitySlot);
+	SAFE_DELETE(g_Alloc_Entity);
 	//ShutDown();
 }
 
@@ -1572,6 +1575,8 @@ void CEntitySystem::DoUpdateLoop(float fFrameTime)
 
 		int nCounter = 0;
 
+		m_classUpdateStats.clear();
+
 		auto entityUpdateLambda = [this, &ctx, &xpos, &ypos, &nCounter, bProfileEntitiesToLog, bProfileEntitiesDesigner](EntityId eid)
 		{
 			CEntity* ce = GetEntityFromID(eid);
@@ -1592,6 +1597,19 @@ void CEntitySystem::DoUpdateLoop(float fFrameTime)
 						time = 0;
 
 					float timeMs = time * 1000.0f;
+
+					const IEntityClass* pClass = ce->GetClass();
+					auto itStats = std::find_if(m_classUpdateStats.begin(), m_classUpdateStats.end(), [pClass](const SClassUpdateStats& stats) { return stats.pClass == pClass; });
+					if (itStats == m_classUpdateStats.end())
+					{
+						m_classUpdateStats.push_back({ pClass, timeMs, 1 });
+					}
+					else
+					{
+						itStats->timeMs += timeMs;
+						++itStats->numEntities;
+					}
+
 					if (bProfileEntitiesToLog || bProfileEntitiesDesigner)
 					{
 						bool bAIEnabled = false;
@@ -1673,6 +1691,8 @@ void CEntitySystem::DoUpdateLoop(float fFrameTime)
 
 		//ctx.numUpdatedEntities = (int)m_mapActiveEntities.size();
 
+		DebugDrawClassUpdateTimes(bProfileEntitiesToLog);
+
 		int numEnts = GetNumEntities();
 
 		if (bProfileEntitiesToLog)
@@ -1719,6 +1739,34 @@ void CEntitySystem::DoUpdateLoop(float fFrameTime)
 	}
 }
 
+//////////////////////////////////////////////////////////////////////////
+void CEntitySystem::DebugDrawClassUpdateTimes(bool bToLog)
+{
+	std::sort(m_classUpdateStats.begin(), m_classUpdateStats.end(), [](const SClassUpdateStats& a, const SClassUpdateStats& b) { return a.timeMs > b.timeMs; });
+
+	if (bToLog)
+	{
+		CryLogAlways("================= Entity Class Update Times =================");
+		for (const SClassUpdateStats& stats : m_classUpdateStats)
+		{
+			CryLogAlways("%.3f ms : %s (%d entities, %.3f ms avg)", stats.timeMs, stats.pClass ? stats.pClass->GetName() : "<no class>",
+			             stats.numEntities, stats.timeMs / (float)stats.numEntities);
+		}
+		return;
+	}
+
+	const size_t maxClassesToDraw = 16;
+	const float colors[4] = { 1, 1, 0.5f, 1 };
+	float ypos = 30;
+	const size_t numClasses = std::min(m_classUpdateStats.size(), maxClassesToDraw);
+	for (size_t i = 0; i < numClasses; ++i)
+	{
+		const SClassUpdateStats& stats = m_classUpdateStats[i];
+		IRenderAuxText::Draw2dLabel(500, ypos, 1.2f, colors, false, "%.3f ms : %s (%d)", stats.timeMs, stats.pClass ? stats.pClass->GetName() : "<no class>", stats.numEntities);
+		ypos += 12;
+	}
+}
+
 //////////////////////////////////////////////////////////////////////////
 void CEntitySystem::CheckInternalConsistency() const
 {
@@ -1789,6 +1837,8 @@ void CEntitySystem::GetMemoryStatistics(ICrySizer* pSizer) const
 		SIZER_COMPONENT_NAME(pSizer, "Entities");
 		pSizer->AddObject(m_EntityArray);
 		pSizer->AddContainer(m_deletedEntities);
+		pSizer->AddObject(g_Alloc_Entity);
+		pSizer->AddObject(g_Alloc_EntitySlot);
 
 	}
 
@@ -3325,6 +3375,9 @@ bool CEntitySystem::ExtractEntityLoadParams(XmlNodeRef& entityNode, SEntitySpawn
 void CEntitySystem::BeginCreateEntities(int nAmtToCreate)
 {
 	m_pEntityLoadManager->PrepareBatchCreation(nAmtToCreate);
+
+	if (gEnv->p3DEngine)
+		gEnv->p3DEngine->BeginBulkRegistration();
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -3337,6 +3390,10 @@ bool CEntitySystem::CreateEntity(XmlNodeRef& entityNode, SEntitySpawnParams& pPa
 void CEntitySystem::EndCreateEntities()
 {
 	m_pEntityLoadManager->OnBatchCreationCompleted();
+
+	// after the attachments are resolved so moved children are only inserted once
+	if (gEnv->p3DEngine)
+		gEnv->p3DEngine->EndBulkRegistration();
 }
 
 void CEntitySystem::PurgeDeferredCollisionEvents(bool bForce)
@@ -3371,6 +3428,14 @@ void CEntitySystem::DebugDrawProximityTriggers()
 	if (!pRenderAuxGeom)
 		return;
 
+	if (m_pProximityTriggerSystem)
+	{
+		const CProximityTriggerSystem::SStats& stats = m_pProximityTriggerSystem->GetStats();
+		const float colors[4] = { 1, 1, 1, 1 };
+		IRenderAuxText::Draw2dLabel(10, 30, 1.5f, colors, false, "Proximity triggers: %u, moved entities: %u, enter events: %u, leave events: %u",
+		                            stats.numTriggers, stats.numMovedEntities, stats.numEnterEvents, stats.numLeaveEvents);
+	}
+
 	IEntityItPtr it = GetEntityIterator();
 	while (IEntity* pEntity = it->Next())
 	{
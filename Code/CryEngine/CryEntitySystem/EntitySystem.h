@@ -427,6 +427,7 @@ private: // -----------------------------------------------------------------
 	void DebugDraw(CEntity* pEntity, float fUpdateTime);
 
 	void DebugDrawEntityUsage();
+	void DebugDrawClassUpdateTimes(bool bToLog);
 	void DebugDrawLayerInfo();
 	void DebugDrawProximityTriggers();
 
@@ -472,6 +473,16 @@ private: // -----------------------------------------------------------------
 
 	EntityNamesMap           m_mapEntityNames;         // Map entity name to entity ID.
 
+	// Accumulated update cost per entity class, filled while es_profileentities is on.
+	struct SClassUpdateStats
+	{
+		const IEntityClass* pClass;
+		float               timeMs;
+		int                 numEntities;
+	};
+	typedef std::vector<SClassUpdateStats> ClassUpdateStats;
+	ClassUpdateStats         m_classUpdateStats;
+
 	CSaltBufferArray<>       m_EntitySaltBuffer;            // used to create new entity ids (with uniqueid=salt)
 	//////////////////////////////////////////////////////////////////////////
 
@@ -122,6 +122,7 @@ CProximityTriggerSystem::CProximityTriggerSystem()
 	, m_pEntitySorter(new RadixSort)
 	, m_Sorted0(nullptr)
 	, m_Sorted1(nullptr)
+	, m_stats()
 {
 	assert(!g_pProximityElement_PoolAlloc);
 	g_pProximityElement_PoolAlloc = new ProximityElement_PoolAlloc;
@@ -297,6 +298,10 @@ void CProximityTriggerSystem::Update()
 {
 	FUNCTION_PROFILER(GetISystem(), PROFILE_ENTITY);
 
+	m_stats.numMovedEntities = (uint32)m_entities.size();
+	m_stats.numEnterEvents = 0;
+	m_stats.numLeaveEvents = 0;
+
 	if (m_bTriggerMoved)
 		SortTriggers();
 
@@ -382,6 +387,7 @@ void CProximityTriggerSystem::Update()
 	if (!m_events.empty())
 		SendEvents();
 
+	m_stats.numTriggers = (uint32)m_triggers.size();
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -418,12 +424,18 @@ void CProximityTriggerSystem::SendEvents()
 		EEntityEvent eventId = m_events[i].bEnter ? ENTITY_EVENT_ENTERAREA : ENTITY_EVENT_LEAVEAREA;
 		SendEvent(eventId, m_events[i].pTrigger->id, m_events[i].entity);
 	}
+	const uint32 numEnterEvents = (uint32)std::count_if(m_events.begin(), m_events.end(), [](const SProximityEvent& event) { return event.bEnter; });
+	m_stats.numEnterEvents += numEnterEvents;
+	m_stats.numLeaveEvents += (uint32)m_events.size() - numEnterEvents;
 	m_events.resize(0);
 }
 
 //////////////////////////////////////////////////////////////////////////
 void CProximityTriggerSystem::PurgeRemovedTriggers()
 {
+	std::sort(m_triggersToRemove.begin(), m_triggersToRemove.end());
+	m_triggersToRemove.erase(std::unique(m_triggersToRemove.begin(), m_triggersToRemove.end()), m_triggersToRemove.end());
+
 	for (int i = 0; i < (int)m_triggersToRemove.size(); i++)
 	{
 		SProximityElement* pTrigger = m_triggersToRemove[i];
@@ -433,11 +445,32 @@ void CProximityTriggerSystem::PurgeRemovedTriggers()
 			SProximityElement* pEntity = pTrigger->inside[j];
 			pEntity->RemoveInside(pTrigger);
 		}
+	}
+
+	// Compact the trigger list in a single pass, keeping the cached AABBs aligned with their triggers.
+	// Triggers created since the last sort have no cached AABB yet, they are always at the end of the list.
+	const size_t numCachedAABBs = std::min(m_triggersAABB.size(), m_triggers.size());
+	size_t numKept = 0;
+	size_t numKeptAABBs = 0;
+	for (size_t i = 0, num = m_triggers.size(); i < num; ++i)
+	{
+		SProximityElement* pTrigger = m_triggers[i];
+		if (std::binary_search(m_triggersToRemove.begin(), m_triggersToRemove.end(), pTrigger))
+			continue;
+
+		m_triggers[numKept++] = pTrigger;
+		if (i < numCachedAABBs)
+			m_triggersAABB[numKeptAABBs++] = m_triggersAABB[i];
+	}
+	m_triggers.resize(numKept);
+	m_triggersAABB.resize(numKeptAABBs);
 
-		stl::find_and_erase(m_triggers, pTrigger);
-		delete pTrigger;
-		m_bTriggerMoved = true;
+	for (int i = 0; i < (int)m_triggersToRemove.size(); i++)
+	{
+		delete m_triggersToRemove[i];
 	}
+
+	m_bTriggerMoved = true;
 	m_triggersToRemove.resize(0);
 }
 
@@ -72,6 +72,15 @@ struct SProximityEvent
 class CProximityTriggerSystem
 {
 public:
+	// Per frame counters, shown by es_DrawProximityTriggers.
+	struct SStats
+	{
+		uint32 numTriggers;
+		uint32 numMovedEntities;
+		uint32 numEnterEvents;
+		uint32 numLeaveEvents;
+	};
+
 	CProximityTriggerSystem();
 	~CProximityTriggerSystem();
 
@@ -87,6 +96,8 @@ public:
 	void               Reset();
 	void               BeginReset();
 
+	const SStats&      GetStats() const { return m_stats; }
+
 	void               GetMemoryUsage(ICrySizer* pSizer) const;
 
 private:
@@ -120,6 +131,8 @@ private:
 	const uint32*                   m_Sorted0;
 	const uint32*                   m_Sorted1;
 
+	SStats                          m_stats;
+
 public:
 	typedef stl::PoolAllocatorNoMT<sizeof(SProximityElement)> ProximityElement_PoolAlloc;
 	static ProximityElement_PoolAlloc* g_pProximityElement_PoolAlloc;
@@ -969,12 +969,13 @@ XmlNodeRef CFlowGraphBase::GetUserData(TFlowNodeId id)
 
 void CFlowGraphBase::Update()
 {
-	CRY_PROFILE_FUNCTION_ARG(PROFILE_ACTION, m_debugName);
-
 	// Disabled or Deactivated or Suspended flow graphs shouldn't be updated!
+	// Checked before the profile marker, most graphs are idle in any given frame.
 	if (m_bEnabled == false || m_bActive == false || m_bSuspended || m_bNeedsUpdating == false)
 		return;
 
+	CRY_PROFILE_FUNCTION_ARG(PROFILE_ACTION, m_debugName);
+
 	if (m_bNeedsInitialize)
 		InitializeValues();
 
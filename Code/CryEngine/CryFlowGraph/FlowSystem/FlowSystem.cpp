@@ -544,6 +544,9 @@ void CFlowSystem::Update()
 			return;
 		}
 
+		if (m_pGameTokenSystem)
+			m_pGameTokenSystem->FlushPendingNotifications();
+
 		if (m_bInspectingEnabled)
 		{
 			// call pre updates
@@ -609,9 +612,34 @@ void CFlowSystem::UpdateGraphs()
 			m_needToUpdateForwardings = false;
 		}
 
-		for (TGraphs::Notifier itGraph(m_graphs); itGraph.IsValid(); itGraph.Next())
+#ifndef _RELEASE
+		if (m_cVars.m_profile > 1)
+		{
+			m_graphCosts.clear();
+
+			for (TGraphs::Notifier itGraph(m_graphs); itGraph.IsValid(); itGraph.Next())
+			{
+				const int updatedBefore = FGProfile.graphsUpdated;
+				const CTimeValue startTime = gEnv->pTimer->GetAsyncTime();
+				itGraph->Update();
+
+				// Only graphs that actually ran are of interest, idle ones return immediately.
+				if (FGProfile.graphsUpdated != updatedBefore)
+				{
+					SGraphCost cost;
+					cost.timeMs = (gEnv->pTimer->GetAsyncTime() - startTime).GetMilliSeconds();
+					cost.name = itGraph->GetDebugName();
+					m_graphCosts.push_back(cost);
+				}
+			}
+		}
+		else
+#endif //_RELEASE
 		{
-			itGraph->Update();
+			for (TGraphs::Notifier itGraph(m_graphs); itGraph.IsValid(); itGraph.Next())
+			{
+				itGraph->Update();
+			}
 		}
 	}
 
@@ -622,6 +650,25 @@ void CFlowSystem::UpdateGraphs()
 		IRenderAuxText::Draw2dLabel(10, 100, 2, white, false, "Number of Flow Graphs Updated: %d", FGProfile.graphsUpdated);
 		IRenderAuxText::Draw2dLabel(10, 120, 2, white, false, "Number of Flow Graph Nodes Updated: %d", FGProfile.nodeUpdates);
 		IRenderAuxText::Draw2dLabel(10, 140, 2, white, false, "Number of Flow Graph Nodes Activated: %d", FGProfile.nodeActivations);
+
+		if (m_cVars.m_profile > 1 && !m_graphCosts.empty())
+		{
+			const size_t numShown = std::min<size_t>(m_graphCosts.size(), 16);
+			std::partial_sort(m_graphCosts.begin(), m_graphCosts.begin() + numShown, m_graphCosts.end());
+
+			float totalMs = 0.0f;
+			for (const SGraphCost& cost : m_graphCosts)
+			{
+				totalMs += cost.timeMs;
+			}
+
+			float yellow[4] = { 1, 1, 0, 1 };
+			IRenderAuxText::Draw2dLabel(10, 170, 1.5f, yellow, false, "Most expensive Flow Graphs (total %.3f ms):", totalMs);
+			for (size_t i = 0; i < numShown; ++i)
+			{
+				IRenderAuxText::Draw2dLabel(10, 190 + 15.0f * i, 1.3f, white, false, "%.3f ms  %s", m_graphCosts[i].timeMs, m_graphCosts[i].name.c_str());
+			}
+		}
 	}
 	FGProfile.Reset();
 #endif //_RELEASE
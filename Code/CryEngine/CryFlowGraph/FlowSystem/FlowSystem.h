@@ -134,6 +134,15 @@ public:
 		}
 	};
 	static TSFGProfile FGProfile;
+
+	// Per graph update cost, gathered with fg_profile 2
+	struct SGraphCost
+	{
+		float  timeMs;
+		string name;
+
+		bool operator<(const SGraphCost& rhs) const { return timeMs > rhs.timeMs; }
+	};
 #endif //_RELEASE
 
 	const STypeInfo& GetTypeInfo(TFlowNodeTypeId typeId) const;
@@ -173,6 +182,9 @@ private:
 	std::vector<TFlowNodeTypeId>        m_freeNodeTypeIDs;
 	TFlowNodeTypeId                     m_nextNodeTypeID;
 	IFlowGraphInspectorPtr              m_pDefaultInspector;
+#ifndef _RELEASE
+	std::vector<SGraphCost>             m_graphCosts;
+#endif //_RELEASE
 
 	CFlowSystemCVars                    m_cVars;
 
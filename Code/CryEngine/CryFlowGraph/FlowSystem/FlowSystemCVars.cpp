@@ -163,7 +163,7 @@ CFlowSystemCVars::CFlowSystemCVars()
 	REGISTER_COMMAND("fg_InspectEntity", InspectEntity, 0, "Inspects the specified Entity graph");
 	REGISTER_COMMAND("fg_InspectAction", InspectAction, 0, "Inspects the specified AIAction graph");
 	REGISTER_CVAR2("fg_SystemEnable", &this->m_enableUpdates, 1, VF_CHEAT, "Toggles FlowGraph System Updates.\nUsage: fg_SystemEnable [0/1]\nDefault is 1 (on).");
-	REGISTER_CVAR2("fg_profile", &this->m_profile, 0, 0, "Flow graph profiling enable/disable");
+	REGISTER_CVAR2("fg_profile", &this->m_profile, 0, 0, "Flow graph profiling.\nUsage: fg_profile [0/1/2]\n0: off, 1: update and activation counters, 2: also list the most expensive graphs of the frame");
 	REGISTER_CVAR2("fg_inspectorLog", &this->m_inspectorLog, 0, 0, "Log inspector on console.");
 
 #ifdef _RELEASE
@@ -22,6 +22,7 @@ CGameTokenSystem* CGameToken::g_pGameTokenSystem = 0;
 //////////////////////////////////////////////////////////////////////////
 CGameToken::CGameToken()
 	: m_changed(0.0f)
+	, m_bNotifyPending(false)
 {
 	m_nFlags = 0;
 }
@@ -29,6 +30,8 @@ CGameToken::CGameToken()
 //////////////////////////////////////////////////////////////////////////
 CGameToken::~CGameToken()
 {
+	if (m_bNotifyPending)
+		g_pGameTokenSystem->RemovePendingNotification(this);
 	Notify(EGAMETOKEN_EVENT_DELETE);
 }
 
@@ -57,6 +60,7 @@ void CGameToken::SetName(const char* sName)
 //////////////////////////////////////////////////////////////////////////
 void CGameToken::SetValue(const TFlowInputData& val)
 {
+	m_valueLock.WLock();
 	if (val != m_value)
 	{
 		m_value.SetValueWithConversion(val);
@@ -76,8 +80,13 @@ void CGameToken::SetValue(const TFlowInputData& val)
 		}
 		#endif
 
+		m_valueLock.WUnlock();
 		TriggerAsChanged(false);
 	}
+	else
+	{
+		m_valueLock.WUnlock();
+	}
 }
 
 void CGameToken::SetValueFromString(const char* valueStr)
@@ -113,7 +122,9 @@ void CGameToken::SetValueFromString(const char* valueStr)
 //////////////////////////////////////////////////////////////////////////
 bool CGameToken::GetValue(TFlowInputData& val) const
 {
+	m_valueLock.RLock();
 	val = m_value;
+	m_valueLock.RUnlock();
 	return true;
 }
 
@@ -121,7 +132,9 @@ bool CGameToken::GetValue(TFlowInputData& val) const
 const char* CGameToken::GetValueAsString() const
 {
 	static string temp;
+	m_valueLock.RLock();
 	m_value.GetValueWithConversion(temp);
+	m_valueLock.RUnlock();
 	return temp.c_str();
 }
 
@@ -51,6 +51,9 @@ public:
 
 	const string& GetStringName() const { return m_name; }
 
+	bool          IsNotifyPending() const          { return m_bNotifyPending; }
+	void          SetNotifyPending(bool bPending) { m_bNotifyPending = bPending; }
+
 private:
 	friend class CGameTokenSystem; // Need access to m_name
 	static CGameTokenSystem* g_pGameTokenSystem;
@@ -58,8 +61,10 @@ private:
 	uint32                   m_nFlags;
 	string                   m_name;
 	TFlowInputData           m_value;
+	mutable CryRWLock        m_valueLock; // Guards m_value so GetValue can be called from any thread.
 
 	CTimeValue               m_changed;
+	bool                     m_bNotifyPending; // Queued in CGameTokenSystem until the next FlushPendingNotifications.
 
 	typedef std::list<IGameTokenEventListener*> Listeneres;
 	Listeneres m_listeners;
@@ -103,6 +103,8 @@ int CGameTokenSystem::m_CVarNumHistoricLines = DBG_HISTORYSIZE;
 ICVar* CGameTokenSystem::m_pCVarFilter = nullptr;
 #endif
 
+int CGameTokenSystem::m_CVarDeferNotifications = 0;
+
 //////////////////////////////////////////////////////////////////////////
 #ifdef _GAMETOKENSDEBUGINFO
 namespace
@@ -131,6 +133,13 @@ CGameTokenSystem::CGameTokenSystem()
 	m_pGameTokensMap = new GameTokensMap();
 	m_bGoingIntoGame = false;
 
+	REGISTER_CVAR2("gt_deferNotifications", &CGameTokenSystem::m_CVarDeferNotifications, 0, 0,
+	               "Defers game token change notifications to the end of the frame.\n"
+	               "Several changes of the same token within a frame are delivered as a single event.\n"
+	               "Changes made from threads other than the main thread are always deferred.\n"
+	               "Usage: gt_deferNotifications [0/1]\n"
+	               "Default is 0 (notify immediately).");
+
 #ifdef _GAMETOKENSDEBUGINFO
 	m_debugHistory.resize(DBG_HISTORYSIZE);
 	ClearDebugHistory();
@@ -151,6 +160,7 @@ CGameTokenSystem::~CGameTokenSystem()
 		delete m_pScriptBind;
 
 	IConsole* pConsole = gEnv->pConsole;
+	pConsole->UnregisterVariable("gt_deferNotifications", true);
 	pConsole->UnregisterVariable("gt_show", true);
 	pConsole->UnregisterVariable("gt_showPosX", true);
 	pConsole->UnregisterVariable("gt_showPosY", true);
@@ -305,6 +315,56 @@ void CGameTokenSystem::Notify(EGameTokenEvent event, CGameToken* pToken)
 	if (gEnv->IsEditing() || m_bGoingIntoGame)
 		return;
 
+	if (pToken && event == EGAMETOKEN_EVENT_CHANGE && (m_CVarDeferNotifications || CryGetCurrentThreadId() != gEnv->mMainThreadId))
+	{
+		CryAutoLock<CryCriticalSectionNonRecursive> lock(m_pendingNotificationsLock);
+		if (!pToken->IsNotifyPending())
+		{
+			pToken->SetNotifyPending(true);
+			m_pendingNotifications.push_back(pToken);
+		}
+		return;
+	}
+
+	NotifyListeners(event, pToken);
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CGameTokenSystem::FlushPendingNotifications()
+{
+	{
+		CryAutoLock<CryCriticalSectionNonRecursive> lock(m_pendingNotificationsLock);
+		if (m_pendingNotifications.empty())
+			return;
+		m_flushingNotifications.swap(m_pendingNotifications);
+	}
+
+	// Listeners may change or delete tokens while being notified, so each token is checked again before use.
+	for (size_t i = 0; i < m_flushingNotifications.size(); ++i)
+	{
+		CGameToken* pToken = m_flushingNotifications[i];
+		if (pToken && pToken->IsNotifyPending())
+		{
+			pToken->SetNotifyPending(false);
+			if (!gEnv->IsEditing() && !m_bGoingIntoGame)
+				NotifyListeners(EGAMETOKEN_EVENT_CHANGE, pToken);
+		}
+	}
+	m_flushingNotifications.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CGameTokenSystem::RemovePendingNotification(CGameToken* pToken)
+{
+	CryAutoLock<CryCriticalSectionNonRecursive> lock(m_pendingNotificationsLock);
+	stl::find_and_erase(m_pendingNotifications, pToken);
+	std::replace(m_flushingNotifications.begin(), m_flushingNotifications.end(), pToken, (CGameToken*)nullptr);
+	pToken->SetNotifyPending(false);
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CGameTokenSystem::NotifyListeners(EGameTokenEvent event, CGameToken* pToken)
+{
 	for (Listeners::iterator it = m_listeners.begin(); it != m_listeners.end(); ++it)
 	{
 		(*it)->OnGameTokenEvent(event, pToken);
@@ -69,8 +69,13 @@ public:
 	void        Notify(EGameTokenEvent event, CGameToken* pToken);
 	void        DumpAllTokens();
 
+	// Delivers the change notifications queued since the last call, once per token. Called once per frame from the flow system.
+	void        FlushPendingNotifications();
+	void        RemovePendingNotification(CGameToken* pToken);
+
 private:
 	bool _InternalLoadLibrary(const char* filename, const char* tag);
+	void NotifyListeners(EGameTokenEvent event, CGameToken* pToken);
 
 	// Use Hash map for speed.
 	typedef std::unordered_map<const char*, CGameToken*, stl::hash_stricmp<const char*>, stl::hash_stricmp<const char*>> GameTokensMap;
@@ -82,6 +87,12 @@ private:
 	std::vector<string>          m_libraries;
 
 	GameTokensMap*               m_pGameTokensMap; // A pointer so it can be fully unloaded on level unload
+
+	// Tokens changed from worker threads, or any thread when gt_deferNotifications is set.
+	std::vector<CGameToken*>     m_pendingNotifications;
+	std::vector<CGameToken*>     m_flushingNotifications;
+	CryCriticalSectionNonRecursive m_pendingNotificationsLock;
+	static int                   m_CVarDeferNotifications;
 	class CScriptBind_GameToken* m_pScriptBind;
 	XmlNodeRef                   m_levelToLevelSave;
 	bool                         m_bGoingIntoGame;
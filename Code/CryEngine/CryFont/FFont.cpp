@@ -36,7 +36,6 @@ CFFont::CFFont(ISystem* pSystem, CCryFont* pCryFont, const char* pFontName)
 	, m_texID(-1)
 	, m_pSystem(pSystem)
 	, m_pCryFont(pCryFont)
-	, m_fontTexDirty(false)
 	, m_effects()
 	, m_pDrawVB(0)
 {
@@ -121,8 +120,6 @@ bool CFFont::Load(const char* pFontFilePath, unsigned int width, unsigned int he
 	m_pFontBuffer = pBuffer;
 	m_fontBufferSize = fileSize;
 
-	m_fontTexDirty = false;
-
 	InitCache();
 
 	return true;
@@ -911,6 +908,7 @@ unsigned int CFFont::GetEffectId(const char* pEffectName) const
 bool CFFont::InitTexture()
 {
 	m_texID = gEnv->pRenderer->FontCreateTexture(m_pFontTexture->GetWidth(), m_pFontTexture->GetHeight(), (uint8*)m_pFontTexture->GetBuffer(), eTF_A8);
+	m_pFontTexture->ClearDirtyRows();
 	return m_texID >= 0;
 }
 
@@ -945,16 +943,54 @@ CFFont::SEffect* CFFont::GetDefaultEffect()
 	return &m_effects[0];
 }
 
+bool CFFont::PrecacheGlyphs(const char* pFilePath)
+{
+	ICryPak* pPak = gEnv->pCryPak;
+
+	string fullFile;
+	if (pPak->IsAbsPath(pFilePath))
+		fullFile = pFilePath;
+	else
+		fullFile = m_curPath + pFilePath;
+
+	FILE* f = pPak->FOpen(fullFile.c_str(), "rb");
+	if (!f)
+		return false;
+
+	const size_t fileSize = pPak->FGetSize(f);
+	string glyphs;
+	glyphs.resize(fileSize);
+	const bool bRead = fileSize && pPak->FReadRaw(&glyphs[0], fileSize, 1, f);
+	pPak->FClose(f);
+
+	if (!bRead || !m_pFontTexture)
+		return false;
+
+	// the gradient slot is never reused, every other slot can hold a glyph
+	size_t glyphCount = 0;
+	for (Unicode::CIterator<const char*, false> it(glyphs.c_str()); *it; ++it)
+		++glyphCount;
+
+	const int slotCount = m_pFontTexture->GetWidthCellCount() * m_pFontTexture->GetHeightCellCount() - 1;
+	if (glyphCount > (size_t)slotCount)
+		CryWarning(VALIDATOR_MODULE_SYSTEM, VALIDATOR_WARNING, "Font %s: %" PRISIZE_T " precached glyphs in %s exceed the %d cache slots, the first ones will be evicted", m_name.c_str(), glyphCount, fullFile.c_str(), slotCount);
+
+	Prepare(glyphs.c_str(), false);
+
+	return true;
+}
+
 void CFFont::Prepare(const char* pStr, bool updateTexture)
 {
-	bool texUpdateNeeded = m_fontTexDirty || m_pFontTexture->PreCacheString(pStr) == 1;
-	if (updateTexture && texUpdateNeeded && m_texID >= 0)
+	m_pFontTexture->PreCacheString(pStr);
+
+	int startY, endY;
+	if (updateTexture && m_texID >= 0 && m_pFontTexture->GetDirtyRows(startY, endY))
 	{
-		gEnv->pRenderer->FontUpdateTexture(m_texID, 0, 0, m_pFontTexture->GetWidth(), m_pFontTexture->GetHeight(), (unsigned char*) m_pFontTexture->GetBuffer());
-		m_fontTexDirty = false;
+		const int width = m_pFontTexture->GetWidth();
+		gEnv->pRenderer->FontUpdateTexture(m_texID, 0, startY, width, endY - startY, (unsigned char*)(m_pFontTexture->GetBuffer() + startY * width));
+		m_pFontTexture->ClearDirtyRows();
 	}
-	else
-		m_fontTexDirty = texUpdateNeeded;
 }
 
 #endif
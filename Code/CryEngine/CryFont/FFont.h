@@ -91,6 +91,8 @@ public:
 
 	bool          InitTexture();
 	bool          InitCache();
+	// Rasterizes the glyphs of a UTF-8 text file (e.g. a localized character set) into the cache up front.
+	bool          PrecacheGlyphs(const char* pFilePath);
 
 	CFontTexture* GetFontTexture() const { return m_pFontTexture; }
 	const string& GetName() const        { return m_name; }
@@ -118,8 +120,6 @@ private:
 	ISystem*         m_pSystem;
 	CCryFont*        m_pCryFont;
 
-	bool             m_fontTexDirty;
-
 	Effects          m_effects;
 
 	SVF_P3F_C4B_T2F* m_pDrawVB;
@@ -157,10 +157,14 @@ private:
 						string newFontPath(sysFontPath);
 						newFontPath += "/";
 						newFontPath += pFontName;
-						m_pFont->Load(newFontPath, m_FontTexSize.x, m_FontTexSize.y, TTFFLAG_CREATE(m_FontSmoothMethod, m_FontSmoothAmount));
+						fontLoaded = m_pFont->Load(newFontPath, m_FontTexSize.x, m_FontTexSize.y, TTFFLAG_CREATE(m_FontSmoothMethod, m_FontSmoothAmount));
 					}
 				}
 	#endif
+				if (fontLoaded && !m_strPrecachePath.empty() && !m_pFont->PrecacheGlyphs(m_strPrecachePath.c_str()))
+				{
+					CryWarning(VALIDATOR_MODULE_SYSTEM, VALIDATOR_WARNING, "Font %s: failed to read glyph precache file %s", m_pFont->GetName().c_str(), m_strPrecachePath.c_str());
+				}
 			}
 			break;
 
@@ -248,6 +252,10 @@ private:
 			{
 				m_FontSmoothAmount = (long)atof(value.c_str());
 			}
+			else if (name == "precache")
+			{
+				m_strPrecachePath = value;
+			}
 			break;
 
 		case ELEMENT_EFFECT:
@@ -325,6 +333,7 @@ public:
 	CFFont::SRenderingPass* m_pPass;
 
 	string                  m_strFontPath;
+	string                  m_strPrecachePath;
 	Vec2i                   m_FontTexSize;
 	bool                    m_bNoRescale;
 
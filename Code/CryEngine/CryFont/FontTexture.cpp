@@ -13,7 +13,7 @@
 CFontTexture::CFontTexture()
 	: m_wSlotUsage(1), m_iWidth(0), m_iHeight(0), m_fInvWidth(0.0f), m_fInvHeight(0.0f), m_iCellWidth(0), m_iCellHeight(0),
 	m_fTextureCellWidth(0), m_fTextureCellHeight(0), m_iWidthCellCount(0), m_iHeightCellCount(0), m_nTextureSlotCount(0),
-	m_pBuffer(0), m_iSmoothMethod(FONT_SMOOTH_NONE), m_iSmoothAmount(FONT_SMOOTH_AMOUNT_NONE)
+	m_pBuffer(0), m_iDirtyStartY(0), m_iDirtyEndY(0), m_iSmoothMethod(FONT_SMOOTH_NONE), m_iSmoothAmount(FONT_SMOOTH_AMOUNT_NONE)
 {
 }
 
@@ -131,6 +131,8 @@ int CFontTexture::Release()
 	m_iSmoothMethod = 0;
 	m_iSmoothAmount = 0;
 
+	ClearDirtyRows();
+
 	m_fTextureCellWidth = 0.0f;
 	m_fTextureCellHeight = 0.0f;
 
@@ -434,9 +436,39 @@ int CFontTexture::UpdateSlot(int iSlot, uint16 wSlotUsage, uint32 cChar)
 	pGlyphBitmap->BlitTo8(m_pBuffer, 0, 0,
 	                      iWidth, iHeight, x * m_iCellWidth, y * m_iCellHeight, m_iWidth);
 
+	// only the rows of the changed cells need to be uploaded
+	const int iStartY = y * m_iCellHeight;
+	const int iEndY = min(iStartY + m_iCellHeight, m_iHeight);
+	if (m_iDirtyStartY >= m_iDirtyEndY)
+	{
+		m_iDirtyStartY = iStartY;
+		m_iDirtyEndY = iEndY;
+	}
+	else
+	{
+		m_iDirtyStartY = min(m_iDirtyStartY, iStartY);
+		m_iDirtyEndY = max(m_iDirtyEndY, iEndY);
+	}
+
 	return 1;
 }
 
+//-------------------------------------------------------------------------------------------------
+bool CFontTexture::GetDirtyRows(int& iStartY, int& iEndY) const
+{
+	iStartY = m_iDirtyStartY;
+	iEndY = m_iDirtyEndY;
+
+	return m_iDirtyStartY < m_iDirtyEndY;
+}
+
+//-------------------------------------------------------------------------------------------------
+void CFontTexture::ClearDirtyRows()
+{
+	m_iDirtyStartY = 0;
+	m_iDirtyEndY = 0;
+}
+
 //-------------------------------------------------------------------------------------------------
 void CFontTexture::CreateGradientSlot()
 {
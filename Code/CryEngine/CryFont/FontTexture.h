@@ -115,6 +115,10 @@ public:
 	// useful for special feature rendering interleaved with fonts (e.g. box behind the text)
 	void CreateGradientSlot();
 
+	// rows of the texture changed since the last ClearDirtyRows(), iEndY is exclusive
+	bool GetDirtyRows(int& iStartY, int& iEndY) const;
+	void ClearDirtyRows();
+
 	int  WriteToFile(const string& szFileName);
 
 	void GetMemoryUsage(ICrySizer* pSizer) const
@@ -160,5 +164,8 @@ private: // ---------------------------------------------------------------
 
 	FONT_TEXTURE_TYPE* m_pBuffer;                 // [y*iWidth * x] x=0..iWidth-1, y=0..iHeight-1
 
+	int                m_iDirtyStartY;
+	int                m_iDirtyEndY;
+
 	uint16             m_wSlotUsage;
 };
@@ -39,6 +39,7 @@ CBaseInput::CBaseInput()
 	, m_enableEventPosting(true)
 	, m_retriggering(false)
 	, m_hasFocus(false)
+	, m_frameInputTimestamp(0)
 	, m_modifiers(0)
 	, m_pCVars(new CInputCVars())
 	, m_platformFlags(0)
@@ -114,6 +115,7 @@ void CBaseInput::Update(bool bFocus)
 	FUNCTION_PROFILER(GetISystem(), PROFILE_INPUT);
 
 	m_hasFocus = bFocus;
+	m_frameInputTimestamp = 0;
 
 	// Update blocking inputs
 	UpdateBlockingInputs();
@@ -136,6 +138,12 @@ void CBaseInput::Update(bool bFocus)
 	event.keyId = eKI_SYS_Commit;
 	PostInputEvent(event);
 
+	if (g_pInputCVars->i_debug_latency && m_frameInputTimestamp)
+	{
+		const float ageMs = (float)(CryGetTicks() - m_frameInputTimestamp) * 1000.0f / (float)CryGetTicksPerSec();
+		gEnv->pLog->Log("InputDebug: oldest input event of frame %u dispatched after %.2f ms", gEnv->nMainFrameID, ageMs);
+	}
+
 	if (m_pKinectInput)
 	{
 		m_pKinectInput->Update();
@@ -471,6 +479,20 @@ void CBaseInput::PostInputEvent(const SInputEvent& event, bool bForce)
 		return;
 	}
 
+	if (!event.timestamp)
+	{
+		SInputEvent stampedEvent = event;
+		stampedEvent.timestamp = CryGetTicks();
+		PostInputEvent(stampedEvent, bForce);
+		return;
+	}
+
+	// hold events are generated by the input system itself and don't measure device latency
+	if (event.deviceType != eIDT_Unknown && event.state != eIS_Down && (!m_frameInputTimestamp || event.timestamp < m_frameInputTimestamp))
+	{
+		m_frameInputTimestamp = event.timestamp;
+	}
+
 	if (g_pInputCVars->i_debug)
 	{
 		// log out key press and release events
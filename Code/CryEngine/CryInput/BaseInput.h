@@ -104,6 +104,7 @@ public:
 	void           SetModifiers(int modifiers) { m_modifiers = modifiers;  }
 
 	virtual uint32 GetPlatformFlags() const    { return m_platformFlags; }
+	virtual int64  GetFrameInputTimestamp() const { return m_frameInputTimestamp; }
 
 	// Input blocking functionality
 	virtual bool                SetBlockingInput(const SInputBlockData& inputBlockData);
@@ -151,6 +152,9 @@ private:
 
 	bool                               m_hasFocus;
 
+	// oldest press/release/change event timestamp dispatched during the current Update
+	int64                              m_frameInputTimestamp;
+
 	// input device management
 	TInputDevices m_inputDevices;
 
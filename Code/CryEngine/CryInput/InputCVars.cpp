@@ -13,6 +13,9 @@ CInputCVars::CInputCVars()
 	              "Usage: i_debug [0/1]\n"
 	              "Default is 0 (off). Set to 1 to spam console with key events (only press and release).");
 	REGISTER_CVAR(i_forcefeedback, 1, 0, "Enable/Disable force feedback output.");
+	REGISTER_CVAR(i_debug_latency, 0, 0,
+	              "Logs the age of the oldest input event dispatched each frame.\n"
+	              "Usage: i_debug_latency [0/1]");
 
 	// mouse
 	REGISTER_CVAR(i_mouse_buffered, 0, 0,
@@ -63,6 +66,10 @@ CInputCVars::CInputCVars()
 	              "Number of ms between device polls in polling thread\n"
 	              "Usage: i_xinput_poll_time 500\n"
 	              "Default is 1000ms. Value must be >=0.");
+	REGISTER_CVAR(i_xinput_poll_rate, 0, 0,
+	              "Rate in Hz at which the input worker thread samples connected XInput pads\n"
+	              "Usage: i_xinput_poll_rate 500\n"
+	              "Default is 0 (pads are read once per frame). Sampled states are queued and processed at the start of the next frame.");
 
 	REGISTER_CVAR(i_xinput_deadzone_handling, 1, 0,
 	              "deadzonehandling\n"
@@ -129,6 +136,7 @@ CInputCVars::CInputCVars()
 CInputCVars::~CInputCVars()
 {
 	gEnv->pConsole->UnregisterVariable("i_debug");
+	gEnv->pConsole->UnregisterVariable("i_debug_latency");
 	gEnv->pConsole->UnregisterVariable("i_forcefeedback");
 
 	// mouse
@@ -145,6 +153,7 @@ CInputCVars::~CInputCVars()
 	// xinput
 	gEnv->pConsole->UnregisterVariable("i_xinput");
 	gEnv->pConsole->UnregisterVariable("i_xinput_poll_time");
+	gEnv->pConsole->UnregisterVariable("i_xinput_poll_rate");
 
 	gEnv->pConsole->UnregisterVariable("i_xinput_deadzone_handling");
 
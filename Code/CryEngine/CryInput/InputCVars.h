@@ -26,6 +26,8 @@ public:
 
 	int   i_xinput;
 	int   i_xinput_poll_time;
+	int   i_xinput_poll_rate;
+	int   i_debug_latency;
 
 	int   i_xinput_deadzone_handling;
 
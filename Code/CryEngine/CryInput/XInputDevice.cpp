@@ -5,6 +5,7 @@
 #include <CrySystem/IConsole.h>
 #include <CryCore/Platform/platform.h>
 #include <CryThreading/IThreadManager.h>
+#include <atomic>
 
 #pragma warning(push)
 #pragma warning(disable: 4244)
@@ -50,11 +51,60 @@ const char* deviceNames[] =
 
 volatile bool g_bConnected[4] = { false };
 
+struct SXInputSample
+{
+	XINPUT_STATE state;
+	int64        timestamp; // CryGetTicks() when the state was read
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Single producer (input worker) / single consumer (main thread) ring of
+// pad states. When full, new samples are dropped until the main thread
+// catches up, the next frame then reads the current state directly.
+//////////////////////////////////////////////////////////////////////////
+class CXInputSampleQueue
+{
+public:
+	enum { kCapacity = 256 };
+
+	CXInputSampleQueue() : m_head(0), m_tail(0) {}
+
+	bool Push(const SXInputSample& sample)
+	{
+		const uint32 head = m_head.load(std::memory_order_relaxed);
+		if (head - m_tail.load(std::memory_order_acquire) >= kCapacity)
+			return false;
+
+		m_samples[head % kCapacity] = sample;
+		m_head.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool Pop(SXInputSample& sample)
+	{
+		const uint32 tail = m_tail.load(std::memory_order_relaxed);
+		if (tail == m_head.load(std::memory_order_acquire))
+			return false;
+
+		sample = m_samples[tail % kCapacity];
+		m_tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+private:
+	SXInputSample       m_samples[kCapacity];
+	std::atomic<uint32> m_head;
+	std::atomic<uint32> m_tail;
+};
+
+CXInputSampleQueue g_xinputSamples[4];
+
 //int g_numControllers = 0;
 
 //////////////////////////////////////////////////////////////////////////
 // This is a thread task responsible for periodically checking gamepad
-// connection status.
+// connection status. With i_xinput_poll_rate set it also samples the
+// connected pads at that rate, decoupling pad latency from the frame rate.
 //////////////////////////////////////////////////////////////////////////
 class CInputConnectionThreadTask : public IThread
 {
@@ -82,17 +132,42 @@ public:
 	{
 		IInput* pInput = m_pInput;
 		XINPUT_CAPABILITIES caps;
+		DWORD lastPacketNumber[4] = { 0 };
+		int64 nextConnectionCheck = 0;
 
 		while (!m_bQuit)
 		{
+			const int64 now = CryGetTicks();
+			const int connectionPollTime = max(g_pInputCVars->i_xinput_poll_time, 1);
+			if (now >= nextConnectionCheck)
 			{
 				for (DWORD i = 0; i < 4; ++i)
 				{
 					DWORD r = XInputGetCapabilities(i, XINPUT_FLAG_GAMEPAD, &caps);
 					g_bConnected[i] = r == ERROR_SUCCESS;
 				}
+				nextConnectionCheck = now + CryGetTicksPerSec() * connectionPollTime / 1000;
 			}
-			Sleep(1000);
+
+			const int pollRate = g_pInputCVars->i_xinput_poll_rate;
+			if (pollRate <= 0)
+			{
+				Sleep(connectionPollTime);
+				continue;
+			}
+
+			for (DWORD i = 0; i < 4; ++i)
+			{
+				SXInputSample sample;
+				if (g_bConnected[i] && XInputGetState(i, &sample.state) == ERROR_SUCCESS && sample.state.dwPacketNumber != lastPacketNumber[i])
+				{
+					sample.timestamp = CryGetTicks();
+					if (g_xinputSamples[i].Push(sample))
+						lastPacketNumber[i] = sample.state.dwPacketNumber;
+				}
+			}
+
+			Sleep(max(1000 / pollRate, 1));
 		}
 	}
 };
@@ -110,7 +185,7 @@ void CleanupVibrationAtExit()
 }
 
 CXInputDevice::CXInputDevice(IInput& input, int deviceNo) : CInputDevice(input, deviceNames[deviceNo]),
-	m_deviceNo(deviceNo), m_connected(false)
+	m_deviceNo(deviceNo), m_connected(false), m_sampleTimestamp(0)
 {
 	memset(&m_state, 0, sizeof(XINPUT_STATE));
 
@@ -253,190 +328,216 @@ void CXInputDevice::Update(bool bFocus)
 	// interpret input
 	if ((m_connected && bFocus) || disconnecting)
 	{
-		XINPUT_STATE state;
-		memset(&state, 0, sizeof(XINPUT_STATE));
-		if (ERROR_SUCCESS != XInputGetState(m_deviceNo, &state) && !disconnecting)
-			return;
-
-		if (state.dwPacketNumber != m_state.dwPacketNumber)
+		// states sampled by the input worker since the last frame, so presses shorter than a frame are not lost
+		SXInputSample sample;
+		bool bSampled = false;
+		while (g_xinputSamples[m_deviceNo].Pop(sample))
 		{
-			SInputEvent event;
-			SInputSymbol* pSymbol = 0;
+			ProcessState(sample.state, sample.timestamp);
+			bSampled = true;
+		}
 
-			event.deviceIndex = (uint8)m_deviceNo;
+		if (!bSampled)
+		{
+			XINPUT_STATE state;
+			memset(&state, 0, sizeof(XINPUT_STATE));
+			if (ERROR_SUCCESS != XInputGetState(m_deviceNo, &state) && !disconnecting)
+				return;
 
-			if (g_pInputCVars->i_xinput_deadzone_handling > 0)
-			{
-				{
-					Vec2 d(state.Gamepad.sThumbLX, state.Gamepad.sThumbLY);
+			ProcessState(state, CryGetTicks());
+		}
+	}
+	else
+	{
+		SXInputSample sample;
+		while (g_xinputSamples[m_deviceNo].Pop(sample))
+		{
+		}
+	}
+}
 
-					FixDeadzone(d);
+void CXInputDevice::ProcessState(XINPUT_STATE state, int64 timestamp)
+{
+	if (state.dwPacketNumber != m_state.dwPacketNumber)
+	{
+		SInputEvent event;
+		SInputSymbol* pSymbol = 0;
 
-					state.Gamepad.sThumbLX = d[0];
-					state.Gamepad.sThumbLY = d[1];
-				}
+		event.deviceIndex = (uint8)m_deviceNo;
+		event.timestamp = timestamp;
+		m_sampleTimestamp = timestamp;
 
-				{
-					Vec2 d(state.Gamepad.sThumbRX, state.Gamepad.sThumbRY);
+		if (g_pInputCVars->i_xinput_deadzone_handling > 0)
+		{
+			{
+				Vec2 d(state.Gamepad.sThumbLX, state.Gamepad.sThumbLY);
 
-					FixDeadzone(d);
+				FixDeadzone(d);
 
-					state.Gamepad.sThumbRX = d[0];
-					state.Gamepad.sThumbRY = d[1];
-				}
+				state.Gamepad.sThumbLX = d[0];
+				state.Gamepad.sThumbLY = d[1];
 			}
-			else
+
 			{
-				const float INV_VALIDRANGE = (1.0f / (INPUT_MAX - m_fDeadZone));
+				Vec2 d(state.Gamepad.sThumbRX, state.Gamepad.sThumbRY);
+
+				FixDeadzone(d);
 
-				// make the inputs move smoothly out of the deadzone instead of snapping straight to m_fDeadZone
-				float fraction = max((float)abs(state.Gamepad.sThumbLX) - m_fDeadZone, 0.f) * INV_VALIDRANGE;
-				state.Gamepad.sThumbLX = fraction * INPUT_MAX * sgn(state.Gamepad.sThumbLX);
+				state.Gamepad.sThumbRX = d[0];
+				state.Gamepad.sThumbRY = d[1];
+			}
+		}
+		else
+		{
+			const float INV_VALIDRANGE = (1.0f / (INPUT_MAX - m_fDeadZone));
 
-				fraction = max((float)abs(state.Gamepad.sThumbLY) - m_fDeadZone, 0.f) * INV_VALIDRANGE;
-				state.Gamepad.sThumbLY = fraction * INPUT_MAX * sgn(state.Gamepad.sThumbLY);
+			// make the inputs move smoothly out of the deadzone instead of snapping straight to m_fDeadZone
+			float fraction = max((float)abs(state.Gamepad.sThumbLX) - m_fDeadZone, 0.f) * INV_VALIDRANGE;
+			state.Gamepad.sThumbLX = fraction * INPUT_MAX * sgn(state.Gamepad.sThumbLX);
 
-				// make the inputs move smoothly out of the deadzone instead of snapping straight to m_fDeadZone
-				fraction = max((float)abs(state.Gamepad.sThumbRX) - m_fDeadZone, 0.f) * INV_VALIDRANGE;
-				state.Gamepad.sThumbRX = fraction * INPUT_MAX * sgn(state.Gamepad.sThumbRX);
+			fraction = max((float)abs(state.Gamepad.sThumbLY) - m_fDeadZone, 0.f) * INV_VALIDRANGE;
+			state.Gamepad.sThumbLY = fraction * INPUT_MAX * sgn(state.Gamepad.sThumbLY);
 
-				fraction = max((float)abs(state.Gamepad.sThumbRY) - m_fDeadZone, 0.f) * INV_VALIDRANGE;
-				state.Gamepad.sThumbRY = fraction * INPUT_MAX * sgn(state.Gamepad.sThumbRY);
+			// make the inputs move smoothly out of the deadzone instead of snapping straight to m_fDeadZone
+			fraction = max((float)abs(state.Gamepad.sThumbRX) - m_fDeadZone, 0.f) * INV_VALIDRANGE;
+			state.Gamepad.sThumbRX = fraction * INPUT_MAX * sgn(state.Gamepad.sThumbRX);
 
-			}
+			fraction = max((float)abs(state.Gamepad.sThumbRY) - m_fDeadZone, 0.f) * INV_VALIDRANGE;
+			state.Gamepad.sThumbRY = fraction * INPUT_MAX * sgn(state.Gamepad.sThumbRY);
 
-			// compare new values against cached value and only send out changes as new input
-			WORD buttonsChange = m_state.Gamepad.wButtons ^ state.Gamepad.wButtons;
-			if (buttonsChange)
-			{
-				for (int i = 0; i < 16; ++i)
-				{
-					uint32 id = (1 << i);
-					if (buttonsChange & id && (pSymbol = DevSpecIdToSymbol(id)))
-					{
-						pSymbol->PressEvent((state.Gamepad.wButtons & id) != 0);
-						pSymbol->AssignTo(event);
-						event.deviceType = eIDT_Gamepad;
-						GetIInput().PostInputEvent(event);
-						DEBUG_CONTROLLER_LOG_BUTTON_ACTION(pSymbol);
-					}
-				}
-			}
+		}
 
-			// now we have done the digital buttons ... let's do the analog stuff
-			if (m_state.Gamepad.bLeftTrigger != state.Gamepad.bLeftTrigger)
+		// compare new values against cached value and only send out changes as new input
+		WORD buttonsChange = m_state.Gamepad.wButtons ^ state.Gamepad.wButtons;
+		if (buttonsChange)
+		{
+			for (int i = 0; i < 16; ++i)
 			{
-				pSymbol = DevSpecIdToSymbol(_XINPUT_GAMEPAD_LEFT_TRIGGER);
-				pSymbol->ChangeEvent(state.Gamepad.bLeftTrigger / 255.0f);
-				pSymbol->AssignTo(event);
-				event.deviceType = eIDT_Gamepad;
-				GetIInput().PostInputEvent(event);
-				DEBUG_CONTROLLER_LOG_BUTTON_ACTION(pSymbol);
-
-				//--- Check previous and current trigger against threshold for digital press/release event
-				bool bIsPressed = state.Gamepad.bLeftTrigger > XINPUT_GAMEPAD_TRIGGER_THRESHOLD ? true : false;
-				bool bWasPressed = m_state.Gamepad.bLeftTrigger > XINPUT_GAMEPAD_TRIGGER_THRESHOLD ? true : false;
-				if (bIsPressed != bWasPressed)
+				uint32 id = (1 << i);
+				if (buttonsChange & id && (pSymbol = DevSpecIdToSymbol(id)))
 				{
-					pSymbol = DevSpecIdToSymbol(_XINPUT_GAMEPAD_LEFT_TRIGGER_BTN);
-					pSymbol->PressEvent(bIsPressed);
+					pSymbol->PressEvent((state.Gamepad.wButtons & id) != 0);
 					pSymbol->AssignTo(event);
 					event.deviceType = eIDT_Gamepad;
 					GetIInput().PostInputEvent(event);
 					DEBUG_CONTROLLER_LOG_BUTTON_ACTION(pSymbol);
 				}
 			}
-			if (m_state.Gamepad.bRightTrigger != state.Gamepad.bRightTrigger)
-			{
-				pSymbol = DevSpecIdToSymbol(_XINPUT_GAMEPAD_RIGHT_TRIGGER);
-				pSymbol->ChangeEvent(state.Gamepad.bRightTrigger / 255.0f);
-				pSymbol->AssignTo(event);
-				event.deviceType = eIDT_Gamepad;
-				GetIInput().PostInputEvent(event);
-				DEBUG_CONTROLLER_LOG_BUTTON_ACTION(pSymbol);
+		}
 
-				//--- Check previous and current trigger against threshold for digital press/release event
-				bool bIsPressed = state.Gamepad.bRightTrigger > XINPUT_GAMEPAD_TRIGGER_THRESHOLD;
-				bool bWasPressed = m_state.Gamepad.bRightTrigger > XINPUT_GAMEPAD_TRIGGER_THRESHOLD;
-				if (bIsPressed != bWasPressed)
-				{
-					pSymbol = DevSpecIdToSymbol(_XINPUT_GAMEPAD_RIGHT_TRIGGER_BTN);
-					pSymbol->PressEvent(bIsPressed);
-					pSymbol->AssignTo(event);
-					event.deviceType = eIDT_Gamepad;
-					GetIInput().PostInputEvent(event);
-					DEBUG_CONTROLLER_LOG_BUTTON_ACTION(pSymbol);
-				}
-			}
-			if ((m_state.Gamepad.sThumbLX != state.Gamepad.sThumbLX) || m_forceResendSticks)
-			{
-				pSymbol = DevSpecIdToSymbol(_XINPUT_GAMEPAD_LEFT_THUMB_X);
-				if (state.Gamepad.sThumbLX == 0.f)
-					pSymbol->ChangeEvent(0.f);
-				else
-					pSymbol->ChangeEvent((state.Gamepad.sThumbLX + 32768) / 32767.5f - 1.0f);
-				pSymbol->AssignTo(event);
-				event.deviceType = eIDT_Gamepad;
-				GetIInput().PostInputEvent(event);
-				//--- Check previous and current state to generate digital press/release event
-				static SInputSymbol* pSymbolLeft = DevSpecIdToSymbol(_XINPUT_GAMEPAD_LEFT_THUMB_LEFT);
-				ProcessAnalogStick(pSymbolLeft, m_state.Gamepad.sThumbLX, state.Gamepad.sThumbLX, -25000);
-				static SInputSymbol* pSymbolRight = DevSpecIdToSymbol(_XINPUT_GAMEPAD_LEFT_THUMB_RIGHT);
-				ProcessAnalogStick(pSymbolRight, m_state.Gamepad.sThumbLX, state.Gamepad.sThumbLX, 25000);
-			}
-			if ((m_state.Gamepad.sThumbLY != state.Gamepad.sThumbLY) || m_forceResendSticks)
-			{
-				pSymbol = DevSpecIdToSymbol(_XINPUT_GAMEPAD_LEFT_THUMB_Y);
-				if (state.Gamepad.sThumbLY == 0.f)
-					pSymbol->ChangeEvent(0.f);
-				else
-					pSymbol->ChangeEvent((state.Gamepad.sThumbLY + 32768) / 32767.5f - 1.0f);
-				pSymbol->AssignTo(event);
-				event.deviceType = eIDT_Gamepad;
-				GetIInput().PostInputEvent(event);
-				//--- Check previous and current state to generate digital press/release event
-				static SInputSymbol* pSymbolUp = DevSpecIdToSymbol(_XINPUT_GAMEPAD_LEFT_THUMB_UP);
-				ProcessAnalogStick(pSymbolUp, m_state.Gamepad.sThumbLY, state.Gamepad.sThumbLY, 25000);
-				static SInputSymbol* pSymbolDown = DevSpecIdToSymbol(_XINPUT_GAMEPAD_LEFT_THUMB_DOWN);
-				ProcessAnalogStick(pSymbolDown, m_state.Gamepad.sThumbLY, state.Gamepad.sThumbLY, -25000);
-			}
-			if ((m_state.Gamepad.sThumbRX != state.Gamepad.sThumbRX) || m_forceResendSticks)
+		// now we have done the digital buttons ... let's do the analog stuff
+		if (m_state.Gamepad.bLeftTrigger != state.Gamepad.bLeftTrigger)
+		{
+			pSymbol = DevSpecIdToSymbol(_XINPUT_GAMEPAD_LEFT_TRIGGER);
+			pSymbol->ChangeEvent(state.Gamepad.bLeftTrigger / 255.0f);
+			pSymbol->AssignTo(event);
+			event.deviceType = eIDT_Gamepad;
+			GetIInput().PostInputEvent(event);
+			DEBUG_CONTROLLER_LOG_BUTTON_ACTION(pSymbol);
+
+			//--- Check previous and current trigger against threshold for digital press/release event
+			bool bIsPressed = state.Gamepad.bLeftTrigger > XINPUT_GAMEPAD_TRIGGER_THRESHOLD ? true : false;
+			bool bWasPressed = m_state.Gamepad.bLeftTrigger > XINPUT_GAMEPAD_TRIGGER_THRESHOLD ? true : false;
+			if (bIsPressed != bWasPressed)
 			{
-				pSymbol = DevSpecIdToSymbol(_XINPUT_GAMEPAD_RIGHT_THUMB_X);
-				if (state.Gamepad.sThumbRX == 0.f)
-					pSymbol->ChangeEvent(0.f);
-				else
-					pSymbol->ChangeEvent((state.Gamepad.sThumbRX + 32768) / 32767.5f - 1.0f);
+				pSymbol = DevSpecIdToSymbol(_XINPUT_GAMEPAD_LEFT_TRIGGER_BTN);
+				pSymbol->PressEvent(bIsPressed);
 				pSymbol->AssignTo(event);
 				event.deviceType = eIDT_Gamepad;
 				GetIInput().PostInputEvent(event);
-				//--- Check previous and current state to generate digital press/release event
-				static SInputSymbol* pSymbolLeft = DevSpecIdToSymbol(_XINPUT_GAMEPAD_RIGHT_THUMB_LEFT);
-				ProcessAnalogStick(pSymbolLeft, m_state.Gamepad.sThumbRX, state.Gamepad.sThumbRX, -25000);
-				static SInputSymbol* pSymbolRight = DevSpecIdToSymbol(_XINPUT_GAMEPAD_RIGHT_THUMB_RIGHT);
-				ProcessAnalogStick(pSymbolRight, m_state.Gamepad.sThumbRX, state.Gamepad.sThumbRX, 25000);
+				DEBUG_CONTROLLER_LOG_BUTTON_ACTION(pSymbol);
 			}
-			if ((m_state.Gamepad.sThumbRY != state.Gamepad.sThumbRY) || m_forceResendSticks)
+		}
+		if (m_state.Gamepad.bRightTrigger != state.Gamepad.bRightTrigger)
+		{
+			pSymbol = DevSpecIdToSymbol(_XINPUT_GAMEPAD_RIGHT_TRIGGER);
+			pSymbol->ChangeEvent(state.Gamepad.bRightTrigger / 255.0f);
+			pSymbol->AssignTo(event);
+			event.deviceType = eIDT_Gamepad;
+			GetIInput().PostInputEvent(event);
+			DEBUG_CONTROLLER_LOG_BUTTON_ACTION(pSymbol);
+
+			//--- Check previous and current trigger against threshold for digital press/release event
+			bool bIsPressed = state.Gamepad.bRightTrigger > XINPUT_GAMEPAD_TRIGGER_THRESHOLD;
+			bool bWasPressed = m_state.Gamepad.bRightTrigger > XINPUT_GAMEPAD_TRIGGER_THRESHOLD;
+			if (bIsPressed != bWasPressed)
 			{
-				pSymbol = DevSpecIdToSymbol(_XINPUT_GAMEPAD_RIGHT_THUMB_Y);
-				if (state.Gamepad.sThumbRY == 0.f)
-					pSymbol->ChangeEvent(0.f);
-				else
-					pSymbol->ChangeEvent((state.Gamepad.sThumbRY + 32768) / 32767.5f - 1.0f);
+				pSymbol = DevSpecIdToSymbol(_XINPUT_GAMEPAD_RIGHT_TRIGGER_BTN);
+				pSymbol->PressEvent(bIsPressed);
 				pSymbol->AssignTo(event);
 				event.deviceType = eIDT_Gamepad;
 				GetIInput().PostInputEvent(event);
-				//--- Check previous and current state to generate digital press/release event
-				static SInputSymbol* pSymbolUp = DevSpecIdToSymbol(_XINPUT_GAMEPAD_RIGHT_THUMB_UP);
-				ProcessAnalogStick(pSymbolUp, m_state.Gamepad.sThumbRY, state.Gamepad.sThumbRY, 25000);
-				static SInputSymbol* pSymbolDown = DevSpecIdToSymbol(_XINPUT_GAMEPAD_RIGHT_THUMB_DOWN);
-				ProcessAnalogStick(pSymbolDown, m_state.Gamepad.sThumbRY, state.Gamepad.sThumbRY, -25000);
+				DEBUG_CONTROLLER_LOG_BUTTON_ACTION(pSymbol);
 			}
-
-			// update cache
-			m_state = state;
-			m_forceResendSticks = false;
 		}
+		if ((m_state.Gamepad.sThumbLX != state.Gamepad.sThumbLX) || m_forceResendSticks)
+		{
+			pSymbol = DevSpecIdToSymbol(_XINPUT_GAMEPAD_LEFT_THUMB_X);
+			if (state.Gamepad.sThumbLX == 0.f)
+				pSymbol->ChangeEvent(0.f);
+			else
+				pSymbol->ChangeEvent((state.Gamepad.sThumbLX + 32768) / 32767.5f - 1.0f);
+			pSymbol->AssignTo(event);
+			event.deviceType = eIDT_Gamepad;
+			GetIInput().PostInputEvent(event);
+			//--- Check previous and current state to generate digital press/release event
+			static SInputSymbol* pSymbolLeft = DevSpecIdToSymbol(_XINPUT_GAMEPAD_LEFT_THUMB_LEFT);
+			ProcessAnalogStick(pSymbolLeft, m_state.Gamepad.sThumbLX, state.Gamepad.sThumbLX, -25000);
+			static SInputSymbol* pSymbolRight = DevSpecIdToSymbol(_XINPUT_GAMEPAD_LEFT_THUMB_RIGHT);
+			ProcessAnalogStick(pSymbolRight, m_state.Gamepad.sThumbLX, state.Gamepad.sThumbLX, 25000);
+		}
+		if ((m_state.Gamepad.sThumbLY != state.Gamepad.sThumbLY) || m_forceResendSticks)
+		{
+			pSymbol = DevSpecIdToSymbol(_XINPUT_GAMEPAD_LEFT_THUMB_Y);
+			if (state.Gamepad.sThumbLY == 0.f)
+				pSymbol->ChangeEvent(0.f);
+			else
+				pSymbol->ChangeEvent((state.Gamepad.sThumbLY + 32768) / 32767.5f - 1.0f);
+			pSymbol->AssignTo(event);
+			event.deviceType = eIDT_Gamepad;
+			GetIInput().PostInputEvent(event);
+			//--- Check previous and current state to generate digital press/release event
+			static SInputSymbol* pSymbolUp = DevSpecIdToSymbol(_XINPUT_GAMEPAD_LEFT_THUMB_UP);
+			ProcessAnalogStick(pSymbolUp, m_state.Gamepad.sThumbLY, state.Gamepad.sThumbLY, 25000);
+			static SInputSymbol* pSymbolDown = DevSpecIdToSymbol(_XINPUT_GAMEPAD_LEFT_THUMB_DOWN);
+			ProcessAnalogStick(pSymbolDown, m_state.Gamepad.sThumbLY, state.Gamepad.sThumbLY, -25000);
+		}
+		if ((m_state.Gamepad.sThumbRX != state.Gamepad.sThumbRX) || m_forceResendSticks)
+		{
+			pSymbol = DevSpecIdToSymbol(_XINPUT_GAMEPAD_RIGHT_THUMB_X);
+			if (state.Gamepad.sThumbRX == 0.f)
+				pSymbol->ChangeEvent(0.f);
+			else
+				pSymbol->ChangeEvent((state.Gamepad.sThumbRX + 32768) / 32767.5f - 1.0f);
+			pSymbol->AssignTo(event);
+			event.deviceType = eIDT_Gamepad;
+			GetIInput().PostInputEvent(event);
+			//--- Check previous and current state to generate digital press/release event
+			static SInputSymbol* pSymbolLeft = DevSpecIdToSymbol(_XINPUT_GAMEPAD_RIGHT_THUMB_LEFT);
+			ProcessAnalogStick(pSymbolLeft, m_state.Gamepad.sThumbRX, state.Gamepad.sThumbRX, -25000);
+			static SInputSymbol* pSymbolRight = DevSpecIdToSymbol(_XINPUT_GAMEPAD_RIGHT_THUMB_RIGHT);
+			ProcessAnalogStick(pSymbolRight, m_state.Gamepad.sThumbRX, state.Gamepad.sThumbRX, 25000);
+		}
+		if ((m_state.Gamepad.sThumbRY != state.Gamepad.sThumbRY) || m_forceResendSticks)
+		{
+			pSymbol = DevSpecIdToSymbol(_XINPUT_GAMEPAD_RIGHT_THUMB_Y);
+			if (state.Gamepad.sThumbRY == 0.f)
+				pSymbol->ChangeEvent(0.f);
+			else
+				pSymbol->ChangeEvent((state.Gamepad.sThumbRY + 32768) / 32767.5f - 1.0f);
+			pSymbol->AssignTo(event);
+			event.deviceType = eIDT_Gamepad;
+			GetIInput().PostInputEvent(event);
+			//--- Check previous and current state to generate digital press/release event
+			static SInputSymbol* pSymbolUp = DevSpecIdToSymbol(_XINPUT_GAMEPAD_RIGHT_THUMB_UP);
+			ProcessAnalogStick(pSymbolUp, m_state.Gamepad.sThumbRY, state.Gamepad.sThumbRY, 25000);
+			static SInputSymbol* pSymbolDown = DevSpecIdToSymbol(_XINPUT_GAMEPAD_RIGHT_THUMB_DOWN);
+			ProcessAnalogStick(pSymbolDown, m_state.Gamepad.sThumbRY, state.Gamepad.sThumbRY, -25000);
+		}
+
+		// update cache
+		m_state = state;
+		m_forceResendSticks = false;
 	}
 }
 
@@ -636,6 +737,7 @@ void CXInputDevice::ProcessAnalogStick(SInputSymbol* pSymbol, SHORT prev, SHORT
 	{
 		SInputEvent event;
 		event.deviceIndex = (uint8)m_deviceNo;
+		event.timestamp = m_sampleTimestamp;
 		pSymbol->AssignTo(event);
 		event.deviceType = eIDT_Gamepad;
 		GetIInput().PostInputEvent(event);
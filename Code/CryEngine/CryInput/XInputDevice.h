@@ -41,6 +41,7 @@ public:
 
 private:
 	void UpdateConnectedState(bool isConnected);
+	void ProcessState(XINPUT_STATE state, int64 timestamp);
 	//void AddInputItem(const IInput::InputItem& item);
 
 	//triggers the speed of the vibration motors -> leftMotor is for low frequencies, the right one is for high frequencies
@@ -54,6 +55,7 @@ private:
 	bool             m_connected;
 	bool             m_forceResendSticks;
 	XINPUT_STATE     m_state;
+	int64            m_sampleTimestamp; //!< timestamp of the state being processed, for events posted from helpers
 	XINPUT_VIBRATION m_currentVibrationSettings;
 
 	float            m_basicLeftMotorRumble, m_basicRightMotorRumble;
@@ -40,6 +40,7 @@ void RegisterCommandClasses()
 	REGISTER_LIVECREATE_COMMAND(CLiveCreateCmd_EnableCameraSync);
 	REGISTER_LIVECREATE_COMMAND(CLiveCreateCmd_DisableCameraSync);
 	REGISTER_LIVECREATE_COMMAND(CLiveCreateCmd_SetEntityTransform);
+	REGISTER_LIVECREATE_COMMAND(CLiveCreateCmd_SetEntityTransformDelta);
 	REGISTER_LIVECREATE_COMMAND(CLiveCreateCmd_EntityUpdate);
 	REGISTER_LIVECREATE_COMMAND(CLiveCreateCmd_EntityDelete);
 	REGISTER_LIVECREATE_COMMAND(CLiveCreateCmd_SetCVar);
@@ -111,6 +111,35 @@ ILINE T& operator<<(T& stream, Matrix44& m)
 namespace LiveCreate
 {
 
+// Raw binary payload, serialized as a size followed by the bytes (strings are not binary safe)
+struct SBinaryBlob
+{
+	std::vector<uint8> m_data;
+
+	friend IDataWriteStream& operator<<(IDataWriteStream& stream, SBinaryBlob& blob)
+	{
+		const uint32 size = blob.m_data.size();
+		stream << size;
+		if (size > 0)
+		{
+			stream.Write(&blob.m_data[0], size);
+		}
+		return stream;
+	}
+
+	friend IDataReadStream& operator<<(IDataReadStream& stream, SBinaryBlob& blob)
+	{
+		uint32 size = 0;
+		stream << size;
+		blob.m_data.resize(size);
+		if (size > 0)
+		{
+			stream.Read(&blob.m_data[0], size);
+		}
+		return stream;
+	}
+};
+
 struct SFullSyncEntityHeader
 {
 	uint32 m_id;
@@ -143,7 +172,8 @@ public:
 	enum EFlags
 	{
 		eFlag_HasCRC = 1 << 0, // Valid CRC information is passed
-		eFlag_Light  = 1 << 1, // Object is a light
+		eFlag_Light      = 1 << 1, // Object is a light
+		eFlag_Compressed = 1 << 2, // Payload is zlib compressed
 	};
 
 	ILINE static IView* GetActiveView()
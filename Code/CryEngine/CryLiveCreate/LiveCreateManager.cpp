@@ -26,6 +26,18 @@ typedef IPlatformHandlerFactory* (* TCreatePlatformHandlerFactory)();
 
 //-----------------------------------------------------------------------------
 
+namespace
+{
+// Commands are matched by class name, the command object may come from a module with its own class instance
+template<class T>
+ILINE bool IsCommandOfClass(const IRemoteCommand& command)
+{
+	return 0 == strcmp(command.GetClass()->GetName(), T::GetStaticClass().GetName());
+}
+}
+
+//-----------------------------------------------------------------------------
+
 CHostInfo::CHostInfo(
 	class CManager* pManager,
 		IPlatformHandler* pPlatform,
@@ -311,6 +323,8 @@ CManager::CManager()
 	: m_pCommandDispatcher(NULL)
 	, m_bIsEnabled(false)
 	, m_bCanSend(false)
+	, m_remoteCameraPosition(ZERO)
+	, m_bHasRemoteCamera(false)
 {
 	// Create the remote command dispatched interface
 	m_pCommandDispatcher = gEnv->pRemoteCommandManager->CreateClient();
@@ -319,6 +333,14 @@ CManager::CManager()
 	// Logging CVar
 	m_pCVarLogEnabled = gEnv->pConsole->RegisterInt("lc_logEnabled", 0, VF_DEV_ONLY);
 
+	// Change batching CVars
+	m_pCVarBatchChanges = gEnv->pConsole->RegisterInt("lc_batchChanges", 1, VF_DEV_ONLY,
+	                                                  "Collect entity transform changes and send only the latest one per entity once per frame");
+	m_pCVarMaxTransformsPerFrame = gEnv->pConsole->RegisterInt("lc_maxTransformsPerFrame", 256, VF_DEV_ONLY,
+	                                                           "Maximum number of batched transform changes sent per frame, the ones closest to the remote camera go first (0 = unlimited)");
+	m_pCVarCompressMinSize = gEnv->pConsole->RegisterInt("lc_compressMinSize", 1024, VF_DEV_ONLY,
+	                                                     "Entity updates bigger than this (bytes) are compressed before sending (0 = never)");
+
 	// Load the additional handlers for platforms
 	LoadPlatformHandlerFactoryDLLs();
 }
@@ -363,6 +385,9 @@ CManager::~CManager()
 	}
 
 	SAFE_RELEASE(m_pCVarLogEnabled);
+	SAFE_RELEASE(m_pCVarBatchChanges);
+	SAFE_RELEASE(m_pCVarMaxTransformsPerFrame);
+	SAFE_RELEASE(m_pCVarCompressMinSize);
 }
 
 bool CManager::IsNullImplementation() const
@@ -627,6 +652,9 @@ void CManager::Update()
 		{
 			if (bIsReady)
 			{
+				// the host did not see the previous changes, do not send deltas against them
+				ResetSentState();
+
 				for (TListeners::const_iterator it = m_pListeners.begin();
 				     it != m_pListeners.end(); ++it)
 				{
@@ -670,6 +698,15 @@ void CManager::Update()
 		hostState.m_bIsReady = bIsReady;
 		m_lastHostStates[pHostInfo] = hostState;
 	}
+
+	// send the changes collected during the frame
+	if (CanSend())
+	{
+		CryAutoLock<CryMutex> pendingLock(m_pendingLock);
+
+		const int maxTransforms = m_pCVarMaxTransformsPerFrame->GetIVal();
+		FlushPendingTransforms((maxTransforms > 0) ? (uint)maxTransforms : ~0u);
+	}
 }
 
 void CManager::EvaluateSendingStatus()
@@ -697,6 +734,14 @@ void CManager::EvaluateSendingStatus()
 
 		m_bCanSend = bCanSend;
 
+		// Queued changes are meaningless once we stop sending
+		if (!m_bCanSend)
+		{
+			CryAutoLock<CryMutex> pendingLock(m_pendingLock);
+			m_pendingTransforms.clear();
+			m_sentTransforms.clear();
+		}
+
 		// Signal listeners
 		for (TListeners::const_iterator it = m_pListeners.begin();
 		     it != m_pListeners.end(); ++it)
@@ -765,14 +810,170 @@ void CManager::LogMessagef(ELogMessageType aType, const char* pMessage, ...)
 
 bool CManager::SendCommand(const IRemoteCommand& command)
 {
-	if (CanSend())
+	if (!CanSend())
 	{
-		return m_pCommandDispatcher->Schedule(command);
+		return false;
 	}
-	else
+
+	CryAutoLock<CryMutex> lock(m_pendingLock);
+
+	// Transform changes are coalesced per entity and sent from Update()
+	if (IsCommandOfClass<CLiveCreateCmd_SetEntityTransform>(command))
 	{
-		return false;
+		const CLiveCreateCmd_SetEntityTransform& cmd = static_cast<const CLiveCreateCmd_SetEntityTransform&>(command);
+
+		EntityTransform transform;
+		transform.m_flags = cmd.m_flags;
+		transform.m_position = cmd.m_position;
+		transform.m_rotation = cmd.m_rotation;
+		transform.m_scale = cmd.m_scale;
+
+		if (m_pCVarBatchChanges->GetIVal())
+		{
+			m_pendingTransforms[cmd.m_guid] = transform;
+		}
+		else
+		{
+			SendTransform(cmd.m_guid, transform);
+		}
+
+		return true;
+	}
+
+	// Any other command must be executed after the changes requested before it
+	FlushPendingTransforms(~0u);
+
+	if (IsCommandOfClass<CLiveCreateCmd_SetCameraPosition>(command))
+	{
+		m_remoteCameraPosition = static_cast<const CLiveCreateCmd_SetCameraPosition&>(command).m_position;
+		m_bHasRemoteCamera = true;
+	}
+	else if (IsCommandOfClass<CLiveCreateCmd_EntityDelete>(command))
+	{
+		m_sentTransforms.erase(static_cast<const CLiveCreateCmd_EntityDelete&>(command).m_guid);
+	}
+	else if (IsCommandOfClass<CLiveCreateCmd_EntityUpdate>(command))
+	{
+		const CLiveCreateCmd_EntityUpdate& cmd = static_cast<const CLiveCreateCmd_EntityUpdate&>(command);
+
+		// the entity is recreated from the data, next transform is sent in full
+		m_sentTransforms.erase(cmd.m_guid);
+
+		const int compressMinSize = m_pCVarCompressMinSize->GetIVal();
+		if ((compressMinSize > 0) && (cmd.m_data.length() >= (size_t)compressMinSize))
+		{
+			CLiveCreateCmd_EntityUpdate compressedCmd;
+			compressedCmd.m_guid = cmd.m_guid;
+			compressedCmd.m_flags = cmd.m_flags;
+			compressedCmd.m_data = cmd.m_data;
+			if (compressedCmd.Compress())
+			{
+				return m_pCommandDispatcher->Schedule(compressedCmd);
+			}
+		}
 	}
+
+	return m_pCommandDispatcher->Schedule(command);
+}
+
+void CManager::FlushPendingTransforms(const uint maxCount)
+{
+	if (m_pendingTransforms.empty())
+	{
+		return;
+	}
+
+	// order by the distance from the remote camera
+	typedef std::pair<float, TEntityTransforms::iterator> TPrioritizedTransform;
+	std::vector<TPrioritizedTransform> transforms;
+	transforms.reserve(m_pendingTransforms.size());
+
+	for (TEntityTransforms::iterator it = m_pendingTransforms.begin();
+	     it != m_pendingTransforms.end(); ++it)
+	{
+		const float distanceSq = m_bHasRemoteCamera ? it->second.m_position.GetSquaredDistance(m_remoteCameraPosition) : 0.0f;
+		transforms.push_back(TPrioritizedTransform(distanceSq, it));
+	}
+
+	const size_t count = std::min<size_t>(maxCount, transforms.size());
+	std::partial_sort(transforms.begin(), transforms.begin() + count, transforms.end(),
+	                  [](const TPrioritizedTransform& a, const TPrioritizedTransform& b) { return a.first < b.first; });
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		TEntityTransforms::iterator it = transforms[i].second;
+		SendTransform(it->first, it->second);
+		m_pendingTransforms.erase(it);
+	}
+
+	if (count < transforms.size())
+	{
+		LogMessagef(eLogType_Normal, "%u transform changes deferred to next frame", (uint)(transforms.size() - count));
+	}
+}
+
+void CManager::SendTransform(const EntityGUID& guid, const EntityTransform& transform)
+{
+	TEntityTransforms::iterator it = m_sentTransforms.find(guid);
+	if (it == m_sentTransforms.end())
+	{
+		// first change of this entity, send everything
+		CLiveCreateCmd_SetEntityTransform cmd;
+		cmd.m_guid = guid;
+		cmd.m_flags = transform.m_flags;
+		cmd.m_position = transform.m_position;
+		cmd.m_rotation = transform.m_rotation;
+		cmd.m_scale = transform.m_scale;
+
+		if (m_pCommandDispatcher->Schedule(cmd))
+		{
+			m_sentTransforms[guid] = transform;
+		}
+
+		return;
+	}
+
+	EntityTransform& sentTransform = it->second;
+
+	CLiveCreateCmd_SetEntityTransformDelta cmd;
+	cmd.m_guid = guid;
+	cmd.m_flags = transform.m_flags;
+	cmd.m_components = 0;
+	cmd.m_position = transform.m_position;
+	cmd.m_rotation = transform.m_rotation;
+	cmd.m_scale = transform.m_scale;
+
+	if (transform.m_position != sentTransform.m_position)
+	{
+		cmd.m_components |= CLiveCreateCmd_SetEntityTransformDelta::eComponent_Position;
+	}
+
+	if ((transform.m_rotation.v != sentTransform.m_rotation.v) || (transform.m_rotation.w != sentTransform.m_rotation.w))
+	{
+		cmd.m_components |= CLiveCreateCmd_SetEntityTransformDelta::eComponent_Rotation;
+	}
+
+	if (transform.m_scale != sentTransform.m_scale)
+	{
+		cmd.m_components |= CLiveCreateCmd_SetEntityTransformDelta::eComponent_Scale;
+	}
+
+	// nothing changed since the last one sent
+	if ((0 == cmd.m_components) && (transform.m_flags == sentTransform.m_flags))
+	{
+		return;
+	}
+
+	if (m_pCommandDispatcher->Schedule(cmd))
+	{
+		sentTransform = transform;
+	}
+}
+
+void CManager::ResetSentState()
+{
+	CryAutoLock<CryMutex> lock(m_pendingLock);
+	m_sentTransforms.clear();
 }
 
 }
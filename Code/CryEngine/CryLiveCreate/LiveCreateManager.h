@@ -5,6 +5,7 @@
 
 #include <CryLiveCreate/ILiveCreateManager.h>
 #include <CryNetwork/IRemoteCommand.h>
+#include <CryEntitySystem/IEntityBasicTypes.h>
 
 struct IPlatformHandler;
 struct IPlatformHandlerFactory;
@@ -118,6 +119,15 @@ protected:
 		bool m_bIsConnected;
 	};
 
+	// Entity transform as last requested by the editor (or last sent to the hosts)
+	struct EntityTransform
+	{
+		uint32 m_flags;
+		Vec3   m_position;
+		Quat   m_rotation;
+		Vec3   m_scale;
+	};
+
 protected:
 	// Remote command dispatched
 	IRemoteCommandClient* m_pCommandDispatcher;
@@ -125,6 +135,11 @@ protected:
 	// Logging
 	ICVar* m_pCVarLogEnabled;
 
+	// Change batching
+	ICVar* m_pCVarBatchChanges;
+	ICVar* m_pCVarMaxTransformsPerFrame;
+	ICVar* m_pCVarCompressMinSize;
+
 	// Manager wide flags
 	bool m_bIsEnabled;
 	bool m_bCanSend;
@@ -147,6 +162,19 @@ protected:
 	typedef std::map<CHostInfo*, LastHostState> TLastHostStateCache;
 	TLastHostStateCache m_lastHostStates;
 
+	// Transform changes collected during the frame, only the latest one per entity is kept.
+	// Sent from Update(), closest to the remote camera first.
+	typedef std::map<EntityGUID, EntityTransform> TEntityTransforms;
+	TEntityTransforms m_pendingTransforms;
+
+	// Transforms already sent to the hosts, base for the delta encoding
+	TEntityTransforms m_sentTransforms;
+	CryMutex          m_pendingLock;
+
+	// Last camera position sent to the hosts, used to prioritize the changes
+	Vec3 m_remoteCameraPosition;
+	bool m_bHasRemoteCamera;
+
 public:
 	ILINE IRemoteCommandClient* GetCommandDispatcher() const
 	{
@@ -188,6 +216,15 @@ private:
 
 	// Reevaluate the sending conditions
 	void EvaluateSendingStatus();
+
+	// Send up to maxCount of the pending transforms, the rest stays queued for the next frame
+	void FlushPendingTransforms(const uint maxCount);
+
+	// Send a transform change as a delta against the last one sent for the entity
+	void SendTransform(const EntityGUID& guid, const EntityTransform& transform);
+
+	// Forget everything that was sent, next updates are sent in full
+	void ResetSentState();
 };
 
 //-----------------------------------------------------------------------------
@@ -16,6 +16,7 @@ namespace LiveCreate
 {
 
 IMPLEMENT_LIVECREATE_COMMAND(CLiveCreateCmd_SetEntityTransform);
+IMPLEMENT_LIVECREATE_COMMAND(CLiveCreateCmd_SetEntityTransformDelta);
 IMPLEMENT_LIVECREATE_COMMAND(CLiveCreateCmd_EntityUpdate);
 IMPLEMENT_LIVECREATE_COMMAND(CLiveCreateCmd_EntityDelete);
 IMPLEMENT_LIVECREATE_COMMAND(CLiveCreateCmd_ObjectAreaUpdate);
@@ -63,8 +64,116 @@ void CLiveCreateCmd_SetEntityTransform::Execute()
 	}
 }
 
+void CLiveCreateCmd_SetEntityTransformDelta::Execute()
+{
+	IEntity* pEntity = gEnv->pEntitySystem->GetEntity(gEnv->pEntitySystem->FindEntityByGuid(m_guid));
+	if (NULL != pEntity)
+	{
+		if (bIsCameraSyncEnabled)
+		{
+			pEntity->SetFlags(ENTITY_FLAG_IGNORE_PHYSICS_UPDATE);
+		}
+
+		// components that were not sent keep their current value
+		int xformFlags = ENTITY_XFORM_EDITOR;
+		Vec3 position = pEntity->GetPos();
+		Quat rotation = pEntity->GetRotation();
+		Vec3 scale = pEntity->GetScale();
+
+		if (m_components & eComponent_Position)
+		{
+			position = m_position;
+			xformFlags |= ENTITY_XFORM_POS;
+		}
+
+		if (m_components & eComponent_Rotation)
+		{
+			rotation = m_rotation;
+			xformFlags |= ENTITY_XFORM_ROT;
+		}
+
+		if (m_components & eComponent_Scale)
+		{
+			scale = m_scale;
+			xformFlags |= ENTITY_XFORM_SCL;
+		}
+
+		pEntity->SetPosRotScale(position, rotation, scale, xformFlags);
+	}
+
+	// a light, only the position is used by the cheap light proxy
+	if ((0 != (m_flags & eFlag_Light)) && (0 != (m_components & eComponent_Position)))
+	{
+		ILightSource* pLight = FindLightSource(m_guid);
+		if (NULL != pLight)
+		{
+			Matrix34 localTransform;
+			localTransform.SetIdentity();
+			localTransform.SetTranslation(m_position);
+			pLight->SetMatrix(localTransform);
+		}
+	}
+}
+
+bool CLiveCreateCmd_EntityUpdate::Compress()
+{
+	if (m_flags & eFlag_Compressed)
+	{
+		return true;
+	}
+
+	const size_t dataSize = m_data.length();
+	if (dataSize == 0)
+	{
+		return false;
+	}
+
+	// deflate can grow incompressible data, such a payload is sent as it is
+	size_t compressedSize = dataSize;
+	m_compressedData.m_data.resize(compressedSize);
+	if (!gEnv->pSystem->CompressDataBlock(m_data.c_str(), dataSize, &m_compressedData.m_data[0], compressedSize) || compressedSize >= dataSize)
+	{
+		stl::free_container(m_compressedData.m_data);
+		return false;
+	}
+
+	m_compressedData.m_data.resize(compressedSize);
+	m_uncompressedSize = (uint32)dataSize;
+	m_flags |= eFlag_Compressed;
+	m_data.clear();
+	return true;
+}
+
+bool CLiveCreateCmd_EntityUpdate::Decompress()
+{
+	if (0 == (m_flags & eFlag_Compressed))
+	{
+		return true;
+	}
+
+	std::vector<char> buffer;
+	buffer.resize(m_uncompressedSize + 1, 0);
+
+	size_t dataSize = m_uncompressedSize;
+	if (m_compressedData.m_data.empty() || !gEnv->pSystem->DecompressDataBlock(&m_compressedData.m_data[0], m_compressedData.m_data.size(), &buffer[0], dataSize) || dataSize != m_uncompressedSize)
+	{
+		return false;
+	}
+
+	m_data.assign(&buffer[0], dataSize);
+	stl::free_container(m_compressedData.m_data);
+	m_flags &= ~eFlag_Compressed;
+	return true;
+}
+
 void CLiveCreateCmd_EntityUpdate::Execute()
 {
+	if (!Decompress())
+	{
+		gEnv->pLog->LogWarning("LiveCreate: Failed to decompress entity update (%u bytes)", m_uncompressedSize);
+		return;
+	}
+
 	// deserialize xml data
 	XmlNodeRef xml = gEnv->pSystem->LoadXmlFromBuffer(m_data.c_str(), m_data.length());
 	if (NULL != xml)
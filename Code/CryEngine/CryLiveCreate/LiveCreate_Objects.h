@@ -42,14 +42,25 @@ public:
 
 //-----------------------------------------------------------------------------
 
-class CLiveCreateCmd_EntityUpdate : public ILiveCreateCommand
+// Transform update carrying only the components that changed since the last one sent
+class CLiveCreateCmd_SetEntityTransformDelta : public ILiveCreateCommand
 {
-	DECLARE_REMOTE_COMMAND(CLiveCreateCmd_EntityUpdate);
+	DECLARE_REMOTE_COMMAND(CLiveCreateCmd_SetEntityTransformDelta);
 
 public:
+	enum EComponent
+	{
+		eComponent_Position = 1 << 0,
+		eComponent_Rotation = 1 << 1,
+		eComponent_Scale    = 1 << 2,
+	};
+
 	EntityGUID m_guid;
 	uint32     m_flags;
-	string     m_data;
+	uint8      m_components;
+	Vec3       m_position;
+	Quat       m_rotation;
+	Vec3       m_scale;
 
 public:
 	template<class T>
@@ -57,9 +68,71 @@ public:
 	{
 		stream << m_guid;
 		stream << m_flags;
-		stream << m_data;
+		stream << m_components;
+
+		if (m_components & eComponent_Position)
+		{
+			stream << m_position;
+		}
+
+		if (m_components & eComponent_Rotation)
+		{
+			stream << m_rotation;
+		}
+
+		if (m_components & eComponent_Scale)
+		{
+			stream << m_scale;
+		}
+	}
+
+	virtual void Execute() LC_COMMAND;
+};
+
+//-----------------------------------------------------------------------------
+
+class CLiveCreateCmd_EntityUpdate : public ILiveCreateCommand
+{
+	DECLARE_REMOTE_COMMAND(CLiveCreateCmd_EntityUpdate);
+
+public:
+	EntityGUID  m_guid;
+	uint32      m_flags;
+	string      m_data;
+
+	// Valid only with eFlag_Compressed, m_data is not sent in that case
+	uint32      m_uncompressedSize;
+	SBinaryBlob m_compressedData;
+
+public:
+	CLiveCreateCmd_EntityUpdate()
+		: m_flags(0)
+		, m_uncompressedSize(0)
+	{}
+
+	template<class T>
+	void Serialize(T& stream)
+	{
+		stream << m_guid;
+		stream << m_flags;
+
+		if (m_flags & eFlag_Compressed)
+		{
+			stream << m_uncompressedSize;
+			stream << m_compressedData;
+		}
+		else
+		{
+			stream << m_data;
+		}
 	}
 
+	// Replace m_data with its compressed version, fails if that would not make it smaller
+	bool Compress();
+
+	// Restore m_data from the compressed payload
+	bool Decompress();
+
 	virtual void Execute() LC_COMMAND;
 };
 
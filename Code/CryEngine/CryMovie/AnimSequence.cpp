@@ -21,8 +21,18 @@
 #include "AnimEnvironmentNode.h"
 #include "AudioNode.h"
 
+#include "Movie.h"
+
 #include <Cry3DEngine/I3DEngine.h>
 #include <CryScriptSystem/IScriptSystem.h>
+#include <CryThreading/IJobManager_JobDelegator.h>
+
+DECLARE_JOB("MovieEvaluateTracks", TMovieEvaluateTracksJob, CAnimSequence::EvaluateTracks_JobEntry);
+
+namespace
+{
+const uint32 kNodesPerEvaluateTracksJob = 16;
+}
 
 CAnimSequence::CAnimSequence(IMovieSystem* pMovieSystem, uint32 id)
 {
@@ -473,6 +483,8 @@ void CAnimSequence::Animate(const SAnimContext& animContext)
 		m_pActiveDirector->Animate(animContextCopy);
 	}
 
+	m_nodesToAnimate.clear();
+
 	for (AnimNodes::iterator it = m_nodes.begin(); it != m_nodes.end(); ++it)
 	{
 		// Make sure correct animation block is binded to node.
@@ -497,11 +509,72 @@ void CAnimSequence::Animate(const SAnimContext& animContext)
 			continue;
 		}
 
+		m_nodesToAnimate.push_back(pAnimNode);
+	}
+
+	// Sample the spline tracks in parallel first, the nodes then pick up the cached values when they
+	// apply them to entities, lights and parameters serially.
+	const uint32 numNodes = static_cast<uint32>(m_nodesToAnimate.size());
+
+	if (CMovieSystem::m_mov_parallelTrackEvaluation && numNodes > kNodesPerEvaluateTracksJob)
+	{
+		JobManager::SJobState jobState;
+
+		for (uint32 i = kNodesPerEvaluateTracksJob; i < numNodes; i += kNodesPerEvaluateTracksJob)
+		{
+			TMovieEvaluateTracksJob job(&m_nodesToAnimate[i], min(kNodesPerEvaluateTracksJob, numNodes - i), animContextCopy.time);
+			job.SetClassInstance(this);
+			job.RegisterJobState(&jobState);
+			job.Run();
+		}
+
+		EvaluateTracks(&m_nodesToAnimate[0], kNodesPerEvaluateTracksJob, animContextCopy.time);
+		gEnv->pJobManager->WaitForJob(jobState);
+	}
+
+	for (IAnimNode* pAnimNode : m_nodesToAnimate)
+	{
 		// Animate node.
 		pAnimNode->Animate(animContextCopy);
 	}
 }
 
+void CAnimSequence::EvaluateTracks_JobEntry(IAnimNode** ppNodes, uint32 numNodes, SAnimTime time)
+{
+	EvaluateTracks(ppNodes, numNodes, time);
+}
+
+void CAnimSequence::EvaluateTracks(IAnimNode* const* ppNodes, uint32 numNodes, SAnimTime time)
+{
+	for (uint32 i = 0; i < numNodes; ++i)
+	{
+		IAnimNode* pAnimNode = ppNodes[i];
+		const int numTracks = pAnimNode->GetTrackCount();
+
+		for (int trackIndex = 0; trackIndex < numTracks; ++trackIndex)
+		{
+			IAnimTrack* pTrack = pAnimNode->GetTrackByIndex(trackIndex);
+
+			// Only spline based tracks are pure functions of their keys, sampling them fills their value cache.
+			switch (pTrack->GetValueType())
+			{
+			case eAnimValue_Float:
+			case eAnimValue_Vector:
+			case eAnimValue_Vector4:
+			case eAnimValue_Quat:
+			case eAnimValue_RGB:
+				if (!(pTrack->GetFlags() & IAnimTrack::eAnimTrackFlags_Disabled))
+				{
+					pTrack->GetValue(time);
+				}
+				break;
+			default:
+				break;
+			}
+		}
+	}
+}
+
 void CAnimSequence::Render()
 {
 	for (AnimNodes::iterator it = m_nodesNeedToRender.begin(); it != m_nodesNeedToRender.end(); ++it)
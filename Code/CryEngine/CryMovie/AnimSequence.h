@@ -104,8 +104,11 @@ public:
 	virtual void                         SetAudioTrigger(const SSequenceAudioTrigger& audioTrigger) override { m_audioTrigger = audioTrigger; }
 	virtual const SSequenceAudioTrigger& GetAudioTrigger() const override                                    { return m_audioTrigger; }
 
+	void EvaluateTracks_JobEntry(IAnimNode** ppNodes, uint32 numNodes, SAnimTime time);
+
 private:
 	void ComputeTimeRange();
+	void EvaluateTracks(IAnimNode* const* ppNodes, uint32 numNodes, SAnimTime time);
 	void NotifyTrackEvent(ITrackEventListener::ETrackEventReason reason,
 	                      const char* event, const char* param = NULL);
 
@@ -120,6 +123,7 @@ private:
 	typedef std::vector<_smart_ptr<IAnimNode>> AnimNodes;
 	AnimNodes         m_nodes;
 	AnimNodes         m_nodesNeedToRender;
+	std::vector<IAnimNode*> m_nodesToAnimate;
 
 	CryGUID           m_guid;
 	uint32            m_id;
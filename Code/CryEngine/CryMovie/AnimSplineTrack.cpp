@@ -8,6 +8,8 @@
 CAnimSplineTrack::CAnimSplineTrack(const CAnimParamType& paramType)
 	: m_paramType(paramType)
 	, m_defaultValue(ZERO)
+	, m_cachedValue(0.0f)
+	, m_bCachedValueValid(false)
 {
 }
 
@@ -27,8 +29,49 @@ TMovieSystemValue CAnimSplineTrack::GetValue(SAnimTime time) const
 	}
 	else
 	{
-		return SampleCurve(time);
+		if (!m_bCachedValueValid || m_cachedTime != time)
+		{
+			m_cachedValue = SampleCurve(time);
+			m_cachedTime = time;
+			m_bCachedValueValid = true;
+		}
+
+		return m_cachedValue;
+	}
+}
+
+void CAnimSplineTrack::RemoveKey(int index)
+{
+	InvalidateCachedValue();
+	TAnimTrack<S2DBezierKey>::RemoveKey(index);
+}
+
+void CAnimSplineTrack::ClearKeys()
+{
+	InvalidateCachedValue();
+	TAnimTrack<S2DBezierKey>::ClearKeys();
+}
+
+int CAnimSplineTrack::CreateKey(SAnimTime time)
+{
+	InvalidateCachedValue();
+	return TAnimTrack<S2DBezierKey>::CreateKey(time);
+}
+
+void CAnimSplineTrack::SetKey(int index, const STrackKey* key)
+{
+	InvalidateCachedValue();
+	TAnimTrack<S2DBezierKey>::SetKey(index, key);
+}
+
+bool CAnimSplineTrack::SerializeKeys(XmlNodeRef& xmlNode, bool bLoading, std::vector<SAnimTime>& keys, const SAnimTime time)
+{
+	if (bLoading)
+	{
+		InvalidateCachedValue();
 	}
+
+	return TAnimTrack<S2DBezierKey>::SerializeKeys(xmlNode, bLoading, keys, time);
 }
 
 TMovieSystemValue CAnimSplineTrack::GetDefaultValue() const
@@ -51,6 +94,7 @@ bool CAnimSplineTrack::Serialize(XmlNodeRef& xmlNode, bool bLoading, bool bLoadE
 
 	if (bLoading)
 	{
+		InvalidateCachedValue();
 		xmlNode->getAttr("defaultValue", m_defaultValue);
 	}
 	else
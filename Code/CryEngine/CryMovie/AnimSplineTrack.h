@@ -24,14 +24,26 @@ public:
 	virtual TMovieSystemValue GetDefaultValue() const override;
 	virtual void              SetDefaultValue(const TMovieSystemValue& value) override;
 
+	virtual void              RemoveKey(int index) override;
+	virtual void              ClearKeys() override;
+	virtual int               CreateKey(SAnimTime time) override;
+	virtual void              SetKey(int index, const STrackKey* key) override;
+
 	virtual bool              Serialize(XmlNodeRef& xmlNode, bool bLoading, bool bLoadEmptyTracks) override;
+	virtual bool              SerializeKeys(XmlNodeRef& xmlNode, bool bLoading, std::vector<SAnimTime>& keys, const SAnimTime time = SAnimTime(0)) override;
 	virtual void              SerializeKey(S2DBezierKey& key, XmlNodeRef& keyNode, bool bLoading) override;
 
 private:
 	float SampleCurve(SAnimTime time) const;
+	void  InvalidateCachedValue() { m_bCachedValueValid = false; }
 
 	Vec2 m_defaultValue;
 
+	//! Last sampled value, reused while the time and the keys stay the same (e.g. paused or fixed time step sequences).
+	mutable SAnimTime m_cachedTime;
+	mutable float     m_cachedValue;
+	mutable bool      m_bCachedValueValid;
+
 	//! Keys of float track.
 	CAnimParamType m_paramType;
 };
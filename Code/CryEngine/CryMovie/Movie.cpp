@@ -37,6 +37,7 @@
 
 int CMovieSystem::m_mov_NoCutscenes = 0;
 float CMovieSystem::m_mov_cameraPrecacheTime = 1.f;
+int CMovieSystem::m_mov_parallelTrackEvaluation = 1;
 #if !defined(_RELEASE)
 int CMovieSystem::m_mov_debugCamShake = 0;
 int CMovieSystem::m_mov_debugSequences = 0;
@@ -229,6 +230,7 @@ CMovieSystem::CMovieSystem(ISystem* pSystem)
 
 	REGISTER_CVAR2("mov_NoCutscenes", &m_mov_NoCutscenes, 0, 0, "Disable playing of Cut-Scenes");
 	REGISTER_CVAR2("mov_cameraPrecacheTime", &m_mov_cameraPrecacheTime, 1.f, VF_NULL, "");
+	REGISTER_CVAR2("mov_parallelTrackEvaluation", &m_mov_parallelTrackEvaluation, 1, VF_NULL, "Sample the spline tracks of playing sequences in parallel jobs before the nodes are animated");
 #if !defined(_RELEASE)
 	REGISTER_CVAR2("mov_debugSequences", &m_mov_debugSequences, 0, VF_NULL, "Sequence debug info (0 = off, 1 = only active sequences, 2 = all sequences, 3 = detailed node-in-use info per sequence");
 #endif
@@ -250,6 +252,7 @@ CMovieSystem::~CMovieSystem()
 	{
 		pConsole->UnregisterVariable("mov_NoCutscenes");
 		pConsole->UnregisterVariable("mov_cameraPrecacheTime");
+		pConsole->UnregisterVariable("mov_parallelTrackEvaluation");
 #if !defined(_RELEASE)
 		pConsole->UnregisterVariable("mov_debugSequences");
 #endif
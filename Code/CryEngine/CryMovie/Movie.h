@@ -247,6 +247,7 @@ private:
 
 public:
 	static float m_mov_cameraPrecacheTime;
+	static int   m_mov_parallelTrackEvaluation;
 #if !defined(_RELEASE)
 	static int   m_mov_debugCamShake;
 	static int   m_mov_debugSequences;
@@ -207,6 +207,50 @@ CRY_UNIT_TEST_SUITE(NetCompression)
 		}
 	}
 
+	CRY_UNIT_BENCHMARK(BM_BoolCompress2WriteRead)
+	{
+		uint8 buffer[512];
+		CBoolCompress2 pol;
+		CBoolCompress2::TMemento m;
+		pol.InitMemento(m);
+	#if USE_ARITHSTREAM
+		CCommOutputStream out(buffer, sizeof(buffer));
+		for (int i = 0; i < 1024; i++)
+		{
+			const bool value = (i % 7) < 5;
+			pol.WriteValue(m, out, value);
+			pol.UpdateMemento(m, value);
+		}
+		const size_t len = out.Flush();
+		CCommInputStream in(buffer, len);
+		pol.InitMemento(m);
+		for (int i = 0; i < 1024; i++)
+		{
+			bool value;
+			pol.ReadValue(m, in, value);
+			pol.UpdateMemento(m, value);
+		}
+	#else
+		CNetOutputSerializeImpl out(buffer, sizeof(buffer));
+		for (int i = 0; i < 1024; i++)
+		{
+			const bool value = (i % 7) < 5;
+			pol.WriteValue(m, &out, value);
+			pol.UpdateMemento(m, value);
+		}
+		const size_t len = out.Flush();
+		CNetInputSerializeImpl in(buffer, len);
+		pol.InitMemento(m);
+		for (int i = 0; i < 1024; i++)
+		{
+			bool value;
+			pol.ReadValue(m, &in, value);
+			pol.UpdateMemento(m, value);
+		}
+	#endif
+		CRY_UNIT_BENCHMARK_KEEP(m);
+	}
+
 }
 
 #endif
@@ -77,7 +77,13 @@ bool CContextEstablisher::StepTo(SContextEstablishState& state)
 #ifndef _RELEASE
 		m_tasks[m_offset].numRuns++;
 #endif
-		switch (m_tasks[m_offset].pTask->OnStep(state))
+		EContextEstablishTaskResult result;
+		{
+			// Report each establishment step to the loading profiler so level loads can be broken down per task.
+			LOADING_TIME_PROFILE_SECTION_NAMED_ARGS("CContextEstablisher::StepTo", m_tasks[m_offset].pTask->GetName());
+			result = m_tasks[m_offset].pTask->OnStep(state);
+		}
+		switch (result)
 		{
 		case eCETR_Ok:
 #ifndef _RELEASE
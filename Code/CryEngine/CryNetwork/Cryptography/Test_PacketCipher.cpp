@@ -0,0 +1,125 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "StdAfx.h"
+#include "rijndael.h"
+#include <CrySystem/CryUnitTest.h>
+
+#if defined(CRY_UNIT_TESTING)
+
+CRY_UNIT_TEST_SUITE(PacketCipher)
+{
+	enum
+	{
+		kPacketSize  = 1024, // a full CTP packet, padded to the cipher block size
+		kPacketCount = 64,
+	};
+
+	// deterministic byte
+	uint8 HashByte(uint32 n)
+	{
+		n = (n ^ 61) ^ (n >> 16);
+		n *= 9;
+		n ^= n >> 4;
+		n *= 0x27d4eb2d;
+		n ^= n >> 15;
+		return uint8(n >> 8);
+	}
+
+	// the ciphers of one channel direction, keyed like SBigEndpointState::SetupEncryption does it
+	struct SPacketCipher
+	{
+		SPacketCipher()
+			: packets(kPacketCount * kPacketSize)
+		{
+			uint8 key[32], initVec[16];
+			for (uint i = 0; i < CRY_ARRAY_COUNT(key); ++i)
+				key[i] = HashByte(i);
+			for (uint i = 0; i < CRY_ARRAY_COUNT(initVec); ++i)
+				initVec[i] = HashByte(i + 100);
+			encrypt.init(Rijndael::CBC, Rijndael::Encrypt, key, Rijndael::Key32Bytes, initVec);
+			decrypt.init(Rijndael::CBC, Rijndael::Decrypt, key, Rijndael::Key32Bytes, initVec);
+
+			for (size_t i = 0; i < packets.size(); ++i)
+				packets[i] = HashByte(uint32(i) + 1000);
+		}
+
+		uint8* GetPacket(int i) { return &packets[i * kPacketSize]; }
+
+		// the way the endpoint ciphered packets before: into a temporary buffer and copied back
+		void EncryptCopy(uint8* pBuf, size_t len)
+		{
+			uint8* buf = (uint8*)alloca(len);
+			encrypt.blockEncrypt(pBuf, len * 8, buf);
+			memcpy(pBuf, buf, len);
+		}
+		void DecryptCopy(uint8* pBuf, size_t len)
+		{
+			uint8* buf = (uint8*)alloca(len);
+			decrypt.blockDecrypt(pBuf, len * 8, buf);
+			memcpy(pBuf, buf, len);
+		}
+
+		Rijndael           encrypt;
+		Rijndael           decrypt;
+		std::vector<uint8> packets;
+	};
+
+	CRY_UNIT_TEST(CUT_PacketCipherInPlaceMatchesCopy)
+	{
+		SPacketCipher cipher;
+		const std::vector<uint8> plain = cipher.packets;
+
+		// sizes from a single block up to a full packet
+		const size_t sizes[] = { 16, 32, 48, 272, kPacketSize };
+		for (uint i = 0; i < CRY_ARRAY_COUNT(sizes); ++i)
+		{
+			uint8* pPacket = cipher.GetPacket(i);
+			std::vector<uint8> copied(pPacket, pPacket + sizes[i]);
+
+			cipher.EncryptCopy(&copied[0], sizes[i]);
+			cipher.encrypt.blockEncrypt(pPacket, int(sizes[i] * 8), pPacket);
+			CRY_UNIT_TEST_ASSERT(memcmp(pPacket, &copied[0], sizes[i]) == 0);
+			CRY_UNIT_TEST_ASSERT(memcmp(pPacket, &plain[i * kPacketSize], sizes[i]) != 0);
+
+			cipher.DecryptCopy(&copied[0], sizes[i]);
+			cipher.decrypt.blockDecrypt(pPacket, int(sizes[i] * 8), pPacket);
+			CRY_UNIT_TEST_ASSERT(memcmp(pPacket, &copied[0], sizes[i]) == 0);
+			CRY_UNIT_TEST_ASSERT(memcmp(pPacket, &plain[i * kPacketSize], sizes[i]) == 0);
+		}
+	}
+
+	// Encrypting and decrypting a burst of full packets, with and without the copy through a temporary buffer.
+	// The copy variants move one packet size more per packet and direction.
+	struct SPacketCipherBenchmark : public CryUnitTest::SBenchmark
+	{
+		SPacketCipherBenchmark() : m_pCipher(nullptr) {}
+
+		virtual void Init() override { m_pCipher = new SPacketCipher(); }
+		virtual void Done() override { SAFE_DELETE(m_pCipher); }
+
+		SPacketCipher* m_pCipher;
+	};
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_PacketCipherCopy, SPacketCipherBenchmark)
+	{
+		for (int i = 0; i < kPacketCount; ++i)
+		{
+			m_pCipher->EncryptCopy(m_pCipher->GetPacket(i), kPacketSize);
+			m_pCipher->DecryptCopy(m_pCipher->GetPacket(i), kPacketSize);
+		}
+		CRY_UNIT_BENCHMARK_KEEP(m_pCipher->packets[0]);
+	}
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_PacketCipherInPlace, SPacketCipherBenchmark)
+	{
+		for (int i = 0; i < kPacketCount; ++i)
+		{
+			uint8* pPacket = m_pCipher->GetPacket(i);
+			m_pCipher->encrypt.blockEncrypt(pPacket, kPacketSize * 8, pPacket);
+			m_pCipher->decrypt.blockDecrypt(pPacket, kPacketSize * 8, pPacket);
+		}
+		CRY_UNIT_BENCHMARK_KEEP(m_pCipher->packets[0]);
+	}
+}
+
+#endif // CRY_UNIT_TESTING
@@ -129,6 +129,7 @@ public:
 	// so it actually encrypts inputLen / 128 blocks of input and puts it in outBuffer
 	// Input len is in BITS!
 	// outBuffer must be at least inputLen / 8 bytes long.
+	// In ECB and CBC mode outBuffer may be the input array.
 	// Returns the encrypted buffer length in BITS or an error code < 0 in case of error
 	int blockEncrypt(const UINT8* input, int inputLen, UINT8* outBuffer);
 	// Encrypts the input array (can be binary data)
@@ -140,6 +141,7 @@ public:
 	// Decrypts the input vector
 	// Input len is in BITS!
 	// outBuffer must be at least inputLen / 8 bytes long
+	// In ECB and CBC mode outBuffer may be the input array.
 	// Returns the decrypted buffer length in BITS and an error code < 0 in case of error
 	int blockDecrypt(const UINT8* input, int inputLen, UINT8* outBuffer);
 	// Decrypts the input vector
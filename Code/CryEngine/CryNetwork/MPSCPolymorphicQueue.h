@@ -0,0 +1,234 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#ifndef __MPSCPOLYMORPHICQUEUE_H__
+#define __MPSCPOLYMORPHICQUEUE_H__
+
+#pragma once
+
+#include "PolymorphicQueue.h"
+#include <CryThreading/CryAtomics.h>
+
+// bounded multi-producer/single-consumer variant of CPolymorphicQueue
+// producers reserve space in a fixed ring buffer with a CAS on the write cursor, construct the item in place
+// and publish it by writing its header word, so adding never takes a lock or allocates
+// the consumer executes items in place in FIFO order and stops at the first item that is still being written
+// if the ring is full, items go into a locked CPolymorphicQueue overflow until the consumer drained it,
+// this keeps the per producer order and means Add never fails
+template<class B>
+class CMPSCPolymorphicQueue
+{
+public:
+	CMPSCPolymorphicQueue();
+	~CMPSCPolymorphicQueue();
+
+	template<class T>
+	void Add(const T& value) { Emplace<T>(value); }
+	// constructs the item in place, it must be fully initialized by its constructor as the consumer may run it right away
+	template<class T, class ... Args>
+	void Emplace(Args&& ... args);
+
+	// consumer thread only
+	template<class F>
+	void Flush(F& f);
+	template<class F>
+	void RealtimeFlush(F& f);
+
+	bool Empty();
+	void GetMemoryStatistics(ICrySizer* pSizer, bool countingThis = false);
+
+private:
+	typedef INT_PTR TWord;
+	static const size_t WORD_SIZE = sizeof(TWord);
+
+	enum
+	{
+		eNumWords       = (256 * 1024) / WORD_SIZE, // must be a power of two
+		eHeader_Written = BIT(0),                   // header is 0 while the item is reserved but not constructed yet
+		eHeader_Skip    = BIT(1),                   // padding up to the end of the ring, no item
+		eHeader_Shift   = 2,                        // header >> eHeader_Shift = size in words including the header
+	};
+
+	template<class T, class ... Args>
+	bool TryEmplace(Args&& ... args);
+	// returns false if the consumer stopped at an item which is still being written
+	template<class F>
+	bool FlushRing(F& f);
+	template<class F>
+	void FlushOverflow(F& f);
+
+	ILINE int64 ReadCursor(const int64& cursor) const { return *const_cast<volatile int64*>(&cursor); }
+
+	CRY_ALIGN(128) int64 m_nWrite;         // reserved words, only increased by producers via CAS
+	CRY_ALIGN(128) int64 m_nRead;          // consumed words, only written by the consumer
+	TWord*               m_pData;
+
+	volatile bool                  m_bOverflow;     // set while m_overflow holds items, producers then bypass the ring
+	CryCriticalSectionNonRecursive m_overflowLock;
+	CPolymorphicQueue<B>           m_overflow;      // protected by m_overflowLock
+	CPolymorphicQueue<B>           m_overflowFlush; // consumer only, items swapped out of m_overflow
+};
+
+template<class B>
+CMPSCPolymorphicQueue<B>::CMPSCPolymorphicQueue()
+	: m_nWrite(0)
+	, m_nRead(0)
+	, m_bOverflow(false)
+{
+	STATIC_CHECK(IsPowerOfTwoCompileTime<eNumWords>::IsPowerOfTwo, MPSC_POLYMORPHIC_QUEUE_SIZE_IS_NOT_POWER_OF_TWO);
+	m_pData = static_cast<TWord*>(CryModuleMemalign(eNumWords * WORD_SIZE, 128));
+	memset(m_pData, 0, eNumWords * WORD_SIZE);
+}
+
+template<class B>
+CMPSCPolymorphicQueue<B>::~CMPSCPolymorphicQueue()
+{
+	struct DoNothing
+	{
+		ILINE void operator()(B* p) {}
+	} f;
+	Flush(f);
+	NET_ASSERT(Empty());
+	CryModuleMemalignFree(m_pData);
+}
+
+template<class B> template<class T, class ... Args>
+void CMPSCPolymorphicQueue<B >::Emplace(Args&& ... args)
+{
+	if (!m_bOverflow && TryEmplace<T>(std::forward<Args>(args) ...))
+		return;
+
+	// the ring is full (or was recently): once an item went to the overflow, all following ones have to as well,
+	// or the consumer could run them before the overflowed ones
+	CryAutoLock<CryCriticalSectionNonRecursive> lock(m_overflowLock);
+	if (m_bOverflow || !TryEmplace<T>(std::forward<Args>(args) ...))
+	{
+		m_overflow.template Emplace<T>(std::forward<Args>(args) ...);
+		m_bOverflow = true;
+	}
+}
+
+template<class B> template<class T, class ... Args>
+bool CMPSCPolymorphicQueue<B >::TryEmplace(Args&& ... args)
+{
+	STATIC_CHECK(alignof(T) <= WORD_SIZE, MPSC_POLYMORPHIC_QUEUE_ITEM_ALIGNMENT_TOO_LARGE);
+	const int64 nSize = 1 + (sizeof(T) + WORD_SIZE - 1) / WORD_SIZE;
+	NET_ASSERT(nSize < eNumWords / 4);
+
+	int64 nWrite, nPadding;
+	do
+	{
+		nWrite = ReadCursor(m_nWrite);
+		const int64 nRead = ReadCursor(m_nRead);
+
+		// items are contiguous, if it doesn't fit before the end of the ring, the rest of the ring is skipped
+		const int64 nOffset = nWrite & (eNumWords - 1);
+		nPadding = (nOffset + nSize > eNumWords) ? eNumWords - nOffset : 0;
+		if (nWrite + nPadding + nSize - nRead > eNumWords)
+			return false;
+	}
+	while (CryInterlockedCompareExchange64(alias_cast<volatile int64*>(&m_nWrite), nWrite + nPadding + nSize, nWrite) != nWrite);
+
+	if (nPadding)
+	{
+		volatile TWord* pSkipHeader = &m_pData[nWrite & (eNumWords - 1)];
+		*pSkipHeader = (TWord)(nPadding << eHeader_Shift) | eHeader_Skip | eHeader_Written;
+	}
+
+	TWord* pHeader = &m_pData[(nWrite + nPadding) & (eNumWords - 1)];
+	new(pHeader + 1)T(std::forward<Args>(args) ...);
+
+	// publish, the consumer must not see the header before the item is constructed
+	MemoryBarrier();
+	*const_cast<volatile TWord*>(pHeader) = (TWord)(nSize << eHeader_Shift) | eHeader_Written;
+	return true;
+}
+
+template<class B> template<class F>
+void CMPSCPolymorphicQueue<B >::Flush(F& f)
+{
+	// repeat as executed items may add new ones
+	while (FlushRing(f) && m_bOverflow)
+		FlushOverflow(f);
+}
+
+template<class B> template<class F>
+void CMPSCPolymorphicQueue<B >::RealtimeFlush(F& f)
+{
+	struct SRealtime
+	{
+		SRealtime(F& f) : m_f(f) {}
+		ILINE void operator()(B* p)
+		{
+			ENSURE_REALTIME;
+			m_f(p);
+		}
+		F& m_f;
+	} realtime(f);
+	Flush(realtime);
+}
+
+template<class B> template<class F>
+bool CMPSCPolymorphicQueue<B >::FlushRing(F& f)
+{
+	int64 nRead = m_nRead;
+	while (nRead != ReadCursor(m_nWrite))
+	{
+		TWord* pHeader = &m_pData[nRead & (eNumWords - 1)];
+		const TWord header = *const_cast<volatile TWord*>(pHeader);
+		if ((header & eHeader_Written) == 0)
+			return false; // still being written by its producer
+		MemoryBarrier();
+
+		const int64 nSize = (int64)(header >> eHeader_Shift);
+		if ((header & eHeader_Skip) == 0)
+		{
+			B* p = reinterpret_cast<B*>(pHeader + 1);
+			f(p);
+			p->~B();
+		}
+
+		// every word could be a header in the next round, so clear the whole item before releasing it
+		memset(pHeader, 0, (size_t)nSize * WORD_SIZE);
+		MemoryBarrier();
+		nRead += nSize;
+		*const_cast<volatile int64*>(&m_nRead) = nRead;
+	}
+	return true;
+}
+
+template<class B> template<class F>
+void CMPSCPolymorphicQueue<B >::FlushOverflow(F& f)
+{
+	// only called once the ring is drained, so everything in the overflow is newer than what was in the ring
+	{
+		CryAutoLock<CryCriticalSectionNonRecursive> lock(m_overflowLock);
+		m_overflowFlush.Swap(m_overflow);
+		m_bOverflow = false;
+	}
+	// executed items may add to this queue again, so don't hold the lock here
+	m_overflowFlush.Flush(f);
+}
+
+template<class B>
+bool CMPSCPolymorphicQueue<B >::Empty()
+{
+	return ReadCursor(m_nRead) == ReadCursor(m_nWrite) && !m_bOverflow;
+}
+
+template<class B>
+void CMPSCPolymorphicQueue<B >::GetMemoryStatistics(ICrySizer* pSizer, bool countingThis /*= false*/)
+{
+	SIZER_COMPONENT_NAME(pSizer, "CMPSCPolymorphicQueue");
+
+	if (countingThis)
+		pSizer->Add(*this);
+
+	pSizer->AddObject(m_pData, eNumWords * WORD_SIZE);
+	{
+		CryAutoLock<CryCriticalSectionNonRecursive> lock(m_overflowLock);
+		m_overflow.GetMemoryStatistics(pSizer);
+	}
+	m_overflowFlush.GetMemoryStatistics(pSizer);
+}
+
+#endif
@@ -241,6 +241,7 @@ struct MMMDebugData
 	int m_totalNumFrees;
 
 	int m_currentNumAllocs;
+	int m_peakNumAllocs;
 };
 
 static MMMDebugData s_MMMDebug;
@@ -260,6 +261,7 @@ static void MMMDebugInit()
 	MMMDebugClearFrameData();
 
 	s_MMMDebug.m_currentNumAllocs = 0;
+	s_MMMDebug.m_peakNumAllocs = 0;
 
 	#if MMM_SAVE || MMM_PLAY
 	s_pMMMSaveData = new MMMSaveData[s_MMMSaveDataSize];
@@ -289,6 +291,7 @@ static void MMMDebugAddAlloc(void* p, size_t sz)
 
 	s_MMMDebug.m_totalNumAllocs++;
 	s_MMMDebug.m_currentNumAllocs++;
+	s_MMMDebug.m_peakNumAllocs = std::max(s_MMMDebug.m_peakNumAllocs, s_MMMDebug.m_currentNumAllocs);
 
 	WriteMMMData(MMM_TYPE_ALLOC, p, sz);
 }
@@ -322,7 +325,7 @@ static void MMMDebugDraw(int x, int& y)
 
 	DrawDebugLine(x, y++, "Total: Frame Allocs %4d Frame Frees %4d", s_MMMDebug.m_totalNumAllocs, s_MMMDebug.m_totalNumFrees);
 	y++;
-	DrawDebugLine(x, y++, "Current Num Allocations %4d", s_MMMDebug.m_currentNumAllocs);
+	DrawDebugLine(x, y++, "Current Num Allocations %4d Peak %4d", s_MMMDebug.m_currentNumAllocs, s_MMMDebug.m_peakNumAllocs);
 
 	MMMDebugClearFrameData();
 }
@@ -347,6 +350,7 @@ CMementoMemoryManager::CMementoMemoryManagerAllocator::CMementoMemoryManagerAllo
 	memset(m_freeList, 0, sizeof(m_freeList));
 	memset(m_numAllocated, 0, sizeof(m_numAllocated));
 	memset(m_numFree, 0, sizeof(m_numFree));
+	memset(m_peakAllocated, 0, sizeof(m_peakAllocated));
 #endif
 
 #if !defined(PURE_CLIENT)
@@ -736,6 +740,7 @@ void CMementoMemoryManager::CMementoMemoryManagerAllocator::InitHandleData(SHand
 			m_freeList[pool].pNext = m_freeList[pool].pNext->pNext;
 			m_numFree[pool]--;
 			m_numAllocated[pool]++;
+			m_peakAllocated[pool] = std::max(m_peakAllocated[pool], m_numAllocated[pool]);
 			hd.size = sz;
 			hd.capacity = (size_t)1 << szP2;
 		}
@@ -788,7 +793,7 @@ void CMementoMemoryManager::CMementoMemoryManagerAllocator::DebugDraw(int x, int
 
 	for (int i = 0; i < NPOOLS; i++)
 	{
-		DrawDebugLine(x, y++, "Pool %d (%4d byte blocks): Num Allocated %4d Num Free %4d Amount Allocated %8d Amount Free %8d", i, 1 << (i + FIRST_POOL), m_numAllocated[i], m_numFree[i], m_numAllocated[i] * (1 << (i + FIRST_POOL)), m_numFree[i] * (1 << (i + FIRST_POOL)));
+		DrawDebugLine(x, y++, "Pool %d (%4d byte blocks): Num Allocated %4d (Peak %4d) Num Free %4d Amount Allocated %8d Amount Free %8d", i, 1 << (i + FIRST_POOL), m_numAllocated[i], m_peakAllocated[i], m_numFree[i], m_numAllocated[i] * (1 << (i + FIRST_POOL)), m_numFree[i] * (1 << (i + FIRST_POOL)));
 		totalAllocated += m_numAllocated[i] * (1 << (i + FIRST_POOL));
 	}
 
@@ -111,6 +111,7 @@ private:
 		SFreeListHeader m_freeList[NPOOLS];
 		int             m_numAllocated[NPOOLS];
 		int             m_numFree[NPOOLS];
+		int             m_peakAllocated[NPOOLS]; // high water mark of m_numAllocated
 		stl::PoolAllocator<4096, stl::PoolAllocatorSynchronizationSinglethreaded, ALIGNMENT> m_pool;
 
 		struct SHandleData
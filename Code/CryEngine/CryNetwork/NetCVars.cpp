@@ -108,6 +108,10 @@ CNetCVars::CNetCVars()
 #endif // NEW_BANDWIDTH_MANAGEMENT
 	REGISTER_CVAR2_DEV_ONLY("net_ping_time", &PingTime, 5.f, 0, "Controls the length of time between ping packets.");
 	REGISTER_CVAR2_DEV_ONLY("net_keepalive_time", &KeepAliveTime, 10.f, 0, "Controls the length of time between keepalive packets.");
+	REGISTER_CVAR2("net_channelTickShards", &ChannelTickShards, 1, 0, "Splits the channels of a nub into this many groups. A forced channel tick only updates one group, the others are\n"
+	               "updated when their own send interval expires. Spreads the per-tick channel update cost on servers with many players.");
+	REGISTER_CVAR2("net_relevanceFarDistance", &RelevanceFarDistance, 0.0f, 0, "Objects further than this from a client's witness are updated at a reduced rate (see net_relevanceFarInterval). 0 disables");
+	REGISTER_CVAR2("net_relevanceFarInterval", &RelevanceFarInterval, 0.5f, 0, "Minimum time in seconds between updates to a client for objects beyond net_relevanceFarDistance");
 
 #if CRY_PLATFORM_DURANGO
 	REGISTER_CVAR2_DEV_ONLY("net_threadAffinity", &networkThreadAffinity, 5, VF_DUMPTODISK, "Xbox network thread affinity");
@@ -239,6 +243,7 @@ CNetCVars::CNetCVars()
 	StatsPassword = REGISTER_STRING("net_stats_pass", "", VF_DUMPTODISK, "Password for reporting stats on dedicated server");
 
 	REGISTER_COMMAND_DEV_ONLY("net_dump_object_state", DumpObjectState, 0, "");
+	REGISTER_COMMAND_DEV_ONLY("net_benchmark_work_queue", BenchmarkWorkQueue, VF_NULL, "compares the locked and the lock-free work queue under contention [producers=8] [items per producer=100000]");
 
 #if ENABLE_DEBUG_KIT
 	REGISTER_COMMAND_DEV_ONLY("net_stall", Stall, VF_NULL, "stall the network thread for a time (default 1 second, but can be passed in as a parameter");
@@ -304,6 +309,18 @@ void CNetCVars::SetCDKey(IConsoleCmdArgs* pArgs)
 	}
 }
 
+//------------------------------------------------------------------------
+void CNetCVars::BenchmarkWorkQueue(IConsoleCmdArgs* pArgs)
+{
+	int numProducers = 8;
+	int numItemsPerProducer = 100000;
+	if (pArgs && pArgs->GetArgCount() >= 2)
+		numProducers = max(atoi(pArgs->GetArg(1)), 1);
+	if (pArgs && pArgs->GetArgCount() >= 3)
+		numItemsPerProducer = max(atoi(pArgs->GetArg(2)), 1);
+	RunWorkQueueBenchmark(numProducers, numItemsPerProducer);
+}
+
 //------------------------------------------------------------------------
 #if ENABLE_DEBUG_KIT
 void CNetCVars::Stall(IConsoleCmdArgs* pArgs)
@@ -59,6 +59,9 @@ public:
 	int   MaxPacketSize;
 	float KeepAliveTime;
 	float PingTime;
+	int   ChannelTickShards;
+	float RelevanceFarDistance;
+	float RelevanceFarInterval;
 
 #if LOG_MESSAGE_DROPS
 	int LogDroppedMessagesVar;
@@ -248,6 +251,7 @@ private:
 	static void DumpObjectState(IConsoleCmdArgs*);
 	static void DumpBlockingRMIs(IConsoleCmdArgs*);
 	static void Stall(IConsoleCmdArgs*);
+	static void BenchmarkWorkQueue(IConsoleCmdArgs*);
 	static void SetCDKey(IConsoleCmdArgs*);
 
 #if NEW_BANDWIDTH_MANAGEMENT
@@ -58,6 +58,17 @@ void CNetDebugTrafficBandwidth::Draw(const SNetworkProfilingStats* const pProfil
 	DrawLine(11, s_white, "%12s %18" PRId64 " %16d %16.2f %16.2f", "Recvd", delta.m_totalBandwidthRecvd, m_bandwidthStats.m_1secAvg.m_totalPacketsRecvd,
 	         (float)m_bandwidthStats.m_1secAvg.m_totalBandwidthRecvd * invKB,
 	         (float)m_bandwidthStats.m_10secAvg.m_totalBandwidthRecvd * invKB);
+
+	DrawLine(13, s_white, "Syscalls/sec: %d send (%d packets), %d recv (%d packets)",
+	         m_bandwidthStats.m_1secAvg.m_sendSyscalls, m_bandwidthStats.m_1secAvg.m_totalPacketsSent,
+	         m_bandwidthStats.m_1secAvg.m_recvSyscalls, m_bandwidthStats.m_1secAvg.m_totalPacketsRecvd);
+
+	const uint32 numPlayers = max(m_bandwidthStats.m_numChannels, 1u);
+	DrawLine(14, s_white, "Per player (%d channels): %.0f bits/sec SENT (%.0f 10 sec avg), %.0f bits/sec RECV",
+	         m_bandwidthStats.m_numChannels,
+	         (float)m_bandwidthStats.m_1secAvg.m_totalBandwidthSent / numPlayers,
+	         (float)m_bandwidthStats.m_10secAvg.m_totalBandwidthSent / numPlayers,
+	         (float)m_bandwidthStats.m_1secAvg.m_totalBandwidthRecvd / numPlayers);
 }
 
 #endif
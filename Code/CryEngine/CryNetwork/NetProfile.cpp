@@ -43,6 +43,7 @@ static int s_netProfileWorstNumChannels = 0;
 static int s_netProfileShowSocketMeasurements = 0;
 static int s_netProfileEnable = 0;
 static int s_netProfileUntouchedDelay = 1;
+static int s_netProfileCapacityLogging = 0;
 static int s_netProfileNumRemoteClients = 0;
 static bool s_netProfileCountReadBits = false;
 
@@ -280,6 +281,7 @@ void netProfileBeginFunction(SNetProfileStackEntry* entry, bool read)
 	}
 
 	entry->m_parent = g_netProfileCurrent;
+	entry->m_startTicks = CryGetTicks();
 	g_netProfileCurrent = entry;
 }
 
@@ -288,6 +290,10 @@ void netProfileEndFunction()
 	assert(g_netProfileCurrent != &g_netProfileNull);
 	assert(g_netProfileCurrent != s_netProfileRoot);
 
+	const int64 ticks = CryGetTicks() - g_netProfileCurrent->m_startTicks;
+	g_netProfileCurrent->m_tickTicks += ticks;
+	g_netProfileCurrent->m_ticks += ticks;
+
 	g_netProfileCurrent = g_netProfileCurrent->m_parent;
 }
 
@@ -330,6 +336,7 @@ void calculateEntryStats(SNetProfileStackEntry* entry, uint32 parentWriteBits, i
 	counts->m_seqbitsAv.AddSample(serialisedBits);
 	counts->m_rmibitsAv.AddSample(entry->m_rmibits);
 	counts->m_payloadAv.AddSample(bitsTokbits);
+	counts->m_timeAv.AddSample(gEnv->pTimer->TicksToSeconds(entry->m_ticks) * 1000.f);
 
 	float onWireOneSec = entry->m_rmi ? bitsTokbits : ((floatSerialisedBits * float(numChannels)) + floatRMIBits) * one1024th;
 	counts->m_onWireAv.AddSample(onWireOneSec);
@@ -461,10 +468,10 @@ static void netProfilePrintEntry(FILE* file, const SNetProfileStackEntry* entry,
 		stringBuffer.append("\t");
 	}
 
-	stringBufferTemp.Format("%7u\t%7u/%7u\t%15.2f\t%15.2f\t%15.2f\t| %5.0f\t%7.0f/%7.0f\t%15.2f\t%15.2f\t%15.2f\t| %7.2f\t%7.2f",
+	stringBufferTemp.Format("%7u\t%7u/%7u\t%15.2f\t%15.2f\t%15.2f\t| %5.0f\t%7.0f/%7.0f\t%15.2f\t%15.2f\t%15.2f\t| %7.2f\t%7.2f\t| %7.3f/%7.3f",
 	                        counts->m_callsAv.GetLast(), counts->m_seqbitsAv.GetLast(), counts->m_rmibitsAv.GetLast(), counts->m_payloadAv.GetLast(), counts->m_onWireAv.GetLast(), counts->m_worst,
 	                        counts->m_callsAv.GetAverage(), counts->m_seqbitsAv.GetAverage(), counts->m_rmibitsAv.GetAverage(), counts->m_payloadAv.GetAverage(), counts->m_onWireAv.GetAverage(), counts->m_worstAv,
-	                        counts->m_heir, counts->m_self);
+	                        counts->m_heir, counts->m_self, counts->m_timeAv.GetLast(), counts->m_timeAv.GetAverage());
 	stringBuffer.append(stringBufferTemp);
 
 	if (depth >= 0)
@@ -530,7 +537,7 @@ void netProfileWriteLogFiles()
 	static int firstTimeBudgetLogging = 1;
 	static ICVar* pLogging = gEnv->pConsole->GetCVar("net_profile_logging");
 	static ICVar* pBudgetLogging = gEnv->pConsole->GetCVar("net_profile_budget_logging");
-	const char* header[9] = { "LAST", "AVERAGE", "Calls", "Seqbits/RMIbits", "Payload(Kbits)", "OnWire(Kbits)", "Worst(Kbits)", "Heir%", "Self%" };
+	const char* header[10] = { "LAST", "AVERAGE", "Calls", "Seqbits/RMIbits", "Payload(Kbits)", "OnWire(Kbits)", "Worst(Kbits)", "Heir%", "Self%", "CPU ms (last/avg)" };
 	char tabs[NUM_TABS + 1] = { 0 };
 	FILE* fout = NULL;
 
@@ -550,15 +557,15 @@ void netProfileWriteLogFiles()
 			netProfileFormatSocketView(fout);
 
 			fprintf(fout, "%s%s\t\t\t\t\t\t\t\t\t| %s\t\t\t\t\t\t\t\t\t|\n", tabs, header[0], header[1]);
-			fprintf(fout, "%s%s\t%s\t%s\t%s\t%s\t| %s\t%s\t%s\t%s\t%s\t| %s\t\t%s\n", tabs, header[2], header[3], header[4], header[5], header[6],
-			        header[2], header[3], header[4], header[5], header[6], header[7], header[8]);
+			fprintf(fout, "%s%s\t%s\t%s\t%s\t%s\t| %s\t%s\t%s\t%s\t%s\t| %s\t\t%s\t| %s\n", tabs, header[2], header[3], header[4], header[5], header[6],
+			        header[2], header[3], header[4], header[5], header[6], header[7], header[8], header[9]);
 			netProfileFormatFlatView(fout);
 
 			fprintf(fout, "\n\n");
 
 			fprintf(fout, "%s%s\t\t\t\t\t\t\t\t\t| %s\t\t\t\t\t\t\t\t\t|\n", tabs, header[0], header[1]);
-			fprintf(fout, "%s%s\t%s\t%s\t%s\t%s\t| %s\t%s\t%s\t%s\t%s\t| %s\t\t%s\n", tabs, header[2], header[3], header[4], header[5], header[6],
-			        header[2], header[3], header[4], header[5], header[6], header[7], header[8]);
+			fprintf(fout, "%s%s\t%s\t%s\t%s\t%s\t| %s\t%s\t%s\t%s\t%s\t| %s\t\t%s\t| %s\n", tabs, header[2], header[3], header[4], header[5], header[6],
+			        header[2], header[3], header[4], header[5], header[6], header[7], header[8], header[9]);
 			netProfileFormatHierarchyView(fout, s_netProfileRoot, 0);
 			fprintf(fout, "\n");
 
@@ -577,7 +584,7 @@ void netProfileWriteLogFiles()
 			fprintf(fout, "%sbitsTx\tsent\tbitsRx\trecv\n", tabs);
 			netProfileFormatSocketView(fout);
 
-			fprintf(fout, "%s%s%s%s%s%s%s%s%s%s\n", tabs, header[0], header[1], header[2], header[3], header[4], header[5], header[6], header[7], header[8]);
+			fprintf(fout, "%s%s%s%s%s%s%s%s%s%s%s\n", tabs, header[0], header[1], header[2], header[3], header[4], header[5], header[6], header[7], header[8], header[9]);
 			netProfileFormatHierarchyView(fout, s_netProfileRoot, 0);
 			fprintf(fout, "\n");
 
@@ -666,6 +673,9 @@ bool netProfileSocketMeasurementTick()
 		g_socketBandwidth.bandwidthStats.m_1secAvg.m_totalPacketsRecvd = g_socketBandwidth.periodStats.m_totalPacketsRecvd;
 		g_socketBandwidth.bandwidthStats.m_10secAvg.m_totalPacketsRecvd = (uint64)(g_socketBandwidth.numPacketsRecv.GetAverage() * AVERAGE_PERIOD);
 
+		g_socketBandwidth.bandwidthStats.m_1secAvg.m_sendSyscalls = g_socketBandwidth.periodStats.m_sendSyscalls;
+		g_socketBandwidth.bandwidthStats.m_1secAvg.m_recvSyscalls = g_socketBandwidth.periodStats.m_recvSyscalls;
+
 		g_socketBandwidth.avgValueRx = g_socketBandwidth.bandwidthUsedAmountRx.GetAverage() * AVERAGE_PERIOD;
 		g_socketBandwidth.sizeDisplayRx = g_socketBandwidth.periodStats.m_totalBandwidthRecvd * AVERAGE_PERIOD;
 
@@ -684,6 +694,15 @@ bool netProfileSocketMeasurementTick()
 			s_budgetExceeded = true;
 		}
 
+		if (s_netProfileCapacityLogging)
+		{
+			const int numClients = max(s_netProfileNumRemoteClients, 1);
+			const float kbitsRecvd = g_socketBandwidth.bandwidthStats.m_1secAvg.m_totalBandwidthRecvd / float(ONE_K_BITS);
+			CryLogAlways("[net capacity] clients %d, net ticks %d/sec, sent %.2f kbits/sec (%.2f per client), recv %.2f kbits/sec (%.2f per client), %d packets sent",
+			             s_netProfileNumRemoteClients, g_socketBandwidth.numDisplayNetTicks, kbits, kbits / numClients, kbitsRecvd, kbitsRecvd / numClients,
+			             g_socketBandwidth.bandwidthStats.m_1secAvg.m_totalPacketsSent);
+		}
+
 		shouldDumpLogs = TRUE;
 	}
 
@@ -805,6 +824,7 @@ void netProfileFlattenTreeRecursive(ProfileLeafList& list, SNetProfileStackEntry
 			leaf.m_name = concatName;
 			leaf.m_totalBits = pNode->m_tickBits;
 			leaf.m_calls = pNode->m_tickCalls;
+			leaf.m_timeMs = gEnv->pTimer->TicksToSeconds(pNode->m_tickTicks) * 1000.f;
 			leaf.m_rmi = pNode->m_rmi;
 
 			list.push_back(leaf);
@@ -831,6 +851,7 @@ void netProfileRegisterCVars()
 	REGISTER_CVAR2_DEV_ONLY("net_profile_show_socket_measurements", &s_netProfileShowSocketMeasurements, 0, VF_NULL, "show bandwidth socket measurements on screen");
 	REGISTER_CVAR2_DEV_ONLY("net_profile_enable", &s_netProfileEnable, 0, VF_NULL, "enable/disable net profile feature");
 	REGISTER_CVAR2_DEV_ONLY("net_profile_untouched_delay", &s_netProfileUntouchedDelay, 5, VF_NULL, "number of seconds to hold untouched profile entries before ditching");
+	REGISTER_CVAR2_DEV_ONLY("net_profile_capacity_logging", &s_netProfileCapacityLogging, 0, VF_NULL, "log connected clients, net tick rate and bandwidth once per second, for capacity tests");
 }
 
 #endif
@@ -866,10 +866,7 @@ void CNetwork::GetMemoryStatistics(ICrySizer* pSizer)
 	m_timer.GetMemoryStatistics(pSizer);
 	m_accurateTimer.GetMemoryStatistics(pSizer);
 
-	{
-		CryAutoLock<NetFastMutex> lk(m_fromGame_otherThreadLock);
-		m_fromGame_otherThreadQueue.GetMemoryStatistics(pSizer);
-	}
+	m_fromGame_otherThreadQueue.GetMemoryStatistics(pSizer);
 
 	//	for (int i=0; i<eMMT_NUM_TYPES; i++)
 	//		m_mmm[i].GetMemoryStatistics(pSizer);
@@ -1198,10 +1195,7 @@ void CNetwork::DoSyncWithGame(ENetworkGameSync type)
 
 			FlushNetLog(true);
 			m_fromGame.Flush(true);
-			{
-				CryAutoLock<NetFastMutex> lk(m_fromGame_otherThreadLock);
-				m_fromGame_otherThreadQueue.Flush(true);
-			}
+			m_fromGame_otherThreadQueue.Flush(true);
 			CMementoMemoryManager::DebugDraw();
 
 #if ENABLE_DEBUG_KIT
@@ -1226,20 +1220,14 @@ void CNetwork::DoSyncWithGame(ENetworkGameSync type)
 		FlushNetLog(true);
 		m_toGame.Flush(true);
 		m_fromGame.Flush(true);
-		{
-			CryAutoLock<NetFastMutex> lk(m_fromGame_otherThreadLock);
-			m_fromGame_otherThreadQueue.Flush(true);
-		}
+		m_fromGame_otherThreadQueue.Flush(true);
 		continuous = true;
 		break;
 	case eNGS_Shutdown_Clear:
 		FlushNetLog(true);
 		m_toGame.FlushEmpty();
 		m_fromGame.FlushEmpty();
-		{
-			CryAutoLock<NetFastMutex> lk(m_fromGame_otherThreadLock);
-			m_fromGame_otherThreadQueue.FlushEmpty();
-		}
+		m_fromGame_otherThreadQueue.FlushEmpty();
 		continuous = true;
 		break;
 	}
@@ -1263,10 +1251,7 @@ void CNetwork::DoSyncWithGame(ENetworkGameSync type)
 					suicidal = AllSuicidal();
 				m_fromGame.Flush(true);
 				m_toGame.Flush(true);
-				{
-					CryAutoLock<NetFastMutex> lk(m_fromGame_otherThreadLock);
-					m_fromGame_otherThreadQueue.Flush(true);
-				}
+				m_fromGame_otherThreadQueue.Flush(true);
 			}
 			if (continuous)
 				if (!emptied)
@@ -297,7 +297,7 @@ public:
 	}
 
 	// small hack to make adding things to the from game queue in general efficient
-#define ADDTOFROMGAMEQUEUE_BODY(params) if (IsPrimaryThread()) { LOCK_ON_STALL_TICKER(); m_fromGame.Add params; UNLOCK_ON_STALL_TICKER(); } else { CryAutoLock<NetFastMutex> lk(m_fromGame_otherThreadLock); m_fromGame_otherThreadQueue.Add params; }
+#define ADDTOFROMGAMEQUEUE_BODY(params) if (IsPrimaryThread()) { LOCK_ON_STALL_TICKER(); m_fromGame.Add params; UNLOCK_ON_STALL_TICKER(); } else { m_fromGame_otherThreadQueue.Add params; }
 	template<class A> void                                                       AddToFromGameQueue(const A& a)
 	{ ADDTOFROMGAMEQUEUE_BODY((a)); }
 	template<class A, class B> void                                              AddToFromGameQueue(const A& a, const B& b)
@@ -444,8 +444,7 @@ private:
 	// m_vFastChannelLookup must be constructed before any of the CWorkQueue's
 	CWorkQueue                     m_toGame;
 	CWorkQueue                     m_fromGame;
-	NetFastMutex                   m_fromGame_otherThreadLock;
-	CWorkQueue                     m_fromGame_otherThreadQueue;
+	CMPSCWorkQueue                 m_fromGame_otherThreadQueue; // added to from any thread without locking, flushed under m_mutex
 	CWorkQueue                     m_intQueue;
 	CWorkQueue                     m_toGameLazyBuilding;
 	CWorkQueue                     m_toGameLazyProcessing;
@@ -59,6 +59,8 @@ public:
 	T* Add(const T& value);
 	template<class T>
 	T* Add();
+	template<class T, class ... Args>
+	T* Emplace(Args&& ... args);
 
 	template<class F>
 	void Flush(F& f);
@@ -163,6 +165,15 @@ T* CPolymorphicQueue<B >::Add()
 	return out;
 }
 
+template<class B> template<class T, class ... Args>
+T* CPolymorphicQueue<B >::Emplace(Args&& ... args)
+{
+	POLY_HEADER;
+	T* out = Check(new(Grab(sizeof(T), POLY_RETADDR))T(std::forward<Args>(args) ...));
+	POLY_FOOTER;
+	return out;
+}
+
 template<class B> template<class F>
 void CPolymorphicQueue<B >::Flush(F& f)
 {
@@ -529,11 +529,9 @@ private:
 		void Encrypt(uint8* pBuf, size_t len)
 		{
 #if ENCRYPTION_RIJNDAEL
-			// cppcheck-suppress allocaCalled
-			PREFAST_SUPPRESS_WARNING(6255) uint8 * buf = (uint8*)alloca(len);
+			// CBC reads each block before writing it back, so the packet doesn't need a copy
 			NET_ASSERT(0 == (len & 15));
-			m_crypt.blockEncrypt(pBuf, len * 8, buf);
-			memcpy(pBuf, buf, len);
+			m_crypt.blockEncrypt(pBuf, len * 8, pBuf);
 #elif ENCRYPTION_STREAMCIPHER
 			m_crypt.Encrypt(pBuf, len, pBuf);
 #endif
@@ -541,11 +539,8 @@ private:
 		void Decrypt(uint8* pBuf, size_t len)
 		{
 #if ENCRYPTION_RIJNDAEL
-			// cppcheck-suppress allocaCalled
-			PREFAST_SUPPRESS_WARNING(6255) uint8 * buf = (uint8*)alloca(len);
 			NET_ASSERT(0 == (len & 15));
-			m_crypt.blockDecrypt(pBuf, len * 8, buf);
-			memcpy(pBuf, buf, len);
+			m_crypt.blockDecrypt(pBuf, len * 8, pBuf);
 #elif ENCRYPTION_STREAMCIPHER
 			m_crypt.Decrypt(pBuf, len, pBuf);
 #endif
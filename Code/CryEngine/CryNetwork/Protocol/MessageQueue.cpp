@@ -923,6 +923,8 @@ void CMessageQueue::CalculatePerFrameData(const SSchedulingParams& params)
 	float drawDistanceScale = 1.0f;
 	if (params.haveWitnessFov)
 		drawDistanceScale = 0.05f + 0.95f * (RAD2DEG(params.witnessFov) / 60.f); // from 3dengine
+	const float farDistance = CNetCVars::Get().RelevanceFarDistance;
+	const float farInterval = CNetCVars::Get().RelevanceFarInterval;
 	#endif
 
 	CActiveElemIterator iter(this, eMSS_Active);
@@ -961,6 +963,12 @@ void CMessageQueue::CalculatePerFrameData(const SSchedulingParams& params)
 			{
 				float distanceFromWitness = params.witnessPosition.GetDistance(posInfo.position);
 				priority += ent.pAG->policy.distanceScaler.GetBump(distanceFromWitness);
+				// far away objects only get an update every net_relevanceFarInterval seconds; the message stays queued meanwhile
+				if (farDistance > 0.0f && distanceFromWitness > farDistance && ent.ordering.latencyClass == eLC_DontCare)
+				{
+					if ((params.now - ent.msg.inserted).GetSeconds() < farInterval)
+						ent.ordering.latencyClass = eLC_DontBother;
+				}
 				if (posInfo.haveDrawDistance)
 					isWithinRenderedDistance = (distanceFromWitness < (posInfo.drawDistance * drawDistanceScale));
 				if (params.haveWitnessDirection)
@@ -230,6 +230,7 @@ CNetNub::CNetNub(const TNetAddress& addr, IGameNub* pGameNub,
 	m_bDead(false),
 	m_addr(addr),
 	m_cleanupChannel(0),
+	m_forcedTickShard(0),
 	m_serverReport(0),
 	m_connectingLocks(0),
 	m_keepAliveLocks(0)
@@ -1946,15 +1947,20 @@ CNetChannel* CNetNub::FindFirstRemoteChannel()
 //#if LOCK_NETWORK_FREQUENCY
 void CNetNub::TickChannels(CTimeValue& now, bool force)
 {
+	// With several shards a forced tick only forces the channels of one shard, round robin
+	const uint32 numShards = (uint32)max(CNetCVars::Get().ChannelTickShards, 1);
+	const uint32 forcedShard = force ? (m_forcedTickShard++ % numShards) : 0;
+
+	uint32 channelIndex = 0;
 	TChannelMap::iterator end = m_channels.end();
-	for (TChannelMap::iterator iter = m_channels.begin(); iter != end; ++iter)
+	for (TChannelMap::iterator iter = m_channels.begin(); iter != end; ++iter, ++channelIndex)
 	{
 		if (CNetChannel* pChan = iter->second->GetNetChannel())
 		{
 #if USE_CHANNEL_TIMERS
 			pChan->CallUpdate(now);
 #else
-			pChan->CallUpdateIfNecessary(now, force);
+			pChan->CallUpdateIfNecessary(now, force && (channelIndex % numShards) == forcedShard);
 #endif // USE_CHANNEL_TIMERS
 		}
 	}
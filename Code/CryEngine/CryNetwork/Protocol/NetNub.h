@@ -309,6 +309,7 @@ private:
 	TNetAddress           m_addr;
 	TPendingConnectionSet m_pendingConnections;
 	size_t                m_cleanupChannel;
+	uint32                m_forcedTickShard;
 	TDisconnectMap        m_disconnectMap;
 	TAckDisconnectSet     m_ackDisconnectSet;
 	TConnectingMap        m_connectingMap;
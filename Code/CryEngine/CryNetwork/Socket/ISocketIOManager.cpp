@@ -5,6 +5,7 @@
 #include "SocketIOManagerIOCP.h"
 #include "SocketIOManagerNull.h"
 #include "SocketIOManagerSelect.h"
+#include "SocketIOManagerEpoll.h"
 #include "SocketIOManagerLobbyIDAddr.h"
 #if CRY_PLATFORM_DURANGO
 	#include "SocketIOManagerDurango.h"
@@ -75,6 +76,20 @@ void CSocketIOManager::FreeDatagramSocket(IDatagramSocketPtr pSocket)
 
 #if NET_MINI_PROFILE || NET_PROFILE_ENABLE
 
+void CSocketIOManager::RecordSyscallStatistics(bool bSend)
+{
+	if (bSend)
+	{
+		g_socketBandwidth.periodStats.m_sendSyscalls++;
+		g_socketBandwidth.bandwidthStats.m_total.m_sendSyscalls++;
+	}
+	else
+	{
+		g_socketBandwidth.periodStats.m_recvSyscalls++;
+		g_socketBandwidth.bandwidthStats.m_total.m_recvSyscalls++;
+	}
+}
+
 void CSocketIOManager::RecordPacketSendStatistics(const uint8* pData, size_t len)
 {
 	uint32 thisSend = (len + UDP_HEADER_SIZE) * 8;
@@ -153,6 +168,22 @@ bool CreateSocketIOManager(int ncpus, ISocketIOManager** ppExternal, ISocketIOMa
 		}
 	}
 #endif // defined(HAS_SOCKETIOMANAGER_DURANGO)
+#if defined(HAS_SOCKETIOMANAGER_EPOLL)
+	if (!created)
+	{
+		CSocketIOManagerEpoll* pMgrEpoll = new CSocketIOManagerEpoll();
+		if ((pMgrEpoll != NULL) && (pMgrEpoll->Init() == true))
+		{
+			*ppInternal = pMgrEpoll;
+			created = true;
+		}
+		else
+		{
+			delete pMgrEpoll;
+			created = false;
+		}
+	}
+#endif // defined(HAS_SOCKETIOMANAGER_EPOLL)
 #if defined(HAS_SOCKETIOMANAGER_SELECT)
 	if (!created)
 	{
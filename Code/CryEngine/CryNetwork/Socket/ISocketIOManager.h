@@ -225,6 +225,7 @@ public:
 
 #if NET_MINI_PROFILE || NET_PROFILE_ENABLE
 	void RecordPacketSendStatistics(const uint8* pData, size_t len);
+	void RecordSyscallStatistics(bool bSend);
 #endif
 
 private:
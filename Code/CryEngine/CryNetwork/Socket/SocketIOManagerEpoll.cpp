@@ -0,0 +1,745 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "StdAfx.h"
+#include "SocketIOManagerEpoll.h"
+#include "Network.h"
+#include "UDPDatagramSocket.h"
+
+#if defined(HAS_SOCKETIOMANAGER_EPOLL)
+
+	#include <sys/epoll.h>
+	#include <unistd.h>
+
+CSocketIOManagerEpoll::CSocketIOManagerEpoll() : CSocketIOManager(eSIOMC_SupportsBackoff)
+	#if LOCK_NETWORK_FREQUENCY
+	, m_userMessageFrameID(0)
+	#endif // LOCK_NETWORK_FREQUENCY
+{
+	if (CNetCVars::Get().enableWatchdogTimer)
+	{
+		m_pWatchdog = new CWatchdogTimer;
+	}
+	else
+	{
+		m_pWatchdog = NULL;
+	}
+
+	m_epollFd = -1;
+	m_wakeupReadable = false;
+	m_pollThreadId = 0;
+	m_wakeupSocket = CRY_INVALID_SOCKET;
+	m_wakeupSender = CRY_INVALID_SOCKET;
+}
+
+CSocketIOManagerEpoll::~CSocketIOManagerEpoll()
+{
+	if (m_wakeupSocket != CRY_INVALID_SOCKET)
+	{
+		CrySock::closesocket(m_wakeupSocket);
+	}
+	if (m_wakeupSender != CRY_INVALID_SOCKET)
+	{
+		CrySock::closesocket(m_wakeupSender);
+	}
+	if (m_epollFd >= 0)
+	{
+		close(m_epollFd);
+	}
+
+	for (size_t i = 0; i < m_socketInfo.size(); i++)
+		delete m_socketInfo[i];
+
+	if (m_pWatchdog)
+	{
+		delete m_pWatchdog;
+	}
+}
+
+bool CSocketIOManagerEpoll::Init()
+{
+	class CAutoCloseSocket
+	{
+	public:
+		CAutoCloseSocket(CRYSOCKET sock) : m_sock(sock) {}
+
+		~CAutoCloseSocket()
+		{
+			if (m_sock != CRY_INVALID_SOCKET)
+				CrySock::closesocket(m_sock);
+		}
+
+		void Release()
+		{
+			m_sock = CRY_INVALID_SOCKET;
+		}
+
+	private:
+		CRYSOCKET m_sock;
+	};
+
+	m_epollFd = epoll_create1(EPOLL_CLOEXEC);
+	if (m_epollFd < 0)
+	{
+		NetWarning("[net] epoll_create1 failed: %d", errno);
+		return false;
+	}
+
+	int i;
+	for (i = 1025; i < 65536; i++)
+	{
+		if (i == 0xed17 || i == 0xfa57)
+			continue;
+		m_wakeupSocket = CrySock::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+		if (m_wakeupSocket == CRY_INVALID_SOCKET)
+			return false;
+
+		CAutoCloseSocket closer(m_wakeupSocket);
+		memset(&m_wakeupAddr, 0, sizeof(m_wakeupAddr));
+
+		m_wakeupAddr.sin_family = AF_INET;
+		m_wakeupAddr.sin_port = htons(i);
+		m_wakeupAddr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		if (CrySock::bind(m_wakeupSocket, (const CRYSOCKADDR*)&m_wakeupAddr, sizeof(CRYSOCKADDR_IN)) != CRY_SOCKET_ERROR)
+		{
+			closer.Release();
+			break;
+		}
+		else
+		{
+			const char* msg = CNetwork::Get()->EnumerateError(MAKE_NRESULT(NET_FAIL, NET_FACILITY_SOCKET, GetLastError()));
+			NetWarning("[net] socket error: %s", msg);
+		}
+	}
+
+	if (i == 65536)
+		return false;
+
+	m_wakeupSender = CrySock::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+	if (m_wakeupSender == CRY_INVALID_SOCKET)
+		return false;
+
+	CRYSOCKADDR_IN saddr;
+	saddr.sin_family = AF_INET;
+	saddr.sin_port = 0;
+	saddr.sin_addr.s_addr = htonl(INADDR_ANY);
+	if (CrySock::bind(m_wakeupSender, (const CRYSOCKADDR*)&saddr, sizeof(CRYSOCKADDR_IN)) == CRY_SOCKET_ERROR)
+	{
+		const char* msg = ((CNetwork*)(GetISystem()->GetINetwork()))->EnumerateError(MAKE_NRESULT(NET_FAIL, NET_FACILITY_SOCKET, GetLastError()));
+		NetWarning("[net] socket error: %s", msg);
+
+		return false;
+	}
+
+	if (!MakeSocketNonBlocking(m_wakeupSender))
+		return false;
+	if (!MakeSocketNonBlocking(m_wakeupSocket))
+		return false;
+
+	// The wakeup socket is level-triggered, so that queued user messages keep waking up the poll
+	// until each of them has been consumed by PollWork
+	epoll_event event;
+	event.events = EPOLLIN;
+	event.data.u64 = 0;
+	event.data.u32 = kWakeupSocketId;
+	if (epoll_ctl(m_epollFd, EPOLL_CTL_ADD, m_wakeupSocket, &event) != 0)
+	{
+		NetWarning("[net] epoll_ctl failed to add wakeup socket: %d", errno);
+		return false;
+	}
+
+	return true;
+}
+
+bool CSocketIOManagerEpoll::PollWait(uint32 waitTime)
+{
+	m_pollThreadId = CryGetCurrentThreadId();
+
+	if (m_pWatchdog)
+	{
+		m_pWatchdog->ClearStalls();
+	}
+
+	// Sockets that are still known to be readable/writable from a previous edge have work
+	// right away, so only collect new events without blocking
+	bool haveData = false;
+	for (size_t i = 0; i < m_socketInfo.size(); i++)
+	{
+		const SSocketInfo& si = *m_socketInfo[i];
+		if (si.isActive && si.HasWork())
+		{
+			haveData = true;
+			break;
+		}
+	}
+
+	epoll_event events[kMaxEventsPerWait];
+	int numEvents = epoll_wait(m_epollFd, events, kMaxEventsPerWait, haveData ? 0 : (int)waitTime);
+	for (int i = 0; i < numEvents; i++)
+	{
+		const uint32 events_i = events[i].events;
+		const uint32 id = events[i].data.u32;
+		if (id == kWakeupSocketId)
+		{
+			m_wakeupReadable = true;
+			haveData = true;
+			continue;
+		}
+
+		if (id >= m_socketInfo.size() || !m_socketInfo[id]->isActive)
+			continue;
+
+		SSocketInfo& si = *m_socketInfo[id];
+		// Errors and hangups are reported to the targets by the failing read/write
+		if (events_i & (EPOLLIN | EPOLLERR | EPOLLHUP))
+			si.canRead = true;
+		if (events_i & (EPOLLOUT | EPOLLERR | EPOLLHUP))
+			si.canWrite = true;
+		haveData = true;
+	}
+
+	return haveData;
+}
+
+int CSocketIOManagerEpoll::PollWork(bool& performedWork)
+{
+	int r = 0;
+	int ret = eSM_COMPLETEDIO;
+	performedWork = false;
+	char buffer[MAX_UDP_PACKET_SIZE];
+	char address[_SS_MAXSIZE];
+	CRYSOCKLEN_T addrlen = _SS_MAXSIZE;
+
+	if (m_wakeupReadable)
+	{
+		m_wakeupReadable = false;
+		if (CrySock::recvfrom(m_wakeupSocket, buffer, MAX_UDP_PACKET_SIZE, 0, (CRYSOCKADDR*)address, &addrlen))
+		{
+			SUserMessage* pMessage = reinterpret_cast<SUserMessage*>(&buffer);
+	#if LOCK_NETWORK_FREQUENCY
+			if (pMessage->m_frameID == m_userMessageFrameID)
+	#endif // LOCK_NETWORK_FREQUENCY
+			{
+				ret = pMessage->m_message;
+			}
+		}
+	}
+
+	size_t numSockets = m_socketInfo.size();
+	for (size_t i = 0; i < numSockets; i++)
+	{
+		SSocketInfo& si = *m_socketInfo[i];
+		if (!si.isActive)
+			continue;
+		if (si.NeedRead() && si.canRead)
+		{
+			if (si.nRecvFrom && RecvFromBatch(si))
+			{
+				performedWork = true;
+			}
+			if (si.nRecv && si.canRead)
+			{
+	#if NET_MINI_PROFILE || NET_PROFILE_ENABLE
+				RecordSyscallStatistics(false);
+	#endif
+				r = recv(si.sock, buffer, MAX_UDP_PACKET_SIZE, 0);
+				switch (r)
+				{
+				case 0:
+					si.pRecvTarget->OnRecvException(eSE_ZeroLengthPacket);
+					si.nRecv--;
+					break;
+				case CRY_SOCKET_ERROR:
+					{
+						CrySock::eCrySockError sockErr = CrySock::TranslateLastSocketError();
+						if (sockErr != CrySock::eCSE_EWOULDBLOCK)
+						{
+							si.pRecvTarget->OnRecvException(OSErrorToSocketError(CrySock::TranslateToSocketError(sockErr)));
+							si.nRecv--;
+						}
+						else
+						{
+							si.canRead = false;
+						}
+					}
+					break;
+				default:
+					CNetwork::Get()->ReportGotPacket();
+					si.pRecvTarget->OnRecvComplete((uint8*)buffer, r);
+					si.nRecv--;
+					performedWork = true;
+					break;
+				}
+			}
+			if (si.nListen && si.canRead)
+			{
+				addrlen = _SS_MAXSIZE;
+				CRYSOCKET sock = CrySock::accept(si.sock, (CRYSOCKADDR*)address, &addrlen);
+				if (sock != CRY_INVALID_SOCKET)
+				{
+					si.pAcceptTarget->OnAccept(ConvertAddr((CRYSOCKADDR*)address, addrlen), sock);
+					si.nListen--;
+					performedWork = true;
+				}
+				else
+				{
+					CrySock::eCrySockError sockErr = CrySock::TranslateLastSocketError();
+					if (sockErr != CrySock::eCSE_EWOULDBLOCK)
+					{
+						si.pAcceptTarget->OnAcceptException(OSErrorToSocketError(CrySock::TranslateToSocketError(sockErr)));
+						si.nListen--;
+					}
+					else
+					{
+						si.canRead = false;
+					}
+				}
+			}
+		}
+		if (si.isActive && si.NeedWrite() && si.canWrite)
+		{
+			bool done = false;
+			while (!done && !si.outgoing.empty())
+			{
+	#if NET_MINI_PROFILE || NET_PROFILE_ENABLE
+				RecordSyscallStatistics(true);
+	#endif
+				r = CrySock::send(si.sock, (char*)si.outgoing.front().data, si.outgoing.front().nLength, 0);
+				switch (r)
+				{
+				case 0:
+					si.pSendTarget->OnSendException(eSE_ZeroLengthPacket);
+					break;
+				case CRY_SOCKET_ERROR:
+					{
+						CrySock::eCrySockError sockErr = CrySock::TranslateLastSocketError();
+						if (sockErr != CrySock::eCSE_EWOULDBLOCK)
+						{
+							si.pSendTarget->OnSendException(OSErrorToSocketError(CrySock::TranslateToSocketError(sockErr)));
+						}
+						else
+						{
+							si.canWrite = false;
+							done = true;
+						}
+						break;
+					}
+				}
+				if (!done)
+					si.outgoing.pop_front();
+			}
+			if (!si.outgoingAddressed.empty())
+			{
+				SendToBatch(si);
+			}
+		}
+	}
+
+	return ret;
+}
+
+bool CSocketIOManagerEpoll::RecvFromBatch(SSocketInfo& si)
+{
+	mmsghdr msgs[kMaxBatchSize];
+	iovec iovs[kMaxBatchSize];
+
+	const int numRequested = std::min(si.nRecvFrom, (int)kMaxBatchSize);
+	for (int i = 0; i < numRequested; i++)
+	{
+		iovs[i].iov_base = m_batchBuffers[i];
+		iovs[i].iov_len = MAX_UDP_PACKET_SIZE;
+		memset(&msgs[i], 0, sizeof(msgs[i]));
+		msgs[i].msg_hdr.msg_name = m_batchAddresses[i];
+		msgs[i].msg_hdr.msg_namelen = _SS_MAXSIZE;
+		msgs[i].msg_hdr.msg_iov = &iovs[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	#if NET_MINI_PROFILE || NET_PROFILE_ENABLE
+	RecordSyscallStatistics(false);
+	#endif
+	const int numReceived = recvmmsg(si.sock, msgs, numRequested, MSG_DONTWAIT, NULL);
+	if (numReceived < 0)
+	{
+		CrySock::eCrySockError sockErr = CrySock::TranslateLastSocketError();
+		if (sockErr != CrySock::eCSE_EWOULDBLOCK)
+		{
+			si.pRecvFromTarget->OnRecvFromException(TNetAddress(), OSErrorToSocketError(CrySock::TranslateToSocketError(sockErr)));
+			si.nRecvFrom--;
+		}
+		else
+		{
+			si.canRead = false;
+		}
+		return false;
+	}
+
+	// A short batch means the socket queue was drained; new data will raise a new edge
+	if (numReceived < numRequested)
+		si.canRead = false;
+
+	for (int i = 0; i < numReceived; i++)
+	{
+		// The target may unregister the socket or drop its recv requests from within the callback
+		if (!si.isActive || !si.pRecvFromTarget || !si.nRecvFrom)
+			break;
+
+		const TNetAddress from = ConvertAddr((CRYSOCKADDR*)m_batchAddresses[i], msgs[i].msg_hdr.msg_namelen);
+		si.nRecvFrom--;
+		if (msgs[i].msg_len == 0)
+		{
+			si.pRecvFromTarget->OnRecvFromException(from, eSE_ZeroLengthPacket);
+		}
+		else
+		{
+			CNetwork::Get()->ReportGotPacket();
+			si.pRecvFromTarget->OnRecvFromComplete(from, m_batchBuffers[i], msgs[i].msg_len);
+		}
+	}
+
+	return numReceived > 0;
+}
+
+void CSocketIOManagerEpoll::SendToBatch(SSocketInfo& si)
+{
+	mmsghdr msgs[kMaxBatchSize];
+	iovec iovs[kMaxBatchSize];
+
+	while (si.isActive && si.canWrite && !si.outgoingAddressed.empty())
+	{
+		int numMsgs = 0;
+		TOutgoingAddressedDataList::iterator it = si.outgoingAddressed.begin();
+		while (it != si.outgoingAddressed.end() && numMsgs < kMaxBatchSize)
+		{
+			int addrlen = _SS_MAXSIZE;
+			if (!ConvertAddr(it->addr, (CRYSOCKADDR*)m_batchAddresses[numMsgs], &addrlen))
+			{
+				it = si.outgoingAddressed.erase(it);
+				continue;
+			}
+
+			iovs[numMsgs].iov_base = it->data;
+			iovs[numMsgs].iov_len = it->nLength;
+			memset(&msgs[numMsgs], 0, sizeof(msgs[numMsgs]));
+			msgs[numMsgs].msg_hdr.msg_name = m_batchAddresses[numMsgs];
+			msgs[numMsgs].msg_hdr.msg_namelen = addrlen;
+			msgs[numMsgs].msg_hdr.msg_iov = &iovs[numMsgs];
+			msgs[numMsgs].msg_hdr.msg_iovlen = 1;
+			++numMsgs;
+			++it;
+		}
+
+		if (numMsgs == 0)
+			break;
+
+	#if NET_MINI_PROFILE || NET_PROFILE_ENABLE
+		RecordSyscallStatistics(true);
+	#endif
+		const int numSent = sendmmsg(si.sock, msgs, numMsgs, 0);
+		if (numSent < 0)
+		{
+			CrySock::eCrySockError sockErr = CrySock::TranslateLastSocketError();
+			if (sockErr == CrySock::eCSE_EWOULDBLOCK)
+			{
+				si.canWrite = false;
+				break;
+			}
+
+			// Drop the failing datagram before notifying the target, which may unregister the socket
+			const TNetAddress addr = si.outgoingAddressed.front().addr;
+			si.outgoingAddressed.pop_front();
+			si.pSendToTarget->OnSendToException(addr, OSErrorToSocketError(CrySock::TranslateToSocketError(sockErr)));
+			continue;
+		}
+
+		for (int i = 0; i < numSent; i++)
+			si.outgoingAddressed.pop_front();
+	}
+}
+
+void CSocketIOManagerEpoll::PushUserMessage(int msg)
+{
+	if (msg < eUM_LAST || msg > eUM_FIRST)
+	{
+		// N.B. range check above relies on user messages being -ve
+		CryFatalError("PushUserMessage(%d) invalid message", msg);
+	}
+
+	SUserMessage message;
+	message.m_message = msg;
+	#if LOCK_NETWORK_FREQUENCY
+	message.m_frameID = m_userMessageFrameID;
+	#endif // LOCK_NETWORK_FREQUENCY
+	CrySock::sendto(m_wakeupSocket, reinterpret_cast<char*>(&message), sizeof(message), 0, (CRYSOCKADDR*)&m_wakeupAddr, sizeof(m_wakeupAddr));
+}
+
+void CSocketIOManagerEpoll::WakeUp()
+{
+	char buf[1] = { 0 };
+	CrySock::sendto(m_wakeupSender, buf, 0, 0, (CRYSOCKADDR*)&m_wakeupAddr, sizeof(m_wakeupAddr));
+}
+
+SSocketID CSocketIOManagerEpoll::RegisterSocket(CRYSOCKET sock, int protocol)
+{
+	uint32 id;
+	for (id = 0; id < m_socketInfo.size(); id++)
+		if (!m_socketInfo[id]->isActive)
+			break;
+	if (id == m_socketInfo.size())
+		m_socketInfo.push_back(new SSocketInfo());
+
+	m_socketInfo[id]->isActive = true;
+	do
+		m_socketInfo[id]->salt++;
+	while (!m_socketInfo[id]->salt);
+	m_socketInfo[id]->sock = sock;
+	m_socketInfo[id]->protocol = protocol;
+	m_socketInfo[id]->canRead = false;
+	m_socketInfo[id]->canWrite = false;
+
+	// Need to reset contents of m_sockInfo[id]. The UnregisterSocket should have done this by assigning SSocketInfo, but
+	// somehow m_socketInfo[id].nRecv has gone negative somewhere between UnregisterSocket and RegisterSocket
+	// Safer to reinitialise everything except the salt.
+	m_socketInfo[id]->nRecvFrom = m_socketInfo[id]->nRecv = m_socketInfo[id]->nListen = 0;
+	m_socketInfo[id]->pRecvFromTarget = NULL;
+	m_socketInfo[id]->pSendToTarget = NULL;
+	m_socketInfo[id]->pConnectTarget = NULL;
+	m_socketInfo[id]->pAcceptTarget = NULL;
+	m_socketInfo[id]->pRecvTarget = NULL;
+	m_socketInfo[id]->pSendTarget = NULL;
+
+	epoll_event event;
+	event.events = EPOLLIN | EPOLLOUT | EPOLLET;
+	event.data.u64 = 0;
+	event.data.u32 = id;
+	if (epoll_ctl(m_epollFd, EPOLL_CTL_ADD, sock, &event) != 0)
+	{
+		NetWarning("[net] epoll_ctl failed to add socket: %d", errno);
+	}
+
+	return SSocketID((int)id, m_socketInfo[id]->salt);
+}
+
+void CSocketIOManagerEpoll::UnregisterSocket(SSocketID sockid)
+{
+	if (SSocketInfo* pSI = GetSocketInfo(sockid))
+	{
+		epoll_event event = {};
+		epoll_ctl(m_epollFd, EPOLL_CTL_DEL, pSI->sock, &event);
+
+		uint16 salt = pSI->salt;
+		*pSI = SSocketInfo();
+		pSI->salt = salt;
+		do
+			pSI->salt++;
+		while (!pSI->salt);
+	}
+}
+
+void CSocketIOManagerEpoll::RegisterBackoffAddressForSocket(const TNetAddress& addr, SSocketID sockid)
+{
+	if (m_pWatchdog)
+	{
+		if (SSocketInfo* pSI = GetSocketInfo(sockid))
+		{
+			m_pWatchdog->RegisterTarget(pSI->sock, addr);
+		}
+	}
+}
+
+void CSocketIOManagerEpoll::UnregisterBackoffAddressForSocket(const TNetAddress& addr, SSocketID sockid)
+{
+	if (m_pWatchdog)
+	{
+		if (SSocketInfo* pSI = GetSocketInfo(sockid))
+		{
+			m_pWatchdog->UnregisterTarget(pSI->sock, addr);
+		}
+	}
+}
+
+CSocketIOManagerEpoll::SSocketInfo* CSocketIOManagerEpoll::GetSocketInfo(SSocketID id)
+{
+	if (id.id >= m_socketInfo.size())
+		return 0;
+	if (m_socketInfo[id.id]->salt != id.salt)
+		return 0;
+	if (!m_socketInfo[id.id]->isActive)
+		return 0;
+	return m_socketInfo[id.id];
+}
+
+void CSocketIOManagerEpoll::SetRecvFromTarget(SSocketID sockid, IRecvFromTarget* pTarget)
+{
+	if (SSocketInfo* pSI = GetSocketInfo(sockid))
+	{
+		pSI->pRecvFromTarget = pTarget;
+		pSI->nRecvFrom *= (pTarget != NULL);
+	}
+}
+
+void CSocketIOManagerEpoll::SetConnectTarget(SSocketID sockid, IConnectTarget* pTarget)
+{
+	if (SSocketInfo* pSI = GetSocketInfo(sockid))
+	{
+		pSI->pConnectTarget = pTarget;
+	}
+}
+
+void CSocketIOManagerEpoll::SetSendToTarget(SSocketID sockid, ISendToTarget* pTarget)
+{
+	if (SSocketInfo* pSI = GetSocketInfo(sockid))
+	{
+		pSI->pSendToTarget = pTarget;
+		if (!pTarget)
+			pSI->outgoingAddressed.clear();
+	}
+}
+
+void CSocketIOManagerEpoll::SetAcceptTarget(SSocketID sockid, IAcceptTarget* pTarget)
+{
+	if (SSocketInfo* pSI = GetSocketInfo(sockid))
+	{
+		pSI->pAcceptTarget = pTarget;
+		pSI->nListen *= (pTarget != NULL);
+	}
+}
+
+void CSocketIOManagerEpoll::SetRecvTarget(SSocketID sockid, IRecvTarget* pTarget)
+{
+	if (SSocketInfo* pSI = GetSocketInfo(sockid))
+	{
+		pSI->pRecvTarget = pTarget;
+		pSI->nRecv *= (pTarget != NULL);
+	}
+}
+
+void CSocketIOManagerEpoll::SetSendTarget(SSocketID sockid, ISendTarget* pTarget)
+{
+	if (SSocketInfo* pSI = GetSocketInfo(sockid))
+	{
+		pSI->pSendTarget = pTarget;
+		if (!pTarget)
+			pSI->outgoing.clear();
+	}
+}
+
+bool CSocketIOManagerEpoll::RequestRecvFrom(SSocketID sockid)
+{
+	if (SSocketInfo* pSI = GetSocketInfo(sockid))
+	{
+		if (pSI->pRecvFromTarget)
+		{
+			pSI->nRecvFrom++;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool CSocketIOManagerEpoll::RequestSendTo(SSocketID sockid, const TNetAddress& addr, const uint8* pData, size_t len)
+{
+	if (len > MAX_UDP_PACKET_SIZE)
+		return false;
+
+	if (SSocketInfo* pSI = GetSocketInfo(sockid))
+	{
+		if (pSI->pSendToTarget)
+		{
+	#if NET_MINI_PROFILE || NET_PROFILE_ENABLE
+			RecordPacketSendStatistics(pData, len);
+	#endif
+
+			// Datagrams are coalesced and sent with a single sendmmsg call from PollWork.
+			// Only wake up the poll if it is blocked on another thread and this starts a new batch.
+			const bool bStartsBatch = pSI->outgoingAddressed.empty();
+			pSI->outgoingAddressed.push_back(SOutgoingAddressedData());
+			pSI->outgoingAddressed.back().nLength = len;
+			pSI->outgoingAddressed.back().addr = addr;
+			memcpy(pSI->outgoingAddressed.back().data, pData, len);
+			if (bStartsBatch && CryGetCurrentThreadId() != m_pollThreadId)
+			{
+				WakeUp();
+			}
+			return true;
+		}
+	}
+	return false;
+}
+
+bool CSocketIOManagerEpoll::RequestSendVoiceTo(SSocketID sockid, const TNetAddress& addr, const uint8* pData, size_t len)
+{
+	return RequestSendTo(sockid, addr, pData, len);
+}
+
+bool CSocketIOManagerEpoll::RequestConnect(SSocketID sockid, const TNetAddress& addr)
+{
+	if (SSocketInfo* pSI = GetSocketInfo(sockid))
+	{
+		if (pSI->pConnectTarget)
+		{
+			char address[_SS_MAXSIZE];
+			int addrlen = _SS_MAXSIZE;
+			if (ConvertAddr(addr, (CRYSOCKADDR*)address, &addrlen))
+			{
+				if (CrySock::connect(pSI->sock, (CRYSOCKADDR*)address, addrlen))
+				{
+					pSI->pConnectTarget->OnConnectException(OSErrorToSocketError(CrySock::GetLastSocketError()));
+				}
+				else
+					pSI->pConnectTarget->OnConnectComplete();
+			}
+			return true;
+		}
+	}
+	return false;
+}
+
+bool CSocketIOManagerEpoll::RequestAccept(SSocketID sockid)
+{
+	if (SSocketInfo* pSI = GetSocketInfo(sockid))
+	{
+		if (pSI->pAcceptTarget)
+		{
+			pSI->nListen++;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool CSocketIOManagerEpoll::RequestSend(SSocketID sockid, const uint8* pData, size_t len)
+{
+	if (SSocketInfo* pSI = GetSocketInfo(sockid))
+	{
+		if (pSI->pSendTarget)
+		{
+			while (len)
+			{
+				pSI->outgoing.push_back(SOutgoingData());
+				size_t ncp = std::min(len, size_t(MAX_UDP_PACKET_SIZE));
+				pSI->outgoing.back().nLength = ncp;
+				memcpy(pSI->outgoing.back().data, pData, ncp);
+				pData += ncp;
+				len -= ncp;
+			}
+			return true;
+		}
+	}
+	return false;
+}
+
+bool CSocketIOManagerEpoll::RequestRecv(SSocketID sockid)
+{
+	if (SSocketInfo* pSI = GetSocketInfo(sockid))
+	{
+		if (pSI->pRecvTarget)
+		{
+			pSI->nRecv++;
+			return true;
+		}
+	}
+	return false;
+}
+
+#endif
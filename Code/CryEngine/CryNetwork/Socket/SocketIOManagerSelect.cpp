@@ -229,6 +229,9 @@ int CSocketIOManagerSelect::PollWork(bool& performedWork)
 					memset(psnSock, 0, sizeof(*psnSock));
 					psnSock->sin_family = AF_INET;
 				}
+	#endif
+	#if NET_MINI_PROFILE || NET_PROFILE_ENABLE
+				RecordSyscallStatistics(false);
 	#endif
 				r = CrySock::recvfrom(si.sock, buffer, MAX_UDP_PACKET_SIZE, 0, (CRYSOCKADDR*)address, &addrlen);
 				switch (r)
@@ -256,6 +259,9 @@ int CSocketIOManagerSelect::PollWork(bool& performedWork)
 			}
 			if (si.nRecv)
 			{
+	#if NET_MINI_PROFILE || NET_PROFILE_ENABLE
+				RecordSyscallStatistics(false);
+	#endif
 				r = recv(si.sock, buffer, MAX_UDP_PACKET_SIZE, 0);
 				switch (r)
 				{
@@ -305,6 +311,9 @@ int CSocketIOManagerSelect::PollWork(bool& performedWork)
 			bool done = false;
 			while (!done && !si.outgoing.empty())
 			{
+	#if NET_MINI_PROFILE || NET_PROFILE_ENABLE
+				RecordSyscallStatistics(true);
+	#endif
 				r = CrySock::send(si.sock, (char*)si.outgoing.front().data, si.outgoing.front().nLength, 0);
 				switch (r)
 				{
@@ -335,6 +344,9 @@ int CSocketIOManagerSelect::PollWork(bool& performedWork)
 				int _addrlen = _SS_MAXSIZE;
 				if (ConvertAddr(si.outgoingAddressed.front().addr, (CRYSOCKADDR*)address, &_addrlen))
 				{
+	#if NET_MINI_PROFILE || NET_PROFILE_ENABLE
+					RecordSyscallStatistics(true);
+	#endif
 					r = CrySock::sendto(si.sock, (char*)si.outgoingAddressed.front().data, si.outgoingAddressed.front().nLength, 0, (CRYSOCKADDR*)address, _addrlen);
 					switch (r)
 					{
@@ -566,6 +578,9 @@ delaysend:
 						sockaddr_in_p2p* inP2PSock = (sockaddr_in_p2p*)address;
 						inP2PSock->sin_vport = htons(UDPP2P_VPORT);
 					}
+	#endif
+	#if NET_MINI_PROFILE || NET_PROFILE_ENABLE
+					RecordSyscallStatistics(true);
 	#endif
 					int r = CrySock::sendto(pSI->sock, (char*)pData, len, 0, (CRYSOCKADDR*)address, addrlen);
 					switch (r)
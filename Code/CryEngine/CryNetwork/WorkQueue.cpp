@@ -2,10 +2,230 @@
 
 #include "StdAfx.h"
 #include "WorkQueue.h"
+#include <CryThreading/IThreadManager.h>
+#include <CrySystem/CryUnitTest.h>
 
-void CWorkQueue::FlushEmpty()
+//////////////////////////////////////////////////////////////////////////
+// net_benchmark_work_queue: compares the locked CWorkQueue (as used for m_fromGame_otherThreadQueue before)
+// against CMPSCWorkQueue, with n producer threads adding to one queue which is flushed by the calling thread
+namespace WorkQueueBenchmark
 {
-	DoNothingOp nothing;
-	m_jobQueue.Flush(nothing);
-	Empty();
+struct STarget : public CMultiThreadRefCount
+{
+	STarget() : m_nExecuted(0) {}
+	bool IsDead() const      { return false; }
+	void Execute(int nValue) { ++m_nExecuted; } // consumer only
+	volatile int m_nExecuted;
+};
+
+// same lock type as NetFastMutex
+struct SLockedQueue
+{
+	void Add(STarget* pTarget, int nValue)
+	{
+		CryAutoLock<CryCriticalSection> lock(m_lock);
+		m_queue.Add(&STarget::Execute, pTarget, nValue);
+	}
+	void Flush()
+	{
+		CryAutoLock<CryCriticalSection> lock(m_lock);
+		m_queue.Flush(true);
+	}
+	static const char* GetName() { return "CWorkQueue + lock"; }
+
+	CryCriticalSection m_lock;
+	CWorkQueue         m_queue;
+};
+
+struct SLockFreeQueue
+{
+	void Add(STarget* pTarget, int nValue) { m_queue.Add(&STarget::Execute, pTarget, nValue); }
+	void Flush()                           { m_queue.Flush(true); }
+	static const char* GetName()           { return "CMPSCWorkQueue"; }
+
+	CMPSCWorkQueue m_queue;
+};
+
+template<class TQueue>
+class CProducer : public IThread
+{
+public:
+	CProducer(TQueue& queue, STarget* pTarget, int nNumItems, volatile bool& bStart)
+		: m_queue(queue), m_pTarget(pTarget), m_nNumItems(nNumItems), m_bStart(bStart) {}
+
+	virtual void ThreadEntry()
+	{
+		while (!m_bStart)
+			CrySleep(0);
+		for (int i = 0; i < m_nNumItems; ++i)
+			m_queue.Add(m_pTarget, i);
+	}
+
+private:
+	TQueue&        m_queue;
+	STarget*       m_pTarget;
+	int            m_nNumItems;
+	volatile bool& m_bStart;
+};
+
+template<class TQueue>
+float Run(int nNumProducers, int nNumItemsPerProducer)
+{
+	std::unique_ptr<TQueue> pQueue(new TQueue);
+	_smart_ptr<STarget> pTarget = new STarget;
+	volatile bool bStart = false;
+
+	std::vector<std::unique_ptr<CProducer<TQueue>>> producers(nNumProducers);
+	for (int i = 0; i < nNumProducers; ++i)
+	{
+		producers[i].reset(new CProducer<TQueue>(*pQueue, pTarget, nNumItemsPerProducer, bStart));
+		if (!gEnv->pThreadManager->SpawnThread(producers[i].get(), "NetWorkQueueBenchmark_%d", i))
+		{
+			NetWarning("net_benchmark_work_queue: failed to spawn producer thread %d", i);
+			producers[i].reset();
+		}
+	}
+
+	int nNumExpected = 0;
+	for (int i = 0; i < nNumProducers; ++i)
+		nNumExpected += producers[i] ? nNumItemsPerProducer : 0;
+
+	// the consumer flushes continuously like the net thread under load
+	const CTimeValue startTime = gEnv->pTimer->GetAsyncTime();
+	bStart = true;
+	while (pTarget->m_nExecuted < nNumExpected)
+		pQueue->Flush();
+	const CTimeValue endTime = gEnv->pTimer->GetAsyncTime();
+
+	for (int i = 0; i < nNumProducers; ++i)
+	{
+		if (producers[i])
+			gEnv->pThreadManager->JoinThread(producers[i].get(), eJM_Join);
+	}
+
+	const float fMs = (endTime - startTime).GetMilliSeconds();
+	NetLogAlways("  %-20s %8.2f ms, %8.1f items/ms", TQueue::GetName(), fMs, fMs > 0.f ? nNumExpected / fMs : 0.f);
+	return fMs;
+}
 }
+
+void RunWorkQueueBenchmark(int nNumProducers, int nNumItemsPerProducer)
+{
+	NetLogAlways("Work queue benchmark: %d producers, %d items each", nNumProducers, nNumItemsPerProducer);
+	const float fLocked = WorkQueueBenchmark::Run<WorkQueueBenchmark::SLockedQueue>(nNumProducers, nNumItemsPerProducer);
+	const float fLockFree = WorkQueueBenchmark::Run<WorkQueueBenchmark::SLockFreeQueue>(nNumProducers, nNumItemsPerProducer);
+	if (fLockFree > 0.f)
+		NetLogAlways("  speedup: %.2fx", fLocked / fLockFree);
+}
+
+#if defined(CRY_UNIT_TESTING)
+
+CRY_UNIT_TEST_SUITE(NetWorkQueue)
+{
+	struct SItemBase
+	{
+		virtual ~SItemBase() {}
+		virtual void Check(std::vector<int>& nextSequence) const = 0;
+	};
+
+	template<size_t PayloadSize>
+	struct SItem : public SItemBase
+	{
+		SItem(int nProducer, int nSequence) : m_nProducer(nProducer), m_nSequence(nSequence)
+		{
+			memset(m_payload, nSequence & 0xff, PayloadSize);
+		}
+
+		// items of one producer have to arrive complete and in the order they were added
+		virtual void Check(std::vector<int>& nextSequence) const
+		{
+			CRY_UNIT_TEST_CHECK_EQUAL(m_nSequence, nextSequence[m_nProducer]);
+			CRY_UNIT_TEST_CHECK_EQUAL(m_payload[0], uint8(m_nSequence & 0xff));
+			CRY_UNIT_TEST_CHECK_EQUAL(m_payload[PayloadSize - 1], uint8(m_nSequence & 0xff));
+			nextSequence[m_nProducer] = m_nSequence + 1;
+		}
+
+		int   m_nProducer;
+		int   m_nSequence;
+		uint8 m_payload[PayloadSize];
+	};
+
+	typedef CMPSCPolymorphicQueue<SItemBase> TQueue;
+
+	class CProducer : public IThread
+	{
+	public:
+		CProducer(TQueue& queue, int nId, int nNumItems) : m_queue(queue), m_nId(nId), m_nNumItems(nNumItems) {}
+
+		virtual void ThreadEntry()
+		{
+			// every fourth item is large, so the ring wraps often and fills up while the consumer lags
+			for (int i = 0; i < m_nNumItems; ++i)
+			{
+				if ((i & 3) == 3)
+					m_queue.Emplace<SItem<2000>>(m_nId, i);
+				else
+					m_queue.Emplace<SItem<12>>(m_nId, i);
+			}
+		}
+
+	private:
+		TQueue& m_queue;
+		int     m_nId;
+		int     m_nNumItems;
+	};
+
+	struct SConsumer
+	{
+		SConsumer(int nNumProducers) : m_nextSequence(nNumProducers, 0), m_nNumExecuted(0) {}
+		void operator()(SItemBase* p)
+		{
+			p->Check(m_nextSequence);
+			++m_nNumExecuted;
+		}
+
+		std::vector<int> m_nextSequence;
+		int              m_nNumExecuted;
+	};
+
+	CRY_UNIT_TEST(CUT_MPSCPolymorphicQueueConcurrentProducers)
+	{
+		const int kNumProducers = 4;
+		const int kNumItems = 2000;
+
+		std::unique_ptr<TQueue> pQueue(new TQueue);
+		std::unique_ptr<CProducer> producers[kNumProducers];
+		for (int i = 0; i < kNumProducers; ++i)
+		{
+			producers[i].reset(new CProducer(*pQueue, i, kNumItems));
+			if (!gEnv->pThreadManager->SpawnThread(producers[i].get(), "UnitTest_MPSCQueue_%d", i))
+			{
+				CRY_UNIT_TEST_ASSERT(!"Failed to spawn producer thread");
+				producers[i]->ThreadEntry();
+				producers[i].reset();
+			}
+		}
+
+		// the consumer sleeps now and then, so items also go through the overflow while producers keep adding
+		SConsumer consumer(kNumProducers);
+		for (int nRound = 0; consumer.m_nNumExecuted < kNumProducers * kNumItems; ++nRound)
+		{
+			pQueue->Flush(consumer);
+			if ((nRound & 15) == 0)
+				CrySleep(1);
+		}
+
+		for (int i = 0; i < kNumProducers; ++i)
+		{
+			if (producers[i])
+				gEnv->pThreadManager->JoinThread(producers[i].get(), eJM_Join);
+		}
+
+		CRY_UNIT_TEST_CHECK_EQUAL(consumer.m_nNumExecuted, kNumProducers * kNumItems);
+		for (int i = 0; i < kNumProducers; ++i)
+			CRY_UNIT_TEST_CHECK_EQUAL(consumer.m_nextSequence[i], kNumItems);
+		CRY_UNIT_TEST_ASSERT(pQueue->Empty());
+	}
+}
+
+#endif // CRY_UNIT_TESTING
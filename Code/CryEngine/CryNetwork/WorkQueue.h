@@ -7,6 +7,7 @@
 
 #include <queue>
 #include "PolymorphicQueue.h"
+#include "MPSCPolymorphicQueue.h"
 
 template<class T>
 inline bool IsDead(const _smart_ptr<T>& pI)
@@ -15,7 +16,10 @@ inline bool IsDead(const _smart_ptr<T>& pI)
 }
 
 // a queue of things that need to be done
-class CWorkQueue
+// TQueue is the storage for the items: CPolymorphicQueue (single threaded, see CWorkQueue)
+// or CMPSCPolymorphicQueue (any thread may add, one thread flushes, see CMPSCWorkQueue)
+template<template<class> class TQueue>
+class CWorkQueueT
 {
 public:
 	void Flush(bool rt)
@@ -27,8 +31,14 @@ public:
 			m_jobQueue.Flush(e);
 	}
 
-	void FlushEmpty();
-	void Swap(CWorkQueue& wq)
+	void FlushEmpty()
+	{
+		DoNothingOp nothing;
+		m_jobQueue.Flush(nothing);
+		Empty();
+	}
+	// not supported by CMPSCWorkQueue
+	void Swap(CWorkQueueT& wq)
 	{
 		m_jobQueue.Swap(wq.m_jobQueue);
 	}
@@ -52,7 +62,7 @@ private:
 		virtual void Execute() = 0;
 		virtual ~IJob() {}
 	};
-	CPolymorphicQueue<IJob> m_jobQueue;
+	TQueue<IJob> m_jobQueue;
 
 	template<class T, class U>
 	class CClassJob : public IJob
@@ -232,7 +242,7 @@ private:
 	class CAtSyncItem : public IJob
 	{
 	public:
-		CAtSyncItem() : m_pItem(0) {}
+		CAtSyncItem(INetAtSyncItem* pItem, U* pCls) : m_pItem(pItem), m_pCls(pCls) {}
 		~CAtSyncItem()
 		{
 			if (m_pItem)
@@ -251,12 +261,6 @@ private:
 				}
 			}
 		}
-		void SetItem(INetAtSyncItem* pItem, U* pCls)
-		{
-			NET_ASSERT(!m_pItem);
-			m_pItem = pItem;
-			m_pCls = pCls;
-		}
 
 	private:
 		CAtSyncItem(const CAtSyncItem&);
@@ -269,6 +273,8 @@ private:
 	class CAtSyncItemWithFollowup : public CAtSyncItem<K>
 	{
 	public:
+		CAtSyncItemWithFollowup(INetAtSyncItem* pItem, K* pCls, void (U::* func)(), U* pFollowUp) : CAtSyncItem<K>(pItem, pCls), m_func(func), m_pCls(pFollowUp) {}
+
 		void Execute()
 		{
 			CAtSyncItem<K>::Execute();
@@ -276,13 +282,6 @@ private:
 				((*m_pCls).*m_func)();
 		}
 
-		CAtSyncItemWithFollowup* SetFollowup(void (U::* func)(), _smart_ptr<U> pFollowUp)
-		{
-			m_func = func;
-			m_pCls = pFollowUp;
-			return this;
-		}
-
 	private:
 		void (U::* m_func)();
 		_smart_ptr<U> m_pCls;
@@ -344,15 +343,22 @@ public:
 	template<class U>
 	void Add(INetAtSyncItem* pItem, U* pCls)
 	{
+		// constructed in place, a CMPSCWorkQueue may run the item as soon as it is added
 		if (pItem)
-			m_jobQueue.Add<CAtSyncItem<U>>()->SetItem(pItem, pCls);
+			m_jobQueue.template Emplace<CAtSyncItem<U>>(pItem, pCls);
 	}
 	template<class K, class U>
 	void Add(INetAtSyncItem* pItem, K* pCls, U* pCls2, void (U::* func)())
 	{
 		if (pItem)
-			m_jobQueue.Add<CAtSyncItemWithFollowup<U, K>>()->SetFollowup(func, pCls2)->SetItem(pItem, pCls);
+			m_jobQueue.template Emplace<CAtSyncItemWithFollowup<U, K>>(pItem, pCls, func, pCls2);
 	}
 };
 
+typedef CWorkQueueT<CPolymorphicQueue>     CWorkQueue;
+typedef CWorkQueueT<CMPSCPolymorphicQueue> CMPSCWorkQueue;
+
+// contention microbenchmark of CWorkQueue + lock vs. CMPSCWorkQueue, see net_benchmark_work_queue
+void RunWorkQueueBenchmark(int nNumProducers, int nNumItemsPerProducer);
+
 #endif
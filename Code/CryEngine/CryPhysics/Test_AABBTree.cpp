@@ -0,0 +1,219 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "StdAfx.h"
+#include <CrySystem/CryUnitTest.h>
+
+#include "bvtree.h"
+#include "aabbtree.h"
+#include "geometry.h"
+#include "trimesh.h"
+#include "raygeom.h"
+
+#if defined(CRY_UNIT_TESTING)
+
+CRY_UNIT_TEST_SUITE(AABBTree)
+{
+	enum
+	{
+		kGridSize    = 64,  // terrain-like ground, uniformly tessellated
+		kPropCount   = 256, // boxes crowded into one corner, where a midpoint split wastes most nodes
+		kRayCount    = 1024,
+	};
+
+	// deterministic value in [0,1)
+	float Hash01(uint32 n)
+	{
+		n = (n ^ 61) ^ (n >> 16);
+		n *= 9;
+		n ^= n >> 4;
+		n *= 0x27d4eb2d;
+		n ^= n >> 15;
+		return (n & 0xffffff) * (1.0f / 0x1000000);
+	}
+
+	// a 64x64m ground with a cluster of small props, similar in shape to a static level chunk
+	struct SLevelMesh
+	{
+		SLevelMesh()
+		{
+			for (int y = 0; y <= kGridSize; ++y)
+			{
+				for (int x = 0; x <= kGridSize; ++x)
+					vertices.push_back(Vec3((float)x, (float)y, Hash01(y * (kGridSize + 1) + x) * 0.5f));
+			}
+			for (int y = 0; y < kGridSize; ++y)
+			{
+				for (int x = 0; x < kGridSize; ++x)
+				{
+					const uint16 i0 = y * (kGridSize + 1) + x, i1 = i0 + 1, i2 = i0 + kGridSize + 1, i3 = i2 + 1;
+					const uint16 quad[] = { i0, i1, i3, i0, i3, i2 };
+					indices.insert(indices.end(), quad, quad + 6);
+				}
+			}
+
+			static const uint16 boxIndices[] = {
+				0, 2, 1, 1, 2, 3, 4, 5, 6, 5, 7, 6, 0, 1, 4, 1, 5, 4,
+				2, 6, 3, 3, 6, 7, 0, 4, 2, 2, 4, 6, 1, 3, 5, 3, 7, 5
+			};
+			for (int i = 0; i < kPropCount; ++i)
+			{
+				const Vec3 center(4.0f + Hash01(i * 3) * 8.0f, 4.0f + Hash01(i * 3 + 1) * 8.0f, 0.5f + Hash01(i * 3 + 2) * 3.0f);
+				const Vec3 size(0.1f + Hash01(i + 1000) * 0.3f);
+				const uint16 nFirst = (uint16)vertices.size();
+				for (int j = 0; j < 8; ++j)
+					vertices.push_back(center + Vec3(j & 1 ? size.x : -size.x, j & 2 ? size.y : -size.y, j & 4 ? size.z : -size.z));
+				for (uint16 index : boxIndices)
+					indices.push_back(nFirst + index);
+			}
+		}
+
+		IGeometry* Create(int flags)
+		{
+			return gEnv->pPhysicalWorld->GetGeomManager()->CreateMesh(&vertices[0], &indices[0], nullptr, nullptr, (int)indices.size() / 3, flags);
+		}
+
+		std::vector<Vec3>   vertices;
+		std::vector<uint16> indices;
+	};
+
+	const int k_meshFlags = mesh_AABB | mesh_multicontact1;
+
+	// half the rays come down onto the ground, the other half go sideways through the props
+	void GetRay(int i, Vec3& origin, Vec3& dir)
+	{
+		if (i & 1)
+		{
+			origin.Set(Hash01(i * 2) * kGridSize, Hash01(i * 2 + 1) * kGridSize, 10.0f);
+			dir.Set(Hash01(i + 7000) - 0.5f, Hash01(i + 9000) - 0.5f, -20.0f);
+		}
+		else
+		{
+			origin.Set(0.0f, 2.0f + Hash01(i * 2) * 12.0f, 0.6f + Hash01(i * 2 + 1) * 3.0f);
+			dir.Set(20.0f, Hash01(i + 7000) * 4.0f - 2.0f, 0.0f);
+		}
+	}
+
+	// distance to the closest hit along the ray, -1 for a miss
+	float CastRay(IGeometry* pMesh, int i)
+	{
+		Vec3 origin, dir;
+		GetRay(i, origin, dir);
+		CRayGeom aray(origin, dir);
+		geom_world_data gwd, gwdRay;
+		intersection_params ip;
+		geom_contact* pContacts;
+		float closest = -1.0f;
+		for (int j = pMesh->Intersect(&aray, &gwd, &gwdRay, &ip, pContacts) - 1; j >= 0; --j)
+		{
+			const float dist = (pContacts[j].pt - origin).len();
+			closest = closest < 0 ? dist : min(closest, dist);
+		}
+		return closest;
+	}
+
+	CAABBTree* GetAABBTree(IGeometry* pMesh)
+	{
+		CBVTree* pTree = static_cast<CTriMesh*>(pMesh)->GetBVTree();
+		return pTree && pTree->GetType() == BVT_AABB ? static_cast<CAABBTree*>(pTree) : nullptr;
+	}
+
+	CRY_UNIT_TEST(CUT_AABBTreeSAHMatchesMidpoint)
+	{
+		SLevelMesh level;
+		IGeometry* pMidpoint = level.Create(k_meshFlags);
+		IGeometry* pSAH = level.Create(k_meshFlags | mesh_AABB_SAH);
+		CRY_UNIT_TEST_ASSERT(pMidpoint && pSAH);
+
+		CAABBTree* pMidpointTree = GetAABBTree(pMidpoint);
+		CAABBTree* pSAHTree = GetAABBTree(pSAH);
+		CRY_UNIT_TEST_ASSERT(pMidpointTree && !pMidpointTree->m_bSAH);
+		CRY_UNIT_TEST_ASSERT(pSAHTree && pSAHTree->m_bSAH);
+		CRY_UNIT_TEST_CHECK_EQUAL(pSAHTree->SanityCheck(), 1);
+
+		// only the tree shape differs, every ray must find the same closest hit
+		int nHits = 0;
+		for (int i = 0; i < kRayCount; ++i)
+		{
+			const float distMidpoint = CastRay(pMidpoint, i);
+			const float distSAH = CastRay(pSAH, i);
+			CRY_UNIT_TEST_CHECK_EQUAL(distMidpoint < 0, distSAH < 0);
+			if (distMidpoint >= 0 && distSAH >= 0)
+			{
+				CRY_UNIT_TEST_CHECK_CLOSE(distMidpoint, distSAH, 0.001f);
+				++nHits;
+			}
+		}
+		CRY_UNIT_TEST_ASSERT(nHits > kRayCount / 2);
+
+		gEnv->pPhysicalWorld->GetGeomManager()->DestroyGeometry(pSAH);
+		gEnv->pPhysicalWorld->GetGeomManager()->DestroyGeometry(pMidpoint);
+	}
+
+	// build time
+	CRY_UNIT_BENCHMARK(BM_AABBTreeBuildMidpoint)
+	{
+		static SLevelMesh s_level;
+		IGeometry* pMesh = s_level.Create(k_meshFlags);
+		CRY_UNIT_BENCHMARK_KEEP(pMesh);
+		gEnv->pPhysicalWorld->GetGeomManager()->DestroyGeometry(pMesh);
+	}
+
+	CRY_UNIT_BENCHMARK(BM_AABBTreeBuildSAH)
+	{
+		static SLevelMesh s_level;
+		IGeometry* pMesh = s_level.Create(k_meshFlags | mesh_AABB_SAH);
+		CRY_UNIT_BENCHMARK_KEEP(pMesh);
+		gEnv->pPhysicalWorld->GetGeomManager()->DestroyGeometry(pMesh);
+	}
+
+	// query speed, the node count (memory) of both trees is logged once per run
+	struct SAABBTreeRayBenchmark : public CryUnitTest::SBenchmark
+	{
+		SAABBTreeRayBenchmark(int flags) : m_flags(flags), m_pMesh(nullptr) {}
+
+		virtual void Init() override
+		{
+			m_pMesh = SLevelMesh().Create(m_flags);
+			if (CAABBTree* pTree = GetAABBTree(m_pMesh))
+				CryLog("AABB tree%s: %d nodes, %d bytes", m_flags & mesh_AABB_SAH ? " (SAH)" : "", pTree->m_nNodes, pTree->m_nNodes * (int)sizeof(AABBnode));
+		}
+		virtual void Done() override
+		{
+			gEnv->pPhysicalWorld->GetGeomManager()->DestroyGeometry(m_pMesh);
+			m_pMesh = nullptr;
+		}
+
+		void CastRays()
+		{
+			float sum = 0;
+			for (int i = 0; i < kRayCount; ++i)
+				sum += CastRay(m_pMesh, i);
+			CRY_UNIT_BENCHMARK_KEEP(sum);
+		}
+
+		int        m_flags;
+		IGeometry* m_pMesh;
+	};
+
+	struct SAABBTreeRayBenchmarkMidpoint : public SAABBTreeRayBenchmark
+	{
+		SAABBTreeRayBenchmarkMidpoint() : SAABBTreeRayBenchmark(k_meshFlags) {}
+	};
+
+	struct SAABBTreeRayBenchmarkSAH : public SAABBTreeRayBenchmark
+	{
+		SAABBTreeRayBenchmarkSAH() : SAABBTreeRayBenchmark(k_meshFlags | mesh_AABB_SAH) {}
+	};
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_AABBTreeRaysMidpoint, SAABBTreeRayBenchmarkMidpoint)
+	{
+		CastRays();
+	}
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_AABBTreeRaysSAH, SAABBTreeRayBenchmarkSAH)
+	{
+		CastRays();
+	}
+}
+
+#endif // CRY_UNIT_TESTING
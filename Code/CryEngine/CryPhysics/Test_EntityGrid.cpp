@@ -0,0 +1,180 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "StdAfx.h"
+#include <CrySystem/CryUnitTest.h>
+
+#include "bvtree.h"
+#include "geometry.h"
+#include "rigidbody.h"
+#include "physicalplaceholder.h"
+#include "physicalentity.h"
+#include "geoman.h"
+#include "physicalworld.h"
+
+#if defined(CRY_UNIT_TESTING)
+
+CRY_UNIT_TEST_SUITE(EntityGrid)
+{
+	enum
+	{
+		kGridSize     = 256,  // cells per axis
+		kQueryCount   = 1024,
+	};
+	const float k_cellSize = 4.0f;
+
+	// deterministic value in [0,1)
+	float Hash01(uint32 n)
+	{
+		n = (n ^ 61) ^ (n >> 16);
+		n *= 9;
+		n ^= n >> 4;
+		n *= 0x27d4eb2d;
+		n ^= n >> 15;
+		return (n & 0xffffff) * (1.0f / 0x1000000);
+	}
+
+	// a private world, so that the bodies neither show up in nor get stepped by the game's world
+	struct SGridWorld
+	{
+		SGridWorld(int nBodies)
+		{
+			pWorld = new CPhysicalWorld(gEnv->pLog);
+			pWorld->SetupEntityGrid(2, Vec3(ZERO), kGridSize, kGridSize, k_cellSize, k_cellSize);
+
+			IGeomManager* pGeoman = pWorld->GetGeomManager();
+			primitives::box box;
+			box.Basis.SetIdentity();
+			box.bOriented = 0;
+			box.center.zero();
+			box.size.Set(0.5f, 0.5f, 0.5f);
+			phys_geometry* pGeom = pGeoman->RegisterGeometry(pGeoman->CreatePrimitive(primitives::box::type, &box));
+			pGeom->pGeom->Release();
+
+			pe_geomparams gp;
+			gp.mass = 1.0f;
+			bodies.resize(nBodies);
+			origins.resize(nBodies);
+			for (int i = 0; i < nBodies; ++i)
+			{
+				// stay clear of the grid border, so that all cells are regular ones
+				origins[i].Set(128.0f + Hash01(i * 2) * (kGridSize * k_cellSize - 256.0f), 128.0f + Hash01(i * 2 + 1) * (kGridSize * k_cellSize - 256.0f), 1.0f);
+				pe_params_pos pp;
+				pp.pos = origins[i];
+				bodies[i] = pWorld->CreatePhysicalEntity(PE_RIGID, &pp);
+				bodies[i]->AddGeometry(pGeom, &gp);
+			}
+			pGeoman->UnregisterGeometry(pGeom);
+		}
+
+		~SGridWorld()
+		{
+			pWorld->Release();
+		}
+
+		// moves every body along its own direction, small steps keep crossing into adjacent cells
+		void Move(int nStep, float stepLength)
+		{
+			pe_params_pos pp;
+			for (size_t i = 0; i < bodies.size(); ++i)
+			{
+				const float angle = Hash01((uint32)i + 50000) * gf_PI2;
+				const float dist = (nStep & 15) * stepLength;
+				pp.pos = origins[i] + Vec3(cos_tpl(angle), sin_tpl(angle), 0) * dist;
+				bodies[i]->SetParams(&pp);
+			}
+		}
+
+		CPhysicalWorld*                pWorld;
+		std::vector<IPhysicalEntity*> bodies;
+		std::vector<Vec3>             origins;
+	};
+
+	// checks that the body owns one thunk per cell of its grid rectangle, and that each thunk is linked in that cell
+	bool IsGridRegistrationValid(CPhysicalWorld* pWorld, IPhysicalEntity* pBody)
+	{
+		CPhysicalPlaceholder* pobj = static_cast<CPhysicalEntity*>(pBody);
+		SEntityGrid& grid = pWorld->m_entgrid;
+		const int ix0 = pobj->m_ig[0].x, ix1 = pobj->m_ig[1].x, iy0 = pobj->m_ig[0].y, iy1 = pobj->m_ig[1].y;
+		if (ix1 < ix0 || iy1 < iy0)
+			return false;
+
+		std::set<int> cells;
+		int nThunks = 0;
+		for (int ithunk = pobj->m_iGThunk0; ithunk; ithunk = pWorld->m_gthunks[ithunk].inextOwned, ++nThunks)
+		{
+			if (pWorld->m_gthunks[ithunk].pent != pobj || nThunks > (ix1 - ix0 + 1) * (iy1 - iy0 + 1))
+				return false;
+			// walk back to the head of the cell list, it stores the cell coordinates
+			int ifirst = ithunk;
+			for (int nSteps = 0; !pWorld->m_gthunks[ifirst].bFirstInCell; ++nSteps)
+			{
+				if (nSteps > 100000)
+					return false;
+				ifirst = (int)pWorld->m_gthunks[ifirst].iprev;
+			}
+			const int iprev = (int)pWorld->m_gthunks[ifirst].iprev;
+			const int ix = iprev & 1023, iy = iprev >> 10 & 1023;
+			if (ix < ix0 || ix > ix1 || iy < iy0 || iy > iy1 || grid.cells[Vec2i(ix, iy) * grid.stride] != ifirst)
+				return false;
+			cells.insert(iy << 10 | ix);
+		}
+		return nThunks == (ix1 - ix0 + 1) * (iy1 - iy0 + 1) && cells.size() == (size_t)nThunks;
+	}
+
+	CRY_UNIT_TEST(CUT_EntityGridIncrementalReposition)
+	{
+		SGridWorld world(2000);
+		IPhysicalEntity** pList;
+
+		for (int nStep = 0; nStep < 48; ++nStep)
+		{
+			// alternate short moves into adjacent cells with jumps that leave the old rectangle entirely
+			world.Move(nStep, nStep & 1 ? 0.9f : 7.0f);
+
+			for (size_t i = 0; i < world.bodies.size(); ++i)
+				CRY_UNIT_TEST_ASSERT(IsGridRegistrationValid(world.pWorld, world.bodies[i]));
+		}
+
+		// every body is found around its position exactly once
+		for (size_t i = 0; i < world.bodies.size(); i += 7)
+		{
+			pe_status_pos sp;
+			world.bodies[i]->GetStatus(&sp);
+			const int nFound = world.pWorld->GetEntitiesInBox(sp.pos - Vec3(0.25f), sp.pos + Vec3(0.25f), pList, ent_rigid | ent_sleeping_rigid, 0);
+			CRY_UNIT_TEST_CHECK_EQUAL((int)std::count(pList, pList + nFound, world.bodies[i]), 1);
+		}
+		const Vec3 worldSize(kGridSize * k_cellSize, kGridSize * k_cellSize, 100.0f);
+		CRY_UNIT_TEST_CHECK_EQUAL(world.pWorld->GetEntitiesInBox(Vec3(ZERO), worldSize, pList, ent_rigid | ent_sleeping_rigid, 0), (int)world.bodies.size());
+	}
+
+	// grid reinsertion of 10k moving rigid bodies
+	struct SEntityGridBenchmark : public CryUnitTest::SBenchmark
+	{
+		SEntityGridBenchmark() : m_pWorld(nullptr), m_nStep(0) {}
+
+		virtual void Init() override { m_pWorld = new SGridWorld(10000); m_nStep = 0; }
+		virtual void Done() override { SAFE_DELETE(m_pWorld); }
+
+		SGridWorld* m_pWorld;
+		int         m_nStep;
+	};
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_EntityGridMove10k, SEntityGridBenchmark)
+	{
+		m_pWorld->Move(m_nStep++, 0.9f);
+	}
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_EntityGridBoxQueries10k, SEntityGridBenchmark)
+	{
+		IPhysicalEntity** pList;
+		int nFound = 0;
+		for (int i = 0; i < kQueryCount; ++i)
+		{
+			const Vec3 center(16.0f + Hash01(i * 2 + 90000) * (kGridSize * k_cellSize - 32.0f), 16.0f + Hash01(i * 2 + 90001) * (kGridSize * k_cellSize - 32.0f), 1.0f);
+			nFound += m_pWorld->pWorld->GetEntitiesInBox(center - Vec3(8.0f), center + Vec3(8.0f), pList, ent_rigid | ent_sleeping_rigid, 0);
+		}
+		CRY_UNIT_BENCHMARK_KEEP(nFound);
+	}
+}
+
+#endif // CRY_UNIT_TESTING
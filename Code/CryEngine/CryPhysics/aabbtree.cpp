@@ -9,13 +9,14 @@
 #include "aabbtree.h"
 #include "trimesh.h"
 
-void CAABBTree::SetParams(int nMinTrisPerNode, int nMaxTrisPerNode, float skipdim, const Matrix33 &Basis, int planeOptimisation)
+void CAABBTree::SetParams(int nMinTrisPerNode, int nMaxTrisPerNode, float skipdim, const Matrix33 &Basis, int planeOptimisation, int bSAH)
 {
 	m_nMinTrisPerNode = nMinTrisPerNode; m_nMaxTrisPerNode = nMaxTrisPerNode;
 	m_maxSkipDim = skipdim;
 	m_Basis = Basis;
 	m_bOriented = m_Basis.IsIdentity()^1;
 	m_axisSplitMask = planeOptimisation ? 0 : -1;
+	m_bSAH = bSAH ? 1:0;
 }
 
 float CAABBTree::Build(CGeometry *pMeshIn)
@@ -171,47 +172,52 @@ float CAABBTree::BuildNode(int iNode, int iTriStart,int nTris, Vec3 center,Vec3
 		allowedAxis = (size[i0] > size[i1]) ? i0 : i1;
 	}
 
-	for(iAxis=0;iAxis<3;iAxis++) {
-		if (size[iAxis]<mindim || (negmask(-allowedAxis-1)&notzero(iAxis-allowedAxis))) { // ignore this axis if blocked, or size is too small
-			axdiff[iAxis] = -1E10f; //nTrisAx[iAxis] = 0;
-			continue;
+	int iAxisSAH;
+	if (m_bSAH && ChooseSplitSAH(iTriStart,nTris, center,size, bbtri, allowedAxis, iAxisSAH,cx)) {
+		iAxis = iAxisSAH; iPart = 2;	// centroids vs the chosen plane
+	} else {
+		for(iAxis=0;iAxis<3;iAxis++) {
+			if (size[iAxis]<mindim || (negmask(-allowedAxis-1)&notzero(iAxis-allowedAxis))) { // ignore this axis if blocked, or size is too small
+				axdiff[iAxis] = -1E10f; //nTrisAx[iAxis] = 0;
+				continue;
+			}
+			axis = m_Basis.GetRow(iAxis); cx = center[iAxis];
+			bounds[0][0]=bounds[1][0]=bounds[2][0] = -size[iAxis]; 
+			bounds[0][1]=bounds[1][1]=bounds[2][1] = size[iAxis]; 
+			numtris[0]=numtris[1]=numtris[2] = 0;
+			for(i=iTriStart;i<iTriStart+nTris;i++) {
+				/*for(j=0,c.zero(),xlim[0]=size[iAxis],xlim[1]=-size[iAxis]; j<3; j++) {
+					c += m_pMesh->m_pVertices[m_pMesh->m_pIndices[i*3+j]];
+					x = axis*m_pMesh->m_pVertices[m_pMesh->m_pIndices[i*3+j]]-cx;
+					xlim[0] = min(xlim[0],x); xlim[1] = max(xlim[1],x);
+				}*/
+				xlim[0] = bbtri[i][0][iAxis] - cx;	// min
+				xlim[1] = bbtri[i][1][iAxis] - cx;	// max
+				c = bbtri[i][2][iAxis] - cx;
+				if (xlim[1]>=0.f) { // mode j=0: group all triangles that are entirely below center
+					bounds[0][1] = min(bounds[0][1],xlim[0]); numtris[0]++;
+				} else
+					bounds[0][0] = max(bounds[0][0],xlim[1]);
+				if (xlim[0]>=0.f) { // mode j=1: group all triangles that are entirely above center
+					bounds[1][1] = min(bounds[1][1],xlim[0]); numtris[1]++;
+				} else
+					bounds[1][0] = max(bounds[1][0],xlim[1]);
+				if (c>=0.f) { // mode j=2: sort triangles basing on centroids only
+					bounds[2][1] = min(bounds[2][1],xlim[0]); numtris[2]++;
+				} else
+					bounds[2][0] = max(bounds[2][0],xlim[1]);
+			}
+			for(i=0;i<3;i++) diff[i] = bounds[i][1]-bounds[i][0]-size[iAxis]*((isneg(numtris[i]-m_nMinTrisPerNode)|isneg(nTris-numtris[i]-m_nMinTrisPerNode))*8);
+			iMode[iAxis] = idxmax3(diff); //nTrisAx[iAxis] = numtris[iMode[iAxis]];
+			axdiff[iAxis] = diff[iMode[iAxis]]*size[dec_mod3[iAxis]]*size[inc_mod3[iAxis]];
 		}
+
+		iAxis = idxmax3(axdiff);
 		axis = m_Basis.GetRow(iAxis); cx = center[iAxis];
-		bounds[0][0]=bounds[1][0]=bounds[2][0] = -size[iAxis]; 
-		bounds[0][1]=bounds[1][1]=bounds[2][1] = size[iAxis]; 
-		numtris[0]=numtris[1]=numtris[2] = 0;
-		for(i=iTriStart;i<iTriStart+nTris;i++) {
-			/*for(j=0,c.zero(),xlim[0]=size[iAxis],xlim[1]=-size[iAxis]; j<3; j++) {
-				c += m_pMesh->m_pVertices[m_pMesh->m_pIndices[i*3+j]];
-				x = axis*m_pMesh->m_pVertices[m_pMesh->m_pIndices[i*3+j]]-cx;
-				xlim[0] = min(xlim[0],x); xlim[1] = max(xlim[1],x);
-			}*/
-			xlim[0] = bbtri[i][0][iAxis] - cx;	// min
-			xlim[1] = bbtri[i][1][iAxis] - cx;	// max
-			c = bbtri[i][2][iAxis] - cx;
-			if (xlim[1]>=0.f) { // mode j=0: group all triangles that are entirely below center
-				bounds[0][1] = min(bounds[0][1],xlim[0]); numtris[0]++;
-			} else
-				bounds[0][0] = max(bounds[0][0],xlim[1]);
-			if (xlim[0]>=0.f) { // mode j=1: group all triangles that are entirely above center
-				bounds[1][1] = min(bounds[1][1],xlim[0]); numtris[1]++;
-			} else
-				bounds[1][0] = max(bounds[1][0],xlim[1]);
-			if (c>=0.f) { // mode j=2: sort triangles basing on centroids only
-				bounds[2][1] = min(bounds[2][1],xlim[0]); numtris[2]++;
-			} else
-				bounds[2][0] = max(bounds[2][0],xlim[1]);
-		}
-		for(i=0;i<3;i++) diff[i] = bounds[i][1]-bounds[i][0]-size[iAxis]*((isneg(numtris[i]-m_nMinTrisPerNode)|isneg(nTris-numtris[i]-m_nMinTrisPerNode))*8);
-		iMode[iAxis] = idxmax3(diff); //nTrisAx[iAxis] = numtris[iMode[iAxis]];
-		axdiff[iAxis] = diff[iMode[iAxis]]*size[dec_mod3[iAxis]]*size[inc_mod3[iAxis]];
+		// Choose which type of triangle we are looking for 0->1, 1->0, 2->2
+		iPart = iMode[iAxis]^1^(iMode[iAxis]>>1);
 	}
 
-	iAxis = idxmax3(axdiff);
-	axis = m_Basis.GetRow(iAxis); cx = center[iAxis];
-	// Choose which type of triangle we are looking for 0->1, 1->0, 2->2
-	iPart = iMode[iAxis]^1^(iMode[iAxis]>>1);
-
 	for(i=j=iTriStart;i<iTriStart+nTris;i++) {
 #if 0
 		if ((unsigned)iAxis >= 3)
@@ -270,6 +276,52 @@ float CAABBTree::BuildNode(int iNode, int iTriStart,int nTris, Vec3 center,Vec3
 	return volume;
 }
 
+int CAABBTree::ChooseSplitSAH(int iTriStart,int nTris, const Vec3 &center,const Vec3 &size, Vec3 (*bbtri)[3], int allowedAxis, int &iAxisSplit,float &xSplit)
+{
+	// bin triangle centroids along each axis and pick the plane with the lowest surface area cost (areas of children weighted by their tri counts)
+	const int nBins = 16;
+	int i,iAxis,iBin,nl,nBin[nBins];
+	Vec3 bmin[nBins],bmax[nBins],ptmin,ptmax,sz;
+	float areaRight[nBins],cost,costBest=1E30f,x0,rstep,step;
+	float mindim = max(max(size.x,size.y),size.z)*0.001f;
+
+	for(iAxis=0;iAxis<3;iAxis++) {
+		if (size[iAxis]<mindim || allowedAxis>=0 && iAxis!=allowedAxis)
+			continue;
+		x0 = center[iAxis]-size[iAxis]; step = size[iAxis]*(2.0f/nBins); rstep = 1.0f/step;
+		for(iBin=0;iBin<nBins;iBin++) {
+			nBin[iBin] = 0; bmin[iBin].Set(1E30f,1E30f,1E30f); bmax[iBin].Set(-1E30f,-1E30f,-1E30f);
+		}
+		for(i=iTriStart;i<iTriStart+nTris;i++) {
+			iBin = min(nBins-1,max(0,float2int((bbtri[i][2][iAxis]-x0)*rstep-0.5f)));
+			nBin[iBin]++;
+			bmin[iBin].x = min(bmin[iBin].x,bbtri[i][0].x); bmax[iBin].x = max(bmax[iBin].x,bbtri[i][1].x);
+			bmin[iBin].y = min(bmin[iBin].y,bbtri[i][0].y); bmax[iBin].y = max(bmax[iBin].y,bbtri[i][1].y);
+			bmin[iBin].z = min(bmin[iBin].z,bbtri[i][0].z); bmax[iBin].z = max(bmax[iBin].z,bbtri[i][1].z);
+		}
+		ptmin.Set(1E30f,1E30f,1E30f); ptmax.Set(-1E30f,-1E30f,-1E30f);
+		for(iBin=nBins-1;iBin>0;iBin--) {	// areaRight[iBin] - the box of bins [iBin..nBins-1]
+			ptmin.x=min(ptmin.x,bmin[iBin].x); ptmin.y=min(ptmin.y,bmin[iBin].y); ptmin.z=min(ptmin.z,bmin[iBin].z);
+			ptmax.x=max(ptmax.x,bmax[iBin].x); ptmax.y=max(ptmax.y,bmax[iBin].y); ptmax.z=max(ptmax.z,bmax[iBin].z);
+			sz = ptmax-ptmin; areaRight[iBin] = max(0.0f, sz.x*sz.y+sz.y*sz.z+sz.z*sz.x);
+		}
+		ptmin.Set(1E30f,1E30f,1E30f); ptmax.Set(-1E30f,-1E30f,-1E30f);
+		for(iBin=nl=0;iBin<nBins-1;iBin++) {	// split between iBin and iBin+1
+			nl += nBin[iBin];
+			ptmin.x=min(ptmin.x,bmin[iBin].x); ptmin.y=min(ptmin.y,bmin[iBin].y); ptmin.z=min(ptmin.z,bmin[iBin].z);
+			ptmax.x=max(ptmax.x,bmax[iBin].x); ptmax.y=max(ptmax.y,bmax[iBin].y); ptmax.z=max(ptmax.z,bmax[iBin].z);
+			if (nl<max(1,m_nMinTrisPerNode) || nTris-nl<max(1,m_nMinTrisPerNode))
+				continue;
+			sz = ptmax-ptmin;
+			cost = max(0.0f, sz.x*sz.y+sz.y*sz.z+sz.z*sz.x)*nl + areaRight[iBin+1]*(nTris-nl);
+			if (cost<costBest) {
+				costBest = cost; iAxisSplit = iAxis; xSplit = x0+(iBin+1)*step;
+			}
+		}
+	}
+	return isneg(costBest-1E29f);
+}
+
 void CAABBTree::SetGeomConvex()
 {
 	for(int i=0;i<m_nNodes;i++)
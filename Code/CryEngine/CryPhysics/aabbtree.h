@@ -36,7 +36,7 @@ class CTriMesh;
 class CAABBTree : public CBVTree {
 public:
 	// cppcheck-suppress uninitMemberVar
-	CAABBTree() { m_pNodes=0; m_pTri2Node=0; m_maxDepth=64; }
+	CAABBTree() { m_pNodes=0; m_pTri2Node=0; m_maxDepth=64; m_bSAH=0; }
 	virtual ~CAABBTree() { 
 		if (m_pNodes) delete[] m_pNodes; m_pNodes=0; 
 		if (m_pTri2Node) delete[] m_pTri2Node; m_pTri2Node=0; 
@@ -47,8 +47,9 @@ public:
 	float Build(CGeometry *pMesh);
 	virtual void SetGeomConvex();
 
-	void SetParams(int nMinTrisPerNode,int nMaxTrisPerNode, float skipdim, const Matrix33 &Basis, int planeOptimisation=0);
+	void SetParams(int nMinTrisPerNode,int nMaxTrisPerNode, float skipdim, const Matrix33 &Basis, int planeOptimisation=0, int bSAH=0);
 	float BuildNode(int iNode, int iTriStart,int nTris, Vec3 center,Vec3 size, Vec3 (*bbtri)[3], int nDepth);
+	int ChooseSplitSAH(int iTriStart,int nTris, const Vec3 &center,const Vec3 &size, Vec3 (*bbtri)[3], int allowedAxis, int &iAxisSplit,float &xSplit);
 
 	virtual int PrepareForIntersectionTest(geometry_under_test *pGTest, CGeometry *pCollider,geometry_under_test *pGTestColl);
 	virtual void CleanupAfterIntersectionTest(geometry_under_test *pGTest);
@@ -96,6 +97,7 @@ public:
 	Matrix33 m_Basis;
 	int16 m_bOriented;
 	int16 m_axisSplitMask;
+	int m_bSAH;
 	int *m_pTri2Node,m_nBitsLog;
 	int m_nMaxTrisPerNode,m_nMinTrisPerNode;
 	int m_nMaxTrisInNode;
@@ -101,14 +101,18 @@ int CHeightfieldBV::GetNodeContents(int iNode, BV *pBVCollider,int bColliderUsed
 	int iStart,nCols,nRows,nPrims,ix,iy,i,j;
 	float minz;
 
+	if (m_PatchStart.x<0) // no patch has been built yet
+		return 0;
 	if (pBVCollider->type==box::type)	{
 		project_box_on_grid((box*)(primitive*)*pBVCollider,m_phf, (geometry_under_test*)((intptr_t)pGTest & -((intptr_t)bColliderLocal^1)), 
 			ix,iy,nCols,nRows,minz);
-		nCols = min(ix+nCols, m_PatchSize.x);
-		nRows = min(iy+nRows, m_PatchSize.y);
 		ix &= ~(ix>>31); iy &= ~(iy>>31);
+		nCols = max(0, min(ix+nCols, m_PatchSize.x)-ix);
+		nRows = max(0, min(iy+nRows, m_PatchSize.y)-iy);
+		if (bColliderLocal>1)
+			minz = -1E10f;
 	} else {
-		nCols=m_PatchSize.x; nRows=m_PatchSize.y; ix=iy=0;
+		nCols=m_PatchSize.x; nRows=m_PatchSize.y; ix=iy=0; minz=-1E10f;
 	}
 
 	//if (m_phf->gettype(ix,iy)==-1)
@@ -116,13 +120,13 @@ int CHeightfieldBV::GetNodeContents(int iNode, BV *pBVCollider,int bColliderUsed
 
 	iStart = ix+iy*m_PatchSize.x;
 	if (!bColliderUsed) {
-		for(i=nPrims=0; i<nRows; i++,iStart+=m_PatchSize.x) {
+		for(i=nPrims=0; i<nRows; i++,iStart+=m_PatchSize.x) if (m_pRowMaxHeight[iy+i]>=minz) { // skip rows entirely below the collider
       char *primbuf = (char*)pGTest->primbuf;
 			nPrims += m_pMesh->GetPrimitiveList(iStart*2,nCols*2, pBVCollider->type,*pBVCollider,bColliderLocal, pGTest,pGTestOp,
                                           (primitive*)(primbuf+nPrims*pGTest->szprim), pGTest->idbuf+nPrims);
     }
 	} else {
-		for(i=nPrims=0; i<nRows; i++,iStart+=m_PatchSize.x)	for(j=0;j<nCols*2;j++) {
+		for(i=nPrims=0; i<nRows; i++,iStart+=m_PatchSize.x)	if (m_pRowMaxHeight[iy+i]>=minz) for(j=0;j<nCols*2;j++) {
 			int itri = iStart*2+j;
 			if (!(m_pUsedTriMap[itri>>5]>>(itri&31) & 1)) {
         char *primbuf = (char*)pGTest->primbuf;
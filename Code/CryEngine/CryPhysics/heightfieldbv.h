@@ -6,8 +6,8 @@
 
 class CHeightfieldBV : public CBVTree {
 public:
-	CHeightfieldBV() { m_pUsedTriMap=0; m_minHeight=0.f; m_maxHeight=0.f; m_pMesh=0; m_phf=0; }
-	virtual ~CHeightfieldBV() { if (m_pUsedTriMap) delete[] m_pUsedTriMap; }
+	CHeightfieldBV() { m_pUsedTriMap=0; m_pRowMaxHeight=0; m_minHeight=0.f; m_maxHeight=0.f; m_pMesh=0; m_phf=0; }
+	virtual ~CHeightfieldBV() { if (m_pUsedTriMap) delete[] m_pUsedTriMap; if (m_pRowMaxHeight) delete[] m_pRowMaxHeight; }
 	virtual int GetType() { return BVT_HEIGHTFIELD; }
 
 	virtual float Build(CGeometry *pGeom);
@@ -28,6 +28,7 @@ public:
 	Vec2i m_PatchSize;
 	float m_minHeight,m_maxHeight;
 	unsigned int *m_pUsedTriMap;
+	float *m_pRowMaxHeight; // max vertex height of each cell row of the current patch
 };
 
 struct InitHeightfieldGlobals { InitHeightfieldGlobals(); };
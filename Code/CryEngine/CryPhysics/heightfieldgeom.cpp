@@ -30,6 +30,7 @@ CHeightfield* CHeightfield::CreateHeightfield(heightfield *phf)
 	m_pTree = &m_Tree;
 
 	m_pVertices = strided_pointer<Vec3>(new Vec3[m_nVerticesAlloc = 32]);
+	m_Tree.m_pRowMaxHeight = new float[m_nVerticesAlloc];
 	m_pNormals = new Vec3[m_nTrisAlloc = 64];
 	m_pIndices = new index_t[m_nTrisAlloc*3];
 	m_pIds = new char[m_nTrisAlloc];
@@ -220,8 +221,9 @@ int CHeightfield::PrepareForIntersectionTest(geometry_under_test *pGTest, CGeome
 		m_nTris = sx*sy*2;
 		m_nMaxVertexValency = 6;
 		IF (m_nVerticesAlloc<m_nVertices, 0) {
-			delete [] m_pVertices.data;
+			delete [] m_pVertices.data; delete[] m_Tree.m_pRowMaxHeight;
 			m_pVertices = strided_pointer<Vec3>(new Vec3[m_nVerticesAlloc = (m_nVertices-1 & ~15)+16]);
+			m_Tree.m_pRowMaxHeight = new float[m_nVerticesAlloc];
 		}
 		IF (m_nTrisAlloc<m_nTris, 0) {
 			delete[] m_pIndices; delete[] m_pNormals; delete[] m_pIds; delete[] m_pTopology; delete[] m_Tree.m_pUsedTriMap;
@@ -234,12 +236,16 @@ int CHeightfield::PrepareForIntersectionTest(geometry_under_test *pGTest, CGeome
 		m_Tree.m_minHeight = m_Tree.m_maxHeight = heights[0];
 		for(j=0,pVtx=m_pVertices.data; j<=sy; j++) {
 			curx = m_hf.step.x*ix; cury = m_hf.step.y*(iy+j);
-			for(i=0; i<=sx; i++,pVtx++,curx+=m_hf.step.x) {
+			for(i=0,maxh=heights[j*(sx+1)]; i<=sx; i++,pVtx++,curx+=m_hf.step.x) {
 				pVtx->Set(curx,cury,heights[(i)+(j)*(sx+1)]) -= origin;
 				m_Tree.m_minHeight = min(m_Tree.m_minHeight, pVtx->z);
-				m_Tree.m_maxHeight = max(m_Tree.m_maxHeight, pVtx->z);
+				maxh = max(maxh, pVtx->z);
 			}
+			m_Tree.m_maxHeight = max(m_Tree.m_maxHeight, maxh);
+			m_Tree.m_pRowMaxHeight[j] = maxh;
 		}
+		for(j=0; j<sy; j++) // a cell row spans 2 vertex rows
+			m_Tree.m_pRowMaxHeight[j] = max(m_Tree.m_pRowMaxHeight[j],m_Tree.m_pRowMaxHeight[j+1]);
 
 		for(irow=i=itri=0,pIdx=m_pIndices,pTop=m_pTopology; irow<sy; irow++,i++)
 		for(icol=0; icol<sx; icol++,itri+=2,i++) {
@@ -65,6 +65,8 @@ CPhysicalEntity::CPhysicalEntity(CPhysicalWorld *pworld, IGeneralMemoryHeap* pHe
 	, m_bPermanent(1)
 	, m_bPrevPermanent(0)
 	, m_iGroup(-1)
+	, m_iLOD(0)
+	, m_timeLOD(0.0f)
 	, m_next_coll(nullptr)
 	, m_next_coll1(nullptr)
 	, m_next_coll2(nullptr)
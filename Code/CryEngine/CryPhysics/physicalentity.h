@@ -345,6 +345,8 @@ public:
 	int m_bPermanent		: 4;
 	int m_bPrevPermanent: 4;
 	int m_iGroup;
+	int m_iLOD;	// physics LOD level of the island in the last world step, negative if the island was skipped
+	float m_timeLOD; // time skipped by the physics LOD, added to the next step
 	CPhysicalEntity *m_next_coll,*m_next_coll1,*m_next_coll2;
 
 	Vec3 m_pos;
@@ -239,6 +239,10 @@ CPhysicalWorld::CPhysicalWorld(ILog *pLog) : m_nWorkerThreads(0)
 	m_vars.splashDist1 = 30.0f; m_vars.minSplashForce1 = 150000.0f; m_vars.minSplashVel1 = 10.0f;
 	m_vars.lastTimeStep = 0;
 	m_vars.numThreads = 2;
+	m_vars.nIslandBatchEnts = 8;
+	m_vars.lodDist = 0;
+	m_vars.lodSleepScale = 4.0f;
+	m_vars.bAsyncStep = 0;
 	m_vars.physCPU = 4;
 	m_vars.physWorkerCPU = 1;
 	m_vars.helperOffset.zero();
@@ -381,7 +385,7 @@ void SEntityGrid::Init()
 void CPhysicalWorld::Init()
 {
 	InitGeoman();
-	m_pTmpEntList=0; m_pTmpEntList1=0; m_pTmpEntList2=0; m_pGroupMass=0; m_pMassList = 0; m_pGroupIds = 0; m_pGroupNums = 0;
+	m_pTmpEntList=0; m_pTmpEntList1=0; m_pTmpEntList2=0; m_pGroupMass=0; m_pMassList = 0; m_pGroupIds = 0; m_pGroupNums = 0; m_pGroupSize = 0;
 	m_nEnts = 0; m_nEntsAlloc = 0; m_bEntityCountReserved = 0;
 	m_entgrid.Init();
 	m_gthunks = 0;
@@ -408,6 +412,8 @@ void CPhysicalWorld::Init()
 	m_nPlaceholders = m_nPlaceholderChunks = 0;
 	m_iLastPlaceholder = -1;
 	m_nProfiledEnts = 0;
+	m_nProfiledIslands = 0;
+	m_maskLODObservers = m_bLODStep = 0;
 	m_iSubstep = 0;
 	m_bWorldStep = 0;
 	m_nDynamicEntitiesDeleted = 0;
@@ -450,7 +456,7 @@ void CPhysicalWorld::Init()
 	m_pwiQueue = 0; m_lockPwiQueue = 0;
 	m_breakQueueHead=-1; m_breakQueueTail=0; m_breakQueueSz=m_breakQueueAlloc = 0;
 	m_breakQueue = 0; m_lockBreakQueue = 0;
-	m_pWaterMan = 0;
+	m_pWaterMan = 0; m_pCurWaterMan = 0;
 	m_idStep = 0;
 	m_nEntListAllocs = 0;
 	m_curGroupMass = 0;
@@ -623,6 +629,7 @@ void CPhysicalWorld::Shutdown(int bDeleteGeometries)
 	if (m_pMassList) delete[] m_pMassList; m_pMassList = 0;
 	if (m_pGroupIds) delete[] m_pGroupIds; m_pGroupIds = 0;
 	if (m_pGroupNums) delete[] m_pGroupNums; m_pGroupNums = 0;
+	if (m_pGroupSize) delete[] m_pGroupSize; m_pGroupSize = 0;
 	if (m_pEntsById) delete[] m_pEntsById; m_pEntsById = 0;	m_nIdsAlloc = 0;
 	m_cubeMapStatic.Free();
 	m_cubeMapDynamic.Free();
@@ -1262,6 +1269,7 @@ IPhysicalEntity* CPhysicalWorld::CreatePhysicalEntity(pe_type type, float lifeTi
 			ReallocateList(m_pMassList,m_nEnts-1,nEntsAllocNew);
 			ReallocateList(m_pGroupIds,m_nEnts-1,nEntsAllocNew);
 			ReallocateList(m_pGroupNums,m_nEnts-1,nEntsAllocNew);
+			ReallocateList(m_pGroupSize,m_nEnts-1,nEntsAllocNew);
 			m_nEntsAlloc = nEntsAllocNew;
 		}
 	} else if (!m_lockQueue || get_iCaller()>=MAX_PHYS_THREADS && iForeignData!=0x5AFE) {
@@ -1528,6 +1536,7 @@ DEBUG_BREAK;
 			ReallocateList(m_pMassList,0,m_nEntsAlloc);
 			ReallocateList(m_pGroupIds,0,m_nEntsAlloc);
 			ReallocateList(m_pGroupNums,0,m_nEntsAlloc);
+			ReallocateList(m_pGroupSize,0,m_nEntsAlloc);
 			m_threadData[0].szList=m_threadData[MAX_PHYS_THREADS].szList = m_nEntsAlloc;
 		}
 	} else if (pent->m_iSimClass>=0) {
@@ -1558,6 +1567,7 @@ int CPhysicalWorld::ReserveEntityCount(int nNewEnts)
 		ReallocateList(m_pMassList,m_nEnts-1,m_nEntsAlloc);
 		ReallocateList(m_pGroupIds,m_nEnts-1,m_nEntsAlloc);
 		ReallocateList(m_pGroupNums,m_nEnts-1,m_nEntsAlloc);
+		ReallocateList(m_pGroupSize,m_nEnts-1,m_nEntsAlloc);
 	}
 	return m_nEntsAlloc;
 }
@@ -2101,8 +2111,10 @@ void CPhysicalWorld::ProcessIslandSolverResults(int i, int iter, float groupTime
 	#ifdef ENTITY_PROFILER_ENABLED
 
 	i1 = CryGetTicks()-iticks0;
-	if (m_vars.bProfileGroups && iticks0>0)
+	if (m_vars.bProfileGroups && iticks0>0) {
 		m_grpProfileData[13].nTicks += i1;
+		AddIslandProfileInfo(m_pTmpEntList1[i],i1,nEnts,nContacts);
+	}
 	if (m_vars.bProfileEntities>0 && iticks0>0) {
 		for(pent=m_pTmpEntList1[i],j=0; pent; pent=pent->m_next_coll)
 			j += -pent->m_iSimClass>>31 & 1;
@@ -2179,21 +2191,92 @@ int CPhysicalWorld::ReadDelayedSolverResults(CMemStream &stm, float &dt,float &E
 	return iGroup;
 }
 
+void CPhysicalWorld::SetLODObserver(int iSlot, const Vec3 *pPos)
+{
+	if ((unsigned int)iSlot>=(unsigned int)CRY_ARRAY_COUNT(m_posLODObservers))
+		return;
+	if (pPos)
+		m_posLODObservers[iSlot] = *pPos;
+	m_maskLODObservers = m_maskLODObservers & ~(1<<iSlot) | (pPos ? 1<<iSlot : 0);
+}
+
+int CPhysicalWorld::ApplyIslandLOD(int nGroups, float time_interval)
+{
+	// the distances are measured in entity grid cells, between the observers' cells and the entities' grid rectangles, 
+	// so the cost is a few integer ops per island member and observer
+	int i,j,iobs,nobs,lod,lodIsland,lodCells;
+	float timeAcc;
+	Vec2i obs[CRY_ARRAY_COUNT(m_posLODObservers)];
+	CPhysicalEntity *pent;
+
+	for(iobs=nobs=0; iobs<CRY_ARRAY_COUNT(m_posLODObservers); iobs++) if (m_maskLODObservers & 1<<iobs) {
+		Vec3 pt = m_entgrid.vecToGrid(m_posLODObservers[iobs]-m_entgrid.origin);
+		obs[nobs++].set(float2int(pt.x*m_entgrid.stepr.x-0.5f), float2int(pt.y*m_entgrid.stepr.y-0.5f));
+	}
+	lodCells = max(1,float2int(m_vars.lodDist*max(m_entgrid.stepr.x,m_entgrid.stepr.y)));
+
+	for(i=j=0; i<nGroups; i++) {
+		for(pent=m_pTmpEntList1[i],lodIsland=2,timeAcc=0; pent; pent=pent->m_next_coll) {
+			if (pent->m_ig[0].x<=GRID_REG_LAST || GetGrid(pent)!=&m_entgrid)
+				lod = 0;
+			else for(iobs=0,lod=2; iobs<nobs; iobs++)
+				lod = min(lod, max(0, max(max(obs[iobs].x-pent->m_ig[1].x, pent->m_ig[0].x-obs[iobs].x), 
+																	max(obs[iobs].y-pent->m_ig[1].y, pent->m_ig[0].y-obs[iobs].y)))/lodCells);
+			lodIsland = min(lodIsland,lod);
+			if (pent->m_iLOD<0)
+				timeAcc = max(timeAcc, pent->m_timeLOD);
+		}
+		timeAcc = min(timeAcc, time_interval*((1<<lodIsland)-1));
+
+		if (lodIsland && timeAcc+time_interval<time_interval*((1<<lodIsland)-0.5f)) {
+			// skip the island this step; its entities are treated as finished for all substeps
+			for(pent=m_pTmpEntList1[i]; pent; pent=pent->m_next_coll) {
+				pent->m_iLOD = -lodIsland; pent->m_timeLOD = timeAcc+time_interval;
+				pent->m_iGroup = -1; pent->m_bMoved = 3;
+				if (pent->m_iSimClass<3 && !pent->m_next_coll2) {
+					pent->m_next_coll2=(CPhysicalEntity*)m_pMovedEnts; m_pMovedEnts=pent;
+				}
+			}
+			continue;
+		}
+		for(pent=m_pTmpEntList1[i]; pent; pent=pent->m_next_coll) {
+			pent->m_iLOD = lodIsland; pent->m_timeLOD = timeAcc;
+			if (timeAcc>0)
+				pent->StartStep(time_interval+timeAcc);
+		}
+		// keep the group order (see wait_for_ent)
+		m_pTmpEntList1[j]=m_pTmpEntList1[i]; m_pGroupMass[j]=m_pGroupMass[i]; m_pGroupSize[j]=m_pGroupSize[i]; 
+		m_pGroupNums[m_pGroupIds[j]=m_pGroupIds[i]] = j; j++;
+	}
+	return j;
+}
+
 void CPhysicalWorld::ProcessNextEntityIsland(float time_interval, int ipass, int iter, int &bAllGroupsFinished, int iCaller)
 {
 	int i,j,n,nEnts,nAnimatedObjects,nBodies,bStepValid,bGroupInvisible;
-	float Ebefore,groupTimeStep,fixedDamping,maxGroupFriction;
+	float Ebefore,groupTimeStep,fixedDamping,maxGroupFriction,islandTimeStep;
 	CPhysicalEntity *pent,*pent_next,*phead,**pentlist;
 
+	int igroup=0,igroupEnd=0;
+
 	do {
-		{ WriteLock lock(m_lockNextEntityGroup);
+		if (igroup>=igroupEnd) { 
+			// small islands are taken in runs to keep the threads off the lock; runs preserve the group order, so the
+			// lower groups an island can wait for (see wait_for_ent) are always taken before it
+			WriteLock lock(m_lockNextEntityGroup);
 			if (m_iCurGroup>=m_nGroups)
 				break;
-			i = m_iCurGroup++;
+			igroup = m_iCurGroup;
+			for(igroupEnd=igroup+1,n=m_pGroupSize[igroup]; igroupEnd<m_nGroups && n+m_pGroupSize[igroupEnd]<=m_vars.nIslandBatchEnts; n+=m_pGroupSize[igroupEnd++]);
+			m_iCurGroup = igroupEnd;
 		}
+		i = igroup++;
 		m_threadData[iCaller].groupMass=m_curGroupMass = m_pGroupMass[i]-m_maxGroupMass*isneg(m_maxGroupMass-m_pGroupMass[i]);
 		m_threadData[iCaller].bGroupInvisible = 0;
-		groupTimeStep = time_interval*(ipass^1); nAnimatedObjects = 0; fixedDamping = -1.0f;
+		islandTimeStep = time_interval;
+		if (m_bLODStep) for(pent=m_pTmpEntList1[i]; pent; pent=pent->m_next_coll) // add the time skipped by the LOD
+			islandTimeStep = max(islandTimeStep, time_interval+pent->m_timeLOD*isneg(-pent->m_iLOD));
+		groupTimeStep = islandTimeStep*(ipass^1); nAnimatedObjects = 0; fixedDamping = -1.0f;
 		Ebefore = 0.0f;
 		for(phead=m_pTmpEntList1[i],bGroupInvisible=pef_invisible,maxGroupFriction=100.0f; phead; phead=phead->m_next_coll)	{
 			ReadLock lockcol(phead->m_lockColliders);
@@ -2224,7 +2307,7 @@ void CPhysicalWorld::ProcessNextEntityIsland(float time_interval, int ipass, int
 
 		if (ipass==0) {
 			for(pent=m_pTmpEntList1[i]; pent; pent=pent->m_next_coll)
-				groupTimeStep = min(groupTimeStep, pent->GetMaxTimeStep(time_interval));
+				groupTimeStep = min(groupTimeStep, pent->GetMaxTimeStep(islandTimeStep));
 			for(pent=m_pTmpEntList1[i],bStepValid=1,phead=0; pent; pent=pent_next) {
 				pent_next=pent->m_next_coll;
 				if (pent->m_iSimClass<3 || pent->GetType()==PE_ARTICULATED)
@@ -2373,6 +2456,19 @@ void CPhysicalWorld::ProcessNextIndependentEntity(float time_interval, int bSkip
 	} while(true);
 }
 
+void CPhysicalWorld::ProcessNextWaterMan(float time_interval)
+{
+	CWaterMan *pWaterMan;
+	do {
+		{ WriteLock lock(m_lockNextEntityGroup);
+			if (!(pWaterMan = m_pCurWaterMan))
+				break;
+			m_pCurWaterMan = pWaterMan->m_next;
+		}
+		pWaterMan->TimeStep(time_interval);
+	} while(true);
+}
+
 void CPhysicalWorld::ProcessBreakingEntities(float time_interval)
 {
 	WriteLock lock3(m_lockDeformingEntsList);
@@ -2404,6 +2500,7 @@ void CPhysicalWorld::ThreadProc(int ithread, SPhysTask *pTask)
 			case 3: ProcessNextLivingEntity(m_rq.time_interval, m_rq.bSkipFlagged, ithread); break;
 			case 4: ProcessNextIndependentEntity(m_rq.time_interval, m_rq.bSkipFlagged, ithread); break;
 			case 5: ProcessBreakingEntities(m_rq.time_interval); break;
+			case 6: ProcessNextWaterMan(m_rq.time_interval); break;
 		}
 		m_threadDone[ithread-FIRST_WORKER_THREAD].Set();
 	}
@@ -2481,6 +2578,7 @@ void CPhysicalWorld::TimeStep(float time_interval, int flags)
 						ReallocateList(m_pMassList,m_nEnts-1,m_nEntsAlloc);
 						ReallocateList(m_pGroupIds,m_nEnts-1,m_nEntsAlloc);
 						ReallocateList(m_pGroupNums,m_nEnts-1,m_nEntsAlloc);
+						ReallocateList(m_pGroupSize,m_nEnts-1,m_nEntsAlloc);
 					}	break;
 				case 5:
 					DestroyPhysicalEntity((IPhysicalEntity*)pent, *(int*)(pQueueSlots[i]+j+sizeof(int)*2+sizeof(void*)),1);
@@ -2569,8 +2667,10 @@ void CPhysicalWorld::TimeStep(float time_interval, int flags)
 				pent->StartStep(time_interval);
 		}
 		m_grpProfileData[13].nCallsLast = 0;
+		m_nProfiledIslands = 0;
 
 		if (flags & ent_rigid && time_interval>0) {
+			m_bLODStep = m_maskLODObservers && m_vars.lodDist>0;
 			if (m_pTypedEnts[2]) do { // make as many substeps as required
 				bAllGroupsFinished = 1;	m_pAuxStepEnt = 0;
 				m_pGroupNums[m_nEntsAlloc-1] = -1; // special group for rigid bodies w/ infinite mass
@@ -2643,7 +2743,7 @@ void CPhysicalWorld::TimeStep(float time_interval, int flags)
 					for(i=0;i<nGroups;i++) {
 						for(ptail=m_pTmpEntList1[i]; ptail->m_next_coll; ptail=ptail->m_next_coll)
 							ptail->m_bMoved=0; ptail->m_bMoved=0;
-						for(phead=m_pTmpEntList1[i]; phead; phead=phead->m_next_coll)
+						for(phead=m_pTmpEntList1[i],m_pGroupSize[i]=0; phead; phead=phead->m_next_coll,m_pGroupSize[i]++)
 							for(j=0,n=phead->GetColliders(pentlist); j<n; j++) if (pentlist[j]->GetMassInv()>0) {
 								if (pentlist[j]->m_bMoved==1 && !(m_bUpdateOnlyFlagged & (pentlist[j]->m_flags^pef_update))) {
 									ptail->m_next_coll = pentlist[j]; ptail = pentlist[j]; ptail->m_next_coll = 0;
@@ -2652,6 +2752,9 @@ void CPhysicalWorld::TimeStep(float time_interval, int flags)
 							}
 					}
 
+					if (m_bLODStep && (iter|ipass)==0)
+						nGroups = ApplyIslandLOD(nGroups,time_interval);
+
 					m_nGroups=nGroups; m_maxGroupMass=m;
 					m_rq.iter=iter;	m_iCurGroup=0;
 					THREAD_TASK(ipass, ProcessNextEntityIsland(time_interval,ipass,iter,bAllGroupsFinished,0));
@@ -2679,9 +2782,9 @@ void CPhysicalWorld::TimeStep(float time_interval, int flags)
 			m_updateTimes[1] = m_updateTimes[2] = m_timePhysics;
 		}
 
-		{ ReadLock lockwm(m_lockWaterMan);
-			for(CWaterMan *pWaterMan=m_pWaterMan; pWaterMan; pWaterMan=pWaterMan->m_next)
-				pWaterMan->TimeStep(time_interval);
+		{ ReadLock lockwm(m_lockWaterMan); // water areas are independent and can step in parallel
+			m_pCurWaterMan = m_pWaterMan;
+			THREAD_TASK(6, ProcessNextWaterMan(time_interval));
 		}
 		for(i=0;i<m_nProfiledEnts;i++) {
 			m_pEntProfileData[i].nTicksStep &= -m_pEntProfileData[i].nTicks>>31;
@@ -2905,33 +3008,69 @@ void CPhysicalWorld::DetachEntityGridThunks(CPhysicalPlaceholder *pobj)
 		SEntityGrid &grid = *GetGrid(pobj);
 		int ithunk,ithunk_next,ithunk_last,icell,iprev,inext;
 		for(ithunk=pobj->m_iGThunk0; ithunk; ithunk=ithunk_next) {
-			TrackThunkUsageFree(ithunk);
 			ithunk_next = m_gthunks[ithunk].inextOwned;
-			iprev=m_gthunks[ithunk].iprev; inext=m_gthunks[ithunk].inext;
-			m_gthunks[ithunk].pent = 0;
+			UnlinkGridThunk(grid, ithunk);
+			ithunk_last = ithunk;
+		}
+		m_gthunks[ithunk_last].inextOwned = m_iFreeGThunk0;
+		m_iFreeGThunk0 = pobj->m_iGThunk0;
+		pobj->m_iGThunk0 = 0;
+	}
+}
+
+void CPhysicalWorld::UnlinkGridThunk(SEntityGrid &grid, int ithunk)
+{
+	int icell,iprev=m_gthunks[ithunk].iprev,inext=m_gthunks[ithunk].inext;
+	TrackThunkUsageFree(ithunk);
+	m_gthunks[ithunk].pent = 0;
 #if defined(__clang__)
 	#pragma clang diagnostic push
 	#pragma clang diagnostic ignored "-Wconstant-conversion"
 #endif
-			m_gthunks[ithunk].inext=m_gthunks[ithunk].iprev = -1;
+	m_gthunks[ithunk].inext=m_gthunks[ithunk].iprev = -1;
 #if defined(__clang__)
 	#pragma clang diagnostic pop
 #endif
-			m_gthunks[inext].iprev = iprev & -(int)inext>>31;
-			m_gthunks[inext].bFirstInCell = m_gthunks[ithunk].bFirstInCell;
-			if (m_gthunks[ithunk].bFirstInCell) {
-				icell = grid.size.x*grid.size.y;
-				if (grid.cells[icell]!=ithunk)
-					icell = Vec2i(iprev&1023,iprev>>10&1023)*grid.stride;
-				grid.cells[(unsigned int)icell] = inext;
-			}	else
-				m_gthunks[iprev].inext = inext;
-			ithunk_last = ithunk;
+	m_gthunks[inext].iprev = iprev & -(int)inext>>31;
+	m_gthunks[inext].bFirstInCell = m_gthunks[ithunk].bFirstInCell;
+	if (m_gthunks[ithunk].bFirstInCell) {
+		icell = grid.size.x*grid.size.y;
+		if (grid.cells[icell]!=ithunk)
+			icell = Vec2i(iprev&1023,iprev>>10&1023)*grid.stride;
+		grid.cells[(unsigned int)icell] = inext;
+	}	else
+		m_gthunks[iprev].inext = inext;
+}
+
+// Detaches the entity's thunks from the cells outside its new rectangle, if it overlaps the current one (see the in-place
+// bbox update in RepositionEntity for the owned list order). The thunks of the shared cells are stored in cellThunks 
+// (indexed by the new rectangle) and removed from the owned list. Returns 0 if the caller should detach all thunks instead
+int CPhysicalWorld::DetachEntityGridThunksOutside(CPhysicalPlaceholder *pobj, const int *igx,const int *igy, int *cellThunks,int szCellThunks)
+{
+	const int ix0=pobj->m_ig[0].x,ix1=pobj->m_ig[1].x, iy0=pobj->m_ig[0].y,iy1=pobj->m_ig[1].y;
+	const int nx=igx[1]-igx[0]+1, n=nx*(igy[1]-igy[0]+1);
+	int ix,iy,ithunk,ithunk_next,nOld;
+	if (ix0<-1 || iy0<-1 || ix1<ix0 || iy1<iy0 || n>szCellThunks || 
+			max(ix0,igx[0])>min(ix1,igx[1]) || max(iy0,igy[0])>min(iy1,igy[1]))
+		return 0;
+	for(ithunk=pobj->m_iGThunk0,nOld=0; ithunk; ithunk=m_gthunks[ithunk].inextOwned,nOld++);
+	if (nOld!=(ix1-ix0+1)*(iy1-iy0+1))
+		return 0;
+
+	SEntityGrid &grid = *GetGrid(pobj);
+	memset(cellThunks, 0, n*sizeof(cellThunks[0]));
+	for(ix=ix1,ithunk=pobj->m_iGThunk0; ix>=ix0; ix--) for(iy=iy1; iy>=iy0; iy--,ithunk=ithunk_next) {
+		ithunk_next = m_gthunks[ithunk].inextOwned;
+		if (ix-igx[0]>=0 && igx[1]-ix>=0 && iy-igy[0]>=0 && igy[1]-iy>=0)
+			cellThunks[ix-igx[0]+(iy-igy[0])*nx] = ithunk;
+		else {
+			UnlinkGridThunk(grid, ithunk);
+			m_gthunks[ithunk].inextOwned = m_iFreeGThunk0;
+			m_iFreeGThunk0 = ithunk;
 		}
-		m_gthunks[ithunk_last].inextOwned = m_iFreeGThunk0;
-		m_iFreeGThunk0 = pobj->m_iGThunk0;
-		pobj->m_iGThunk0 = 0;
 	}
+	pobj->m_iGThunk0 = 0;
+	return 1;
 }
 #if defined(__GNUC__)
 #if __GNUC__ >= 4 && __GNUC__MINOR__ < 7
@@ -3099,7 +3238,7 @@ int CPhysicalWorld::GetFreeThunk()
 int CPhysicalWorld::RepositionEntity(CPhysicalPlaceholder *pobj, int flags, Vec3 *BBox, int bQueued)
 {
 	SEntityGrid *pgrid = GetGrid(pobj);
-	int i,j,igx[2],igy[2],igxInner[2],igyInner[2],igz[2],ix,iy,ithunk,ithunk0;
+	int i,j,igx[2],igy[2],igxInner[2],igyInner[2],igz[2],ix,iy,ithunk,ithunk0,cellThunks[64],bKeepThunks=0;
 	unsigned int n;
 	if ((unsigned int)pobj->m_iSimClass>=7u) return 0; // entity is frozen
 	int bGridLocked = 0;
@@ -3128,8 +3267,12 @@ int CPhysicalWorld::RepositionEntity(CPhysicalPlaceholder *pobj, int flags, Vec3
 					flags|=8; goto skiprepos; //pcurobj = pobj->m_pEntBuddy;
 				}
 				m_bGridThunksChanged = 1;
-				DetachEntityGridThunks(pobj);
 				n = (igx[1]-igx[0]+1)*(igy[1]-igy[0]+1);
+				// an entity moving into adjacent cells keeps the thunks of the cells it stays in
+				if (!(flags&4 | pobj->m_bOBBThunks | moveToEnd) && pgrid==&m_entgrid && pobj->m_iSimClass!=5 && n-1<(unsigned int)m_vars.nMaxEntityCells)
+					bKeepThunks = DetachEntityGridThunksOutside(pobj, igx,igy, cellThunks,CRY_ARRAY_COUNT(cellThunks));
+				if (!bKeepThunks)
+					DetachEntityGridThunks(pobj);
 				if (pobj->m_iSimClass!=5) {
 					if (n==0 || n>(unsigned int)m_vars.nMaxEntityCells) {
 						Vec3 pos = (pcurobj->m_BBox[0]+pcurobj->m_BBox[1])*0.5f;
@@ -3165,10 +3308,18 @@ int CPhysicalWorld::RepositionEntity(CPhysicalPlaceholder *pobj, int flags, Vec3
 							continue;
 					}
 					j = pgrid->getcell_safe(ix,iy);
-					if (!(ithunk = GetFreeThunk())) {
+					int bKept = bKeepThunks && (ithunk = cellThunks[ix-igx[0]+(iy-igy[0])*(igx[1]-igx[0]+1)]);
+					if (!bKept && !(ithunk = GetFreeThunk())) {
+						if (bKeepThunks) for(i=(igx[1]-igx[0]+1)*(igy[1]-igy[0]+1)-1; i>=0; i--) if (cellThunks[i]) { // let the next repositioning detach them
+							m_gthunks[cellThunks[i]].inextOwned = pcurobj->m_iGThunk0;
+							pcurobj->m_iGThunk0 = cellThunks[i];
+						}
 						flags|=8; goto skiprepos;
 					}
-					TrackThunkUsageAlloc(ithunk);
+					if (bKept)
+						cellThunks[ix-igx[0]+(iy-igy[0])*(igx[1]-igx[0]+1)] = 0;
+					else
+						TrackThunkUsageAlloc(ithunk);
 					pe_gridthunk * __restrict pNewGThunk = &m_gthunks[ithunk];
 
 					pNewGThunk->inextOwned = pcurobj->m_iGThunk0;
@@ -3177,7 +3328,9 @@ int CPhysicalWorld::RepositionEntity(CPhysicalPlaceholder *pobj, int flags, Vec3
 
 					int ithunkGrid = pgrid->cells[j];
 
-					if (!ithunkGrid || m_gthunks[ithunkGrid].iSimClass-5 & ~moveToEnd) {
+					if (bKept)
+						;	// already linked in this cell
+					else if (!ithunkGrid || m_gthunks[ithunkGrid].iSimClass-5 & ~moveToEnd) {
 						int& entGridEntry = pgrid->cells[(unsigned int)j];
 						pNewGThunk->bFirstInCell = 1;
 						pNewGThunk->iprev = ((iy & pgrid->size.y-1)<<10|ix & pgrid->size.x-1);
@@ -3952,6 +4105,7 @@ void CPhysicalWorld::DestroyDynamicEntities()
 		ReallocateList(m_pMassList,0,m_nEntsAlloc);
 		ReallocateList(m_pGroupIds,0,m_nEntsAlloc);
 		ReallocateList(m_pGroupNums,0,m_nEntsAlloc);
+		ReallocateList(m_pGroupSize,0,m_nEntsAlloc);
 	}
 }
 
@@ -4577,6 +4731,7 @@ void CPhysicalWorld::GetMemoryStatistics(ICrySizer *pSizer)
 		pSizer->AddObject(m_pMassList, m_nEntsAlloc*sizeof(m_pMassList[0]));
 		pSizer->AddObject(m_pGroupIds, m_nEntsAlloc*sizeof(m_pGroupIds[0]));
 		pSizer->AddObject(m_pGroupNums, m_nEntsAlloc*sizeof(m_pGroupNums[0]));
+		pSizer->AddObject(m_pGroupSize, m_nEntsAlloc*sizeof(m_pGroupSize[0]));
 		pSizer->AddObject(m_pEntsById, m_nIdsAlloc*sizeof(m_pEntsById[0]));
 		pSizer->AddObject(&m_entgrid.cells, GetGridSize(m_entgrid.cells, m_entgrid.size));
 		pSizer->AddObject(m_gthunks, m_thunkPoolSz*sizeof(m_gthunks[0]));
@@ -4650,6 +4805,27 @@ void CPhysicalWorld::GetMemoryStatistics(ICrySizer *pSizer)
 }
 
 
+void CPhysicalWorld::AddIslandProfileInfo(CPhysicalEntity *phead,int nTicks,int nEnts,int nContacts)
+{
+	if (m_nProfiledIslands==CRY_ARRAY_COUNT(m_islandProfileData) && nTicks<=m_islandProfileData[m_nProfiledIslands-1].nTicksLast)
+		return;
+
+	int i;
+	WriteLock lock(m_lockEntProfiler);
+	m_nProfiledIslands -= iszero(m_nProfiledIslands-(int)CRY_ARRAY_COUNT(m_islandProfileData));
+	for(i=m_nProfiledIslands; i>0 && m_islandProfileData[i-1].nTicksLast<nTicks; i--)
+		m_islandProfileData[i] = m_islandProfileData[i-1];
+	phys_profile_info &ppi = m_islandProfileData[i];
+	memset(&ppi, 0, sizeof(ppi));
+	ppi.pEntity = phead;
+	ppi.nTicksLast = nTicks;
+	ppi.nCallsLast = nEnts;
+	ppi.nCalls = nContacts;
+	ppi.id = phead->m_id;
+	ppi.pName = m_pRenderer ? m_pRenderer->GetForeignName(phead->m_pForeignData,phead->m_iForeignData,phead->m_iForeignFlags) : "noname";
+	m_nProfiledIslands++;
+}
+
 void CPhysicalWorld::AddEntityProfileInfo(CPhysicalEntity *pent,int nTicks)
 {
 	if (m_vars.bProfileGroups)
@@ -4926,12 +5102,11 @@ void CPhysicalWorld::ClearLoggedEvents()
 
 #ifdef PHYSWORLD_SERIALIZATION
 void SerializeGeometries(CPhysicalWorld *pWorld, const char *fname,int bSave);
-void SerializeWorld(CPhysicalWorld *pWorld, const char *fname,int bSave);
+int SerializeWorld(CPhysicalWorld *pWorld, const char *fname,int bSave);
 
 int CPhysicalWorld::SerializeWorld(const char *fname, int bSave)
 {
-	::SerializeWorld(this,fname,bSave);
-	return 1;
+	return ::SerializeWorld(this,fname,bSave);
 }
 int CPhysicalWorld::SerializeGeometries(const char *fname, int bSave)
 {
@@ -361,6 +361,8 @@ public:
 	}
 
 	virtual void TimeStep(float time_interval, int flags=ent_all|ent_deleted);
+	virtual void SetLODObserver(int iSlot, const Vec3 *pPos);
+	int ApplyIslandLOD(int nGroups, float time_interval);
 	virtual float GetPhysicsTime() { return m_timePhysics; }
 	virtual int GetiPhysicsTime() { return m_iTimePhysics; }
 	virtual void SetPhysicsTime(float time) {
@@ -388,7 +390,10 @@ public:
 		return RayWorldIntersection(rp, pNameTag, iCaller);
 	}
 	virtual int RayWorldIntersection(const SRWIParams &rp, const char *pNameTag="RayWorldIntersection(Physics)", int iCaller=get_iCaller_int());
+	virtual int RayWorldIntersectionBatch(const SRWIBatchParams &bp, const char *pNameTag="RayWorldIntersection(Batch)", int iCaller=get_iCaller_int());
 	virtual int TracePendingRays(int bDoTracing=1);
+	void QueueRay(const SRWIParams &rp, int iCaller);
+	int TraceRay(const SRWIParams &rp, const char *pNameTag, int iCaller, int bMarkSkipEnts);
 
 	void RayHeightfield(const Vec3 &org,Vec3 &dir, ray_hit *hits, int flags, int iCaller);
 	void RayWater(const Vec3 &org,const Vec3 &dir, struct entity_grid_checker &egc, int flags,int nMaxHits, ray_hit *hits);
@@ -429,6 +434,8 @@ public:
 	int ChangeEntitySimClass(CPhysicalEntity *pent, int bGridLocked);
 	int RepositionEntity(CPhysicalPlaceholder *pobj, int flags=3, Vec3 *BBox=0, int bQueued=0);
 	void DetachEntityGridThunks(CPhysicalPlaceholder *pobj);
+	void UnlinkGridThunk(SEntityGrid &grid, int ithunk);
+	int DetachEntityGridThunksOutside(CPhysicalPlaceholder *pobj, const int *igx,const int *igy, int *cellThunks,int szCellThunks);
 	void ScheduleForStep(CPhysicalEntity *pent, float time_interval);
 	CPhysicalEntity *CheckColliderListsIntegrity();
 
@@ -456,10 +463,12 @@ public:
 	}
 
 	void AddEntityProfileInfo(CPhysicalEntity *pent,int nTicks);
+	void AddIslandProfileInfo(CPhysicalEntity *phead,int nTicks,int nEnts,int nContacts);
 	virtual int GetEntityProfileInfo(phys_profile_info *&pList)	{	pList=m_pEntProfileData; return m_nProfiledEnts; }
 	void AddFuncProfileInfo(const char *name,int nTicks);
 	virtual int GetFuncProfileInfo(phys_profile_info *&pList)	{	pList=m_pFuncProfileData; return m_nProfileFunx; }
 	virtual int GetGroupProfileInfo(phys_profile_info *&pList) { pList=m_grpProfileData; return CRY_ARRAY_COUNT(m_grpProfileData); }
+	virtual int GetIslandProfileInfo(phys_profile_info *&pList) { pList=m_islandProfileData; return m_nProfiledIslands; }
 	virtual int GetJobProfileInfo(phys_job_info *&pList) { pList = m_JobProfileInfo; return CRY_ARRAY_COUNT(m_JobProfileInfo); }
 	phys_job_info& GetJobProfileInst(int ijob) { return m_JobProfileInfo[ijob]; }
 
@@ -603,6 +612,7 @@ public:
 	void ProcessNextLivingEntity(float time_interval, int bSkipFlagged, int iCaller);
 	void ProcessNextIndependentEntity(float time_interval, int bSkipFlagged, int iCaller);
 	void ProcessBreakingEntities(float time_interval);
+	void ProcessNextWaterMan(float time_interval);
 	void ThreadProc(int ithread, SPhysTask *pTask);
 
 	template<class T> void ReallocQueue(T *&pqueue, int sz,int &szAlloc, int &head,int &tail, int nGrow) {
@@ -713,7 +723,10 @@ public:
 	CPhysicalEntity **m_pTmpEntList,**m_pTmpEntList1,**m_pTmpEntList2;
 	CPhysicalEntity *m_pHiddenEnts;
 	float *m_pGroupMass,*m_pMassList;
-	int *m_pGroupIds,*m_pGroupNums;
+	int *m_pGroupIds,*m_pGroupNums,*m_pGroupSize;
+	Vec3 m_posLODObservers[8];
+	int m_maskLODObservers;
+	int m_bLODStep;
 
 	SEntityGrid m_entgrid;
 	SEntityGrid *m_pDeletedGrids = nullptr;
@@ -795,6 +808,8 @@ public:
 	int m_nProfileFunx,m_nProfileFunxAlloc;
 	volatile int m_lockEntProfiler,m_lockFuncProfiler;
 	phys_profile_info m_grpProfileData[16];
+	phys_profile_info m_islandProfileData[16];
+	int m_nProfiledIslands;
 	phys_job_info m_JobProfileInfo[6];
 	float m_lastTimeInterval;
 	int m_nSlowFrames;
@@ -874,6 +889,7 @@ public:
 	volatile int m_nWorkerThreads;
 	volatile int m_iCurGroup;
 	volatile CPhysicalEntity *m_pCurEnt;
+	class CWaterMan *volatile m_pCurWaterMan;
 	volatile CPhysicalEntity *m_pMovedEnts;
 	volatile int m_lockNextEntityGroup;
 	volatile int m_lockMovedEntsList;
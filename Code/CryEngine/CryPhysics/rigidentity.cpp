@@ -3362,6 +3362,8 @@ int CRigidEntity::Update(float time_interval, float damping)
 {
 	int i,j,iCaller=get_iCaller_int();
 	float dt,E,E_accum, Emin = m_bFloating && m_nColliders+m_nPrevColliders==0 ? m_EminWater : m_Emin;
+	if (m_iLOD>0 && m_pWorld->m_bLODStep) // far from the LOD observers - fall asleep sooner
+		Emin *= m_pWorld->m_vars.lodSleepScale*m_iLOD;
 	Vec3 L_accum,pt[4];
 	coord_block_BBox partCoordTmp[2];
 	//m_nStickyContacts = m_nSlidingContacts = 0;
@@ -470,12 +470,48 @@ void CPhysicalWorld::RayWater(const Vec3 &org,const Vec3 &dir, entity_grid_check
 	}
 }
 
-int CPhysicalWorld::RayWorldIntersection(const IPhysicalWorld::SRWIParams &rp, const char *pNameTag, int iCaller)
+void CPhysicalWorld::QueueRay(const IPhysicalWorld::SRWIParams &rp, int iCaller)
 {
-	ray_hit *hits = rp.hits;
-	Vec3 dir = rp.dir;
-	int objtypes = rp.objtypes;
+	int i;
+	ReallocQueue(m_rwiQueue, m_rwiQueueSz,m_rwiQueueAlloc, m_rwiQueueHead,m_rwiQueueTail, 64);
+	m_rwiQueue[m_rwiQueueHead].pForeignData = rp.pForeignData;
+	m_rwiQueue[m_rwiQueueHead].iForeignData = rp.iForeignData;
+	m_rwiQueue[m_rwiQueueHead].org = rp.org;
+	m_rwiQueue[m_rwiQueueHead].dir = rp.dir;
+	m_rwiQueue[m_rwiQueueHead].objtypes = rp.objtypes;
+	m_rwiQueue[m_rwiQueueHead].flags = rp.flags & ~rwi_queue;
+	m_rwiQueue[m_rwiQueueHead].phitLast = rp.phitLast;
+	m_rwiQueue[m_rwiQueueHead].iCaller = iCaller;
+	m_rwiQueue[m_rwiQueueHead].OnEvent = rp.OnEvent;
+	if (!(m_rwiQueue[m_rwiQueueHead].hits = rp.hits)) {
+		WriteLock lockH(m_lockRwiHitsPool);
+		int nhits=0;
+		ray_hit *phit=m_pRwiHitsTail->next,*pchunk=0;
+		if (m_rwiPoolEmpty || phit!=m_pRwiHitsHead)
+			for(nhits=1; nhits<rp.nMaxHits && (m_rwiPoolEmpty || phit!=m_pRwiHitsHead); nhits++,phit=phit->next,m_rwiPoolEmpty=0) 
+				if (phit->next!=phit+1)
+					pchunk=phit,nhits=0;
+		if (nhits<rp.nMaxHits) {
+			phit = new ray_hit[(nhits=max(rp.nMaxHits,512))+1]+1;
+			memset(phit-1, 0, (nhits+1)*sizeof(ray_hit));
+			for(i=0;i<nhits-1;i++) phit[i].next = phit+i+1;
+			phit[nhits-1].next=m_pRwiHitsTail->next; m_pRwiHitsTail->next=phit;
+			m_rwiHitsPoolSize += nhits;
+		}	else
+			phit = (pchunk ? pchunk:m_pRwiHitsTail)->next;
+		m_pRwiHitsTail = phit+rp.nMaxHits-1; m_rwiPoolEmpty = 0;
+		m_rwiQueue[m_rwiQueueHead].hits = phit;
+		m_rwiQueue[m_rwiQueueHead].iCaller |= 1<<16;
+	}
+	m_rwiQueue[m_rwiQueueHead].nMaxHits = rp.nMaxHits;
+	m_rwiQueue[m_rwiQueueHead].nSkipEnts = min((int)(sizeof(m_rwiQueue[0].idSkipEnts)/sizeof(m_rwiQueue[0].idSkipEnts[0])),rp.nSkipEnts);
+	for(i=0;i<m_rwiQueue[m_rwiQueueHead].nSkipEnts;i++)
+		m_rwiQueue[m_rwiQueueHead].idSkipEnts[i] = rp.pSkipEnts[i] ? GetPhysicalEntityId(rp.pSkipEnts[i]):-3;
+	m_rwiQueueSz++;
+}
 
+int CPhysicalWorld::RayWorldIntersection(const IPhysicalWorld::SRWIParams &rp, const char *pNameTag, int iCaller)
+{
 	FUNCTION_PROFILER( GetISystem(),PROFILE_PHYSICS );
 
 	IF (rp.dir.len2()<=0, 0)
@@ -483,45 +519,21 @@ int CPhysicalWorld::RayWorldIntersection(const IPhysicalWorld::SRWIParams &rp, c
 
 	IF (rp.flags & rwi_queue, 0) {
 		WriteLock lockQ(m_lockRwiQueue);
-		int i;
-		ReallocQueue(m_rwiQueue, m_rwiQueueSz,m_rwiQueueAlloc, m_rwiQueueHead,m_rwiQueueTail, 64);
-		m_rwiQueue[m_rwiQueueHead].pForeignData = rp.pForeignData;
-		m_rwiQueue[m_rwiQueueHead].iForeignData = rp.iForeignData;
-		m_rwiQueue[m_rwiQueueHead].org = rp.org;
-		m_rwiQueue[m_rwiQueueHead].dir = rp.dir;
-		m_rwiQueue[m_rwiQueueHead].objtypes = objtypes;
-		m_rwiQueue[m_rwiQueueHead].flags = rp.flags & ~rwi_queue;
-		m_rwiQueue[m_rwiQueueHead].phitLast = rp.phitLast;
-		m_rwiQueue[m_rwiQueueHead].iCaller = iCaller;
-		m_rwiQueue[m_rwiQueueHead].OnEvent = rp.OnEvent;
-		if (!(m_rwiQueue[m_rwiQueueHead].hits = rp.hits)) {
-			WriteLock lockH(m_lockRwiHitsPool);
-			int nhits=0;
-			ray_hit *phit=m_pRwiHitsTail->next,*pchunk=0;
-			if (m_rwiPoolEmpty || phit!=m_pRwiHitsHead)
-				for(nhits=1; nhits<rp.nMaxHits && (m_rwiPoolEmpty || phit!=m_pRwiHitsHead); nhits++,phit=phit->next,m_rwiPoolEmpty=0) 
-					if (phit->next!=phit+1)
-						pchunk=phit,nhits=0;
-			if (nhits<rp.nMaxHits) {
-				phit = new ray_hit[(nhits=max(rp.nMaxHits,512))+1]+1;
-				memset(phit-1, 0, (nhits+1)*sizeof(ray_hit));
-				for(i=0;i<nhits-1;i++) phit[i].next = phit+i+1;
-				phit[nhits-1].next=m_pRwiHitsTail->next; m_pRwiHitsTail->next=phit;
-				m_rwiHitsPoolSize += nhits;
-			}	else
-				phit = (pchunk ? pchunk:m_pRwiHitsTail)->next;
-			m_pRwiHitsTail = phit+rp.nMaxHits-1; m_rwiPoolEmpty = 0;
-			m_rwiQueue[m_rwiQueueHead].hits = phit;
-			m_rwiQueue[m_rwiQueueHead].iCaller |= 1<<16;
-		}
-		m_rwiQueue[m_rwiQueueHead].nMaxHits = rp.nMaxHits;
-		m_rwiQueue[m_rwiQueueHead].nSkipEnts = min((int)(sizeof(m_rwiQueue[0].idSkipEnts)/sizeof(m_rwiQueue[0].idSkipEnts[0])),rp.nSkipEnts);
-		for(i=0;i<m_rwiQueue[m_rwiQueueHead].nSkipEnts;i++)
-			m_rwiQueue[m_rwiQueueHead].idSkipEnts[i] = rp.pSkipEnts[i] ? GetPhysicalEntityId(rp.pSkipEnts[i]):-3;
-		m_rwiQueueSz++;
+		QueueRay(rp, iCaller);
 		return 1;
 	} 
 
+	assert(iCaller<=MAX_PHYS_THREADS);
+	WriteLockCond lock(m_lockCaller[iCaller], iCaller==MAX_PHYS_THREADS && rp.iForeignData!=FD_RWI_RECURSIVE);
+	return TraceRay(rp, pNameTag, iCaller, 1);
+}
+
+int CPhysicalWorld::TraceRay(const IPhysicalWorld::SRWIParams &rp, const char *pNameTag, int iCaller, int bMarkSkipEnts)
+{
+	ray_hit *hits = rp.hits;
+	Vec3 dir = rp.dir;
+	int objtypes = rp.objtypes;
+
 	PHYS_FUNC_PROFILER( pNameTag );
 	int i,nHits; 
 	entity_grid_checker egc;
@@ -534,9 +546,6 @@ int CPhysicalWorld::RayWorldIntersection(const IPhysicalWorld::SRWIParams &rp, c
 		inodeLastHit = rp.phitLast->iNode;
 	}
 
-	assert(iCaller<=MAX_PHYS_THREADS);
-	WriteLockCond lock(m_lockCaller[iCaller], iCaller==MAX_PHYS_THREADS && rp.iForeignData!=FD_RWI_RECURSIVE);
-
 	if (rp.iForeignData==FD_RWI_RECURSIVE) {
 		egc.nEnts = ((entity_grid_checker*)rp.pForeignData)->nEnts;
 		egc.sync_from(*(entity_grid_checker*)rp.pForeignData);
@@ -566,7 +575,8 @@ int CPhysicalWorld::RayWorldIntersection(const IPhysicalWorld::SRWIParams &rp, c
 	}
 
 	IF (objtypes & ~(ent_terrain|ent_water) && m_gthunks, 1) {
-		MarkSkipEnts(rp.pSkipEnts,rp.nSkipEnts,1<<iCaller);
+		if (bMarkSkipEnts)
+			MarkSkipEnts(rp.pSkipEnts,rp.nSkipEnts,1<<iCaller);
 
 		egc.phits = rp.hits;
 		egc.pWorld = this;
@@ -638,7 +648,8 @@ int CPhysicalWorld::RayWorldIntersection(const IPhysicalWorld::SRWIParams &rp, c
 			AtomicAdd(&(egc.pTmpEntList[i]->m_pEntBuddy && egc.pTmpEntList[i]->m_pEntBuddy->m_pEntBuddy==egc.pTmpEntList[i] && !IsPortal(egc.pTmpEntList[i]) ?
 								egc.pTmpEntList[i]->m_pEntBuddy : egc.pTmpEntList[i])->m_bProcessed, -(1<<iCaller));
 		
-		UnmarkSkipEnts(rp.pSkipEnts,rp.nSkipEnts,1<<iCaller);
+		if (bMarkSkipEnts)
+			UnmarkSkipEnts(rp.pSkipEnts,rp.nSkipEnts,1<<iCaller);
 
 		if (rp.flags & rwi_separate_important_hits) {
 			int j,idx[2]; ray_hit thit;
@@ -712,6 +723,99 @@ int CPhysicalWorld::RayWorldIntersection(const IPhysicalWorld::SRWIParams &rp, c
 	return nHits;
 }
 
+static inline uint32 spread_bits(uint32 x)
+{
+	x &= 0xFFFF;
+	x = (x | x<<8) & 0x00FF00FF;
+	x = (x | x<<4) & 0x0F0F0F0F;
+	x = (x | x<<2) & 0x33333333;
+	return (x | x<<1) & 0x55555555;
+}
+static void swap(uint32 *pkey,int *pidx, int i1,int i2) {
+	uint32 key=pkey[i1]; pkey[i1]=pkey[i2]; pkey[i2]=key;
+	int i=pidx[i1]; pidx[i1]=pidx[i2]; pidx[i2]=i;
+}
+static void qsort(uint32 *pkey,int *pidx, int ileft,int iright)
+{
+	if (ileft>=iright) return;
+	int i,ilast; 
+	swap(pkey,pidx, ileft,ileft+iright>>1);
+	for(ilast=ileft,i=ileft+1; i<=iright; i++)
+	if (pkey[i] < pkey[ileft])
+		swap(pkey,pidx, ++ilast,i);
+	swap(pkey,pidx, ileft,ilast);
+
+	qsort(pkey,pidx, ileft,ilast-1);
+	qsort(pkey,pidx, ilast+1,iright);
+}
+
+int CPhysicalWorld::RayWorldIntersectionBatch(const IPhysicalWorld::SRWIBatchParams &bp, const char *pNameTag, int iCaller)
+{
+	FUNCTION_PROFILER( GetISystem(),PROFILE_PHYSICS );
+
+	int i,nHits=0;
+	SRWIParams rp;
+	rp.pForeignData = bp.pForeignData;
+	rp.OnEvent = bp.OnEvent;
+	rp.objtypes = bp.objtypes;
+	rp.flags = bp.flags;
+	rp.nMaxHits = bp.nMaxHits;
+	rp.pSkipEnts = bp.pSkipEnts;
+	rp.nSkipEnts = bp.nSkipEnts;
+	rp.collclass = bp.collclass;
+	if (bp.nRays<=0 || bp.nMaxHits<=0)
+		return 0;
+
+	IF (bp.flags & rwi_queue, 0) {
+		WriteLock lockQ(m_lockRwiQueue);
+		for(i=0;i<bp.nRays;i++) if (bp.pDir[i].len2()>0) {
+			rp.org = bp.pOrg[i]; rp.dir = bp.pDir[i];
+			rp.iForeignData = bp.piForeignData ? bp.piForeignData[i] : i;
+			rp.hits = bp.hits ? bp.hits+i*bp.nMaxHits : 0;
+			QueueRay(rp, iCaller); nHits++;
+		}
+		return nHits;
+	}
+
+	// trace the rays in Morton order of their origin's grid cell, then by direction octant, so that consecutive 
+	// rays step through the same cells and bv tree nodes while they are still in the cache
+	int idxbuf[256]; uint32 keybuf[256];
+	int *idx = bp.nRays<=256 ? idxbuf : new int[bp.nRays];
+	uint32 *key = bp.nRays<=256 ? keybuf : new uint32[bp.nRays];
+	for(i=0;i<bp.nRays;i++) {
+		Vec3 origin_grid = m_entgrid.vecToGrid(bp.pOrg[i]-m_entgrid.origin), dir_grid = m_entgrid.vecToGrid(bp.pDir[i]);
+		int ix = max(0,min(m_entgrid.size.x-1, float2int(origin_grid.x*m_entgrid.stepr.x-0.5f)));
+		int iy = max(0,min(m_entgrid.size.y-1, float2int(origin_grid.y*m_entgrid.stepr.y-0.5f)));
+		key[i] = (spread_bits(ix) | spread_bits(iy)<<1)<<3 | isneg(dir_grid.x) | isneg(dir_grid.y)<<1 | isneg(dir_grid.z)<<2;
+		idx[i] = i;
+	}
+	qsort(key,idx, 0,bp.nRays-1);
+
+	{
+		assert(iCaller<=MAX_PHYS_THREADS);
+		WriteLockCond lock(m_lockCaller[iCaller], iCaller==MAX_PHYS_THREADS);
+		MarkSkipEnts(bp.pSkipEnts,bp.nSkipEnts,1<<iCaller);
+		for(i=0;i<bp.nRays;i++) {
+			int iray=idx[i], nRayHits=0;
+			if (bp.pDir[iray].len2()>0) {
+				rp.org = bp.pOrg[iray]; rp.dir = bp.pDir[iray];
+				rp.hits = bp.hits+iray*bp.nMaxHits;
+				nRayHits = TraceRay(rp, pNameTag, iCaller, 0);
+			}	else for(int j=0;j<bp.nMaxHits;j++)
+				bp.hits[iray*bp.nMaxHits+j].dist = -1;
+			if (bp.pnHits)
+				bp.pnHits[iray] = nRayHits;
+			nHits += nRayHits;
+		}
+		UnmarkSkipEnts(bp.pSkipEnts,bp.nSkipEnts,1<<iCaller);
+	}
+
+	if (idx!=idxbuf) {
+		delete[] idx; delete[] key;
+	}
+	return nHits;
+}
+
 int CPhysicalWorld::TracePendingRays(int bDoTracing)
 {	
 	int i,nChex=0;
@@ -43,6 +43,10 @@ CSoftEntity::CSoftEntity(CPhysicalWorld *pworld, IGeneralMemoryHeap* pHeap)
 	, m_lastqHost(IDENTITY)
 	, m_pTetrEdges(nullptr)
 	, m_pTetrQueue(nullptr)
+	, m_pRelaxEdges(nullptr)
+	, m_pRelaxStart(nullptr)
+	, m_nRelaxEdgesAlloc(0)
+	, m_nRelaxVtxAlloc(0)
 	, m_lastPos(ZERO)
 	, m_timeStepFull(0.0f)
 	, m_timeStepPerformed(0.0f)
@@ -114,6 +118,8 @@ CSoftEntity::~CSoftEntity()
 	if (m_pVtxEdges) { delete[] m_pVtxEdges; m_pVtxEdges=0; }
 	if (m_pTetrEdges) { delete[] m_pTetrEdges; m_pTetrEdges=0; }
 	if (m_pTetrQueue) { delete[] m_pTetrQueue; m_pTetrQueue=0; }
+	if (m_pRelaxEdges) { delete[] m_pRelaxEdges; m_pRelaxEdges=0; }
+	if (m_pRelaxStart) { delete[] m_pRelaxStart; m_pRelaxStart=0; }
 	RemoveCore();
 	m_nVtx=m_nEdges = 0; 
 }
@@ -1288,20 +1294,40 @@ void CSoftEntity::StepInner(float time_interval, int bCollMode, check_part *chec
 	}
 
 	if (!(m_flags & sef_volumetric)) {
+		// positions, lengths and masses don't change during relaxation, so the edge directions and factors are gathered once, 
+		// in the order the iterations visit them
+		if (m_nRelaxEdgesAlloc<m_nEdges*2) {
+			delete[] m_pRelaxEdges; m_pRelaxEdges = new se_relax_edge[m_nRelaxEdgesAlloc = m_nEdges*2];
+		}
+		if (m_nRelaxVtxAlloc<=m_nConnectedVtx) {
+			delete[] m_pRelaxStart; m_pRelaxStart = new int[m_nRelaxVtxAlloc = m_nVtx+1];
+		}
+		for(i=j1=0; i<m_nConnectedVtx; i++) {
+			i0 = m_vtx[i].idx; m_pRelaxStart[i] = j1;
+			for(j=m_vtx[i0].iStartEdge; j<=m_vtx[i0].iEndEdge; j++)	
+				if ((vreq = (m_edges[m_pVtxEdges[j]].len-m_edges[m_pVtxEdges[j]].len0)*m_ks)>-1e10f) {
+					i1 = m_edges[m_pVtxEdges[j]].ivtx[0]+m_edges[m_pVtxEdges[j]].ivtx[1]-i0;
+					if (m_vtx[i1].idx0<i)
+						continue;
+					se_relax_edge &re = m_pRelaxEdges[j1++];
+					re.l = (m_vtx[i1].pos-m_vtx[i0].pos)*m_edges[m_pVtxEdges[j]].rlen;
+					re.vreq0 = vreq; re.i1 = i1;
+					re.kmass0 = m_vtx[i0].massinv*m_edges[m_pVtxEdges[j]].kmass;
+					re.kmass1 = m_vtx[i1].massinv*m_edges[m_pVtxEdges[j]].kmass;
+				}
+		}
+		m_pRelaxStart[i] = j1;
+
 		iter=0; do {
 			for(i=0,rmax=0; i<m_nConnectedVtx; i++) {
 				i0 = m_vtx[i].idx;
-				for(j=m_vtx[i0].iStartEdge; j<=m_vtx[i0].iEndEdge; j++)	
-					if ((vreq = (m_edges[m_pVtxEdges[j]].len-m_edges[m_pVtxEdges[j]].len0)*m_ks)>-1e10f) {
-						i1 = m_edges[m_pVtxEdges[j]].ivtx[0]+m_edges[m_pVtxEdges[j]].ivtx[1]-i0;
-						if (m_vtx[i1].idx0<i)
-							continue;
-						l = (m_vtx[i1].pos-m_vtx[i0].pos)*m_edges[m_pVtxEdges[j]].rlen;
-						F = l*-min(100.0f, vreq=(m_vtx[i0].vel-m_vtx[i1].vel)*l-vreq);
-						m_vtx[i0].vel += F*(m_vtx[i0].massinv*m_edges[m_pVtxEdges[j]].kmass);
-						m_vtx[i1].vel -= F*(m_vtx[i1].massinv*m_edges[m_pVtxEdges[j]].kmass);
-						rmax = max(rmax,-vreq);
-					}
+				for(j=m_pRelaxStart[i]; j<m_pRelaxStart[i+1]; j++) {
+					const se_relax_edge &re = m_pRelaxEdges[j];
+					F = re.l*-min(100.0f, vreq=(m_vtx[i0].vel-m_vtx[re.i1].vel)*re.l-re.vreq0);
+					m_vtx[i0].vel += F*re.kmass0;
+					m_vtx[re.i1].vel -= F*re.kmass1;
+					rmax = max(rmax,-vreq);
+				}
 				if (m_vtx[i0].pContactEnt && !m_vtx[i0].bAttached) {
 					m_vtx[i0].vel -= m_vtx[i0].ncontact*min(0.0f, vreq = m_vtx[i0].ncontact*(m_vtx[i0].vel-m_vtx[i0].vcontact)-m_vtx[i0].vreq);
 					rmax = max(rmax,-vreq);
@@ -1895,6 +1921,8 @@ void CSoftEntity::GetMemoryStatistics(ICrySizer *pSizer) const
 		pSizer->AddObject(m_pTetrEdges, m_parts[0].pLattice->m_nTetr*6*sizeof(m_pTetrEdges[0]));
 		pSizer->AddObject(m_pTetrQueue, m_parts[0].pLattice->m_nTetr*sizeof(m_pTetrQueue[0]));
 	}
+	pSizer->AddObject(m_pRelaxEdges, m_nRelaxEdgesAlloc*sizeof(m_pRelaxEdges[0]));
+	pSizer->AddObject(m_pRelaxStart, m_nRelaxVtxAlloc*sizeof(m_pRelaxStart[0]));
 }
 
 #undef CMemStream
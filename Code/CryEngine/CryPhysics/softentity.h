@@ -47,6 +47,13 @@ struct se_edge {
 	float angle0[2];
 };
 
+struct se_relax_edge { // per-step constant part of an edge constraint, in the solver's traversal order
+	Vec3 l;
+	float vreq0;
+	float kmass0,kmass1;
+	int i1;
+};
+
 struct check_part {
 	Vec3 offset;
 	Matrix33 R;
@@ -120,6 +127,9 @@ class CSoftEntity : public CPhysicalEntity {
 	quaternionf m_lastqHost;
 	int *m_pTetrEdges;
 	int *m_pTetrQueue;
+	se_relax_edge *m_pRelaxEdges;
+	int *m_pRelaxStart;
+	int m_nRelaxEdgesAlloc,m_nRelaxVtxAlloc;
 	Vec3 m_lastPos;
 
 	float m_timeStepFull;
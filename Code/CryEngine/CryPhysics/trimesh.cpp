@@ -308,7 +308,7 @@ CTriMesh* CTriMesh::CreateTriMesh(strided_pointer<const Vec3> pVertices,strided_
 		if (flags & mesh_AABB) {
 			Matrix33 Basis; Basis.SetIdentity();
 			CAABBTree *pTree = new CAABBTree;
-			pTree->SetParams(nMinTrisPerNode,nMaxTrisPerNode,skipdim,Basis,flags&mesh_AABB_plane_optimise);
+			pTree->SetParams(nMinTrisPerNode,nMaxTrisPerNode,skipdim,Basis,flags&mesh_AABB_plane_optimise,flags&mesh_AABB_SAH);
 			volumes[nTrees] = (pTrees[nTrees]=pTree)->Build(this);
 			++nTrees;
 		}
@@ -320,7 +320,7 @@ CTriMesh* CTriMesh::CreateTriMesh(strided_pointer<const Vec3> pVertices,strided_
 			}
 			CAABBTree *pTree = new CAABBTree;
 			Matrix33 Basis = GetMtxFromBasis(axes);
-			pTree->SetParams(nMinTrisPerNode,nMaxTrisPerNode,skipdim,Basis,flags&mesh_AABB_plane_optimise);
+			pTree->SetParams(nMinTrisPerNode,nMaxTrisPerNode,skipdim,Basis,flags&mesh_AABB_plane_optimise,flags&mesh_AABB_SAH);
 			volumes[nTrees] = (pTrees[nTrees]=pTree)->Build(this)*1.01f; // favor non-oriented AABBs slightly
 			++nTrees;
 		}
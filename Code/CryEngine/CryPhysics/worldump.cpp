@@ -2178,6 +2178,9 @@ struct CPhysVarsSerializer : Serializer {
 		DECLARE_MEMBER("bSkipRedundantColldet", ft_int, bSkipRedundantColldet)
 		DECLARE_MEMBER("bLimitSimpleSolverEnergy", ft_int, bLimitSimpleSolverEnergy)
 		DECLARE_MEMBER("numThreads", ft_int, numThreads)
+		DECLARE_MEMBER("nIslandBatchEnts", ft_int, nIslandBatchEnts)
+		DECLARE_MEMBER("lodDist", ft_float, lodDist)
+		DECLARE_MEMBER("lodSleepScale", ft_float, lodSleepScale)
 	}
 };
 
@@ -2393,12 +2396,10 @@ void SerializeGeometries(CPhysicalWorld *pWorld, const char *fname,int bSave)
 
 
 bool SerializeWorldBin(CPhysicalWorld *pWorld, const char *fname,int bSave);
-void SerializeWorld(CPhysicalWorld *pWorld, const char *fname,int bSave) 
+int SerializeWorld(CPhysicalWorld *pWorld, const char *fname,int bSave) 
 {
-	if (bSave & 2) {
-		SerializeWorldBin(pWorld, fname, bSave&1);
-		return;
-	}
+	if (bSave & 2)
+		return SerializeWorldBin(pWorld, fname, bSave&1) ? 1:0;
 	CPhysicalPlaceholderSerializer pps;
 	CTetrahedronSerializer ts;
 	CTetrLatticeSerializer tls(&ts);
@@ -2438,7 +2439,7 @@ void SerializeWorld(CPhysicalWorld *pWorld, const char *fname,int bSave)
 	ctx.bSaving = bSave;
 	ctx.f = fopen(fname, bSave ? "wt":"rt");
 	if (!ctx.f)
-		return;
+		return 0;
 	if (ctx.bSaving = bSave)
 		fputs("World\n", ctx.f);
 	else
@@ -2449,6 +2450,7 @@ void SerializeWorld(CPhysicalWorld *pWorld, const char *fname,int bSave)
 	(ctx.pSerializer = &pws)->Serialize(ctx);
 	fclose(ctx.f);
 	g_StaticPhysicalEntity.m_pWorld = pWorld;
+	return 1;
 }
 
 
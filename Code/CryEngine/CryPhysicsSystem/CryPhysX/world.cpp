@@ -18,6 +18,7 @@ volatile int g_lockEntList = 0;
 
 void PhysXWorld::Release()
 {
+	FetchAsyncStep();
 	delete this;
 }
 
@@ -234,6 +235,29 @@ PxQueryHitType::Enum RaycastBatchFilter(PxFilterData queryFD, PxFilterData shape
 	return (queryFD.word0 & 15) < shapeFD.word3 ? PxQueryHitType::eTOUCH : PxQueryHitType::eBLOCK;
 }
 
+static void SetupRaycastFilter(RaycastFilter &hitFilter, int flags, int objtypes)
+{
+	if (int collTypes = flags >> rwi_colltype_bit)
+		if (!(flags & rwi_colltype_any)) {
+			hitFilter.flagsAll = collTypes;
+			hitFilter.flagsAny = -1;
+		} else
+			hitFilter.flagsAny = collTypes;
+	if (!(objtypes & ent_terrain))
+		hitFilter.skipId = -1;
+}
+
+static int RaycastScene(const Vec3 &org, const Vec3 &dir, ray_hit *hits, RaycastCallback &hitCB, PxHitFlags hitFlags, const PxQueryFilterData &fd, RaycastFilter &hitFilter)
+{
+	Vec3 dirNorm = dir.GetNormalized();
+	hitCB.hasBlock = false; hitCB.nbTouches = 0;
+	g_cryPhysX.Scene()->raycast(V(org), V(dirNorm), dir*dirNorm, hitCB, hitFlags, fd, &hitFilter);
+	int nhits = CopyHitData(hitCB.block, hits[0], hitCB.hasBlock, org,dir);
+	for(int i=0; i<hitCB.nbTouches; i++)
+		nhits += CopyHitData(hitCB.touches[i], hits[hitCB.hasBlock+i], true, org,dir);
+	return nhits;
+}
+
 int PhysXWorld::RayWorldIntersection(const SRWIParams& rp, const char* pNameTag, int iCaller)
 {
 	if (!(rp.dir.len2()>0) || !rp.hits)
@@ -264,19 +288,52 @@ int PhysXWorld::RayWorldIntersection(const SRWIParams& rp, const char* pNameTag,
 
 	RaycastCallback hitCB(rp.nMaxHits>1 ? (PxRaycastHit*)alloca((rp.nMaxHits-1)*sizeof(PxRaycastHit)):nullptr, rp.nMaxHits-1);
 	RaycastFilter hitFilter(rp.flags & 15, (PhysXEnt**)rp.pSkipEnts, rp.nSkipEnts);
-	if (int collTypes = rp.flags >> rwi_colltype_bit)
-		if (!(rp.flags & rwi_colltype_any)) {
-			hitFilter.flagsAll = collTypes;
-			hitFilter.flagsAny = -1;
-		} else
-			hitFilter.flagsAny = collTypes;
-	if (!(rp.objtypes & ent_terrain))
-		hitFilter.skipId = -1;
+	SetupRaycastFilter(hitFilter, rp.flags, rp.objtypes);
 	ReadLockScene lock;
-	g_cryPhysX.Scene()->raycast(V(rp.org), V(dirNorm), rp.dir*dirNorm, hitCB, hitFlags, fd, &hitFilter);
-	int nhits = CopyHitData(hitCB.block, rp.hits[0], hitCB.hasBlock, rp.org,rp.dir);
-	for(int i=0; i<hitCB.nbTouches; i++)
-		nhits += CopyHitData(hitCB.touches[i], rp.hits[hitCB.hasBlock+i], true, rp.org,rp.dir);
+	return RaycastScene(rp.org,rp.dir, rp.hits, hitCB,hitFlags,fd,hitFilter);
+}
+
+int PhysXWorld::RayWorldIntersectionBatch(const SRWIBatchParams& bp, const char* pNameTag, int iCaller)
+{
+	if (!(bp.flags & rwi_queue) && bp.hits) {
+		// immediate rays share the filter, the touch buffer and the scene lock
+		// (PxBatchQuery prefilter shaders don't see shape materials, which define pierceability, so scene raycasts are used)
+		PxHitFlags hitFlags(PxHitFlag::eDEFAULT|PxHitFlag::eMESH_MULTIPLE);
+		PxQueryFilterData fd(objtypesFilter(bp.objtypes) | PxQueryFlag::ePREFILTER);
+		RaycastCallback hitCB(bp.nMaxHits>1 ? (PxRaycastHit*)alloca((bp.nMaxHits-1)*sizeof(PxRaycastHit)):nullptr, bp.nMaxHits-1);
+		RaycastFilter hitFilter(bp.flags & 15, (PhysXEnt**)bp.pSkipEnts, bp.nSkipEnts);
+		SetupRaycastFilter(hitFilter, bp.flags, bp.objtypes);
+		int nhits = 0;
+		ReadLockScene lock;
+		for(int i=0; i<bp.nRays; i++) {
+			int nRayHits = bp.pDir[i].len2()>0 ? RaycastScene(bp.pOrg[i],bp.pDir[i], bp.hits+i*bp.nMaxHits, hitCB,hitFlags,fd,hitFilter) : 0;
+			if (bp.pnHits)
+				bp.pnHits[i] = nRayHits;
+			nhits += nRayHits;
+		}
+		return nhits;
+	}
+
+	// queued rays go to the batch query one by one
+	SRWIParams rp;
+	rp.pForeignData = bp.pForeignData;
+	rp.OnEvent = bp.OnEvent;
+	rp.objtypes = bp.objtypes;
+	rp.flags = bp.flags;
+	rp.nMaxHits = bp.nMaxHits;
+	rp.pSkipEnts = bp.pSkipEnts;
+	rp.nSkipEnts = bp.nSkipEnts;
+	rp.collclass = bp.collclass;
+	int nhits = 0;
+	for(int i=0; i<bp.nRays; i++) {
+		rp.org = bp.pOrg[i]; rp.dir = bp.pDir[i];
+		rp.iForeignData = bp.piForeignData ? bp.piForeignData[i] : i;
+		rp.hits = bp.hits ? bp.hits+i*bp.nMaxHits : nullptr;
+		int nRayHits = RayWorldIntersection(rp, pNameTag, iCaller);
+		if (bp.pnHits)
+			bp.pnHits[i] = nRayHits;
+		nhits += nRayHits;
+	}
 	return nhits;
 }
 
@@ -648,10 +705,35 @@ void PhysXWorld::UpdateProjectileState(PhysXProjectile *pent)
 }
 
 
+void PhysXWorld::FinishStep(float dtFixed)
+{
+	WriteLockScene lockScene;
+	{ WriteLock lock(m_lockCollEvents); 
+		g_cryPhysX.Scene()->fetchResults(true);
+	}
+	g_cryPhysX.Scene()->flushQueryUpdates();
+	AtomicAdd((volatile uint*)&m_updated, 1);
+	{ ReadLock lock(g_lockEntList);
+		for(PhysXEnt *pent=m_activeEntList[1]; pent!=ListStart(m_activeEntList); pent=pent->m_list[1])
+			pent->PostStep(dtFixed);
+		for(PhysXEnt *pent=m_auxEntList[1]; pent!=ListStart(m_auxEntList); pent=pent->m_list[1])
+			pent->PostStep(dtFixed);
+	}
+}
+
+void PhysXWorld::FetchAsyncStep()
+{
+	if (m_dtAsync>0) {
+		FinishStep(m_dtAsync);
+		m_dtAsync = 0;
+	}
+}
+
 void PhysXWorld::TimeStep(float dt, int flags)
 {
 	//if (!m_dt && dt)
 	//	g_cpx.Scene()->forceDynamicTreeRebuild(true,true);
+	FetchAsyncStep();
 	m_time += dt;
 	if (m_vars.fixedTimestep>0)
 		dt = m_vars.fixedTimestep;
@@ -668,22 +750,16 @@ void PhysXWorld::TimeStep(float dt, int flags)
 		for(; pentAdd; pentAdd=pentAdd->AddToScene(true));
 	}
 
+	float dtAsync = 0;
 	if (flags & ent_rigid && (!m_vars.bSingleStepMode || m_vars.bDoStep)) {
 		float dtFixed = g_cryPhysX.dt();
 		for(int i=0; m_dtSurplus+dt>dtFixed && i<m_vars.nMaxSubsteps; dt-=dtFixed,i++)	{
-			g_cryPhysX.Scene()->simulate(dtFixed,0,m_scratchBuf.data(),m_scratchBuf.size());
-			WriteLockScene lockScene;
-			{ WriteLock lock(m_lockCollEvents); 
-				g_cryPhysX.Scene()->fetchResults(true);
-			}
-			g_cryPhysX.Scene()->flushQueryUpdates();
-			AtomicAdd((volatile uint*)&m_updated, 1);
-			{ ReadLock lock(g_lockEntList);
-				for(PhysXEnt *pent=m_activeEntList[1]; pent!=ListStart(m_activeEntList); pent=pent->m_list[1])
-					pent->PostStep(dtFixed);
-				for(PhysXEnt *pent=m_auxEntList[1]; pent!=ListStart(m_auxEntList); pent=pent->m_list[1])
-					pent->PostStep(dtFixed);
+			if (m_vars.bAsyncStep && !m_vars.bSingleStepMode && !(m_dtSurplus+dt-dtFixed>dtFixed && i+1<m_vars.nMaxSubsteps)) {
+				dtAsync = dtFixed; // the last substep is started at the end of TimeStep and fetched at the beginning of the next one
+				continue;
 			}
+			g_cryPhysX.Scene()->simulate(dtFixed,0,m_scratchBuf.data(),m_scratchBuf.size());
+			FinishStep(dtFixed);
 		}
 		m_dtSurplus += dt;
 		m_dtSurplus = min(dtFixed, m_dtSurplus);
@@ -712,6 +788,10 @@ void PhysXWorld::TimeStep(float dt, int flags)
 			}
 		}
 	}
+	if (dtAsync>0) {
+		g_cryPhysX.Scene()->simulate(dtAsync,0,m_scratchBuf.data(),m_scratchBuf.size());
+		m_dtAsync = dtAsync;
+	}
 
 	if (PxVisualDebugger *dbg = g_cryPhysX.Physics()->getVisualDebugger()) {
 		CCamera &cam = gEnv->pSystem->GetViewCamera();
@@ -949,6 +1029,7 @@ PhysXWorld::PhysXWorld(ILog* pLog) : m_debugDraw(false)
 	m_vars.splashDist1 = 30.0f; m_vars.minSplashForce1 = 150000.0f; m_vars.minSplashVel1 = 10.0f;
 	m_vars.lastTimeStep = 0;
 	m_vars.numThreads = 2;
+	m_vars.bAsyncStep = 0;
 	m_vars.physCPU = 4;
 	m_vars.physWorkerCPU = 1;
 	m_vars.helperOffset.zero();
@@ -67,6 +67,7 @@ public:
 	{ return GetSurfaceParameters(surface_idx,bounciness,friction,flags); }
 
 	virtual void  TimeStep(float time_interval, int flags = ent_all | ent_deleted);
+	virtual void  SetLODObserver(int iSlot, const Vec3* pPos) { CRY_PHYSX_LOG_FUNCTION; }
 
 	virtual float GetPhysicsTime() { return m_time; }
 	virtual int   GetiPhysicsTime() { return float2int(m_time/m_vars.timeGranularity); }
@@ -79,6 +80,7 @@ public:
 	virtual int GetEntitiesInBox(Vec3 ptmin, Vec3 ptmax, IPhysicalEntity**& pList, int objtypes, int szListPrealloc = 0);
 
 	virtual int RayWorldIntersection(const SRWIParams& rp, const char* pNameTag = RWI_NAME_TAG, int iCaller = MAX_PHYS_THREADS);
+	virtual int RayWorldIntersectionBatch(const SRWIBatchParams& bp, const char* pNameTag = RWI_NAME_TAG, int iCaller = MAX_PHYS_THREADS);
 	virtual int  TracePendingRays(int bDoActualTracing = 1);
 
 	virtual void ResetDynamicEntities();
@@ -123,6 +125,7 @@ public:
 	virtual int   GetEntityProfileInfo(phys_profile_info*& pList) { CRY_PHYSX_LOG_FUNCTION; _RETURN_INT_DUMMY_; }
 	virtual int   GetFuncProfileInfo(phys_profile_info*& pList) { CRY_PHYSX_LOG_FUNCTION; _RETURN_INT_DUMMY_; }
 	virtual int   GetGroupProfileInfo(phys_profile_info*& pList) { CRY_PHYSX_LOG_FUNCTION; _RETURN_INT_DUMMY_; }
+	virtual int   GetIslandProfileInfo(phys_profile_info*& pList) { CRY_PHYSX_LOG_FUNCTION; _RETURN_INT_DUMMY_; }
 	virtual int   GetJobProfileInfo(phys_job_info*& pList) { CRY_PHYSX_LOG_FUNCTION; _RETURN_INT_DUMMY_; }
 
 	virtual void             AddEventClient(int type, int(*func)(const EventPhys*), int bLogged, float priority = 1.0f);
@@ -183,6 +186,7 @@ public:
 	pe_params_buoyancy m_pbGlob;
 	Vec3 m_wind = Vec3(0);
 	float m_dt=0, m_dtSurplus=0;
+	float m_dtAsync=0; // the substep that is simulating between TimeStep calls (p_async_step)
 	int m_idStep = 0;
 	volatile int m_updated=0;
 	double m_time = 0;
@@ -219,6 +223,8 @@ public:
 
 	PxMaterial *GetSurfaceType(int i) { return m_mats[ (uint)i<(uint)NSURFACETYPES && m_mats[i] ? i : 0 ]; }
 	void UpdateProjectileState(PhysXProjectile *pent);
+	void FinishStep(float dtFixed);
+	void FetchAsyncStep();
 
 	private:
 
@@ -8,7 +8,7 @@
 #include <CrySchematyc/Compiler/IGraphNodeCompiler.h>
 #include <CrySchematyc/Env/IEnvRegistry.h>
 #include <CrySchematyc/Env/Elements/IEnvComponent.h>
-#include <CrySchematyc/Env/Elements/IEnvFunction.h>
+#include <CrySchematyc/Env/Elements/EnvFunction.h>
 #include <CrySchematyc/Script/IScriptRegistry.h>
 #include <CrySchematyc/Script/Elements/IScriptComponentInstance.h>
 #include <CrySchematyc/Script/Elements/IScriptFunction.h>
@@ -25,6 +25,40 @@
 
 namespace Schematyc
 {
+namespace
+{
+
+// The data ports follow the flow ports in the order of the function's inputs and outputs (see CreateInputsAndOutputs),
+// so the scratchpad values can be handed to the function by index instead of through a parameter map.
+void ExecuteEnvFunction(const IEnvFunction& envFunction, CRuntimeGraphNodeInstance& node, void* pObject)
+{
+	const uint32 inputCount = envFunction.GetInputCount();
+	const uint32 outputCount = envFunction.GetOutputCount();
+	if ((node.GetInputCount() == CScriptGraphFunctionNode::EInputIdx::FirstParam + inputCount) && (node.GetOutputCount() == CScriptGraphFunctionNode::EOutputIdx::FirstParam + outputCount))
+	{
+		CAnyConstPtr inputs[EnvFunctionUtils::MaxParams];
+		CAnyPtr outputs[EnvFunctionUtils::MaxParams];
+		for (uint32 inputIdx = 0; inputIdx < inputCount; ++inputIdx)
+		{
+			inputs[inputIdx] = node.GetInputData(CScriptGraphFunctionNode::EInputIdx::FirstParam + inputIdx);
+		}
+		for (uint32 outputIdx = 0; outputIdx < outputCount; ++outputIdx)
+		{
+			outputs[outputIdx] = node.GetOutputData(CScriptGraphFunctionNode::EOutputIdx::FirstParam + outputIdx);
+		}
+
+		envFunction.Execute(inputs, outputs, pObject);
+	}
+	else
+	{
+		StackRuntimeParamMap params;
+		node.BindParams(params);
+
+		envFunction.Execute(params, pObject);
+	}
+}
+
+} // Anonymous
 
 CScriptGraphFunctionNode::SEnvGlobalFunctionRuntimeData::SEnvGlobalFunctionRuntimeData(const IEnvFunction* _pEnvFunction)
 	: pEnvFunction(_pEnvFunction)
@@ -509,10 +543,7 @@ SRuntimeResult CScriptGraphFunctionNode::ExecuteEnvGlobalFunction(SRuntimeContex
 {
 	SEnvGlobalFunctionRuntimeData& data = DynamicCast<SEnvGlobalFunctionRuntimeData>(*context.node.GetData());
 
-	StackRuntimeParamMap params;
-	context.node.BindParams(params); // #SchematycTODO : Rather than populating the runtime parameter map every time we reference a node it might make more sense to pre-allocate node instances every time we instantiate a graph.
-
-	data.pEnvFunction->Execute(params, nullptr);
+	ExecuteEnvFunction(*data.pEnvFunction, context.node, nullptr);
 
 	return SRuntimeResult(ERuntimeStatus::Continue, EOutputIdx::Out);
 }
@@ -523,10 +554,7 @@ SRuntimeResult CScriptGraphFunctionNode::ExecuteEnvComponentFunction(SRuntimeCon
 	void* pComponent = static_cast<CObject*>(context.pObject)->GetComponent(data.componentIdx); // #SchematycTODO : How can we ensure this pointer is correct for the implementation, not just the interface?
 	assert(pComponent);
 
-	StackRuntimeParamMap params;
-	context.node.BindParams(params); // #SchematycTODO : Rather than populating the runtime parameter map every time we reference a node it might make more sense to pre-allocate node instances every time we instantiate a graph.
-
-	data.pEnvFunction->Execute(params, pComponent);
+	ExecuteEnvFunction(*data.pEnvFunction, context.node, pComponent);
 
 	return SRuntimeResult(ERuntimeStatus::Continue, EOutputIdx::Out);
 }
@@ -0,0 +1,282 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "StdAfx.h"
+
+#include <CrySchematyc/Env/Elements/EnvFunction.h>
+#include <CrySchematyc/Runtime/RuntimeGraph.h>
+#include <CrySchematyc/Runtime/RuntimeParamMap.h>
+#include <CrySystem/CryUnitTest.h>
+
+#include "Script/Graph/Nodes/ScriptGraphFunctionNode.h"
+
+#if defined(CRY_UNIT_TESTING)
+
+CRY_UNIT_TEST_SUITE(SchematycRuntimeGraph)
+{
+	using namespace Schematyc;
+
+	enum
+	{
+		kObjectCount = 1000, // objects running the same graph, each with its own graph instance
+	};
+
+	// a component the graph reads and writes through member functions
+	struct SMover
+	{
+		SMover(float _position = 0.0f, float _speed = 0.0f)
+			: position(_position)
+			, speed(_speed)
+			, distance(0.0f)
+		{}
+
+		float GetPosition() const       { return position; }
+		float GetSpeed() const          { return speed; }
+		void  SetPosition(float value)  { position = value; }
+		void  SetDistance(float value)  { distance = value; }
+
+		static void ReflectType(CTypeDesc<SMover>& desc)
+		{
+			desc.SetGUID("1a800923-9857-446b-82a2-be46ff1d9809"_cry_guid);
+		}
+
+		float position;
+		float speed;
+		float distance;
+	};
+
+	float Mul(float a, float b)                           { return a * b; }
+	float Add(float a, float b)                           { return a + b; }
+	float ClampValue(float value, float min, float max)   { return clamp_tpl(value, min, max); }
+	float AbsValue(float value)                           { return fabsf(value); }
+
+	// node data of a function node, like CScriptGraphFunctionNode::SEnvComponentFunctionRuntimeData
+	struct SFunctionData
+	{
+		SFunctionData(const IEnvFunction* _pFunction = nullptr)
+			: pFunction(_pFunction)
+		{}
+
+		static void ReflectType(CTypeDesc<SFunctionData>& desc)
+		{
+			desc.SetGUID("9fba2f06-9349-4961-ac5b-3f57cf6f8769"_cry_guid);
+		}
+
+		const IEnvFunction* pFunction;
+	};
+
+	typedef CScriptGraphFunctionNode::EInputIdx  EInputIdx;
+	typedef CScriptGraphFunctionNode::EOutputIdx EOutputIdx;
+
+	SRuntimeResult ExecuteBegin(SRuntimeContext& context, const SRuntimeActivationParams& activationParams)
+	{
+		return SRuntimeResult(ERuntimeStatus::Continue, 0);
+	}
+
+	// how function nodes called environment functions before: the node's ports bound to a parameter map by id
+	SRuntimeResult ExecuteFunctionByMap(SRuntimeContext& context, const SRuntimeActivationParams& activationParams)
+	{
+		const SFunctionData& data = DynamicCast<SFunctionData>(*context.node.GetData());
+
+		StackRuntimeParamMap params;
+		context.node.BindParams(params);
+
+		data.pFunction->Execute(params, context.pObject);
+
+		return SRuntimeResult(ERuntimeStatus::Continue, EOutputIdx::Out);
+	}
+
+	// how function nodes call them now: the scratchpad values handed over in port order
+	SRuntimeResult ExecuteFunctionBound(SRuntimeContext& context, const SRuntimeActivationParams& activationParams)
+	{
+		const SFunctionData& data = DynamicCast<SFunctionData>(*context.node.GetData());
+
+		CAnyConstPtr inputs[EnvFunctionUtils::MaxParams];
+		CAnyPtr outputs[EnvFunctionUtils::MaxParams];
+		for (uint32 inputIdx = 0, inputCount = data.pFunction->GetInputCount(); inputIdx < inputCount; ++inputIdx)
+		{
+			inputs[inputIdx] = context.node.GetInputData(EInputIdx::FirstParam + inputIdx);
+		}
+		for (uint32 outputIdx = 0, outputCount = data.pFunction->GetOutputCount(); outputIdx < outputCount; ++outputIdx)
+		{
+			outputs[outputIdx] = context.node.GetOutputData(EOutputIdx::FirstParam + outputIdx);
+		}
+
+		data.pFunction->Execute(inputs, outputs, context.pObject);
+
+		return SRuntimeResult(ERuntimeStatus::Continue, EOutputIdx::Out);
+	}
+
+	// A component update as a designer would wire it: move by speed, keep in bounds, write back and report the distance.
+	// The nodes are laid out like the compiler lays out function nodes, flow port first and data ports in parameter order.
+	struct SMoverGraph
+	{
+		enum
+		{
+			kNoSource = 0, // the begin node, never a data source, so the input keeps the function's default
+		};
+
+		struct SStep
+		{
+			const IEnvFunction* pFunction;
+			RuntimeGraphNodeIdx sources[3]; // node providing each data input through its first data output
+		};
+
+		SMoverGraph(RuntimeGraphNodeCallbackPtr pFunctionCallback)
+			: graph("710cb88f-8b86-481a-b1b1-1e3030684418"_cry_guid, "MoverUpdate")
+		{
+			pGetPosition = EnvFunction::MakeShared(&SMover::GetPosition, "2a221da4-e4e9-4f56-83bb-2eb3b6d59c6e"_cry_guid, "GetPosition", SCHEMATYC_SOURCE_FILE_INFO);
+			pGetPosition->BindOutput(0, 'pos', "Position");
+			pGetSpeed = EnvFunction::MakeShared(&SMover::GetSpeed, "7681a64d-f7f1-460b-9a64-57d1e18cbf23"_cry_guid, "GetSpeed", SCHEMATYC_SOURCE_FILE_INFO);
+			pGetSpeed->BindOutput(0, 'spd', "Speed");
+			pMul = EnvFunction::MakeShared(&Mul, "38779010-9749-45d6-834d-ae7ec715304f"_cry_guid, "Mul", SCHEMATYC_SOURCE_FILE_INFO);
+			pMul->BindInput(1, 'a', "A");
+			pMul->BindInput(2, 'b', "B", nullptr, 0.033f);
+			pMul->BindOutput(0, 'r', "Result");
+			pAdd = EnvFunction::MakeShared(&Add, "08e9ec00-6e8c-48db-9714-af02ddf87a9a"_cry_guid, "Add", SCHEMATYC_SOURCE_FILE_INFO);
+			pAdd->BindInput(1, 'a', "A");
+			pAdd->BindInput(2, 'b', "B");
+			pAdd->BindOutput(0, 'r', "Result");
+			pClamp = EnvFunction::MakeShared(&ClampValue, "157ba2f5-5fa9-4db3-9f7f-28eea36bdadf"_cry_guid, "Clamp", SCHEMATYC_SOURCE_FILE_INFO);
+			pClamp->BindInput(1, 'val', "Value");
+			pClamp->BindInput(2, 'min', "Min", nullptr, -100.0f);
+			pClamp->BindInput(3, 'max', "Max", nullptr, 100.0f);
+			pClamp->BindOutput(0, 'r', "Result");
+			pSetPosition = EnvFunction::MakeShared(&SMover::SetPosition, "c94a47cd-96be-488c-a01c-c9cc23b419ea"_cry_guid, "SetPosition", SCHEMATYC_SOURCE_FILE_INFO);
+			pSetPosition->BindInput(1, 'pos', "Position");
+			pAbs = EnvFunction::MakeShared(&AbsValue, "252fed87-5161-4da7-b4f3-0de62db87c42"_cry_guid, "Abs", SCHEMATYC_SOURCE_FILE_INFO);
+			pAbs->BindInput(1, 'val', "Value");
+			pAbs->BindOutput(0, 'r', "Result");
+			pSetDistance = EnvFunction::MakeShared(&SMover::SetDistance, "940f44c3-2443-4b97-841f-cf28faa40339"_cry_guid, "SetDistance", SCHEMATYC_SOURCE_FILE_INFO);
+			pSetDistance->BindInput(1, 'dist', "Distance");
+
+			const SStep steps[] =
+			{
+				{ pGetPosition.get(), { kNoSource } },       // 1
+				{ pGetSpeed.get(),    { kNoSource } },       // 2
+				{ pMul.get(),         { 2, kNoSource } },    // 3: speed * time step
+				{ pAdd.get(),         { 1, 3 } },            // 4
+				{ pClamp.get(),       { 4, kNoSource } },    // 5
+				{ pSetPosition.get(), { 5 } },               // 6
+				{ pAbs.get(),         { 5 } },               // 7
+				{ pSetDistance.get(), { 7 } },               // 8
+			};
+
+			graph.AddNode(CryGUID(), "Begin", &ExecuteBegin, 0, 1);
+			RuntimeGraphNodeIdx nodeIdx = 0;
+			for (const SStep& step : steps)
+			{
+				const IEnvFunction& function = *step.pFunction;
+				++nodeIdx;
+				graph.AddNode(CryGUID(), function.GetName(), pFunctionCallback, EInputIdx::FirstParam + function.GetInputCount(), EOutputIdx::FirstParam + function.GetOutputCount());
+				graph.SetNodeData(nodeIdx, CAnyConstRef(SFunctionData(&function)));
+
+				for (uint32 outputIdx = 0, outputCount = function.GetOutputCount(); outputIdx < outputCount; ++outputIdx)
+				{
+					graph.SetNodeOutputId(nodeIdx, EOutputIdx::FirstParam + outputIdx, CUniqueId::FromUInt32(function.GetOutputId(outputIdx)));
+					graph.SetNodeOutputData(nodeIdx, EOutputIdx::FirstParam + outputIdx, *function.GetOutputData(outputIdx));
+				}
+				for (uint32 inputIdx = 0, inputCount = function.GetInputCount(); inputIdx < inputCount; ++inputIdx)
+				{
+					graph.SetNodeInputId(nodeIdx, EInputIdx::FirstParam + inputIdx, CUniqueId::FromUInt32(function.GetInputId(inputIdx)));
+					if (step.sources[inputIdx] != kNoSource)
+					{
+						graph.AddDataLink(step.sources[inputIdx], EOutputIdx::FirstParam, nodeIdx, EInputIdx::FirstParam + inputIdx);
+					}
+					else
+					{
+						graph.SetNodeInputData(nodeIdx, EInputIdx::FirstParam + inputIdx, *function.GetInputData(inputIdx));
+					}
+				}
+
+				graph.AddFlowLink(nodeIdx - 1, 0, nodeIdx, EInputIdx::In);
+			}
+
+			movers.reserve(kObjectCount);
+			instances.reserve(kObjectCount);
+			for (int i = 0; i < kObjectCount; ++i)
+			{
+				movers.emplace_back(static_cast<float>(i % 100), static_cast<float>(10 + i % 7));
+				instances.emplace_back(graph);
+			}
+		}
+
+		void Update()
+		{
+			StackRuntimeParamMap params;
+			for (int i = 0; i < kObjectCount; ++i)
+			{
+				instances[i].Execute(&movers[i], params, SRuntimeActivationParams(0, 0, EActivationMode::Output));
+			}
+		}
+
+		std::shared_ptr<CEnvFunction>      pGetPosition;
+		std::shared_ptr<CEnvFunction>      pGetSpeed;
+		std::shared_ptr<CEnvFunction>      pMul;
+		std::shared_ptr<CEnvFunction>      pAdd;
+		std::shared_ptr<CEnvFunction>      pClamp;
+		std::shared_ptr<CEnvFunction>      pSetPosition;
+		std::shared_ptr<CEnvFunction>      pAbs;
+		std::shared_ptr<CEnvFunction>      pSetDistance;
+		CRuntimeGraph                      graph;
+		std::vector<SMover>                movers;
+		std::vector<CRuntimeGraphInstance> instances;
+	};
+
+	CRY_UNIT_TEST(CUT_BoundFunctionNodesMatchParamMap)
+	{
+		SMoverGraph byMap(&ExecuteFunctionByMap);
+		SMoverGraph bound(&ExecuteFunctionBound);
+		byMap.Update();
+		bound.Update();
+
+		for (int i = 0; i < kObjectCount; ++i)
+		{
+			const float expectedPosition = static_cast<float>(i % 100) + static_cast<float>(10 + i % 7) * 0.033f;
+			CRY_UNIT_TEST_ASSERT(fabsf(byMap.movers[i].position - expectedPosition) < 0.0001f);
+			CRY_UNIT_TEST_CHECK_EQUAL(byMap.movers[i].distance, byMap.movers[i].position);
+			CRY_UNIT_TEST_CHECK_EQUAL(bound.movers[i].position, byMap.movers[i].position);
+			CRY_UNIT_TEST_CHECK_EQUAL(bound.movers[i].distance, byMap.movers[i].distance);
+		}
+	}
+
+	// One update of 1000 objects running the same eight function node graph, with the function nodes binding
+	// their ports to a parameter map by id and with the ports handed to the functions in order.
+	// Both run through CRuntimeGraphInstance::Execute, so the difference is the cost of calling a function.
+	struct SMoverGraphBenchmark : public CryUnitTest::SBenchmark
+	{
+		SMoverGraphBenchmark(RuntimeGraphNodeCallbackPtr pFunctionCallback)
+			: m_pFunctionCallback(pFunctionCallback)
+			, m_pGraph(nullptr)
+		{}
+
+		virtual void Init() override { m_pGraph = new SMoverGraph(m_pFunctionCallback); }
+		virtual void Done() override { SAFE_DELETE(m_pGraph); }
+
+		RuntimeGraphNodeCallbackPtr m_pFunctionCallback;
+		SMoverGraph*                m_pGraph;
+	};
+
+	struct SMoverGraphBenchmarkByMap : public SMoverGraphBenchmark
+	{
+		SMoverGraphBenchmarkByMap() : SMoverGraphBenchmark(&ExecuteFunctionByMap) {}
+	};
+
+	struct SMoverGraphBenchmarkBound : public SMoverGraphBenchmark
+	{
+		SMoverGraphBenchmarkBound() : SMoverGraphBenchmark(&ExecuteFunctionBound) {}
+	};
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_RuntimeGraph1kObjectsByMap, SMoverGraphBenchmarkByMap)
+	{
+		m_pGraph->Update();
+		CRY_UNIT_BENCHMARK_KEEP(m_pGraph->movers[0].distance);
+	}
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_RuntimeGraph1kObjectsBound, SMoverGraphBenchmarkBound)
+	{
+		m_pGraph->Update();
+		CRY_UNIT_BENCHMARK_KEEP(m_pGraph->movers[0].distance);
+	}
+}
+
+#endif // CRY_UNIT_TESTING
@@ -2,6 +2,8 @@
 
 #include "StdAfx.h"
 
+#include <CrySchematyc/Env/Elements/EnvFunction.h>
+#include <CrySchematyc/Runtime/RuntimeParamMap.h>
 #include <CrySchematyc/Runtime/RuntimeParams.h>
 #include <CrySchematyc/Utils/Scratchpad.h>
 #include <CrySchematyc/Utils/SharedString.h>
@@ -83,11 +85,54 @@ UnitTestResultFlags TestRuntimeParams()
 	return EUnitTestResultFlags::Success;
 }
 
+float AddAndDouble(int32 a, float b, float& c)
+{
+	c = b * 2.0f;
+	return static_cast<float>(a) + b;
+}
+
+UnitTestResultFlags TestEnvFunctionParams()
+{
+	CEnvFunction envFunction(&AddAndDouble, "01f7329a-b181-483f-b1b5-3c8fc180542a"_cry_guid, "AddAndDouble", SCHEMATYC_SOURCE_FILE_INFO);
+	envFunction.BindInput(1, 'a', "A");
+	envFunction.BindInput(2, 'b', "B");
+	envFunction.BindOutput(0, 'r', "Result");
+	envFunction.BindOutput(3, 'c', "C");
+
+	const int32 valueA = 101;
+	const float valueB = 202.0f;
+
+	// Parameters looked up by id.
+	float mapResult = 0.0f;
+	float mapC = 0.0f;
+	StackRuntimeParamMap params;
+	params.BindInput(CUniqueId::FromUInt32('a'), &valueA);
+	params.BindInput(CUniqueId::FromUInt32('b'), &valueB);
+	params.BindOutput(CUniqueId::FromUInt32('r'), CAnyPtr(&mapResult));
+	params.BindOutput(CUniqueId::FromUInt32('c'), CAnyPtr(&mapC));
+	envFunction.Execute(params, nullptr);
+
+	// Parameters pre-bound in input and output order, the way function nodes call environment functions.
+	float boundResult = 0.0f;
+	float boundC = 0.0f;
+	const CAnyConstPtr inputs[] = { &valueA, &valueB };
+	const CAnyPtr outputs[] = { CAnyPtr(&boundResult), CAnyPtr(&boundC) };
+	envFunction.Execute(inputs, outputs, nullptr);
+
+	if ((mapResult != 303.0f) || (mapC != 404.0f) || (boundResult != mapResult) || (boundC != mapC))
+	{
+		return EUnitTestResultFlags::FatalError;
+	}
+
+	return EUnitTestResultFlags::Success;
+}
+
 UnitTestResultFlags Run()
 {
 	UnitTestResultFlags resultFlags = EUnitTestResultFlags::Success;
 	resultFlags.Add(TestScratchpad());
 	resultFlags.Add(TestRuntimeParams());
+	resultFlags.Add(TestEnvFunctionParams());
 	return resultFlags;
 }
 
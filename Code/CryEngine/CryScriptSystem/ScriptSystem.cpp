@@ -21,6 +21,7 @@
 #include <CrySystem/ICmdLine.h>
 #include <CrySystem/ILog.h>
 #include <CrySystem/ITimer.h>
+#include <CrySystem/Profilers/IStatoscope.h>
 #include <CryAISystem/IAISystem.h>
 #include <CryMath/Random.h>
 
@@ -46,6 +47,8 @@ extern HANDLE gDLLHandle;
 
 // Fine tune this value for optimal performance/memory
 #define PER_FRAME_LUA_GC_STEP        2
+// Upper bound of allocations carried over to later frames when the GC budget runs out
+#define MAX_LUA_GC_DEBT_KB           4096
 
 #define LUA_NODE_ALLOCATOR_BLOCKSIZE 128 * 1024
 #define LUA_NODE_ALLOCATOR_TYPE      eCryDefaultMalloc
@@ -108,6 +111,33 @@ void LuaGarbargeCollect(IConsoleCmdArgs*)
 }
 
 inline CScriptTable* AllocTable() { return new CScriptTable; }
+
+#if ENABLE_STATOSCOPE
+class CLuaGCDG : public IStatoscopeDataGroup
+{
+public:
+	CLuaGCDG(CScriptSystem* pScriptSystem) : m_pScriptSystem(pScriptSystem) {}
+
+	virtual SDescription GetDescription() const
+	{
+		return SDescription('G', "Lua GC", "['/LuaGC/' (float gcTimeMs) (float maxPauseMs) (int steps) (int fullCollections) (float memoryKB)]");
+	}
+
+	virtual void Write(IStatoscopeFrameRecord& fr)
+	{
+		const CScriptSystem::SGCStats& stats = m_pScriptSystem->GetGCStats();
+		fr.AddValue(stats.totalTimeMs);
+		fr.AddValue(stats.maxPauseMs);
+		fr.AddValue(stats.numSteps);
+		fr.AddValue(stats.numFullCollections);
+		fr.AddValue((float)m_pScriptSystem->GetCGCount());
+		m_pScriptSystem->ResetGCStats();
+	}
+
+private:
+	CScriptSystem* m_pScriptSystem;
+};
+#endif
 //	inline void FreeTable( CScriptTable *pTable ) { /*delete pTable;*/ }
 }
 
@@ -680,6 +710,7 @@ CScriptSystem::CScriptSystem()
 	: L(nullptr)
 	, m_cvar_script_debugger(nullptr)
 	, m_cvar_script_coverage(nullptr)
+	, m_cvar_gc_budget(nullptr)
 	, m_nTempArg(0)
 	, m_nTempTop(0)
 	, m_pUserDataMetatable(nullptr)
@@ -689,11 +720,15 @@ CScriptSystem::CScriptSystem()
 	, m_fGCFreq(10.0f)
 	, m_lastGCTime(0.0f)
 	, m_nLastGCCount(0)
+	, m_nGCDebtKb(0)
 	, m_forceReloadCount(0)
 	, m_pScriptTimerMgr(nullptr)
 	, m_nCallDepth(0)
 	, m_nLastBreakLine(0)
 	, m_pLuaDebugger(nullptr)
+#if ENABLE_STATOSCOPE
+	, m_pGCStatoscopeDG(nullptr)
+#endif
 {
 	s_mpScriptSystem = this; // Should really be checking here...
 }
@@ -704,6 +739,14 @@ CScriptSystem::~CScriptSystem()
 {
 	m_pSystem->GetISystemEventDispatcher()->RemoveListener(this);
 
+#if ENABLE_STATOSCOPE
+	if (m_pGCStatoscopeDG)
+	{
+		gEnv->pStatoscope->UnregisterDataGroup(m_pGCStatoscopeDG);
+		SAFE_DELETE(m_pGCStatoscopeDG);
+	}
+#endif
+
 	delete m_pScriptTimerMgr;
 
 #if CRY_PLATFORM_WINDOWS
@@ -792,6 +835,19 @@ bool CScriptSystem::Init(ISystem* pSystem, bool bStdLibs, int nStackSize)
 	REGISTER_INT("lua_StopOnError", 0, VF_CHEAT, "Stops on error");
 	m_cvar_script_coverage = REGISTER_INT_CB("lua_CodeCoverage", 0, VF_CHEAT, "Enables code coverage", CScriptSystem::CodeCoverageChange);
 
+	m_cvar_gc_budget = REGISTER_FLOAT("lua_gcBudget", 0.5f, VF_NULL,
+	                                  "Time in milliseconds the incremental garbage collector may run per frame.\n"
+	                                  "At least one step is always performed, allocations not collected within the budget are carried over to the next frames.\n"
+	                                  "Usage: lua_gcBudget [ms]");
+
+#if ENABLE_STATOSCOPE
+	if (gEnv->pStatoscope)
+	{
+		m_pGCStatoscopeDG = new CLuaGCDG(this);
+		gEnv->pStatoscope->RegisterDataGroup(m_pGCStatoscopeDG);
+	}
+#endif
+
 	// Ensure the debugger is in the correct mode
 	EnableDebugger((ELuaDebugMode) m_cvar_script_debugger->GetIVal());
 
@@ -1718,6 +1774,46 @@ void CScriptSystem::PushFuncParamAny(const ScriptAnyValue& any)
 	m_nTempArg++;
 }
 
+//////////////////////////////////////////////////////////////////////////
+void CScriptSystem::PushFuncParamNumber(float value)
+{
+	if (m_nTempArg == -1)
+		return;
+	lua_pushnumber(L, value);
+	m_nTempArg++;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CScriptSystem::PushFuncParamBool(bool value)
+{
+	if (m_nTempArg == -1)
+		return;
+	lua_pushboolean(L, value);
+	m_nTempArg++;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CScriptSystem::PushFuncParamHandle(ScriptHandle value)
+{
+	if (m_nTempArg == -1)
+		return;
+	lua_pushlightuserdata(L, value.ptr);
+	m_nTempArg++;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CScriptSystem::PushFuncParamTable(IScriptTable* pTable)
+{
+	if (m_nTempArg == -1)
+		return;
+	// Pushing the reference directly skips the AddRef/Release a temporary ScriptAnyValue would do.
+	if (pTable)
+		PushTable(pTable);
+	else
+		lua_pushnil(L);
+	m_nTempArg++;
+}
+
 //////////////////////////////////////////////////////////////////////////
 void CScriptSystem::SetGlobalAny(const char* sKey, const ScriptAnyValue& any)
 {
@@ -1794,7 +1890,15 @@ void CScriptSystem::ForceGarbageCollection()
 	int beforeUsage = lua_gc(L, LUA_GCCOUNT, 0) * 1024 + lua_gc(L, LUA_GCCOUNTB, 0);
 
 	// Do a full garbage collection cycle.
+	const CTimeValue startTime = gEnv->pTimer->GetAsyncTime();
 	lua_gc(L, LUA_GCCOLLECT, 0);
+	const float pauseMs = (gEnv->pTimer->GetAsyncTime() - startTime).GetMilliSeconds();
+
+	m_gcStats.totalTimeMs += pauseMs;
+	m_gcStats.maxPauseMs = max(m_gcStats.maxPauseMs, pauseMs);
+	++m_gcStats.numFullCollections;
+	m_nLastGCCount = GetCGCount();
+	m_nGCDebtKb = 0;
 
 	int fracUsage = lua_gc(L, LUA_GCCOUNTB, 0);
 	int totalUsage = lua_gc(L, LUA_GCCOUNT, 0) * 1024 + fracUsage;
@@ -2163,43 +2267,46 @@ void CScriptSystem::Update()
 		pScriptSystem->SetGlobalValue("_aitick", aiTicks);
 	}
 
-	//TRACE("GC DELTA %d",m_pScriptSystem->GetCGCount()-nStartGC);
-	//int nStartGC = pScriptSystem->GetCGCount();
-
-	bool bKickIn = false;                             // Invoke Gargabe Collector
+	UpdateGarbageCollection(currTime);
 
-	if (currTime - m_lastGCTime > m_fGCFreq)  // g_GC_Frequence->GetIVal())
-		bKickIn = true;
+	m_pScriptTimerMgr->Update(nCurTime.GetMilliSecondsAsInt64());
+}
 
-	int nGCCount = pScriptSystem->GetCGCount();
+//////////////////////////////////////////////////////////////////////////
+void CScriptSystem::UpdateGarbageCollection(float currTime)
+{
+	FRAME_PROFILER("Lua GC", m_pSystem, PROFILE_SCRIPT);
 
-	bool bNoLuaGC = false;
+	// The work is sized by the allocation rate: whatever the scripts allocated since the last frame
+	// is added to the debt, which the incremental steps pay back within the frame budget.
+	const int nGCCount = GetCGCount();
+	m_nGCDebtKb = min(m_nGCDebtKb + max(nGCCount - m_nLastGCCount, 0), MAX_LUA_GC_DEBT_KB);
 
-	if (nGCCount - m_nLastGCCount > 2000 && !bNoLuaGC)   //
-		bKickIn = true;
+	const float budgetMs = m_cvar_gc_budget->GetFVal();
+	const CTimeValue startTime = gEnv->pTimer->GetAsyncTime();
+	float elapsedMs = 0.0f;
 
-	//if(bKickIn)
+	do
 	{
-		FRAME_PROFILER("Lua GC", m_pSystem, PROFILE_SCRIPT);
-
-		//CryLog( "Lua GC=%d",GetCGCount() );
-
-		//float fTimeBefore=pTimer->GetAsyncCurTime()*1000;
+		const bool bCycleFinished = lua_gc(L, LUA_GCSTEP, PER_FRAME_LUA_GC_STEP) != 0;
+		m_nGCDebtKb -= PER_FRAME_LUA_GC_STEP;
+		++m_gcStats.numSteps;
+		elapsedMs = (gEnv->pTimer->GetAsyncTime() - startTime).GetMilliSeconds();
 
-		// Do a full garbage collection cycle.
-		//pScriptSystem->ForceGarbageCollection();
-
-		// Do incremental Garbage Collection
-		lua_gc(L, LUA_GCSTEP, (PER_FRAME_LUA_GC_STEP));
-
-		m_nLastGCCount = pScriptSystem->GetCGCount();
-		m_lastGCTime = currTime;
-		//float fTimeAfter=pTimer->GetAsyncCurTime()*1000;
-		//CryLog("--[after coll]GC DELTA %d ",pScriptSystem->GetCGCount()-nGCCount);
-		//TRACE("--[after coll]GC DELTA %d [time =%f]",m_pScriptSystem->GetCGCount()-nStartGC,fTimeAfter-fTimeBefore);
+		if (bCycleFinished)
+		{
+			m_nGCDebtKb = 0;
+			break;
+		}
 	}
+	while (m_nGCDebtKb > 0 && elapsedMs < budgetMs);
 
-	m_pScriptTimerMgr->Update(nCurTime.GetMilliSecondsAsInt64());
+	m_nGCDebtKb = max(m_nGCDebtKb, 0);
+	m_gcStats.totalTimeMs += elapsedMs;
+	m_gcStats.maxPauseMs = max(m_gcStats.maxPauseMs, elapsedMs);
+
+	m_nLastGCCount = GetCGCount();
+	m_lastGCTime = currTime;
 }
 
 //////////////////////////////////////////////////////////////////////////
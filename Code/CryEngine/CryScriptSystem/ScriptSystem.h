@@ -16,6 +16,7 @@ extern "C" {
 #include "ScriptTimerMgr.h"
 
 class CLUADbg;
+struct IStatoscopeDataGroup;
 
 struct SLuaStackEntry
 {
@@ -103,8 +104,21 @@ public:
 	//!
 	bool          Init(ISystem* pSystem, bool bStdLibs, int nStackSize);
 
-	void          Update();
-	void          SetGCFrequency(const float fRate);
+	//! Garbage collection work accumulated since the statistics were last reset.
+	struct SGCStats
+	{
+		SGCStats() : totalTimeMs(0.0f), maxPauseMs(0.0f), numSteps(0), numFullCollections(0) {}
+
+		float totalTimeMs;
+		float maxPauseMs;
+		int   numSteps;
+		int   numFullCollections;
+	};
+
+	void            Update();
+	void            SetGCFrequency(const float fRate);
+	const SGCStats& GetGCStats() const { return m_gcStats; }
+	void            ResetGCStats()     { m_gcStats = SGCStats(); }
 
 	void          SetEnvironment(HSCRIPTFUNCTION scriptFunction, IScriptTable* pEnv);
 	IScriptTable* GetEnvironment(HSCRIPTFUNCTION scriptFunction);
@@ -159,6 +173,10 @@ public:
 	// Push function param.
 	//////////////////////////////////////////////////////////////////////////
 	virtual void PushFuncParamAny(const ScriptAnyValue& any);
+	virtual void PushFuncParamNumber(float value);
+	virtual void PushFuncParamBool(bool value);
+	virtual void PushFuncParamHandle(ScriptHandle value);
+	virtual void PushFuncParamTable(IScriptTable* pTable);
 
 	//////////////////////////////////////////////////////////////////////////
 	// Set global value.
@@ -258,12 +276,16 @@ private: // --------------------------------------------------------------------
 	void AddFileToList(const char* sName);
 	void RemoveFileFromList(const ScriptFileListItor& itor);
 
+	//! Runs incremental collection steps until the allocations since the last frame are paid back or the frame budget is spent.
+	void UpdateGarbageCollection(float currTime);
+
 	// ----------------------------------------------------------------------------
 private:
 	static CScriptSystem* s_mpScriptSystem;
 	lua_State*            L;
 	ICVar*                m_cvar_script_debugger; // Stores current debugging mode
 	ICVar*                m_cvar_script_coverage;
+	ICVar*                m_cvar_gc_budget;       // Milliseconds of incremental garbage collection per frame
 	int                   m_nTempArg;
 	int                   m_nTempTop;
 
@@ -281,6 +303,11 @@ private:
 	float                 m_fGCFreq;      //!< relative time in seconds
 	float                 m_lastGCTime;   //!< absolute time in seconds
 	int                   m_nLastGCCount; //!<
+	int                   m_nGCDebtKb;    //!< allocations not yet paid back by incremental steps
+	SGCStats              m_gcStats;
+#if ENABLE_STATOSCOPE
+	IStatoscopeDataGroup* m_pGCStatoscopeDG;
+#endif
 	int                   m_forceReloadCount;
 
 	CScriptTimerMgr*      m_pScriptTimerMgr;
@@ -0,0 +1,177 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "StdAfx.h"
+#include <CryScriptSystem/IScriptSystem.h>
+#include <CrySystem/CryUnitTest.h>
+
+#if defined(CRY_UNIT_TESTING)
+
+CRY_UNIT_TEST_SUITE(ScriptCalls)
+{
+	enum
+	{
+		kEntityCount = 10000,
+	};
+
+	// an entity class with an update callback, and a check of the parameters it was called with
+	const char* k_classScript =
+	  "ScriptCallsTestClass = {"
+	  "  OnUpdate = function(self, frameTime) self.time = self.time + frameTime end,"
+	  "  CheckParams = function(self, n, b, h, t) return n == 0.5 and b == true and type(h) == 'userdata' and t == self end,"
+	  "  IsNil = function(self, t) return t == nil end,"
+	  "}";
+
+	// entity script tables delegating to their class, as CEntityScript sets them up
+	struct SScriptEntities
+	{
+		SScriptEntities()
+			: pSS(gEnv->pScriptSystem)
+			, onUpdate(0)
+		{
+			pSS->ExecuteBuffer(k_classScript, strlen(k_classScript), "ScriptCallsTest");
+			pSS->GetGlobalValue("ScriptCallsTestClass", pClass);
+			if (!pClass)
+				return;
+
+			// resolved once, the way CEntityScript keeps the state functions
+			pClass->GetValue("OnUpdate", onUpdate);
+
+			entities.reserve(kEntityCount);
+			for (int i = 0; i < kEntityCount; ++i)
+			{
+				SmartScriptTable pEntity(pSS->CreateTable());
+				pEntity->Delegate(pClass);
+				pEntity->SetValue("time", 0.0f);
+				entities.push_back(pEntity);
+			}
+		}
+
+		~SScriptEntities()
+		{
+			if (onUpdate)
+				pSS->ReleaseFunc(onUpdate);
+			stl::free_container(entities);
+			pClass = nullptr;
+			pSS->SetGlobalToNull("ScriptCallsTestClass");
+		}
+
+		bool IsValid() const { return pClass && onUpdate; }
+
+		// the function looked up by name and the parameters converted to ScriptAnyValue on every call
+		void UpdateByName(float frameTime)
+		{
+			for (IScriptTable* pEntity : entities)
+			{
+				if (pSS->BeginCall(pEntity, "OnUpdate"))
+				{
+					pSS->PushFuncParamAny(ScriptAnyValue(pEntity));
+					pSS->PushFuncParamAny(ScriptAnyValue(frameTime));
+					pSS->EndCall();
+				}
+			}
+		}
+
+		// the cached function, parameters still converted to ScriptAnyValue as Script::CallMethod did before
+		void UpdateCachedAny(float frameTime)
+		{
+			for (IScriptTable* pEntity : entities)
+			{
+				if (pSS->BeginCall(onUpdate))
+				{
+					pSS->PushFuncParamAny(ScriptAnyValue(pEntity));
+					pSS->PushFuncParamAny(ScriptAnyValue(frameTime));
+					pSS->EndCall();
+				}
+			}
+		}
+
+		// how CEntityScript::CallStateFunction calls OnUpdate
+		void UpdateCached(float frameTime)
+		{
+			for (IScriptTable* pEntity : entities)
+				Script::CallMethod(pEntity, onUpdate, frameTime);
+		}
+
+		IScriptSystem*                pSS;
+		SmartScriptTable              pClass;
+		HSCRIPTFUNCTION               onUpdate;
+		std::vector<SmartScriptTable> entities;
+	};
+
+	CRY_UNIT_TEST(CUT_ScriptCallParamsMatchAny)
+	{
+		SScriptEntities entities;
+		CRY_UNIT_TEST_ASSERT(entities.IsValid());
+		IScriptSystem* pSS = entities.pSS;
+		IScriptTable* pEntity = entities.entities[0];
+		const ScriptHandle handle((void*)pEntity);
+
+		bool bResult = false;
+		CRY_UNIT_TEST_ASSERT(pSS->BeginCall(pEntity, "CheckParams"));
+		pSS->PushFuncParam(pEntity);
+		pSS->PushFuncParam(0.5f);
+		pSS->PushFuncParam(true);
+		pSS->PushFuncParam(handle);
+		pSS->PushFuncParam(pEntity);
+		CRY_UNIT_TEST_ASSERT(pSS->EndCall(bResult) && bResult);
+
+		bResult = false;
+		CRY_UNIT_TEST_ASSERT(pSS->BeginCall(pEntity, "CheckParams"));
+		pSS->PushFuncParamAny(ScriptAnyValue(pEntity));
+		pSS->PushFuncParamAny(ScriptAnyValue(0.5f));
+		pSS->PushFuncParamAny(ScriptAnyValue(true));
+		pSS->PushFuncParamAny(ScriptAnyValue(handle));
+		pSS->PushFuncParamAny(ScriptAnyValue(pEntity));
+		CRY_UNIT_TEST_ASSERT(pSS->EndCall(bResult) && bResult);
+
+		bResult = false;
+		CRY_UNIT_TEST_ASSERT(pSS->BeginCall(pEntity, "IsNil"));
+		pSS->PushFuncParam(pEntity);
+		pSS->PushFuncParam((IScriptTable*)nullptr);
+		CRY_UNIT_TEST_ASSERT(pSS->EndCall(bResult) && bResult);
+
+		// all three update paths reach the same callback
+		entities.UpdateByName(0.25f);
+		entities.UpdateCachedAny(0.25f);
+		entities.UpdateCached(0.5f);
+		for (IScriptTable* pUpdated : entities.entities)
+		{
+			float time = 0.0f;
+			CRY_UNIT_TEST_ASSERT(pUpdated->GetValue("time", time));
+			CRY_UNIT_TEST_CHECK_EQUAL(time, 1.0f);
+		}
+	}
+
+	// One update of 10k script entities. Looking the callback up by name and converting the parameters
+	// to ScriptAnyValue, the cached callback with converted parameters, and the cached callback with the
+	// parameters pushed directly as entities call OnUpdate now.
+	struct SScriptCallsBenchmark : public CryUnitTest::SBenchmark
+	{
+		SScriptCallsBenchmark() : m_pEntities(nullptr) {}
+
+		virtual void Init() override { m_pEntities = new SScriptEntities(); }
+		virtual void Done() override { SAFE_DELETE(m_pEntities); }
+
+		SScriptEntities* m_pEntities;
+	};
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_ScriptCallbacks10kByName, SScriptCallsBenchmark)
+	{
+		if (m_pEntities->IsValid())
+			m_pEntities->UpdateByName(0.033f);
+	}
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_ScriptCallbacks10kCachedAny, SScriptCallsBenchmark)
+	{
+		if (m_pEntities->IsValid())
+			m_pEntities->UpdateCachedAny(0.033f);
+	}
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_ScriptCallbacks10kCached, SScriptCallsBenchmark)
+	{
+		if (m_pEntities->IsValid())
+			m_pEntities->UpdateCached(0.033f);
+	}
+}
+
+#endif // CRY_UNIT_TESTING
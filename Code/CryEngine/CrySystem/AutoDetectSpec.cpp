@@ -650,10 +650,12 @@ static void LogDeviceInfo(unsigned int adapterIdx, const DXGI_ADAPTER_DESC1& ad,
 	CryLogAlways("  - Suitable rendering device: %s", suitableDevice ? "yes" : "no");
 }
 
-static bool FindGPU(DXGI_ADAPTER_DESC1& adapterDesc, Win32SysInspect::DXFeatureLevel& featureLevel)
+static bool FindGPU(DXGI_ADAPTER_DESC1& adapterDesc, Win32SysInspect::DXFeatureLevel& featureLevel, uint64* pDriverVersion = nullptr)
 {
 	memset(&adapterDesc, 0, sizeof(adapterDesc));
 	featureLevel = Win32SysInspect::DXFL_Undefined;
+	if (pDriverVersion)
+		*pDriverVersion = 0;
 
 	if (!IsVistaOrAbove())
 		return false;
@@ -690,6 +692,12 @@ static bool FindGPU(DXGI_ADAPTER_DESC1& adapterDesc, Win32SysInspect::DXFeatureL
 					DXGI_ADAPTER_DESC1 ad;
 					pAdapter->GetDesc1(&ad);
 
+					// user mode driver version (product.version.subversion.build)
+					LARGE_INTEGER umdVersion;
+					umdVersion.QuadPart = 0;
+					if (pDriverVersion)
+						pAdapter->CheckInterfaceSupport(__uuidof(IDXGIDevice), &umdVersion);
+
 					if (!displaysConnected && r_overrideDXGIAdapter >= 0)
 						CryLogAlways("No display connected to DXGI adapter override %d. Adapter cannot be used for rendering.", r_overrideDXGIAdapter);
 
@@ -720,6 +728,8 @@ static bool FindGPU(DXGI_ADAPTER_DESC1& adapterDesc, Win32SysInspect::DXFeatureL
 						{
 							adapterDesc = ad;
 							featureLevel = fl;
+							if (pDriverVersion)
+								*pDriverVersion = umdVersion.QuadPart;
 						}
 
 						SAFE_RELEASE(pDevice12);
@@ -736,6 +746,8 @@ static bool FindGPU(DXGI_ADAPTER_DESC1& adapterDesc, Win32SysInspect::DXFeatureL
 						{
 							adapterDesc = ad;
 							featureLevel = fl;
+							if (pDriverVersion)
+								*pDriverVersion = umdVersion.QuadPart;
 						}
 
 						SAFE_RELEASE(pDevice11);
@@ -752,6 +764,8 @@ static bool FindGPU(DXGI_ADAPTER_DESC1& adapterDesc, Win32SysInspect::DXFeatureL
 						{
 							adapterDesc = ad;
 							featureLevel = fl;
+							if (pDriverVersion)
+								*pDriverVersion = umdVersion.QuadPart;
 						}
 
 						SAFE_RELEASE(pDevice11);
@@ -809,6 +823,21 @@ bool Win32SysInspect::GetGPUInfo(char* pName, size_t bufferSize, unsigned int& v
 	return gpuFound;
 }
 
+uint64 Win32SysInspect::GetGPUDriverVersion()
+{
+	DXGI_ADAPTER_DESC1 adapterDesc = { 0 };
+	DXFeatureLevel featureLevel = Win32SysInspect::DXFL_Undefined;
+	uint64 driverVersion = 0;
+	FindGPU(adapterDesc, featureLevel, &driverVersion);
+	return driverVersion;
+}
+
+void Win32SysInspect::GetCPUName(char* pName, size_t bufferSize)
+{
+	::GetCPUName(pName, bufferSize);
+	TrimExcessiveWhiteSpaces(pName);
+}
+
 class CGPURating
 {
 public:
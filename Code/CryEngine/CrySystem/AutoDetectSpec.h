@@ -56,6 +56,8 @@ void          GetNumCPUCores(unsigned int& totAvailToSystem, unsigned int& totAv
 bool          IsDX11Supported();
 bool          IsDX12Supported();
 bool          GetGPUInfo(char* pName, size_t bufferSize, unsigned int& vendorID, unsigned int& deviceID, unsigned int& totLocalVidMem, DXFeatureLevel& featureLevel);
+uint64        GetGPUDriverVersion();
+void          GetCPUName(char* pName, size_t bufferSize);
 int           GetGPURating(unsigned int vendorId, unsigned int deviceId);
 void          GetOS(SPlatformInfo::EWinVersion& ver, bool& is64Bit, char* pName, size_t bufferSize);
 bool          IsVistaKB940105Required();
@@ -291,6 +291,15 @@ public:
 	LARGE_INTEGER GetFrequency() const { return m_frequency; }
 	const SThreadEntry* GetThreadEntries() const { return m_threadEntry; }
 
+	void SetCriticalPath(const CBootProfiler::SCriticalPathStep* pSteps, size_t numSteps, float totalTimeMS)
+	{
+		m_criticalPath.assign(pSteps, pSteps + numSteps);
+		m_criticalPathTimeMS = totalTimeMS;
+	}
+
+	const std::vector<CBootProfiler::SCriticalPathStep>& GetCriticalPath() const { return m_criticalPath; }
+	float GetCriticalPathTime() const { return m_criticalPathTimeMS; }
+
 private:
 
 	SThreadEntry        m_threadEntry[eMAX_THREADS_TO_PROFILE];
@@ -298,11 +307,14 @@ private:
 	CryFixedStringT<32> m_name;
 
 	LARGE_INTEGER       m_frequency;
+
+	std::vector<CBootProfiler::SCriticalPathStep> m_criticalPath;
+	float               m_criticalPathTimeMS;
 };
 
 //////////////////////////////////////////////////////////////////////////
 
-CBootProfilerSession::CBootProfilerSession(const char* szName) : m_name(szName)
+CBootProfilerSession::CBootProfilerSession(const char* szName) : m_name(szName), m_criticalPathTimeMS(0.0f)
 {
 	memset(m_threadEntry, 0, sizeof(m_threadEntry));
 
@@ -431,6 +443,29 @@ static void SaveProfileSessionToDisk(const float funcMinTimeThreshold, CBootProf
 		}
 	}
 
+	const std::vector<CBootProfiler::SCriticalPathStep>& criticalPath = pSession->GetCriticalPath();
+	if (!criticalPath.empty())
+	{
+		cry_sprintf(buf, buf_size, "\t<criticalPath totalTimeMS=\"%f\">\n", pSession->GetCriticalPathTime());
+		fprintf(pFile, "%s", buf);
+
+		for (const CBootProfiler::SCriticalPathStep& step : criticalPath)
+		{
+			stack_string name = step.name.c_str();
+			name.replace("&", "&amp;");
+			name.replace("<", "&lt;");
+			name.replace(">", "&gt;");
+			name.replace("\"", "&quot;");
+
+			cry_sprintf(buf, buf_size, "\t\t<step name=\"%s\" thread=\"%s\" startMS=\"%f\" totalTimeMS=\"%f\" waitMS=\"%f\"/>\n",
+			            name.c_str(), step.threadName.c_str(), step.startMS, step.durationMS, step.waitMS);
+			fprintf(pFile, "%s", buf);
+		}
+
+		cry_sprintf(buf, buf_size, "\t</criticalPath>\n");
+		fprintf(pFile, "%s", buf);
+	}
+
 	cry_sprintf(buf, buf_size, "</root>\n");
 	fprintf(pFile, "%s", buf);
 
@@ -548,6 +583,14 @@ void CBootProfiler::StopBlock(CBootProfilerRecord* record)
 	}
 }
 
+void CBootProfiler::SetCriticalPath(const SCriticalPathStep* pSteps, size_t numSteps, float totalTimeMS)
+{
+	if (m_pCurrentSession)
+	{
+		m_pCurrentSession->SetCriticalPath(pSteps, numSteps, totalTimeMS);
+	}
+}
+
 void CBootProfiler::StartFrame(const char* name)
 {
 	static int prev_CV_sys_bp_frames = CV_sys_bp_frames;
@@ -30,6 +30,15 @@ public:
 		{}
 	};
 
+	struct SCriticalPathStep
+	{
+		CryFixedStringT<64> name;
+		CryFixedStringT<32> threadName;
+		float               startMS;    // since the start of the path
+		float               durationMS;
+		float               waitMS;     // spent waiting for other steps
+	};
+
 	typedef CryMT::vector<CBootProfilerSession*> TSessions;
 	typedef CryMT::vector<SSaveSessionInfo> TSessionsToSave;
 
@@ -56,6 +65,9 @@ public:
 	CBootProfilerRecord*  StartBlock(const char* name, const char* args);
 	void                  StopBlock(CBootProfilerRecord* record);
 
+	// Saved with the current session, see CSystemInitGraph.
+	void                  SetCriticalPath(const SCriticalPathStep* pSteps, size_t numSteps, float totalTimeMS);
+
 	void                  StartFrame(const char* name);
 	void                  StopFrame();
 
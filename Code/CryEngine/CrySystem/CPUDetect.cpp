@@ -1646,4 +1646,125 @@ void CCpuFeatures::Detect(void)
 	for (int i = m_NumPhysicsProcessors = 0; i < m_NumAvailProcessors; i++)
 		if (m_Cpu[i].mbPhysical)
 			++m_NumPhysicsProcessors;
+
+	DetectTopology();
+}
+
+#if CRY_PLATFORM_LINUX
+// reads a single integer from a sysfs file, returns false if the file doesn't exist (e.g. older kernels)
+static bool ReadSysFsInt(const char* szPath, int& rValue)
+{
+	FILE* pFile = fopen(szPath, "r");
+	if (!pFile)
+		return false;
+	const bool bRead = fscanf(pFile, "%d", &rValue) == 1;
+	fclose(pFile);
+	return bRead;
+}
+#endif
+
+// maps os specific ids to a dense [0..n) range
+static uint8 GetDenseTopologyId(int* pKnownIds, uint& rNumKnownIds, int nId)
+{
+	for (uint i = 0; i < rNumKnownIds; ++i)
+		if (pKnownIds[i] == nId)
+			return (uint8)i;
+	pKnownIds[rNumKnownIds] = nId;
+	return (uint8)rNumKnownIds++;
+}
+
+void CCpuFeatures::DetectTopology()
+{
+	// defaults: one cache cluster and one node containing all cpus
+	for (uint c = 0; c < m_NumAvailProcessors; ++c)
+	{
+		m_Cpu[c].mCoreId = (uint8)c;
+		m_Cpu[c].mCacheClusterId = 0;
+		m_Cpu[c].mNumaNodeId = 0;
+	}
+	m_NumCacheClusters = 1;
+	m_NumNumaNodes = 1;
+
+#if CRY_PLATFORM_WINDOWS
+	DWORD nBufferSize = 0;
+	GetLogicalProcessorInformation(NULL, &nBufferSize);
+	if (nBufferSize == 0)
+		return;
+
+	std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> infos(nBufferSize / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+	if (!GetLogicalProcessorInformation(&infos[0], &nBufferSize))
+		return;
+
+	uint nNumCores = 0, nNumClusters = 0, nNumNodes = 0;
+	for (const SYSTEM_LOGICAL_PROCESSOR_INFORMATION& info : infos)
+	{
+		const bool bCore = info.Relationship == RelationProcessorCore;
+		const bool bCluster = info.Relationship == RelationCache && info.Cache.Level == 3;
+		const bool bNode = info.Relationship == RelationNumaNode;
+		if (!bCore && !bCluster && !bNode)
+			continue;
+
+		for (uint c = 0; c < m_NumAvailProcessors; ++c)
+		{
+			if ((info.ProcessorMask & ((ULONG_PTR)1 << c)) == 0)
+				continue;
+			if (bCore)    m_Cpu[c].mCoreId = (uint8)nNumCores;
+			if (bCluster) m_Cpu[c].mCacheClusterId = (uint8)nNumClusters;
+			if (bNode)    m_Cpu[c].mNumaNodeId = (uint8)nNumNodes;
+		}
+		nNumCores += bCore ? 1 : 0;
+		nNumClusters += bCluster ? 1 : 0;
+		nNumNodes += bNode ? 1 : 0;
+	}
+	m_NumCacheClusters = max(nNumClusters, 1u);
+	m_NumNumaNodes = max(nNumNodes, 1u);
+#elif CRY_PLATFORM_LINUX
+	int knownCores[MAX_CPU], knownClusters[MAX_CPU], knownNodes[MAX_CPU];
+	uint nNumCores = 0, nNumClusters = 0, nNumNodes = 0;
+	char szPath[256];
+	for (uint c = 0; c < m_NumAvailProcessors; ++c)
+	{
+		if (m_Cpu[c].mAffinityMask == 0)
+			m_Cpu[c].mAffinityMask = (DWORD_PTR)1 << c;
+
+		int nPackageId = 0;
+		cry_sprintf(szPath, "/sys/devices/system/cpu/cpu%u/topology/physical_package_id", c);
+		ReadSysFsInt(szPath, nPackageId);
+
+		int nCoreId = c;
+		cry_sprintf(szPath, "/sys/devices/system/cpu/cpu%u/topology/core_id", c);
+		ReadSysFsInt(szPath, nCoreId);
+		m_Cpu[c].mCoreId = GetDenseTopologyId(knownCores, nNumCores, (nPackageId << 16) | nCoreId);
+
+		// L3 id is only exported by newer kernels, fall back to the package
+		int nClusterId = 0;
+		cry_sprintf(szPath, "/sys/devices/system/cpu/cpu%u/cache/index3/id", c);
+		if (ReadSysFsInt(szPath, nClusterId))
+			nClusterId = (nPackageId << 16) | nClusterId;
+		else
+			nClusterId = nPackageId;
+		m_Cpu[c].mCacheClusterId = GetDenseTopologyId(knownClusters, nNumClusters, nClusterId);
+
+		// a cpu is linked into its node directory, without NUMA support the package is the best guess
+		int nNodeId = nPackageId;
+		for (int node = 0; node < MAX_CPU; ++node)
+		{
+			cry_sprintf(szPath, "/sys/devices/system/cpu/cpu%u/node%d", c, node);
+			if (access(szPath, F_OK) == 0)
+			{
+				nNodeId = node;
+				break;
+			}
+		}
+		m_Cpu[c].mNumaNodeId = GetDenseTopologyId(knownNodes, nNumNodes, nNodeId);
+	}
+	m_NumCacheClusters = max(nNumClusters, 1u);
+	m_NumNumaNodes = max(nNumNodes, 1u);
+#endif
+
+	CryLogAlways("CPU topology: %u L3 cache cluster(s), %u NUMA node(s)", m_NumCacheClusters, m_NumNumaNodes);
+	for (uint i = 0; i < m_NumCacheClusters; ++i)
+		CryLogAlways("  L3 cluster %u: affinity mask 0x%" PRIx64, i, (uint64)GetCacheClusterAffinityMask(i));
+	for (uint i = 0; i < m_NumNumaNodes; ++i)
+		CryLogAlways("  NUMA node %u: affinity mask 0x%" PRIx64, i, (uint64)GetNumaNodeAffinityMask(i));
 }
@@ -85,12 +85,15 @@ struct SCpu
 	char          mFpuType[64];
 	bool          mbPhysical; // false for hyperthreaded
 	DWORD_PTR     mAffinityMask;
+	uint8         mCoreId;         // dense index of the physical core, SMT siblings share it
+	uint8         mCacheClusterId; // dense index of the group of cores sharing the last level (L3) cache
+	uint8         mNumaNodeId;     // dense index of the NUMA node (socket if NUMA information is not available)
 
 	// constructor
 	SCpu()
 		: meVendor(eCVendor_Unknown), meModel(eCpu_Unknown), mFeatures(0),
 		mbSerialPresent(false), mFamily(0), mModel(0), mStepping(0),
-		mbPhysical(true), mAffinityMask(0)
+		mbPhysical(true), mAffinityMask(0), mCoreId(0), mCacheClusterId(0), mNumaNodeId(0)
 	{
 		memset(mSerialNumber, 0, sizeof(mSerialNumber));
 		memset(mVendor, 0, sizeof(mVendor));
@@ -107,6 +110,8 @@ private:
 	uint  m_NumAvailProcessors;
 	uint  m_NumPhysicsProcessors;
 	uint32 m_nFeatures;
+	uint  m_NumCacheClusters;
+	uint  m_NumNumaNodes;
 	bool m_bOS_ISSE;
 	bool m_bOS_ISSE_EXCEPTIONS;
 public:
@@ -121,12 +126,15 @@ public:
 		m_NumAvailProcessors = 0;
 		m_NumPhysicsProcessors = 0;
 		m_nFeatures = 0;
+		m_NumCacheClusters = 1;
+		m_NumNumaNodes = 1;
 		m_bOS_ISSE = 0;
 		m_bOS_ISSE_EXCEPTIONS = 0;
 		ZeroMemory(m_Cpu, sizeof(m_Cpu));
 	}
 
 	void      Detect();
+	void      DetectTopology();
 
 	uint      GetLogicalCPUCount() const          { return m_NumLogicalProcessors; }
 	uint      GetPhysCPUCount() const             { return m_NumPhysicsProcessors; }
@@ -144,6 +152,26 @@ public:
 		PREFAST_ASSUME(i > 0 && i < MAX_CPU);
 		return m_Cpu[i - 1].mAffinityMask;
 	}
+
+	// cpu topology, always at least one cluster/node containing all available cpus
+	uint      GetNumCacheClusters() const                  { return m_NumCacheClusters; }
+	uint      GetNumNumaNodes() const                      { return m_NumNumaNodes; }
+	DWORD_PTR GetCacheClusterAffinityMask(uint iCluster) const
+	{
+		DWORD_PTR mask = 0;
+		for (uint i = 0; i < GetCPUCount(); ++i)
+			if (m_Cpu[i].mCacheClusterId == iCluster)
+				mask |= m_Cpu[i].mAffinityMask;
+		return mask;
+	}
+	DWORD_PTR GetNumaNodeAffinityMask(uint iNode) const
+	{
+		DWORD_PTR mask = 0;
+		for (uint i = 0; i < GetCPUCount(); ++i)
+			if (m_Cpu[i].mNumaNodeId == iNode)
+				mask |= m_Cpu[i].mAffinityMask;
+		return mask;
+	}
 };
 
 #endif // #ifndef __CPUDETECT_H__
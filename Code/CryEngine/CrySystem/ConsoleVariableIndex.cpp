@@ -0,0 +1,156 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "StdAfx.h"
+#include "ConsoleVariableIndex.h"
+#include <CrySystem/IConsole.h>
+
+namespace
+{
+char s_removedSentinel;
+}
+
+ICVar* const CConsoleVariableIndex::s_pRemoved = reinterpret_cast<ICVar*>(&s_removedSentinel);
+
+//////////////////////////////////////////////////////////////////////////
+uint32 CConsoleVariableIndex::HashName(const char* szName)
+{
+	// FNV-1a
+	uint32 nHash = 0x811c9dc5;
+	for (const char* p = szName; *p; ++p)
+	{
+		char c = *p;
+		if (c >= 'A' && c <= 'Z')
+			c += 'a' - 'A';
+		nHash = (nHash ^ (uint8)c) * 0x01000193;
+	}
+	return nHash ? nHash : 1;
+}
+
+//////////////////////////////////////////////////////////////////////////
+CConsoleVariableIndex::CConsoleVariableIndex()
+	: m_pTable(AllocateTable(4096))
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+CConsoleVariableIndex::~CConsoleVariableIndex()
+{
+	free(m_pTable);
+	for (STable* pTable : m_retiredTables)
+		free(pTable);
+}
+
+//////////////////////////////////////////////////////////////////////////
+CConsoleVariableIndex::STable* CConsoleVariableIndex::AllocateTable(uint32 nSize)
+{
+	STable* const pTable = (STable*)malloc(sizeof(STable) + (nSize - 1) * sizeof(SSlot));
+	pTable->nMask = nSize - 1;
+	pTable->nUsed = 0;
+	memset(pTable->slots, 0, nSize * sizeof(SSlot));
+	return pTable;
+}
+
+//////////////////////////////////////////////////////////////////////////
+ICVar* CConsoleVariableIndex::Find(const char* szName) const
+{
+	const STable* const pTable = m_pTable;
+	const uint32 nHash = HashName(szName);
+	for (uint32 i = nHash & pTable->nMask;; i = (i + 1) & pTable->nMask)
+	{
+		const SSlot& slot = pTable->slots[i];
+		ICVar* const pCVar = slot.pCVar;
+		if (!pCVar)
+			return NULL;
+		if (pCVar != s_pRemoved && slot.nHash == nHash && stricmp(pCVar->GetName(), szName) == 0)
+			return pCVar;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CConsoleVariableIndex::Insert(ICVar* pCVar)
+{
+	CryAutoLock<CryCriticalSectionNonRecursive> lock(m_lock);
+
+	// keep the load (including tombstones) below 50% so that most lookups are a single probe
+	if ((m_pTable->nUsed + 1) * 2 > m_pTable->nMask + 1)
+		Grow_Locked();
+
+	InsertSlot_Locked(m_pTable, HashName(pCVar->GetName()), pCVar);
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CConsoleVariableIndex::InsertSlot_Locked(STable* pTable, uint32 nHash, ICVar* pCVar)
+{
+	for (uint32 i = nHash & pTable->nMask;; i = (i + 1) & pTable->nMask)
+	{
+		SSlot& slot = pTable->slots[i];
+		if (slot.pCVar == s_pRemoved && slot.nHash == nHash)
+		{
+			// re-registering the same name, the hash readers compare against stays the same
+			CryInterlockedExchangePointer((void* volatile*)&slot.pCVar, pCVar);
+			return;
+		}
+		if (!slot.pCVar)
+		{
+			slot.nHash = nHash;
+			CryInterlockedExchangePointer((void* volatile*)&slot.pCVar, pCVar);
+			++pTable->nUsed;
+			return;
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CConsoleVariableIndex::Remove(ICVar* pCVar)
+{
+	CryAutoLock<CryCriticalSectionNonRecursive> lock(m_lock);
+
+	// readers may still be probing a retired table, the variable must vanish from those too
+	const uint32 nHash = HashName(pCVar->GetName());
+	for (size_t t = 0; t <= m_retiredTables.size(); ++t)
+	{
+		STable* const pTable = t < m_retiredTables.size() ? m_retiredTables[t] : m_pTable;
+		for (uint32 i = nHash & pTable->nMask; pTable->slots[i].pCVar; i = (i + 1) & pTable->nMask)
+		{
+			if (pTable->slots[i].pCVar == pCVar)
+			{
+				CryInterlockedExchangePointer((void* volatile*)&pTable->slots[i].pCVar, s_pRemoved);
+				break;
+			}
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CConsoleVariableIndex::Grow_Locked()
+{
+	STable* const pOldTable = m_pTable;
+
+	uint32 nLive = 0;
+	for (uint32 i = 0; i <= pOldTable->nMask; ++i)
+		nLive += (pOldTable->slots[i].pCVar && pOldTable->slots[i].pCVar != s_pRemoved) ? 1 : 0;
+
+	uint32 nSize = pOldTable->nMask + 1;
+	while ((nLive + 1) * 4 > nSize)
+		nSize *= 2;
+
+	STable* const pNewTable = AllocateTable(nSize);
+	for (uint32 i = 0; i <= pOldTable->nMask; ++i)
+	{
+		const SSlot& slot = pOldTable->slots[i];
+		if (slot.pCVar && slot.pCVar != s_pRemoved)
+			InsertSlot_Locked(pNewTable, slot.nHash, slot.pCVar);
+	}
+
+	CryInterlockedExchangePointer((void* volatile*)&m_pTable, pNewTable);
+	m_retiredTables.push_back(pOldTable);
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CConsoleVariableIndex::GetMemoryUsage(ICrySizer* pSizer) const
+{
+	pSizer->AddObject(m_pTable, sizeof(STable) + m_pTable->nMask * sizeof(SSlot));
+	for (const STable* pTable : m_retiredTables)
+		pSizer->AddObject(pTable, sizeof(STable) + pTable->nMask * sizeof(SSlot));
+	pSizer->AddContainer(m_retiredTables);
+}
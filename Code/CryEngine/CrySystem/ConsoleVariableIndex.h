@@ -0,0 +1,57 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#ifndef _CRY_SYSTEM_CONSOLE_VARIABLE_INDEX_HDR_
+#define _CRY_SYSTEM_CONSOLE_VARIABLE_INDEX_HDR_
+
+struct ICVar;
+
+//////////////////////////////////////////////////////////////////////////
+// Open addressing hash table of the registered console variables, keyed by the case insensitive name hash.
+// Lookups are wait-free and can run on any thread while the main thread registers and unregisters variables:
+// a slot is published by a single pointer store, unregistered variables leave a tombstone behind, and a grown
+// table doesn't free the previous one until the index is destroyed, since readers may still be probing it.
+// A variable must not be deleted while another thread may still be using the pointer it looked up, as before.
+//////////////////////////////////////////////////////////////////////////
+class CConsoleVariableIndex
+{
+public:
+	// case insensitive, never 0
+	static uint32 HashName(const char* szName);
+
+	CConsoleVariableIndex();
+	~CConsoleVariableIndex();
+
+	// writers are serialized internally
+	void   Insert(ICVar* pCVar);
+	void   Remove(ICVar* pCVar);
+
+	ICVar* Find(const char* szName) const;
+
+	void   GetMemoryUsage(ICrySizer* pSizer) const;
+
+private:
+	struct SSlot
+	{
+		ICVar* volatile pCVar; // NULL = free, s_pRemoved = tombstone
+		uint32          nHash;
+	};
+
+	struct STable
+	{
+		uint32 nMask;
+		uint32 nUsed; // including the tombstones
+		SSlot  slots[1];
+	};
+
+	static STable* AllocateTable(uint32 nSize);
+	static void    InsertSlot_Locked(STable* pTable, uint32 nHash, ICVar* pCVar);
+	void           Grow_Locked();
+
+	static ICVar* const            s_pRemoved;
+
+	STable* volatile               m_pTable;
+	std::vector<STable*>           m_retiredTables;
+	CryCriticalSectionNonRecursive m_lock;
+};
+
+#endif
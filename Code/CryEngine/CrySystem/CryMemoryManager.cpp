@@ -444,6 +444,10 @@ void BucketAllocatorReplayRegisterAddressRange(const char* name)
 	g_GlobPageBucketAllocator.ReplayRegisterAddressRange(name);
 	#endif //CAPTURE_REPLAY_LOG
 }
+void BucketAllocatorGetThreadCacheStats(SBucketThreadCacheStats& stats)
+{
+	g_GlobPageBucketAllocator.GetThreadCacheStats(stats);
+}
 #endif //defined(USE_GLOBAL_BUCKET_ALLOCATOR)
 
 #if CRY_PLATFORM_ORBIS
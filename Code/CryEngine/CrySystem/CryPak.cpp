@@ -43,6 +43,7 @@
 #endif
 
 #include <CrySystem/Profilers/IDiskProfiler.h>
+#include "DiskProfiler.h"
 
 #if CRY_PLATFORM_IOS
 	#include "SystemUtilsApple.h"
@@ -398,7 +399,8 @@ CCryPak::CCryPak(IMiniLog* pLog, PakVars* pPakVars, const bool bLvlRes, const IG
 	m_fFileAcessTime(0.f),
 	m_bLvlRes(bLvlRes),
 	m_renderThreadId(0),
-	m_pWidget(NULL)
+	m_pWidget(NULL),
+	m_nNextFileIndexId(1)
 {
 	LOADING_TIME_PROFILE_SECTION;
 
@@ -1549,7 +1551,7 @@ FILE* CCryPak::FOpen(const char* pName, const char* szMode, unsigned nInputFlags
 	if (strlen(pName) >= g_nMaxPath)
 		return 0;
 
-	PROFILE_DISK_OPEN;
+	PROFILE_DISK_OPEN_WITHNAME(pName);
 	SAutoCollectFileAcessTime accessTime(this);
 
 	FILE* fp = NULL;
@@ -1850,6 +1852,11 @@ bool CCryPak::WillOpenFromPak(const char* szPath)
 // tests if the given file path refers to an existing file inside registered (opened) packs
 // the path must be absolute normalized lower-case with forward-slashes
 ZipDir::FileEntry* CCryPak::FindPakFileEntry(const char* szPath, unsigned int& nArchiveFlags, ZipDir::CachePtr* pZip, bool bSkipInMemoryPaks)
+{
+	return FindPakFileEntryImpl(szPath, nArchiveFlags, pZip, bSkipInMemoryPaks, m_pPakVars->nFileIndex != 0);
+}
+
+ZipDir::FileEntry* CCryPak::FindPakFileEntryImpl(const char* szPath, unsigned int& nArchiveFlags, ZipDir::CachePtr* pZip, bool bSkipInMemoryPaks, bool bUseIndex)
 {
 	FUNCTION_PROFILER(gEnv->pSystem, PROFILE_SYSTEM);
 
@@ -1860,6 +1867,23 @@ ZipDir::FileEntry* CCryPak::FindPakFileEntry(const char* szPath, unsigned int& n
 
 	unsigned nNameLen = (unsigned)strlen(szPath);
 	AUTO_READLOCK(m_csZips);
+
+	// a path being in more paks than fit here is rare enough to just search the directories
+	CPakFileIndex::SCandidate candidates[8];
+	uint32 nCandidates = 0;
+	const char* szFileName = szPath;
+	if (bUseIndex)
+	{
+		nCandidates = m_fileIndex.Find(CPakFileIndex::HashPath(szPath), candidates, CRY_ARRAY_COUNT(candidates));
+		bUseIndex = nCandidates <= CRY_ARRAY_COUNT(candidates);
+
+		for (const char* p = szPath; *p; ++p)
+		{
+			if (*p == '/' || *p == '\\')
+				szFileName = p + 1;
+		}
+	}
+
 	// scan through registered pak files and try to find this file
 	for (ZipArray::reverse_iterator itZip = m_arrZips.rbegin(); itZip != m_arrZips.rend(); ++itZip)
 	{
@@ -1869,23 +1893,42 @@ ZipDir::FileEntry* CCryPak::FindPakFileEntry(const char* szPath, unsigned int& n
 		if (itZip->pArchive->GetFlags() & ICryArchive::FLAGS_DISABLE_PAK)
 			continue;
 
-		size_t nBindRootLen = itZip->strBindRoot.length();
-
 		size_t nRootCompLength = itZip->strBindRoot.length();
 		const char* const cpRoot = itZip->strBindRoot.c_str();
 
 		if (nNameLen > nRootCompLength && !memcmp(cpRoot, szPath, nRootCompLength))
 		{
-			nBindRootLen = nRootCompLength;
+			ZipDir::FileEntry* pFileEntry = NULL;
+			if (bUseIndex && itZip->nIndexId)
+			{
+				for (uint32 i = 0; i < nCandidates; ++i)
+				{
+					if (candidates[i].nPackId != itZip->nIndexId)
+						continue;
+
+					// compare the full path in the pak, different paths can have the same hash
+					const char* szPathInPak = szPath + nRootCompLength;
+					if (szFileName < szPathInPak || !CPakFileIndex::IsSameDirPath(candidates[i].szDirPath, szPathInPak, szFileName - szPathInPak))
+						continue;
+
+					ZipDir::FileEntry* pCandidate = (ZipDir::FileEntry*)((uint8*)itZip->pZip->GetDataPointer() + candidates[i].nFileEntryOffset);
+					if (!stricmp(itZip->pZip->GetFileEntryName(pCandidate), szFileName))
+					{
+						pFileEntry = pCandidate;
+						break;
+					}
+				}
+			}
+			else
+			{
+				pFileEntry = itZip->pZip->FindFile(szPath + nRootCompLength);
+			}
 
-			ZipDir::FileEntry* pFileEntry = itZip->pZip->FindFile(szPath + nBindRootLen);
 			if (pFileEntry)
 			{
 				if (pZip)
 					*pZip = itZip->pZip;
 
-				//if (pZip)
-				//CryLog( "Zip [%s] %s",itZip->pZip->GetFilePath(),szPath );
 				nArchiveFlags = itZip->pArchive->GetFlags();
 				return pFileEntry;
 			}
@@ -1895,6 +1938,71 @@ ZipDir::FileEntry* CCryPak::FindPakFileEntry(const char* szPath, unsigned int& n
 	return NULL;
 }
 
+//////////////////////////////////////////////////////////////////////////
+void CCryPak::BenchmarkFileIndex(int nIterations)
+{
+	std::vector<string> trace;
+#ifdef USE_DISK_PROFILER
+	if (CDiskProfiler* pDiskProfiler = static_cast<CDiskProfiler*>(gEnv->pSystem->GetIDiskProfiler()))
+		pDiskProfiler->GetFileOpenTrace(trace);
+#endif
+	if (trace.empty())
+	{
+		CryLogAlways("No file opens recorded, enable profile_disk and load a level first");
+		return;
+	}
+
+	char szFullPathBuf[g_nMaxPath];
+	for (string& path : trace)
+		path = AdjustFileName(path.c_str(), szFullPathBuf, 0);
+
+	// both schemes have to agree, otherwise the index is broken
+	uint32 nFound = 0, nMismatches = 0;
+	for (const string& path : trace)
+	{
+		unsigned int nFlags;
+		ZipDir::FileEntry* pIndexed = FindPakFileEntryImpl(path.c_str(), nFlags, NULL, false, true);
+		ZipDir::FileEntry* pSearched = FindPakFileEntryImpl(path.c_str(), nFlags, NULL, false, false);
+		nFound += pSearched ? 1 : 0;
+		if (pIndexed != pSearched)
+		{
+			if (nMismatches++ < 10)
+				CryLogAlways("  index and directory search disagree on %s", path.c_str());
+		}
+	}
+
+	int64 nTicks[2];
+	for (int nScheme = 0; nScheme < 2; ++nScheme)
+	{
+		const int64 nStartTicks = CryGetTicks();
+		for (int i = 0; i < nIterations; ++i)
+		{
+			for (const string& path : trace)
+			{
+				unsigned int nFlags;
+				FindPakFileEntryImpl(path.c_str(), nFlags, NULL, false, nScheme == 0);
+			}
+		}
+		nTicks[nScheme] = CryGetTicks() - nStartTicks;
+	}
+
+	size_t nIndexedPaks = 0;
+	{
+		AUTO_READLOCK(m_csZips);
+		for (const PackDesc& desc : m_arrZips)
+			nIndexedPaks += desc.nIndexId ? 1 : 0;
+		CryLogAlways("File lookup benchmark: %" PRISIZE_T " of %" PRISIZE_T " paks indexed, %" PRISIZE_T " files in the index",
+		             nIndexedPaks, m_arrZips.size(), m_fileIndex.GetNumEntries());
+	}
+
+	const float fLookups = (float)trace.size() * nIterations;
+	const float fIndexTime = gEnv->pTimer->TicksToSeconds(nTicks[0]);
+	const float fSearchTime = gEnv->pTimer->TicksToSeconds(nTicks[1]);
+	CryLogAlways("  %u lookups x %d iterations (%u found in paks, %u mismatches)", (uint32)trace.size(), nIterations, nFound, nMismatches);
+	CryLogAlways("  index:            %8.2f ms, %6.3f us per lookup", fIndexTime * 1000.f, fIndexTime * 1000000.f / fLookups);
+	CryLogAlways("  directory search: %8.2f ms, %6.3f us per lookup", fSearchTime * 1000.f, fSearchTime * 1000000.f / fLookups);
+}
+
 long CCryPak::FTell(FILE* hFile)
 {
 	AUTO_READLOCK(m_csOpenFiles);
@@ -2567,6 +2675,10 @@ bool CCryPak::OpenPackCommon(const char* szBindRoot, const char* szFullPath, uns
 			}
 		}
 		ZipArray::iterator itZipPlace = revItZip.base();
+
+		if (m_pPakVars->nFileIndex && m_fileIndex.AddPack(m_nNextFileIndexId, desc.strBindRoot.c_str(), desc.pZip))
+			desc.nIndexId = m_nNextFileIndexId++;
+
 		m_arrZips.insert(itZipPlace, desc);
 
 #if 0
@@ -2607,6 +2719,8 @@ bool CCryPak::ClosePack(const char* pName, unsigned nFlags)
 			bool bResult = (it->pZip->NumRefs() == 2) && it->pArchive->Unique();
 			if (bResult)
 			{
+				if (it->nIndexId)
+					m_fileIndex.RemovePack(it->nIndexId);
 				m_arrZips.erase(it);
 			}
 #if 0
@@ -3100,7 +3214,13 @@ CCachedFileData::~CCachedFileData()
 		m_pPak->Unregister(this);
 
 	// forced destruction
-	if (m_pFileData)
+	if (m_pFileMapping)
+	{
+		m_pFileMapping->RemoveView(m_pFileEntry->desc.lSizeUncompressed);
+		m_pFileMapping = NULL;
+		m_pFileData = NULL;
+	}
+	else if (m_pFileData)
 	{
 		g_pPakHeap->FreeTemporary(m_pFileData);
 		m_pFileData = NULL;
@@ -3162,6 +3282,10 @@ void* CCachedFileData::GetData(bool bRefreshCache, const bool decompress /* = tr
 			{
 				assert(!m_bDecompressedDecrypted);
 			}
+			if (MapData())
+				return m_pFileData;
+
+			const int64 nStartTicks = CryGetTicks();
 			uint32 nTempBufferSize = (allocateForDecompressed) ? m_pFileEntry->desc.lSizeUncompressed : m_pFileEntry->desc.lSizeCompressed;
 			void* fileData = g_pPakHeap->TempAlloc(nTempBufferSize, "CCachedFileData::GetData");
 
@@ -3177,12 +3301,35 @@ void* CCachedFileData::GetData(bool bRefreshCache, const bool decompress /* = tr
 				m_pFileData = fileData;
 				if (decompress || decrypt)
 					m_bDecompressedDecrypted = true;
+
+				if (m_pPak)
+				{
+					SFileDataStats& stats = m_pPak->m_fileDataStats;
+					CryInterlockedAdd(&stats.nCopies, (size_t)1);
+					CryInterlockedAdd(&stats.nCopyBytes, (size_t)nTempBufferSize);
+					CryInterlockedAdd(&stats.nCopyTicks, (size_t)(CryGetTicks() - nStartTicks));
+				}
 			}
 		}
 	}
 	return m_pFileData;
 }
 
+//////////////////////////////////////////////////////////////////////////
+const void* CCachedFileData::GetDataView()
+{
+	if (!m_pFileData)
+	{
+		assert(m_pZip);
+		assert(m_pFileEntry && m_pZip->IsOwnerOf(m_pFileEntry));
+		AUTO_LOCK_CS(m_csDecompressDecryptLock);
+		if (!m_pFileData && !MapData())
+			return NULL;
+	}
+	// the data may have been read into a heap copy before
+	return m_pFileMapping ? m_pFileData : NULL;
+}
+
 //////////////////////////////////////////////////////////////////////////
 int64 CCachedFileData::ReadData(void* pBuffer, int64 nFileOffset, int64 nReadSize)
 {
@@ -3200,33 +3347,48 @@ int64 CCachedFileData::ReadData(void* pBuffer, int64 nFileOffset, int64 nReadSiz
 	if (nReadSize == 0)
 		return 0;
 
-	if (m_pFileEntry->nMethod == ZipFile::METHOD_STORE) //Can't use this technique for METHOD_STORE_AND_STREAMCIPHER_KEYTABLE as seeking with encryption performs poorly
+	if (m_pFileEntry->nMethod == ZipFile::METHOD_STORE && !m_pFileData) //Can't use this technique for METHOD_STORE_AND_STREAMCIPHER_KEYTABLE as seeking with encryption performs poorly
 	{
 		AUTO_LOCK_CS(m_csDecompressDecryptLock);
-		// Uncompressed read.
-		if (ZipDir::ZD_ERROR_SUCCESS != m_pZip->ReadFile(m_pFileEntry, NULL, pBuffer, false, nFileOffset, nReadSize))
+		// Uncompressed read, unless the file can be copied straight from the mapped zip file
+		if (!m_pFileData && !MapData())
 		{
-			return -1;
+			if (ZipDir::ZD_ERROR_SUCCESS != m_pZip->ReadFile(m_pFileEntry, NULL, pBuffer, false, nFileOffset, nReadSize))
+			{
+				return -1;
+			}
+			return nReadSize;
 		}
 	}
-	else
-	{
-		uint8* pSrcBuffer = (uint8*)GetData(true, m_pFileEntry->IsCompressed(), true, m_pFileEntry->IsEncrypted());
 
-		if (pSrcBuffer)
-		{
-			pSrcBuffer += nFileOffset;
-			memcpy(pBuffer, pSrcBuffer, (size_t)nReadSize);
-		}
-		else
-		{
-			return -1;
-		}
-	}
+	uint8* pSrcBuffer = (uint8*)GetData(true, m_pFileEntry->IsCompressed(), true, m_pFileEntry->IsEncrypted());
+	if (!pSrcBuffer)
+		return -1;
 
+	memcpy(pBuffer, pSrcBuffer + nFileOffset, (size_t)nReadSize);
 	return nReadSize;
 }
 
+//////////////////////////////////////////////////////////////////////////
+bool CCachedFileData::MapData()
+{
+	if (!m_pPak || !m_pPak->m_pPakVars->nMapStoredFiles)
+		return false;
+
+	const void* pView = m_pZip->GetFileView(m_pFileEntry, m_pFileMapping);
+	if (!pView)
+		return false;
+
+	const size_t nSize = m_pFileEntry->desc.lSizeUncompressed;
+	m_pFileMapping->AddView(nSize);
+	m_pFileData = const_cast<void*>(pView);
+
+	SFileDataStats& stats = m_pPak->m_fileDataStats;
+	CryInterlockedAdd(&stats.nViews, (size_t)1);
+	CryInterlockedAdd(&stats.nViewBytes, nSize);
+	return true;
+}
+
 //////////////////////////////////////////////////////////////////////////
 void CCachedFileData::AddRef()
 {
@@ -3487,6 +3649,7 @@ void CCryPak::GetMemoryStatistics(ICrySizer* pSizer)
 		AUTO_READLOCK(m_csZips);
 		SIZER_SUBCOMPONENT_NAME(pSizer, "Zips");
 		pSizer->AddObject(m_arrZips);
+		pSizer->AddObject(m_fileIndex);
 	}
 
 	{
@@ -4621,6 +4784,9 @@ CCryPak::CPakFileWidget::CPakFileWidget(minigui::IMiniCtrl* pParentMenu, ICryPer
 		m_pTable->AddColumn("BindRoot");
 		m_pTable->AddColumn("In Mem");
 		m_pTable->AddColumn("Override");
+		m_pTable->AddColumn("Mapped MB");
+		m_pTable->AddColumn("Resident MB");
+		m_pTable->AddColumn("Views");
 		m_pTable->Hide(true);
 	}
 	pPerfHud->AddWidget(this);
@@ -4641,7 +4807,28 @@ void CCryPak::CPakFileWidget::Update()
 		m_pTable->AddData(1, col, it->strBindRoot.c_str());
 		m_pTable->AddData(2, col, it->pZip->IsInMemory() ? "true" : "false");
 		m_pTable->AddData(3, col, (it->pArchive->GetFlags() & ICryArchive::FLAGS_OVERRIDE_PAK) ? "true" : "false");
+
+		if (const ZipDir::CFileMapping* pMapping = it->pZip->GetFileMapping())
+		{
+			const int64 nResident = pMapping->GetResidentSize();
+			m_pTable->AddData(4, col, "%.1f", pMapping->GetSize() / (1024.f * 1024.f));
+			m_pTable->AddData(5, col, nResident >= 0 ? "%.1f" : "-", nResident / (1024.f * 1024.f));
+			m_pTable->AddData(6, col, "%d (%.1f MB)", pMapping->GetNumViews(), pMapping->GetViewBytes() / (1024.f * 1024.f));
+		}
+		else
+		{
+			m_pTable->AddData(4, col, "-");
+			m_pTable->AddData(5, col, "-");
+			m_pTable->AddData(6, col, "-");
+		}
 	}
+
+	// totals since startup, the copy time is what mapping the stored files saves
+	const SFileDataStats& stats = m_pPak->m_fileDataStats;
+	m_pTable->AddData(0, colNormal, "Copied: %" PRISIZE_T " files, %.1f MB in %.0f ms", stats.nCopies, stats.nCopyBytes / (1024.f * 1024.f), gEnv->pTimer->TicksToSeconds(stats.nCopyTicks) * 1000.f);
+	m_pTable->AddData(1, colNormal, "Mapped: %" PRISIZE_T " files, %.1f MB", stats.nViews, stats.nViewBytes / (1024.f * 1024.f));
+	for (int i = 2; i < 7; ++i)
+		m_pTable->AddData(i, colNormal, "");
 }
 
 bool CCryPak::ForEachArchiveFolderEntry(const char* szArchivePath, const char* szFolderPath, const ArchiveEntrySinkFunction& callback)
@@ -22,6 +22,7 @@
 #include "MTSafeAllocator.h"
 #include <CryCore/StlUtils.h>
 #include "PakVars.h"
+#include "PakFileIndex.h"
 #include "FileIOWrapper.h"
 #include <CryCore/Containers/VectorMap.h>
 #include <CrySystem/Profilers/IPerfHud.h>
@@ -44,6 +45,9 @@ struct CCachedFileData : public _i_reference_target_t
 	void* GetData(bool bRefreshCache = true, const bool decompress = true, const bool allocateForDecompressed = true, const bool decrypt = true);
 	// Uncompress file data directly to provided memory.
 	bool  GetDataTo(void* pFileData, int nDataSize, bool bDecompress = true);
+	// return a view of the stored file in the memory mapped zip file, or NULL if it can't be mapped.
+	// Never falls back to reading the file into a heap copy.
+	const void* GetDataView();
 
 	// Return number of copied bytes, or -1 if did not read anything
 	int64                    ReadData(void* pBuffer, int64 nFileOffset, int64 nReadSize);
@@ -65,7 +69,7 @@ struct CCachedFileData : public _i_reference_target_t
 
 	size_t sizeofThis() const
 	{
-		return sizeof(*this) + (m_pFileData && m_pFileEntry ? m_pFileEntry->desc.lSizeUncompressed : 0);
+		return sizeof(*this) + (m_pFileData && m_pFileEntry && !m_pFileMapping ? m_pFileEntry->desc.lSizeUncompressed : 0);
 	}
 
 	void GetMemoryUsage(ICrySizer* pSizer) const
@@ -97,7 +101,13 @@ public:
 	CryCriticalSection m_csDecompressDecryptLock;
 	volatile bool      m_bDecompressedDecrypted;
 
+	// set if m_pFileData is a view into the memory mapped zip file instead of a heap copy
+	ZipDir::CFileMappingPtr m_pFileMapping;
+
 private:
+	// must be called with m_csDecompressDecryptLock held
+	bool MapData();
+
 	CCachedFileData(const CCachedFileData&);
 	CCachedFileData& operator=(const CCachedFileData&);
 };
@@ -105,6 +115,19 @@ private:
 TYPEDEF_AUTOPTR(CCachedFileData);
 typedef CCachedFileData_AutoPtr CCachedFileDataPtr;
 
+//////////////////////////////////////////////////////////////////////////
+// statistics of the file data CCachedFileData provided, displayed by the pak file PerfHUD widget
+struct SFileDataStats
+{
+	volatile size_t nCopies;     // files read into a heap buffer
+	volatile size_t nCopyBytes;
+	volatile size_t nCopyTicks;  // time spent reading and unpacking them
+	volatile size_t nViews;      // stored files handed out as a view into a mapped zip file
+	volatile size_t nViewBytes;
+
+	SFileDataStats() : nCopies(0), nCopyBytes(0), nCopyTicks(0), nViews(0), nViewBytes(0) {}
+};
+
 //////////////////////////////////////////////////////////////////////////
 struct CCachedFileRawData : public CMultiThreadRefCount
 {
@@ -264,8 +287,11 @@ class CCryPak : public ICryPak, public ISystemEventListener
 	// the array of opened caches - they get destructed by themselves (these are auto-pointers, see the ZipDir::Cache documentation)
 	struct PackDesc
 	{
+		PackDesc() : nIndexId(0) {}
+
 		string          strBindRoot; // the zip binding root WITH the trailing native slash
 		string          strFileName; // the zip file name (with path) - very useful for debugging so please don't remove
+		uint32          nIndexId;    // the id of the files in m_fileIndex, 0 if the zip isn't indexed
 
 		TCommentDataMap m_commentData;  //VectorMap of key=value pairs from the zip archive comments
 		const char*     GetFullPath() const { return pZip->GetFilePath(); }
@@ -289,6 +315,8 @@ class CCryPak : public ICryPak, public ISystemEventListener
 	typedef std::vector<PackDesc, stl::STLGlobalAllocator<PackDesc>> ZipArray;
 	CryReadModifyLock m_csZips;
 	ZipArray          m_arrZips;
+	CPakFileIndex     m_fileIndex;            // guarded by m_csZips as well
+	uint32            m_nNextFileIndexId;
 	friend class CCryPakFindData;
 
 protected:
@@ -332,6 +360,7 @@ private:
 
 	ITimer*                             m_pITimer;
 	float                               m_fFileAcessTime;                           // Time used to perform file operations
+	SFileDataStats                      m_fileDataStats;                            // How the data of the files in paks was provided
 	std::vector<ICryPakFileAcesssSink*> m_FileAccessSinks;                          // useful for gathering file access statistics
 
 	const PakVars*                      m_pPakVars;
@@ -538,6 +567,9 @@ public: // ---------------------------------------------------------------------
 	ZipDir::FileEntry*              FindPakFileEntry(const char* szPath, unsigned int& nArchiveFlags, ZipDir::CachePtr* pZip = 0, bool bSkipInMemoryPaks = false);
 	ZipDir::FileEntry*              FindPakFileEntry(const char* szPath) { unsigned int flags; return FindPakFileEntry(szPath, flags); }
 
+	// replays the file opens recorded by the disk profiler to compare the lookup through m_fileIndex with the directory search
+	void                            BenchmarkFileIndex(int nIterations);
+
 	virtual bool                    LoadPakToMemory(const char* pName, EInMemoryPakLocation nLoadPakToMemory, IMemoryBlock* pMemoryBlock = NULL) override;
 	virtual void                    LoadPaksToMemory(int nMaxPakSize, bool bLoadToMemory) override;
 
@@ -686,6 +718,8 @@ private:
 
 	CPakFileWidget* m_pWidget;
 
+	ZipDir::FileEntry* FindPakFileEntryImpl(const char* szPath, unsigned int& nArchiveFlags, ZipDir::CachePtr* pZip, bool bSkipInMemoryPaks, bool bUseIndex);
+
 	virtual bool ForEachArchiveFolderEntry(const char* szArchivePath, const char* szFolderPath, const ArchiveEntrySinkFunction& callback) override;
 };
 
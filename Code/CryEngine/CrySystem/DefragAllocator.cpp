@@ -2,6 +2,7 @@
 
 #include "StdAfx.h"
 #include "DefragAllocator.h"
+#include "DefragScheduler.h"
 
 #ifdef CDBA_MORE_DEBUG
 	#pragma optimize("",off)
@@ -46,6 +47,9 @@ CDefragAllocator::~CDefragAllocator()
 
 void CDefragAllocator::Release(bool bDiscard)
 {
+	if (m_policy.pDefragPolicy)
+		CDefragScheduler::GetInstance().Unregister(this);
+
 	if (!bDiscard)
 	{
 		if (m_policy.pDefragPolicy)
@@ -149,6 +153,9 @@ void CDefragAllocator::Init(UINT_PTR capacity, UINT_PTR minAlignment, const Poli
 #ifdef CDBA_MORE_DEBUG
 	m_nLastCheckedChunk = 0;
 #endif
+
+	if (policy.pDefragPolicy)
+		CDefragScheduler::GetInstance().Register(this, policy.szName);
 }
 
 #ifndef _RELEASE
@@ -569,10 +576,20 @@ size_t CDefragAllocator::DefragmentTick(size_t maxMoves, size_t maxAmount, bool
 	Tick_Validation_Locked();
 #endif
 
+	// Share the frame's budget with the other defragmenting heaps
+	if (!bForce && m_policy.pDefragPolicy)
+	{
+		maxAmount = CDefragScheduler::GetInstance().BeginTick(this, (size_t)m_capacity << m_logMinAlignment, Defrag_GetFragmentedSize_Locked(), maxAmount);
+		if (maxAmount == 0)
+			maxMoves = 0;
+	}
+
 	maxMoves = min(maxMoves, (size_t)MaxPendingMoves);
 	maxMoves = min(maxMoves, m_unusedChunks.size());    // Assume that each move requires a split
 	maxAmount >>= m_logMinAlignment;
 
+	const int64 startTicks = CryGetTicks();
+
 	PendingMove* moves[MaxPendingMoves];
 	size_t numMoves = 0;
 	size_t curAmount = 0;
@@ -605,12 +622,30 @@ size_t CDefragAllocator::DefragmentTick(size_t maxMoves, size_t maxAmount, bool
 #endif
 	}
 
+	if (!bForce && m_policy.pDefragPolicy)
+		CDefragScheduler::GetInstance().EndTick(this, curAmount << m_logMinAlignment, CryGetTicks() - startTicks);
+
 	if (m_isThreadSafe)
 		m_lock.Unlock();
 
 	return curAmount;
 }
 
+size_t CDefragAllocator::Defrag_GetFragmentedSize_Locked() const
+{
+	// The largest free block is in the highest non empty bucket
+	const SDefragAllocChunk* pChunks = &m_chunks[0];
+	uint32 largestFreeSize = 0;
+	for (int bucketIdx = NumBuckets - 1; bucketIdx >= 0 && !largestFreeSize; --bucketIdx)
+	{
+		Index rootIdx = m_freeBuckets[bucketIdx];
+		for (Index idx = pChunks[rootIdx].freeNextIdx; idx != rootIdx; idx = pChunks[idx].freeNextIdx)
+			largestFreeSize = max(largestFreeSize, pChunks[idx].attr.GetSize());
+	}
+
+	return (size_t)(m_available - min(m_available, largestFreeSize)) << m_logMinAlignment;
+}
+
 CDefragAllocator::Index CDefragAllocator::AllocateChunk()
 {
 	Index result = InvalidChunkIdx;
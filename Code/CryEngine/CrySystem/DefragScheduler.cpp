@@ -0,0 +1,178 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include <StdAfx.h>
+#include "DefragScheduler.h"
+
+int CDefragScheduler::s_sys_defrag_budget = 4096;
+float CDefragScheduler::s_sys_defrag_budget_ms = 1.0f;
+
+//////////////////////////////////////////////////////////////////////////
+CDefragScheduler::CDefragScheduler()
+	: m_nFrameId(0)
+	, m_nFrameTicks(0)
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+CDefragScheduler& CDefragScheduler::GetInstance()
+{
+	static CDefragScheduler instance;
+	return instance;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CDefragScheduler::RegisterCVars()
+{
+	REGISTER_CVAR2("sys_defrag_budget", &s_sys_defrag_budget, s_sys_defrag_budget, VF_NULL,
+	               "KB all defragmenting heaps together may move per frame, shared by fragmentation. 0 = no limit");
+	REGISTER_CVAR2("sys_defrag_budget_ms", &s_sys_defrag_budget_ms, s_sys_defrag_budget_ms, VF_NULL,
+	               "Milliseconds all defragmenting heaps together may spend scheduling moves per frame. 0 = no limit");
+	REGISTER_COMMAND("sys_defrag_dump", DumpCmd, VF_NULL, "Logs fragmentation, quota and moved bytes of the defragmenting heaps");
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CDefragScheduler::Register(IDefragAllocator* pAllocator, const char* szName)
+{
+	CryAutoLock<CryCriticalSectionNonRecursive> lock(m_lock);
+	if (FindHeap_Locked(pAllocator))
+		return;
+
+	SHeap heap;
+	ZeroStruct(heap);
+	heap.pAllocator = pAllocator;
+	heap.szName = (szName && szName[0]) ? szName : "unnamed";
+	m_heaps.push_back(heap);
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CDefragScheduler::Unregister(IDefragAllocator* pAllocator)
+{
+	CryAutoLock<CryCriticalSectionNonRecursive> lock(m_lock);
+	for (size_t i = 0; i < m_heaps.size(); ++i)
+	{
+		if (m_heaps[i].pAllocator == pAllocator)
+		{
+			m_heaps[i] = m_heaps.back();
+			m_heaps.pop_back();
+			break;
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+size_t CDefragScheduler::BeginTick(IDefragAllocator* pAllocator, size_t nCapacity, size_t nFragmentedSize, size_t maxAmount)
+{
+	CryAutoLock<CryCriticalSectionNonRecursive> lock(m_lock);
+
+	const uint32 nFrameId = gEnv ? gEnv->nMainFrameID : 0;
+	if (nFrameId != m_nFrameId)
+		BeginFrame_Locked(nFrameId);
+
+	SHeap* pHeap = FindHeap_Locked(pAllocator);
+	if (!pHeap)
+		return maxAmount;
+
+	pHeap->nCapacity = nCapacity;
+	pHeap->nFragmentedSize = nFragmentedSize;
+
+	// A heap without known fragmentation at the start of the frame (just registered, or not fragmented
+	// at its last tick) got no quota, it gets its share of the budget from what it reports now instead.
+	// Together with the quotas already handed out this can go over the budget once, by at most this share.
+	if (!pHeap->nQuota && !pHeap->nMovedThisFrame && nFragmentedSize)
+		pHeap->nQuota = GetQuota_Locked(*pHeap);
+
+	if (s_sys_defrag_budget_ms > 0.0f && m_nFrameTicks > 0 && gEnv && gEnv->pTimer)
+	{
+		if (gEnv->pTimer->TicksToSeconds(m_nFrameTicks) * 1000.0f >= s_sys_defrag_budget_ms)
+			return 0;
+	}
+
+	if (s_sys_defrag_budget <= 0)
+		return maxAmount;
+
+	const size_t nLeft = pHeap->nQuota > pHeap->nMovedThisFrame ? pHeap->nQuota - pHeap->nMovedThisFrame : 0;
+	return min(maxAmount, nLeft);
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CDefragScheduler::EndTick(IDefragAllocator* pAllocator, size_t nMovedSize, int64 nTicks)
+{
+	CryAutoLock<CryCriticalSectionNonRecursive> lock(m_lock);
+
+	m_nFrameTicks += nTicks;
+	if (SHeap* pHeap = FindHeap_Locked(pAllocator))
+	{
+		pHeap->nMovedThisFrame += nMovedSize;
+		pHeap->nMovedSinceStats += nMovedSize;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CDefragScheduler::BeginFrame_Locked(uint32 nFrameId)
+{
+	m_nFrameId = nFrameId;
+	m_nFrameTicks = 0;
+
+	// Fragmentation is as reported by the heap's last tick
+	for (SHeap& heap : m_heaps)
+	{
+		heap.nQuota = GetQuota_Locked(heap);
+		heap.nMovedThisFrame = 0;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+size_t CDefragScheduler::GetQuota_Locked(const SHeap& heap) const
+{
+	uint64 nTotalFragmented = 0;
+	for (const SHeap& other : m_heaps)
+		nTotalFragmented += other.nFragmentedSize;
+
+	const uint64 nBudget = (uint64)max(s_sys_defrag_budget, 0) * 1024;
+	return nTotalFragmented ? (size_t)(nBudget * heap.nFragmentedSize / nTotalFragmented) : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+CDefragScheduler::SHeap* CDefragScheduler::FindHeap_Locked(IDefragAllocator* pAllocator)
+{
+	for (SHeap& heap : m_heaps)
+	{
+		if (heap.pAllocator == pAllocator)
+			return &heap;
+	}
+	return NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CDefragScheduler::GetStats(std::vector<SHeapStats>& stats)
+{
+	CryAutoLock<CryCriticalSectionNonRecursive> lock(m_lock);
+
+	stats.resize(m_heaps.size());
+	for (size_t i = 0; i < m_heaps.size(); ++i)
+	{
+		SHeap& heap = m_heaps[i];
+		stats[i].szName = heap.szName;
+		stats[i].nCapacity = heap.nCapacity;
+		stats[i].nFragmentedSize = heap.nFragmentedSize;
+		stats[i].nQuota = heap.nQuota;
+		stats[i].nMovedSize = heap.nMovedSinceStats;
+		heap.nMovedSinceStats = 0;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CDefragScheduler::DumpCmd(IConsoleCmdArgs* pArgs)
+{
+	CDefragScheduler& scheduler = GetInstance();
+	CryAutoLock<CryCriticalSectionNonRecursive> lock(scheduler.m_lock);
+
+	CryLogAlways("Defragmenting heaps (%u, budget %d KB / %.2f ms per frame):", (uint32)scheduler.m_heaps.size(), s_sys_defrag_budget, s_sys_defrag_budget_ms);
+	for (const SHeap& heap : scheduler.m_heaps)
+	{
+		CryLogAlways("  %-24s capacity %7" PRISIZE_T " KB, fragmented %7" PRISIZE_T " KB (%5.1f%%), quota %6" PRISIZE_T " KB, moved this frame %6" PRISIZE_T " KB",
+		             heap.szName, heap.nCapacity / 1024, heap.nFragmentedSize / 1024,
+		             heap.nCapacity ? 100.0f * (float)heap.nFragmentedSize / (float)heap.nCapacity : 0.0f,
+		             heap.nQuota / 1024, heap.nMovedThisFrame / 1024);
+	}
+}
@@ -0,0 +1,65 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#pragma once
+
+class IDefragAllocator;
+
+//////////////////////////////////////////////////////////////////////////
+// Shares a per frame defragmentation budget (sys_defrag_budget, sys_defrag_budget_ms) between all
+// defrag allocators with a defrag policy, so that they don't all move blocks in the same frame.
+// Every heap gets a byte quota each frame proportional to its fragmentation, CDefragAllocator::DefragmentTick
+// clamps its move amount to what is left of it. The copies themselves are still issued by the heap's
+// IDefragAllocatorPolicy (cryAsyncMemcpy jobs for CPU heaps, GPU copies for the buffer/texture pools).
+//////////////////////////////////////////////////////////////////////////
+class CDefragScheduler
+{
+public:
+	struct SHeapStats
+	{
+		const char* szName;
+		size_t      nCapacity;
+		size_t      nFragmentedSize; // free memory outside of the largest free block
+		size_t      nQuota;          // bytes the heap may move in the current frame
+		size_t      nMovedSize;      // bytes scheduled for moving since the previous GetStats call
+	};
+
+	static CDefragScheduler& GetInstance();
+	static void              RegisterCVars();
+
+	void                     Register(IDefragAllocator* pAllocator, const char* szName);
+	void                     Unregister(IDefragAllocator* pAllocator);
+
+	// Updates the heap's fragmentation, returns maxAmount clamped to the remaining quota of the heap.
+	size_t BeginTick(IDefragAllocator* pAllocator, size_t nCapacity, size_t nFragmentedSize, size_t maxAmount);
+	void   EndTick(IDefragAllocator* pAllocator, size_t nMovedSize, int64 nTicks);
+
+	void   GetStats(std::vector<SHeapStats>& stats);
+
+private:
+	struct SHeap
+	{
+		IDefragAllocator* pAllocator;
+		const char*       szName;
+		size_t            nCapacity;
+		size_t            nFragmentedSize;
+		size_t            nQuota;
+		size_t            nMovedThisFrame;
+		size_t            nMovedSinceStats;
+	};
+
+	CDefragScheduler();
+
+	void   BeginFrame_Locked(uint32 nFrameId);
+	size_t GetQuota_Locked(const SHeap& heap) const;
+	SHeap* FindHeap_Locked(IDefragAllocator* pAllocator);
+
+	static void DumpCmd(IConsoleCmdArgs* pArgs);
+
+	CryCriticalSectionNonRecursive m_lock;
+	std::vector<SHeap>             m_heaps;
+	uint32                         m_nFrameId;
+	int64                          m_nFrameTicks;
+
+	static int                     s_sys_defrag_budget;
+	static float                   s_sys_defrag_budget_ms;
+};
@@ -85,6 +85,8 @@ bool CDiskProfiler::RegisterStatistics(SDiskProfileStatistics* pStatistics)
 		else if (pStatistics->m_nIOType == edotOpen)
 		{
 			m_outStatistics.m_nFileOpenCount++;
+			if (!pStatistics->m_strFile.empty() && (int)m_fileOpenTrace.size() < profile_disk_max_items)
+				m_fileOpenTrace.push_back(pStatistics->m_strFile);
 		}
 		else if (pStatistics->m_nIOType == edotRead)
 		{
@@ -294,6 +296,8 @@ void CDiskProfiler::Update()
 
 	if (profile_disk > 0)
 	{
+		if (!m_bEnabled)
+			m_fileOpenTrace.clear();
 		m_bEnabled = true;
 
 		if (profile_disk > 1)
@@ -360,6 +364,12 @@ bool CDiskProfiler::IsEnabled() const
 	return m_bEnabled && (int)m_statistics.size() < profile_disk_max_items;
 }
 
+void CDiskProfiler::GetFileOpenTrace(std::vector<string>& trace)
+{
+	CryAutoCriticalSection lock(m_csLock);
+	trace = m_fileOpenTrace;
+}
+
 void CDiskProfiler::SetTaskType(const threadID nThreadId, const uint32 nType /*= eStreamTaskTypeCount*/)
 {
 	CryAutoCriticalSection lock(m_csLock);
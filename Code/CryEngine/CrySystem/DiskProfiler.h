@@ -38,6 +38,9 @@ public:
 
 	virtual bool IsEnabled() const;
 
+	// names of the files opened since the profiler was enabled, to replay the file lookups (sys_PakBenchmarkFileIndex)
+	void GetFileOpenTrace(std::vector<string>& trace);
+
 protected:
 	// rendering routine
 	void RenderBlock(const float timeStart, const float timeEnd, const ColorB threadColor, const ColorB IOTypeColor);
@@ -50,6 +53,7 @@ protected:
 	volatile bool m_bEnabled;
 	CryCriticalSection m_csLock;  // MT-safe profiling
 	Statistics m_statistics;	  // main statistics collector
+	std::vector<string> m_fileOpenTrace;
 	ThreadColorMap m_threadsColorLegend;
 	ThreadTaskTypeMap m_currentThreadTaskType;
 	ISystem* m_pSystem;
@@ -3,6 +3,7 @@
 #include "StdAfx.h"
 #include "DownloadManager.h"
 #include "HTTPDownloader.h"
+#include "System.h"
 
 #if CRY_PLATFORM_WINDOWS
 
@@ -49,6 +50,30 @@ void CDownloadManager::RemoveDownload(CHTTPDownloader* pDownload)
 //-------------------------------------------------------------------------------------------------
 void CDownloadManager::Update()
 {
+	// downloads are started in the order they were queued, bounded by sys_download_max_active
+	int nActive = 0;
+	for (CHTTPDownloader* pDL : m_lDownloadList)
+	{
+		if (!pDL->IsQueued() && pDL->GetState() == HTTP_STATE_WORKING)
+		{
+			++nActive;
+		}
+	}
+
+	for (CHTTPDownloader* pDL : m_lDownloadList)
+	{
+		if (nActive >= max(g_cvars.sys_download_max_active, 1))
+		{
+			break;
+		}
+
+		if (pDL->IsQueued())
+		{
+			pDL->Start();
+			++nActive;
+		}
+	}
+
 	std::list<CHTTPDownloader*>::iterator it = m_lDownloadList.begin();
 
 	while (it != m_lDownloadList.end())
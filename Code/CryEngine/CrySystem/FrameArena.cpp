@@ -0,0 +1,235 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include <StdAfx.h>
+#include "FrameArena.h"
+#include <CryThreading/IThreadManager.h>
+
+int CFrameArenaManager::s_sys_FrameArenaSize = 1024;
+
+#if CRY_FRAME_ARENA
+static THREADLOCAL CFrameArena* s_pThreadArena = nullptr;
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+CFrameArena::CFrameArena(size_t capacity, const volatile int* pFrameId, const char* szThreadName)
+	: m_currentBuffer(0)
+	, m_capacity(capacity)
+	, m_peakUsed(0)
+	, m_numOverflows(0)
+	, m_overflowBytes(0)
+	, m_threadName(szThreadName ? szThreadName : "")
+{
+	for (SBuffer& buffer : m_buffers)
+	{
+		buffer.pBase = static_cast<uint8*>(CryModuleMemalign(capacity, 128));
+		buffer.pOverflow = nullptr;
+		buffer.overflowBytes = 0;
+	}
+
+	m_pFrameId = pFrameId;
+	m_frameId = *pFrameId;
+	m_pCursor = m_buffers[0].pBase;
+	m_pEnd = m_buffers[0].pBase + capacity;
+}
+
+//////////////////////////////////////////////////////////////////////////
+CFrameArena::~CFrameArena()
+{
+	for (SBuffer& buffer : m_buffers)
+	{
+		ResetBuffer(buffer);
+		CryModuleMemalignFree(buffer.pBase);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CFrameArena::GetStats(SFrameArenaStats& stats) const
+{
+	// read from other threads, the values are only approximate
+	stats.numArenas = 1;
+	stats.capacity = m_capacity;
+	stats.used = (size_t)(m_pCursor - m_buffers[m_currentBuffer].pBase);
+	stats.peakUsed = m_peakUsed;
+	stats.numOverflows = m_numOverflows;
+	stats.overflowBytes = m_overflowBytes;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CFrameArena::BeginFrame()
+{
+	const int frameId = *m_pFrameId;
+	const int numFramesPassed = frameId - m_frameId;
+	m_frameId = frameId;
+
+	SBuffer& lastBuffer = m_buffers[m_currentBuffer];
+	m_peakUsed = max(m_peakUsed, (size_t)(m_pCursor - lastBuffer.pBase) + lastBuffer.overflowBytes);
+
+	// the other buffer was used two or more frames ago
+	m_currentBuffer ^= 1;
+	ResetBuffer(m_buffers[m_currentBuffer]);
+	if (numFramesPassed >= 2)
+		ResetBuffer(lastBuffer);
+
+	m_pCursor = m_buffers[m_currentBuffer].pBase;
+	m_pEnd = m_pCursor + m_capacity;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void* CFrameArena::AllocateOverflow(size_t size, size_t alignment)
+{
+	// the block header is padded to keep the alignment of the returned memory
+	alignment = max(alignment, (size_t)16);
+	const size_t headerSize = (sizeof(SOverflowBlock) + alignment - 1) & ~(alignment - 1);
+	SOverflowBlock* pBlock = static_cast<SOverflowBlock*>(CryModuleMemalign(headerSize + size, alignment));
+
+	SBuffer& buffer = m_buffers[m_currentBuffer];
+	pBlock->pNext = buffer.pOverflow;
+	buffer.pOverflow = pBlock;
+	buffer.overflowBytes += size;
+
+	++m_numOverflows;
+	m_overflowBytes += size;
+	return (uint8*)pBlock + headerSize;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CFrameArena::ResetBuffer(SBuffer& buffer)
+{
+	while (SOverflowBlock* pBlock = buffer.pOverflow)
+	{
+		buffer.pOverflow = pBlock->pNext;
+		CryModuleMemalignFree(pBlock);
+	}
+	buffer.overflowBytes = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+CFrameArenaManager& CFrameArenaManager::GetInstance()
+{
+	static CFrameArenaManager instance;
+	return instance;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CFrameArenaManager::RegisterCVars()
+{
+	REGISTER_CVAR2("sys_frame_arena_size", &s_sys_FrameArenaSize, s_sys_FrameArenaSize, VF_REQUIRE_APP_RESTART,
+	               "Size in KB of each of the two per thread frame arena buffers, allocations which don't fit go to the heap");
+	REGISTER_COMMAND("sys_frame_arena_dump", DumpCmd, VF_NULL, "Logs usage and overflow statistics of the per thread frame arenas");
+}
+
+//////////////////////////////////////////////////////////////////////////
+CFrameArenaManager::~CFrameArenaManager()
+{
+	for (CFrameArena* pArena : m_arenas)
+		delete pArena;
+	for (SReleasedArena& released : m_releasedArenas)
+		delete released.pArena;
+}
+
+//////////////////////////////////////////////////////////////////////////
+IFrameArena* CFrameArenaManager::GetThreadArena()
+{
+#if CRY_FRAME_ARENA
+	IF_UNLIKELY (!s_pThreadArena)
+	{
+		const char* szThreadName = gEnv && gEnv->pThreadManager ? gEnv->pThreadManager->GetThreadName(CryGetCurrentThreadId()) : "";
+		s_pThreadArena = new CFrameArena((size_t)max(s_sys_FrameArenaSize, 1) * 1024, &m_frameId, szThreadName);
+
+		CryAutoLock<CryCriticalSectionNonRecursive> lock(m_lock);
+		m_arenas.push_back(s_pThreadArena);
+	}
+	return s_pThreadArena;
+#else
+	return nullptr;
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CFrameArenaManager::ReleaseThreadArena()
+{
+#if CRY_FRAME_ARENA
+	CFrameArena* pArena = s_pThreadArena;
+	if (!pArena)
+		return;
+	s_pThreadArena = nullptr;
+
+	SFrameArenaStats arenaStats;
+	pArena->GetStats(arenaStats);
+
+	CryAutoLock<CryCriticalSectionNonRecursive> lock(m_lock);
+	stl::find_and_erase(m_arenas, pArena);
+	m_releasedOverflows += arenaStats.numOverflows;
+	m_releasedOverflowBytes += arenaStats.overflowBytes;
+
+	SReleasedArena released = { pArena, m_frameId };
+	m_releasedArenas.push_back(released);
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CFrameArenaManager::Advance()
+{
+	const int frameId = CryInterlockedIncrement(&m_frameId);
+
+	// allocations stay valid for their frame and the next one, after that nobody can use the memory of an exited thread
+	CryAutoLock<CryCriticalSectionNonRecursive> lock(m_lock);
+	for (size_t i = 0; i < m_releasedArenas.size(); )
+	{
+		if (frameId - m_releasedArenas[i].frameId >= 2)
+		{
+			delete m_releasedArenas[i].pArena;
+			m_releasedArenas[i] = m_releasedArenas.back();
+			m_releasedArenas.pop_back();
+		}
+		else
+		{
+			++i;
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+uint32 CFrameArenaManager::GetNumReleasedArenas()
+{
+	CryAutoLock<CryCriticalSectionNonRecursive> lock(m_lock);
+	return (uint32)m_releasedArenas.size();
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CFrameArenaManager::GetStats(SFrameArenaStats& stats)
+{
+	ZeroStruct(stats);
+
+	CryAutoLock<CryCriticalSectionNonRecursive> lock(m_lock);
+	stats.numOverflows = m_releasedOverflows;
+	stats.overflowBytes = m_releasedOverflowBytes;
+	for (const CFrameArena* pArena : m_arenas)
+	{
+		SFrameArenaStats arenaStats;
+		pArena->GetStats(arenaStats);
+		stats.numArenas += arenaStats.numArenas;
+		stats.capacity += arenaStats.capacity;
+		stats.used += arenaStats.used;
+		stats.peakUsed = max(stats.peakUsed, arenaStats.peakUsed);
+		stats.numOverflows += arenaStats.numOverflows;
+		stats.overflowBytes += arenaStats.overflowBytes;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CFrameArenaManager::DumpCmd(IConsoleCmdArgs* pArgs)
+{
+	CFrameArenaManager& manager = GetInstance();
+	CryAutoLock<CryCriticalSectionNonRecursive> lock(manager.m_lock);
+
+	CryLogAlways("Frame arenas (%u threads, %d KB per buffer):", (uint32)manager.m_arenas.size(), s_sys_FrameArenaSize);
+	for (const CFrameArena* pArena : manager.m_arenas)
+	{
+		SFrameArenaStats stats;
+		pArena->GetStats(stats);
+		CryLogAlways("  %-32s used %7" PRISIZE_T " KB, peak %7" PRISIZE_T " KB, overflows %6u (%" PRISIZE_T " KB)%s",
+		             pArena->GetThreadName(), stats.used / 1024, stats.peakUsed / 1024, stats.numOverflows, stats.overflowBytes / 1024,
+		             stats.peakUsed > stats.capacity ? " - increase sys_frame_arena_size" : "");
+	}
+}
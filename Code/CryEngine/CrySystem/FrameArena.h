@@ -0,0 +1,87 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#pragma once
+
+#include <CryMemory/FrameArena.h>
+
+//////////////////////////////////////////////////////////////////////////
+class CFrameArena final : public IFrameArena
+{
+public:
+	CFrameArena(size_t capacity, const volatile int* pFrameId, const char* szThreadName);
+	virtual ~CFrameArena();
+
+	//////////////////////////////////////////////////////////////////////////
+	// IFrameArena implementation
+	virtual void        GetStats(SFrameArenaStats& stats) const override;
+	virtual const char* GetThreadName() const override { return m_threadName.c_str(); }
+	//////////////////////////////////////////////////////////////////////////
+
+protected:
+	virtual void  BeginFrame() override;
+	virtual void* AllocateOverflow(size_t size, size_t alignment) override;
+
+private:
+	struct SOverflowBlock
+	{
+		SOverflowBlock* pNext;
+	};
+
+	struct SBuffer
+	{
+		uint8*          pBase;
+		SOverflowBlock* pOverflow;     // heap blocks released together with the buffer
+		size_t          overflowBytes; // overflow of the frame using this buffer
+	};
+
+	void ResetBuffer(SBuffer& buffer);
+
+	SBuffer      m_buffers[2];
+	uint32       m_currentBuffer;
+	const size_t m_capacity;
+	size_t       m_peakUsed;
+	uint32       m_numOverflows;
+	size_t       m_overflowBytes;
+	string       m_threadName;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Owns the frame arenas of all threads, accessed through CCryMemoryManager
+class CFrameArenaManager
+{
+public:
+	static CFrameArenaManager& GetInstance();
+	static void                RegisterCVars();
+
+	~CFrameArenaManager();
+
+	IFrameArena* GetThreadArena();
+	// Called by threads spawned through the thread manager when they exit, the arena is freed two frames later
+	void         ReleaseThreadArena();
+	void         Advance();
+	void         GetStats(SFrameArenaStats& stats);
+
+	uint32       GetNumReleasedArenas();
+
+private:
+	CFrameArenaManager() : m_frameId(0), m_releasedOverflows(0), m_releasedOverflowBytes(0) {}
+
+	static void DumpCmd(IConsoleCmdArgs* pArgs);
+
+	struct SReleasedArena
+	{
+		CFrameArena* pArena;
+		int          frameId;
+	};
+
+	CryCriticalSectionNonRecursive m_lock;
+	std::vector<CFrameArena*>      m_arenas;
+	std::vector<SReleasedArena>    m_releasedArenas; // exited threads, memory may still be read until two frames passed
+	volatile int                   m_frameId;
+
+	// overflow statistics of released arenas, so the totals keep counting since startup
+	uint32                         m_releasedOverflows;
+	size_t                         m_releasedOverflowBytes;
+
+	static int                     s_sys_FrameArenaSize;
+};
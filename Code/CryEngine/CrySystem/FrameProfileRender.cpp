@@ -1349,6 +1349,29 @@ void CFrameProfileSystem::DrawGraph()
 	DrawTextLabel(m_pRenderer, x, y, labelColDarkGreen, FrameProfileRenderConstants::c_fontScale, "Worker Utilization:");
 	x += 5;   // Indent
 	DrawTextLabel(m_pRenderer, x, y, labelColor, FrameProfileRenderConstants::c_fontScale, "Sample Time: %4.2fms:", cSamplePeriode * 0.001f);
+
+	// Per cache cluster/NUMA node utilization, only shown if the workers are placed on more than one
+	uint32 nNumClusters = 0;
+	for (uint32 i = 0; i < cNumWorkers; ++i)
+		nNumClusters = max(nNumClusters, (uint32)rWorkerStatsInput.workerStats[i].nClusterId + 1);
+	if (nNumClusters > 1)
+	{
+		for (uint32 nCluster = 0; nCluster < nNumClusters; ++nCluster)
+		{
+			float nClusterUtil = 0.f;
+			uint32 nClusterWorkers = 0, nClusterJobs = 0;
+			for (uint32 i = 0; i < cNumWorkers; ++i)
+			{
+				if (rWorkerStatsInput.workerStats[i].nClusterId != nCluster)
+					continue;
+				nClusterUtil += rWorkerStatsInput.workerStats[i].nUtilPerc;
+				nClusterJobs += rWorkerStatsInput.workerStats[i].nNumJobsExecuted;
+				++nClusterWorkers;
+			}
+			if (nClusterWorkers)
+				DrawTextLabel(m_pRenderer, x, y, labelColor, FrameProfileRenderConstants::c_fontScale, "Cluster %u: %u Workers, Workload: %05.2f%%, Jobs: %04u", nCluster, nClusterWorkers, nClusterUtil / (float)nClusterWorkers, nClusterJobs);
+		}
+	}
 	x -= 5;
 
 	y += FrameProfileRenderConstants::c_yStepSizeText;   // Gap
@@ -1372,7 +1395,10 @@ void CFrameProfileSystem::DrawGraph()
 		float* pInfoLabelCol = labelColor;
 
 		//Draw worker summary control
-		DrawTextLabel(m_pRenderer, x, y, labelColor, FrameProfileRenderConstants::c_fontScale, "Worker %d:", i);
+		if (nNumClusters > 1)
+			DrawTextLabel(m_pRenderer, x, y, labelColor, FrameProfileRenderConstants::c_fontScale, "Worker %d (Cluster %d):", i, rWorkerStatsInput.workerStats[i].nClusterId);
+		else
+			DrawTextLabel(m_pRenderer, x, y, labelColor, FrameProfileRenderConstants::c_fontScale, "Worker %d:", i);
 
 		x += 5;  // Indent
 		DrawTextLabel(m_pRenderer, x, y, pInfoLabelCol, FrameProfileRenderConstants::c_fontScale, "Work Time: %05.2fms, Idle Time: %05.2fms", nExecutionPeriodMs, nIdleTime);
@@ -3,12 +3,35 @@
 #include "StdAfx.h"
 #include "HTTPDownloader.h"
 #include "DownloadManager.h"
+#include "System.h"
 
 #include <CrySystem/ILog.h>
 #include <CrySystem/ISystem.h>
+#include <CrySystem/File/ICryPak.h>
 
 #if CRY_PLATFORM_WINDOWS
 
+namespace
+{
+bool WriteAt(HANDLE hFile, int64 offset, const void* pData, DWORD size)
+{
+	OVERLAPPED ov = { 0 };
+	ov.Offset = (DWORD)(offset & 0xFFFFFFFF);
+	ov.OffsetHigh = (DWORD)(offset >> 32);
+	DWORD dwWritten = 0;
+	return WriteFile(hFile, pData, size, &dwWritten, &ov) && dwWritten == size;
+}
+
+bool ReadAt(HANDLE hFile, int64 offset, void* pData, DWORD size)
+{
+	OVERLAPPED ov = { 0 };
+	ov.Offset = (DWORD)(offset & 0xFFFFFFFF);
+	ov.OffsetHigh = (DWORD)(offset >> 32);
+	DWORD dwRead = 0;
+	return ReadFile(hFile, pData, size, &dwRead, &ov) && dwRead == size;
+}
+}
+
 //-------------------------------------------------------------------------------------------------
 CHTTPDownloader::CHTTPDownloader()
 	: m_hThread(0),
@@ -18,10 +41,24 @@ CHTTPDownloader::CHTTPDownloader()
 	m_pBuffer(0),
 	m_iState(HTTP_STATE_NONE),
 	m_bContinue(false),
+	m_bQueued(false),
+	m_hFile(INVALID_HANDLE_VALUE),
+	m_nTotalSize(0),
+	m_nChunkSize(0),
+	m_nChunkCount(0),
+	m_nHashedChunks(0),
+	m_nNextChunk(0),
+	m_bChunkFailed(false),
+	m_nBytesReceived(0),
+	m_nStartTime(0),
+	m_nEndTime(0),
+	m_bCheckMD5(false),
 	m_pSystem(0),
 	m_pParent(0)
 {
 	m_pScriptSystem = NULL;
+	memset(m_expectedMD5, 0, sizeof(m_expectedMD5));
+	memset(m_md5, 0, sizeof(m_md5));
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -57,19 +94,62 @@ int CHTTPDownloader::Create(ISystem* pISystem, CDownloadManager* pParent)
 //-------------------------------------------------------------------------------------------------
 int CHTTPDownloader::Download(const char* szURL, const char* szDestination)
 {
+	// resolve aliases such as %USER%, so patches can be written straight into a pak staging folder
+	char szAdjusted[ICryPak::g_nMaxPath];
+	gEnv->pCryPak->AdjustFileName(szDestination, szAdjusted, ICryPak::FLAGS_FOR_WRITING);
+
 	m_szURL = szURL;
-	m_szDstFile = szDestination;
+	m_szDstFile = szAdjusted;
 	m_bContinue = 1;
-
-	CreateDownloadThread();
+	m_bQueued = true;
 
 	return 1;
 }
 
+//-------------------------------------------------------------------------------------------------
+void CHTTPDownloader::SetExpectedMD5(const char* szHexDigest)
+{
+	m_bCheckMD5 = szHexDigest && strlen(szHexDigest) == 32;
+	for (int i = 0; m_bCheckMD5 && i < 16; ++i)
+	{
+		unsigned int value = 0;
+		m_bCheckMD5 = sscanf(szHexDigest + i * 2, "%2x", &value) == 1;
+		m_expectedMD5[i] = (uint8)value;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+void CHTTPDownloader::Start()
+{
+	m_bQueued = false;
+	m_iState = HTTP_STATE_WORKING;
+
+	CreateDownloadThread();
+}
+
 //-------------------------------------------------------------------------------------------------
 void CHTTPDownloader::Cancel()
 {
 	m_bContinue = 0;
+	m_bQueued = false;
+
+	if (m_iState == HTTP_STATE_NONE)
+	{
+		m_iState = HTTP_STATE_CANCELED;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+float CHTTPDownloader::GetBytesPerSecond() const
+{
+	if (!m_nStartTime)
+	{
+		return 0.0f;
+	}
+
+	const uint64 nEndTime = m_nEndTime ? m_nEndTime : GetTickCount64();
+	const uint64 nElapsedMs = max(nEndTime - m_nStartTime, (uint64)1);
+	return (float)m_nBytesReceived * 1000.0f / (float)nElapsedMs;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -88,10 +168,19 @@ void CHTTPDownloader::CreateDownloadThread()
 	m_hThread = ::CreateThread(0, 0, (LPTHREAD_START_ROUTINE)DownloadProc, this, 0, &dwThreadId);
 }
 
+//-------------------------------------------------------------------------------------------------
+DWORD CHTTPDownloader::ConnectionProc(CHTTPDownloader* _this)
+{
+	_this->DownloadChunks();
+
+	return 0;
+}
+
 //-------------------------------------------------------------------------------------------------
 DWORD CHTTPDownloader::DoDownload()
 {
 	m_iState = HTTP_STATE_WORKING;
+	m_nStartTime = GetTickCount64();
 
 	m_hINET = InternetOpen("", INTERNET_OPEN_TYPE_PRECONFIG, 0, 0, 0);
 
@@ -109,21 +198,315 @@ DWORD CHTTPDownloader::DoDownload()
 		return 1;
 	}
 
+	const string partFile = m_szDstFile + ".part";
+	m_szStateFile = partFile + ".state";
+
+	// servers without range support fall back to a single connection without resume
+	m_nTotalSize = QueryRangedSize();
+	m_iState = (m_nTotalSize > 0) ? DownloadRanged(partFile) : DownloadSingleStream(partFile);
+	m_nEndTime = GetTickCount64();
+
+	return 1;
+}
+
+//-------------------------------------------------------------------------------------------------
+int64 CHTTPDownloader::QueryRangedSize()
+{
+	DWORD dwFlags = INTERNET_FLAG_NO_CACHE_WRITE | INTERNET_FLAG_NO_COOKIES | INTERNET_FLAG_NO_UI | INTERNET_FLAG_RELOAD;
+	const char szHeaders[] = "Range: bytes=0-0\r\n";
+	HINTERNET hUrl = InternetOpenUrl(m_hINET, m_szURL.c_str(), szHeaders, (DWORD)-1, dwFlags, 0);
+
+	if (!hUrl)
+	{
+		return -1;
+	}
+
+	int64 nTotalSize = -1;
+	DWORD dwStatus = 0;
+	DWORD dwSize = sizeof(dwStatus);
+	if (HttpQueryInfo(hUrl, HTTP_QUERY_STATUS_CODE | HTTP_QUERY_FLAG_NUMBER, &dwStatus, &dwSize, 0) && dwStatus == 206)
+	{
+		// "bytes 0-0/<total>"
+		char szBuffer[128] = { 0 };
+		dwSize = sizeof(szBuffer) - 1;
+		if (HttpQueryInfo(hUrl, HTTP_QUERY_CONTENT_RANGE, szBuffer, &dwSize, 0))
+		{
+			const char* szTotal = strchr(szBuffer, '/');
+			if (szTotal && szTotal[1] != '*')
+			{
+				nTotalSize = _atoi64(szTotal + 1);
+			}
+		}
+	}
+
+	InternetCloseHandle(hUrl);
+
+	return nTotalSize;
+}
+
+//-------------------------------------------------------------------------------------------------
+int CHTTPDownloader::DownloadRanged(const string& partFile)
+{
+	m_iFileSize = (int)min(m_nTotalSize, (int64)INT_MAX);
+	m_nChunkSize = (int64)max(g_cvars.sys_download_chunk_size, 64) * 1024;
+	m_nChunkCount = (uint32)((m_nTotalSize + m_nChunkSize - 1) / m_nChunkSize);
+	m_chunkDone.reset(new std::atomic<bool>[m_nChunkCount]);
+	for (uint32 i = 0; i < m_nChunkCount; ++i)
+	{
+		m_chunkDone[i] = false;
+	}
+
+	m_hFile = CreateFile(partFile.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, 0, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, 0);
+	if (m_hFile == INVALID_HANDLE_VALUE)
+	{
+		return HTTP_STATE_ERROR;
+	}
+
+	LARGE_INTEGER fileSize;
+	if (GetFileSizeEx(m_hFile, &fileSize) && fileSize.QuadPart == m_nTotalSize)
+	{
+		LoadResumeState();
+	}
+	else
+	{
+		LARGE_INTEGER size;
+		size.QuadPart = m_nTotalSize;
+		SetFilePointerEx(m_hFile, size, 0, FILE_BEGIN);
+		SetEndOfFile(m_hFile);
+	}
+
+	PrepareBuffer();
+
+	m_nNextChunk = 0;
+	m_bChunkFailed = false;
+	m_nHashedChunks = 0;
+
+	const int nConnections = clamp_tpl(g_cvars.sys_download_connections, 1, HTTP_MAX_CONNECTIONS);
+	HANDLE hConnections[HTTP_MAX_CONNECTIONS];
+	int nStarted = 0;
+	for (int i = 0; i < nConnections && i < (int)m_nChunkCount; ++i)
+	{
+		DWORD dwThreadId = 0;
+		hConnections[nStarted] = ::CreateThread(0, 0, (LPTHREAD_START_ROUTINE)ConnectionProc, this, 0, &dwThreadId);
+		if (hConnections[nStarted])
+		{
+			++nStarted;
+		}
+	}
+
+	// hash finished chunks in file order while the connections are still receiving later ones
+	SMD5Context context;
+	m_pSystem->GetIZLibCompressor()->MD5Init(&context);
+
+	uint64 nLastSaveTime = GetTickCount64();
+	while (WaitForMultipleObjects(nStarted, hConnections, TRUE, 10) == WAIT_TIMEOUT)
+	{
+		HashAvailableChunks(context);
+
+		if (GetTickCount64() - nLastSaveTime > 1000)
+		{
+			SaveResumeState();
+			nLastSaveTime = GetTickCount64();
+		}
+	}
+
+	for (int i = 0; i < nStarted; ++i)
+	{
+		CloseHandle(hConnections[i]);
+	}
+
+	if (!HashAvailableChunks(context) || m_bChunkFailed || !m_bContinue || !nStarted)
+	{
+		// keep the finished chunks for the next attempt
+		SaveResumeState();
+		CloseHandle(m_hFile);
+		m_hFile = INVALID_HANDLE_VALUE;
+
+		return m_bContinue ? HTTP_STATE_ERROR : HTTP_STATE_CANCELED;
+	}
+
+	CloseHandle(m_hFile);
+	m_hFile = INVALID_HANDLE_VALUE;
+	DeleteFile(m_szStateFile.c_str());
+
+	return FinalizeFile(partFile, context) ? HTTP_STATE_COMPLETE : HTTP_STATE_ERROR;
+}
+
+//-------------------------------------------------------------------------------------------------
+void CHTTPDownloader::DownloadChunks()
+{
+	std::unique_ptr<unsigned char[]> pBuffer(new unsigned char[HTTP_BUFFER_SIZE]);
+
+	while (m_bContinue && !m_bChunkFailed)
+	{
+		const uint32 nChunk = m_nNextChunk++;
+		if (nChunk >= m_nChunkCount)
+		{
+			break;
+		}
+
+		if (m_chunkDone[nChunk])
+		{
+			continue;
+		}
+
+		bool bDone = false;
+		for (int nTry = 0; nTry < HTTP_CHUNK_RETRIES && !bDone && m_bContinue; ++nTry)
+		{
+			bDone = DownloadChunk(nChunk, pBuffer.get());
+		}
+
+		if (!bDone)
+		{
+			m_bChunkFailed = true;
+			break;
+		}
+
+		m_chunkDone[nChunk] = true;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+bool CHTTPDownloader::DownloadChunk(uint32 nChunk, unsigned char* pBuffer)
+{
+	const int64 nBegin = nChunk * m_nChunkSize;
+	const int64 nEnd = min(nBegin + m_nChunkSize, m_nTotalSize);
+
+	string headers;
+	headers.Format("Range: bytes=%lld-%lld\r\n", nBegin, nEnd - 1);
+
+	DWORD dwFlags = INTERNET_FLAG_NO_CACHE_WRITE | INTERNET_FLAG_NO_COOKIES | INTERNET_FLAG_NO_UI | INTERNET_FLAG_RELOAD;
+	HINTERNET hUrl = InternetOpenUrl(m_hINET, m_szURL.c_str(), headers.c_str(), (DWORD)-1, dwFlags, 0);
+
+	if (!hUrl)
+	{
+		return false;
+	}
+
+	DWORD dwStatus = 0;
+	DWORD dwSize = sizeof(dwStatus);
+	if (!HttpQueryInfo(hUrl, HTTP_QUERY_STATUS_CODE | HTTP_QUERY_FLAG_NUMBER, &dwStatus, &dwSize, 0) || dwStatus != 206)
+	{
+		InternetCloseHandle(hUrl);
+		return false;
+	}
+
+	int64 nOffset = nBegin;
+	DWORD dwRead = 0;
+	while (m_bContinue && nOffset < nEnd && InternetReadFile(hUrl, pBuffer, (DWORD)min((int64)HTTP_BUFFER_SIZE, nEnd - nOffset), &dwRead) && dwRead)
+	{
+		if (!WriteAt(m_hFile, nOffset, pBuffer, dwRead))
+		{
+			break;
+		}
+
+		nOffset += dwRead;
+		m_nBytesReceived += dwRead;
+	}
+
+	InternetCloseHandle(hUrl);
+
+	return nOffset == nEnd;
+}
+
+//-------------------------------------------------------------------------------------------------
+bool CHTTPDownloader::HashAvailableChunks(SMD5Context& context)
+{
+	IZLibCompressor* pZLib = m_pSystem->GetIZLibCompressor();
+
+	while (m_nHashedChunks < m_nChunkCount && m_chunkDone[m_nHashedChunks])
+	{
+		const int64 nBegin = m_nHashedChunks * m_nChunkSize;
+		const int64 nEnd = min(nBegin + m_nChunkSize, m_nTotalSize);
+
+		for (int64 nOffset = nBegin; nOffset < nEnd; nOffset += HTTP_BUFFER_SIZE)
+		{
+			const DWORD dwSize = (DWORD)min((int64)HTTP_BUFFER_SIZE, nEnd - nOffset);
+			if (!ReadAt(m_hFile, nOffset, m_pBuffer, dwSize))
+			{
+				return false;
+			}
+			pZLib->MD5Update(&context, (const char*)m_pBuffer, dwSize);
+		}
+
+		++m_nHashedChunks;
+	}
+
+	return m_nHashedChunks == m_nChunkCount;
+}
+
+//-------------------------------------------------------------------------------------------------
+void CHTTPDownloader::LoadResumeState()
+{
+	FILE* hState = fopen(m_szStateFile.c_str(), "rb");
+	if (!hState)
+	{
+		return;
+	}
+
+	long long nTotalSize = 0;
+	long long nChunkSize = 0;
+	if (fscanf(hState, "%lld %lld\n", &nTotalSize, &nChunkSize) == 2 && nTotalSize == m_nTotalSize && nChunkSize == m_nChunkSize)
+	{
+		int64 nResumed = 0;
+		for (uint32 i = 0; i < m_nChunkCount; ++i)
+		{
+			const int c = fgetc(hState);
+			if (c == EOF)
+			{
+				break;
+			}
+
+			if (c == '1')
+			{
+				m_chunkDone[i] = true;
+				nResumed += min(m_nChunkSize, m_nTotalSize - i * m_nChunkSize);
+			}
+		}
+
+		m_pSystem->GetILog()->Log("DOWNLOAD RESUMED: %s (%lld of %lld bytes present)", m_szURL.c_str(), nResumed, m_nTotalSize);
+	}
+
+	fclose(hState);
+}
+
+//-------------------------------------------------------------------------------------------------
+void CHTTPDownloader::SaveResumeState() const
+{
+	if (!m_nChunkCount)
+	{
+		return;
+	}
+
+	FILE* hState = fopen(m_szStateFile.c_str(), "wb");
+	if (!hState)
+	{
+		return;
+	}
+
+	fprintf(hState, "%lld %lld\n", (long long)m_nTotalSize, (long long)m_nChunkSize);
+	for (uint32 i = 0; i < m_nChunkCount; ++i)
+	{
+		fputc(m_chunkDone[i] ? '1' : '0', hState);
+	}
+
+	fclose(hState);
+}
+
+//-------------------------------------------------------------------------------------------------
+int CHTTPDownloader::DownloadSingleStream(const string& partFile)
+{
 	DWORD dwFlags = INTERNET_FLAG_NO_CACHE_WRITE | INTERNET_FLAG_NO_COOKIES | INTERNET_FLAG_NO_UI | INTERNET_FLAG_RELOAD;
 	m_hUrl = InternetOpenUrl(m_hINET, m_szURL.c_str(), 0, 0, dwFlags, 0);
 
 	if (!m_hUrl)
 	{
-		m_iState = HTTP_STATE_ERROR;
-
-		return 1;
+		return HTTP_STATE_ERROR;
 	}
 
 	if (!m_bContinue)
 	{
-		m_iState = HTTP_STATE_CANCELED;
-
-		return 1;
+		return HTTP_STATE_CANCELED;
 	}
 
 	char szBuffer[64] = { 0 };
@@ -141,22 +524,21 @@ DWORD CHTTPDownloader::DoDownload()
 
 	if (!m_bContinue)
 	{
-		m_iState = HTTP_STATE_CANCELED;
-
-		return 1;
+		return HTTP_STATE_CANCELED;
 	}
 
 	PrepareBuffer();
 
-	FILE* hFile = fopen(m_szDstFile.c_str(), "wb");
+	FILE* hFile = fopen(partFile.c_str(), "wb");
 
 	if (!hFile)
 	{
-		m_iState = HTTP_STATE_ERROR;
-
-		return 1;
+		return HTTP_STATE_ERROR;
 	}
 
+	SMD5Context context;
+	m_pSystem->GetIZLibCompressor()->MD5Init(&context);
+
 	DWORD dwRead = 0;
 
 	while (InternetReadFile(m_hUrl, m_pBuffer, HTTP_BUFFER_SIZE, &dwRead))
@@ -164,33 +546,42 @@ DWORD CHTTPDownloader::DoDownload()
 		if (dwRead)
 		{
 			fwrite(m_pBuffer, 1, dwRead, hFile);
+			m_pSystem->GetIZLibCompressor()->MD5Update(&context, (const char*)m_pBuffer, dwRead);
+			m_nBytesReceived += dwRead;
 		}
 		else
 		{
 			fclose(hFile);
 
-			m_iState = HTTP_STATE_COMPLETE;
-
-			return 1;
+			return FinalizeFile(partFile, context) ? HTTP_STATE_COMPLETE : HTTP_STATE_ERROR;
 		}
 
 		if (!m_bContinue)
 		{
 			fclose(hFile);
 
-			m_iState = HTTP_STATE_CANCELED;
-
-			return 1;
+			return HTTP_STATE_CANCELED;
 		}
-
-		Sleep(5);
 	}
 
 	fclose(hFile);
 
-	m_iState = HTTP_STATE_ERROR;
+	return HTTP_STATE_ERROR;
+}
 
-	return 1;
+//-------------------------------------------------------------------------------------------------
+bool CHTTPDownloader::FinalizeFile(const string& partFile, SMD5Context& context)
+{
+	m_pSystem->GetIZLibCompressor()->MD5Final(&context, (char*)m_md5);
+
+	if (m_bCheckMD5 && memcmp(m_md5, m_expectedMD5, sizeof(m_md5)) != 0)
+	{
+		m_pSystem->GetILog()->LogError("DOWNLOAD MD5 MISMATCH: %s", m_szURL.c_str());
+		DeleteFile(partFile.c_str());
+		return false;
+	}
+
+	return MoveFileEx(partFile.c_str(), m_szDstFile.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_COPY_ALLOWED) != 0;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -207,15 +598,20 @@ void CHTTPDownloader::Release()
 {
 	m_bContinue = 0;
 
-	if (m_hUrl)
-	{
-		InternetCloseHandle(m_hUrl);
-	}
-
+	// closing the session handle aborts the requests of all connections and closes their handles, m_hUrl included
 	if (m_hINET)
 	{
 		InternetSetStatusCallback(m_hINET, 0);
 		InternetCloseHandle(m_hINET);
+		m_hINET = 0;
+		m_hUrl = 0;
+	}
+
+	if (m_hThread)
+	{
+		WaitForSingleObject(m_hThread, INFINITE);
+		CloseHandle(m_hThread);
+		m_hThread = 0;
 	}
 
 	if (m_pBuffer)
@@ -230,10 +626,6 @@ void CHTTPDownloader::Release()
 	m_szURL.clear();
 	m_szDstFile.clear();
 
-	WaitForSingleObject(m_hThread, 5); // wait five milliseconds for the thread to finish
-	CloseHandle(m_hThread);
-	m_hThread = 0;
-
 	m_pParent->RemoveDownload(this);
 
 	delete this;
@@ -248,7 +640,7 @@ void CHTTPDownloader::OnError()
 
 	HSCRIPTFUNCTION pScriptFunction = 0;
 
-	if (!pScriptObject->GetValue("OnError", pScriptFunction))
+	if (!pScriptObject || !pScriptObject->GetValue("OnError", pScriptFunction))
 	{
 		return;
 	}
@@ -261,13 +653,14 @@ void CHTTPDownloader::OnError()
 //-------------------------------------------------------------------------------------------------
 void CHTTPDownloader::OnComplete()
 {
-	m_pSystem->GetILog()->Log("DOWNLOAD COMPLETE: %s", CHTTPDownloader::GetURL().c_str());
+	m_pSystem->GetILog()->Log("DOWNLOAD COMPLETE: %s (%lld bytes received in %.1fs, %.2f MB/s)", CHTTPDownloader::GetURL().c_str(),
+	                          (long long)m_nBytesReceived, (float)(m_nEndTime - m_nStartTime) / 1000.0f, GetBytesPerSecond() / (1024.0f * 1024.0f));
 
 	IScriptTable* pScriptObject = GetScriptObject();
 
 	HSCRIPTFUNCTION pScriptFunction = 0;
 
-	if (!pScriptObject->GetValue("OnComplete", pScriptFunction))
+	if (!pScriptObject || !pScriptObject->GetValue("OnComplete", pScriptFunction))
 	{
 		return;
 	}
@@ -286,7 +679,7 @@ void CHTTPDownloader::OnCancel()
 
 	HSCRIPTFUNCTION pScriptFunction = 0;
 
-	if (!pScriptObject->GetValue("OnCancel", pScriptFunction))
+	if (!pScriptObject || !pScriptObject->GetValue("OnCancel", pScriptFunction))
 	{
 		return;
 	}
@@ -17,9 +17,12 @@
 	#include <CryCore/Platform/CryWindows.h>
 	#include <wininet.h> // requires <windows.h>
 	#include <CryScriptSystem/IScriptSystem.h>
+	#include <CrySystem/ZLib/IZLibCompressor.h>
 	#include <dbghelp.h>
 
-	#define HTTP_BUFFER_SIZE (16384)
+	#define HTTP_BUFFER_SIZE      (16384)
+	#define HTTP_MAX_CONNECTIONS  (16)
+	#define HTTP_CHUNK_RETRIES    (3)
 
 enum
 {
@@ -32,6 +35,11 @@ enum
 
 class CDownloadManager;
 
+// Downloads a single URL into a file.
+// When the server supports byte ranges the file is split into fixed size chunks that are fetched over
+// several connections and written straight to their offset in "<destination>.part". Finished chunks
+// are recorded in "<destination>.part.state", so a failed or canceled download resumes with the
+// missing chunks only. The MD5 of the file is computed while the remaining chunks are still in flight.
 class CHTTPDownloader // : public _ScriptableEx<CHTTPDownloader>
 {
 public:
@@ -39,12 +47,21 @@ public:
 	virtual ~CHTTPDownloader();
 
 	int           Create(ISystem* pISystem, CDownloadManager* pParent);
+	//! Queues the download, it is started by the download manager once a slot is free (see sys_download_max_active).
 	int           Download(const char* szURL, const char* szDestination);
+	//! Fails the download if the MD5 of the received file does not match the given 32 character hex digest.
+	void          SetExpectedMD5(const char* szHexDigest);
+	void          Start();
 	void          Cancel();
 	int           GetState()             { return m_iState; };
+	bool          IsQueued() const       { return m_bQueued; }
 	int           GetFileSize() const    { return m_iFileSize; };
 	const string& GetURL() const         { return m_szURL; };
 	const string& GetDstFileName() const { return m_szDstFile; };
+	const uint8*  GetMD5() const         { return m_md5; }
+	//! Bytes received over the network by this session, excluding chunks resumed from a previous one.
+	int64         GetBytesReceived() const { return m_nBytesReceived; }
+	float         GetBytesPerSecond() const;
 	void          Release();
 
 	int           Download(IFunctionHandler* pH);
@@ -62,22 +79,52 @@ public:
 private:
 
 	static DWORD  DownloadProc(CHTTPDownloader* _this);
+	static DWORD  ConnectionProc(CHTTPDownloader* _this);
 	void          CreateDownloadThread();
 	DWORD         DoDownload();
+	int           DownloadRanged(const string& partFile);
+	int           DownloadSingleStream(const string& partFile);
+	int64         QueryRangedSize();
+	bool          DownloadChunk(uint32 nChunk, unsigned char* pBuffer);
+	void          DownloadChunks();
+	void          LoadResumeState();
+	void          SaveResumeState() const;
+	bool          HashAvailableChunks(SMD5Context& context);
+	bool          FinalizeFile(const string& partFile, SMD5Context& context);
 	void          PrepareBuffer();
 	IScriptTable* GetScriptObject() { return 0; };
 
 	string            m_szURL;
 	string            m_szDstFile;
+	string            m_szStateFile;
 	HANDLE            m_hThread;
 	HINTERNET         m_hINET;
 	HINTERNET         m_hUrl;
+	HANDLE            m_hFile;
 
 	unsigned char*    m_pBuffer;
 	int               m_iFileSize;
 
 	volatile int      m_iState;
 	volatile bool     m_bContinue;
+	volatile bool     m_bQueued;
+
+	// ranged download state, chunks are handed out to the connection threads in order
+	int64                               m_nTotalSize;
+	int64                               m_nChunkSize;
+	uint32                              m_nChunkCount;
+	uint32                              m_nHashedChunks;
+	std::unique_ptr<std::atomic<bool>[]> m_chunkDone;
+	std::atomic<uint32>                 m_nNextChunk;
+	std::atomic<bool>                   m_bChunkFailed;
+
+	std::atomic<int64>                  m_nBytesReceived;
+	uint64                              m_nStartTime;
+	uint64                              m_nEndTime;
+
+	bool                                m_bCheckMD5;
+	uint8                               m_expectedMD5[16];
+	uint8                               m_md5[16];
 
 	ISystem*          m_pSystem;
 	CDownloadManager* m_pParent;
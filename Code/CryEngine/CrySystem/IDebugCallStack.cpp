@@ -26,7 +26,47 @@ IDebugCallStack::IDebugCallStack() : m_bIsFatalError(false), m_postBackupProcess
 
 }
 
-#if CRY_PLATFORM_LINUX || CRY_PLATFORM_ANDROID || CRY_PLATFORM_APPLE
+#if CRY_PLATFORM_LINUX
+	#include <dlfcn.h>
+	#include <cxxabi.h>
+
+// Resolves addresses through the dynamic linker, so only symbols in the dynamic symbol tables of the loaded modules are found.
+// Used by the sampling profiler.
+class CLinuxDebugCallStack : public IDebugCallStack
+{
+public:
+	virtual string GetModuleNameForAddr(void* addr) override
+	{
+		Dl_info info;
+		if (dladdr(addr, &info) && info.dli_fname)
+			return PathUtil::GetFile(info.dli_fname);
+		return "[unknown]";
+	}
+
+	virtual bool GetProcNameForAddr(void* addr, string& procName, void*& baseAddr, string& filename, int& line) override
+	{
+		Dl_info info;
+		if (!dladdr(addr, &info) || !info.dli_sname)
+			return IDebugCallStack::GetProcNameForAddr(addr, procName, baseAddr, filename, line);
+
+		int status = 0;
+		char* szDemangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+		procName = (status == 0 && szDemangled) ? szDemangled : info.dli_sname;
+		free(szDemangled);
+
+		baseAddr = info.dli_saddr;
+		filename = info.dli_fname ? PathUtil::GetFile(info.dli_fname) : "[unknown]";
+		line = 0;
+		return true;
+	}
+};
+
+IDebugCallStack* IDebugCallStack::instance()
+{
+	static CLinuxDebugCallStack sInstance;
+	return &sInstance;
+}
+#elif CRY_PLATFORM_ANDROID || CRY_PLATFORM_APPLE
 IDebugCallStack* IDebugCallStack::instance()
 {
 	static IDebugCallStack sInstance;
@@ -60,6 +60,8 @@ void JobManager::CWorkerBackEndProfiler::Init(uint16 numWorkers)
 		m_WorkerStatsInfo.m_nEndTime[i] = 0;
 	}
 	m_WorkerStatsInfo.m_nNumWorkers = numWorkers;
+	m_WorkerStatsInfo.m_workerClusterIds.clear();
+	m_WorkerStatsInfo.m_workerClusterIds.resize(numWorkers, 0);
 
 	if (m_WorkerStatsInfo.m_pWorkerStats)
 		CryModuleMemalignFree(m_WorkerStatsInfo.m_pWorkerStats);
@@ -247,6 +249,19 @@ uint32 JobManager::CWorkerBackEndProfiler::GetNumWorkers() const
 	return m_WorkerStatsInfo.m_nNumWorkers;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void JobManager::CWorkerBackEndProfiler::SetWorkerClusterId(const uint8 workerId, const uint8 clusterId)
+{
+	assert(workerId < m_WorkerStatsInfo.m_nNumWorkers);
+	m_WorkerStatsInfo.m_workerClusterIds[workerId] = clusterId;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+uint8 JobManager::CWorkerBackEndProfiler::GetWorkerClusterId(const uint8 workerId) const
+{
+	return workerId < m_WorkerStatsInfo.m_nNumWorkers ? m_WorkerStatsInfo.m_workerClusterIds[workerId] : 0;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void JobManager::CWorkerBackEndProfiler::GetWorkerStats(const uint8 nBufferIndex, JobManager::CWorkerFrameStats& rWorkerStats) const
 {
@@ -275,6 +290,7 @@ void JobManager::CWorkerBackEndProfiler::GetWorkerStats(const uint8 nBufferIndex
 		{
 			ZeroMemory(&rWorkerStats.workerStats[i], sizeof(CWorkerFrameStats::SWorkerStats));
 		}
+		rWorkerStats.workerStats[i].nClusterId = m_WorkerStatsInfo.m_workerClusterIds[i];
 	}
 }
 
@@ -391,6 +407,8 @@ JobManager::CJobManager::CJobManager()
 
 #if defined(JOBMANAGER_SUPPORT_PROFILING)
 	m_profilingData.nFrameIdx = 0;
+	m_nTraceFramesLeft = 0;
+	m_nTraceFrameCount = 0;
 #endif
 
 	memset(m_arrJobInvokers, 0, sizeof(m_arrJobInvokers));
@@ -538,6 +556,7 @@ void JobManager::CJobManager::AddJob(JobManager::CJobDelegator& crJob, const Job
 #if defined(JOBMANAGER_SUPPORT_PROFILING)
 	SJobProfilingData* pJobProfilingData = gEnv->GetJobManager()->GetProfilingData(infoBlock.profilerIndex);
 	pJobProfilingData->jobHandle = cJobHandle;
+	pJobProfilingData->nParentProfilerIndex = JobManager::detail::GetCurrentJobProfilerIndex();
 #endif
 
 	// == dispatch to the right BackEnd == //
@@ -1403,8 +1422,18 @@ void JobManager::CJobManager::SetFrameStartTime(const CTimeValue& rFrameStartTim
 {
 #if defined(JOBMANAGER_SUPPORT_PROFILING)
 	if (!m_bJobSystemProfilerPaused)
+	{
 		++m_profilingData.nFrameIdx;
 
+		// the frame before the last one is complete, it is only overwritten in two frames
+		if (m_nTraceFramesLeft)
+		{
+			CaptureTraceFrame(m_profilingData.GetRenderFrameIdx());
+			if (--m_nTraceFramesLeft == 0)
+				WriteTraceFile();
+		}
+	}
+
 	int idx = m_profilingData.GetFillFrameIdx();
 	m_FrameStartTime[idx] = rFrameStartTime;
 	// reset profiling counter
@@ -1478,6 +1507,285 @@ ColorB JobManager::CJobManager::GetRegionColor(SMarker::TMarkerString marker)
 #endif
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Chrome trace event export of the job profiling data
+// jobs are written as complete events on one track per worker, sync waits and the profiling markers on
+// the threads which issued them, and the job which added another job is connected to it with a flow event
+#if defined(JOBMANAGER_SUPPORT_PROFILING)
+namespace JobManager {
+namespace TraceCapture {
+
+enum
+{
+	eTid_Main        = 1,
+	eTid_Render      = 2,
+	eTid_WorkerBase  = 100,
+	eTid_Other       = 1000,  // other threads which waited for jobs
+	eTid_External    = 2000,  // tracks added with AddTraceEvent
+	eMaxCaptureFrames = 600,
+};
+
+// job and marker names are identifiers, but don't let a stray quote break the file
+const char* EscapeName(const char* szName, stack_string& escaped)
+{
+	escaped.clear();
+	for (const char* p = szName; *p; ++p)
+	{
+		if (*p == '"' || *p == '\\')
+			escaped += '\\';
+		if ((unsigned char)*p >= ' ')
+			escaped += *p;
+	}
+	return escaped.c_str();
+}
+
+bool HasRun(const SJobProfilingData& data, const CTimeValue& minStartTime, uint32 nNumWorkers)
+{
+	// profiling entries are not cleared when they are reused, and jobs run by the fallback backend carry no times
+	return data.jobHandle && data.nStartTime >= minStartTime && data.nEndTime >= data.nStartTime && data.nWorkerThread < nNumWorkers;
+}
+
+} // namespace TraceCapture
+} // namespace JobManager
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+void JobManager::CJobManager::StartTraceCapture(uint32 nFrames, const char* szFileName)
+{
+#if defined(JOBMANAGER_SUPPORT_PROFILING)
+	if (m_nTraceFramesLeft)
+	{
+		CryLogAlways("Job trace capture already running, %u frames left", m_nTraceFramesLeft);
+		return;
+	}
+
+	m_nTraceFramesLeft = clamp_tpl<uint32>(nFrames, 1, TraceCapture::eMaxCaptureFrames);
+	m_nTraceFrameCount = 0;
+	m_traceFileName = szFileName;
+	m_traceEvents.clear();
+	m_traceThreadIds.clear();
+	{
+		AUTO_LOCK_T(CryCriticalSectionNonRecursive, m_traceExternalLock);
+		m_traceExternalEvents.clear();
+		m_traceTrackNames.clear();
+	}
+	CryLogAlways("Capturing %u frames of job profiling data to %s", m_nTraceFramesLeft, m_traceFileName.c_str());
+#else
+	CryLogAlways("Job trace capture is not supported in this build");
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool JobManager::CJobManager::IsTraceCaptureRunning() const
+{
+#if defined(JOBMANAGER_SUPPORT_PROFILING)
+	return m_nTraceFramesLeft != 0;
+#else
+	return false;
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void JobManager::CJobManager::AddTraceEvent(const char* szTrack, const char* szName, const char* szCategory, const CTimeValue& startTime, const CTimeValue& endTime)
+{
+#if defined(JOBMANAGER_SUPPORT_PROFILING)
+	if (!m_nTraceFramesLeft || endTime < startTime)
+		return;
+
+	AUTO_LOCK_T(CryCriticalSectionNonRecursive, m_traceExternalLock);
+
+	uint32 nTrack = 0;
+	while (nTrack < m_traceTrackNames.size() && m_traceTrackNames[nTrack] != szTrack)
+		++nTrack;
+	if (nTrack == m_traceTrackNames.size())
+		m_traceTrackNames.push_back(szTrack);
+
+	STraceExternalEvent event;
+	event.name = szName;
+	event.category = szCategory;
+	event.nTrack = nTrack;
+	event.startTime = startTime;
+	event.endTime = endTime;
+	m_traceExternalEvents.push_back(event);
+#endif
+}
+
+#if defined(JOBMANAGER_SUPPORT_PROFILING)
+///////////////////////////////////////////////////////////////////////////////
+void JobManager::CJobManager::AppendTraceEvent(const char* szFormat, ...)
+{
+	char buffer[512];
+	va_list args;
+	va_start(args, szFormat);
+	cry_vsprintf(buffer, szFormat, args);
+	va_end(args);
+
+	// the thread name metadata is written in front of the events, so every event can start with a separator
+	m_traceEvents += ",\n";
+	m_traceEvents += buffer;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+uint32 JobManager::CJobManager::GetTraceThreadId(threadID nThreadId)
+{
+	threadID nMainThreadId = gEnv->mMainThreadId;
+	threadID nRenderThreadId = ~0;
+	if (gEnv->pRenderer)
+		gEnv->pRenderer->GetThreadIDs(nMainThreadId, nRenderThreadId);
+
+	if (nThreadId == nMainThreadId)
+		return TraceCapture::eTid_Main;
+	if (nThreadId == nRenderThreadId)
+		return TraceCapture::eTid_Render;
+
+	for (uint32 i = 0; i < m_traceThreadIds.size(); ++i)
+	{
+		if (m_traceThreadIds[i] == nThreadId)
+			return TraceCapture::eTid_Other + i;
+	}
+	m_traceThreadIds.push_back(nThreadId);
+	return TraceCapture::eTid_Other + m_traceThreadIds.size() - 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void JobManager::CJobManager::CaptureTraceFrame(uint32 nFrameIdx)
+{
+	using namespace TraceCapture;
+
+	const CTimeValue frameStartTime = m_FrameStartTime[nFrameIdx];
+	if (m_nTraceFrameCount == 0)
+		m_traceStartTime = frameStartTime;
+	const uint32 nFrame = m_nTraceFrameCount++;
+	const uint32 nNumWorkers = GetNumWorkerThreads();
+
+	AppendTraceEvent("{\"name\":\"Frame %u\",\"cat\":\"frame\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":%d,\"ts\":%" PRId64 "}",
+	                 nFrame, eTid_Main, (frameStartTime - m_traceStartTime).GetMicroSecondsAsInt64());
+
+	stack_string name;
+	const uint32 nNumEntries = min((uint32)m_profilingData.nProfilingDataCounter[nFrameIdx] + 1, (uint32)SJobProfilingDataContainer::nCapturedEntriesPerFrame);
+	for (uint32 i = 0; i < nNumEntries; ++i)
+	{
+		const SJobProfilingData& data = m_profilingData.arrJobProfilingData[nFrameIdx][i];
+		if (!data.jobHandle)
+			continue;
+		EscapeName(data.jobHandle->cpString, name);
+
+		// a job can only start after the frame it was added in began
+		if (HasRun(data, frameStartTime, nNumWorkers))
+		{
+			const int64 nStart = (data.nStartTime - m_traceStartTime).GetMicroSecondsAsInt64();
+			const uint32 nTid = eTid_WorkerBase + data.nWorkerThread;
+			AppendTraceEvent("{\"name\":\"%s\",\"cat\":\"job\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%" PRId64 ",\"dur\":%" PRId64 ",\"args\":{\"frame\":%u}}",
+			                 name.c_str(), nTid, nStart, (data.nEndTime - data.nStartTime).GetMicroSecondsAsInt64(), nFrame);
+
+			// the parent was added earlier, so its entry is at most one frame older and still valid
+			if (data.nParentProfilerIndex != (uint16)~0)
+			{
+				const SJobProfilingData* pParent = GetProfilingData(data.nParentProfilerIndex);
+				if (pParent != &m_profilingData.m_DymmyProfilingData && HasRun(*pParent, m_traceStartTime, nNumWorkers) && pParent->nStartTime <= data.nStartTime)
+				{
+					const uint32 nFlowId = nFrame * SJobProfilingDataContainer::nCapturedEntriesPerFrame + i;
+					AppendTraceEvent("{\"name\":\"AddJob\",\"cat\":\"dependency\",\"ph\":\"s\",\"id\":%u,\"pid\":1,\"tid\":%u,\"ts\":%" PRId64 "}",
+					                 nFlowId, eTid_WorkerBase + pParent->nWorkerThread, (pParent->nStartTime - m_traceStartTime).GetMicroSecondsAsInt64());
+					AppendTraceEvent("{\"name\":\"AddJob\",\"cat\":\"dependency\",\"ph\":\"f\",\"bp\":\"e\",\"id\":%u,\"pid\":1,\"tid\":%u,\"ts\":%" PRId64 "}",
+					                 nFlowId, nTid, nStart);
+				}
+			}
+		}
+
+		if (data.nWaitBegin >= frameStartTime && data.nWaitEnd > data.nWaitBegin)
+		{
+			AppendTraceEvent("{\"name\":\"Wait %s\",\"cat\":\"wait\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%" PRId64 ",\"dur\":%" PRId64 "}",
+			                 name.c_str(), GetTraceThreadId(data.nThreadId), (data.nWaitBegin - m_traceStartTime).GetMicroSecondsAsInt64(),
+			                 (data.nWaitEnd - data.nWaitBegin).GetMicroSecondsAsInt64());
+		}
+	}
+
+	// regions can span frames, they are written as separate begin and end events
+	for (int nThread = 0; nThread < 2; ++nThread)
+	{
+		const SMarker* pMarkers = nThread == 0 ? m_arrMainThreadMarker[nFrameIdx] : m_arrRenderThreadMarker[nFrameIdx];
+		const uint32 nNumMarkers = min(nThread == 0 ? m_nMainThreadMarkerIndex[nFrameIdx] : m_nRenderThreadMarkerIndex[nFrameIdx], (uint32)nMarkerEntries);
+		for (uint32 i = 0; i < nNumMarkers; ++i)
+		{
+			const SMarker& marker = pMarkers[i];
+			const int64 nTime = (marker.time - m_traceStartTime).GetMicroSecondsAsInt64();
+			if (marker.type == SMarker::PUSH_MARKER)
+				AppendTraceEvent("{\"name\":\"%s\",\"cat\":\"marker\",\"ph\":\"B\",\"pid\":1,\"tid\":%d,\"ts\":%" PRId64 "}",
+				                 EscapeName(marker.marker.c_str(), name), nThread == 0 ? eTid_Main : eTid_Render, nTime);
+			else
+				AppendTraceEvent("{\"ph\":\"E\",\"pid\":1,\"tid\":%d,\"ts\":%" PRId64 "}", nThread == 0 ? eTid_Main : eTid_Render, nTime);
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void JobManager::CJobManager::WriteTraceFile()
+{
+	using namespace TraceCapture;
+
+	char path[ICryPak::g_nMaxPath] = "";
+	gEnv->pCryPak->AdjustFileName(m_traceFileName.c_str(), path, ICryPak::FLAGS_PATH_REAL | ICryPak::FLAGS_FOR_WRITING);
+	gEnv->pCryPak->MakeDir(PathUtil::GetParentDirectory(string(path)).c_str());
+
+	FILE* pFile = ::fopen(path, "wb");
+	if (!pFile)
+	{
+		CryWarning(VALIDATOR_MODULE_SYSTEM, VALIDATOR_WARNING, "Job trace capture: could not open %s for writing", path);
+		m_traceEvents.clear();
+		return;
+	}
+
+	fprintf(pFile, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+	fprintf(pFile, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"CryEngine\"}}");
+	fprintf(pFile, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"Main\"}}", eTid_Main);
+	fprintf(pFile, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"Render\"}}", eTid_Render);
+	for (uint32 i = 0; i < GetNumWorkerThreads(); ++i)
+		fprintf(pFile, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"JobSystem_Worker_%u\"}}", eTid_WorkerBase + i, i);
+
+	stack_string name;
+	for (uint32 i = 0; i < m_traceThreadIds.size(); ++i)
+	{
+		const char* szThreadName = gEnv->pThreadManager ? gEnv->pThreadManager->GetThreadName(m_traceThreadIds[i]) : nullptr;
+		fprintf(pFile, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+		        eTid_Other + i, EscapeName(szThreadName && szThreadName[0] ? szThreadName : "Unknown", name));
+	}
+
+	fwrite(m_traceEvents.c_str(), 1, m_traceEvents.size(), pFile);
+
+	{
+		AUTO_LOCK_T(CryCriticalSectionNonRecursive, m_traceExternalLock);
+
+		stack_string category;
+		for (uint32 i = 0; i < m_traceTrackNames.size(); ++i)
+		{
+			fprintf(pFile, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+			        eTid_External + i, EscapeName(m_traceTrackNames[i].c_str(), name));
+		}
+
+		for (const STraceExternalEvent& event : m_traceExternalEvents)
+		{
+			// the first captured frame lags behind StartTraceCapture, drop what was measured before it
+			if (event.startTime < m_traceStartTime)
+				continue;
+			fprintf(pFile, ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%" PRId64 ",\"dur\":%" PRId64 "}",
+			        EscapeName(event.name.c_str(), name), EscapeName(event.category.c_str(), category), eTid_External + event.nTrack,
+			        (event.startTime - m_traceStartTime).GetMicroSecondsAsInt64(), (event.endTime - event.startTime).GetMicroSecondsAsInt64());
+		}
+
+		m_traceExternalEvents.clear();
+		m_traceTrackNames.clear();
+	}
+
+	fprintf(pFile, "\n]}\n");
+	fclose(pFile);
+
+	CryLogAlways("Job trace capture: wrote %u frames to %s", m_nTraceFrameCount, path);
+	m_traceEvents.clear();
+	m_traceThreadIds.clear();
+}
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 JobManager::TSemaphoreHandle JobManager::CJobManager::AllocateSemaphore(volatile const void* pOwner)
 {
@@ -1592,6 +1900,7 @@ void JobManager::CJobManager::AddBlockingFallbackJob(JobManager::SInfoBlock* pIn
 ///////////////////////////////////////////////////////////////////////////////
 TLS_DEFINE(uint32, gWorkerThreadId);
 TLS_DEFINE(uintptr_t, gFallbackInfoBlocks);
+TLS_DEFINE(uintptr_t, gCurrentJobProfilerIndex);
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace JobManager {
@@ -1617,6 +1926,19 @@ uint32 JobManager::detail::GetWorkerThreadId()
 	return is_marked_worker_thread_id(nID) ? unmark_worker_thread_id(nID) : ~0;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void JobManager::detail::SetCurrentJobProfilerIndex(uint16 nProfilerIndex)
+{
+	// stored +1, so that the default TLS value of 0 means no job is running
+	TLS_SET(gCurrentJobProfilerIndex, (uintptr_t)(uint16)(nProfilerIndex + 1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+uint16 JobManager::detail::GetCurrentJobProfilerIndex()
+{
+	return (uint16)(TLS_GET(uintptr_t, gCurrentJobProfilerIndex) - 1);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void JobManager::detail::PushToFallbackJobList(JobManager::SInfoBlock* pInfoBlock)
 {
@@ -33,6 +33,10 @@ JobManager::SInfoBlock* PopFromFallbackJobList();
 void   SetWorkerThreadId(uint32 nWorkerThreadId);
 uint32 GetWorkerThreadId();
 
+// functions to access the profiler index of the job running on this thread, used to record which job added which
+void   SetCurrentJobProfilerIndex(uint16 nProfilerIndex);
+uint16 GetCurrentJobProfilerIndex();
+
 } // namespace detail
 
 // Tracks CPU/PPU worker thread(s) utilization and job execution time per frame
@@ -69,6 +73,10 @@ public:
 	// Get the number of workers tracked
 	virtual uint32 GetNumWorkers() const;
 
+	// Cache cluster or NUMA node a worker is placed on
+	virtual void  SetWorkerClusterId(const uint8 workerId, const uint8 clusterId);
+	virtual uint8 GetWorkerClusterId(const uint8 workerId) const;
+
 protected:
 	void GetWorkerStats(const uint8 nBufferIndex, JobManager::CWorkerFrameStats& rWorkerStats) const;
 	void GetJobStats(const uint8 nBufferIndex, TJobFrameStatsContainer& rJobStatsContainer, IWorkerBackEndProfiler::EJobSortOrder jobSortOrder) const;
@@ -87,6 +95,7 @@ protected:
 		uint32                    m_nEndTime[JobManager::detail::eJOB_FRAME_STATS];   // End Time of sample period (multi buffered)
 		uint16                    m_nNumWorkers;                                      // Number of workers tracked
 		JobManager::SWorkerStats* m_pWorkerStats;                                     // Array of worker stats for each worker (multi buffered)
+		DynArray<uint8>           m_workerClusterIds;                                 // Cache cluster/NUMA node of each worker
 	};
 
 protected:
@@ -256,6 +265,10 @@ public:
 
 	virtual void DumpJobList() override;
 
+	virtual void StartTraceCapture(uint32 nFrames, const char* szFileName) override;
+	virtual bool IsTraceCaptureRunning() const override;
+	virtual void AddTraceEvent(const char* szTrack, const char* szName, const char* szCategory, const CTimeValue& startTime, const CTimeValue& endTime) override;
+
 	virtual bool OnInputEvent(const SInputEvent &event) override;
 
 	void IncreaseRunJobs();
@@ -307,6 +320,30 @@ private:
 	std::map<SMarker::TMarkerString, ColorB> m_RegionColors;
 	CTimeValue m_FrameStartTime[SJobProfilingDataContainer::nCapturedFrames];
 
+	// chrome trace capture, see StartTraceCapture
+	void CaptureTraceFrame(uint32 nFrameIdx);
+	void WriteTraceFile();
+	void AppendTraceEvent(const char* szFormat, ...) PRINTF_PARAMS(2, 3);
+	uint32 GetTraceThreadId(threadID nThreadId);
+
+	uint32 m_nTraceFramesLeft;                  // frames still to capture, 0 if no capture is running
+	uint32 m_nTraceFrameCount;
+	CTimeValue m_traceStartTime;                // all timestamps are relative to this
+	string m_traceFileName;
+	string m_traceEvents;
+	std::vector<threadID> m_traceThreadIds;     // threads other than main and render which waited for jobs
+
+	struct STraceExternalEvent
+	{
+		string     name;
+		string     category;
+		uint32     nTrack;
+		CTimeValue startTime;
+		CTimeValue endTime;
+	};
+	std::vector<STraceExternalEvent> m_traceExternalEvents;  // see AddTraceEvent, written with the file since they can arrive from any thread
+	std::vector<string> m_traceTrackNames;
+	CryCriticalSectionNonRecursive m_traceExternalLock;
 #endif
 
 	// singleton stuff
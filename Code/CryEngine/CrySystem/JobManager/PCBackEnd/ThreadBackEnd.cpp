@@ -13,11 +13,13 @@
 #include "../JobManager.h"
 #include "../../System.h"
 #include "../../CPUDetect.h"
+#include <CryThreading/IThreadConfigManager.h>
 
 ///////////////////////////////////////////////////////////////////////////////
 JobManager::ThreadBackEnd::CThreadBackEnd::CThreadBackEnd()
 	: m_Semaphore(SJobQueue_ThreadBackEnd::eMaxWorkQueueJobsRegularPriority)
 	, m_nNumWorkerThreads(0)
+	, m_bWorkStealing(false)
 {
 	m_JobQueue.Init();
 
@@ -54,13 +56,24 @@ bool JobManager::ThreadBackEnd::CThreadBackEnd::Init(uint32 nSysMaxWorker)
 		return false;
 
 	m_nNumWorkerThreads = nNumWorkerToCreate;
+	m_bWorkStealing = g_cvars.sys_job_system_work_stealing != 0;
 
 	m_arrWorkerThreads.resize(nNumWorkerToCreate);
 
 	for (uint32 i = 0; i < nNumWorkerToCreate; ++i)
-	{
 		m_arrWorkerThreads[i] = new CThreadBackEndWorkerThread(this, m_Semaphore, m_JobQueue, i);
 
+	PlaceWorkerThreads();
+
+	for (uint32 i = 0; i < nNumWorkerToCreate; ++i)
+	{
+
+		if (m_bWorkStealing)
+		{
+			for (uint32 nPriority = 0; nPriority < eNumPriorityLevel; ++nPriority)
+				m_arrWorkerThreads[i]->GetLocalQueue(nPriority).Init();
+		}
+
 		if (!gEnv->pThreadManager->SpawnThread(m_arrWorkerThreads[i], "JobSystem_Worker_%u", i))
 		{
 			CryFatalError("Error spawning \"JobSystem_Worker_%u\" thread.", i);
@@ -69,11 +82,42 @@ bool JobManager::ThreadBackEnd::CThreadBackEnd::Init(uint32 nSysMaxWorker)
 #if defined(JOBMANAGER_SUPPORT_FRAMEPROFILER)
 	m_pBackEndWorkerProfiler = new JobManager::CWorkerBackEndProfiler;
 	m_pBackEndWorkerProfiler->Init(nNumWorkerToCreate);
+	for (uint32 i = 0; i < nNumWorkerToCreate; ++i)
+		m_pBackEndWorkerProfiler->SetWorkerClusterId(i, m_arrWorkerThreads[i]->GetClusterId());
 #endif
 
+	if (m_bWorkStealing)
+		CryLogAlways("JobSystem: work stealing enabled for %u workers", nNumWorkerToCreate);
+
 	return true;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void JobManager::ThreadBackEnd::CThreadBackEnd::PlaceWorkerThreads()
+{
+#if !CRY_PLATFORM_DURANGO && !CRY_PLATFORM_ORBIS
+	CCpuFeatures* pCPU = ((CSystem*)gEnv->pSystem)->GetCPUFeatures();
+	IThreadConfigManager* pThreadConfigMngr = gEnv->pThreadManager->GetThreadConfigManager();
+
+	for (uint32 i = 0; i < m_nNumWorkerThreads; ++i)
+	{
+		const SThreadConfig* pConfig = pThreadConfigMngr->GetThreadConfig("JobSystem_Worker_%u", i);
+		if (!pConfig || !(pConfig->paramActivityFlag & SThreadConfig::eThreadParamFlag_AffinityGroup) || pConfig->affinityGroup == SThreadConfig::eAffinityGroup_None)
+			continue;
+
+		const bool bNumaNode = pConfig->affinityGroup == SThreadConfig::eAffinityGroup_NumaNode;
+		const uint32 nNumGroups = bNumaNode ? pCPU->GetNumNumaNodes() : pCPU->GetNumCacheClusters();
+
+		// spread the workers evenly, neighbouring worker ids share a group so stealing stays local
+		const uint32 nGroup = (i * nNumGroups) / m_nNumWorkerThreads;
+		const DWORD_PTR nMask = bNumaNode ? pCPU->GetNumaNodeAffinityMask(nGroup) : pCPU->GetCacheClusterAffinityMask(nGroup);
+		m_arrWorkerThreads[i]->SetPlacement(nGroup, nMask);
+
+		CryLogAlways("JobSystem: worker %u placed on %s %u (affinity mask 0x%" PRIx64 ")", i, bNumaNode ? "NUMA node" : "L3 cluster", nGroup, (uint64)nMask);
+	}
+#endif
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 bool JobManager::ThreadBackEnd::CThreadBackEnd::ShutDown()
 {
@@ -119,6 +163,13 @@ void JobManager::ThreadBackEnd::CThreadBackEnd::AddJob(JobManager::CJobDelegator
 	uint32 nJobPriority = crJob.GetPriorityLevel();
 	CJobManager* __restrict pJobManager = CJobManager::Instance();
 
+	// jobs spawned from a regular worker stay on that worker, others steal them if idle
+	IF (m_bWorkStealing && !crJob.IsBlocking() && JobManager::IsWorkerThread() && !JobManager::IsBlockingWorkerThread(), 0)
+	{
+		if (TryAddLocalJob(crJob, cJobHandle, rInfoBlock))
+			return;
+	}
+
 	/////////////////////////////////////////////////////////////////////////////
 	// Acquire Infoblock to use
 	uint32 jobSlot;
@@ -158,24 +209,7 @@ void JobManager::ThreadBackEnd::CThreadBackEnd::AddJob(JobManager::CJobDelegator
 
 	/////////////////////////////////////////////////////////////////////////////
 	// Initialize the InfoBlock
-	rInfoBlock.AssignMembersTo(&rJobInfoBlock);
-
-	// copy job parameter if it is a non-queue job
-	if (crJob.GetQueue() == NULL)
-	{
-		JobManager::CJobManager::CopyJobParameter(crJob.GetParamDataSize(), rJobInfoBlock.GetParamAddress(), crJob.GetJobParamData());
-	}
-
-	assert(rInfoBlock.jobInvoker);
-
-	const uint32 cJobId = cJobHandle->jobId;
-	rJobInfoBlock.jobId = (unsigned char)cJobId;
-
-#if defined(JOBMANAGER_SUPPORT_FRAMEPROFILER)
-	assert(cJobId < JobManager::detail::eJOB_FRAME_STATS_MAX_SUPP_JOBS);
-	m_pBackEndWorkerProfiler->RegisterJob(cJobId, pJobManager->GetJobName(rInfoBlock.jobInvoker));
-	rJobInfoBlock.frameProfIndex = (unsigned char)m_pBackEndWorkerProfiler->GetProfileIndex();
-#endif
+	InitJobInfoBlock(crJob, cJobHandle, rInfoBlock, rJobInfoBlock);
 
 	/////////////////////////////////////////////////////////////////////////////
 	// initialization finished, make all visible for worker threads
@@ -212,6 +246,53 @@ void JobManager::ThreadBackEnd::CThreadBackEnd::AddJob(JobManager::CJobDelegator
 	}
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void JobManager::ThreadBackEnd::CThreadBackEnd::InitJobInfoBlock(JobManager::CJobDelegator& crJob, const JobManager::TJobHandle cJobHandle, JobManager::SInfoBlock& rInfoBlock, JobManager::SInfoBlock& rJobInfoBlock)
+{
+	rInfoBlock.AssignMembersTo(&rJobInfoBlock);
+
+	// copy job parameter if it is a non-queue job
+	if (crJob.GetQueue() == NULL)
+	{
+		JobManager::CJobManager::CopyJobParameter(crJob.GetParamDataSize(), rJobInfoBlock.GetParamAddress(), crJob.GetJobParamData());
+	}
+
+	assert(rInfoBlock.jobInvoker);
+
+	const uint32 cJobId = cJobHandle->jobId;
+	rJobInfoBlock.jobId = (unsigned char)cJobId;
+
+#if defined(JOBMANAGER_SUPPORT_FRAMEPROFILER)
+	assert(cJobId < JobManager::detail::eJOB_FRAME_STATS_MAX_SUPP_JOBS);
+	m_pBackEndWorkerProfiler->RegisterJob(cJobId, CJobManager::Instance()->GetJobName(rInfoBlock.jobInvoker));
+	rJobInfoBlock.frameProfIndex = (unsigned char)m_pBackEndWorkerProfiler->GetProfileIndex();
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool JobManager::ThreadBackEnd::CThreadBackEnd::TryAddLocalJob(JobManager::CJobDelegator& crJob, const JobManager::TJobHandle cJobHandle, JobManager::SInfoBlock& rInfoBlock)
+{
+	const uint32 nWorkerId = JobManager::detail::GetWorkerThreadId();
+	if (nWorkerId >= m_arrWorkerThreads.size())
+		return false;
+
+	detail::CWorkStealingQueue& rLocalQueue = m_arrWorkerThreads[nWorkerId]->GetLocalQueue(crJob.GetPriorityLevel());
+	JobManager::SInfoBlock* pJobInfoBlock = rLocalQueue.BeginPush();
+	if (pJobInfoBlock == NULL)
+		return false; // deque full, use the shared queue
+
+	InitJobInfoBlock(crJob, cJobHandle, rInfoBlock, *pJobInfoBlock);
+	rLocalQueue.EndPush();
+
+#if !defined(_RELEASE)
+	CJobManager::Instance()->IncreaseRunJobs();
+#endif
+
+	// wake up a sleeping worker to steal it, whoever takes the job consumes the count again
+	m_Semaphore.SignalNewJob();
+	return true;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void JobManager::ThreadBackEnd::CThreadBackEndWorkerThread::SignalStopWork()
 {
@@ -257,6 +338,7 @@ void JobManager::ThreadBackEnd::CThreadBackEndWorkerThread::ThreadEntry()
 {
 	// set up thread id
 	JobManager::detail::SetWorkerThreadId(m_nId);
+	ApplyPlacement();
 
 #if defined(JOB_SPIN_DURING_IDLE)
 	HANDLE nThreadID = GetCurrentThread();
@@ -271,6 +353,9 @@ void JobManager::ThreadBackEnd::CThreadBackEndWorkerThread::ThreadEntry()
 
 	CJobManager* __restrict pJobManager = CJobManager::Instance();
 
+	// work stealing mode: set when waking up from the semaphore, which already took the count of one job
+	bool bJobCountTaken = false;
+
 	do
 	{
 		SInfoBlock infoBlock;
@@ -292,6 +377,23 @@ void JobManager::ThreadBackEnd::CThreadBackEndWorkerThread::ThreadEntry()
 			// free temp info block again
 			delete pFallbackInfoBlock;
 		}
+		else if (m_pThreadBackend->IsWorkStealingEnabled())
+		{
+			// look for work in our own deques, the shared queue and the other workers before going to sleep,
+			// every job add releases the semaphore once, so a sleeping worker is always woken up for new work
+			if (!FindWorkStealingJob(infoBlock, nPriorityLevel))
+			{
+				m_rSemaphore.WaitForNewJob(m_nId);
+				bJobCountTaken = true;
+				continue;
+			}
+
+			// take the count of every job found without waiting as well. if the add has not signalled yet
+			// the count stays behind and causes a single extra wakeup
+			if (!bJobCountTaken)
+				m_rSemaphore.TryConsumeJob();
+			bJobCountTaken = false;
+		}
 		else
 		{
 			///////////////////////////////////////////////////////////////////////////
@@ -350,35 +452,8 @@ void JobManager::ThreadBackEnd::CThreadBackEndWorkerThread::ThreadEntry()
 			}
 			while (true);
 
-			// compute our jobslot index from the only increasing publish index
-			uint32 nExtractedCurIndex = static_cast<uint32>(JobManager::SJobQueuePos::ExtractIndex(currentPullIndex, nPriorityLevel));
-			uint32 nNumWorkerQUeueJobs = m_rJobQueue.GetMaxWorkerQueueJobs(nPriorityLevel);
-			uint32 nJobSlot = nExtractedCurIndex & (nNumWorkerQUeueJobs - 1);
-
-			// 2. Wait still the produces has finished writing all data to the SInfoBlock
-			JobManager::detail::SJobQueueSlotState* pJobInfoBlockState = &m_rJobQueue.jobInfoBlockStates[nPriorityLevel][nJobSlot];
-			int iter = 0;
-			while (!pJobInfoBlockState->IsReady())
-			{
-				CrySleep(iter++ > 10 ? 1 : 0);
-			}
-			;
-
-			// 3. Get a local copy of the info block as asson as it is ready to be used
-			JobManager::SInfoBlock* pCurrentJobSlot = &m_rJobQueue.jobInfoBlocks[nPriorityLevel][nJobSlot];
-			pCurrentJobSlot->AssignMembersTo(&infoBlock);
-			if (!infoBlock.HasQueue())  // copy parameters for non producer/consumer jobs
-			{
-				JobManager::CJobManager::CopyJobParameter(infoBlock.paramSize << 4, infoBlock.GetParamAddress(), pCurrentJobSlot->GetParamAddress());
-			}
-
-			// 4. Remark the job state as suspended
-			MemoryBarrier();
-			pJobInfoBlockState->SetNotReady();
-
-			// 5. Mark the jobslot as free again
-			MemoryBarrier();
-			pCurrentJobSlot->Release((1 << JobManager::SJobQueuePos::eBitsPerPriorityLevel) / m_rJobQueue.GetMaxWorkerQueueJobs(nPriorityLevel));
+			// 2.-5. wait for the producer, copy the info block and release the job slot
+			ReadGlobalJobSlot(currentPullIndex, nPriorityLevel, infoBlock);
 		}
 
 		///////////////////////////////////////////////////////////////////////////
@@ -399,6 +474,7 @@ void JobManager::ThreadBackEnd::CThreadBackEndWorkerThread::ThreadEntry()
 			SJobProfilingData* pJobProfilingData = gEnv->GetJobManager()->GetProfilingData(infoBlock.profilerIndex);
 			pJobProfilingData->nStartTime = gEnv->pTimer->GetAsyncTime();
 			pJobProfilingData->nWorkerThread = GetWorkerThreadId();
+			JobManager::detail::SetCurrentJobProfilerIndex(infoBlock.profilerIndex);
 #endif
 
 #if defined(JOBMANAGER_SUPPORT_FRAMEPROFILER)
@@ -447,6 +523,7 @@ void JobManager::ThreadBackEnd::CThreadBackEndWorkerThread::ThreadEntry()
 			}
 #if defined(JOBMANAGER_SUPPORT_PROFILING)
 			pJobProfilingData->nEndTime = gEnv->pTimer->GetAsyncTime();
+			JobManager::detail::SetCurrentJobProfilerIndex((uint16)~0);
 #endif
 		}
 
@@ -455,6 +532,142 @@ void JobManager::ThreadBackEnd::CThreadBackEndWorkerThread::ThreadEntry()
 
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void JobManager::ThreadBackEnd::CThreadBackEndWorkerThread::ReadGlobalJobSlot(uint64 nPullIndex, uint32 nPriorityLevel, SInfoBlock& rInfoBlock)
+{
+	// compute our jobslot index from the only increasing publish index
+	uint32 nExtractedCurIndex = static_cast<uint32>(JobManager::SJobQueuePos::ExtractIndex(nPullIndex, nPriorityLevel));
+	uint32 nNumWorkerQUeueJobs = m_rJobQueue.GetMaxWorkerQueueJobs(nPriorityLevel);
+	uint32 nJobSlot = nExtractedCurIndex & (nNumWorkerQUeueJobs - 1);
+
+	// 2. Wait still the produces has finished writing all data to the SInfoBlock
+	JobManager::detail::SJobQueueSlotState* pJobInfoBlockState = &m_rJobQueue.jobInfoBlockStates[nPriorityLevel][nJobSlot];
+	int iter = 0;
+	while (!pJobInfoBlockState->IsReady())
+	{
+		CrySleep(iter++ > 10 ? 1 : 0);
+	}
+	;
+
+	// 3. Get a local copy of the info block as asson as it is ready to be used
+	JobManager::SInfoBlock* pCurrentJobSlot = &m_rJobQueue.jobInfoBlocks[nPriorityLevel][nJobSlot];
+	pCurrentJobSlot->AssignMembersTo(&rInfoBlock);
+	if (!rInfoBlock.HasQueue())  // copy parameters for non producer/consumer jobs
+	{
+		JobManager::CJobManager::CopyJobParameter(rInfoBlock.paramSize << 4, rInfoBlock.GetParamAddress(), pCurrentJobSlot->GetParamAddress());
+	}
+
+	// 4. Remark the job state as suspended
+	MemoryBarrier();
+	pJobInfoBlockState->SetNotReady();
+
+	// 5. Mark the jobslot as free again
+	MemoryBarrier();
+	pCurrentJobSlot->Release((1 << JobManager::SJobQueuePos::eBitsPerPriorityLevel) / m_rJobQueue.GetMaxWorkerQueueJobs(nPriorityLevel));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool JobManager::ThreadBackEnd::CThreadBackEndWorkerThread::TryPullFromGlobalQueue(SInfoBlock& rInfoBlock, uint32& rPriorityLevel)
+{
+	uint64 currentPushIndex = ~0;
+	uint64 currentPullIndex = ~0;
+	uint64 newPullIndex = ~0;
+	uint32 nPriorityLevel = ~0;
+	do
+	{
+#if CRY_PLATFORM_WINDOWS || CRY_PLATFORM_APPLE || CRY_PLATFORM_LINUX || CRY_PLATFORM_ANDROID// emulate a 64bit atomic read on PC platfom
+		currentPullIndex = CryInterlockedCompareExchange64(alias_cast<volatile int64*>(&m_rJobQueue.pull.index), 0, 0);
+		currentPushIndex = CryInterlockedCompareExchange64(alias_cast<volatile int64*>(&m_rJobQueue.push.index), 0, 0);
+#else
+		currentPullIndex = *const_cast<volatile uint64*>(&m_rJobQueue.pull.index);
+		currentPushIndex = *const_cast<volatile uint64*>(&m_rJobQueue.push.index);
+#endif
+		// unlike the regular worker loop, don't spin on an empty queue, there might be work to steal
+		if (currentPushIndex == currentPullIndex)
+			return false;
+
+		if (!JobManager::SJobQueuePos::IncreasePullIndex(currentPullIndex, currentPushIndex, newPullIndex, nPriorityLevel,
+		                                                 m_rJobQueue.GetMaxWorkerQueueJobs(eHighPriority), m_rJobQueue.GetMaxWorkerQueueJobs(eRegularPriority), m_rJobQueue.GetMaxWorkerQueueJobs(eLowPriority), m_rJobQueue.GetMaxWorkerQueueJobs(eStreamPriority)))
+			return false;
+
+		if (CryInterlockedCompareExchange64(alias_cast<volatile int64*>(&m_rJobQueue.pull.index), newPullIndex, currentPullIndex) == currentPullIndex)
+			break;
+	}
+	while (true);
+
+	ReadGlobalJobSlot(currentPullIndex, nPriorityLevel, rInfoBlock);
+	rPriorityLevel = nPriorityLevel;
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+uint32 JobManager::ThreadBackEnd::CThreadBackEndWorkerThread::PeekGlobalQueuePriority() const
+{
+#if CRY_PLATFORM_WINDOWS || CRY_PLATFORM_APPLE || CRY_PLATFORM_LINUX || CRY_PLATFORM_ANDROID// emulate a 64bit atomic read on PC platfom
+	const uint64 currentPullIndex = CryInterlockedCompareExchange64(alias_cast<volatile int64*>(&m_rJobQueue.pull.index), 0, 0);
+	const uint64 currentPushIndex = CryInterlockedCompareExchange64(alias_cast<volatile int64*>(&m_rJobQueue.push.index), 0, 0);
+#else
+	const uint64 currentPullIndex = *const_cast<volatile uint64*>(&m_rJobQueue.pull.index);
+	const uint64 currentPushIndex = *const_cast<volatile uint64*>(&m_rJobQueue.push.index);
+#endif
+	if (currentPushIndex == currentPullIndex)
+		return eNumPriorityLevel;
+
+	uint64 newPullIndex = ~0;
+	uint32 nPriorityLevel = eNumPriorityLevel;
+	if (!JobManager::SJobQueuePos::IncreasePullIndex(currentPullIndex, currentPushIndex, newPullIndex, nPriorityLevel,
+	                                                 m_rJobQueue.GetMaxWorkerQueueJobs(eHighPriority), m_rJobQueue.GetMaxWorkerQueueJobs(eRegularPriority), m_rJobQueue.GetMaxWorkerQueueJobs(eLowPriority), m_rJobQueue.GetMaxWorkerQueueJobs(eStreamPriority)))
+		return eNumPriorityLevel;
+
+	return nPriorityLevel;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool JobManager::ThreadBackEnd::CThreadBackEndWorkerThread::FindWorkStealingJob(SInfoBlock& rInfoBlock, uint32& rPriorityLevel)
+{
+	const uint32 nNumWorkers = m_pThreadBackend->GetNumWorkerThreads();
+
+	// the shared queue always hands out its highest priority job, so only pull from it
+	// once we reached its priority level, to not run a low priority job before local regular work
+	uint32 nGlobalQueuePriority = PeekGlobalQueuePriority();
+	for (uint32 nPriority = 0; nPriority < eNumPriorityLevel; ++nPriority)
+	{
+		// 1. our own most recently spawned job, likely still in cache
+		if (m_localQueues[nPriority].Pop(rInfoBlock))
+		{
+			rPriorityLevel = nPriority;
+			return true;
+		}
+
+		// 2. jobs added from non-worker threads
+		if (nGlobalQueuePriority <= nPriority)
+		{
+			if (TryPullFromGlobalQueue(rInfoBlock, rPriorityLevel))
+				return true;
+			nGlobalQueuePriority = PeekGlobalQueuePriority();
+		}
+
+		// 3. steal the oldest job of another worker, start with our neighbour to spread the victims
+		// workers of our own cache cluster are tried first, their data is likely shared in L3
+		for (uint32 nPass = 0; nPass < 2; ++nPass)
+		{
+			for (uint32 i = 1; i < nNumWorkers; ++i)
+			{
+				CThreadBackEndWorkerThread* pVictim = m_pThreadBackend->GetWorkerThread((m_nId + i) % nNumWorkers);
+				if ((pVictim->GetClusterId() == m_nClusterId) != (nPass == 0))
+					continue;
+				if (pVictim->GetLocalQueue(nPriority).Steal(rInfoBlock))
+				{
+					rPriorityLevel = nPriority;
+					return true;
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 ILINE void IncrQueuePullPointer(INT_PTR& rCurPullAddr, const INT_PTR cIncr, const INT_PTR cQueueStart, const INT_PTR cQueueEnd)
 {
@@ -505,6 +718,7 @@ void JobManager::ThreadBackEnd::CThreadBackEndWorkerThread::DoWorkProducerConsum
 		SJobProfilingData* pJobProfilingData = gEnv->GetJobManager()->GetProfilingData(pAddPacketData->profilerIndex);
 		pJobProfilingData->nStartTime = gEnv->pTimer->GetAsyncTime();
 		pJobProfilingData->nWorkerThread = GetWorkerThreadId();
+		JobManager::detail::SetCurrentJobProfilerIndex(pAddPacketData->profilerIndex);
 #endif
 
 		// do we need another job invoker (multi-type job prod/con queue)
@@ -541,6 +755,7 @@ void JobManager::ThreadBackEnd::CThreadBackEndWorkerThread::DoWorkProducerConsum
 
 #if defined(JOBMANAGER_SUPPORT_PROFILING)
 		pJobProfilingData->nEndTime = gEnv->pTimer->GetAsyncTime();
+		JobManager::detail::SetCurrentJobProfilerIndex((uint16)~0);
 #endif
 
 		// == update queue state == //
@@ -686,10 +901,34 @@ JobManager::ThreadBackEnd::CThreadBackEndWorkerThread::CThreadBackEndWorkerThrea
 	m_rJobQueue(rJobQueue),
 	m_bStop(false),
 	m_nId(nId),
+	m_nClusterId(0),
+	m_nAffinityMask(0),
 	m_pThreadBackend(pThreadBackend)
 {
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void JobManager::ThreadBackEnd::CThreadBackEndWorkerThread::ApplyPlacement()
+{
+	if (m_nAffinityMask == 0)
+		return;
+
+#if CRY_PLATFORM_WINAPI
+	if (SetThreadAffinityMask(GetCurrentThread(), m_nAffinityMask) == 0)
+		CryWarning(VALIDATOR_MODULE_SYSTEM, VALIDATOR_WARNING, "JobSystem: failed to set affinity mask 0x%" PRIx64 " for worker %u", (uint64)m_nAffinityMask, m_nId);
+#elif CRY_PLATFORM_LINUX || CRY_PLATFORM_ANDROID
+	cpu_set_t cpuSet;
+	CPU_ZERO(&cpuSet);
+	for (uint32 c = 0; c < sizeof(m_nAffinityMask) * 8; ++c)
+	{
+		if (m_nAffinityMask & ((DWORD_PTR)1 << c))
+			CPU_SET(c, &cpuSet);
+	}
+	if (sched_setaffinity(0, sizeof(cpuSet), &cpuSet) != 0)
+		CryWarning(VALIDATOR_MODULE_SYSTEM, VALIDATOR_WARNING, "JobSystem: failed to set affinity mask 0x%" PRIx64 " for worker %u", (uint64)m_nAffinityMask, m_nId);
+#endif
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 JobManager::ThreadBackEnd::CThreadBackEndWorkerThread::~CThreadBackEndWorkerThread()
 {
@@ -14,6 +14,7 @@
 
 #include <CryThreading/IJobManager.h>
 #include "../JobStructs.h"
+#include "WorkStealingQueue.h"
 
 #include <CryThreading/IThreadManager.h>
 
@@ -75,6 +76,25 @@ public:
 		return false;
 #endif
 	}
+
+	// takes the count of a job that was found without waiting (work stealing mode),
+	// so the count keeps matching the pending jobs and idle workers don't wake up for nothing
+	void TryConsumeJob()
+	{
+#if defined(JOB_SPIN_DURING_IDLE)
+		int nCount = ~0;
+		do
+		{
+			nCount = *const_cast<volatile int*>(&m_nCounter);
+			if (nCount <= 0)
+				return;
+		}
+		while (CryInterlockedCompareExchange(alias_cast<volatile LONG*>(&m_nCounter), nCount - 1, nCount) != nCount);
+#else
+		m_Semaphore.TryAcquire();
+#endif
+	}
+
 	void WaitForNewJob(uint32 nWorkerID)
 	{
 #if defined(JOB_SPIN_DURING_IDLE)
@@ -209,19 +229,43 @@ public:
 
 	// Signals the thread that it should not accept anymore work and exit
 	void SignalStopWork();
+
+	// per priority level deque used in work stealing mode, only this worker pushes/pops, others steal
+	detail::CWorkStealingQueue& GetLocalQueue(uint32 nPriorityLevel) { return m_localQueues[nPriorityLevel]; }
+
+	// cache cluster/NUMA node placement, the affinity is applied by the worker itself on startup (0 = no pinning)
+	void   SetPlacement(uint32 nClusterId, DWORD_PTR nAffinityMask) { m_nClusterId = nClusterId; m_nAffinityMask = nAffinityMask; }
+	uint32 GetClusterId() const                                     { return m_nClusterId; }
 private:
+	// pins the calling worker thread to m_nAffinityMask
+	void ApplyPlacement();
+
 	void DoWorkProducerConsumerQueue(SInfoBlock& rInfoBlock);
 
+	// pulls a job from the shared queue, returns false if the queue is empty
+	bool TryPullFromGlobalQueue(SInfoBlock& rInfoBlock, uint32& rPriorityLevel);
+	// copies the job at the claimed pull index out of the shared queue and frees its slot
+	void ReadGlobalJobSlot(uint64 nPullIndex, uint32 nPriorityLevel, SInfoBlock& rInfoBlock);
+	// highest priority level with pending jobs in the shared queue, eNumPriorityLevel if empty
+	uint32 PeekGlobalQueuePriority() const;
+	// work stealing mode: local deque, shared queue and other workers' deques, in priority order
+	bool FindWorkStealingJob(SInfoBlock& rInfoBlock, uint32& rPriorityLevel);
+
 	uint32                               m_nId;                   // id of the worker thread
+	uint32                               m_nClusterId;            // cache cluster/NUMA node the worker is placed on
+	DWORD_PTR                            m_nAffinityMask;         // cpus of the cluster, 0 if the thread config doesn't request placement
 	volatile bool                        m_bStop;
 	detail::CWaitForJobObject&           m_rSemaphore;
 	JobManager::SJobQueue_ThreadBackEnd& m_rJobQueue;
 	CThreadBackEnd*                      m_pThreadBackend;
+	detail::CWorkStealingQueue           m_localQueues[eNumPriorityLevel];
 };
 
 // the implementation of the PC backend
 // has n-worker threads which use atomic operations to pull from the job queue
 // and uses a semaphore to signal the workers if there is work required
+// in work stealing mode, jobs added from a worker are pushed into that worker's deques
+// and idle workers steal from the other workers before going to sleep
 class CThreadBackEnd : public IBackend
 {
 public:
@@ -239,6 +283,10 @@ public:
 	// returns the index to use for the frame profiler
 	uint32 GetCurrentFrameBufferIndex() const;
 
+	// true if worker spawned jobs go into per worker deques (sys_job_system_work_stealing)
+	bool                        IsWorkStealingEnabled() const { return m_bWorkStealing; }
+	CThreadBackEndWorkerThread* GetWorkerThread(uint32 nWorkerId) const { return m_arrWorkerThreads[nWorkerId]; }
+
 #if defined(JOBMANAGER_SUPPORT_FRAMEPROFILER)
 	JobManager::IWorkerBackEndProfiler* GetBackEndWorkerProfiler() const { return m_pBackEndWorkerProfiler; }
 #endif
@@ -246,10 +294,18 @@ public:
 private:
 	friend class JobManager::CJobManager;
 
+	// fills the job parameters and profiling data into the destination info block
+	void InitJobInfoBlock(JobManager::CJobDelegator& crJob, const JobManager::TJobHandle cJobHandle, JobManager::SInfoBlock& rInfoBlock, JobManager::SInfoBlock& rJobInfoBlock);
+	// work stealing mode: push a job spawned by a worker into its own deque, returns false if the deque is full
+	bool TryAddLocalJob(JobManager::CJobDelegator& crJob, const JobManager::TJobHandle cJobHandle, JobManager::SInfoBlock& rInfoBlock);
+	// assigns the workers to cache clusters/NUMA nodes if requested by the "JobSystem_Worker_%u" thread configs
+	void PlaceWorkerThreads();
+
 	JobManager::SJobQueue_ThreadBackEnd      m_JobQueue;              // job queue node where jobs are pushed into and from
 	detail::CWaitForJobObject                m_Semaphore;             // semaphore to count available jobs, to allow the workers to go sleeping instead of spinning when no work is required
 	std::vector<CThreadBackEndWorkerThread*> m_arrWorkerThreads;      // array of worker threads
 	uint8 m_nNumWorkerThreads;                                        // number of worker threads
+	bool  m_bWorkStealing;                                            // jobs added from workers go into per worker deques, idle workers steal
 
 	// members required for profiling jobs in the frame profiler
 #if defined(JOBMANAGER_SUPPORT_FRAMEPROFILER)
@@ -0,0 +1,172 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+// -------------------------------------------------------------------------
+//  File name:   WorkStealingQueue.h
+//  Version:     v1.00
+//  Compilers:   Visual Studio.NET
+//  Description: Per worker Chase-Lev style job deques for the PC backend.
+//               The owning worker pushes and pops at the bottom (LIFO),
+//               other workers steal from the top (FIFO).
+// -------------------------------------------------------------------------
+//  History:
+////////////////////////////////////////////////////////////////////////////
+
+#ifndef WORK_STEALING_QUEUE_H_
+#define WORK_STEALING_QUEUE_H_
+
+#include <CryThreading/IJobManager.h>
+#include <CryThreading/CryAtomics.h>
+
+namespace JobManager {
+namespace ThreadBackEnd {
+namespace detail {
+
+// fixed size Chase-Lev deque of SInfoBlocks
+// the deque only stores positions, each position maps to a fixed SInfoBlock slot,
+// the slot is only accessed by the thread which won the position (via the top CAS for thieves),
+// this avoids reading a SInfoBlock while the owner is writing it.
+// a slot is only reused by the owner once the consumer has copied it out and marked it free again
+class CWorkStealingQueue
+{
+public:
+	enum { eNumSlots = 256 };
+
+	CWorkStealingQueue()
+		: m_nTop(0)
+		, m_nBottom(0)
+		, m_pSlots(NULL)
+		, m_pSlotStates(NULL)
+	{
+		STATIC_CHECK(IsPowerOfTwoCompileTime<eNumSlots>::IsPowerOfTwo, ERROR_WORK_STEALING_QUEUE_SIZE_IS_NOT_POWER_OF_TWO);
+	}
+
+	~CWorkStealingQueue()
+	{
+		Release();
+	}
+
+	void Init()
+	{
+		m_pSlots = static_cast<JobManager::SInfoBlock*>(CryModuleMemalign(eNumSlots * sizeof(JobManager::SInfoBlock), 128));
+		m_pSlotStates = static_cast<volatile int*>(CryModuleMemalign(eNumSlots * sizeof(int), 128));
+		for (uint32 i = 0; i < eNumSlots; ++i)
+		{
+			new(&m_pSlots[i])JobManager::SInfoBlock();
+			m_pSlotStates[i] = eSlotFree;
+		}
+		m_nTop = 0;
+		m_nBottom = 0;
+	}
+
+	void Release()
+	{
+		if (m_pSlots)
+		{
+			for (uint32 i = 0; i < eNumSlots; ++i)
+				m_pSlots[i].~SInfoBlock();
+			CryModuleMemalignFree(m_pSlots);
+			CryModuleMemalignFree((void*)m_pSlotStates);
+		}
+		m_pSlots = NULL;
+		m_pSlotStates = NULL;
+	}
+
+	// owner only: returns the slot to fill for the next push, or NULL if the deque is full
+	JobManager::SInfoBlock* BeginPush()
+	{
+		const int64 nBottom = m_nBottom;
+		const int64 nTop = *const_cast<volatile int64*>(&m_nTop);
+		if (nBottom - nTop >= eNumSlots)
+			return NULL;
+
+		// a consumer might still be copying out the slot from the previous round
+		const uint32 nSlot = static_cast<uint32>(nBottom) & (eNumSlots - 1);
+		if (m_pSlotStates[nSlot] != eSlotFree)
+			return NULL;
+
+		MemoryBarrier();
+		m_pSlotStates[nSlot] = eSlotUsed;
+		return &m_pSlots[nSlot];
+	}
+
+	// owner only: publishes the slot returned by BeginPush
+	void EndPush()
+	{
+		MemoryBarrier();
+		*const_cast<volatile int64*>(&m_nBottom) = m_nBottom + 1;
+	}
+
+	// owner only: takes the most recently pushed job
+	bool Pop(JobManager::SInfoBlock& rInfoBlock)
+	{
+		const int64 nBottom = m_nBottom - 1;
+		*const_cast<volatile int64*>(&m_nBottom) = nBottom;
+		MemoryBarrier();
+		int64 nTop = *const_cast<volatile int64*>(&m_nTop);
+
+		if (nTop > nBottom)
+		{
+			// deque was empty, restore bottom
+			*const_cast<volatile int64*>(&m_nBottom) = nTop;
+			return false;
+		}
+
+		if (nTop == nBottom)
+		{
+			// last element, race against thieves for it
+			const bool bWon = CryInterlockedCompareExchange64(alias_cast<volatile int64*>(&m_nTop), nTop + 1, nTop) == nTop;
+			*const_cast<volatile int64*>(&m_nBottom) = nTop + 1;
+			if (!bWon)
+				return false;
+		}
+
+		CopyOutSlot(static_cast<uint32>(nBottom) & (eNumSlots - 1), rInfoBlock);
+		return true;
+	}
+
+	// any thread: takes the oldest job
+	bool Steal(JobManager::SInfoBlock& rInfoBlock)
+	{
+		const int64 nTop = *const_cast<volatile int64*>(&m_nTop);
+		MemoryBarrier();
+		const int64 nBottom = *const_cast<volatile int64*>(&m_nBottom);
+		if (nTop >= nBottom)
+			return false;
+
+		if (CryInterlockedCompareExchange64(alias_cast<volatile int64*>(&m_nTop), nTop + 1, nTop) != nTop)
+			return false;
+
+		CopyOutSlot(static_cast<uint32>(nTop) & (eNumSlots - 1), rInfoBlock);
+		return true;
+	}
+
+	// approximate, only used as a hint
+	bool IsEmpty() const
+	{
+		return *const_cast<volatile int64*>(&m_nTop) >= *const_cast<volatile int64*>(&m_nBottom);
+	}
+
+private:
+	enum { eSlotFree = 0, eSlotUsed = 1 };
+
+	void CopyOutSlot(uint32 nSlot, JobManager::SInfoBlock& rInfoBlock)
+	{
+		JobManager::SInfoBlock& rSlot = m_pSlots[nSlot];
+		rSlot.AssignMembersTo(&rInfoBlock);
+		rSlot.jobLambdaInvoker = nullptr;
+
+		MemoryBarrier();
+		m_pSlotStates[nSlot] = eSlotFree;
+	}
+
+	CRY_ALIGN(128) int64     m_nTop;    // only increased by CAS, read by the owner and thieves
+	CRY_ALIGN(128) int64     m_nBottom; // only written by the owner
+	JobManager::SInfoBlock*  m_pSlots;
+	volatile int*            m_pSlotStates;
+};
+
+} // namespace detail
+} // namespace ThreadBackEnd
+} // namespace JobManager
+
+#endif // WORK_STEALING_QUEUE_H_
@@ -0,0 +1,144 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "StdAfx.h"
+#include "PCBackEnd/WorkStealingQueue.h"
+#include "../UnitTestThread.h"
+#include <CrySystem/CryUnitTest.h>
+#include <CryThreading/JobGraph.h>
+
+#if defined(CRY_UNIT_TESTING)
+
+CRY_UNIT_TEST_SUITE(JobSystem)
+{
+	CRY_UNIT_TEST(CUT_WorkStealingQueue)
+	{
+		using JobManager::ThreadBackEnd::detail::CWorkStealingQueue;
+
+		const int kJobCount = 20000;
+		const int kThiefCount = 3;
+
+		CWorkStealingQueue queue;
+		queue.Init();
+
+		// every job carries its index in pNext, each one has to be taken exactly once
+		std::vector<int> takenCount(kJobCount, 0);
+		volatile int nTakenTotal = 0;
+		volatile bool bPushDone = false;
+
+		auto takeJob = [&](const JobManager::SInfoBlock& infoBlock)
+		{
+			const int nJob = static_cast<int>(reinterpret_cast<UINT_PTR>(infoBlock.pNext)) - 1;
+			CRY_UNIT_TEST_ASSERT(nJob >= 0 && nJob < kJobCount);
+			CryInterlockedIncrement(const_cast<volatile int*>(&takenCount[nJob]));
+			CryInterlockedIncrement(&nTakenTotal);
+		};
+
+		auto steal = [&]()
+		{
+			JobManager::SInfoBlock infoBlock;
+			while (!bPushDone || !queue.IsEmpty())
+			{
+				if (queue.Steal(infoBlock))
+					takeJob(infoBlock);
+			}
+		};
+
+		std::unique_ptr<CUnitTestThread> thieves[kThiefCount];
+		for (int i = 0; i < kThiefCount; ++i)
+		{
+			thieves[i].reset(new CUnitTestThread("JobManager", steal, i));
+			CRY_UNIT_TEST_ASSERT(thieves[i]->IsStarted());
+		}
+
+		// owner: push in bursts and pop some of them back, so pops race against steals for the last element
+		JobManager::SInfoBlock infoBlock;
+		int nPushed = 0;
+		while (nPushed < kJobCount)
+		{
+			const int nBurst = 1 + (nPushed % 7);
+			for (int i = 0; i < nBurst && nPushed < kJobCount; ++i)
+			{
+				JobManager::SInfoBlock* pSlot = queue.BeginPush();
+				if (!pSlot)
+					break;
+				pSlot->pNext = reinterpret_cast<JobManager::SInfoBlock*>(static_cast<UINT_PTR>(nPushed + 1));
+				queue.EndPush();
+				++nPushed;
+			}
+			if (queue.Pop(infoBlock))
+				takeJob(infoBlock);
+		}
+		while (queue.Pop(infoBlock))
+			takeJob(infoBlock);
+		bPushDone = true;
+
+		for (int i = 0; i < kThiefCount; ++i)
+			thieves[i].reset();
+
+		CRY_UNIT_TEST_CHECK_EQUAL(int(nTakenTotal), kJobCount);
+		for (int i = 0; i < kJobCount; ++i)
+			CRY_UNIT_TEST_CHECK_EQUAL(takenCount[i], 1);
+		CRY_UNIT_TEST_ASSERT(queue.IsEmpty());
+
+		queue.Release();
+	}
+
+	CRY_UNIT_TEST(CUT_JobGraphDependencyOrder)
+	{
+		// more roots than the inline root storage, each later node depends on up to three earlier ones
+		const int kRootCount = 100;
+		const int kNodeCount = 400;
+
+		volatile int nClock = 0;
+		std::vector<int> startTime(kNodeCount, 0);
+		std::vector<int> finishTime(kNodeCount, 0);
+		std::vector<std::pair<int, int>> edges;
+		volatile int nContinuationTime = 0;
+
+		JobManager::CJobGraph graph;
+		for (int i = 0; i < kNodeCount; ++i)
+		{
+			graph.AddJob("UnitTest_JobGraph", [&, i]()
+			{
+				startTime[i] = CryInterlockedIncrement(&nClock);
+				finishTime[i] = CryInterlockedIncrement(&nClock);
+			});
+		}
+		for (int i = kRootCount; i < kNodeCount; ++i)
+		{
+			std::set<int> predecessors;
+			for (int j = 1; j <= 3; ++j)
+				predecessors.insert((i * 7 + j * 13) % i);
+			for (int nPredecessor : predecessors)
+			{
+				graph.AddDependency(nPredecessor, i);
+				edges.push_back(std::make_pair(nPredecessor, i));
+			}
+		}
+		graph.SetContinuation("UnitTest_JobGraphContinuation", [&]()
+		{
+			nContinuationTime = CryInterlockedIncrement(&nClock);
+		});
+
+		JobManager::SJobState graphState;
+		graph.Run(&graphState);
+		gEnv->GetJobManager()->WaitForJob(graphState);
+
+		CRY_UNIT_TEST_ASSERT(!graph.IsRunning());
+		for (const std::pair<int, int>& edge : edges)
+			CRY_UNIT_TEST_ASSERT(finishTime[edge.first] < startTime[edge.second]);
+		for (int i = 0; i < kNodeCount; ++i)
+		{
+			CRY_UNIT_TEST_ASSERT(startTime[i] > 0);
+			CRY_UNIT_TEST_ASSERT(finishTime[i] < nContinuationTime);
+		}
+
+		// an empty graph finishes right away, the graph can be rebuilt after it stopped
+		graph.Reset();
+		graph.Run(&graphState);
+		gEnv->GetJobManager()->WaitForJob(graphState);
+		CRY_UNIT_TEST_ASSERT(!graph.IsRunning());
+	}
+}
+
+#endif // CRY_UNIT_TESTING
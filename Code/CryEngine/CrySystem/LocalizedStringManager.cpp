@@ -38,6 +38,7 @@
 // CVAR names
 const char c_sys_localization_debug[] = "sys_localization_debug";
 const char c_sys_localization_encode[] = "sys_localization_encode";
+const char c_sys_localization_string_tables[] = "sys_localization_string_tables";
 
 enum ELocalizedXmlColumns
 {
@@ -195,12 +196,33 @@ void CLocalizedStringsManager::LocalizationDumpLoadedInfo(IConsoleCmdArgs* pArgs
 
 		// *INDENT-OFF* - Space between closing quote and PRISIZE_T needs to be preserved
 		CryLogAlways("		Entries %d, Approx Size %" PRISIZE_T "Kb", entries, pSizer->GetTotalSize() / 1024);
+
+		if (pLoca->m_pLanguage)
+		{
+			for (const CLocalizedStringTable* pTable : pLoca->m_pLanguage->m_vStringTables)
+			{
+				if (pTable->GetTagID() == tagit->second.id)
+				{
+					CryLogAlways("		String table entries %u, File Size %" PRISIZE_T "Kb (%s), Heap Size %" PRISIZE_T "Kb", pTable->GetEntryCount(),
+					             pTable->GetFileSize() / 1024, pTable->IsMapped() ? "mapped" : "read", pTable->GetHeapSize() / 1024);
+				}
+			}
+		}
 		// *INDENT-ON*
 
 		SAFE_RELEASE(pSizer);
 	}
 }
 
+//////////////////////////////////////////////////////////////////////////
+void CLocalizedStringsManager::BuildStringTables(IConsoleCmdArgs* pArgs)
+{
+	CLocalizedStringsManager* pLoca = (CLocalizedStringsManager*) gEnv->pSystem->GetLocalizationManager();
+
+	const bool bCompress = pArgs->GetArgCount() < 2 || atoi(pArgs->GetArg(1)) != 0;
+	pLoca->WriteStringTables(bCompress);
+}
+
 #endif //#if !defined(_RELEASE)
 
 //////////////////////////////////////////////////////////////////////
@@ -212,6 +234,7 @@ CLocalizedStringsManager::CLocalizedStringsManager(ISystem* pSystem)
 	: m_postProcessors(1)
 	, m_cvarLocalizationDebug(0)
 	, m_cvarLocalizationEncode(1)
+	, m_cvarLocalizationStringTables(1)
 	, m_availableLocalizations(0)
 {
 	m_pSystem = pSystem;
@@ -243,7 +266,18 @@ CLocalizedStringsManager::CLocalizedStringsManager(ISystem* pSystem)
 	               "1: Huffman encode translated text, saves approx 30% with a small runtime performance cost\n"
 	               "Default is 1.");
 
+	REGISTER_CVAR2(c_sys_localization_string_tables, &m_cvarLocalizationStringTables, m_cvarLocalizationStringTables, VF_NULL,
+	               "Loads a localization tag from its packed string table (<language>_xml/<tag>.loctbl) instead of its XML sheets\n"
+	               "if the table exists. Not used in the editor.\n"
+	               "Usage: sys_localization_string_tables [0..1]\n"
+	               "Default is 1.");
+
 	REGISTER_COMMAND("LocalizationDumpLoadedInfo", LocalizationDumpLoadedInfo, VF_NULL, "Dump out into about the loaded localization files");
+	REGISTER_COMMAND("loc_build_string_tables", BuildStringTables, VF_NULL,
+	                 "Writes a packed string table for every tag of the current language loaded from XML and reports the memory\n"
+	                 "the tag takes as loaded entries and as string table.\n"
+	                 "Usage: loc_build_string_tables [compress]\n"
+	                 "compress: 1 = LZ4 compress the text pages (default), 0 = store them");
 #endif //#if !defined(_RELEASE)
 
 	//Check that someone hasn't added a language ID without a language name
@@ -342,6 +376,8 @@ void CLocalizedStringsManager::FreeLocalizationData()
 		std::for_each(pLanguage->m_vLocalizedStrings.begin(), pLanguage->m_vLocalizedStrings.end(), stl::container_object_deleter());
 		pLanguage->m_vLocalizedStrings.clear();
 		pLanguage->m_keysMap.clear();
+		std::for_each(pLanguage->m_vStringTables.begin(), pLanguage->m_vStringTables.end(), stl::container_object_deleter());
+		pLanguage->m_vStringTables.clear();
 	}
 
 	m_loadedTables.clear();
@@ -714,6 +750,12 @@ bool CLocalizedStringsManager::LoadLocalizationDataByTag(
 	}
 
 	bool bResult = true;
+	if (LoadStringTable(sTag, it->second.id))
+	{
+		it->second.loaded = true;
+		return true;
+	}
+
 	stack_string const szLocalizationFolderPath(PathUtil::GetLocalizationFolder() + CRY_NATIVE_PATH_SEPSTR + m_pLanguage->sLanguage + "_xml" + CRY_NATIVE_PATH_SEPSTR);
 	TStringVec& vEntries = it->second.filenames;
 
@@ -769,6 +811,8 @@ bool CLocalizedStringsManager::ReleaseLocalizationDataByTag(
 		//QueryPerformanceCounter(&liStart);
 		AutoLock lock(m_cs);  //Make sure to lock, as this is a modifying operation
 
+		ReleaseStringTables(m_pLanguage, nTagID);
+
 		bool bMapEntryErased = false;
 		//First, remove entries from the map
 		for (StringsKeyMap::iterator keyMapIt = m_pLanguage->m_keysMap.begin(); keyMapIt != m_pLanguage->m_keysMap.end(); )
@@ -1555,11 +1599,29 @@ void CLocalizedStringsManager::ReloadData()
 {
 	tmapFilenames temp = m_loadedTables;
 
+	// the tags loaded from string tables have no files in m_loadedTables
+	TStringVec stringTableTags;
+	if (m_pLanguage)
+	{
+		for (const CLocalizedStringTable* pTable : m_pLanguage->m_vStringTables)
+		{
+			for (TTagFileNames::const_iterator tagIt = m_tagFileNames.begin(); tagIt != m_tagFileNames.end(); ++tagIt)
+			{
+				if (tagIt->second.id == pTable->GetTagID())
+					stringTableTags.push_back(tagIt->first);
+			}
+		}
+	}
+
 	FreeLocalizationData();
 	for (tmapFilenames::iterator it = temp.begin(); it != temp.end(); ++it)
 	{
 		DoLoadExcelXmlSpreadsheet((*it).first, (*it).second.nTagID, true);
 	}
+	for (const string& sTag : stringTableTags)
+	{
+		LoadLocalizationDataByTag(sTag.c_str(), true);
+	}
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -1579,6 +1641,130 @@ void CLocalizedStringsManager::AddLocalizedString(SLanguage* pLanguage, SLocaliz
 		CryLog("<Localization> Add new string <%u> with ID %d to <%s>", keyCRC32, nId, pLanguage->sLanguage.c_str());
 }
 
+//////////////////////////////////////////////////////////////////////////
+string CLocalizedStringsManager::GetStringTableFileName(const char* sTag) const
+{
+	return PathUtil::GetLocalizationFolder() + CRY_NATIVE_PATH_SEPSTR + m_pLanguage->sLanguage + "_xml" + CRY_NATIVE_PATH_SEPSTR + sTag + ".loctbl";
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CLocalizedStringsManager::LoadStringTable(const char* sTag, uint8 nTagID)
+{
+	// the editor needs the original texts and rows, which only the XML sheets have
+	if (!m_pLanguage || !m_cvarLocalizationStringTables || gEnv->IsEditor())
+		return false;
+
+	const string sFileName = GetStringTableFileName(sTag);
+	if (!gEnv->pCryPak->IsFileExist(sFileName.c_str()))
+		return false;
+
+	CLocalizedStringTable* pTable = new CLocalizedStringTable(nTagID);
+	if (!pTable->Open(sFileName.c_str()))
+	{
+		delete pTable;
+		return false;
+	}
+
+	CryLog("Loading Localization String Table %s (%u strings, %" PRISIZE_T " KB, %s)", sFileName.c_str(), pTable->GetEntryCount(),
+	       pTable->GetFileSize() / 1024, pTable->IsMapped() ? "mapped" : "read");
+
+	AutoLock lock(m_cs);  //Make sure to lock, as this is a modifying operation
+	m_pLanguage->m_vStringTables.push_back(pTable);
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLocalizedStringsManager::ReleaseStringTables(SLanguage* pLanguage, uint8 nTagID)
+{
+	SLanguage::TStringTables& tables = pLanguage->m_vStringTables;
+	for (SLanguage::TStringTables::iterator it = tables.begin(); it != tables.end(); )
+	{
+		if ((*it)->GetTagID() == nTagID)
+		{
+			delete *it;
+			it = tables.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+const CLocalizedStringTable::SEntry* CLocalizedStringsManager::FindInStringTables(uint32 keyCRC32, const CLocalizedStringTable*& pOutTable) const
+{
+	for (const CLocalizedStringTable* pTable : m_pLanguage->m_vStringTables)
+	{
+		if (const CLocalizedStringTable::SEntry* pEntry = pTable->Find(keyCRC32))
+		{
+			pOutTable = pTable;
+			return pEntry;
+		}
+	}
+	return nullptr;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLocalizedStringsManager::WriteStringTables(bool bCompress)
+{
+#if !defined(_RELEASE)
+	if (!m_pLanguage)
+		return;
+
+	AutoLock lock(m_cs);
+	for (TTagFileNames::const_iterator tagIt = m_tagFileNames.begin(); tagIt != m_tagFileNames.end(); ++tagIt)
+	{
+		if (!tagIt->second.loaded)
+			continue;
+
+		std::vector<CLocalizedStringTable::SSourceEntry> entries;
+		CrySizerImpl* pSizer = new CrySizerImpl();
+		for (StringsKeyMap::const_iterator it = m_pLanguage->m_keysMap.begin(); it != m_pLanguage->m_keysMap.end(); ++it)
+		{
+			const SLocalizedStringEntry* pEntry = it->second;
+			if (pEntry->nTagID != tagIt->second.id)
+				continue;
+
+			pEntry->GetMemoryUsage(pSizer);
+			pSizer->AddObject(&*it, sizeof(*it));
+
+			entries.resize(entries.size() + 1);
+			CLocalizedStringTable::SSourceEntry& source = entries.back();
+			source.keyCRC = it->first;
+			source.flags = pEntry->flags & ~SLocalizedStringEntry::IS_COMPRESSED;
+			source.text = pEntry->GetTranslatedText(m_pLanguage);
+			source.characterName = pEntry->sCharacterName;
+			source.soundEvent = pEntry->sPrototypeSoundEvent;
+			source.volume = pEntry->fVolume;
+			source.radioRatio = pEntry->fRadioRatio;
+			source.soundMoods = pEntry->SoundMoods;
+			source.eventParameters = pEntry->EventParameters;
+		}
+		const size_t nEntriesSize = pSizer->GetTotalSize();
+		SAFE_RELEASE(pSizer);
+
+		// tags which were loaded from a string table have no entries to write
+		if (entries.empty())
+			continue;
+
+		const string sFileName = GetStringTableFileName(tagIt->first.c_str());
+		if (!CLocalizedStringTable::Write(sFileName.c_str(), entries, bCompress))
+			continue;
+
+		CLocalizedStringTable table(tagIt->second.id);
+		if (!table.Open(sFileName.c_str()))
+			continue;
+
+		// *INDENT-OFF* - Space between closing quote and PRISIZE_T needs to be preserved
+		CryLogAlways("<Localization> Tag %s: %u strings, %" PRISIZE_T " KB as loaded entries, string table %s %" PRISIZE_T " KB file (%s), %" PRISIZE_T " KB heap",
+		             tagIt->first.c_str(), (uint32)entries.size(), nEntriesSize / 1024, sFileName.c_str(), table.GetFileSize() / 1024,
+		             table.IsMapped() ? "mapped" : "read", table.GetHeapSize() / 1024);
+		// *INDENT-ON*
+	}
+#endif //#if !defined(_RELEASE)
+}
+
 //////////////////////////////////////////////////////////////////////////
 bool CLocalizedStringsManager::LocalizeString(const char* sString, string& outLocalizedString, bool bEnglish)
 {
@@ -1801,13 +1987,15 @@ bool CLocalizedStringsManager::LocalizeLabel(const char* sLabel, string& outLoca
 		{
 			AutoLock lock(m_cs);                                                                       //Lock here, to prevent strings etc being modified underneath this lookup
 			SLocalizedStringEntry* entry = stl::find_in_map(m_pLanguage->m_keysMap, labelCRC32, NULL); // skip @ character.
+			const CLocalizedStringTable* pTable = NULL;
+			const CLocalizedStringTable::SEntry* pTableEntry = entry ? NULL : FindInStringTables(labelCRC32, pTable);
 
 			// if it continues with cc_ it's a control code
 			if (sLabel[1] && (sLabel[1] == 'c' || sLabel[1] == 'C') &&
 			    sLabel[2] && (sLabel[2] == 'c' || sLabel[2] == 'C') &&
 			    sLabel[3] && sLabel[3] == '_')
 			{
-				if (entry == NULL)
+				if (entry == NULL && pTableEntry == NULL)
 				{
 					// controlcode
 					// lookup KeyName
@@ -1857,6 +2045,11 @@ bool CLocalizedStringsManager::LocalizeLabel(const char* sLabel, string& outLoca
 				}
 				return true;
 			}
+			else if (pTableEntry != NULL)
+			{
+				pTable->GetText(*pTableEntry, outLocalString);
+				return true;
+			}
 			else
 			{
 				LocalizedStringsManagerWarning(sLabel, "entry not found in string table");
@@ -1938,8 +2131,16 @@ bool CLocalizedStringsManager::GetLocalizedInfoByKey(const char* sKey, SLocalize
 
 			return true;
 		}
-		else
-			return false;
+
+		const CLocalizedStringTable* pTable = NULL;
+		if (const CLocalizedStringTable::SEntry* pTableEntry = FindInStringTables(keyCRC32, pTable))
+		{
+			outGameInfo.szCharacterName = pTable->GetName(pTableEntry->characterName);
+			pTable->GetText(*pTableEntry, outGameInfo.sUtf8TranslatedText);
+			outGameInfo.bUseSubtitle = (pTableEntry->flags & SLocalizedStringEntry::USE_SUBTITLE) != 0;
+			return true;
+		}
+		return false;
 	}
 }
 
@@ -2025,6 +2226,56 @@ bool CLocalizedStringsManager::GetLocalizedInfoByKey(const char* sKey, SLocalize
 				bResult = (pOutSoundInfo->pSoundMoods == NULL); // only report error if memory was provided but is too small
 			}
 		}
+		else
+		{
+			const CLocalizedStringTable* pTable = NULL;
+			if (const CLocalizedStringTable::SEntry* pTableEntry = FindInStringTables(keyCRC32, pTable))
+			{
+				bResult = true;
+
+				pOutSoundInfo->szCharacterName = pTable->GetName(pTableEntry->characterName);
+				pTable->GetText(*pTableEntry, pOutSoundInfo->sUtf8TranslatedText);
+
+				pOutSoundInfo->sSoundEvent = pTable->GetName(pTableEntry->soundEvent);
+				pOutSoundInfo->fVolume = CryConvertHalfToFloat(pTableEntry->volume);
+				pOutSoundInfo->fRadioRatio = CryConvertHalfToFloat(pTableEntry->radioRatio);
+				pOutSoundInfo->bUseSubtitle = (pTableEntry->flags & SLocalizedStringEntry::USE_SUBTITLE) != 0;
+				pOutSoundInfo->bIsDirectRadio = (pTableEntry->flags & SLocalizedStringEntry::IS_DIRECTED_RADIO) != 0;
+				pOutSoundInfo->bIsIntercepted = (pTableEntry->flags & SLocalizedStringEntry::IS_INTERCEPTED) != 0;
+
+				// same rules as above, the arrays are filled if they are large enough, otherwise the needed size is returned
+				const CLocalizedStringTable::SSoundValue* pValues = NULL;
+				const int nNumSoundMoods = (int)pTable->GetSoundMoods(*pTableEntry, pValues);
+				if (pOutSoundInfo->nNumSoundMoods >= nNumSoundMoods)
+				{
+					for (int i = 0; i < pOutSoundInfo->nNumSoundMoods; ++i)
+					{
+						pOutSoundInfo->pSoundMoods[i].sName = i < nNumSoundMoods ? pTable->GetName(pValues[i].name) : "";
+						pOutSoundInfo->pSoundMoods[i].fValue = i < nNumSoundMoods ? pValues[i].value : 0.0f;
+					}
+				}
+				else
+				{
+					bResult = (pOutSoundInfo->pSoundMoods == NULL);
+				}
+				pOutSoundInfo->nNumSoundMoods = nNumSoundMoods;
+
+				const int nNumEventParameters = (int)pTable->GetEventParameters(*pTableEntry, pValues);
+				if (pOutSoundInfo->nNumEventParameters >= nNumEventParameters)
+				{
+					for (int i = 0; i < pOutSoundInfo->nNumEventParameters; ++i)
+					{
+						pOutSoundInfo->pEventParameters[i].sName = i < nNumEventParameters ? pTable->GetName(pValues[i].name) : "";
+						pOutSoundInfo->pEventParameters[i].fValue = i < nNumEventParameters ? pValues[i].value : 0.0f;
+					}
+				}
+				else
+				{
+					bResult = (pOutSoundInfo->pSoundMoods == NULL);
+				}
+				pOutSoundInfo->nNumEventParameters = nNumEventParameters;
+			}
+		}
 	}
 
 	return bResult;
@@ -2035,7 +2286,11 @@ int CLocalizedStringsManager::GetLocalizedStringCount()
 {
 	if (!m_pLanguage)
 		return 0;
-	return m_pLanguage->m_vLocalizedStrings.size();
+
+	int nCount = m_pLanguage->m_vLocalizedStrings.size();
+	for (const CLocalizedStringTable* pTable : m_pLanguage->m_vStringTables)
+		nCount += pTable->GetEntryCount();
+	return nCount;
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -2044,8 +2299,27 @@ bool CLocalizedStringsManager::GetLocalizedInfoByIndex(int nIndex, SLocalizedInf
 	if (!m_pLanguage)
 		return false;
 	const std::vector<SLocalizedStringEntry*>& entryVec = m_pLanguage->m_vLocalizedStrings;
-	if (nIndex < 0 || nIndex >= (int)entryVec.size())
+	if (nIndex < 0)
 		return false;
+
+	// the string table entries are counted after the loaded ones
+	if (nIndex >= (int)entryVec.size())
+	{
+		AutoLock lock(m_cs);
+		uint32 nTableIndex = nIndex - entryVec.size();
+		for (const CLocalizedStringTable* pTable : m_pLanguage->m_vStringTables)
+		{
+			if (const CLocalizedStringTable::SEntry* pTableEntry = pTable->GetEntry(nTableIndex))
+			{
+				outGameInfo.szCharacterName = pTable->GetName(pTableEntry->characterName);
+				pTable->GetText(*pTableEntry, outGameInfo.sUtf8TranslatedText);
+				outGameInfo.bUseSubtitle = (pTableEntry->flags & SLocalizedStringEntry::USE_SUBTITLE) != 0;
+				return true;
+			}
+			nTableIndex -= pTable->GetEntryCount();
+		}
+		return false;
+	}
 	const SLocalizedStringEntry* pEntry = entryVec[nIndex];
 
 	outGameInfo.szCharacterName = pEntry->sCharacterName;
@@ -2121,6 +2395,16 @@ bool CLocalizedStringsManager::GetSubtitle(const char* sKeyOrLabel, string& outS
 			}
 			return true;
 		}
+
+		const CLocalizedStringTable* pTable = NULL;
+		if (const CLocalizedStringTable::SEntry* pTableEntry = FindInStringTables(keyCRC32, pTable))
+		{
+			if ((pTableEntry->flags & SLocalizedStringEntry::USE_SUBTITLE) == 0 && !bForceSubtitle)
+				return false;
+
+			pTable->GetText(*pTableEntry, outSubtitle);
+			return true;
+		}
 		return false;
 	}
 }
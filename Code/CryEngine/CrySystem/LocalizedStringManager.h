@@ -21,6 +21,7 @@
 #include <CryCore/Containers/CryListenerSet.h>
 
 #include "Huffman.h"
+#include "LocalizedStringTable.h"
 
 //////////////////////////////////////////////////////////////////////////
 /*
@@ -90,6 +91,7 @@ public:
 
 #if !defined(_RELEASE)
 	static void LocalizationDumpLoadedInfo(IConsoleCmdArgs* pArgs);
+	static void BuildStringTables(IConsoleCmdArgs* pArgs);
 #endif //#if !defined(_RELEASE)
 
 private:
@@ -220,11 +222,13 @@ private:
 	{
 		typedef std::vector<SLocalizedStringEntry*> TLocalizedStringEntries;
 		typedef std::vector<HuffmanCoder*>          THuffmanCoders;
+		typedef std::vector<CLocalizedStringTable*> TStringTables;
 
 		string                  sLanguage;
 		StringsKeyMap           m_keysMap;
 		TLocalizedStringEntries m_vLocalizedStrings;
 		THuffmanCoders          m_vEncoders;
+		TStringTables           m_vStringTables; // tags loaded from packed string tables instead of XML
 
 		void                    GetMemoryUsage(ICrySizer* pSizer) const
 		{
@@ -233,6 +237,7 @@ private:
 			pSizer->AddObject(m_vLocalizedStrings);
 			pSizer->AddObject(m_keysMap);
 			pSizer->AddObject(m_vEncoders);
+			pSizer->AddObject(m_vStringTables);
 		}
 	};
 
@@ -254,6 +259,13 @@ private:
 #endif
 
 	void AddLocalizedString(SLanguage* pLanguage, SLocalizedStringEntry* pEntry, const uint32 keyCRC32);
+
+	string                               GetStringTableFileName(const char* sTag) const;
+	bool                                 LoadStringTable(const char* sTag, uint8 nTagID);
+	void                                 ReleaseStringTables(SLanguage* pLanguage, uint8 nTagID);
+	// Looks up keys of the tags which were loaded from string tables, m_cs has to be locked.
+	const CLocalizedStringTable::SEntry* FindInStringTables(uint32 keyCRC32, const CLocalizedStringTable*& pOutTable) const;
+	void                                 WriteStringTables(bool bCompress);
 	void AddControl(int nKey);
 	//////////////////////////////////////////////////////////////////////////
 	void ParseFirstLine(IXmlTableReader* pXmlTableReader, char* nCellIndexToType, std::map<int, string>& SoundMoodIndex, std::map<int, string>& EventParameterIndex);
@@ -302,6 +314,7 @@ private:
 	// CVARs
 	int m_cvarLocalizationDebug;
 	int m_cvarLocalizationEncode; //Encode/Compress translated text to save memory
+	int m_cvarLocalizationStringTables; //Load tags from packed string tables where available
 
 	//The localizations that are available for this SKU. Used for determining what to show on a language select screen or whether to show one at all
 	TLocalizationBitfield m_availableLocalizations;
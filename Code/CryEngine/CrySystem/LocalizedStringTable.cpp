@@ -0,0 +1,404 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "StdAfx.h"
+#include "LocalizedStringTable.h"
+#include "ZipDirFileMapping.h"
+#include "CryPak.h"
+#include <lz4.h>
+
+namespace
+{
+inline size_t AlignTo(size_t nSize, size_t nAlign)
+{
+	return (nSize + nAlign - 1) / nAlign * nAlign;
+}
+
+struct SEntryKeyLess
+{
+	bool operator()(const CLocalizedStringTable::SEntry& entry, uint32 keyCRC) const { return entry.keyCRC < keyCRC; }
+};
+
+class CNamesWriter
+{
+public:
+	uint32 Add(const string& name)
+	{
+		if (name.empty())
+			return CLocalizedStringTable::NO_OFFSET;
+
+		std::map<string, uint32>::const_iterator it = m_offsets.find(name);
+		if (it != m_offsets.end())
+			return it->second;
+
+		const uint32 nOffset = (uint32)m_data.size();
+		m_data.insert(m_data.end(), name.c_str(), name.c_str() + name.length() + 1);
+		m_offsets[name] = nOffset;
+		return nOffset;
+	}
+
+	uint32 AddSoundValues(const DynArray<SLocalizedAdvancesSoundEntry>& moods, const DynArray<SLocalizedAdvancesSoundEntry>& parameters)
+	{
+		if (moods.empty() && parameters.empty())
+			return CLocalizedStringTable::NO_OFFSET;
+
+		std::vector<CLocalizedStringTable::SSoundValue> values;
+		values.reserve(moods.size() + parameters.size());
+		for (const SLocalizedAdvancesSoundEntry& mood : moods)
+			values.push_back({ Add(mood.sName), mood.fValue });
+		for (const SLocalizedAdvancesSoundEntry& parameter : parameters)
+			values.push_back({ Add(parameter.sName), parameter.fValue });
+
+		m_data.resize(AlignTo(m_data.size(), 4), 0);
+		const uint32 nOffset = (uint32)m_data.size();
+		const uint16 counts[2] = { (uint16)moods.size(), (uint16)parameters.size() };
+		const char* const pCounts = reinterpret_cast<const char*>(counts);
+		const char* const pValues = reinterpret_cast<const char*>(&values[0]);
+		m_data.insert(m_data.end(), pCounts, pCounts + sizeof(counts));
+		m_data.insert(m_data.end(), pValues, pValues + values.size() * sizeof(values[0]));
+		return nOffset;
+	}
+
+	std::vector<char>& GetData() { return m_data; }
+
+private:
+	std::vector<char>        m_data;
+	std::map<string, uint32> m_offsets;
+};
+}
+
+//////////////////////////////////////////////////////////////////////////
+CLocalizedStringTable::CLocalizedStringTable(uint8 nTagID)
+	: m_nTagID(nTagID)
+	, m_pData(nullptr)
+	, m_nFileSize(0)
+	, m_pHeader(nullptr)
+	, m_pEntries(nullptr)
+	, m_pPages(nullptr)
+	, m_pNames(nullptr)
+	, m_nCachedPage(NO_OFFSET)
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+CLocalizedStringTable::~CLocalizedStringTable()
+{
+	if (m_pMapping)
+		m_pMapping->RemoveView(m_nFileSize);
+}
+
+//////////////////////////////////////////////////////////////////////////
+size_t CLocalizedStringTable::Write(const char* szFileName, std::vector<SSourceEntry>& entries, bool bCompress)
+{
+	std::sort(entries.begin(), entries.end(), [](const SSourceEntry& a, const SSourceEntry& b) { return a.keyCRC < b.keyCRC; });
+
+	std::vector<SEntry> fileEntries(entries.size());
+	std::vector<char> text;
+	CNamesWriter names;
+
+	// the names go first, the sound value records after them need to be aligned
+	for (size_t i = 0; i < entries.size(); ++i)
+	{
+		fileEntries[i].characterName = names.Add(entries[i].characterName);
+		fileEntries[i].soundEvent = names.Add(entries[i].soundEvent);
+	}
+
+	for (size_t i = 0; i < entries.size(); ++i)
+	{
+		const SSourceEntry& source = entries[i];
+		SEntry& entry = fileEntries[i];
+		entry.keyCRC = source.keyCRC;
+		entry.flags = source.flags;
+		entry.volume = source.volume;
+		entry.radioRatio = source.radioRatio;
+		memset(entry.padding, 0, sizeof(entry.padding));
+		entry.soundValues = names.AddSoundValues(source.soundMoods, source.eventParameters);
+
+		entry.text = NO_OFFSET;
+		entry.textLength = 0;
+		if (source.text.empty())
+			continue;
+
+		uint32 nLength = (uint32)source.text.length();
+		if (nLength >= PAGE_SIZE)
+		{
+			CryWarning(VALIDATOR_MODULE_SYSTEM, VALIDATOR_WARNING, "[LocError] String table %s: text of key %08x is longer than a page and got truncated", szFileName, source.keyCRC);
+			nLength = PAGE_SIZE - 1;
+		}
+
+		// a text never crosses a page, so reading it touches a single page
+		if (text.size() / PAGE_SIZE != (text.size() + nLength) / PAGE_SIZE)
+			text.resize(AlignTo(text.size(), PAGE_SIZE), 0);
+
+		entry.text = (uint32)text.size();
+		entry.textLength = nLength;
+		text.insert(text.end(), source.text.c_str(), source.text.c_str() + nLength);
+		text.push_back(0);
+	}
+
+	std::vector<char>& namesData = names.GetData();
+	namesData.resize(AlignTo(namesData.size(), 4), 0);
+
+	const uint32 numPages = (uint32)((text.size() + PAGE_SIZE - 1) / PAGE_SIZE);
+
+	SHeader header;
+	header.magic = FILE_MAGIC;
+	header.version = FILE_VERSION;
+	header.numEntries = (uint32)fileEntries.size();
+	header.numPages = numPages;
+	header.namesOffset = (uint32)(sizeof(SHeader) + fileEntries.size() * sizeof(SEntry) + numPages * sizeof(SPage));
+	header.namesSize = (uint32)namesData.size();
+	header.textSize = (uint32)text.size();
+	header.flags = 0;
+
+	std::vector<SPage> pages(numPages);
+	std::vector<char> pageData;
+	std::vector<char> compressed(LZ4_compressBound(PAGE_SIZE));
+	uint32 nOffset = header.namesOffset + header.namesSize;
+	for (uint32 i = 0; i < numPages; ++i)
+	{
+		const char* const pPage = &text[i * PAGE_SIZE];
+		const int nPageSize = (int)min(text.size() - i * PAGE_SIZE, (size_t)PAGE_SIZE);
+		const int nCompressed = bCompress ? LZ4_compress_default(pPage, &compressed[0], nPageSize, (int)compressed.size()) : 0;
+
+		// pages that don't get smaller are stored
+		pages[i].offset = nOffset;
+		if (nCompressed > 0 && nCompressed < nPageSize)
+		{
+			pages[i].storedSize = nCompressed;
+			pageData.insert(pageData.end(), &compressed[0], &compressed[0] + nCompressed);
+		}
+		else
+		{
+			pages[i].storedSize = nPageSize;
+			pageData.insert(pageData.end(), pPage, pPage + nPageSize);
+		}
+		nOffset += pages[i].storedSize;
+	}
+
+	ICryPak* const pPak = gEnv->pCryPak;
+	FILE* const pFile = pPak->FOpen(szFileName, "wb");
+	if (!pFile)
+	{
+		CryWarning(VALIDATOR_MODULE_SYSTEM, VALIDATOR_WARNING, "[LocError] Can't write string table %s", szFileName);
+		return 0;
+	}
+
+	bool bResult = pPak->FWrite(&header, sizeof(header), 1, pFile) == 1;
+	if (!fileEntries.empty())
+		bResult &= pPak->FWrite(&fileEntries[0], sizeof(SEntry), fileEntries.size(), pFile) == fileEntries.size();
+	if (!pages.empty())
+		bResult &= pPak->FWrite(&pages[0], sizeof(SPage), pages.size(), pFile) == pages.size();
+	if (!namesData.empty())
+		bResult &= pPak->FWrite(&namesData[0], 1, namesData.size(), pFile) == namesData.size();
+	if (!pageData.empty())
+		bResult &= pPak->FWrite(&pageData[0], 1, pageData.size(), pFile) == pageData.size();
+	pPak->FClose(pFile);
+
+	if (!bResult)
+	{
+		CryWarning(VALIDATOR_MODULE_SYSTEM, VALIDATOR_WARNING, "[LocError] Writing string table %s failed", szFileName);
+		return 0;
+	}
+
+	return nOffset;
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CLocalizedStringTable::Open(const char* szFileName)
+{
+	LOADING_TIME_PROFILE_SECTION_ARGS(szFileName);
+
+	ICryPak* const pPak = gEnv->pCryPak;
+	FILE* const pFile = pPak->FOpen(szFileName, "rb");
+	if (!pFile)
+		return false;
+
+	m_nFileSize = pPak->FGetSize(pFile);
+	if (m_nFileSize < sizeof(SHeader))
+	{
+		pPak->FClose(pFile);
+		return false;
+	}
+
+	// use the file in place where possible, the data has to be aligned for the entry table
+	if (pPak->IsInPak(pFile))
+	{
+		CCryPak* const pCryPak = static_cast<CCryPak*>(pPak);
+		CCachedFileDataPtr pFileData = pCryPak->GetPakVars()->nMapStoredFiles ? pCryPak->GetOpenedFileDataInZip(pFile) : CCachedFileDataPtr();
+		if (pFileData && pFileData->m_pFileMapping && pFileData->GetFileEntry() && pFileData->GetFileEntry()->nMethod == ZipFile::METHOD_STORE)
+		{
+			const uint8* const pData = static_cast<const uint8*>(pFileData->GetData());
+			if (pData && ((UINT_PTR)pData & 3) == 0)
+			{
+				m_pPakData = pFileData.get();
+				m_pData = pData;
+			}
+		}
+	}
+	else if (ZipDir::CFileMapping* pMapping = ZipDir::CFileMapping::Create(pFile, (int64)m_nFileSize))
+	{
+		m_pMapping = pMapping;
+		m_pMapping->AddView(m_nFileSize);
+		m_pData = m_pMapping->GetData();
+	}
+
+	if (!m_pData)
+	{
+		m_fileData.resize(m_nFileSize);
+		if (pPak->FReadRaw(&m_fileData[0], 1, m_nFileSize, pFile) != m_nFileSize)
+		{
+			pPak->FClose(pFile);
+			return false;
+		}
+		m_pData = &m_fileData[0];
+	}
+	pPak->FClose(pFile);
+
+	m_pHeader = reinterpret_cast<const SHeader*>(m_pData);
+	if (!Validate())
+	{
+		CryWarning(VALIDATOR_MODULE_SYSTEM, VALIDATOR_WARNING, "[LocError] String table %s is corrupt or of an unsupported version", szFileName);
+		m_pHeader = nullptr;
+		return false;
+	}
+
+	m_pEntries = reinterpret_cast<const SEntry*>(m_pData + sizeof(SHeader));
+	m_pPages = reinterpret_cast<const SPage*>(m_pEntries + m_pHeader->numEntries);
+	m_pNames = reinterpret_cast<const char*>(m_pData + m_pHeader->namesOffset);
+
+	for (uint32 i = 0; i < m_pHeader->numPages; ++i)
+	{
+		if (m_pPages[i].storedSize != min(m_pHeader->textSize - i * PAGE_SIZE, (uint32)PAGE_SIZE))
+		{
+			m_pageCache.resize(PAGE_SIZE);
+			break;
+		}
+	}
+
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CLocalizedStringTable::Validate() const
+{
+	const SHeader& header = *m_pHeader;
+	if (header.magic != FILE_MAGIC || header.version != FILE_VERSION)
+		return false;
+
+	const uint64 nTablesEnd = sizeof(SHeader) + (uint64)header.numEntries * sizeof(SEntry) + (uint64)header.numPages * sizeof(SPage);
+	if (nTablesEnd > header.namesOffset || (uint64)header.namesOffset + header.namesSize > m_nFileSize)
+		return false;
+	if ((uint64)header.numPages * PAGE_SIZE < header.textSize || (uint64)header.numPages * PAGE_SIZE >= (uint64)header.textSize + PAGE_SIZE)
+		return false;
+
+	const SPage* const pPages = reinterpret_cast<const SPage*>(m_pData + sizeof(SHeader) + header.numEntries * sizeof(SEntry));
+	for (uint32 i = 0; i < header.numPages; ++i)
+	{
+		if ((uint64)pPages[i].offset + pPages[i].storedSize > m_nFileSize || pPages[i].storedSize > PAGE_SIZE)
+			return false;
+	}
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+const CLocalizedStringTable::SEntry* CLocalizedStringTable::GetEntry(uint32 nIndex) const
+{
+	return nIndex < GetEntryCount() ? &m_pEntries[nIndex] : nullptr;
+}
+
+//////////////////////////////////////////////////////////////////////////
+const CLocalizedStringTable::SEntry* CLocalizedStringTable::Find(uint32 keyCRC) const
+{
+	if (!m_pHeader)
+		return nullptr;
+
+	const SEntry* const pEnd = m_pEntries + m_pHeader->numEntries;
+	const SEntry* const pEntry = std::lower_bound(m_pEntries, pEnd, keyCRC, SEntryKeyLess());
+	return (pEntry != pEnd && pEntry->keyCRC == keyCRC) ? pEntry : nullptr;
+}
+
+//////////////////////////////////////////////////////////////////////////
+const char* CLocalizedStringTable::GetPage(uint32 nPage) const
+{
+	if (nPage >= m_pHeader->numPages)
+		return nullptr;
+
+	const SPage& page = m_pPages[nPage];
+	const uint32 nPageSize = min(m_pHeader->textSize - nPage * PAGE_SIZE, (uint32)PAGE_SIZE);
+	const char* const pStored = reinterpret_cast<const char*>(m_pData + page.offset);
+	if (page.storedSize == nPageSize)
+		return pStored;
+
+	if (m_nCachedPage != nPage)
+	{
+		m_nCachedPage = NO_OFFSET;
+		if (LZ4_decompress_safe(pStored, &m_pageCache[0], page.storedSize, nPageSize) != (int)nPageSize)
+			return nullptr;
+		m_nCachedPage = nPage;
+	}
+	return &m_pageCache[0];
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLocalizedStringTable::GetText(const SEntry& entry, string& outText) const
+{
+	const char* const pPage = entry.text != NO_OFFSET ? GetPage(entry.text / PAGE_SIZE) : nullptr;
+	const uint32 nInPage = entry.text % PAGE_SIZE;
+	if (pPage && nInPage + entry.textLength < PAGE_SIZE)
+		outText.assign(pPage + nInPage, entry.textLength);
+	else
+		outText.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////
+const char* CLocalizedStringTable::GetName(uint32 nOffset) const
+{
+	return (m_pHeader && nOffset < m_pHeader->namesSize) ? m_pNames + nOffset : "";
+}
+
+//////////////////////////////////////////////////////////////////////////
+const uint16* CLocalizedStringTable::GetSoundValueCounts(const SEntry& entry) const
+{
+	if (entry.soundValues == NO_OFFSET || (uint64)entry.soundValues + 2 * sizeof(uint16) > m_pHeader->namesSize)
+		return nullptr;
+
+	const uint16* const pCounts = reinterpret_cast<const uint16*>(m_pNames + entry.soundValues);
+	const uint64 nEnd = (uint64)entry.soundValues + 2 * sizeof(uint16) + (uint64)(pCounts[0] + pCounts[1]) * sizeof(SSoundValue);
+	return nEnd <= m_pHeader->namesSize ? pCounts : nullptr;
+}
+
+//////////////////////////////////////////////////////////////////////////
+uint32 CLocalizedStringTable::GetSoundMoods(const SEntry& entry, const SSoundValue*& pValues) const
+{
+	const uint16* const pCounts = GetSoundValueCounts(entry);
+	if (!pCounts)
+		return 0;
+
+	pValues = reinterpret_cast<const SSoundValue*>(pCounts + 2);
+	return pCounts[0];
+}
+
+//////////////////////////////////////////////////////////////////////////
+uint32 CLocalizedStringTable::GetEventParameters(const SEntry& entry, const SSoundValue*& pValues) const
+{
+	const uint16* const pCounts = GetSoundValueCounts(entry);
+	if (!pCounts)
+		return 0;
+
+	pValues = reinterpret_cast<const SSoundValue*>(pCounts + 2) + pCounts[0];
+	return pCounts[1];
+}
+
+//////////////////////////////////////////////////////////////////////////
+size_t CLocalizedStringTable::GetHeapSize() const
+{
+	return sizeof(*this) + m_fileData.capacity() + m_pageCache.capacity();
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLocalizedStringTable::GetMemoryUsage(ICrySizer* pSizer) const
+{
+	pSizer->AddObject(this, sizeof(*this));
+	pSizer->AddObject(m_fileData);
+	pSizer->AddObject(m_pageCache);
+}
@@ -0,0 +1,139 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#pragma once
+
+#include <CrySystem/ILocalizationManager.h>
+
+namespace ZipDir
+{
+class CFileMapping;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Packed, read-only string table holding the localized strings of one localization tag.
+// It's built from the entries loaded from the tag's Excel XML sheets (loc_build_string_tables) and saved as
+// <language>_xml/<tag>.loctbl. The loaded table is used in place, a loose file or a file stored in a mapped
+// pak is memory mapped, anything else is read with a single allocation. Lookups by label CRC are a binary
+// search over the entry table and never allocate.
+//
+// File layout, little endian:
+//   SHeader
+//   SEntry[numEntries]   sorted by key CRC
+//   SPage[numPages]
+//   names section        character names, sound events and sound value names, NUL terminated, followed by the
+//                        sound value records of the entries { uint16 numMoods, uint16 numParameters,
+//                        SSoundValue[numMoods + numParameters] }; never compressed so pointers into it stay valid
+//   text pages           the translated texts, NUL terminated, a text never crosses a page. A page is stored
+//                        if its stored size equals its uncompressed size, otherwise it's a LZ4 block.
+//////////////////////////////////////////////////////////////////////////
+class CLocalizedStringTable
+{
+public:
+	enum
+	{
+		FILE_MAGIC   = 0x4254534c, // 'LSTB'
+		FILE_VERSION = 1,
+		PAGE_SIZE    = 16 * 1024,
+		NO_OFFSET    = 0xffffffff
+	};
+
+	struct SHeader
+	{
+		uint32 magic;
+		uint32 version;
+		uint32 numEntries;
+		uint32 numPages;
+		uint32 namesOffset;
+		uint32 namesSize;
+		uint32 textSize;    // uncompressed size of all text pages
+		uint32 flags;       // unused
+	};
+
+	struct SEntry
+	{
+		uint32  keyCRC;
+		uint32  text;          // offset in the uncompressed text pages
+		uint32  textLength;
+		uint32  characterName; // offset in the names section or NO_OFFSET, same for the next two
+		uint32  soundEvent;
+		uint32  soundValues;
+		CryHalf volume;
+		CryHalf radioRatio;
+		uint8   flags;         // CLocalizedStringsManager::SLocalizedStringEntry flags
+		uint8   padding[3];
+	};
+
+	struct SPage
+	{
+		uint32 offset;         // in the file
+		uint32 storedSize;
+	};
+
+	struct SSoundValue
+	{
+		uint32 name;           // offset in the names section
+		float  value;
+	};
+
+	// Input for Write().
+	struct SSourceEntry
+	{
+		uint32                                 keyCRC;
+		uint8                                  flags;
+		string                                 text;
+		string                                 characterName;
+		string                                 soundEvent;
+		CryHalf                                volume;
+		CryHalf                                radioRatio;
+		DynArray<SLocalizedAdvancesSoundEntry> soundMoods;
+		DynArray<SLocalizedAdvancesSoundEntry> eventParameters;
+	};
+
+	explicit CLocalizedStringTable(uint8 nTagID);
+	~CLocalizedStringTable();
+
+	// Writes a table of the entries, which are sorted by key on the way. Returns the file size, 0 on failure.
+	static size_t Write(const char* szFileName, std::vector<SSourceEntry>& entries, bool bCompress);
+
+	bool          Open(const char* szFileName);
+
+	uint8         GetTagID() const      { return m_nTagID; }
+	uint32        GetEntryCount() const { return m_pHeader ? m_pHeader->numEntries : 0; }
+	const SEntry* GetEntry(uint32 nIndex) const;
+	const SEntry* Find(uint32 keyCRC) const;
+
+	// Not thread safe for compressed tables, the last decompressed page is cached.
+	void          GetText(const SEntry& entry, string& outText) const;
+	// Returns "" for NO_OFFSET, the string lives as long as the table.
+	const char*   GetName(uint32 nOffset) const;
+	uint32        GetSoundMoods(const SEntry& entry, const SSoundValue*& pValues) const;
+	uint32        GetEventParameters(const SEntry& entry, const SSoundValue*& pValues) const;
+
+	size_t        GetFileSize() const { return m_nFileSize; }
+	// memory the table allocated, the mapped file data is not included
+	size_t        GetHeapSize() const;
+	bool          IsMapped() const    { return m_fileData.empty() && m_pData != nullptr; }
+
+	void          GetMemoryUsage(ICrySizer* pSizer) const;
+
+private:
+	bool          Validate() const;
+	const char*   GetPage(uint32 nPage) const;
+	const uint16* GetSoundValueCounts(const SEntry& entry) const;
+
+	uint8                             m_nTagID;
+	const uint8*                      m_pData;
+	size_t                            m_nFileSize;
+	const SHeader*                    m_pHeader;
+	const SEntry*                     m_pEntries;
+	const SPage*                      m_pPages;
+	const char*                       m_pNames;
+
+	// exactly one of these holds the file data
+	_smart_ptr<_i_reference_target_t> m_pPakData;
+	_smart_ptr<ZipDir::CFileMapping>  m_pMapping;
+	std::vector<uint8>                m_fileData;
+
+	mutable std::vector<char>         m_pageCache;
+	mutable uint32                    m_nCachedPage;
+};
@@ -37,7 +37,7 @@
 #define LOG_EXCLUSIVE_ACCESS_SINGLE_WRITER_LOCK_VALUE (uint32)BIT(31) // sets last bit to indicate readers must wait on writer
 
 //////////////////////////////////////////////////////////////////////////
-ILINE void LockNoneExclusiveAccess(SExclusiveThreadAccessLock* pExclusiveLock)
+void LockNoneExclusiveAccess(SExclusiveThreadAccessLock* pExclusiveLock)
 {
 	const threadID nCurrentThreadId = CryGetCurrentThreadId();
 
@@ -62,7 +62,7 @@ ILINE void LockNoneExclusiveAccess(SExclusiveThreadAccessLock* pExclusiveLock)
 }
 
 //////////////////////////////////////////////////////////////////////////
-ILINE void UnlockNoneExclusiveAccess(SExclusiveThreadAccessLock* pExclusiveLock)
+void UnlockNoneExclusiveAccess(SExclusiveThreadAccessLock* pExclusiveLock)
 {
 	CryInterlockedDecrement(alias_cast<volatile int*>(&pExclusiveLock->counter));
 }
@@ -143,6 +143,7 @@ CLog::CLog(ISystem* pSystem)
 	, m_pLogSpamDelay(nullptr)
 	, m_pLogModule(nullptr)
 	, m_eLogMode(eLogMode_Normal)
+	, m_asyncWriter(&m_exclusiveLogFileThreadAccessLock)
 {
 	memset(m_szFilename, 0, MAX_FILENAME_SIZE);
 	memset(m_sBackupFilename, 0, MAX_FILENAME_SIZE);
@@ -208,6 +209,9 @@ void CLog::RegisterConsoleVariables()
 
 		REGISTER_CVAR2("log_tick", &LogCVars::s_log_tick, LogCVars::s_log_tick, 0, "When not 0, writes tick log entry into the log file, every N seconds");
 
+		CLogAsyncWriter::RegisterCVars();
+		REGISTER_COMMAND("log_AsyncStats", &LogAsyncStats, 0, "Logs the written, dropped and truncated message counts of the asynchronous log writer (log_Async)");
+
 #if KEEP_LOG_FILE_OPEN
 		REGISTER_COMMAND("log_flush", &LogFlushFile, 0, "Flush the log file");
 #endif
@@ -247,6 +251,8 @@ void CLog::RegisterConsoleVariables()
 //////////////////////////////////////////////////////////////////////
 CLog::~CLog()
 {
+	m_asyncWriter.Shutdown();
+
 #if defined(SUPPORT_LOG_IDENTER)
 	while (m_topIndenter)
 	{
@@ -1014,10 +1020,24 @@ void CLog::LogStringToFile(const char* szString, bool bAdd, bool bError)
 	//////////////////////////////////////////////////////////////////////////
 	int logToFile = m_pLogWriteToFile ? m_pLogWriteToFile->GetIVal() : 1;
 
-	if (logToFile)
+	// Hand the line to the writer thread, a crashing application writes straight to the file
+	if (logToFile && m_eLogMode != eLogMode_AppCrash && CLogAsyncWriter::IsEnabled() && m_asyncWriter.Start())
+	{
+	#if KEEP_LOG_FILE_OPEN
+		if (m_pLogFile)
+		{
+			CloseLogFile(true);
+		}
+	#endif
+		m_asyncWriter.Push(tempString.c_str(), tempString.length(), bAdd);
+	}
+	else if (logToFile)
 	{
 		SCOPED_ALLOW_FILE_ACCESS_FROM_THIS_THREAD();
 
+		// write out what is still pending before writing synchronously again
+		m_asyncWriter.Close();
+
 	#if KEEP_LOG_FILE_OPEN
 		if (!m_pLogFile)
 		{
@@ -1329,6 +1349,7 @@ bool CLog::SetFileName(const char* filename)
 		return false;
 
 	cry_strcpy(m_szFilename, temp.c_str());
+	m_asyncWriter.SetFileName(m_szFilename);
 
 	CreateBackupFile();
 
@@ -1489,6 +1510,7 @@ const char* CLog::GetModuleFilter()
 void CLog::Flush()
 {
 	Update();
+	m_asyncWriter.Flush();
 #if KEEP_LOG_FILE_OPEN
 	if (m_pLogFile)
 	{
@@ -1500,6 +1522,7 @@ void CLog::Flush()
 void CLog::FlushAndClose()
 {
 	Update();
+	m_asyncWriter.Close();
 #if KEEP_LOG_FILE_OPEN
 	if (m_pLogFile)
 	{
@@ -1508,6 +1531,16 @@ void CLog::FlushAndClose()
 #endif
 }
 
+void CLog::LogAsyncStats(IConsoleCmdArgs* pArgs)
+{
+	CLogAsyncWriter::SStats stats;
+	static_cast<CLog*>(gEnv->pLog)->m_asyncWriter.GetStats(stats);
+
+	CryLogAlways("Asynchronous log writer (log_Async %d): %u messages written, %u dropped (buffer full), %u truncated, %u rotations",
+	             CLogAsyncWriter::IsEnabled() ? 1 : 0, stats.nWritten, stats.nDropped, stats.nTruncated, stats.nRotations);
+	CryLogAlways("  %u of %u records pending, peak %u", stats.nPending, stats.nCapacity, stats.nPeakPending);
+}
+
 #if KEEP_LOG_FILE_OPEN
 void CLog::LogFlushFile(IConsoleCmdArgs* pArgs)
 {
@@ -1517,6 +1550,10 @@ void CLog::LogFlushFile(IConsoleCmdArgs* pArgs)
 
 void CLog::SetLogMode(ELogMode eLogMode)
 {
+	// from now on the crashing thread writes synchronously, the lines that are still in the ring go first
+	if (eLogMode == eLogMode_AppCrash)
+		m_asyncWriter.Close();
+
 	m_eLogMode = eLogMode;
 }
 
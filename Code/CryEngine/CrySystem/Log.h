@@ -5,6 +5,7 @@
 #include <CrySystem/ILog.h>
 #include <CryThreading/CryAtomics.h>
 #include <CryThreading/MultiThread_Containers.h>
+#include "LogAsyncWriter.h"
 
 //////////////////////////////////////////////////////////////////////
 
@@ -23,6 +24,10 @@ struct SExclusiveThreadAccessLock
 	volatile threadID writerThreadId;
 };
 
+// Shared access to the log file, waits while a thread holds the exclusive access (ThreadExclusiveLogAccess).
+void LockNoneExclusiveAccess(SExclusiveThreadAccessLock* pExclusiveLock);
+void UnlockNoneExclusiveAccess(SExclusiveThreadAccessLock* pExclusiveLock);
+
 //////////////////////////////////////////////////////////////////////
 class CLog : public ILog
 {
@@ -153,6 +158,8 @@ private: // -------------------------------------------------------------------
 	SLogHistoryItem m_history[16];
 	int             m_iLastHistoryItem;
 
+	static void LogAsyncStats(IConsoleCmdArgs* pArgs);
+
 #if KEEP_LOG_FILE_OPEN
 	static void LogFlushFile(IConsoleCmdArgs* pArgs);
 
@@ -171,6 +178,7 @@ public: // -------------------------------------------------------------------
 		pSizer->AddObject(m_pLogVerbosityOverridesWriteToFile);
 		pSizer->AddObject(m_pLogSpamDelay);
 		pSizer->AddObject(m_threadSafeMsgQueue);
+		m_asyncWriter.GetMemoryUsage(pSizer);
 	}
 	// checks the verbosity of the message and returns NULL if the message must NOT be
 	// logged, or the pointer to the part of the message that should be logged
@@ -201,4 +209,5 @@ public: // -------------------------------------------------------------------
 
 	ELogMode                           m_eLogMode;
 	mutable SExclusiveThreadAccessLock m_exclusiveLogFileThreadAccessLock;
+	CLogAsyncWriter                    m_asyncWriter;
 };
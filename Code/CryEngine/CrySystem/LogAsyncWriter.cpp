@@ -0,0 +1,429 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "StdAfx.h"
+#include "LogAsyncWriter.h"
+#include "Log.h"
+#include <CryThreading/IThreadConfigManager.h>
+
+#if defined(DEDICATED_SERVER)
+int CLogAsyncWriter::s_log_Async = 1;
+#else
+int CLogAsyncWriter::s_log_Async = 0;
+#endif
+int CLogAsyncWriter::s_log_AsyncRotateSize = 0;
+int CLogAsyncWriter::s_log_AsyncRotateCount = 5;
+
+namespace
+{
+const char* const k_szWriterThreadName = "LogWriter";
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLogAsyncWriter::RegisterCVars()
+{
+	REGISTER_CVAR2("log_Async", &s_log_Async, s_log_Async, VF_NULL,
+	               "Writes the log file from a low priority background thread, logging only copies the line into a ring buffer.\n"
+	               "Pending lines are still written out when the log is flushed, on shutdown and when the application crashes.\n"
+	               "0=write synchronously on the main thread, 1=asynchronous");
+	REGISTER_CVAR2("log_AsyncRotateSize", &s_log_AsyncRotateSize, s_log_AsyncRotateSize, VF_NULL,
+	               "MB after which the asynchronous log writer rotates the log file (game_1.log, game_2.log, ...). 0=never");
+	REGISTER_CVAR2("log_AsyncRotateCount", &s_log_AsyncRotateCount, s_log_AsyncRotateCount, VF_NULL,
+	               "Number of rotated log files kept by log_AsyncRotateSize");
+}
+
+//////////////////////////////////////////////////////////////////////////
+CLogAsyncWriter::CLogAsyncWriter(SExclusiveThreadAccessLock* pExclusiveLock)
+	: m_pRecords(NULL)
+	, m_nWritePos(0)
+	, m_nReadPos(0)
+	, m_nDropped(0)
+	, m_nTruncated(0)
+	, m_nPeakPending(0)
+	, m_pExclusiveLock(pExclusiveLock)
+	, m_bQuit(false)
+	, m_bStarted(false)
+	, m_bStartFailed(false)
+	, m_bStarting(false)
+	, m_bLowerPriority(false)
+	, m_bWriterThread(false)
+	, m_bShutDown(false)
+	, m_pFile(NULL)
+	, m_nFileSize(0)
+	, m_bLineOpen(false)
+	, m_nWritten(0)
+	, m_nDroppedReported(0)
+	, m_nRotations(0)
+{
+	m_szFileName[0] = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+CLogAsyncWriter::~CLogAsyncWriter()
+{
+	Shutdown();
+	delete[] m_pRecords;
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CLogAsyncWriter::Start(bool bWriterThread)
+{
+	if (m_bStarted || m_bStartFailed || m_bStarting || m_bShutDown)
+		return m_bStarted;
+
+	if (bWriterThread && (!gEnv || !gEnv->pThreadManager))
+		return false;
+
+	m_pRecords = new SRecord[k_nRecordCount];
+	for (uint32 i = 0; i < k_nRecordCount; ++i)
+		m_pRecords[i].nSequence = i;
+
+	m_bWriterThread = bWriterThread;
+	if (!bWriterThread)
+	{
+		m_bStarted = true;
+		return true;
+	}
+
+	// the thread manager may log a warning about the thread config, that one is written synchronously
+	m_bStarting = true;
+
+	// a log line is never urgent, unless the thread config explicitly asks for another priority
+	IThreadConfigManager* pConfigManager = gEnv->pThreadManager->GetThreadConfigManager();
+	m_bLowerPriority = !pConfigManager || pConfigManager->GetThreadConfig(k_szWriterThreadName) == pConfigManager->GetDefaultThreadConfig();
+
+	m_bQuit = false;
+	const bool bSpawned = gEnv->pThreadManager->SpawnThread(this, k_szWriterThreadName);
+	m_bStarting = false;
+	if (!bSpawned)
+	{
+		m_bStartFailed = true;
+		SAFE_DELETE_ARRAY(m_pRecords);
+		return false;
+	}
+
+	m_bStarted = true;
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLogAsyncWriter::Shutdown()
+{
+	// both CLog and the writer's own destructor shut it down, the second call must not reopen the file
+	if (m_bShutDown)
+		return;
+	m_bShutDown = true;
+
+	if (m_bStarted)
+	{
+		if (m_bWriterThread)
+		{
+			m_bQuit = true;
+			m_wakeEvent.Set();
+			gEnv->pThreadManager->JoinThread(this, eJM_Join);
+		}
+		m_bStarted = false;
+	}
+
+	if (!LockDrain())
+		return;
+
+	Drain_Locked();
+
+	if (m_nDropped || m_nTruncated)
+	{
+		char szReport[160];
+		cry_sprintf(szReport, "<Log> Asynchronous log writer: %u messages written, %u dropped, %u truncated", m_nWritten, (uint32)m_nDropped, (uint32)m_nTruncated);
+		WriteMessage_Locked(szReport, strlen(szReport), false);
+	}
+
+	Close_Locked();
+	m_drainLock.Unlock();
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLogAsyncWriter::ThreadEntry()
+{
+#if CRY_PLATFORM_WINDOWS
+	if (m_bLowerPriority)
+		SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+#endif
+
+	while (!m_bQuit)
+	{
+		m_wakeEvent.Wait(k_nWakeIntervalMs);
+
+		CryAutoLock<CryCriticalSectionNonRecursive> lock(m_drainLock);
+		Drain_Locked();
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CLogAsyncWriter::Push(const char* szText, size_t nLength, bool bAdd)
+{
+	if (!m_pRecords)
+		return false;
+
+	uint32 nSpan = max(1u, (uint32)((nLength + k_nRecordTextSize - 1) / k_nRecordTextSize));
+	if (nSpan > k_nMaxSpan)
+	{
+		nSpan = k_nMaxSpan;
+		nLength = k_nMaxSpan * k_nRecordTextSize;
+		CryInterlockedIncrement((volatile int*)&m_nTruncated);
+	}
+
+	// Records are freed in order, so when the last record of the span is free for this lap all of them are.
+	uint32 nPos;
+	for (;; )
+	{
+		nPos = m_nWritePos;
+		const uint32 nLast = nPos + nSpan - 1;
+		const int32 nDiff = (int32)(m_pRecords[nLast & (k_nRecordCount - 1)].nSequence - nLast);
+		if (nDiff == 0)
+		{
+			if ((uint32)CryInterlockedCompareExchange((volatile LONG*)&m_nWritePos, (LONG)(nPos + nSpan), (LONG)nPos) == nPos)
+				break;
+		}
+		else if (nDiff < 0)
+		{
+			CryInterlockedIncrement((volatile int*)&m_nDropped);
+			m_wakeEvent.Set();
+			return false;
+		}
+	}
+
+	size_t nOffset = 0;
+	for (uint32 i = 0; i < nSpan; ++i)
+	{
+		SRecord& record = m_pRecords[(nPos + i) & (k_nRecordCount - 1)];
+		const size_t nChunk = min(nLength - nOffset, (size_t)k_nRecordTextSize);
+		memcpy(record.text, szText + nOffset, nChunk);
+		record.nLength = (uint16)nChunk;
+		record.nSpan = (uint8)(i == 0 ? nSpan : 0);
+		record.bAdd = bAdd ? 1 : 0;
+		nOffset += nChunk;
+		CryInterlockedExchange((volatile LONG*)&record.nSequence, (LONG)(nPos + i + 1));
+	}
+
+	// the writer thread polls anyway, only wake it up early when the ring starts filling up
+	const uint32 nPending = nPos + nSpan - m_nReadPos;
+	if (nPending > m_nPeakPending)
+		m_nPeakPending = nPending;
+	if (nPending > k_nRecordCount / 4)
+		m_wakeEvent.Set();
+
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CLogAsyncWriter::LockDrain()
+{
+	for (int i = 0; !m_drainLock.TryLock(); ++i)
+	{
+		if (i >= 1000)
+			return false;
+		CrySleep(1);
+	}
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLogAsyncWriter::Flush()
+{
+	if (!LockDrain())
+		return;
+
+	Drain_Locked();
+	if (m_pFile)
+		fflush(m_pFile);
+	m_drainLock.Unlock();
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLogAsyncWriter::Close()
+{
+	if (!m_pFile && m_nReadPos == m_nWritePos)
+		return;
+
+	if (!LockDrain())
+		return;
+
+	Drain_Locked();
+	Close_Locked();
+	m_drainLock.Unlock();
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLogAsyncWriter::SetFileName(const char* szFileName)
+{
+	if (!LockDrain())
+		return;
+
+	Drain_Locked();
+	Close_Locked();
+	cry_strcpy(m_szFileName, szFileName);
+	m_drainLock.Unlock();
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLogAsyncWriter::Drain_Locked()
+{
+	if (!m_pRecords)
+		return;
+
+	// the crash handler waits for these before suspending the other threads
+	LockNoneExclusiveAccess(m_pExclusiveLock);
+
+	bool bWritten = false;
+	for (;; )
+	{
+		const uint32 nPos = m_nReadPos;
+		const SRecord& first = m_pRecords[nPos & (k_nRecordCount - 1)];
+		if (first.nSequence != nPos + 1)
+			break;
+
+		// the records of a message are published in order by the same thread
+		const uint32 nSpan = first.nSpan;
+		if (m_pRecords[(nPos + nSpan - 1) & (k_nRecordCount - 1)].nSequence != nPos + nSpan)
+			break;
+
+		size_t nLength = 0;
+		for (uint32 i = 0; i < nSpan; ++i)
+		{
+			const SRecord& record = m_pRecords[(nPos + i) & (k_nRecordCount - 1)];
+			memcpy(m_drainBuffer + nLength, record.text, record.nLength);
+			nLength += record.nLength;
+		}
+		const bool bAdd = first.bAdd != 0;
+
+		for (uint32 i = 0; i < nSpan; ++i)
+			CryInterlockedExchange((volatile LONG*)&m_pRecords[(nPos + i) & (k_nRecordCount - 1)].nSequence, (LONG)(nPos + i + k_nRecordCount));
+		m_nReadPos = nPos + nSpan;
+
+		WriteMessage_Locked(m_drainBuffer, nLength, bAdd);
+		++m_nWritten;
+		bWritten = true;
+	}
+
+	const uint32 nDropped = m_nDropped;
+	if (nDropped != m_nDroppedReported)
+	{
+		char szReport[128];
+		cry_sprintf(szReport, "<Log> %u messages were dropped, the asynchronous log buffer was full", nDropped - m_nDroppedReported);
+		m_nDroppedReported = nDropped;
+		WriteMessage_Locked(szReport, strlen(szReport), false);
+		bWritten = true;
+	}
+
+	if (bWritten && m_pFile)
+		fflush(m_pFile);
+
+	UnlockNoneExclusiveAccess(m_pExclusiveLock);
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLogAsyncWriter::WriteMessage_Locked(const char* szText, size_t nLength, bool bAdd)
+{
+	if (!m_pFile && !Open_Locked())
+		return;
+
+	if (!bAdd && s_log_AsyncRotateSize > 0 && m_nFileSize >= ((uint64)s_log_AsyncRotateSize << 20))
+	{
+		Rotate_Locked();
+		if (!m_pFile)
+			return;
+	}
+
+	// lines are terminated when the next one starts, like with KEEP_LOG_FILE_OPEN
+	if (nLength && szText[nLength - 1] == '\n')
+		--nLength;
+	if (!bAdd && m_bLineOpen)
+	{
+		fputc('\n', m_pFile);
+		++m_nFileSize;
+	}
+
+	fwrite(szText, 1, nLength, m_pFile);
+	m_nFileSize += nLength;
+	m_bLineOpen = true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CLogAsyncWriter::Open_Locked()
+{
+	if (!m_szFileName[0])
+		return false;
+
+	SCOPED_ALLOW_FILE_ACCESS_FROM_THIS_THREAD();
+
+	m_pFile = fxopen(m_szFileName, "at");
+	if (!m_pFile)
+		return false;
+
+	fseek(m_pFile, 0, SEEK_END);
+	const long nSize = ftell(m_pFile);
+	m_nFileSize = nSize > 0 ? (uint64)nSize : 0;
+
+	// the synchronous path terminates every line, unless it keeps the file open
+	m_bLineOpen = KEEP_LOG_FILE_OPEN && m_nFileSize > 0;
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLogAsyncWriter::Close_Locked()
+{
+	if (!m_pFile)
+		return;
+
+	if (m_bLineOpen)
+		fputc('\n', m_pFile);
+	fclose(m_pFile);
+	m_pFile = NULL;
+	m_bLineOpen = false;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLogAsyncWriter::Rotate_Locked()
+{
+	Close_Locked();
+
+	const string sExt = PathUtil::GetExt(m_szFileName);
+	const string sBase = PathUtil::RemoveExtension(string(m_szFileName));
+	const int nCount = max(s_log_AsyncRotateCount, 0);
+
+	string sOlder, sNewer;
+	for (int i = nCount; i > 0; --i)
+	{
+		sOlder.Format(sExt.empty() ? "%s_%d" : "%s_%d.%s", sBase.c_str(), i, sExt.c_str());
+		if (i == nCount)
+			remove(sOlder.c_str());
+		if (i > 1)
+			sNewer.Format(sExt.empty() ? "%s_%d" : "%s_%d.%s", sBase.c_str(), i - 1, sExt.c_str());
+		else
+			sNewer = m_szFileName;
+		rename(sNewer.c_str(), sOlder.c_str());
+	}
+	if (nCount == 0)
+		remove(m_szFileName);
+
+	++m_nRotations;
+	Open_Locked();
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLogAsyncWriter::GetStats(SStats& stats) const
+{
+	stats.nWritten = m_nWritten;
+	stats.nDropped = m_nDropped;
+	stats.nTruncated = m_nTruncated;
+	stats.nRotations = m_nRotations;
+	stats.nPending = m_nWritePos - m_nReadPos;
+	stats.nPeakPending = m_nPeakPending;
+	stats.nCapacity = m_pRecords ? k_nRecordCount : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLogAsyncWriter::GetMemoryUsage(ICrySizer* pSizer) const
+{
+	if (m_pRecords)
+		pSizer->AddObject(m_pRecords, k_nRecordCount * sizeof(SRecord));
+}
@@ -0,0 +1,118 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#pragma once
+
+#include <CryThreading/IThreadManager.h>
+
+struct SExclusiveThreadAccessLock;
+
+//////////////////////////////////////////////////////////////////////////
+// Writes the log file from a background thread (log_Async), the logging thread only copies the formatted line
+// into a ring buffer of preallocated records instead of opening, writing and closing the file itself.
+// The ring is a bounded multi producer queue: a message claims as many consecutive records as it needs with a
+// single compare exchange of the write position and publishes each record through its sequence number, the writer
+// thread consumes them in order. A message that doesn't fit into the free records is dropped and one spanning more
+// than k_nMaxSpan records is truncated, both are counted and drops are reported in the log file itself.
+// Flush() and Close() drain the ring on the calling thread, which is how FlushAndClose() and the crash handler
+// still get every pending line into the file.
+//////////////////////////////////////////////////////////////////////////
+class CLogAsyncWriter : public IThread
+{
+public:
+	struct SStats
+	{
+		uint32 nWritten;     // messages written to the file
+		uint32 nDropped;     // messages dropped because the ring buffer was full
+		uint32 nTruncated;   // messages cut at k_nMaxSpan records
+		uint32 nRotations;
+		uint32 nPending;     // records not written yet
+		uint32 nPeakPending;
+		uint32 nCapacity;
+	};
+
+	static void RegisterCVars();
+	static bool IsEnabled() { return s_log_Async != 0; }
+
+	explicit CLogAsyncWriter(SExclusiveThreadAccessLock* pExclusiveLock);
+	~CLogAsyncWriter();
+
+	// Allocates the ring and spawns the writer thread on first use, returns false if it can't run (yet) or was shut down.
+	// Without bWriterThread the ring is only drained by Flush(), Close() and Shutdown(). Main thread only.
+	bool Start(bool bWriterThread = true);
+	// Stops the writer thread, then drains and closes the file. Only the first call does anything.
+	void Shutdown();
+
+	// Any thread. bAdd appends the text to the previous line. Returns false if the message was dropped.
+	bool Push(const char* szText, size_t nLength, bool bAdd);
+
+	// Writes out the pending records on the calling thread.
+	void Flush();
+	// Flush and close the file, the next record reopens it. Used before the file is written synchronously again.
+	void Close();
+	// Closes the file and writes to szFileName from now on.
+	void SetFileName(const char* szFileName);
+
+	void GetStats(SStats& stats) const;
+	void GetMemoryUsage(ICrySizer* pSizer) const;
+
+private:
+	enum
+	{
+		k_nRecordCount    = 4096,
+		k_nRecordSize     = 512,
+		k_nRecordTextSize = k_nRecordSize - 8,
+		k_nMaxSpan        = 32,
+		k_nWakeIntervalMs = 50,
+	};
+
+	struct SRecord
+	{
+		volatile uint32 nSequence; // == position while free, position + 1 once published
+		uint16          nLength;
+		uint8           nSpan;     // records of the message, only set in its first record
+		uint8           bAdd;
+		char            text[k_nRecordTextSize];
+	};
+
+	virtual void ThreadEntry() override;
+
+	// Waits a bounded time for the drain lock, a crashed writer thread must not take the crash handler with it.
+	bool LockDrain();
+	void Drain_Locked();
+	void WriteMessage_Locked(const char* szText, size_t nLength, bool bAdd);
+	bool Open_Locked();
+	void Close_Locked();
+	void Rotate_Locked();
+
+	static int                     s_log_Async;
+	static int                     s_log_AsyncRotateSize;
+	static int                     s_log_AsyncRotateCount;
+
+	SRecord*                       m_pRecords;
+	volatile uint32                m_nWritePos;
+	volatile uint32                m_nReadPos;
+	volatile uint32                m_nDropped;
+	volatile uint32                m_nTruncated;
+	uint32                         m_nPeakPending;
+
+	SExclusiveThreadAccessLock*    m_pExclusiveLock;
+	CryCriticalSectionNonRecursive m_drainLock;
+	CryEvent                       m_wakeEvent;
+	volatile bool                  m_bQuit;
+	bool                           m_bStarted;
+	bool                           m_bStartFailed;
+	bool                           m_bStarting;
+	bool                           m_bLowerPriority;
+	bool                           m_bWriterThread;
+	bool                           m_bShutDown;
+
+	// owned by the drain lock
+	FILE*                          m_pFile;
+	uint64                         m_nFileSize;
+	bool                           m_bLineOpen; // the last line in the file isn't terminated yet
+	uint32                         m_nWritten;
+	uint32                         m_nDroppedReported;
+	uint32                         m_nRotations;
+	char                           m_szFileName[256];
+	char                           m_drainBuffer[k_nMaxSpan * k_nRecordTextSize];
+};
@@ -277,6 +277,7 @@ static volatile threadID s_ignoreThreadId = (threadID) - 1;
 
 static uint32 g_memReplayFrameCount;
 const int k_maxCallStackDepth = 256;
+const uint32 k_defaultSampleInterval = 512 * 1024;
 extern volatile bool g_replayCleanedUp;
 
 static volatile UINT_PTR s_replayLastGlobal = 0;
@@ -516,6 +517,166 @@ void ReplayAllocator::Free()
 	UnreserveAddressSpace(m_heap, m_commitEnd);
 }
 
+namespace
+{
+ILINE size_t SampledSlot(UINT_PTR id, size_t mask)
+{
+	return (size_t)(((uint64)id * 0x9E3779B97F4A7C15ULL) >> 40) & mask;
+}
+}
+
+ReplaySampler::ReplaySampler()
+	: m_interval(0)
+	, m_bytesUntilSample(0)
+	, m_rng(0)
+	, m_tables(NULL)
+	, m_sampled(NULL)
+	, m_callstacks(NULL)
+	, m_tablesSize(0)
+	, m_numSampled(0)
+	, m_numCallstacks(0)
+	, m_nextOverflowCallstackId(CallstackCapacity + 1)
+	, m_overflowed(false)
+{
+}
+
+ReplaySampler::~ReplaySampler()
+{
+	if (m_tables)
+		UnreserveAddressSpace(m_tables, reinterpret_cast<char*>(m_tables) + m_tablesSize);
+}
+
+bool ReplaySampler::Reset()
+{
+	if (!m_tables)
+	{
+		const size_t sz = SampledCapacity * sizeof(UINT_PTR) + CallstackCapacity * sizeof(uint64);
+		const size_t alignedSz = (sz + (PageSize - 1)) & ~(size_t)(PageSize - 1);
+
+		void* base = ReserveAddressSpace(alignedSz);
+		if (!base)
+			return false;
+		if (!MapAddressSpace(base, alignedSz))
+		{
+			UnreserveAddressSpace(base, base);
+			return false;
+		}
+
+		m_tables = base;
+		m_tablesSize = alignedSz;
+		m_callstacks = reinterpret_cast<uint64*>(base);
+		m_sampled = reinterpret_cast<UINT_PTR*>(m_callstacks + CallstackCapacity);
+	}
+
+	memset(m_tables, 0, m_tablesSize);
+	m_numSampled = 0;
+	m_numCallstacks = 0;
+	m_nextOverflowCallstackId = CallstackCapacity + 1;
+	m_overflowed = false;
+
+	m_rng = (uint64)CryGetTicks() | 1;
+	m_bytesUntilSample = PickSampleDistance();
+	return true;
+}
+
+int64 ReplaySampler::PickSampleDistance()
+{
+	// xorshift64*, uniform in [0, 1) from the top 53 bits
+	m_rng ^= m_rng >> 12;
+	m_rng ^= m_rng << 25;
+	m_rng ^= m_rng >> 27;
+	const double q = (double)((m_rng * 0x2545F4914F6CDD1DULL) >> 11) * (1.0 / 9007199254740992.0);
+
+	const double distance = -log(1.0 - q) * (double)m_interval;
+	return (int64)distance + 1;
+}
+
+bool ReplaySampler::AddSampled(UINT_PTR id)
+{
+	// keep the load at 75% at most, the probes stay short
+	if (m_numSampled >= SampledCapacity / 4 * 3)
+	{
+		m_overflowed = true;
+		return false;
+	}
+
+	const size_t mask = SampledCapacity - 1;
+	size_t i = SampledSlot(id, mask);
+	while (m_sampled[i] && m_sampled[i] != id)
+		i = (i + 1) & mask;
+
+	if (!m_sampled[i])
+		++m_numSampled;
+	m_sampled[i] = id;
+	return true;
+}
+
+bool ReplaySampler::RemoveSampled(UINT_PTR id)
+{
+	if (!m_numSampled)
+		return false;
+
+	const size_t mask = SampledCapacity - 1;
+	size_t i = SampledSlot(id, mask);
+	while (m_sampled[i] != id)
+	{
+		if (!m_sampled[i])
+			return false;
+		i = (i + 1) & mask;
+	}
+
+	// backward shift deletion, the table never contains tombstones
+	for (size_t j = (i + 1) & mask; m_sampled[j]; j = (j + 1) & mask)
+	{
+		const size_t home = SampledSlot(m_sampled[j], mask);
+		if (((j - home) & mask) >= ((j - i) & mask))
+		{
+			m_sampled[i] = m_sampled[j];
+			i = j;
+		}
+	}
+
+	m_sampled[i] = 0;
+	--m_numSampled;
+	return true;
+}
+
+uint32 ReplaySampler::GetCallstackId(const UINT_PTR* callstack, uint32 length, bool& isNew)
+{
+	uint64 hash = 0xcbf29ce484222325ULL ^ length;
+	for (uint32 i = 0; i < length; ++i)
+	{
+		hash = (hash ^ (uint64)callstack[i]) * 0x9E3779B97F4A7C15ULL;
+		hash ^= hash >> 29;
+	}
+	if (!hash)
+		hash = 1;
+
+	const size_t mask = CallstackCapacity - 1;
+	size_t i = (size_t)hash & mask;
+	while (m_callstacks[i])
+	{
+		if (m_callstacks[i] == hash)
+		{
+			isNew = false;
+			return (uint32)i + 1;
+		}
+		i = (i + 1) & mask;
+	}
+
+	isNew = true;
+	if (m_numCallstacks >= CallstackCapacity / 4 * 3)
+	{
+		// dictionary is full, every further callstack is sent with its own id
+		m_overflowed = true;
+		return m_nextOverflowCallstackId++;
+	}
+
+	m_callstacks[i] = hash;
+	++m_numCallstacks;
+	return (uint32)i + 1;
+}
+
 ReplayCompressor::ReplayCompressor(ReplayAllocator& allocator, IReplayWriter* writer)
 	: m_allocator(&allocator)
 	, m_writer(writer)
@@ -1270,11 +1431,14 @@ void CMemReplay::StartOnCommandLine(const char* cmdLine)
 		char openCmd[bufferLength] = "disk:";
 
 		// Try and detect a new style open string, and fall back to the old suffix format if it fails.
-		if (
-		  (strncmp(mrCmd, "-memreplay disk", 15) == 0) ||
-		  (strncmp(mrCmd, "-memreplay socket", 17) == 0))
+		// Look for it anywhere, -memreplaysample and the like may come first.
+		const char* openArg = strstr(lwrCmdLine.c_str(), "-memreplay disk");
+		if (!openArg)
+			openArg = strstr(lwrCmdLine.c_str(), "-memreplay socket");
+
+		if (openArg)
 		{
-			const char* arg = mrCmd + strlen("-memreplay ");
+			const char* arg = openArg + strlen("-memreplay ");
 			const char* argEnd = arg;
 			while (*argEnd && !isspace((unsigned char) *argEnd))
 				++argEnd;
@@ -1285,6 +1449,13 @@ void CMemReplay::StartOnCommandLine(const char* cmdLine)
 			RetrieveMemReplaySuffix(openCmd + 5, lwrCmdLine.c_str(), bufferLength - 5);
 		}
 
+		// -memreplaysample [bytes]: record one in that many allocated bytes only
+		if (const char* sampleCmd = strstr(lwrCmdLine.c_str(), "-memreplaysample"))
+		{
+			const uint32 interval = (uint32)strtoul(sampleCmd + strlen("-memreplaysample"), NULL, 10);
+			m_sampler.SetInterval(interval ? interval : k_defaultSampleInterval);
+		}
+
 		Start(bPaused, openCmd);
 	}
 }
@@ -1302,6 +1473,12 @@ void CMemReplay::Start(bool bPaused, const char* openString)
 
 	if (!m_stream.IsOpen())
 	{
+		if (m_sampler.IsEnabled() && !m_sampler.Reset())
+		{
+			// Not enough memory for the sampler tables, record everything.
+			m_sampler.SetInterval(0);
+		}
+
 		if (m_stream.Open(openString))
 		{
 			s_replayLastGlobal = GetCurrentSysFree();
@@ -1317,6 +1494,9 @@ void CMemReplay::Start(bool bPaused, const char* openString)
 			m_stream.WriteEvent(MemReplayInfoEvent(exeSize, initialGlobal, s_replayStartingFree));
 			m_stream.WriteEvent(MemReplayFrameStartEvent(g_memReplayFrameCount++));
 
+			if (m_sampler.IsEnabled())
+				m_stream.WriteEvent(MemReplaySampleInfoEvent(m_sampler.GetInterval()));
+
 	#if CRY_PLATFORM_DURANGO
 			m_stream.WriteEvent(MemReplayModuleRefShortEvent("minidump"));
 	#endif
@@ -1342,6 +1522,15 @@ void CMemReplay::Stop()
 		RecordModules();
 
 		m_stream.Close();
+
+		// The stream is closed, logging doesn't end up in the replay anymore.
+		if (m_sampler.IsEnabled())
+		{
+			CryLogAlways("MemReplay: %" PRISIZE_T " sampled allocations alive, %" PRISIZE_T " distinct callstacks (sample interval %u bytes)",
+			             m_sampler.GetNumSampled(), m_sampler.GetNumCallstacks(), m_sampler.GetInterval());
+			if (m_sampler.HasOverflowed())
+				CryWarning(VALIDATOR_MODULE_SYSTEM, VALIDATOR_WARNING, "MemReplay: sampler tables were full, the profile misses samples - use a larger -memreplaysample interval");
+		}
 	}
 }
 
@@ -1373,7 +1562,8 @@ void CMemReplay::ExitScope_Alloc(UINT_PTR id, UINT_PTR sz, UINT_PTR alignment)
 
 	if (m_scopeDepth == 0)
 	{
-		if (id && m_stream.IsOpen() && CryGetCurrentThreadId() != s_ignoreThreadId)
+		// In sampling mode the allocations which aren't picked neither take the log lock nor walk the stack.
+		if (id && m_stream.IsOpen() && CryGetCurrentThreadId() != s_ignoreThreadId && (!m_sampler.IsEnabled() || m_sampler.Sample(sz)))
 		{
 			CryAutoLock<CryCriticalSection> lock(GetLogMutex());
 
@@ -1383,7 +1573,10 @@ void CMemReplay::ExitScope_Alloc(UINT_PTR id, UINT_PTR sz, UINT_PTR alignment)
 				INT_PTR changeGlobal = (INT_PTR)(s_replayLastGlobal - global);
 				s_replayLastGlobal = global;
 
-				RecordAlloc(m_scopeClass, m_scopeSubClass, m_scopeModuleId, id, alignment, sz, sz, changeGlobal);
+				if (m_sampler.IsEnabled())
+					RecordSampledAlloc(m_scopeClass, m_scopeSubClass, m_scopeModuleId, id, alignment, sz, sz, changeGlobal);
+				else
+					RecordAlloc(m_scopeClass, m_scopeSubClass, m_scopeModuleId, id, alignment, sz, sz, changeGlobal);
 			}
 		}
 	}
@@ -1411,15 +1604,44 @@ void CMemReplay::ExitScope_Realloc(UINT_PTR originalId, UINT_PTR newId, UINT_PTR
 	{
 		if (m_stream.IsOpen() && CryGetCurrentThreadId() != s_ignoreThreadId)
 		{
-			CryAutoLock<CryCriticalSection> lock(GetLogMutex());
+			if (m_sampler.IsEnabled())
+			{
+				// Sampled as a free of the old block and an allocation of the new one.
+				const bool bWasSampled = m_sampler.RemoveSampled(originalId);
+				const bool bSample = m_sampler.Sample(sz);
 
-			if (m_stream.IsOpen())
+				if (bWasSampled || bSample)
+				{
+					CryAutoLock<CryCriticalSection> lock(GetLogMutex());
+
+					if (m_stream.IsOpen())
+					{
+						UINT_PTR global = GetCurrentSysFree();
+						INT_PTR changeGlobal = (INT_PTR)(s_replayLastGlobal - global);
+						s_replayLastGlobal = global;
+
+						if (bWasSampled)
+						{
+							RecordFree(m_scopeClass, m_scopeSubClass, m_scopeModuleId, originalId, changeGlobal, false);
+							changeGlobal = 0;
+						}
+						if (bSample)
+							RecordSampledAlloc(m_scopeClass, m_scopeSubClass, m_scopeModuleId, newId, alignment, sz, sz, changeGlobal);
+					}
+				}
+			}
+			else
 			{
-				UINT_PTR global = GetCurrentSysFree();
-				INT_PTR changeGlobal = (INT_PTR)(s_replayLastGlobal - global);
-				s_replayLastGlobal = global;
+				CryAutoLock<CryCriticalSection> lock(GetLogMutex());
 
-				RecordRealloc(m_scopeClass, m_scopeSubClass, m_scopeModuleId, originalId, newId, alignment, sz, sz, changeGlobal);
+				if (m_stream.IsOpen())
+				{
+					UINT_PTR global = GetCurrentSysFree();
+					INT_PTR changeGlobal = (INT_PTR)(s_replayLastGlobal - global);
+					s_replayLastGlobal = global;
+
+					RecordRealloc(m_scopeClass, m_scopeSubClass, m_scopeModuleId, originalId, newId, alignment, sz, sz, changeGlobal);
+				}
 			}
 		}
 	}
@@ -1433,7 +1655,8 @@ void CMemReplay::ExitScope_Free(UINT_PTR id)
 
 	if (m_scopeDepth == 0)
 	{
-		if (id && m_stream.IsOpen() && CryGetCurrentThreadId() != s_ignoreThreadId)
+		// In sampling mode only the frees of sampled allocations are recorded.
+		if (id && m_stream.IsOpen() && CryGetCurrentThreadId() != s_ignoreThreadId && (!m_sampler.IsEnabled() || m_sampler.RemoveSampled(id)))
 		{
 			CryAutoLock<CryCriticalSection> lock(GetLogMutex());
 
@@ -1444,7 +1667,7 @@ void CMemReplay::ExitScope_Free(UINT_PTR id)
 				s_replayLastGlobal = global;
 
 				PREFAST_SUPPRESS_WARNING(6326)
-				RecordFree(m_scopeClass, m_scopeSubClass, m_scopeModuleId, id, changeGlobal, REPLAY_RECORD_FREECS != 0);
+				RecordFree(m_scopeClass, m_scopeSubClass, m_scopeModuleId, id, changeGlobal, REPLAY_RECORD_FREECS != 0 && !m_sampler.IsEnabled());
 			}
 		}
 	}
@@ -2008,6 +2231,42 @@ void CMemReplay::RecordFree(EMemReplayAllocClass::Class cls, uint16 subCls, int
 	m_stream.EndAllocateRawEvent<MemReplayFreeEvent>(ev->callstackLength * sizeof(ev->callstack[0]) - sizeof(ev->callstack));
 }
 
+void CMemReplay::RecordSampledAlloc(EMemReplayAllocClass::Class cls, uint16 subCls, int moduleId, UINT_PTR p, UINT_PTR alignment, UINT_PTR sizeRequested, UINT_PTR sizeConsumed, INT_PTR sizeGlobal)
+{
+	if (!m_sampler.AddSampled(p))
+		return;
+
+	UINT_PTR callstack[k_maxCallStackDepth];
+	uint32 callstackLength = k_maxCallStackDepth;
+	CSystem::debug_GetCallStackRaw(CastCallstack(callstack), callstackLength);
+
+	bool bIsNew = false;
+	const uint32 callstackId = m_sampler.GetCallstackId(callstack, callstackLength, bIsNew);
+	if (bIsNew)
+	{
+		MemReplayCallstackDefEvent* ev = new(m_stream.BeginAllocateRawEvent<MemReplayCallstackDefEvent>(
+		                                       callstackLength * sizeof(callstack[0]) - SIZEOF_MEMBER(MemReplayCallstackDefEvent, callstack)))
+		                                 MemReplayCallstackDefEvent(callstackId);
+
+		memcpy(ev->callstack, callstack, callstackLength * sizeof(callstack[0]));
+		ev->callstackLength = callstackLength;
+
+		m_stream.EndAllocateRawEvent<MemReplayCallstackDefEvent>(ev->callstackLength * sizeof(ev->callstack[0]) - sizeof(ev->callstack));
+	}
+
+	m_stream.WriteEvent(MemReplaySampledAllocEvent(
+	                      CryGetCurrentThreadId32(),
+	                      static_cast<uint16>(moduleId),
+	                      static_cast<uint16>(cls),
+	                      static_cast<uint16>(subCls),
+	                      p,
+	                      static_cast<uint32>(alignment),
+	                      static_cast<uint32>(sizeRequested),
+	                      static_cast<uint32>(sizeConsumed),
+	                      static_cast<int32>(sizeGlobal),
+	                      callstackId));
+}
+
 void CMemReplay::RecordModules()
 {
 	m_modules.RefreshModules(RecordModuleLoad, RecordModuleUnload, this);
@@ -148,6 +148,9 @@ enum Ids
 	RE_Realloc3,
 	RE_UnregisterAddressRange,
 	RE_MapPage2,
+	RE_SampleInfo,
+	RE_CallstackDef,
+	RE_SampledAlloc,
 };
 }
 
@@ -734,6 +737,67 @@ struct MemReplayUnMapPageEvent
 	}
 } __PACKED;
 
+// Written once at the start of a sampled log, see ReplaySampler.
+struct MemReplaySampleInfoEvent
+{
+	static const int EventId = MemReplayEventIds::RE_SampleInfo;
+
+	uint32           sampleInterval;
+
+	MemReplaySampleInfoEvent(uint32 sampleInterval)
+		: sampleInterval(sampleInterval)
+	{
+	}
+} __PACKED;
+
+struct MemReplayCallstackDefEvent
+{
+	static const int EventId = MemReplayEventIds::RE_CallstackDef;
+
+	uint32           callstackId;
+	uint16           callstackLength;
+	UINT_PTR         callstack[1]; // Must be last.
+
+	MemReplayCallstackDefEvent(uint32 callstackId)
+		: callstackId(callstackId)
+		, callstackLength(0)
+	{
+	}
+} __PACKED;
+
+// An allocation picked by the sampler. It stands for sizeRequested / (1 - exp(-sizeRequested / sampleInterval))
+// bytes of allocations from the same callstack. Only frees of sampled allocations are recorded.
+struct MemReplaySampledAllocEvent
+{
+	static const int EventId = MemReplayEventIds::RE_SampledAlloc;
+
+	uint32           threadId;
+	UINT_PTR         id;
+	uint32           alignment;
+	uint32           sizeRequested;
+	uint32           sizeConsumed;
+	int32            sizeGlobal; //  Inferred from changes in global memory status
+
+	uint16           moduleId;
+	uint16           allocClass;
+	uint16           allocSubClass;
+	uint32           callstackId;
+
+	MemReplaySampledAllocEvent(uint32 threadId, uint16 moduleId, uint16 allocClass, uint16 allocSubClass, UINT_PTR id, uint32 alignment, uint32 sizeReq, uint32 sizeCon, int32 sizeGlobal, uint32 callstackId)
+		: threadId(threadId)
+		, id(id)
+		, alignment(alignment)
+		, sizeRequested(sizeReq)
+		, sizeConsumed(sizeCon)
+		, sizeGlobal(sizeGlobal)
+		, moduleId(moduleId)
+		, allocClass(allocClass)
+		, allocSubClass(allocSubClass)
+		, callstackId(callstackId)
+	{
+	}
+} __PACKED;
+
 	#pragma pack(pop)
 
 	#if CRY_PLATFORM_WINDOWS || CRY_PLATFORM_DURANGO || CRY_PLATFORM_LINUX || CRY_PLATFORM_ANDROID || CRY_PLATFORM_APPLE
@@ -803,6 +867,79 @@ private:
 	LPVOID                         m_allocEnd;
 };
 
+// Low overhead mode (-memreplaysample <bytes>): instead of every allocation, one in every
+// 'interval' allocated bytes is recorded, the distance between two samples is exponentially
+// distributed (a Poisson process over the allocated bytes, as in tcmalloc's heap profiler),
+// so an allocation of size s is picked with the probability 1 - exp(-s / interval).
+// Callstacks are written once and referenced by id afterwards.
+// Not thread safe, CMemReplay calls it with m_scope held.
+class ReplaySampler : private ReplayAllocatorBase
+{
+public:
+	ReplaySampler();
+	~ReplaySampler();
+
+	void   SetInterval(uint32 interval) { m_interval = interval; }
+	uint32 GetInterval() const          { return m_interval; }
+	bool   IsEnabled() const            { return m_interval != 0; }
+
+	// Maps the tables on first use and forgets all previous samples.
+	bool Reset();
+
+	// Counts the allocated bytes, returns true if this allocation is picked.
+	ILINE bool Sample(UINT_PTR sz)
+	{
+		if ((int64)sz < m_bytesUntilSample)
+		{
+			m_bytesUntilSample -= (int64)sz;
+			return false;
+		}
+		m_bytesUntilSample = PickSampleDistance();
+		return true;
+	}
+
+	// Returns false if the table of live samples is full, the allocation must not be recorded then.
+	bool AddSampled(UINT_PTR id);
+	// Returns false if the allocation wasn't sampled.
+	bool RemoveSampled(UINT_PTR id);
+
+	// isNew is set when the callstack hasn't been seen before and has to be defined in the log.
+	uint32 GetCallstackId(const UINT_PTR* callstack, uint32 length, bool& isNew);
+
+	size_t GetNumSampled() const    { return m_numSampled; }
+	size_t GetNumCallstacks() const { return m_numCallstacks; }
+	// true if samples were dropped or callstacks sent repeatedly because a table was full
+	bool   HasOverflowed() const    { return m_overflowed; }
+
+private:
+	ReplaySampler(const ReplaySampler&);
+	ReplaySampler& operator=(const ReplaySampler&);
+
+	int64 PickSampleDistance();
+
+private:
+	enum
+	{
+		SampledCapacity   = 1 << 18,
+		CallstackCapacity = 1 << 16,
+	};
+
+private:
+	uint32    m_interval;
+	int64     m_bytesUntilSample;
+	uint64    m_rng;
+
+	void*     m_tables;
+	UINT_PTR* m_sampled;
+	uint64*   m_callstacks;
+	size_t    m_tablesSize;
+
+	size_t    m_numSampled;
+	size_t    m_numCallstacks;
+	uint32    m_nextOverflowCallstackId;
+	bool      m_overflowed;
+};
+
 class ReplayCompressor
 {
 public:
@@ -1188,6 +1325,7 @@ private:
 	void RecordAlloc(EMemReplayAllocClass::Class cls, uint16 subCls, int moduleId, UINT_PTR p, UINT_PTR alignment, UINT_PTR sizeRequested, UINT_PTR sizeConsumed, INT_PTR sizeGlobal);
 	void RecordRealloc(EMemReplayAllocClass::Class cls, uint16 subCls, int moduleId, UINT_PTR op, UINT_PTR p, UINT_PTR alignment, UINT_PTR sizeRequested, UINT_PTR sizeConsumed, INT_PTR sizeGlobal);
 	void RecordFree(EMemReplayAllocClass::Class cls, uint16 subCls, int moduleId, UINT_PTR p, INT_PTR sizeGlobal, bool captureCallstack);
+	void RecordSampledAlloc(EMemReplayAllocClass::Class cls, uint16 subCls, int moduleId, UINT_PTR p, UINT_PTR alignment, UINT_PTR sizeRequested, UINT_PTR sizeConsumed, INT_PTR sizeGlobal);
 	void RecordModules();
 
 	int  GetCurrentExecutableSize();
@@ -1196,6 +1334,7 @@ private:
 	volatile uint32             m_allocReference;
 	ReplayLogStream             m_stream;
 	CReplayModules              m_modules;
+	ReplaySampler               m_sampler;
 
 	CryCriticalSection          m_scope;
 
@@ -8,6 +8,9 @@
 #include "GeneralMemoryHeap.h"
 #include "PageMappingHeap.h"
 #include "DefragAllocator.h"
+#include "DefragScheduler.h"
+#include "FrameArena.h"
+#include <CryMemory/BucketAllocator.h>
 
 #if CRY_PLATFORM_WINDOWS
 	#include <Psapi.h>
@@ -23,6 +26,10 @@
 #endif
 extern LONG g_TotalAllocatedMemory;
 
+#if defined(USE_GLOBAL_BUCKET_ALLOCATOR)
+extern void BucketAllocatorGetThreadCacheStats(SBucketThreadCacheStats& stats);
+#endif
+
 #ifdef MEMMAN_STATIC
 CCryMemoryManager g_memoryManager;
 #endif
@@ -44,6 +51,21 @@ int CCryMemoryManager::s_sys_MemoryDeadListSize;
 void CCryMemoryManager::RegisterCVars()
 {
 	REGISTER_CVAR2("sys_MemoryDeadListSize", &s_sys_MemoryDeadListSize, 0, VF_REQUIRE_APP_RESTART, "Keep upto size bytes in a \"deadlist\" of allocations to assist in capturing tramples");
+	CFrameArenaManager::RegisterCVars();
+	CDefragScheduler::RegisterCVars();
+	REGISTER_COMMAND("sys_bucket_thread_cache_dump", DumpBucketThreadCacheStatsCmd, VF_NULL, "Logs hit rate and cross thread free statistics of the bucket allocator thread caches");
+}
+
+void CCryMemoryManager::DumpBucketThreadCacheStatsCmd(IConsoleCmdArgs* pArgs)
+{
+	SBucketThreadCacheStats stats;
+	GetInstance()->GetBucketThreadCacheStats(stats);
+
+	CryLogAlways("Bucket allocator thread caches (%u threads, %" PRISIZE_T " KB cached):", stats.numThreadCaches, stats.cachedBytes / 1024);
+	CryLogAlways("  allocs %" PRIu64 ", hit rate %.1f%%, refills %" PRIu64,
+	             stats.numAllocs, stats.numAllocs ? 100.0 * stats.numAllocHits / stats.numAllocs : 0.0, stats.numRefills);
+	CryLogAlways("  frees %" PRIu64 ", flushes %" PRIu64 ", cross thread frees at least %" PRIu64,
+	             stats.numFrees, stats.numFlushes, stats.numRemoteFrees);
 }
 #endif
 
@@ -296,6 +318,34 @@ void CCryMemoryManager::FreePages(void* p, size_t size)
 	MEMREPLAY_SCOPE_FREE(id);
 }
 
+//////////////////////////////////////////////////////////////////////////
+IFrameArena* CCryMemoryManager::GetThreadFrameArena()
+{
+	return CFrameArenaManager::GetInstance().GetThreadArena();
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CCryMemoryManager::AdvanceFrameArenas()
+{
+	CFrameArenaManager::GetInstance().Advance();
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CCryMemoryManager::GetFrameArenaStats(SFrameArenaStats& stats)
+{
+	CFrameArenaManager::GetInstance().GetStats(stats);
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CCryMemoryManager::GetBucketThreadCacheStats(SBucketThreadCacheStats& stats)
+{
+#if defined(USE_GLOBAL_BUCKET_ALLOCATOR)
+	BucketAllocatorGetThreadCacheStats(stats);
+#else
+	ZeroStruct(stats);
+#endif
+}
+
 //////////////////////////////////////////////////////////////////////////
 extern "C"
 {
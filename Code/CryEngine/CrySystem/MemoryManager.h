@@ -32,6 +32,7 @@ public:
 	// Singleton
 	static CCryMemoryManager* GetInstance();
 	static void               RegisterCVars();
+	static void               DumpBucketThreadCacheStatsCmd(IConsoleCmdArgs* pArgs);
 
 	//////////////////////////////////////////////////////////////////////////
 	virtual bool                     GetProcessMemInfo(SProcessMemInfo& minfo);
@@ -56,6 +57,11 @@ public:
 
 	virtual void*                    AllocPages(size_t size);
 	virtual void                     FreePages(void* p, size_t size);
+
+	virtual IFrameArena*             GetThreadFrameArena();
+	virtual void                     AdvanceFrameArenas();
+	virtual void                     GetFrameArenaStats(SFrameArenaStats& stats);
+	virtual void                     GetBucketThreadCacheStats(SBucketThreadCacheStats& stats);
 };
 #else
 typedef IMemoryManager CCryMemoryManager;
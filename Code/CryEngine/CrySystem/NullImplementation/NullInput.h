@@ -75,6 +75,8 @@ public:
 
 	virtual uint32               GetPlatformFlags() const override                                                                                           { return 0; }
 
+	virtual int64                GetFrameInputTimestamp() const override                                                                                     { return 0; }
+
 	virtual IKinectInput*        GetKinectInput() override                                                                                                   { return nullptr; }
 	virtual INaturalPointInput*  GetNaturalPointInput() override                                                                                             { return nullptr; }
 	// Input blocking functionality
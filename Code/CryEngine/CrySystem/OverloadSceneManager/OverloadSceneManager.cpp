@@ -7,6 +7,7 @@
 #include <CryGame/IGameFramework.h>
 #include <CrySystem/Profilers/IStatoscope.h>
 #include <CryRenderer/IRenderAuxGeom.h>
+#include <CryThreading/IJobManager.h>
 
 #if ENABLE_STATOSCOPE
 class COverloadDG : public IStatoscopeDataGroup
@@ -19,6 +20,7 @@ public:
 		return SDescription('L', "overload scene manager", "['/Overload/' (int enabled) (float targetFrameRate) (float fbScale)"
 		                                                   "(float currentStats/frameRate) (float currentStats/gpuFrameRate)"
 		                                                   "(float smoothedStats/frameRate) (float smoothedStats/gpuFrameRate)"
+		                                                   "(float smoothedStats/gpuTime) (float gpuBudget)"
 		                                                   "]");
 	}
 
@@ -35,6 +37,8 @@ public:
 		SScenePerformanceStats& smoothedStats = m_pOSM->m_smoothedSceneStats;
 		fr.AddValue(smoothedStats.frameRate);
 		fr.AddValue(smoothedStats.gpuFrameRate);
+		fr.AddValue(smoothedStats.gpuTime);
+		fr.AddValue(m_pOSM->GetGPUBudget());
 	}
 
 private:
@@ -42,6 +46,78 @@ private:
 };
 #endif
 
+//--------------------------------------------------------------------------------------------------
+// Name: CCVarScalabilityHook
+// Desc: Scales a console variable down to lowScale times the value it had when scaling started.
+//       That value is restored once the hook is back at full quality, so user changes are kept.
+//--------------------------------------------------------------------------------------------------
+class CCVarScalabilityHook : public IOverloadScalabilityHook
+{
+public:
+	CCVarScalabilityHook(const char* szName, ICVar* pCVar, float lowScale)
+		: m_szName(szName)
+		, m_pCVar(pCVar)
+		, m_lowScale(lowScale)
+		, m_baseValue(0.0f)
+		, m_bActive(false)
+	{}
+
+	virtual const char* GetName() const { return m_szName; }
+
+	virtual void SetQualityLevel(float level)
+	{
+		if (level >= 1.0f)
+		{
+			if (m_bActive)
+				SetValue(m_baseValue);
+			m_bActive = false;
+			return;
+		}
+
+		if (!m_bActive)
+		{
+			m_baseValue = m_pCVar->GetFVal();
+			m_bActive = true;
+		}
+		SetValue(m_baseValue * LERP(m_lowScale, 1.0f, level));
+	}
+
+private:
+	void SetValue(float value)
+	{
+		if (m_pCVar->GetType() == CVAR_INT)
+			m_pCVar->Set((int)(value + 0.5f));
+		else
+			m_pCVar->Set(value);
+	}
+
+	const char* m_szName;
+	ICVar*      m_pCVar;
+	float       m_lowScale;
+	float       m_baseValue;
+	bool        m_bActive;
+};
+
+// Default hooks in priority order, the least noticeable reductions come first
+static const struct
+{
+	const char* szName;
+	const char* szCVar;
+	float       lowScale;
+	uint32      budgetMask;
+} s_defaultScalabilityHooks[] =
+{
+	{ "Vegetation density",       "e_MergedMeshesViewDistRatio",   0.5f,  eOverloadBudget_GPU | eOverloadBudget_Workers                                          },
+	{ "Particle screen fill",     "e_ParticlesMaxScreenFill",      0.25f, eOverloadBudget_GPU                                                                    },
+	{ "Particle LOD",             "e_ParticlesLod",                0.5f,  eOverloadBudget_Workers | eOverloadBudget_RenderThread                                 },
+	{ "Animation LOD",            "ca_AnimationUpdateLodDistance", 0.5f,  eOverloadBudget_Workers | eOverloadBudget_MainThread                                   },
+	{ "Attachment culling",       "ca_AttachmentCullingRation",    0.5f,  eOverloadBudget_Workers | eOverloadBudget_RenderThread                                 },
+	{ "Attachment culling MP",    "ca_AttachmentCullingRationMP",  0.5f,  eOverloadBudget_Workers | eOverloadBudget_RenderThread                                 },
+	{ "Vegetation view distance", "e_ViewDistRatioVegetation",     0.5f,  eOverloadBudget_GPU | eOverloadBudget_MainThread | eOverloadBudget_RenderThread        },
+	{ "Shadow cascades",          "e_GsmLodsNum",                  0.6f,  eOverloadBudget_GPU | eOverloadBudget_RenderThread                                     },
+	{ "View distance",            "e_ViewDistRatio",               0.6f,  eOverloadBudget_MainThread | eOverloadBudget_RenderThread | eOverloadBudget_GPU        },
+};
+
 //--------------------------------------------------------------------------------------------------
 // Name: COverloadSceneManager
 // Desc: Constructor
@@ -51,6 +127,7 @@ COverloadSceneManager::COverloadSceneManager()
 	InitialiseCVars();
 
 	m_currentFrameStat = 0;
+	m_bDefaultHooksCreated = false;
 
 	ResetDefaultValues();
 
@@ -142,9 +219,20 @@ void COverloadSceneManager::InitialiseCVars()
 	REGISTER_CVAR(osm_historyLength, 5, VF_NULL, "Overload scene manager number of frames to record stats for");
 	REGISTER_CVAR(osm_targetFPS, 28.0f, VF_NULL, "Overload scene manager target frame rate");
 	REGISTER_CVAR(osm_targetFPSTolerance, 1.0f, VF_NULL, "The overload scene manager will make adjustments if fps is outside targetFPS +/- this value");
-	REGISTER_CVAR(osm_fbScaleDeltaDown, 5.0f, VF_NULL, "The speed multiplier for the overload scene manager frame buffer scaling down");
-	REGISTER_CVAR(osm_fbScaleDeltaUp, 1.0f, VF_NULL, "The speed multiplier for the overload scene manager frame buffer scaling up");
+	REGISTER_CVAR(osm_fbScaleDeltaDown, 5.0f, VF_NULL, "The speed multiplier for the overload scene manager frame buffer scaling down, each unit moves 5% of the way to the scale meeting the GPU budget per frame");
+	REGISTER_CVAR(osm_fbScaleDeltaUp, 1.0f, VF_NULL, "The speed multiplier for the overload scene manager frame buffer scaling up, each unit moves 5% of the way to the scale meeting the GPU budget per frame");
 	REGISTER_CVAR(osm_fbMinScale, 0.66f, VF_NULL, "The minimum scale factor the overload scene manager will drop to");
+	REGISTER_CVAR(osm_fbMaxScale, 1.0f, VF_NULL, "The maximum scale factor the overload scene manager will raise to. At most 1, the scene renders into a sub-rect of the full size targets");
+
+	REGISTER_CVAR(osm_budgetScaling, 1, VF_NULL, "Enables scaling of registered subsystem quality hooks (particles, view distance, shadows, animation, vegetation)\n"
+	                                             "when the main thread, render thread, worker or GPU budget is exceeded. Requires osm_enabled");
+	REGISTER_CVAR(osm_budgetMainThread, 0.0f, VF_NULL, "Main thread budget in ms, excluding the wait for the render thread. 0 = frame time of osm_targetFPS");
+	REGISTER_CVAR(osm_budgetRenderThread, 0.0f, VF_NULL, "Render thread budget in ms, excluding the waits for main thread and GPU. 0 = frame time of osm_targetFPS");
+	REGISTER_CVAR(osm_budgetGPU, 0.0f, VF_NULL, "GPU budget in ms. 0 = frame time of osm_targetFPS. Hooks only see the GPU budget once the framebuffer scale is at osm_fbMinScale");
+	REGISTER_CVAR(osm_budgetWorkers, 85.0f, VF_NULL, "Average worker thread utilization budget in percent");
+	REGISTER_CVAR(osm_budgetHysteresis, 0.15f, VF_NULL, "Hooks are only raised again when all their budgets are below (1 - this value) of the budget");
+	REGISTER_CVAR(osm_budgetStep, 0.1f, VF_NULL, "Quality level change per hook adjustment");
+	REGISTER_CVAR(osm_budgetCooldown, 1.0f, VF_NULL, "Seconds between two adjustments affecting the same budget, raising waits twice as long");
 
 	REGISTER_COMMAND("osm_setFBScale", cmd_setFBScale, VF_NULL, "Sets the framebuffer scale to either a single scale on both X and Y, or independent scales.\n"
 	                                                            "NOTE: Will be overridden immediately if Overload scene manager is still enabled - see osm_enabled");
@@ -159,6 +247,7 @@ void COverloadSceneManager::Reset()
 	gEnv->pStatoscope->AddUserMarker("Overload", "OverloadSceneManager::Reset()");
 
 	ResetDefaultValues();
+	ResetHooks();
 
 	gEnv->pRenderer->SetViewportDownscale(m_fbScale, m_fbScale);
 }
@@ -172,15 +261,22 @@ void COverloadSceneManager::ResetDefaultValues()
 	m_lerpAuto.m_start = m_lerpAuto.m_length = 1.0f;
 	m_lerpAuto.m_reversed = true;
 	m_fbAutoScale = m_fbOverrideDestScale = m_fbOverrideCurScale = 1.0f;
+	m_overBudgetMask = 0;
+	for (float& adjustTime : m_budgetAdjustTime)
+		adjustTime = 0.0f;
 
 	// completely reset history
 	for (int i = 0; i < osm_historyLength; i++)
 	{
 		SScenePerformanceStats& stats = m_sceneStats[i];
+		stats.Reset();
 		stats.frameRate = stats.gpuFrameRate = osm_targetFPS;
+		stats.gpuTime = GetGPUBudget();
 	}
 
+	m_smoothedSceneStats.Reset();
 	m_smoothedSceneStats.frameRate = m_smoothedSceneStats.gpuFrameRate = osm_targetFPS;
+	m_smoothedSceneStats.gpuTime = GetGPUBudget();
 }
 //-------------------------------------------------------------------------------------------------
 
@@ -195,6 +291,7 @@ void COverloadSceneManager::Update()
 
 	UpdateStats();
 	ResizeFB();
+	UpdateBudgets();
 
 #if DEBUG_OVERLOAD_SCENE_MANAGER
 	DebugDrawDisplay();
@@ -279,11 +376,32 @@ void COverloadSceneManager::UpdateStats()
 	currentStats.frameRate = frameLength > 0.0f ? 1000.0f / frameLength : 0.0f;
 	currentStats.gpuFrameRate = gpuFrameLength > 0.0f ? 1000.0f / gpuFrameLength : 0.0f;
 
+	// Same split as the statoscope threading data group: loads exclude the time spent waiting on each other
+	IRenderer::SRenderTimes renderTimes;
+	gEnv->pRenderer->GetRenderTimes(renderTimes);
+	currentStats.mainThreadTime = max(frameLength - renderTimes.fWaitForRender * 1000.0f, 0.0f);
+	currentStats.renderThreadTime = max((renderTimes.fTimeProcessedRT - renderTimes.fWaitForGPU) * 1000.0f, 0.0f);
+	currentStats.gpuTime = gpuFrameLength;
+
+	currentStats.workerUtilization = 0.0f;
+#if defined(JOBMANAGER_SUPPORT_FRAMEPROFILER)
+	if (JobManager::IBackend* pBackend = gEnv->GetJobManager()->GetBackEnd(JobManager::eBET_Thread))
+	{
+		if (JobManager::IWorkerBackEndProfiler* pProfiler = pBackend->GetBackEndWorkerProfiler())
+		{
+			JobManager::SWorkerFrameStatsSummary summary;
+			pProfiler->GetFrameStatsSummary(summary);
+			currentStats.workerUtilization = summary.nAvgUtilPerc;
+		}
+	}
+#endif
+
 #if DEBUG_OVERLOAD_SCENE_MANAGER
 	if (osm_stress)
 	{
 		float curTime = gEnv->pTimer->GetCurrTime();
 		currentStats.gpuFrameRate = 25.0f + sinf(curTime) * cry_random(0.0f, 10.0f);
+		currentStats.gpuTime = 1000.0f / currentStats.gpuFrameRate;
 	}
 #endif
 
@@ -299,10 +417,18 @@ void COverloadSceneManager::CalculateSmoothedStats()
 		SScenePerformanceStats& stats = m_sceneStats[i];
 		m_smoothedSceneStats.frameRate += stats.frameRate;
 		m_smoothedSceneStats.gpuFrameRate += stats.gpuFrameRate;
+		m_smoothedSceneStats.mainThreadTime += stats.mainThreadTime;
+		m_smoothedSceneStats.renderThreadTime += stats.renderThreadTime;
+		m_smoothedSceneStats.gpuTime += stats.gpuTime;
+		m_smoothedSceneStats.workerUtilization += stats.workerUtilization;
 	}
 
 	m_smoothedSceneStats.frameRate /= osm_historyLength;
 	m_smoothedSceneStats.gpuFrameRate /= osm_historyLength;
+	m_smoothedSceneStats.mainThreadTime /= osm_historyLength;
+	m_smoothedSceneStats.renderThreadTime /= osm_historyLength;
+	m_smoothedSceneStats.gpuTime /= osm_historyLength;
+	m_smoothedSceneStats.workerUtilization /= osm_historyLength;
 }
 
 float COverloadSceneManager::CalcFBScale()
@@ -324,22 +450,46 @@ float COverloadSceneManager::CalcFBScale()
 	return LERP(m_fbAutoScale, curOverrideScale, delta);
 }
 
-void COverloadSceneManager::ResizeFB()
+//--------------------------------------------------------------------------------------------------
+// Name: StepAutoScale
+// Desc: Moves the framebuffer scale part of the way to the scale at which the GPU time meets the
+//       budget. The GPU time is taken to grow with the pixel count, so with the square of the scale.
+//       The parts of the frame that don't scale make this estimate fall short, it never overshoots.
+//--------------------------------------------------------------------------------------------------
+float COverloadSceneManager::StepAutoScale(float scale, float gpuTime, float gpuBudget, float tolerance, float rateDown, float rateUp, float minScale, float maxScale)
 {
-	// don't do anything for invalid framerates
-	if (m_smoothedSceneStats.gpuFrameRate < 5.0f || m_smoothedSceneStats.gpuFrameRate > 100.0f)
+	if (gpuTime > 0.0f && gpuBudget > 0.0f)
 	{
-		return;
+		const float ratio = gpuTime / gpuBudget;
+		if (fabsf(ratio - 1.0f) > tolerance)
+		{
+			const float targetScale = scale * sqrt_tpl(1.0f / ratio);
+			scale = LERP(scale, targetScale, clamp_tpl(ratio > 1.0f ? rateDown : rateUp, 0.0f, 1.0f));
+		}
 	}
 
-	float fpsDiff = fabsf(m_smoothedSceneStats.gpuFrameRate - osm_targetFPS);
+	return clamp_tpl(scale, minScale, max(minScale, maxScale));
+}
+
+float COverloadSceneManager::GetGPUBudget() const
+{
+	if (osm_budgetGPU > 0.0f)
+		return osm_budgetGPU;
+	return osm_targetFPS > 0.0f ? 1000.0f / osm_targetFPS : 0.0f;
+}
 
-	if (m_smoothedSceneStats.gpuFrameRate < osm_targetFPS - osm_targetFPSTolerance)
-		m_fbAutoScale -= osm_fbScaleDeltaDown / 1000.0f * fpsDiff;
-	else if (m_smoothedSceneStats.gpuFrameRate > osm_targetFPS + osm_targetFPSTolerance)
-		m_fbAutoScale += osm_fbScaleDeltaUp / 1000.0f * fpsDiff;
+void COverloadSceneManager::ResizeFB()
+{
+	// don't do anything for invalid GPU times, frames this long are loading hitches
+	if (m_smoothedSceneStats.gpuTime <= 0.0f || m_smoothedSceneStats.gpuTime > 200.0f)
+	{
+		return;
+	}
 
-	m_fbAutoScale = clamp_tpl(m_fbAutoScale, osm_fbMinScale, 1.0f);
+	// a fast GPU raises the scale up to the maximum, the tolerance band is the one of the target frame rate
+	const float tolerance = osm_targetFPS > 0.0f ? osm_targetFPSTolerance / osm_targetFPS : 0.0f;
+	m_fbAutoScale = StepAutoScale(m_fbAutoScale, m_smoothedSceneStats.gpuTime, GetGPUBudget(), tolerance,
+	                              osm_fbScaleDeltaDown * 0.05f, osm_fbScaleDeltaUp * 0.05f, osm_fbMinScale, min(osm_fbMaxScale, 1.0f));
 
 #if DEBUG_OVERLOAD_SCENE_MANAGER
 	if (osm_stress == 2)
@@ -353,6 +503,193 @@ void COverloadSceneManager::ResizeFB()
 	gEnv->pRenderer->SetViewportDownscale(m_fbScale, m_fbScale);
 }
 
+//--------------------------------------------------------------------------------------------------
+// Name: RegisterScalabilityHook and UnregisterScalabilityHook
+// Desc: Hooks are kept in registration order, which is the order they are lowered in
+//--------------------------------------------------------------------------------------------------
+void COverloadSceneManager::RegisterScalabilityHook(IOverloadScalabilityHook* pHook, uint32 budgetMask, float minLevel)
+{
+	if (!pHook)
+		return;
+
+	for (SScalabilityHook& hook : m_hooks)
+	{
+		if (hook.pHook == pHook)
+		{
+			hook.budgetMask = budgetMask;
+			hook.minLevel = clamp_tpl(minLevel, 0.0f, 1.0f);
+			return;
+		}
+	}
+
+	SScalabilityHook hook;
+	hook.pHook = pHook;
+	hook.budgetMask = budgetMask;
+	hook.minLevel = clamp_tpl(minLevel, 0.0f, 1.0f);
+	hook.level = 1.0f;
+	m_hooks.push_back(hook);
+}
+
+void COverloadSceneManager::UnregisterScalabilityHook(IOverloadScalabilityHook* pHook)
+{
+	for (auto it = m_hooks.begin(); it != m_hooks.end(); ++it)
+	{
+		if (it->pHook == pHook)
+		{
+			if (it->level < 1.0f)
+				pHook->SetQualityLevel(1.0f);
+			m_hooks.erase(it);
+			return;
+		}
+	}
+}
+
+void COverloadSceneManager::ResetHooks()
+{
+	for (SScalabilityHook& hook : m_hooks)
+	{
+		if (hook.level < 1.0f)
+		{
+			hook.level = 1.0f;
+			hook.pHook->SetQualityLevel(1.0f);
+		}
+	}
+	m_overBudgetMask = 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Name: CreateDefaultHooks
+// Desc: Wraps the engine scalability cvars, created on first use since the 3D engine and
+//       animation cvars don't exist yet when the overload scene manager is constructed
+//--------------------------------------------------------------------------------------------------
+void COverloadSceneManager::CreateDefaultHooks()
+{
+	m_bDefaultHooksCreated = true;
+
+	// Default hooks go before any hooks registered so far, those take priority below them
+	std::vector<SScalabilityHook> registeredHooks;
+	registeredHooks.swap(m_hooks);
+
+	for (const auto& desc : s_defaultScalabilityHooks)
+	{
+		if (ICVar* pCVar = gEnv->pConsole->GetCVar(desc.szCVar))
+		{
+			m_defaultHooks.emplace_back(new CCVarScalabilityHook(desc.szName, pCVar, desc.lowScale));
+			RegisterScalabilityHook(m_defaultHooks.back().get(), desc.budgetMask, 0.0f);
+		}
+	}
+
+	m_hooks.insert(m_hooks.end(), registeredHooks.begin(), registeredHooks.end());
+}
+
+//--------------------------------------------------------------------------------------------------
+// Name: UpdateBudgets
+// Desc: Lowers the first hook of every exceeded budget and raises the last lowered hook once all of
+//       its budgets have headroom. The cooldown and the hysteresis band keep this from oscillating.
+//--------------------------------------------------------------------------------------------------
+void COverloadSceneManager::UpdateBudgets()
+{
+	if (!osm_budgetScaling)
+	{
+		if (m_overBudgetMask || !m_hooks.empty())
+			ResetHooks();
+		return;
+	}
+
+	if (!m_bDefaultHooksCreated)
+		CreateDefaultHooks();
+
+	const float frameBudget = osm_targetFPS > 0.0f ? 1000.0f / osm_targetFPS : 0.0f;
+	const float budgets[eBudget_Count] =
+	{
+		osm_budgetMainThread > 0.0f ? osm_budgetMainThread : frameBudget,
+		osm_budgetRenderThread > 0.0f ? osm_budgetRenderThread : frameBudget,
+		osm_budgetWorkers,
+		GetGPUBudget(),
+	};
+	const float loads[eBudget_Count] =
+	{
+		m_smoothedSceneStats.mainThreadTime,
+		m_smoothedSceneStats.renderThreadTime,
+		m_smoothedSceneStats.workerUtilization,
+		m_smoothedSceneStats.gpuTime,
+	};
+
+	uint32 overMask = 0, underMask = 0;
+	for (int i = 0; i < eBudget_Count; i++)
+	{
+		if (budgets[i] <= 0.0f || loads[i] <= 0.0f)
+		{
+			underMask |= BIT(i);   // untracked budgets never block recovery
+			continue;
+		}
+		if (loads[i] > budgets[i])
+			overMask |= BIT(i);
+		else if (loads[i] < budgets[i] * (1.0f - osm_budgetHysteresis))
+			underMask |= BIT(i);
+	}
+
+	// Resolution scaling handles the GPU first, the hooks only step in once it has bottomed out
+	if (m_fbScale > osm_fbMinScale + 0.01f)
+		overMask &= ~eOverloadBudget_GPU;
+
+	m_overBudgetMask = overMask;
+
+	const float curTime = gEnv->pTimer->GetCurrTime();
+	const float step = max(osm_budgetStep, 0.01f);
+
+	for (int i = 0; i < eBudget_Count; i++)
+	{
+		const uint32 budget = BIT(i);
+		if (!(overMask & budget) || curTime - m_budgetAdjustTime[i] < osm_budgetCooldown)
+			continue;
+
+		for (SScalabilityHook& hook : m_hooks)
+		{
+			if ((hook.budgetMask & budget) && hook.level > hook.minLevel)
+			{
+				hook.level = max(hook.level - step, hook.minLevel);
+				hook.pHook->SetQualityLevel(hook.level);
+				for (int j = 0; j < eBudget_Count; j++)
+				{
+					if (hook.budgetMask & BIT(j))
+						m_budgetAdjustTime[j] = curTime;
+				}
+				break;
+			}
+		}
+	}
+
+	if (overMask)
+		return;
+
+	// Raise a single hook per update, the last one lowered first
+	for (auto it = m_hooks.rbegin(); it != m_hooks.rend(); ++it)
+	{
+		SScalabilityHook& hook = *it;
+		if (hook.level >= 1.0f || (hook.budgetMask & underMask) != hook.budgetMask)
+			continue;
+
+		bool bCooledDown = true;
+		for (int j = 0; j < eBudget_Count; j++)
+		{
+			if ((hook.budgetMask & BIT(j)) && curTime - m_budgetAdjustTime[j] < osm_budgetCooldown * 2.0f)
+				bCooledDown = false;
+		}
+		if (!bCooledDown)
+			break;
+
+		hook.level = min(hook.level + step, 1.0f);
+		hook.pHook->SetQualityLevel(hook.level);
+		for (int j = 0; j < eBudget_Count; j++)
+		{
+			if (hook.budgetMask & BIT(j))
+				m_budgetAdjustTime[j] = curTime;
+		}
+		break;
+	}
+}
+
 #if DEBUG_OVERLOAD_SCENE_MANAGER
 //--------------------------------------------------------------------------------------------------
 // Name: DebugDrawDisplay
@@ -368,6 +705,23 @@ void COverloadSceneManager::DebugDrawDisplay()
 		static float textSize = 1.4f;
 		IRenderAuxText::Draw2dLabel(textPos.x, textPos.y, textSize, &textCol.r, false, "Overload Scene Manager debug view");
 
+		static const ColorF overCol(1.0f, 0.3f, 0.3f, 1.0f);
+		const SScenePerformanceStats& stats = m_smoothedSceneStats;
+		float y = textPos.y + 20.0f;
+		IRenderAuxText::Draw2dLabel(textPos.x, y, 1.2f, (m_overBudgetMask ? &overCol.r : &textCol.r), false,
+		                            "MT %.1fms  RT %.1fms  GPU %.1fms  Workers %.0f%%  FB scale %.2f",
+		                            stats.mainThreadTime, stats.renderThreadTime, stats.gpuTime, stats.workerUtilization, m_fbScale);
+		for (const SScalabilityHook& hook : m_hooks)
+		{
+			y += 14.0f;
+			IRenderAuxText::Draw2dLabel(textPos.x, y, 1.2f, (hook.budgetMask & m_overBudgetMask) ? &overCol.r : &textCol.r, false,
+			                            "%-26s %.2f%s%s%s%s", hook.pHook->GetName(), hook.level,
+			                            (hook.budgetMask & eOverloadBudget_MainThread) ? " MT" : "",
+			                            (hook.budgetMask & eOverloadBudget_RenderThread) ? " RT" : "",
+			                            (hook.budgetMask & eOverloadBudget_Workers) ? " Workers" : "",
+			                            (hook.budgetMask & eOverloadBudget_GPU) ? " GPU" : "");
+		}
+
 		DebugDrawGraphs();
 	}
 }//-------------------------------------------------------------------------------------------------
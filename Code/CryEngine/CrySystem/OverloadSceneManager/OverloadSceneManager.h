@@ -38,10 +38,20 @@ struct SScenePerformanceStats
 	{
 		frameRate = 0.0f;
 		gpuFrameRate = 0.0f;
+		mainThreadTime = 0.0f;
+		renderThreadTime = 0.0f;
+		gpuTime = 0.0f;
+		workerUtilization = 0.0f;
 	}
 
 	float frameRate;
 	float gpuFrameRate;
+
+	// per budget load, times in ms without the time spent waiting on the other threads
+	float mainThreadTime;
+	float renderThreadTime;
+	float gpuTime;
+	float workerUtilization; // average worker utilization in percent
 };//------------------------------------------------------------------------------------------------
 
 //==================================================================================================
@@ -67,13 +77,33 @@ public:
 	virtual void OverrideScale(float frameScale, float dt);
 	virtual void ResetScale(float dt);
 
+	virtual void RegisterScalabilityHook(IOverloadScalabilityHook* pHook, uint32 budgetMask, float minLevel);
+	virtual void UnregisterScalabilityHook(IOverloadScalabilityHook* pHook);
+
+	// one update of the automatic framebuffer scale, times in ms, tolerance relative to the budget
+	static float StepAutoScale(float scale, float gpuTime, float gpuBudget, float tolerance, float rateDown, float rateUp, float minScale, float maxScale);
+
 private:
 
+	enum { eBudget_Count = 4 };
+
+	struct SScalabilityHook
+	{
+		IOverloadScalabilityHook* pHook;
+		uint32                    budgetMask;
+		float                     minLevel;
+		float                     level;
+	};
+
 	void  ResetDefaultValues();
 	void  InitialiseCVars();
 	void  UpdateStats();
 	void  CalculateSmoothedStats();
 	void  ResizeFB();
+	float GetGPUBudget() const; // osm_budgetGPU, or the frame time of osm_targetFPS
+	void  CreateDefaultHooks();
+	void  UpdateBudgets();
+	void  ResetHooks();
 
 	float CalcFBScale();       // performs all lerping and returns final framebuffer scale
 
@@ -92,7 +122,12 @@ private:
 	float                  osm_targetFPS;
 	float                  osm_targetFPSTolerance;
 	float                  osm_fbScaleDeltaUp, osm_fbScaleDeltaDown;
-	float                  osm_fbMinScale;
+	float                  osm_fbMinScale, osm_fbMaxScale;
+	int                    osm_budgetScaling;
+	float                  osm_budgetMainThread, osm_budgetRenderThread, osm_budgetGPU, osm_budgetWorkers;
+	float                  osm_budgetHysteresis;
+	float                  osm_budgetStep;
+	float                  osm_budgetCooldown;
 
 	SScenePerformanceStats m_smoothedSceneStats;
 	SScenePerformanceStats m_sceneStats[SCENE_PERFORMANCE_FRAME_HISTORY];
@@ -101,6 +136,13 @@ private:
 	// current output scale, set to the renderer
 	float m_fbScale;
 
+	// Budget scaling: hooks in priority order, lowered front to back and raised back to front
+	std::vector<SScalabilityHook>                           m_hooks;
+	std::vector<std::unique_ptr<IOverloadScalabilityHook>> m_defaultHooks;
+	float  m_budgetAdjustTime[eBudget_Count]; // last time a hook of this budget was changed
+	uint32 m_overBudgetMask;
+	bool   m_bDefaultHooksCreated;
+
 	// Lerping behaviour is to lerp from autoscale to (lerp between cur/dest override)
 	//
 	//                                        m_fbOverrideCurScale
@@ -0,0 +1,83 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "StdAfx.h"
+#include "OverloadSceneManager.h"
+#include <CrySystem/CryUnitTest.h>
+
+#if defined(CRY_UNIT_TESTING)
+
+CRY_UNIT_TEST_SUITE(OverloadSceneManagerFBScale)
+{
+	// the defaults of osm_targetFPS, osm_targetFPSTolerance, osm_fbScaleDeltaDown/Up and osm_fbMinScale as ResizeFB passes them
+	const float k_budget = 1000.0f / 28.0f;
+	const float k_tolerance = 1.0f / 28.0f;
+	const float k_rateDown = 5.0f * 0.05f;
+	const float k_rateUp = 1.0f * 0.05f;
+	const float k_minScale = 0.66f;
+
+	// a GPU frame with a part that scales with the pixel count and a part that doesn't (shadows, post, UI)
+	struct SGPUFrame
+	{
+		SGPUFrame(float fixedTime, float scaledTime) : fixedTime(fixedTime), scaledTime(scaledTime) {}
+
+		float GetTime(float scale) const { return fixedTime + scaledTime * scale * scale; }
+
+		// runs the controller for a few seconds of frames, returns false if the scale ever turned around
+		bool Run(float& scale, float maxScale, int frameCount = 300) const
+		{
+			float prevStep = 0.0f;
+			for (int i = 0; i < frameCount; ++i)
+			{
+				const float newScale = COverloadSceneManager::StepAutoScale(scale, GetTime(scale), k_budget, k_tolerance, k_rateDown, k_rateUp, k_minScale, maxScale);
+				const float step = newScale - scale;
+				if (step * prevStep < 0.0f)
+					return false;
+				if (step != 0.0f)
+					prevStep = step;
+				scale = newScale;
+			}
+			return true;
+		}
+
+		float fixedTime;
+		float scaledTime;
+	};
+
+	CRY_UNIT_TEST(CUT_FBScaleSettlesWithinBudget)
+	{
+		// 40ms at full resolution has to come down to the budget
+		const SGPUFrame frame(4.0f, 36.0f);
+		float scale = 1.0f;
+		CRY_UNIT_TEST_ASSERT(frame.Run(scale, 1.0f));
+		CRY_UNIT_TEST_ASSERT(scale < 1.0f && scale > k_minScale);
+		CRY_UNIT_TEST_ASSERT(fabsf(frame.GetTime(scale) / k_budget - 1.0f) <= k_tolerance + 0.001f);
+
+		// and goes back up once the load drops
+		const SGPUFrame lighterFrame(4.0f, 32.0f);
+		const float loadedScale = scale;
+		CRY_UNIT_TEST_ASSERT(lighterFrame.Run(scale, 1.0f));
+		CRY_UNIT_TEST_ASSERT(scale > loadedScale);
+		CRY_UNIT_TEST_ASSERT(fabsf(lighterFrame.GetTime(scale) / k_budget - 1.0f) <= k_tolerance + 0.001f);
+	}
+
+	CRY_UNIT_TEST(CUT_FBScaleKeepsToBounds)
+	{
+		// far over budget, the scale stops at the minimum
+		float scale = 1.0f;
+		CRY_UNIT_TEST_ASSERT(SGPUFrame(4.0f, 100.0f).Run(scale, 1.0f));
+		CRY_UNIT_TEST_CHECK_EQUAL(scale, k_minScale);
+
+		// a fast GPU, far above the target frame rate, goes up to the maximum
+		CRY_UNIT_TEST_ASSERT(SGPUFrame(1.0f, 4.0f).Run(scale, 1.0f));
+		CRY_UNIT_TEST_CHECK_EQUAL(scale, 1.0f);
+		CRY_UNIT_TEST_ASSERT(SGPUFrame(1.0f, 4.0f).Run(scale, 0.9f));
+		CRY_UNIT_TEST_CHECK_EQUAL(scale, 0.9f);
+
+		// without a GPU time or budget the scale only gets clamped
+		CRY_UNIT_TEST_CHECK_EQUAL(COverloadSceneManager::StepAutoScale(0.8f, 0.0f, k_budget, k_tolerance, k_rateDown, k_rateUp, k_minScale, 1.0f), 0.8f);
+		CRY_UNIT_TEST_CHECK_EQUAL(COverloadSceneManager::StepAutoScale(0.8f, 50.0f, 0.0f, k_tolerance, k_rateDown, k_rateUp, k_minScale, 1.0f), 0.8f);
+		CRY_UNIT_TEST_CHECK_EQUAL(COverloadSceneManager::StepAutoScale(0.5f, 0.0f, k_budget, k_tolerance, k_rateDown, k_rateUp, k_minScale, 1.0f), k_minScale);
+	}
+}
+
+#endif // CRY_UNIT_TESTING
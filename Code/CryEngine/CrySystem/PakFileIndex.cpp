@@ -0,0 +1,188 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "StdAfx.h"
+#include "PakFileIndex.h"
+#include "ZipDir.h"
+
+namespace
+{
+uint32 CountFiles(const ZipDir::DirHeader* pDir)
+{
+	uint32 nFiles = pDir->numFiles;
+	for (uint32 i = 0; i < pDir->numDirs; ++i)
+		nFiles += CountFiles(pDir->GetSubdirEntry(i)->GetDirectory());
+	return nFiles;
+}
+}
+
+//////////////////////////////////////////////////////////////////////////
+uint64 CPakFileIndex::HashPath(const char* szPath, uint64 nHash)
+{
+	// FNV-1a
+	for (const char* p = szPath; *p; ++p)
+	{
+		char c = *p;
+		if (c == '\\')
+			c = '/';
+		else if (c >= 'A' && c <= 'Z')
+			c += 'a' - 'A';
+		nHash = (nHash ^ (uint8)c) * 0x100000001b3ULL;
+	}
+	return nHash;
+}
+
+//////////////////////////////////////////////////////////////////////////
+CPakFileIndex::CPakFileIndex()
+	: m_nUsed(0)
+	, m_nRemoved(0)
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CPakFileIndex::AddPack(uint32 nPackId, const char* szBindRoot, ZipDir::Cache* pZip)
+{
+	assert(nPackId != ePackId_Free && nPackId != ePackId_Removed);
+
+	const ZipDir::DirHeader* pRoot = pZip->GetRoot();
+	if (!pRoot)
+		return false;
+
+	Reserve(m_nUsed + CountFiles(pRoot));
+	AddDir(pZip, pRoot, HashPath(szBindRoot), nPackId, string(), m_dirPaths[nPackId]);
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CPakFileIndex::AddDir(const ZipDir::Cache* pZip, const ZipDir::DirHeader* pDir, uint64 nPrefixHash, uint32 nPackId, const string& dirPath, DirPaths& dirPaths)
+{
+	const char* pNamePool = pDir->GetNamePool();
+	const uint8* pData = (const uint8*)pZip->GetDataPointer();
+
+	const uint32 nDirIndex = (uint32)dirPaths.size();
+	dirPaths.push_back(dirPath);
+
+	for (uint32 i = 0; i < pDir->numFiles; ++i)
+	{
+		const ZipDir::FileEntry* pFileEntry = pDir->GetFileEntry(i);
+		Insert(HashPath(pFileEntry->GetName(pNamePool), nPrefixHash), nPackId, (uint32)((const uint8*)pFileEntry - pData), nDirIndex);
+	}
+
+	for (uint32 i = 0; i < pDir->numDirs; ++i)
+	{
+		const ZipDir::DirEntry* pDirEntry = pDir->GetSubdirEntry(i);
+		const char* szDirName = pDirEntry->GetName(pNamePool);
+		AddDir(pZip, pDirEntry->GetDirectory(), HashPath("/", HashPath(szDirName, nPrefixHash)), nPackId, dirPath + szDirName + "/", dirPaths);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CPakFileIndex::IsSameDirPath(const char* szDirPath, const char* szPath, size_t nLength)
+{
+	for (size_t i = 0; i < nLength; ++i)
+	{
+		char a = szDirPath[i];
+		char b = szPath[i];
+		if (!a)
+			return false;
+		if (a == '\\')
+			a = '/';
+		if (b == '\\')
+			b = '/';
+		if (a != b && tolower((uint8)a) != tolower((uint8)b))
+			return false;
+	}
+	return szDirPath[nLength] == 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CPakFileIndex::RemovePack(uint32 nPackId)
+{
+	for (SSlot& slot : m_slots)
+	{
+		if (slot.nPackId == nPackId)
+		{
+			slot.nPackId = ePackId_Removed;
+			--m_nUsed;
+			++m_nRemoved;
+		}
+	}
+	m_dirPaths.erase(nPackId);
+}
+
+//////////////////////////////////////////////////////////////////////////
+uint32 CPakFileIndex::Find(uint64 nHash, SCandidate* pCandidates, uint32 nMaxCandidates) const
+{
+	if (m_slots.empty())
+		return 0;
+
+	uint32 nFound = 0;
+	const size_t nMask = m_slots.size() - 1;
+	for (size_t i = (size_t)nHash & nMask; m_slots[i].nPackId != ePackId_Free; i = (i + 1) & nMask)
+	{
+		const SSlot& slot = m_slots[i];
+		if (slot.nHash == nHash && slot.nPackId != ePackId_Removed)
+		{
+			if (nFound < nMaxCandidates)
+			{
+				pCandidates[nFound].nPackId = slot.nPackId;
+				pCandidates[nFound].nFileEntryOffset = slot.nFileEntryOffset;
+				pCandidates[nFound].szDirPath = m_dirPaths.find(slot.nPackId)->second[slot.nDirIndex].c_str();
+			}
+			++nFound;
+		}
+	}
+	return nFound;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CPakFileIndex::Insert(uint64 nHash, uint32 nPackId, uint32 nFileEntryOffset, uint32 nDirIndex)
+{
+	// the same path can be in several paks, these are separate entries
+	const size_t nMask = m_slots.size() - 1;
+	size_t i = (size_t)nHash & nMask;
+	while (m_slots[i].nPackId != ePackId_Free && m_slots[i].nPackId != ePackId_Removed)
+		i = (i + 1) & nMask;
+
+	if (m_slots[i].nPackId == ePackId_Removed)
+		--m_nRemoved;
+
+	m_slots[i].nHash = nHash;
+	m_slots[i].nPackId = nPackId;
+	m_slots[i].nFileEntryOffset = nFileEntryOffset;
+	m_slots[i].nDirIndex = nDirIndex;
+	++m_nUsed;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CPakFileIndex::Reserve(size_t nEntries)
+{
+	// keep the load (including removed slots) below 50% so that most lookups are a single probe
+	if ((nEntries + m_nRemoved) * 2 <= m_slots.size())
+		return;
+
+	size_t nSize = 1024;
+	while (nSize < nEntries * 2)
+		nSize *= 2;
+
+	std::vector<SSlot> oldSlots(nSize);
+	oldSlots.swap(m_slots);
+	for (SSlot& slot : m_slots)
+		slot.nPackId = ePackId_Free;
+
+	m_nUsed = 0;
+	m_nRemoved = 0;
+	for (const SSlot& slot : oldSlots)
+	{
+		if (slot.nPackId != ePackId_Free && slot.nPackId != ePackId_Removed)
+			Insert(slot.nHash, slot.nPackId, slot.nFileEntryOffset, slot.nDirIndex);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CPakFileIndex::GetMemoryUsage(ICrySizer* pSizer) const
+{
+	pSizer->AddContainer(m_slots);
+	pSizer->AddHashMap(m_dirPaths);
+	for (const auto& dirPaths : m_dirPaths)
+		pSizer->AddObject(dirPaths.second);
+}
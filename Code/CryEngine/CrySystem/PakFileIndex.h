@@ -0,0 +1,78 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#ifndef _CRY_SYSTEM_PAK_FILE_INDEX_HDR_
+#define _CRY_SYSTEM_PAK_FILE_INDEX_HDR_
+
+namespace ZipDir
+{
+struct Cache;
+struct DirHeader;
+struct FileEntry;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Open addressing hash table of the full paths (bind root + path in the pak) of all files in all mounted paks.
+// A full path lookup is a single probe instead of a directory tree walk in every pak.
+// The index doesn't know about the pak priorities and flags, CCryPak::FindPakFileEntry
+// picks the candidate of the pak with the highest priority.
+// Different paths can have the same hash, so every candidate carries the directory path
+// it was found in; together with the file entry name that gives the full path to compare.
+// Access is guarded by CCryPak::m_csZips.
+//////////////////////////////////////////////////////////////////////////
+class CPakFileIndex
+{
+public:
+	struct SCandidate
+	{
+		uint32      nPackId;
+		uint32      nFileEntryOffset; // relative to ZipDir::Cache::GetDataPointer()
+		const char* szDirPath;        // path in the pak with a trailing '/', empty for the root
+	};
+
+	// case insensitive, '/' and '\' hash the same; pass the hash of a prefix to continue it
+	static uint64 HashPath(const char* szPath, uint64 nHash = 0xcbf29ce484222325ULL);
+
+	CPakFileIndex();
+
+	// returns false if the pak can't be indexed (its file names are stored as CRC32)
+	bool AddPack(uint32 nPackId, const char* szBindRoot, ZipDir::Cache* pZip);
+	void RemovePack(uint32 nPackId);
+
+	// fills in the files with the given path hash, returns their number,
+	// which is larger than nMaxCandidates if they didn't all fit
+	uint32 Find(uint64 nHash, SCandidate* pCandidates, uint32 nMaxCandidates) const;
+
+	// case insensitive, '/' and '\' compare the same
+	static bool IsSameDirPath(const char* szDirPath, const char* szPath, size_t nLength);
+
+	size_t GetNumEntries() const { return m_nUsed; }
+	void   GetMemoryUsage(ICrySizer* pSizer) const;
+
+private:
+	enum : uint32
+	{
+		ePackId_Free    = 0,
+		ePackId_Removed = ~0u,
+	};
+
+	struct SSlot
+	{
+		uint64 nHash;
+		uint32 nPackId;
+		uint32 nFileEntryOffset;
+		uint32 nDirIndex; // into the directory paths of the pack
+	};
+
+	typedef std::vector<string> DirPaths;
+
+	void AddDir(const ZipDir::Cache* pZip, const ZipDir::DirHeader* pDir, uint64 nPrefixHash, uint32 nPackId, const string& dirPath, DirPaths& dirPaths);
+	void Insert(uint64 nHash, uint32 nPackId, uint32 nFileEntryOffset, uint32 nDirIndex);
+	void Reserve(size_t nEntries);
+
+	std::vector<SSlot>                   m_slots;
+	std::unordered_map<uint32, DirPaths> m_dirPaths; // by pack id
+	size_t                               m_nUsed;
+	size_t                               m_nRemoved;
+};
+
+#endif
@@ -28,9 +28,12 @@ struct PakVars
 	int nTotalInMemoryPakSizeLimit;
 	int nStreamCache;
 	int nInMemoryPerPakSizeLimit;
+	int nLevelCacheInMemorySizeLimit;
 	int nLogInvalidFileAccess;
 	int nLoadFrontendShaderCache;
 	int nUncachedStreamReads;
+	int nMapStoredFiles;
+	int nFileIndex;
 #ifndef _RELEASE
 	int nLogAllFileAccess;
 #endif
@@ -47,9 +50,12 @@ struct PakVars
 		, nSaveLevelResourceList(0)
 		, nValidateFileHashes(0)
 		, nUncachedStreamReads(1)
+		, nMapStoredFiles(0)
+		, nFileIndex(1)
 	{
 		nInMemoryPerPakSizeLimit = 6;    // 6 Megabytes limit
 		nTotalInMemoryPakSizeLimit = 30; // Megabytes
+		nLevelCacheInMemorySizeLimit = 10; // Megabytes
 
 		nLoadCache = 0;       // Load in memory paks from _FastLoad folder
 		nLoadModePaks = 0;    // Load menucommon/gamemodeswitch paks
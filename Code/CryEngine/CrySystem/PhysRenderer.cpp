@@ -363,7 +363,8 @@ void CPhysRenderer::DrawGeometry(IGeometry* pGeom, geom_world_data* pgwd, const
 
 	// handle opacity
 	ColorB clrNew = clr;
-	float fAlpha = gEnv->pConsole->GetCVar("p_draw_helpers_opacity")->GetFVal();
+	static CVarHandle<float> s_drawHelpersOpacity("p_draw_helpers_opacity");
+	float fAlpha = s_drawHelpersOpacity.Get(1.0f);
 	fAlpha = ::min(::max(0.0f, fAlpha), 1.0f);
 	if (fAlpha < 0.99) clrNew.set(clr.r, clr.g, clr.b, (uint8)(fAlpha * (float)clr.a));
 
@@ -390,7 +390,9 @@ bool CResourceManager::LoadLevelCachePak(const char* sPakName, const char* sBind
 	//and the paks can never be inside other paks so we optimise the search
 	uint32 nOpenPakFlags = ICryPak::FLAGS_FILENAMES_AS_CRC32 | ICryPak::FLAGS_CHECK_MOD_PATHS | ICryPak::FLAGS_NEVER_IN_PAK;
 
-	if (nFileSize < LEVEL_PAK_INMEMORY_MAXSIZE) // 10 megs.
+	// Paks used only during level loading are released at the end of it, so they can be prefetched past the 10 megs
+	const size_t nInMemoryMaxSize = bOnlyDuringLevelLoading ? (size_t)g_cvars.pakVars.nLevelCacheInMemorySizeLimit * 1024 * 1024 : LEVEL_PAK_INMEMORY_MAXSIZE;
+	if (nFileSize < nInMemoryMaxSize)
 	{
 		if (!(nOpenPakFlags & ICryPak::FLAGS_PAK_IN_MEMORY_CPU))
 			nOpenPakFlags |= ICryPak::FLAGS_PAK_IN_MEMORY;
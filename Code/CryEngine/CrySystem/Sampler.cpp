@@ -510,4 +510,328 @@ bool CSymbolDatabase::LookupFunctionName(uint64 ip, string& funcName, string& fi
 	return false;
 }
 
+#elif CRY_PLATFORM_LINUX
+	#include <CrySystem/ISystem.h>
+	#include <CryThreading/IThreadManager.h>
+	#include <CryThreading/IJobManager.h>
+	#include "IDebugCallStack.h"
+
+	#include <signal.h>
+	#include <ucontext.h>
+	#include <errno.h>
+
+namespace
+{
+// Written from the SIGPROF handler, which may only use async signal safe operations:
+// slots are reserved with an atomic increment and published with the ready flag.
+// The handler stays installed once the first sampling started and drops signals while sampling is disabled,
+// a signal queued by pthread_kill can arrive long after the sampling thread sent it.
+struct SRawSample
+{
+	uint64       ip;
+	threadID     threadId;
+	int64        ticks;
+	volatile int ready;
+};
+
+SRawSample*      s_pRawSamples = nullptr;
+int              s_nMaxRawSamples = 0;
+volatile int     s_nNextRawSample = 0;
+volatile bool    s_bSamplingEnabled = false;
+
+void SigProfHandler(int, siginfo_t*, void* pContext)
+{
+	if (!s_bSamplingEnabled)
+		return;
+
+	const int savedErrno = errno;
+
+	const int idx = CryInterlockedIncrement(&s_nNextRawSample) - 1;
+	if (idx < s_nMaxRawSamples)
+	{
+		const ucontext_t* pUContext = static_cast<const ucontext_t*>(pContext);
+		SRawSample& sample = s_pRawSamples[idx];
+	#if defined(__x86_64__)
+		sample.ip = (uint64)pUContext->uc_mcontext.gregs[REG_RIP];
+	#elif defined(__i386__)
+		sample.ip = (uint64)pUContext->uc_mcontext.gregs[REG_EIP];
+	#elif defined(__aarch64__)
+		sample.ip = (uint64)pUContext->uc_mcontext.pc;
+	#else
+		sample.ip = 0;
+	#endif
+		sample.threadId = threadID(pthread_self());
+		sample.ticks = CryGetTicks();
+		CryMT::CryMemoryBarrier();
+		sample.ready = 1;
+	}
+
+	errno = savedErrno;
+}
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Sends SIGPROF to all other registered threads every sample period.
+// The thread list is walked under the thread manager's lock so no thread
+// can exit while it is being signaled.
+//////////////////////////////////////////////////////////////////////////
+class CSamplingThread : public IThread
+{
+public:
+	CSamplingThread(int samplePeriodMs)
+		: m_samplePeriodMs(max(samplePeriodMs, 1))
+		, m_bStop(false)
+		, m_bFinished(false)
+	{}
+
+	void Stop()             { m_bStop = true; }
+	bool IsFinished() const { return m_bFinished; }
+
+	virtual void ThreadEntry() override
+	{
+		while (!m_bStop && s_nNextRawSample < s_nMaxRawSamples)
+		{
+			gEnv->pThreadManager->ForEachOtherThread(&SignalThread);
+			CrySleep(m_samplePeriodMs);
+		}
+		m_bFinished = true;
+	}
+
+private:
+	static void SignalThread(threadID nThreadId, void*)
+	{
+		pthread_kill((pthread_t)nThreadId, SIGPROF);
+	}
+
+	int           m_samplePeriodMs;
+	volatile bool m_bStop;
+	volatile bool m_bFinished;
+};
+
+//////////////////////////////////////////////////////////////////////////
+CSampler::CSampler()
+{
+	m_pSamplingThread = NULL;
+	m_nMaxSamples = 0;
+	SetMaxSamples(2000);
+	m_nProcessedSamples = 0;
+	m_bSampling = false;
+	m_bHandlerInstalled = false;
+	m_samplePeriodMs = 1; //1ms
+	m_startTicks = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+CSampler::~CSampler()
+{
+	if (m_pSamplingThread)
+	{
+		m_pSamplingThread->Stop();
+		gEnv->pThreadManager->JoinThread(m_pSamplingThread, eJM_Join);
+		SAFE_DELETE(m_pSamplingThread);
+	}
+	s_bSamplingEnabled = false;
+	CryMT::CryMemoryBarrier();
+	if (m_bHandlerInstalled)
+	{
+		// Ignored rather than restored, the default action would terminate the process on a late signal
+		struct sigaction action;
+		memset(&action, 0, sizeof(action));
+		action.sa_handler = SIG_IGN;
+		sigemptyset(&action.sa_mask);
+		sigaction(SIGPROF, &action, nullptr);
+		m_bHandlerInstalled = false;
+	}
+	delete[] s_pRawSamples;
+	s_pRawSamples = nullptr;
+	s_nMaxRawSamples = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CSampler::SetMaxSamples(int nMaxSamples)
+{
+	if (!m_bSampling)
+		m_nMaxSamples = max(nMaxSamples, 1);
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CSampler::Start()
+{
+	if (m_bSampling)
+		return;
+
+	CryLogAlways("Starting Sampling of all threads with interval %dms, max samples: %d ...", m_samplePeriodMs, m_nMaxSamples);
+
+	if (s_nMaxRawSamples != m_nMaxSamples)
+	{
+		delete[] s_pRawSamples;
+		s_pRawSamples = new SRawSample[m_nMaxSamples];
+	}
+	memset(s_pRawSamples, 0, sizeof(SRawSample) * m_nMaxSamples);
+	s_nNextRawSample = 0;
+	s_nMaxRawSamples = m_nMaxSamples;
+	CryMT::CryMemoryBarrier();
+
+	if (!m_bHandlerInstalled)
+	{
+		struct sigaction action;
+		memset(&action, 0, sizeof(action));
+		action.sa_sigaction = &SigProfHandler;
+		action.sa_flags = SA_SIGINFO | SA_RESTART;
+		sigemptyset(&action.sa_mask);
+		if (sigaction(SIGPROF, &action, nullptr) != 0)
+		{
+			CryWarning(VALIDATOR_MODULE_SYSTEM, VALIDATOR_WARNING, "Sampler: could not install the SIGPROF handler");
+			return;
+		}
+		m_bHandlerInstalled = true;
+	}
+
+	m_threadSamples.clear();
+	m_nProcessedSamples = 0;
+	m_startTicks = CryGetTicks();
+	m_startTime = gEnv->pTimer->GetAsyncTime();
+
+	s_bSamplingEnabled = true;
+	CryMT::CryMemoryBarrier();
+
+	m_pSamplingThread = new CSamplingThread(m_samplePeriodMs);
+	if (!gEnv->pThreadManager->SpawnThread(m_pSamplingThread, "ProfileSampler"))
+	{
+		CryWarning(VALIDATOR_MODULE_SYSTEM, VALIDATOR_WARNING, "Sampler: could not spawn the sampling thread");
+		SAFE_DELETE(m_pSamplingThread);
+		s_bSamplingEnabled = false;
+		return;
+	}
+	m_bSampling = true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CSampler::Stop()
+{
+	if (m_bSampling && m_pSamplingThread)
+		m_pSamplingThread->Stop();
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CSampler::Update()
+{
+	if (!m_bSampling)
+		return;
+
+	ProcessSamples();
+
+	if (!m_pSamplingThread->IsFinished())
+		return;
+
+	gEnv->pThreadManager->JoinThread(m_pSamplingThread, eJM_Join);
+	SAFE_DELETE(m_pSamplingThread);
+
+	// Late signals are dropped by the handler from now on, give the ones already past the check time to publish
+	s_bSamplingEnabled = false;
+	CryMT::CryMemoryBarrier();
+	CrySleep(max(m_samplePeriodMs, 1));
+
+	ProcessSamples();
+	m_bSampling = false;
+
+	LogSampledData();
+}
+
+//////////////////////////////////////////////////////////////////////////
+const string& CSampler::LookupFunctionName(uint64 ip)
+{
+	auto it = m_symbolCache.find(ip);
+	if (it != m_symbolCache.end())
+		return it->second;
+
+	string procName, fileName;
+	void* pBaseAddr = nullptr;
+	int line = 0;
+	IDebugCallStack::instance()->GetProcNameForAddr((void*)ip, procName, pBaseAddr, fileName, line);
+	return m_symbolCache.emplace(ip, procName).first->second;
+}
+
+//////////////////////////////////////////////////////////////////////////
+CSampler::SThreadSamples& CSampler::GetThreadSamples(threadID threadId)
+{
+	for (SThreadSamples& samples : m_threadSamples)
+	{
+		if (samples.threadId == threadId)
+			return samples;
+	}
+
+	m_threadSamples.push_back(SThreadSamples());
+	SThreadSamples& samples = m_threadSamples.back();
+	samples.threadId = threadId;
+	const char* szName = gEnv->pThreadManager->GetThreadName(threadId);
+	samples.name = (szName && szName[0]) ? szName : "Unknown";
+	samples.traceTrack = "Sampler " + samples.name;
+	return samples;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CSampler::ProcessSamples()
+{
+	IJobManager* pJobManager = gEnv->GetJobManager();
+	const bool bTrace = pJobManager && pJobManager->IsTraceCaptureRunning();
+	const CTimeValue samplePeriod((double)m_samplePeriodMs * 0.001);
+
+	// Slots are published in reservation order per thread, stop at the first one still being written
+	const int nAvailable = min((int)s_nNextRawSample, s_nMaxRawSamples);
+	for (; m_nProcessedSamples < nAvailable && s_pRawSamples[m_nProcessedSamples].ready; ++m_nProcessedSamples)
+	{
+		const SRawSample& sample = s_pRawSamples[m_nProcessedSamples];
+		const string& function = LookupFunctionName(sample.ip);
+		SThreadSamples& threadSamples = GetThreadSamples(sample.threadId);
+		threadSamples.funcCounts[function] += 1;
+
+		if (bTrace)
+		{
+			const CTimeValue time = m_startTime + CTimeValue((double)gEnv->pTimer->TicksToSeconds(sample.ticks - m_startTicks));
+			pJobManager->AddTraceEvent(threadSamples.traceTrack.c_str(), function.c_str(), "sample", time, time + samplePeriod);
+		}
+	}
+}
+
+inline bool CompareFunctionSamples(const CSampler::SFunctionSample& s1, const CSampler::SFunctionSample& s2)
+{
+	return s1.nSamples > s2.nSamples;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CSampler::LogSampledData()
+{
+	// Log sample info.
+	CryLogAlways("=========================================================================");
+	CryLogAlways("= Profiler Output (%d samples)", m_nProcessedSamples);
+	CryLogAlways("=========================================================================");
+
+	const uint32 nMaxFunctionsPerThread = 30;
+	std::vector<SFunctionSample> functionSamples;
+	for (const SThreadSamples& threadSamples : m_threadSamples)
+	{
+		functionSamples.clear();
+		int nTotalSamples = 0;
+		for (const auto& funcCount : threadSamples.funcCounts)
+		{
+			SFunctionSample fs;
+			fs.function = funcCount.first;
+			fs.nSamples = funcCount.second;
+			functionSamples.push_back(fs);
+			nTotalSamples += funcCount.second;
+		}
+		std::sort(functionSamples.begin(), functionSamples.end(), CompareFunctionSamples);
+
+		CryLogAlways("Thread %s: %d samples", threadSamples.name.c_str(), nTotalSamples);
+		const float fOnePercent = (float)nTotalSamples / 100;
+		for (uint32 i = 0; i < functionSamples.size() && i < nMaxFunctionsPerThread; i++)
+		{
+			const float fPercent = functionSamples[i].nSamples / fOnePercent;
+			CryLogAlways("%6.2f%% (%4d samples) : %s", fPercent, functionSamples[i].nSamples, functionSamples[i].function.c_str());
+		}
+	}
+	CryLogAlways("=========================================================================");
+}
+
 #endif // CRY_PLATFORM_WINDOWS
@@ -82,6 +82,68 @@ private:
 	CSymbolDatabase*             m_pSymDB;
 };
 
+#elif CRY_PLATFORM_LINUX
+
+class CSamplingThread;
+
+//////////////////////////////////////////////////////////////////////////
+// Linux sampler: a sampling thread sends SIGPROF to every thread registered
+// with the thread manager at regular intervals, the signal handler records
+// the interrupted IP of each thread.
+// Samples are symbolicated through IDebugCallStack on the main thread,
+// added to a running job trace capture as per thread tracks and summarized
+// per thread in the log once sampling finishes.
+//////////////////////////////////////////////////////////////////////////
+class CSampler
+{
+public:
+	struct SFunctionSample
+	{
+		string function;
+		uint32 nSamples; // Number of samples per function.
+	};
+
+	CSampler();
+	~CSampler();
+
+	void Start();
+	void Stop();
+	void Update();
+
+	void SetMaxSamples(int nMaxSamples);
+
+	int  GetSamplePeriod() const     { return m_samplePeriodMs; }
+	void SetSamplePeriod(int millis) { m_samplePeriodMs = millis; }
+
+private:
+	struct SThreadSamples
+	{
+		threadID              threadId;
+		string                name;
+		string                traceTrack;
+		std::map<string, int> funcCounts;
+	};
+
+	void            ProcessSamples();
+	void            LogSampledData();
+	const string&   LookupFunctionName(uint64 ip);
+	SThreadSamples& GetThreadSamples(threadID threadId);
+
+	std::unordered_map<uint64, string> m_symbolCache;
+	std::vector<SThreadSamples>        m_threadSamples;
+	int                                m_nMaxSamples;
+	int                                m_nProcessedSamples;
+	int                                m_samplePeriodMs;
+	bool                               m_bSampling;
+	bool                               m_bHandlerInstalled;
+
+	// maps the signal handler's tick stamps to the timer used by the job trace
+	int64                              m_startTicks;
+	CTimeValue                         m_startTime;
+
+	CSamplingThread*                   m_pSamplingThread;
+};
+
 #else // CRY_PLATFORM_WINDOWS
 
 // Dummy sampler.
@@ -12,6 +12,7 @@
 #include "ServiceNetwork.h"
 #include "RemoteCommandHelpers.h"
 #include <CryNetwork/CrySocks.h>
+#include <lz4.h>
 
 //-----------------------------------------------------------------------------
 
@@ -164,6 +165,13 @@ CServiceNetworkConnection::CServiceNetworkConnection(
 	, m_reconnectTryCount(0)
 	, m_bDisableCommunication(false)
 	, m_pSendedMessages(NULL)
+	, m_sendCommand(eCommand_Data)
+	, m_receiveCommand(eCommand_Data)
+	, m_pNextSendMessage(NULL)
+	, m_features(0)
+	, m_featuresAnswerSentSoFar(0)
+	, m_bFeaturesAnswerPending(false)
+	, m_bReceivingFeatures(false)
 	, m_refCount(1)
 {
 	// put the socket back in non blocking mode
@@ -237,7 +245,7 @@ void CServiceNetworkConnection::FlushAndClose(const uint32 timeout)
 	if (!m_bDisableCommunication)
 	{
 		// We don't have any messages on the waiting list, we can close immediately
-		if (m_pSendQueue.empty())
+		if (IsSendingQueueEmpty())
 		{
 			// Normal close
 			Close();
@@ -264,7 +272,7 @@ void CServiceNetworkConnection::FlushAndWait()
 	m_bDisableCommunication = true;
 
 	// Wait for the connection to be empty
-	while (IsAlive() && !m_pSendQueue.empty())
+	while (IsAlive() && !IsSendingQueueEmpty())
 	{
 		Sleep(1);
 	}
@@ -310,6 +318,7 @@ void CServiceNetworkConnection::Reset()
 			m_pCurrentReceiveMessage->Release();
 			m_pCurrentReceiveMessage = NULL;
 		}
+		m_bReceivingFeatures = false;
 
 		// reset reconnection timer
 		m_lastMessageReceivedTime = m_pManager->GetNetworkTime();
@@ -342,6 +351,12 @@ void CServiceNetworkConnection::Shutdown()
 		message->Release();
 	}
 
+	if (m_pNextSendMessage != NULL)
+	{
+		m_pNextSendMessage->Release();
+		m_pNextSendMessage = NULL;
+	}
+
 	// release current in-flight message
 	if (m_pCurrentReceiveMessage != NULL)
 	{
@@ -440,6 +455,8 @@ void CServiceNetworkConnection::Update()
 
 						// yeah, we got reconnected, try to reinitialize the connection
 						m_messageDataReceivedSoFar = 0;
+						m_features = 0; // negotiated again with the (possibly different) server
+						m_bReceivingFeatures = false;
 						m_state = eState_Initializing;
 					}
 				}
@@ -535,7 +552,7 @@ bool CServiceNetworkConnection::TryInitialize()
 	// Initialization data header
 	InitHeader header;
 	header.m_cmd = eCommand_Initialize;
-	header.m_pad0 = 0;
+	header.m_pad0 = m_pManager->IsPackingEnabled() ? (uint8)eFeature_All : 0; // requested features, ignored by older servers
 	header.m_pad1 = 0;
 	header.m_pad2 = 0;
 	header.m_tryCount = m_reconnectTryCount;
@@ -652,10 +669,16 @@ void CServiceNetworkConnection::SendKeepAlive(const uint64 currentNetworkTime)
 
 void CServiceNetworkConnection::ProcessSendingQueue()
 {
+	// Features answer must be the first thing the client gets
+	if (m_bFeaturesAnswerPending)
+	{
+		return;
+	}
+
 	// Get the top message from the send queue
 	if (NULL == m_pSendedMessages)
 	{
-		m_pSendedMessages = m_pSendQueue.pop();
+		m_pSendedMessages = PopMessageToSend(m_sendCommand);
 		if (NULL == m_pSendedMessages)
 		{
 			return;
@@ -671,7 +694,7 @@ void CServiceNetworkConnection::ProcessSendingQueue()
 	{
 		// prepare header - endian safe
 		Header header;
-		header.m_cmd = eCommand_Data;
+		header.m_cmd = m_sendCommand;
 		header.m_size = messageSize;
 
 		// Swap the header for reading
@@ -722,8 +745,235 @@ void CServiceNetworkConnection::ProcessSendingQueue()
 	}
 }
 
+CServiceNetworkMessage* CServiceNetworkConnection::PopMessageToSend(uint8& outCommand)
+{
+	outCommand = eCommand_Data;
+
+	CServiceNetworkMessage* pFirst = m_pNextSendMessage ? m_pNextSendMessage : m_pSendQueue.pop();
+	m_pNextSendMessage = NULL;
+	if (NULL == pFirst)
+	{
+		return NULL;
+	}
+
+	// Old peer or packing disabled, send as is
+	if (!(m_features & eFeature_PackedData) || !m_pManager->IsPackingEnabled())
+	{
+		return pFirst;
+	}
+
+	// Gather as many queued messages as fit in one block
+	// Large messages are packed alone so they can still be compressed
+	const uint32 packMaxSize = m_pManager->GetPackMaxSize();
+	const uint32 kSizePrefix = sizeof(uint32);
+
+	std::vector<CServiceNetworkMessage*> messages;
+	messages.push_back(pFirst);
+	uint32 rawSize = kSizePrefix + pFirst->GetSize();
+	while (rawSize < packMaxSize)
+	{
+		CServiceNetworkMessage* pNext = m_pSendQueue.pop();
+		if (NULL == pNext)
+		{
+			break;
+		}
+
+		if (rawSize + kSizePrefix + pNext->GetSize() > packMaxSize)
+		{
+			m_pNextSendMessage = pNext;
+			break;
+		}
+
+		messages.push_back(pNext);
+		rawSize += kSizePrefix + pNext->GetSize();
+	}
+
+	// Too big to be described by a packed block, send as is
+	if (rawSize + kPackedHeaderSize > kMaximumMessageSize)
+	{
+		CRY_ASSERT(messages.size() == 1);
+		return pFirst;
+	}
+
+	// Build the unpacked payload
+	m_packBuffer.resize(rawSize);
+	uint8* pWrite = m_packBuffer.data();
+	for (const CServiceNetworkMessage* pMessage : messages)
+	{
+		uint32 size = pMessage->GetSize();
+		SwapEndian(size, eLittleEndian);
+		memcpy(pWrite, &size, kSizePrefix);
+		memcpy(pWrite + kSizePrefix, pMessage->GetPointer(), pMessage->GetSize());
+		pWrite += kSizePrefix + pMessage->GetSize();
+	}
+
+	// Compress if it is worth it
+	uint8 flags = 0;
+	const uint8* pPayload = m_packBuffer.data();
+	uint32 payloadSize = rawSize;
+	const uint32 compressMinSize = m_pManager->GetCompressMinSize();
+	if (compressMinSize > 0 && rawSize >= compressMinSize)
+	{
+		m_compressBuffer.resize(LZ4_compressBound((int)rawSize));
+		const int compressedSize = LZ4_compress_default((const char*)m_packBuffer.data(), (char*)m_compressBuffer.data(), (int)rawSize, (int)m_compressBuffer.size());
+		if (compressedSize > 0 && (uint32)compressedSize < rawSize)
+		{
+			flags |= ePackedFlag_LZ4;
+			pPayload = m_compressBuffer.data();
+			payloadSize = (uint32)compressedSize;
+		}
+	}
+
+	// Single message with nothing gained, skip the packing overhead
+	if (messages.size() == 1 && flags == 0)
+	{
+		return pFirst;
+	}
+
+	CServiceNetworkMessage* pPacked = static_cast<CServiceNetworkMessage*>(m_pManager->AllocMessageBuffer(kPackedHeaderSize + payloadSize));
+	uint8* pPackedData = (uint8*)pPacked->GetPointer();
+	uint32 packedRawSize = rawSize;
+	SwapEndian(packedRawSize, eLittleEndian);
+	pPackedData[0] = flags;
+	memcpy(pPackedData + 1, &packedRawSize, sizeof(packedRawSize));
+	memcpy(pPackedData + kPackedHeaderSize, pPayload, payloadSize);
+
+	// The packed block replaces the source messages on the queue
+	int queueSizeDelta = (int)pPacked->GetSize();
+	for (CServiceNetworkMessage* pMessage : messages)
+	{
+		queueSizeDelta -= (int)pMessage->GetSize();
+		pMessage->Release();
+	}
+	CryInterlockedAdd(&m_sendQueueDataSize, queueSizeDelta);
+
+	// stats count the source messages, the packed one is counted when sent
+#ifndef RELEASE
+	CryInterlockedAdd((volatile int*) &m_statsNumPacketsSend, (int)messages.size() - 1);
+#endif
+
+	LOG_VERBOSE(3, "Connection local='%s', remote='%s', this=%p: packed %d messages (%d bytes) into %d bytes",
+	            m_localAddress.ToString().c_str(),
+	            m_remoteAddress.ToString().c_str(),
+	            (UINT_PTR) this,
+	            (int)messages.size(),
+	            rawSize,
+	            pPacked->GetSize());
+
+	outCommand = eCommand_Packed;
+	return pPacked;
+}
+
+bool CServiceNetworkConnection::UnpackMessage(const CServiceNetworkMessage& packedMessage)
+{
+	const uint8* pData = (const uint8*)packedMessage.GetPointer();
+	const uint32 dataSize = packedMessage.GetSize();
+	if (dataSize < kPackedHeaderSize)
+	{
+		return false;
+	}
+
+	const uint8 flags = pData[0];
+	uint32 rawSize = 0;
+	memcpy(&rawSize, pData + 1, sizeof(rawSize));
+	SwapEndian(rawSize, eLittleEndian);
+	if (rawSize > kMaximumMessageSize)
+	{
+		return false;
+	}
+
+	const uint8* pRaw = pData + kPackedHeaderSize;
+	if (flags & ePackedFlag_LZ4)
+	{
+		m_packBuffer.resize(rawSize);
+		const int decompressedSize = LZ4_decompress_safe((const char*)pRaw, (char*)m_packBuffer.data(), (int)(dataSize - kPackedHeaderSize), (int)rawSize);
+		if (decompressedSize != (int)rawSize)
+		{
+			return false;
+		}
+		pRaw = m_packBuffer.data();
+	}
+	else if (rawSize != dataSize - kPackedHeaderSize)
+	{
+		return false;
+	}
+
+	// Split into the original messages
+	const uint32 kSizePrefix = sizeof(uint32);
+	uint32 offset = 0;
+	while (offset < rawSize)
+	{
+		if (rawSize - offset < kSizePrefix)
+		{
+			return false;
+		}
+
+		uint32 size = 0;
+		memcpy(&size, pRaw + offset, kSizePrefix);
+		SwapEndian(size, eLittleEndian);
+		offset += kSizePrefix;
+
+		if (size == 0 || size > rawSize - offset)
+		{
+			return false;
+		}
+
+		if (!m_bDisableCommunication)
+		{
+			CServiceNetworkMessage* pMessage = static_cast<CServiceNetworkMessage*>(m_pManager->AllocMessageBuffer(size));
+			memcpy(pMessage->GetPointer(), pRaw + offset, size);
+			m_pReceiveQueue.push(pMessage);
+		}
+		offset += size;
+
+#ifndef RELEASE
+		CryInterlockedIncrement((volatile int*) &m_statsNumPacketsReceived);
+#endif
+	}
+
+	return true;
+}
+
+void CServiceNetworkConnection::SetRequestedFeatures(const uint8 requestedFeatures)
+{
+	CRY_ASSERT(m_endpointType == eEndpoint_Server);
+
+	// Older clients do not request anything and do not expect the answer
+	m_features = m_pManager->IsPackingEnabled() ? (requestedFeatures & eFeature_All) : 0;
+	m_bFeaturesAnswerPending = (requestedFeatures != 0);
+	m_featuresAnswerSentSoFar = 0;
+}
+
+bool CServiceNetworkConnection::SendFeaturesAnswer()
+{
+	if (m_bFeaturesAnswerPending)
+	{
+		const uint8 answer[2] = { eCommand_Features, m_features };
+		const uint32 dataLeft = sizeof(answer) - m_featuresAnswerSentSoFar;
+		m_featuresAnswerSentSoFar += TrySend(answer + m_featuresAnswerSentSoFar, dataLeft, true);
+		if (m_featuresAnswerSentSoFar == sizeof(answer))
+		{
+			m_bFeaturesAnswerPending = false;
+
+			LOG_VERBOSE(2, "Connection local='%s', remote='%s', this=%p: features answer sent (%d)",
+			            m_localAddress.ToString().c_str(),
+			            m_remoteAddress.ToString().c_str(),
+			            (UINT_PTR) this,
+			            m_features);
+		}
+	}
+
+	return !m_bFeaturesAnswerPending;
+}
+
 void CServiceNetworkConnection::ProcessKeepAlive()
 {
+	// The features answer must reach the client before the first keep alive (which confirms the connection)
+	if (!SendFeaturesAnswer())
+	{
+		return;
+	}
+
 	const uint64 currentNetworkTime = m_pManager->GetNetworkTime();
 	if ((currentNetworkTime - m_lastKeepAliveSendTime) > kKeepAlivePeriod)
 	{
@@ -773,6 +1023,25 @@ void CServiceNetworkConnection::ProcessReceivingQueue()
 		return;
 	}
 
+	// Flags byte of the features answer
+	if (m_bReceivingFeatures)
+	{
+		uint8 features = 0;
+		if (TryReceive(&features, 1, true) != 1)
+		{
+			return;
+		}
+
+		m_bReceivingFeatures = false;
+		m_features = features & eFeature_All;
+
+		LOG_VERBOSE(2, "Connection local='%s', remote='%s', this=%p: features accepted by server (%d)",
+		            m_localAddress.ToString().c_str(),
+		            m_remoteAddress.ToString().c_str(),
+		            (UINT_PTR) this,
+		            m_features);
+	}
+
 	// First byte - header
 	if (m_messageDataReceivedSoFar == 0)
 	{
@@ -810,9 +1079,10 @@ void CServiceNetworkConnection::ProcessReceivingQueue()
 				m_lastKeepAliveSendTime = m_pManager->GetNetworkTime();
 				m_lastMessageReceivedTime = m_pManager->GetNetworkTime();
 			}
-			else if (messageType == eCommand_Data)
+			else if (messageType == eCommand_Data || (messageType == eCommand_Packed && (m_features & eFeature_PackedData)))
 			{
 				// wait for the message length
+				m_receiveCommand = messageType;
 				m_messageReceiveLength = 0;
 				m_messageDataReceivedSoFar = kOffsetHeader;
 				m_lastMessageReceivedTime = m_pManager->GetNetworkTime();
@@ -824,6 +1094,13 @@ void CServiceNetworkConnection::ProcessReceivingQueue()
 				            (UINT_PTR) this);
 
 			}
+			else if (messageType == eCommand_Features && m_endpointType == eEndpoint_Client)
+			{
+				// the flags byte follows
+				m_features = 0;
+				m_bReceivingFeatures = true;
+				return;
+			}
 			else if (messageType == eCommand_Initialize)
 			{
 				// let the system process the message
@@ -936,6 +1213,27 @@ void CServiceNetworkConnection::ProcessReceivingQueue()
 			            (UINT_PTR) this,
 			            m_pCurrentReceiveMessage->GetSize());
 
+			if (m_receiveCommand == eCommand_Packed)
+			{
+				// Unpack the batched messages into the receive queue
+				const bool bValid = UnpackMessage(*m_pCurrentReceiveMessage);
+				m_pCurrentReceiveMessage->Release();
+				m_pCurrentReceiveMessage = NULL;
+				m_messageDataReceivedSoFar = 0;
+
+				if (!bValid)
+				{
+					// Serious error
+					LOG_VERBOSE(0, "Connection local='%s', remote='%s', this=%p: received corrupted packed block",
+					            m_localAddress.ToString().c_str(),
+					            m_remoteAddress.ToString().c_str(),
+					            (UINT_PTR) this);
+
+					Reset();
+				}
+				return;
+			}
+
 			// Put in the receive queue, only if no communication is disabled
 			if (m_bDisableCommunication)
 			{
@@ -1479,6 +1777,9 @@ void CServiceNetworkListener::ProcessPendingConnections()
 					}
 					else
 					{
+						// the client may have changed its settings when reconnecting
+						existingConnection->SetRequestedFeatures(con.m_initHeader.m_pad0);
+
 						// add to global list of active debug connections (so we can start receiving data)
 						m_pManager->RegisterConnection(*existingConnection);
 					}
@@ -1496,6 +1797,7 @@ void CServiceNetworkListener::ProcessPendingConnections()
 
 					// this is the first time we see this connection on set the proper connection counter
 					newConnection->m_reconnectTryCount = con.m_initHeader.m_tryCount;
+					newConnection->SetRequestedFeatures(con.m_initHeader.m_pad0);
 
 					// happy moment, log it
 					LOG_VERBOSE(0, "Listener local='%s', this=%p: confirmed connection from '%s'",
@@ -1552,6 +1854,11 @@ CServiceNetwork::CServiceNetwork()
 	m_pReceiveDataQueueLimit = REGISTER_INT("net_receiveQueueSize", 20 << 20, VF_DEV_ONLY, "");
 	m_pSendDataQueueLimit = REGISTER_INT("net_sendQueueSize", 5 << 20, VF_DEV_ONLY, "");
 
+	// Batching and compression of messages (negotiated per connection, older peers get plain messages)
+	m_pPackMessages = REGISTER_INT("net_packMessages", 1, VF_DEV_ONLY, "Batch queued service network messages into packed blocks when the peer supports it");
+	m_pPackMaxSize = REGISTER_INT("net_packMaxSize", 64 << 10, VF_DEV_ONLY, "Maximum size of a packed block of batched messages (bytes)");
+	m_pCompressMinSize = REGISTER_INT("net_compressMinSize", 1 << 10, VF_DEV_ONLY, "Packed blocks of at least this size are LZ4 compressed (0 = no compression)");
+
 	// Reinitialize the random number generator with independent seed value
 	m_guidGenerator.Seed((uint32)GetNetworkTime());
 
@@ -1594,6 +1901,9 @@ CServiceNetwork::~CServiceNetwork()
 	SAFE_RELEASE(m_pVerboseLevel);
 	SAFE_RELEASE(m_pReceiveDataQueueLimit);
 	SAFE_RELEASE(m_pSendDataQueueLimit);
+	SAFE_RELEASE(m_pPackMessages);
+	SAFE_RELEASE(m_pPackMaxSize);
+	SAFE_RELEASE(m_pCompressMinSize);
 }
 
 #ifndef RELEASE
@@ -107,8 +107,36 @@ public:
 
 		// Initialize communication channel (sent only once)
 		eCommand_Initialize = 3,
+
+		// Server answer to the features requested in the initialization header (followed by one byte with the accepted EFeature flags)
+		eCommand_Features = 4,
+
+		// Packed data block, several messages batched together and optionally compressed
+		eCommand_Packed = 5,
+	};
+
+	// Optional protocol features, requested by the client in InitHeader::m_pad0 and confirmed by the server with eCommand_Features.
+	// Peers that do not know about the features never send nor receive packed data.
+	enum EFeature
+	{
+		// Peer understands eCommand_Packed blocks
+		eFeature_PackedData = 1 << 0,
+
+		// All features supported by this implementation
+		eFeature_All = eFeature_PackedData,
 	};
 
+	// Flags stored in the first byte of a packed block
+	enum EPackedFlag
+	{
+		// Payload is LZ4 compressed
+		ePackedFlag_LZ4 = 1 << 0,
+	};
+
+	// Packed block header: flags (1 byte) and size of the unpacked payload (4 bytes)
+	// Unpacked payload is a sequence of messages each prefixed with its size (4 bytes)
+	static const uint32 kPackedHeaderSize = 5;
+
 #pragma pack(push)
 #pragma pack(1)
 
@@ -190,6 +218,27 @@ private:
 	CServiceNetworkMessage* m_pCurrentReceiveMessage;
 	uint32                  m_messageDummyReadLength;
 
+	// Command of the message being sent/received (eCommand_Data or eCommand_Packed)
+	uint8 m_sendCommand;
+	uint8 m_receiveCommand;
+
+	// Message popped from the send queue that did not fit into the last packed block
+	CServiceNetworkMessage* m_pNextSendMessage;
+
+	// Features accepted for this connection (EFeature flags)
+	uint8 m_features;
+
+	// Server side: bytes of the eCommand_Features answer sent so far (the answer goes out before anything else)
+	uint32 m_featuresAnswerSentSoFar;
+	bool   m_bFeaturesAnswerPending;
+
+	// Client side: eCommand_Features received, waiting for the flags byte
+	bool m_bReceivingFeatures;
+
+	// Scratch buffers for packing/unpacking (used only on the network thread)
+	std::vector<uint8> m_packBuffer;
+	std::vector<uint8> m_compressBuffer;
+
 	// External request to close this connection was issued
 	bool m_bCloseRequested;
 
@@ -204,7 +253,7 @@ public:
 
 	ILINE bool IsSendingQueueEmpty() const
 	{
-		return m_pSendQueue.empty();
+		return m_pSendQueue.empty() && (m_pNextSendMessage == NULL);
 	}
 
 	ILINE CServiceNetwork* GetManager() const
@@ -248,6 +297,17 @@ private:
 	void ProcessSendingQueue();
 	void ProcessReceivingQueue();
 
+	// Batch small messages from the send queue into one packed (and possibly compressed) block
+	// Returns the message to send and the command to send it with
+	CServiceNetworkMessage* PopMessageToSend(uint8& outCommand);
+
+	// Split received packed block into messages and put them on the receive queue, returns false if the block is corrupted
+	bool UnpackMessage(const CServiceNetworkMessage& packedMessage);
+
+	// Features negotiated in the initialization header (server side)
+	void SetRequestedFeatures(const uint8 requestedFeatures);
+	bool SendFeaturesAnswer();
+
 	// Keep alive message handling
 	void ProcessKeepAlive();
 	void SendKeepAlive(const uint64 currentNetworkTime);
@@ -402,6 +462,11 @@ protected:
 	ICVar* m_pReceiveDataQueueLimit;
 	ICVar* m_pSendDataQueueLimit;
 
+	// Message batching and compression
+	ICVar* m_pPackMessages;
+	ICVar* m_pPackMaxSize;
+	ICVar* m_pCompressMinSize;
+
 public:
 	ILINE const uint64 GetNetworkTime() const
 	{
@@ -423,6 +488,21 @@ public:
 		return m_pSendDataQueueLimit->GetIVal();
 	}
 
+	ILINE const bool IsPackingEnabled() const
+	{
+		return m_pPackMessages->GetIVal() != 0;
+	}
+
+	ILINE const uint32 GetPackMaxSize() const
+	{
+		return min((uint32)max(m_pPackMaxSize->GetIVal(), 0), CServiceNetworkConnection::kMaximumMessageSize);
+	}
+
+	ILINE const uint32 GetCompressMinSize() const
+	{
+		return (uint32)max(m_pCompressMinSize->GetIVal(), 0);
+	}
+
 public:
 	CServiceNetwork();
 	virtual ~CServiceNetwork();
@@ -0,0 +1,483 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+// -------------------------------------------------------------------------
+//  File name:   SpecBenchmark.cpp
+//  Description: Hardware spec benchmark
+// -------------------------------------------------------------------------
+
+#include "StdAfx.h"
+#include "SpecBenchmark.h"
+#include "System.h"
+#include "AutoDetectSpec.h"
+
+#include <Cry3DEngine/I3DEngine.h>
+#include <CryRenderer/IRenderer.h>
+#include <CrySystem/IConsole.h>
+#include <CrySystem/ITimer.h>
+#include <CryThreading/IJobManager.h>
+
+const float CSpecBenchmark::WarmupTime = 3.0f;
+const float CSpecBenchmark::PathAltitude = 30.0f;
+
+namespace
+{
+const char* const kProfileFile = "%USER%/SpecProfile.xml";
+const char* const kCalibrationFile = "Config/SpecCalibration.xml";
+const char* const kMetricNames[CSpecBenchmark::eMetric_Count] = { "Main", "Render", "Workers", "GPU" };
+
+// Fixed amount of dependent float math, the worker metric is the wall time of kKernelChunks of it spread over all workers
+const int kKernelChunks = 256;
+const int kKernelIterations = 100000;
+
+float SpecBenchmarkKernel(int seed)
+{
+	float a = 1.0f + (float)(seed & 0xff) * 0.001f;
+	float b = 0.5f;
+	for (int i = 0; i < kKernelIterations; ++i)
+	{
+		a = a * 1.0001f + b;
+		b = sqrt_tpl(fabs_tpl(a - b)) * 0.999f;
+	}
+	return a + b;
+}
+
+float Percentile90(std::vector<float>& samples)
+{
+	if (samples.empty())
+		return 0.0f;
+
+	const size_t index = (samples.size() * 9) / 10;
+	std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+	return samples[index];
+}
+
+int MetricFromName(const char* szName)
+{
+	for (int i = 0; i < CSpecBenchmark::eMetric_Count; ++i)
+	{
+		if (stricmp(szName, kMetricNames[i]) == 0)
+			return i;
+	}
+	return -1;
+}
+}
+
+CSpecBenchmark::CSpecBenchmark()
+	: m_state(eState_Idle)
+	, m_runStartTime(0.0f)
+	, m_stateStartTime(0.0f)
+	, m_specBeforeRun(CONFIG_CUSTOM)
+	, m_loadedLevel(false)
+{
+	for (int i = 0; i < eMetric_Count; ++i)
+		m_results[i] = 0.0f;
+
+	gEnv->pSystem->GetISystemEventDispatcher()->RegisterListener(this, "CSpecBenchmark");
+}
+
+CSpecBenchmark::~CSpecBenchmark()
+{
+	gEnv->pSystem->GetISystemEventDispatcher()->RemoveListener(this);
+}
+
+void CSpecBenchmark::Init()
+{
+	LoadCalibration();
+	m_fingerprint = BuildFingerprint();
+
+	if (!g_cvars.sys_specBenchmark)
+		return;
+
+	if (LoadProfile())
+	{
+		CryLogAlways("SpecBenchmark: applying stored profile");
+		ApplySpecs();
+		return;
+	}
+
+	CryLogAlways("SpecBenchmark: no valid profile for this hardware, benchmark will run on the next level");
+	m_state = eState_WaitForLevel;
+
+	// Built-in benchmark scene, unloaded again when the run is over
+	const char* szLevel = g_cvars.sys_specBenchmarkLevel ? g_cvars.sys_specBenchmarkLevel->GetString() : "";
+	if (szLevel && szLevel[0])
+	{
+		string mapCmd("map ");
+		mapCmd.append(szLevel);
+		gEnv->pConsole->ExecuteString(mapCmd.c_str(), false, true);
+		m_loadedLevel = true;
+	}
+}
+
+void CSpecBenchmark::Start()
+{
+	if (IsRunning())
+		return;
+
+	if (!gEnv->pRenderer || !gEnv->p3DEngine || gEnv->IsDedicated())
+	{
+		CryWarning(VALIDATOR_MODULE_SYSTEM, VALIDATOR_WARNING, "SpecBenchmark: needs a renderer and a 3D engine");
+		m_state = eState_Idle;
+		return;
+	}
+
+	CryLogAlways("SpecBenchmark: starting");
+
+	// Run at a fixed spec so the results of different machines are comparable, specs are changed deferred (outside of rendering)
+	m_specBeforeRun = gEnv->pSystem->GetConfigSpec();
+	string specCmd;
+	specCmd.Format("sys_spec %d", CONFIG_HIGH_SPEC);
+	gEnv->pConsole->ExecuteString(specCmd.c_str(), true, true);
+
+	for (int i = 0; i < eMetric_Count; ++i)
+	{
+		m_samples[i].clear();
+		m_results[i] = 0.0f;
+	}
+
+	m_results[eMetric_Workers] = MeasureWorkers();
+
+	m_runStartTime = m_stateStartTime = gEnv->pTimer->GetAsyncCurTime();
+	m_state = eState_Warmup;
+}
+
+void CSpecBenchmark::BeforeRender(CCamera& viewCamera)
+{
+	if (!IsRunning())
+		return;
+
+	// Orbit around the middle of the level, once per run, looking along the path slightly down
+	const float duration = WarmupTime + max(1.0f, g_cvars.sys_specBenchmarkDuration);
+	const float pathTime = gEnv->pTimer->GetAsyncCurTime() - m_runStartTime;
+
+	const int terrainSize = gEnv->p3DEngine->GetTerrainSize();
+	const float halfSize = terrainSize > 0 ? (float)terrainSize * 0.5f : 0.0f;
+	const float radius = terrainSize > 0 ? (float)terrainSize * 0.3f : 64.0f;
+
+	auto pathPoint = [&](float t)
+	{
+		const float angle = gf_PI2 * t / duration;
+		Vec3 pos(halfSize + radius * cos_tpl(angle), halfSize + radius * sin_tpl(angle), 0.0f);
+		const float ground = terrainSize > 0 ? gEnv->p3DEngine->GetTerrainElevation(pos.x, pos.y) : 0.0f;
+		pos.z = max(ground, gEnv->p3DEngine->GetWaterLevel()) + PathAltitude;
+		return pos;
+	};
+
+	const Vec3 pos = pathPoint(pathTime);
+	Vec3 dir = pathPoint(pathTime + 1.0f) - pos;
+	dir.z = 0.0f;
+	dir.NormalizeSafe(Vec3(0.0f, 1.0f, 0.0f));
+	dir.z = -0.25f;
+
+	viewCamera.SetMatrix(Matrix34(Matrix33::CreateRotationVDir(dir.GetNormalized()), pos));
+}
+
+void CSpecBenchmark::AfterRender()
+{
+	if (!IsRunning())
+		return;
+
+	const float elapsed = gEnv->pTimer->GetAsyncCurTime() - m_stateStartTime;
+
+	if (m_state == eState_Warmup)
+	{
+		if (elapsed >= WarmupTime)
+		{
+			m_stateStartTime = gEnv->pTimer->GetAsyncCurTime();
+			m_state = eState_Measure;
+		}
+		return;
+	}
+
+	// Main thread time is the frame minus the time spent waiting for the render thread
+	IRenderer::SRenderTimes renderTimes;
+	gEnv->pRenderer->GetRenderTimes(renderTimes);
+
+	const float frameTime = gEnv->pTimer->GetRealFrameTime() * 1000.0f;
+	m_samples[eMetric_Main].push_back(max(0.0f, frameTime - renderTimes.fWaitForRender * 1000.0f));
+	m_samples[eMetric_Render].push_back(renderTimes.fTimeProcessedRT * 1000.0f);
+	m_samples[eMetric_GPU].push_back(gEnv->pRenderer->GetGPUFrameTime() * 1000.0f);
+
+	if (elapsed >= g_cvars.sys_specBenchmarkDuration)
+		Finish();
+}
+
+void CSpecBenchmark::OnSystemEvent(ESystemEvent event, UINT_PTR wparam, UINT_PTR lparam)
+{
+	switch (event)
+	{
+	case ESYSTEM_EVENT_LEVEL_GAMEPLAY_START:
+		if (m_state == eState_WaitForLevel)
+			Start();
+		break;
+	case ESYSTEM_EVENT_LEVEL_UNLOAD:
+		if (IsRunning())
+			Abort();
+		break;
+	default:
+		break;
+	}
+}
+
+string CSpecBenchmark::BuildFingerprint() const
+{
+	// Anything that changes the results invalidates the profile
+	string fingerprint;
+
+#if CRY_PLATFORM_WINDOWS
+	char cpuName[256];
+	Win32SysInspect::GetCPUName(cpuName, sizeof(cpuName));
+	fingerprint.Format("%s|%u", cpuName, gEnv->pi.numLogicalProcessors);
+
+	const uint64 driverVersion = Win32SysInspect::GetGPUDriverVersion();
+	fingerprint.append(string().Format("|drv%u.%u.%u.%u", (uint32)(driverVersion >> 48), (uint32)(driverVersion >> 32) & 0xffff, (uint32)(driverVersion >> 16) & 0xffff, (uint32)driverVersion & 0xffff));
+#else
+	fingerprint.Format("%u", gEnv->pi.numLogicalProcessors);
+#endif
+
+	if (gEnv->pRenderer)
+	{
+		IRenderer::SGpuInfo gpuInfo;
+		memset(&gpuInfo, 0, sizeof(gpuInfo));
+		gEnv->pRenderer->QueryActiveGpuInfo(gpuInfo);
+		fingerprint.append(string().Format("|%s|%04x:%04x:%08x:%02x", gpuInfo.name ? gpuInfo.name : "", gpuInfo.VendorId, gpuInfo.DeviceId, gpuInfo.SubSysId, gpuInfo.Revision));
+	}
+
+	return fingerprint;
+}
+
+void CSpecBenchmark::LoadCalibration()
+{
+	m_calibration.clear();
+
+	// Projects can provide their own table, headroom is the frame budget divided by the 90th percentile time at high spec
+	XmlNodeRef root = gEnv->pCryPak->IsFileExist(kCalibrationFile) ? gEnv->pSystem->LoadXmlFromFile(kCalibrationFile) : XmlNodeRef();
+	if (root)
+	{
+		for (int i = 0; i < root->getChildCount(); ++i)
+		{
+			XmlNodeRef node = root->getChild(i);
+			const int metric = MetricFromName(node->getAttr("metric"));
+			if (!node->isTag("Group") || metric < 0)
+				continue;
+
+			SCalibrationEntry entry(node->getAttr("name"), (EMetric)metric, 0.0f, 0.0f, 0.0f);
+			node->getAttr("veryHigh", entry.minHeadroom[0]);
+			node->getAttr("high", entry.minHeadroom[1]);
+			node->getAttr("medium", entry.minHeadroom[2]);
+			m_calibration.push_back(entry);
+		}
+	}
+
+	if (m_calibration.empty())
+	{
+		m_calibration.push_back(SCalibrationEntry("sys_spec_Shading", eMetric_GPU, 1.6f, 1.1f, 0.75f));
+		m_calibration.push_back(SCalibrationEntry("sys_spec_Shadows", eMetric_GPU, 1.6f, 1.1f, 0.75f));
+		m_calibration.push_back(SCalibrationEntry("sys_spec_PostProcessing", eMetric_GPU, 1.5f, 1.0f, 0.7f));
+		m_calibration.push_back(SCalibrationEntry("sys_spec_VolumetricEffects", eMetric_GPU, 1.6f, 1.1f, 0.75f));
+		m_calibration.push_back(SCalibrationEntry("sys_spec_Water", eMetric_GPU, 1.4f, 1.0f, 0.7f));
+		m_calibration.push_back(SCalibrationEntry("sys_spec_Texture", eMetric_GPU, 1.3f, 0.9f, 0.6f));
+		m_calibration.push_back(SCalibrationEntry("sys_spec_Light", eMetric_GPU, 1.5f, 1.0f, 0.7f));
+		m_calibration.push_back(SCalibrationEntry("sys_spec_ObjectDetail", eMetric_Render, 1.5f, 1.1f, 0.75f));
+		m_calibration.push_back(SCalibrationEntry("sys_spec_GameEffects", eMetric_Main, 1.5f, 1.1f, 0.75f));
+		m_calibration.push_back(SCalibrationEntry("sys_spec_Physics", eMetric_Main, 1.5f, 1.1f, 0.75f));
+		m_calibration.push_back(SCalibrationEntry("sys_spec_Particles", eMetric_Workers, 2.0f, 1.2f, 0.8f));
+	}
+}
+
+float CSpecBenchmark::MeasureWorkers() const
+{
+	const int numJobs = max(1, (int)gEnv->pJobManager->GetNumWorkerThreads());
+	std::vector<float> results(kKernelChunks, 0.0f);
+	volatile int nNext = 0;
+
+	const float startTime = gEnv->pTimer->GetAsyncCurTime();
+
+	CryJobState jobState;
+	for (int j = 0; j < numJobs; ++j)
+	{
+		gEnv->pJobManager->AddLambdaJob("SpecBenchmarkWorkers", [&results, &nNext]()
+		{
+			for (int i = CryInterlockedIncrement(&nNext) - 1; i < kKernelChunks; i = CryInterlockedIncrement(&nNext) - 1)
+				results[i] = SpecBenchmarkKernel(i);
+		}, JobManager::eRegularPriority, &jobState);
+	}
+	jobState.Wait();
+
+	const float workersTime = (gEnv->pTimer->GetAsyncCurTime() - startTime) * 1000.0f;
+
+	// keep the results alive
+	float checksum = 0.0f;
+	for (float result : results)
+		checksum += result;
+	CryLog("SpecBenchmark: %d workers, %.2f ms (checksum %f)", numJobs, workersTime, checksum);
+
+	return workersTime;
+}
+
+void CSpecBenchmark::Finish()
+{
+	m_state = eState_Idle;
+
+	m_results[eMetric_Main] = Percentile90(m_samples[eMetric_Main]);
+	m_results[eMetric_Render] = Percentile90(m_samples[eMetric_Render]);
+	m_results[eMetric_GPU] = Percentile90(m_samples[eMetric_GPU]);
+
+	CryLogAlways("SpecBenchmark: finished after %d frames (90th percentile): main %.2f ms, render %.2f ms, workers %.2f ms, gpu %.2f ms",
+	             (int)m_samples[eMetric_Main].size(), m_results[eMetric_Main], m_results[eMetric_Render], m_results[eMetric_Workers], m_results[eMetric_GPU]);
+
+	for (int i = 0; i < eMetric_Count; ++i)
+		stl::free_container(m_samples[i]);
+
+	MapResultsToSpecs();
+	ApplySpecs();
+	SaveProfile();
+
+	if (m_loadedLevel)
+	{
+		gEnv->pConsole->ExecuteString("unload", false, true);
+		m_loadedLevel = false;
+	}
+}
+
+void CSpecBenchmark::Abort()
+{
+	CryLogAlways("SpecBenchmark: level unloaded, run aborted");
+
+	for (int i = 0; i < eMetric_Count; ++i)
+		stl::free_container(m_samples[i]);
+
+	string specCmd;
+	specCmd.Format("sys_spec %d", m_specBeforeRun);
+	gEnv->pConsole->ExecuteString(specCmd.c_str(), true, true);
+
+	// try again on the next level
+	m_state = eState_WaitForLevel;
+	m_loadedLevel = false;
+}
+
+void CSpecBenchmark::MapResultsToSpecs()
+{
+	m_groupSpecs.clear();
+
+	const int targetFps = max(1, g_cvars.sys_specBenchmarkTargetFps);
+	const float budget = 1000.0f / (float)targetFps;
+
+	for (const SCalibrationEntry& entry : m_calibration)
+	{
+		// metric not available on this platform (e.g. no GPU timers), keep the group as it is
+		const float measured = m_results[entry.metric];
+		if (measured <= 0.0f)
+			continue;
+
+		const float headroom = budget / measured;
+		int spec = CONFIG_LOW_SPEC;
+		if (headroom >= entry.minHeadroom[0])
+			spec = CONFIG_VERYHIGH_SPEC;
+		else if (headroom >= entry.minHeadroom[1])
+			spec = CONFIG_HIGH_SPEC;
+		else if (headroom >= entry.minHeadroom[2])
+			spec = CONFIG_MEDIUM_SPEC;
+
+		SGroupSpec groupSpec;
+		groupSpec.group = entry.group;
+		groupSpec.spec = spec;
+		m_groupSpecs.push_back(groupSpec);
+
+		CryLogAlways("SpecBenchmark: %s = %d (%s headroom %.2f)", entry.group.c_str(), spec, kMetricNames[entry.metric], headroom);
+	}
+}
+
+void CSpecBenchmark::ApplySpecs() const
+{
+	if (m_groupSpecs.empty())
+		return;
+
+	// The overall spec is the weakest group, it resets all groups so the individual ones are set afterwards
+	int minSpec = CONFIG_VERYHIGH_SPEC;
+	for (const SGroupSpec& groupSpec : m_groupSpecs)
+		minSpec = min(minSpec, groupSpec.spec);
+
+	string cmd;
+	cmd.Format("sys_spec %d", minSpec);
+	gEnv->pConsole->ExecuteString(cmd.c_str(), true, true);
+
+	for (const SGroupSpec& groupSpec : m_groupSpecs)
+	{
+		if (gEnv->pConsole->GetCVar(groupSpec.group.c_str()))
+		{
+			cmd.Format("%s %d", groupSpec.group.c_str(), groupSpec.spec);
+			gEnv->pConsole->ExecuteString(cmd.c_str(), true, true);
+		}
+	}
+}
+
+bool CSpecBenchmark::LoadProfile()
+{
+	if (!gEnv->pCryPak->IsFileExist(kProfileFile))
+		return false;
+
+	XmlNodeRef root = gEnv->pSystem->LoadXmlFromFile(kProfileFile);
+	if (!root || !root->isTag("SpecProfile"))
+		return false;
+
+	int version = 0;
+	root->getAttr("version", version);
+	if (version != ProfileVersion || m_fingerprint != root->getAttr("fingerprint"))
+	{
+		CryLogAlways("SpecBenchmark: stored profile is outdated (hardware, driver or version changed)");
+		return false;
+	}
+
+	m_groupSpecs.clear();
+	for (int i = 0; i < root->getChildCount(); ++i)
+	{
+		XmlNodeRef node = root->getChild(i);
+		if (node->isTag("Metric"))
+		{
+			const int metric = MetricFromName(node->getAttr("name"));
+			if (metric >= 0)
+				node->getAttr("ms", m_results[metric]);
+		}
+		else if (node->isTag("Group"))
+		{
+			SGroupSpec groupSpec;
+			groupSpec.group = node->getAttr("name");
+			groupSpec.spec = CONFIG_CUSTOM;
+			node->getAttr("spec", groupSpec.spec);
+			if (groupSpec.spec >= CONFIG_LOW_SPEC && groupSpec.spec <= CONFIG_VERYHIGH_SPEC)
+				m_groupSpecs.push_back(groupSpec);
+		}
+	}
+
+	return !m_groupSpecs.empty();
+}
+
+bool CSpecBenchmark::SaveProfile() const
+{
+	XmlNodeRef root = gEnv->pSystem->CreateXmlNode("SpecProfile");
+	root->setAttr("version", ProfileVersion);
+	root->setAttr("fingerprint", m_fingerprint.c_str());
+
+	for (int i = 0; i < eMetric_Count; ++i)
+	{
+		XmlNodeRef node = root->newChild("Metric");
+		node->setAttr("name", kMetricNames[i]);
+		node->setAttr("ms", m_results[i]);
+	}
+
+	for (const SGroupSpec& groupSpec : m_groupSpecs)
+	{
+		XmlNodeRef node = root->newChild("Group");
+		node->setAttr("name", groupSpec.group.c_str());
+		node->setAttr("spec", groupSpec.spec);
+	}
+
+	if (!root->saveToFile(kProfileFile))
+	{
+		CryWarning(VALIDATOR_MODULE_SYSTEM, VALIDATOR_WARNING, "SpecBenchmark: failed to write '%s'", kProfileFile);
+		return false;
+	}
+
+	return true;
+}
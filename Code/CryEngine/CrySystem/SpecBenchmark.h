@@ -0,0 +1,111 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+// -------------------------------------------------------------------------
+//  File name:   SpecBenchmark.h
+//  Description: Hardware spec benchmark
+//               Flies a scripted camera path over a level, measures main thread,
+//               render thread, worker and GPU timings separately and maps them
+//               to the sys_spec_* cvar groups through a calibration table.
+//               The result is stored in a profile that is reused until the
+//               hardware or the GPU driver changes.
+// -------------------------------------------------------------------------
+
+#ifndef __SpecBenchmark_h__
+#define __SpecBenchmark_h__
+#pragma once
+
+#include <CrySystem/ISystem.h>
+
+class CCamera;
+
+class CSpecBenchmark : public ISystemEventListener
+{
+public:
+	static const int    ProfileVersion = 1;
+	static const float  WarmupTime;
+	static const float  PathAltitude;
+
+	enum EMetric
+	{
+		eMetric_Main,
+		eMetric_Render,
+		eMetric_Workers,
+		eMetric_GPU,
+		eMetric_Count
+	};
+
+protected:
+
+	enum EState
+	{
+		eState_Idle,
+		eState_WaitForLevel, // run requested, waiting for a level to fly over
+		eState_Warmup,
+		eState_Measure
+	};
+
+	// Spec level of a cvar group is chosen by the headroom (frame budget / measured time) of one metric
+	struct SCalibrationEntry
+	{
+		string  group;
+		EMetric metric;
+		float   minHeadroom[3]; // very high, high, medium, anything below is low
+
+		SCalibrationEntry() : metric(eMetric_GPU) { minHeadroom[0] = minHeadroom[1] = minHeadroom[2] = 0.0f; }
+		SCalibrationEntry(const char* groupName, EMetric metric, float veryHigh, float high, float medium)
+			: group(groupName), metric(metric)
+		{ minHeadroom[0] = veryHigh; minHeadroom[1] = high; minHeadroom[2] = medium; }
+	};
+
+	struct SGroupSpec
+	{
+		string group;
+		int    spec;
+	};
+
+protected:
+	EState                         m_state;
+	float                          m_runStartTime;   // drives the camera path
+	float                          m_stateStartTime;
+	int                            m_specBeforeRun;
+	bool                           m_loadedLevel;
+
+	std::vector<float>             m_samples[eMetric_Count];
+	float                          m_results[eMetric_Count]; // 90th percentile in ms
+
+	std::vector<SCalibrationEntry> m_calibration;
+	std::vector<SGroupSpec>        m_groupSpecs;
+	string                         m_fingerprint;
+
+public:
+
+	CSpecBenchmark();
+	virtual ~CSpecBenchmark();
+
+	// Applies the stored profile when it matches this machine, otherwise requests a run
+	void Init();
+
+	// Starts a run on the currently loaded level
+	void Start();
+	bool IsRunning() const { return m_state == eState_Warmup || m_state == eState_Measure; }
+
+	void BeforeRender(CCamera& viewCamera);
+	void AfterRender();
+
+	// ISystemEventListener
+	virtual void OnSystemEvent(ESystemEvent event, UINT_PTR wparam, UINT_PTR lparam) override;
+
+protected:
+
+	string BuildFingerprint() const;
+	void   LoadCalibration();
+	float  MeasureWorkers() const;
+	void   Finish();
+	void   Abort();
+	void   MapResultsToSpecs();
+	void   ApplySpecs() const;
+	bool   LoadProfile();
+	bool   SaveProfile() const;
+};
+
+#endif // __SpecBenchmark_h__
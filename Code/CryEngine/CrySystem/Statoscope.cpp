@@ -15,6 +15,7 @@
 #include "SimpleStringPool.h"
 #include "System.h"
 #include "ThreadProfiler.h"
+#include "DefragScheduler.h"
 #include <CryThreading/IThreadManager.h>
 #include <CrySystem/Scaleform/IScaleformHelper.h>
 #include <CryParticleSystem/IParticlesPfx2.h>
@@ -24,6 +25,8 @@
 
 #if ENABLE_STATOSCOPE
 
+	#include <lz4.h>
+
 namespace
 {
 class CCompareFrameProfilersSelfTime
@@ -243,9 +246,43 @@ void CStatoscopeIntervalGroup::WriteDescEvent(void* p) const
 	}
 }
 
+void CStatoscopeFrameRecordWriter::BeginDataGroup(std::vector<uint32>* pDeltaState)
+{
+	m_pDeltaState = pDeltaState;
+	m_nDeltaIndex = 0;
+}
+
+void CStatoscopeFrameRecordWriter::EndDataGroup()
+{
+	// the next record is compared against exactly this one, even if it has fewer data sets
+	if (m_pDeltaState)
+		m_pDeltaState->resize(m_nDeltaIndex);
+	m_pDeltaState = NULL;
+}
+
+void CStatoscopeFrameRecordWriter::WriteNumeric(uint32 nBits)
+{
+	if (m_pDeltaState)
+	{
+		std::vector<uint32>& state = *m_pDeltaState;
+		if (m_nDeltaIndex < state.size())
+		{
+			const uint32 nPrevBits = state[m_nDeltaIndex];
+			state[m_nDeltaIndex] = nBits;
+			nBits ^= nPrevBits;
+		}
+		else
+		{
+			state.push_back(nBits);
+		}
+		++m_nDeltaIndex;
+	}
+	m_pDataWriter->WriteData(nBits);
+}
+
 void CStatoscopeFrameRecordWriter::AddValue(float f)
 {
-	m_pDataWriter->WriteData(f);
+	WriteNumeric(alias_cast<uint32>(f));
 	++m_nWrittenElements;
 }
 
@@ -257,7 +294,7 @@ void CStatoscopeFrameRecordWriter::AddValue(const char* s)
 
 void CStatoscopeFrameRecordWriter::AddValue(int i)
 {
-	m_pDataWriter->WriteData(i);
+	WriteNumeric((uint32)i);
 	++m_nWrittenElements;
 }
 
@@ -1515,7 +1552,7 @@ struct SNetworkProfileDG : public IStatoscopeDataGroup
 {
 	virtual SDescription GetDescription() const
 	{
-		return SDescription('d', "network profile", "['/NetworkProfile/$' (int totalBits) (int seqBits) (int rmiBits) (int calls)]");
+		return SDescription('d', "network profile", "['/NetworkProfile/$' (int totalBits) (int seqBits) (int rmiBits) (int calls) (float cpuMs)]");
 	}
 
 	virtual void Write(IStatoscopeFrameRecord& fr)
@@ -1528,6 +1565,7 @@ struct SNetworkProfileDG : public IStatoscopeDataGroup
 			fr.AddValue((int)(nps.m_rmi ? 0 : nps.m_totalBits));
 			fr.AddValue((int)(nps.m_rmi ? nps.m_totalBits : 0));
 			fr.AddValue((int)nps.m_calls);
+			fr.AddValue(nps.m_timeMs);
 		}
 	}
 
@@ -1543,7 +1581,7 @@ struct SNetworkProfileDG : public IStatoscopeDataGroup
 			for (int32 i = 0; i < profileStats.m_ProfileInfoStats.size(); i++)
 			{
 				SProfileInfoStat& nps = profileStats.m_ProfileInfoStats[i];
-				if (nps.m_totalBits)
+				if (nps.m_totalBits || nps.m_timeMs > 0.f)
 				{
 					m_statsCache.push_back(nps);
 				}
@@ -1556,6 +1594,45 @@ struct SNetworkProfileDG : public IStatoscopeDataGroup
 	std::vector<SProfileInfoStat> m_statsCache;
 };
 
+struct SDefragDG : public IStatoscopeDataGroup
+{
+	virtual SDescription GetDescription() const
+	{
+		return SDescription('F', "defrag", "['/Defrag/$' (float fragmentedMB) (float fragmentation) (float quotaKB) (float movedKB)]");
+	}
+
+	virtual void Write(IStatoscopeFrameRecord& fr)
+	{
+		for (uint32 i = 0; i < m_stats.size(); i++)
+		{
+			const CDefragScheduler::SHeapStats& heap = m_stats[i];
+
+			// Several heaps may share a name, e.g. the device buffer pools
+			uint32 nSameName = 0;
+			for (uint32 j = 0; j < i; j++)
+				nSameName += strcmp(m_stats[j].szName, heap.szName) == 0;
+
+			string name = heap.szName;
+			if (nSameName)
+				name.Format("%s %u", heap.szName, nSameName);
+
+			fr.AddValue(name.c_str());
+			fr.AddValue(heap.nFragmentedSize / (1024.0f * 1024.0f));
+			fr.AddValue(heap.nFragmentedSize / (float)max(heap.nCapacity, (size_t)1));
+			fr.AddValue(heap.nQuota / 1024.0f);
+			fr.AddValue(heap.nMovedSize / 1024.0f);
+		}
+	}
+
+	virtual uint32 PrepareToWrite()
+	{
+		CDefragScheduler::GetInstance().GetStats(m_stats);
+		return m_stats.size();
+	}
+
+	std::vector<CDefragScheduler::SHeapStats> m_stats;
+};
+
 class CStreamingObjectIntervalGroup : public CStatoscopeIntervalGroup, public IStreamedObjectListener
 {
 public:
@@ -1782,6 +1859,10 @@ CStatoscope::CStatoscope()
 	m_pStatoscopeWriteTimeout = REGISTER_FLOAT("e_StatoscopeWriteTimeout", 1.0f, VF_NULL, "The number of seconds the data writer will stall before it gives up trying to write data (currently only applies to the telemetry data writer).");
 	m_pStatoscopeConnectTimeout = REGISTER_FLOAT("e_StatoscopeConnectTimeout", 5.0f, VF_NULL, "The number of seconds the data writer will stall while trying connect to the telemetry server.");
 	m_pStatoscopeAllowFPSOverrideCVar = REGISTER_INT("e_StatoscopeAllowFpsOverride", 1, VF_NULL, "Allow overriding of cvars in release for fps captures (MP only).");
+	m_pStatoscopeCompactFormatCVar = REGISTER_INT("e_StatoscopeCompactFormat", 0, VF_NULL,
+	                                              "Writes file and socket logs in the compact format, applied when the next log starts:\n"
+	                                              "values are delta coded against the previous frame and the stream is LZ4 block compressed on the data writer thread.\n"
+	                                              "Read with CryCommonTools/Statoscope/StatoscopeReader.");
 	m_pGameRulesCVar = NULL;
 
 	m_logNum = 1;
@@ -2222,7 +2303,7 @@ void CStatoscope::AddFrameRecord(bool bOutputHeader)
 		m_pDataWriter->WriteData((char)StatoscopeDataWriter::EE_LittleEndian);
 	#endif
 
-		m_pDataWriter->WriteData(STATOSCOPE_BINARY_VERSION);
+		m_pDataWriter->WriteData(m_pDataWriter->IsCompactFormat() ? STATOSCOPE_BINARY_VERSION_DELTA : STATOSCOPE_BINARY_VERSION);
 
 		//Using string pool?
 		m_pDataWriter->WriteData(m_pDataWriter->IsUsingStringPool());
@@ -2266,6 +2347,9 @@ void CStatoscope::AddFrameRecord(bool bOutputHeader)
 		{
 			CStatoscopeDataGroup* dataGroup = m_activeDataGroups[i];
 			dataGroup->WriteHeader(m_pDataWriter);
+
+			// the reader restarts the delta coding of all groups with every header
+			dataGroup->GetDeltaState().clear();
 		}
 	}
 	else
@@ -2307,7 +2391,9 @@ void CStatoscope::AddFrameRecord(bool bOutputHeader)
 		m_pDataWriter->WriteData(nDataSets);
 
 		fr.ResetWrittenElementCount();
+		fr.BeginDataGroup(m_pDataWriter->IsCompactFormat() ? &dataGroup.GetDeltaState() : NULL);
 		pCallback->Write(fr);
+		fr.EndDataGroup();
 
 		int nElementsWritten = fr.GetWrittenElementCount();
 		int nExpectedElems = dataGroup.GetNumElements() * nDataSets;
@@ -2797,6 +2883,7 @@ void CStatoscope::RegisterBuiltInDataGroups()
 	RegisterDataGroup(new SNetworkDG());
 	RegisterDataGroup(new SChannelDG());
 	RegisterDataGroup(new SNetworkProfileDG());
+	RegisterDataGroup(new SDefragDG());
 }
 
 void CStatoscope::RegisterBuiltInIvDataGroups()
@@ -2828,6 +2915,10 @@ void CStatoscope::CreateDataWriter()
 
 		assert(m_pDataWriter);
 	}
+
+	// the telemetry server only understands the plain format
+	if (m_pDataWriter && m_pStatoscopeLogDestinationCVar->GetIVal() != eLD_Telemetry)
+		m_pDataWriter->SetCompactFormat(m_pStatoscopeCompactFormatCVar->GetIVal() != 0);
 }
 
 void CStatoscope::WriteIntervalClassEvents()
@@ -3038,6 +3129,8 @@ bool CStatoscopeServer::CheckError(int err, const char* tag)
 CDataWriter::CDataWriter(bool bUseStringPool, float writeTimeout)
 {
 	m_bUseStringPool = bUseStringPool;
+	m_bCompactFormat = false;
+	m_bCompactFormatRequested = false;
 	m_bTimedOut = false;
 	m_writeTimeout = writeTimeout;
 
@@ -3053,6 +3146,14 @@ CDataWriter::CDataWriter(bool bUseStringPool, float writeTimeout)
 void CDataWriter::Close()
 {
 	Flush();
+
+	if (m_bCompactFormat)
+	{
+		uint64 nBytesIn, nBytesOut;
+		m_DataThread.GetCompressionStats(nBytesIn, nBytesOut);
+		if (nBytesIn)
+			CryLog("Statoscope compact log: %" PRIu64 " KB compressed to %" PRIu64 " KB (%.1f%%)", nBytesIn / 1024, nBytesOut / 1024, 100.0f * (float)nBytesOut / (float)nBytesIn);
+	}
 }
 
 void CDataWriter::Flush()
@@ -3067,6 +3168,8 @@ void CDataWriter::ResetForNewLog()
 {
 	m_pFlushStartPtr = m_pWritePtr;
 	m_DataThread.Clear();
+	m_bCompactFormat = m_bCompactFormatRequested;
+	m_DataThread.ResetStream(m_bCompactFormat);
 	m_DataThread.Flush();
 	m_bShouldOutputLogTopHeader = true;
 	m_bHaveOutputModuleInformation = false;
@@ -3074,6 +3177,20 @@ void CDataWriter::ResetForNewLog()
 	m_bTimedOut = false;
 }
 
+void CDataWriter::SetCompactFormat(bool bCompact)
+{
+	if (bCompact == m_bCompactFormatRequested)
+		return;
+
+	m_bCompactFormatRequested = bCompact;
+	if (m_bShouldOutputLogTopHeader && m_bCompactFormat != bCompact)
+	{
+		// nothing written to this log yet
+		m_bCompactFormat = bCompact;
+		m_DataThread.ResetStream(bCompact);
+	}
+}
+
 void CDataWriter::FlushIOThread()
 {
 	printf("[Statoscope]Flush Data Thread\n");
@@ -3246,6 +3363,13 @@ CSocketDataWriter::CSocketDataWriter(CStatoscopeServer* pStatoscopeServer, float
 
 bool CSocketDataWriter::Open()
 {
+	// a client that stopped reading gets disconnected, listening again starts a new log for the next one
+	if (HasTimedOut() && m_pStatoscopeServer->IsConnected())
+	{
+		CryLog("Statoscope client timed out, closing the connection");
+		m_pStatoscopeServer->CloseConnection();
+	}
+
 	m_pStatoscopeServer->CheckForConnection();
 	return m_pStatoscopeServer->IsConnected();
 }
@@ -3419,6 +3543,14 @@ CStatoscopeIOThread::CStatoscopeIOThread()
 	m_threadID = THREADID_NULL;
 	m_numBytesInQueue = 0;
 	m_bRun = true;
+	m_nBlockFill = 0;
+	m_bCompress = false;
+	m_bStreamStarted = false;
+	m_bCompressRequested = false;
+	m_bResetStream = false;
+	m_bFlushBlock = false;
+	m_nCompressedBytesIn = 0;
+	m_nCompressedBytesOut = 0;
 
 	if (!gEnv->pThreadManager->SpawnThread(this, "StatoscopeDataWriter"))
 	{
@@ -3438,10 +3570,16 @@ CStatoscopeIOThread::~CStatoscopeIOThread()
 
 void CStatoscopeIOThread::Flush()
 {
+	// the compressor's partial block has to go out as well
+	m_bFlushBlock = true;
+
 	CTimeValue startTime = gEnv->pTimer->GetAsyncTime();
-	while (m_sendJobs.size())
+	while (m_sendJobs.size() || m_bFlushBlock || m_bResetStream)
 	{
 		CrySleep(1);
+		if (!m_pDataWriter)
+			continue;
+
 		CTimeValue currentTime = gEnv->pTimer->GetAsyncTime();
 		float timeout = m_pDataWriter->GetWriteTimeout();
 		if (timeout != 0.0f && currentTime.GetDifferenceInSeconds(startTime) > timeout)
@@ -3457,6 +3595,16 @@ void CStatoscopeIOThread::ThreadEntry()
 {
 	while (m_bRun)
 	{
+		if (m_bResetStream)
+		{
+			m_bCompress = m_bCompressRequested;
+			m_bStreamStarted = false;
+			m_nBlockFill = 0;
+			m_nCompressedBytesIn = 0;
+			m_nCompressedBytesOut = 0;
+			m_bResetStream = false;
+		}
+
 		if (m_sendJobs.size() > 0)
 		{
 			SendJob job;
@@ -3465,24 +3613,89 @@ void CStatoscopeIOThread::ThreadEntry()
 				job = m_sendJobs.front();
 			}
 
-			m_pDataWriter->SendData(job.pBuffer, job.nBytes);
+			if (m_bCompress)
+				AppendToBlock(job.pBuffer, job.nBytes);
+			else
+				m_pDataWriter->SendData(job.pBuffer, job.nBytes);
 
 			{
 				CryMT::queue<SendJob>::AutoLock lock(m_sendJobs.get_lock());
 				SendJob j;
-				m_sendJobs.try_pop(j);
-				m_numBytesInQueue -= j.nBytes;
+				if (m_sendJobs.try_pop(j))
+					m_numBytesInQueue -= j.nBytes;
 			}
 
 			//PIXEndNamedEvent();
 		}
 		else
 		{
+			// a partially filled block goes out when flushed or when it gets old, so that a socket client stays current
+			const bool bFlush = m_bFlushBlock;
+			if (m_nBlockFill && (bFlush || gEnv->pTimer->GetAsyncTime().GetDifferenceInSeconds(m_blockStartTime) > 0.5f))
+				SendBlock();
+			if (bFlush)
+				m_bFlushBlock = false;
+
 			CrySleep(1);
 		}
 	}
 }
 
+void CStatoscopeIOThread::AppendToBlock(const char* pBuffer, int nBytes)
+{
+	if (m_block.empty())
+	{
+		m_block.resize(STATOSCOPE_COMPACT_BLOCK_SIZE);
+		m_compressedBlock.resize(2 * sizeof(uint32) + LZ4_compressBound(STATOSCOPE_COMPACT_BLOCK_SIZE));
+	}
+
+	while (nBytes > 0)
+	{
+		if (m_nBlockFill == 0)
+			m_blockStartTime = gEnv->pTimer->GetAsyncTime();
+
+		const uint32 nCopy = min((uint32)nBytes, STATOSCOPE_COMPACT_BLOCK_SIZE - m_nBlockFill);
+		memcpy(&m_block[m_nBlockFill], pBuffer, nCopy);
+		m_nBlockFill += nCopy;
+		pBuffer += nCopy;
+		nBytes -= nCopy;
+
+		if (m_nBlockFill == STATOSCOPE_COMPACT_BLOCK_SIZE)
+			SendBlock();
+	}
+}
+
+void CStatoscopeIOThread::SendBlock()
+{
+	if (!m_bStreamStarted)
+	{
+		const uint32 streamHeader[2] = { STATOSCOPE_COMPACT_MAGIC, STATOSCOPE_COMPACT_VERSION };
+		m_pDataWriter->SendData((const char*)streamHeader, sizeof(streamHeader));
+		m_bStreamStarted = true;
+	}
+
+	// block: uint32 uncompressed size, uint32 compressed size (== uncompressed size if stored), data
+	uint32* pBlockHeader = (uint32*)&m_compressedBlock[0];
+	char* pPayload = &m_compressedBlock[2 * sizeof(uint32)];
+	const int nCapacity = (int)m_compressedBlock.size() - (int)(2 * sizeof(uint32));
+
+	int nCompressed = LZ4_compress_default(&m_block[0], pPayload, (int)m_nBlockFill, nCapacity);
+	if (nCompressed <= 0 || nCompressed >= (int)m_nBlockFill)
+	{
+		memcpy(pPayload, &m_block[0], m_nBlockFill);
+		nCompressed = (int)m_nBlockFill;
+	}
+	pBlockHeader[0] = m_nBlockFill;
+	pBlockHeader[1] = (uint32)nCompressed;
+
+	const int nSize = (int)(2 * sizeof(uint32)) + nCompressed;
+	m_pDataWriter->SendData(&m_compressedBlock[0], nSize);
+
+	m_nCompressedBytesIn += m_nBlockFill;
+	m_nCompressedBytesOut += nSize;
+	m_nBlockFill = 0;
+}
+
 void CStatoscopeIOThread::QueueSendData(const char* pBuffer, int nBytes)
 {
 	if (nBytes > 0)
@@ -17,6 +17,14 @@
 
 const uint32 STATOSCOPE_BINARY_VERSION = 2;
 
+// Compact logs (e_StatoscopeCompactFormat), see CryCommonTools/Statoscope/StatoscopeReader.h for the layout.
+// Version 3 frame records store every float and int value XORed with the value at the same position in the
+// previous record of its data group, the stream is cut into LZ4 blocks behind the compact stream magic.
+const uint32 STATOSCOPE_BINARY_VERSION_DELTA = 3;
+const uint32 STATOSCOPE_COMPACT_MAGIC = 0x345a5453; // "STZ4"
+const uint32 STATOSCOPE_COMPACT_VERSION = 1;
+const uint32 STATOSCOPE_COMPACT_BLOCK_SIZE = 64 * 1024;
+
 	#include <CryString/CryName.h>
 	#include <CryNetwork/CrySocks.h>
 
@@ -82,6 +90,8 @@ public:
 	explicit CStatoscopeFrameRecordWriter(CDataWriter* pDataWriter)
 		: m_pDataWriter(pDataWriter)
 		, m_nWrittenElements(0)
+		, m_pDeltaState(NULL)
+		, m_nDeltaIndex(0)
 	{
 	}
 
@@ -99,9 +109,17 @@ public:
 		return m_nWrittenElements;
 	}
 
+	// With a delta state the numeric values of the group are written XORed with the previous record's
+	void BeginDataGroup(std::vector<uint32>* pDeltaState);
+	void EndDataGroup();
+
 private:
-	CDataWriter* m_pDataWriter;
-	int          m_nWrittenElements;
+	void WriteNumeric(uint32 nBits);
+
+	CDataWriter*         m_pDataWriter;
+	int                  m_nWrittenElements;
+	std::vector<uint32>* m_pDeltaState;
+	uint32               m_nDeltaIndex;
 };
 
 namespace StatoscopeDataWriter
@@ -253,11 +271,15 @@ public:
 	void                  WriteHeader(CDataWriter* pDataWriter);
 	size_t                GetNumElements() const { return m_dataClass.GetNumElements(); }
 
+	// numeric values of the previous record, for the delta coded compact format
+	std::vector<uint32>&  GetDeltaState()        { return m_deltaState; }
+
 private:
 	const char            m_id;
 	const char*           m_name;
 	CStatoscopeDataClass  m_dataClass;
 	IStatoscopeDataGroup* m_pCallback;
+	std::vector<uint32>   m_deltaState;
 };
 
 class CStatoscopeIntervalGroup
@@ -376,6 +398,20 @@ public:
 
 	void     Flush();
 
+	// Starts a new stream, LZ4 block compressed behind STATOSCOPE_COMPACT_MAGIC if bCompress.
+	// Applied by the IO thread before it sends the next job.
+	void     ResetStream(bool bCompress)
+	{
+		m_bCompressRequested = bCompress;
+		m_bResetStream = true;
+	}
+
+	void     GetCompressionStats(uint64& nBytesIn, uint64& nBytesOut) const
+	{
+		nBytesIn = m_nCompressedBytesIn;
+		nBytesOut = m_nCompressedBytesOut;
+	}
+
 	void     Clear()
 	{
 		CryMT::queue<SendJob>::AutoLock lock(m_sendJobs.get_lock());
@@ -406,6 +442,9 @@ protected:
 	// Start accepting work on thread
 	virtual void ThreadEntry();
 
+	void         AppendToBlock(const char* pBuffer, int nBytes);
+	void         SendBlock();
+
 	struct SendJob
 	{
 		const char* pBuffer;
@@ -417,6 +456,19 @@ protected:
 	threadID              m_threadID;
 	CDataWriter*          m_pDataWriter;
 	volatile bool         m_bRun;
+
+	// compression state, only touched by the IO thread
+	std::vector<char, stl::STLGlobalAllocator<char>> m_block;
+	std::vector<char, stl::STLGlobalAllocator<char>> m_compressedBlock;
+	uint32                m_nBlockFill;
+	CTimeValue            m_blockStartTime;
+	bool                  m_bCompress;
+	bool                  m_bStreamStarted;
+	volatile bool         m_bCompressRequested;
+	volatile bool         m_bResetStream;
+	volatile bool         m_bFlushBlock;
+	volatile uint64       m_nCompressedBytesIn;
+	volatile uint64       m_nCompressedBytesOut;
 };
 
 //Base data writer class
@@ -434,6 +486,11 @@ public:
 
 	void         ResetForNewLog();
 
+	// Compact format for the next log: delta coded values, LZ4 compressed on the IO thread.
+	// Takes effect right away if nothing has been written to the current log yet.
+	void SetCompactFormat(bool bCompact);
+	bool IsCompactFormat() const { return m_bCompactFormat; }
+
 	//write to internal buffer, common to all IO Writers
 	void WriteData(const void* pData, int Size);
 
@@ -515,6 +572,8 @@ protected:
 
 	float            m_writeTimeout;
 	bool             m_bUseStringPool;
+	bool             m_bCompactFormat;
+	bool             m_bCompactFormatRequested;
 	volatile bool    m_bTimedOut;
 };
 
@@ -774,6 +833,7 @@ public:
 	ICVar*                                         m_pStatoscopeConnectTimeout;
 	ICVar*                                         m_pGameRulesCVar;
 	ICVar*                                         m_pStatoscopeAllowFPSOverrideCVar;
+	ICVar*                                         m_pStatoscopeCompactFormatCVar;
 
 	string                                         m_currentMap;
 
@@ -168,6 +168,14 @@ uint32 CAsyncIOFileRequest::ConfigureRead(CCachedFileData* pFileData)
 	// FIXME later - see FIXME in DecryptBlockEntry if changing how m_bStreamInPlace is inited
 
 	m_bStreamInPlace = !m_bCompressedBuffer || ((!m_pExternalMemoryBuffer || !m_bWriteOnlyExternal) && (m_nFileSize > m_nFileSizeCompressed));
+
+	// block compressed files always have a read buffer, see AllocateOutput
+	m_bBlockCompressed = pFileData && pFileEntry->IsBlockCompressed();
+	if (m_bBlockCompressed)
+	{
+		m_nCompressionMethod = pFileEntry->nMethod;
+		m_bStreamInPlace = true;
+	}
 	m_bReadBegun = 1;
 
 	return 0;
@@ -197,12 +205,18 @@ uint32 CAsyncIOFileRequest::AllocateOutput(CCachedFileData* pZipEntry)
 		uint32 nReadAllocSize = 0;
 		uint32 nZStreamOffs = 0;
 		uint32 nLookaheadOffs = 0;
+		uint32 nBlockSrcOffs = 0;
 
 		if (m_pExternalMemoryBuffer)
 		{
 			nReadAllocSize = m_bCompressedBuffer
 			                 ? (m_nRequestedSize < m_nFileSize ? m_nFileSize : 0)
 			                 : 0;
+
+			// the blocks are decompressed in parallel without m_externalBufferLockDecompress, and lz4 and zstd
+			// read back what they've written, JobFinalize_Decompress copies the result to the external buffer
+			if (m_bBlockCompressed)
+				nReadAllocSize = m_nFileSize;
 		}
 		else
 		{
@@ -215,7 +229,7 @@ uint32 CAsyncIOFileRequest::AllocateOutput(CCachedFileData* pZipEntry)
 
 		bool bReadInBlocks = CanReadInPages();
 		bool bNeedsLookahead = m_bStreamInPlace;
-		bool bBlockDecompress = m_bCompressedBuffer && bReadInBlocks;
+		bool bBlockDecompress = m_bCompressedBuffer && bReadInBlocks && !m_bBlockCompressed;
 
 		if (bBlockDecompress)
 		{
@@ -229,6 +243,12 @@ uint32 CAsyncIOFileRequest::AllocateOutput(CCachedFileData* pZipEntry)
 			}
 		}
 
+		if (m_bBlockCompressed)
+		{
+			nBlockSrcOffs = nAllocSize;
+			nAllocSize += Align(m_nFileSizeCompressed, BUFFER_ALIGNMENT);
+		}
+
 		char* pBuffer = NULL;
 
 		if (nAllocSize)
@@ -281,7 +301,14 @@ uint32 CAsyncIOFileRequest::AllocateOutput(CCachedFileData* pZipEntry)
 			m_pZlibStream->opaque = g_pPakHeap;
 		}
 
-		if (m_bCompressedBuffer)
+		if (m_bBlockCompressed)
+		{
+			m_pBlockSrc = (byte*)&pBuffer[nBlockSrcOffs];
+
+			// held by the IO thread until all blocks have been pushed
+			m_nBlocksPending = 1;
+		}
+		else if (m_bCompressedBuffer)
 		{
 			m_pDecompQueue = new SStreamJobQueue;
 		}
@@ -475,6 +502,7 @@ void CAsyncIOFileRequest::FreeBuffer()
 
 		pStreamEngine->TempFree(m_pMemoryBuffer, m_nMemoryBufferSize);
 		m_pMemoryBuffer = 0;
+		m_pBlockSrc = NULL;
 	}
 
 #ifdef STREAMENGINE_ENABLE_STATS
@@ -711,6 +739,16 @@ uint32 CAsyncIOFileRequest::ReadFileInPages(CStreamingIOThread* pIOThread, CCryF
 		return ERROR_MISSCHEDULED;
 	}
 
+#if defined(STREAMENGINE_SUPPORT_IO_URING)
+	if (CStreamIOUring* pIOUring = pIOThread->GetIOUring())
+	{
+		int fd = -1;
+		int64 nFileDataOffset = 0;
+		if (pZipEntry && pZip->GetFileDataLocation(pZipEntry->m_pFileEntry, fd, nFileDataOffset))
+			return ReadFileInPagesIOUring(pIOThread, *pIOUring, pZipEntry, fd, nFileDataOffset);
+	}
+#endif
+
 	bool bReadInPages = CanReadInPages();
 
 	uint32 nPageReadLen = (m_nPageReadEnd - m_nPageReadStart);
@@ -724,8 +762,9 @@ uint32 CAsyncIOFileRequest::ReadFileInPages(CStreamingIOThread* pIOThread, CCryF
 	                                ? (m_nFileSize - m_nFileSizeCompressed)
 	                                : 0;
 
-	byte* const pReadBase = (byte*)m_pReadMemoryBuffer + nReadStartOffset;
-	byte* const pReadEnd = (byte*)m_pReadMemoryBuffer + m_nReadMemoryBufferSize;
+	// block compressed files are read into a buffer of their own, as the blocks are decompressed in any order
+	byte* const pReadBase = m_pBlockSrc ? m_pBlockSrc : (byte*)m_pReadMemoryBuffer + nReadStartOffset;
+	byte* const pReadEnd = m_pBlockSrc ? m_pBlockSrc + m_nFileSizeCompressed : (byte*)m_pReadMemoryBuffer + m_nReadMemoryBufferSize;
 
 	CStreamEngine* pStreamEngine = static_cast<CStreamEngine*>(gEnv->pSystem->GetStreamEngine());
 
@@ -779,6 +818,8 @@ uint32 CAsyncIOFileRequest::ReadFileInPages(CStreamingIOThread* pIOThread, CCryF
 
 #ifdef STREAMENGINE_ENABLE_STATS
 			CTimeValue t0 = gEnv->pTimer->GetAsyncTime();
+			if (m_eMediaType != eStreamSourceTypeMemory)
+				pIOThread->m_NotInMemoryStats.AddQueueDepthSample(1);
 #endif
 
 			//printf("[StreamRead] %p %i %p %i %i\n", this, m_bCompressedBuffer, pReadTarget, m_nPageReadStart + m_nPageReadCurrent, nPageSize);
@@ -846,6 +887,214 @@ uint32 CAsyncIOFileRequest::ReadFileInPages(CStreamingIOThread* pIOThread, CCryF
 	return 0;
 }
 
+#if defined(STREAMENGINE_SUPPORT_IO_URING)
+//////////////////////////////////////////////////////////////////////////
+// Same as the page loop in ReadFileInPages, but the pages are split into blocks which are all read through the
+// io_uring of the IO thread, so the device has many reads in flight. Pages are still handed to decryption and
+// decompression strictly in order, so a preempted request resumes at m_nPageReadCurrent as usual.
+uint32 CAsyncIOFileRequest::ReadFileInPagesIOUring(CStreamingIOThread* pIOThread, CStreamIOUring& ring, CCachedFileData* pZipEntry, int fd, int64 nFileDataOffset)
+{
+	enum { eMaxPagesInFlight = 16 };
+
+	struct SPage
+	{
+		byte*           pReadTarget;
+		SStreamPageHdr* pTemporaryPageHdr;
+		uint32          nOffset;    // relative to m_nPageReadStart
+		uint32          nSize;
+		uint32          nSubmitted;
+		uint32          nCompleted;
+	};
+
+	bool const bReadInPages = CanReadInPages();
+	uint32 const nPageReadLen = (m_nPageReadEnd - m_nPageReadStart);
+
+	bool const bCompressed = m_bCompressedBuffer;
+	bool const bEncrypted = m_bEncryptedBuffer;
+	bool const bInPlace = m_bStreamInPlace;
+	bool const bIgnoreOutOfTmp = IgnoreOutofTmpMem();
+
+	size_t const nReadStartOffset = bCompressed
+	                                ? (m_nFileSize - m_nFileSizeCompressed)
+	                                : 0;
+
+	// block compressed files are read into a buffer of their own, as the blocks are decompressed in any order
+	byte* const pReadBase = m_pBlockSrc ? m_pBlockSrc : (byte*)m_pReadMemoryBuffer + nReadStartOffset;
+	byte* const pReadEnd = m_pBlockSrc ? m_pBlockSrc + m_nFileSizeCompressed : (byte*)m_pReadMemoryBuffer + m_nReadMemoryBufferSize;
+
+	CStreamEngine* pStreamEngine = static_cast<CStreamEngine*>(gEnv->pSystem->GetStreamEngine());
+	uint32 const nBlockSize = (uint32)clamp_tpl(g_cvars.sys_streaming_io_uring_block_size, 4, 16 * 1024) * 1024;
+
+	// the external buffer must stay alive while the kernel writes to it, so cancelling waits for the reads in flight
+	CryOptionalAutoLock<CryCriticalSection> readLock(m_externalBufferLockRead, m_pExternalMemoryBuffer != NULL);
+
+#ifdef STREAMENGINE_ENABLE_LISTENER
+	NotifyListenerIO IOListener(gEnv->pSystem->GetStreamEngine()->GetListener(), this, pZipEntry, nPageReadLen - m_nPageReadCurrent);
+#endif
+
+#ifdef STREAMENGINE_ENABLE_STATS
+	CTimeValue t0 = gEnv->pTimer->GetAsyncTime();
+#endif
+
+	SPage pages[eMaxPagesInFlight];
+	uint32 nFirstPage = 0;
+	uint32 nNumPages = 0;
+	uint32 nNextPageOffset = m_nPageReadCurrent;
+	uint32 nError = 0;
+	bool bPreempted = false; // no new pages, but the ones in flight are finished
+
+	while (true)
+	{
+		// keep the ring filled, the blocks of the newest page first
+		while (!nError && ring.GetInFlight() < ring.GetCapacity())
+		{
+			if (nNumPages)
+			{
+				const uint32 nSlot = (nFirstPage + nNumPages - 1) % eMaxPagesInFlight;
+				SPage& lastPage = pages[nSlot];
+				if (lastPage.nSubmitted < lastPage.nSize)
+				{
+					const uint32 nReadSize = min(nBlockSize, lastPage.nSize - lastPage.nSubmitted);
+					ring.QueueRead(fd, lastPage.pReadTarget + lastPage.nSubmitted, nReadSize,
+					               nFileDataOffset + m_nPageReadStart + lastPage.nOffset + lastPage.nSubmitted, ((uint64)nSlot << 32) | lastPage.nSubmitted);
+					lastPage.nSubmitted += nReadSize;
+					continue;
+				}
+			}
+
+			if (bPreempted || nNumPages == eMaxPagesInFlight || nNextPageOffset == nPageReadLen)
+				break;
+
+			if ((nError = m_nError))
+				break;
+
+			//check if job needs to be pre-empted
+			if (ReadFileCheckPreempt(pIOThread))
+			{
+				bPreempted = true;
+				break;
+			}
+
+			SPage& page = pages[(nFirstPage + nNumPages) % eMaxPagesInFlight];
+			page.nOffset = nNextPageOffset;
+			page.nSize = bReadInPages
+			             ? min((uint32)STREAMING_PAGE_SIZE, nPageReadLen - nNextPageOffset)
+			             : nPageReadLen - nNextPageOffset;
+			page.nSubmitted = 0;
+			page.nCompleted = 0;
+			page.pTemporaryPageHdr = NULL;
+
+			if (bInPlace)
+			{
+				page.pReadTarget = pReadBase + nNextPageOffset;
+				if (page.pReadTarget + page.nSize > pReadEnd)
+					__debugbreak();
+			}
+			else
+			{
+				page.pReadTarget = AllocatePage(page.nSize, !bIgnoreOutOfTmp, page.pTemporaryPageHdr);
+				if (!page.pReadTarget)
+				{
+					// with pages in flight, try again once they were handed on
+					if (nNumPages == 0)
+						nError = ERROR_OUT_OF_MEMORY;
+					break;
+				}
+				page.pTemporaryPageHdr->nRefs = 1;
+			}
+
+			nNextPageOffset += page.nSize;
+			++nNumPages;
+		}
+
+		if (ring.GetInFlight() == 0)
+			break;
+
+#ifdef STREAMENGINE_ENABLE_STATS
+		pIOThread->m_NotInMemoryStats.AddQueueDepthSample(ring.GetInFlight());
+#endif
+
+		if (!ring.Submit(true))
+		{
+			nError = ERROR_REFSTREAM_ERROR;
+			break;
+		}
+
+		CStreamIOUring::SCompletion completion;
+		while (ring.PopCompletion(completion))
+		{
+			SPage& page = pages[completion.nUserData >> 32];
+			const uint32 nBlockOffset = (uint32)completion.nUserData;
+			if (completion.nResult <= 0)
+			{
+				if (!nError)
+					CryWarning(VALIDATOR_MODULE_SYSTEM, VALIDATOR_WARNING, "Streaming: io_uring read of %s failed (%d)", m_strFileName.c_str(), completion.nResult);
+				nError = ERROR_REFSTREAM_ERROR;
+				continue;
+			}
+
+			const uint32 nRead = (uint32)completion.nResult;
+			const uint32 nBlockEnd = min((nBlockOffset / nBlockSize + 1) * nBlockSize, page.nSize);
+			page.nCompleted += nRead;
+
+			// short read, the completion just freed an entry for the rest of the block
+			if (nBlockOffset + nRead < nBlockEnd && !nError)
+			{
+				ring.QueueRead(fd, page.pReadTarget + nBlockOffset + nRead, nBlockEnd - nBlockOffset - nRead,
+				               nFileDataOffset + m_nPageReadStart + page.nOffset + nBlockOffset + nRead, (completion.nUserData & ~0xffffffffULL) | (nBlockOffset + nRead));
+			}
+		}
+
+		// hand on the completed pages in order
+		while (!nError && nNumPages && pages[nFirstPage].nCompleted == pages[nFirstPage].nSize)
+		{
+			SPage& page = pages[nFirstPage];
+			bool bLastBlock = (m_nPageReadCurrent + page.nSize) == nPageReadLen;
+
+#if defined(STREAMENGINE_SUPPORT_DECRYPT)
+			if (bEncrypted)
+			{
+				PushDecryptPage(pStreamEngine->GetJobEngineState(), page.pReadTarget, page.pTemporaryPageHdr, page.nSize, bLastBlock);
+			}
+			else
+#endif                 //STREAMENGINE_SUPPORT_DECRYPT
+			if (bCompressed)
+			{
+				PushDecompressPage(pStreamEngine->GetJobEngineState(), page.pReadTarget, page.pTemporaryPageHdr, page.nSize, bLastBlock);
+			}
+			else if (page.pTemporaryPageHdr)
+			{
+				__debugbreak();
+			}
+
+			if (page.pTemporaryPageHdr && CryInterlockedDecrement(&page.pTemporaryPageHdr->nRefs) == 0)
+				GetStreamEngine()->TempFree(page.pReadTarget, page.pTemporaryPageHdr->nSize);
+
+			m_nPageReadCurrent += page.nSize;
+			nFirstPage = (nFirstPage + 1) % eMaxPagesInFlight;
+			--nNumPages;
+		}
+	}
+
+	// pages which were read but not handed on because of an error
+	for (; nNumPages; --nNumPages, nFirstPage = (nFirstPage + 1) % eMaxPagesInFlight)
+	{
+		if (pages[nFirstPage].pTemporaryPageHdr)
+			GetStreamEngine()->TempFree(pages[nFirstPage].pReadTarget, pages[nFirstPage].pTemporaryPageHdr->nSize);
+	}
+
+#ifdef STREAMENGINE_ENABLE_STATS
+	// wall time, the reads overlap
+	m_readTime += gEnv->pTimer->GetAsyncTime() - t0;
+#endif
+
+	if (nError)
+		return nError;
+
+	return (bPreempted && m_nPageReadCurrent < nPageReadLen) ? ERROR_PREEMPTED : 0;
+}
+#endif
+
 uint32 CAsyncIOFileRequest::ReadFileCheckPreempt(CStreamingIOThread* pIOThread)
 {
 	if (m_ePriority != estpUrgent)
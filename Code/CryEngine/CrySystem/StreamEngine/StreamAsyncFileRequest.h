@@ -16,6 +16,7 @@
 #include <CrySystem/IStreamEngineDefs.h>
 #include <CrySystem/TimeValue.h>
 #include <CryCore/Platform/CryWindows.h>
+#include "StreamIOUring.h"
 
 class CStreamEngine;
 class CAsyncIOFileRequest;
@@ -165,6 +166,9 @@ public:
 	uint32         ReadFile(CStreamingIOThread* pIOThread);
 	uint32         ReadFileResume(CStreamingIOThread* pIOThread);
 	uint32         ReadFileInPages(CStreamingIOThread* pIOThread, CCryFile& file);
+#if defined(STREAMENGINE_SUPPORT_IO_URING)
+	uint32         ReadFileInPagesIOUring(CStreamingIOThread* pIOThread, CStreamIOUring& ring, CCachedFileData* pZipEntry, int fd, int64 nFileDataOffset);
+#endif
 	uint32         ReadFileCheckPreempt(CStreamingIOThread* pIOThread);
 
 	uint32         ConfigureRead(CCachedFileData* pFileData);
@@ -179,6 +183,11 @@ public:
 	static void    JobStart_Decompress(CAsyncIOFileRequest_TransferPtr& pSelf, const SStreamJobEngineState& engineState, int nSlot);
 	void           DecompressBlockEntry(SStreamJobEngineState engineState, int nJob);
 
+	// Files compressed as independent blocks, every block is decompressed by a job of its own as soon as it has been read
+	uint32         PushDecompressIndependentBlocks(const SStreamJobEngineState& engineState, uint32 nBytesRead, bool bLast);
+	static void    JobStart_DecompressIndependentBlock(CAsyncIOFileRequest_TransferPtr& pSelf, const SStreamJobEngineState& engineState, uint32 nBlock, uint32 nSrcOffset);
+	void           DecompressIndependentBlockEntry(SStreamJobEngineState engineState, uint32 nBlock, uint32 nSrcOffset);
+
 #if defined(STREAMENGINE_SUPPORT_DECRYPT)
 	uint32      PushDecryptPage(const SStreamJobEngineState& engineState, void* pSrc, SStreamPageHdr* pSrcHdr, uint32 nBytes, bool bLast);
 	uint32      PushDecryptBlock(const SStreamJobEngineState& engineState, void* pSrc, SStreamPageHdr* pSrcHdr, uint32 nOffs, uint32 nBytes, bool bLast);
@@ -288,6 +297,7 @@ public:
 	uint32       m_bSortKeyComputed   : 1;
 	uint32       m_bOutputAllocated   : 1;
 	uint32       m_bReadBegun         : 1;
+	uint32       m_bBlockCompressed   : 1;
 
 	// Actual size of the data on the media.
 	uint32                m_nSizeOnMedia;
@@ -310,6 +320,17 @@ public:
 	volatile uint32              m_nBytesDecompressed;
 	volatile uint32              m_nBytesDecrypted;
 
+	// ZipFile::METHOD_LZ4_BLOCKS and METHOD_ZSTD_BLOCKS
+	byte*                        m_pBlockSrc;
+	const uint32*                m_pBlockSizesCompressed; // the block table in m_pBlockSrc
+	uint32                       m_nBlockSize;
+	uint32                       m_nNumBlocks;
+	uint32                       m_nBlocksPushed;
+	uint32                       m_nNextBlockSrcOffset;
+	volatile int                 m_nBlocksPending;
+	volatile size_t              m_nBlockUnzipTicks;
+	uint32                       m_nCompressionMethod;
+
 	uint32                       m_crc32FromHeader;
 
 	volatile LONG                m_nFinalised;
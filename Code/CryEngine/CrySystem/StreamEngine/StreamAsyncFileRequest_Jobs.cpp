@@ -4,6 +4,7 @@
 #include <CryThreading/IJobManager_JobDelegator.h>
 
 #include "StreamAsyncFileRequest.h"
+#include "ZipDirStructures.h"
 
 #if defined(STREAMENGINE_SUPPORT_DECRYPT)
 	#include "ZipEncrypt.h"
@@ -86,6 +87,7 @@ DECLARE_JOB("StreamDecryptBlock", TStreamDecryptBlockJob, CAsyncIOFileRequest::D
 #endif  //STREAMENGINE_SUPPORT_DECRYPT
 
 DECLARE_JOB("StreamInflateBlock", TStreamInflateBlockJob, CAsyncIOFileRequest::DecompressBlockEntry)
+DECLARE_JOB("StreamDecompressIndependentBlock", TStreamDecompressIndependentBlockJob, CAsyncIOFileRequest::DecompressIndependentBlockEntry)
 
 //#pragma optimize("",off)
 
@@ -281,6 +283,57 @@ void CAsyncIOFileRequest::DecompressBlockEntry(SStreamJobEngineState engineState
 #endif
 }
 
+//////////////////////////////////////////////////////////////////////////
+void CAsyncIOFileRequest::DecompressIndependentBlockEntry(SStreamJobEngineState engineState, uint32 nBlock, uint32 nSrcOffset)
+{
+	STREAM_DECOMPRESS_TRACE("[StreamDecompress] DecompressIndependentBlockEntry(%x) %p %s %u\n", CryGetCurrentThreadId(), this, m_strFileName.c_str(), nBlock);
+
+	CAsyncIOFileRequest_TransferPtr pSelf(this);
+
+	if (!HasFailed())
+	{
+#if defined(STREAMENGINE_ENABLE_TIMING)
+		LARGE_INTEGER liStart;
+		QueryPerformanceCounter(&liStart);
+
+		CRY_PROFILE_REGION(PROFILE_SYSTEM, "DcmpIndependentBlck");
+#endif
+
+		// the read buffer is never the external one, see AllocateOutput, so the blocks don't need the decompress lock
+		const uint32 nDstOffset = nBlock * m_nBlockSize;
+		const uint32 nDstSize = min(m_nBlockSize, m_nFileSize - nDstOffset);
+		const int nReturnCode = ZipDir::ZipRawUncompressBlock(
+		  m_nCompressionMethod,
+		  (unsigned char*)m_pReadMemoryBuffer + nDstOffset,
+		  nDstSize,
+		  m_pBlockSrc + nSrcOffset,
+		  m_pBlockSizesCompressed[nBlock]);
+
+		if (nReturnCode == Z_OK)
+		{
+#if defined(STREAMENGINE_ENABLE_TIMING)
+			LARGE_INTEGER liEnd;
+			QueryPerformanceCounter(&liEnd);
+			CryInterlockedAdd(&m_nBlockUnzipTicks, (size_t)(liEnd.QuadPart - liStart.QuadPart));
+#endif
+		}
+		else
+		{
+#ifndef _RELEASE
+			CryWarning(VALIDATOR_MODULE_SYSTEM, VALIDATOR_ERROR, "Decomp Error: %s : block %u", m_strFileName.c_str(), nBlock);
+#endif
+			Failed(ERROR_DECOMPRESSION_FAIL);
+		}
+	}
+
+	if (CryInterlockedDecrement(&m_nBlocksPending) == 0)
+		JobFinalize_Decompress(pSelf, engineState);
+
+#if defined(STREAMENGINE_ENABLE_STATS)
+	CryInterlockedDecrement(&engineState.pStats->nCurrentDecompressCount);
+#endif
+}
+
 #if defined(STREAMENGINE_SUPPORT_DECRYPT)
 //////////////////////////////////////////////////////////////////////////
 void CAsyncIOFileRequest::DecryptBlockEntry(SStreamJobEngineState engineState, int nJob)
@@ -432,6 +485,9 @@ void CAsyncIOFileRequest::DecryptBlockEntry(SStreamJobEngineState engineState, i
 
 uint32 CAsyncIOFileRequest::PushDecompressPage(const SStreamJobEngineState& engineState, void* pSrc, SStreamPageHdr* pSrcHdr, uint32 nBytes, bool bLast)
 {
+	if (m_bBlockCompressed)
+		return PushDecompressIndependentBlocks(engineState, (uint32)((byte*)pSrc + nBytes - m_pBlockSrc), bLast);
+
 	uint32 nError = 0;
 
 	for (uint32 nBlockPos = 0; !nError && (nBlockPos < nBytes); nBlockPos += STREAMING_BLOCK_SIZE)
@@ -483,6 +539,76 @@ void CAsyncIOFileRequest::JobStart_Decompress(CAsyncIOFileRequest_TransferPtr& p
 	job.Run();
 }
 
+// The pages are pushed in order, nBytesRead is the part of m_pBlockSrc which has been read so far.
+uint32 CAsyncIOFileRequest::PushDecompressIndependentBlocks(const SStreamJobEngineState& engineState, uint32 nBytesRead, bool bLast)
+{
+	if (!m_nError && !m_pBlockSizesCompressed &&
+	    nBytesRead >= sizeof(ZipFile::BlockCompressionHeader) && nBytesRead >= ZipDir::BlockTable::GetSize(m_pBlockSrc))
+	{
+		ZipDir::BlockTable table;
+		if (table.Init(m_pBlockSrc, m_nFileSizeCompressed, m_nFileSize))
+		{
+			m_pBlockSizesCompressed = table.pCompressedSizes;
+			m_nBlockSize = table.nBlockSize;
+			m_nNumBlocks = table.nNumBlocks;
+			m_nNextBlockSrcOffset = table.nDataOffset;
+		}
+		else
+		{
+#ifndef _RELEASE
+			CryWarning(VALIDATOR_MODULE_SYSTEM, VALIDATOR_ERROR, "Decomp Error: %s : invalid block table", m_strFileName.c_str());
+#endif
+			Failed(ERROR_DECOMPRESSION_FAIL);
+		}
+	}
+
+	if (!m_nError && m_pBlockSizesCompressed)
+	{
+		while (m_nBlocksPushed < m_nNumBlocks && m_nNextBlockSrcOffset + m_pBlockSizesCompressed[m_nBlocksPushed] <= nBytesRead)
+		{
+			const uint32 nBlock = m_nBlocksPushed++;
+			const uint32 nSrcOffset = m_nNextBlockSrcOffset;
+			m_nNextBlockSrcOffset += m_pBlockSizesCompressed[nBlock];
+
+			STREAM_DECOMPRESS_TRACE("[StreamDecompress] Spawning independent block job %p %u\n", this, nBlock);
+
+			CryInterlockedIncrement(&m_nBlocksPending);
+			AddRef();
+			CAsyncIOFileRequest_TransferPtr pSelf(this);
+			JobStart_DecompressIndependentBlock(pSelf, engineState, nBlock, nSrcOffset);
+		}
+	}
+
+	if (bLast)
+	{
+		if (!m_pBlockSizesCompressed || m_nBlocksPushed != m_nNumBlocks)
+			Failed(ERROR_DECOMPRESSION_FAIL);
+
+		// drop the reference held by the IO thread, whoever is last finalizes
+		if (CryInterlockedDecrement(&m_nBlocksPending) == 0)
+		{
+			AddRef();
+			CAsyncIOFileRequest_TransferPtr pSelf(this);
+			JobFinalize_Decompress(pSelf, engineState);
+		}
+	}
+
+	return m_nError;
+}
+
+void CAsyncIOFileRequest::JobStart_DecompressIndependentBlock(CAsyncIOFileRequest_TransferPtr& pSelf, const SStreamJobEngineState& engineState, uint32 nBlock, uint32 nSrcOffset)
+{
+#if defined(STREAMENGINE_ENABLE_STATS)
+	CryInterlockedIncrement(&engineState.pStats->nCurrentDecompressCount);
+#endif
+
+	TStreamDecompressIndependentBlockJob job(engineState, nBlock, nSrcOffset);
+	job.RegisterJobState(&pSelf->m_DecompJob);
+	job.SetClassInstance(pSelf.Relinquish());
+	job.SetPriorityLevel(JobManager::eStreamPriority);
+	job.Run();
+}
+
 #if defined(STREAMENGINE_SUPPORT_DECRYPT)
 uint32 CAsyncIOFileRequest::PushDecryptPage(const SStreamJobEngineState& engineState, void* pSrc, SStreamPageHdr* pSrcHdr, uint32 nBytes, bool bLast)
 {
@@ -551,16 +677,30 @@ void CAsyncIOFileRequest::JobFinalize_Decompress(CAsyncIOFileRequest_TransferPtr
 
 	CAsyncIOFileRequest* pReq = &*pSelf;
 
-	if (!pReq->HasFailed())
+#if defined(STREAMENGINE_ENABLE_TIMING)
+	if (pReq->m_nBlockUnzipTicks)
+	{
+		LARGE_INTEGER liFreq;
+		QueryPerformanceFrequency(&liFreq);
+		pReq->m_unzipTime += CTimeValue((int64)((int64)pReq->m_nBlockUnzipTicks * CTimeValue::TIMEVALUE_PRECISION / liFreq.QuadPart));
+	}
+#endif
+
 	{
-		// Handle reads of subsections of a compressed file, by copying the section to the output
-		unsigned char* pDst = (unsigned char*)pReq->m_pOutputMemoryBuffer;
-		unsigned char* pSrc = (unsigned char*)pReq->m_pReadMemoryBuffer + pReq->m_nRequestedOffset;
+		// the independent blocks are decompressed into a buffer of their own, which is only copied to the external buffer here
+		CryOptionalAutoLock<CryCriticalSection> decompLock(pReq->m_externalBufferLockDecompress, pReq->m_bBlockCompressed && pReq->m_pExternalMemoryBuffer != NULL);
 
-		if (pDst != pSrc)
-			memmove(pReq->m_pOutputMemoryBuffer, pSrc, pReq->m_nRequestedSize);
+		if (!pReq->HasFailed())
+		{
+			// Handle reads of subsections of a compressed file, by copying the section to the output
+			unsigned char* pDst = (unsigned char*)pReq->m_pOutputMemoryBuffer;
+			unsigned char* pSrc = (unsigned char*)pReq->m_pReadMemoryBuffer + pReq->m_nRequestedOffset;
 
-		pReq->JobFinalize_Validate(engineState);
+			if (pDst != pSrc)
+				memmove(pReq->m_pOutputMemoryBuffer, pSrc, pReq->m_nRequestedSize);
+
+			pReq->JobFinalize_Validate(engineState);
+		}
 	}
 
 	pReq->JobFinalize_Buffer(engineState);
@@ -631,6 +771,7 @@ void CAsyncIOFileRequest::JobFinalize_Buffer(const SStreamJobEngineState& engine
 
 			m_pMemoryBuffer = NULL;
 			m_nMemoryBufferSize = 0;
+			m_pBlockSrc = NULL;
 		}
 	}
 }
@@ -376,6 +376,7 @@ void UpdateIOThreadStats(
 	float fTotalReadTime = pIOThread->m_NotInMemoryStats.m_TotalReadTime.GetSeconds();
 	if (fTotalReadTime > 0.0f)
 		pNotInMemoryInfo->nAverageActualReadBandwidth = (uint32)(pNotInMemoryInfo->nTotalBytesRead / fTotalReadTime);
+	pNotInMemoryInfo->fQueueDepthLastSecond = pIOThread->m_NotInMemoryStats.m_fQueueDepthInLastSecond;
 
 	// in memory reading
 	if (pInMemoryInfo)
@@ -1240,9 +1241,9 @@ void CStreamEngine::DrawStatistics()
 		         (uint32)(stats.hddInfo.nTotalBytesRead / (1024 * stats.hddInfo.nTotalRequestCount)),
 		         (float)stats.hddInfo.nCurrentReadBandwidth / (1024 * 1024), (float)stats.hddInfo.nSessionReadBandwidth / (1024 * 1024),
 		         (float)stats.hddInfo.nActualReadBandwidth / (1024 * 1024), (float)stats.hddInfo.nAverageActualReadBandwidth / (1024 * 1024));
-		DrawText(tx, ty += ystep, clText, "\t  Seek: %1.2f GB - Active: %2.1f%%(%2.1f%%)",
+		DrawText(tx, ty += ystep, clText, "\t  Seek: %1.2f GB - Active: %2.1f%%(%2.1f%%) - Queue depth: %1.1f",
 		         (float)stats.hddInfo.nAverageSeekOffset / (1024 * 1024),
-		         stats.hddInfo.fActiveDuringLastSecond, stats.hddInfo.fAverageActiveTime);
+		         stats.hddInfo.fActiveDuringLastSecond, stats.hddInfo.fAverageActiveTime, stats.hddInfo.fQueueDepthLastSecond);
 	}
 	// Optical stats
 	if (stats.discInfo.nTotalRequestCount > 0)
@@ -1252,9 +1253,9 @@ void CStreamEngine::DrawStatistics()
 		         (uint32)(stats.discInfo.nTotalBytesRead / (1024 * stats.discInfo.nTotalRequestCount)),
 		         (float)stats.discInfo.nCurrentReadBandwidth / (1024 * 1024), (float)stats.discInfo.nSessionReadBandwidth / (1024 * 1024),
 		         (float)stats.discInfo.nActualReadBandwidth / (1024 * 1024), (float)stats.discInfo.nAverageActualReadBandwidth / (1024 * 1024));
-		DrawText(tx, ty += ystep, clText, "\t  Seek: %1.2f GB - Active: %2.1f%%(%2.1f%%)",
+		DrawText(tx, ty += ystep, clText, "\t  Seek: %1.2f GB - Active: %2.1f%%(%2.1f%%) - Queue depth: %1.1f",
 		         (float)stats.discInfo.nAverageSeekOffset / (1024 * 1024),
-		         stats.discInfo.fActiveDuringLastSecond, stats.discInfo.fAverageActiveTime);
+		         stats.discInfo.fActiveDuringLastSecond, stats.discInfo.fAverageActiveTime, stats.discInfo.fQueueDepthLastSecond);
 	}
 	DrawText(tx, ty += ystep, clText, "Mem : Request: %3d|%5d (%4d MB)",
 	         stats.memoryInfo.nRequestCount, stats.memoryInfo.nTotalRequestCount, (stats.memoryInfo.nTotalBytesRead / (1024 * 1024)));
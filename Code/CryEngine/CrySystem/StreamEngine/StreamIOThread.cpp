@@ -38,6 +38,10 @@ CStreamingIOThread::CStreamingIOThread(CStreamEngine* pStreamEngine, EStreamSour
 
 	m_nReadCounter = 0;
 
+#if defined(STREAMENGINE_SUPPORT_IO_URING)
+	m_pIOUring = NULL;
+#endif
+
 	if (!gEnv->pThreadManager->SpawnThread(this, name))
 	{
 		CryFatalError("Error spawning \"%s\" thread.", name);
@@ -98,6 +102,22 @@ void CStreamingIOThread::ThreadEntry()
 
 	m_nLastReadDiskOffset = 0;
 
+#if defined(STREAMENGINE_SUPPORT_IO_URING)
+	// in memory requests never block on the device
+	if (g_cvars.sys_streaming_io_uring && m_eMediaType != eStreamSourceTypeMemory)
+	{
+		m_pIOUring = new CStreamIOUring;
+		if (m_pIOUring->Init((uint32)clamp_tpl(g_cvars.sys_streaming_io_uring_depth, 1, 4096)))
+		{
+			CryLog("%s: using io_uring with %u entries", m_name.c_str(), m_pIOUring->GetCapacity());
+		}
+		else
+		{
+			SAFE_DELETE(m_pIOUring);
+		}
+	}
+#endif
+
 	//
 	// Main thread loop
 	while (!m_bCancelThreadRequest)
@@ -402,6 +422,10 @@ void CStreamingIOThread::ThreadEntry()
 #endif
 		}
 	}
+
+#if defined(STREAMENGINE_SUPPORT_IO_URING)
+	SAFE_DELETE(m_pIOUring);
+#endif
 }
 
 #ifdef STREAMENGINE_ENABLE_STATS
@@ -425,10 +449,17 @@ void CStreamingIOThread::SStats::Update(const CTimeValue& deltaT)
 	else
 		m_nReadOffsetInLastSecond = 0;
 
+	if (m_nTempQueueDepthSamples > 0)
+		m_fQueueDepthInLastSecond = (float)m_nTempQueueDepthSum / m_nTempQueueDepthSamples;
+	else
+		m_fQueueDepthInLastSecond = 0.f;
+
 	m_TempReadTime.SetValue(0);
 	m_nTempBytesRead = 0;
 	m_nTempReadOffset = 0;
 	m_nTempRequestCount = 0;
+	m_nTempQueueDepthSum = 0;
+	m_nTempQueueDepthSamples = 0;
 }
 #endif
 
@@ -15,6 +15,7 @@
 
 #include <CrySystem/IStreamEngine.h>
 #include "StreamAsyncFileRequest.h"
+#include "StreamIOUring.h"
 
 #include <CryThreading/IThreadManager.h>
 
@@ -50,6 +51,11 @@ public:
 
 	CStreamEngineWakeEvent& GetWakeEvent() { return m_awakeEvent; }
 
+#if defined(STREAMENGINE_SUPPORT_IO_URING)
+	// null if reads are blocking on this thread, only valid on the IO thread itself
+	CStreamIOUring*         GetIOUring() { return m_pIOUring; }
+#endif
+
 	//////////////////////////////////////////////////////////////////////////
 	// IThread
 	//////////////////////////////////////////////////////////////////////////
@@ -74,11 +80,19 @@ public:
 			m_nReadBytesInLastSecond(0), m_fReadingDuringLastSecond(.0f),
 			m_nTempBytesRead(0), m_nActualReadBandwith(0), m_nTempReadOffset(0),
 			m_nTotalReadOffset(0), m_nReadOffsetInLastSecond(0), m_nTempRequestCount(0),
-			m_nTotalRequestCount(0), m_nRequestCountInLastSecond(0)
+			m_nTotalRequestCount(0), m_nRequestCountInLastSecond(0),
+			m_fQueueDepthInLastSecond(0.f), m_nTempQueueDepthSum(0), m_nTempQueueDepthSamples(0)
 		{}
 
 		void Update(const CTimeValue& deltaT);
 
+		// number of reads in flight, sampled whenever a read is issued
+		void AddQueueDepthSample(uint32 nReadsInFlight)
+		{
+			m_nTempQueueDepthSum += nReadsInFlight;
+			m_nTempQueueDepthSamples++;
+		}
+
 		void Reset()
 		{
 			m_nTotalReadBytes = 0;
@@ -97,11 +111,14 @@ public:
 		uint32     m_nReadBytesInLastSecond;
 		uint32     m_nRequestCountInLastSecond;
 		uint64     m_nReadOffsetInLastSecond;
+		float      m_fQueueDepthInLastSecond; // Average number of reads in flight
 
 		uint32     m_nTempRequestCount;
 		uint64     m_nTempBytesRead;
 		uint64     m_nTempReadOffset;
 		CTimeValue m_TempReadTime;
+		uint64     m_nTempQueueDepthSum;
+		uint32     m_nTempQueueDepthSamples;
 	};
 
 	SStats m_InMemoryStats;
@@ -137,6 +154,10 @@ private:
 	CryEvent               m_resetDoneEvent;
 	string                 m_name;
 	uint32                 m_nReadCounter;
+
+#if defined(STREAMENGINE_SUPPORT_IO_URING)
+	CStreamIOUring*        m_pIOUring;
+#endif
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,206 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+// -------------------------------------------------------------------------
+//  File name:   StreamIOUring.cpp
+//  Description: Minimal io_uring submission/completion ring used by the
+//               streaming IO threads on Linux to keep several reads in flight
+// -------------------------------------------------------------------------
+//  History:
+//
+////////////////////////////////////////////////////////////////////////////
+
+#include <StdAfx.h>
+#include "StreamIOUring.h"
+
+#if defined(STREAMENGINE_SUPPORT_IO_URING)
+
+	#include <linux/io_uring.h>
+	#include <sys/mman.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+	#include <errno.h>
+
+namespace
+{
+int IOUringSetup(uint32 nEntries, io_uring_params* pParams)
+{
+	return (int)syscall(__NR_io_uring_setup, nEntries, pParams);
+}
+
+int IOUringEnter(int fd, uint32 nToSubmit, uint32 nMinComplete, uint32 nFlags)
+{
+	return (int)syscall(__NR_io_uring_enter, fd, nToSubmit, nMinComplete, nFlags, NULL, 0);
+}
+
+// the kernel updates the heads and tails concurrently
+ILINE uint32 LoadAcquire(const uint32* p)       { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+ILINE void   StoreRelease(uint32* p, uint32 val) { __atomic_store_n(p, val, __ATOMIC_RELEASE); }
+}
+
+//////////////////////////////////////////////////////////////////////////
+CStreamIOUring::CStreamIOUring()
+	: m_fd(-1)
+	, m_nEntries(0)
+	, m_nInFlight(0)
+	, m_nToSubmit(0)
+	, m_pSqRing(MAP_FAILED)
+	, m_pCqRing(MAP_FAILED)
+	, m_nSqRingSize(0)
+	, m_nCqRingSize(0)
+	, m_pSqes((io_uring_sqe*)MAP_FAILED)
+	, m_nSqesSize(0)
+{
+}
+
+CStreamIOUring::~CStreamIOUring()
+{
+	Shutdown();
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CStreamIOUring::Init(uint32 nEntries)
+{
+	Shutdown();
+
+	io_uring_params params;
+	memset(&params, 0, sizeof(params));
+	m_fd = IOUringSetup(nEntries, &params);
+	if (m_fd < 0)
+	{
+		CryLog("Streaming: io_uring is not available (errno %d), using blocking reads", errno);
+		return false;
+	}
+
+	// IORING_OP_READ was added together with this feature flag
+	if ((params.features & IORING_FEAT_RW_CUR_POS) == 0)
+	{
+		CryLog("Streaming: kernel io_uring doesn't support IORING_OP_READ, using blocking reads");
+		Shutdown();
+		return false;
+	}
+
+	m_nSqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32);
+	m_nCqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+	const bool bSingleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+	if (bSingleMap)
+		m_nSqRingSize = m_nCqRingSize = max(m_nSqRingSize, m_nCqRingSize);
+
+	m_pSqRing = mmap(0, m_nSqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQ_RING);
+	m_pCqRing = bSingleMap ? m_pSqRing : mmap(0, m_nCqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_CQ_RING);
+	m_nSqesSize = params.sq_entries * sizeof(io_uring_sqe);
+	m_pSqes = (io_uring_sqe*)mmap(0, m_nSqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQES);
+	if (m_pSqRing == MAP_FAILED || m_pCqRing == MAP_FAILED || m_pSqes == MAP_FAILED)
+	{
+		CryWarning(VALIDATOR_MODULE_SYSTEM, VALIDATOR_WARNING, "Streaming: failed to map the io_uring rings (errno %d), using blocking reads", errno);
+		Shutdown();
+		return false;
+	}
+
+	uint8* pSq = (uint8*)m_pSqRing;
+	m_pSqHead = (uint32*)(pSq + params.sq_off.head);
+	m_pSqTail = (uint32*)(pSq + params.sq_off.tail);
+	m_nSqMask = *(uint32*)(pSq + params.sq_off.ring_mask);
+	m_pSqArray = (uint32*)(pSq + params.sq_off.array);
+
+	uint8* pCq = (uint8*)m_pCqRing;
+	m_pCqHead = (uint32*)(pCq + params.cq_off.head);
+	m_pCqTail = (uint32*)(pCq + params.cq_off.tail);
+	m_nCqMask = *(uint32*)(pCq + params.cq_off.ring_mask);
+	m_pCqes = (io_uring_cqe*)(pCq + params.cq_off.cqes);
+
+	// the completion queue is at least as large, so it can never overflow
+	m_nEntries = params.sq_entries;
+	m_nInFlight = 0;
+	m_nToSubmit = 0;
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CStreamIOUring::Shutdown()
+{
+	if (m_pSqes != MAP_FAILED)
+		munmap(m_pSqes, m_nSqesSize);
+	if (m_pCqRing != MAP_FAILED && m_pCqRing != m_pSqRing)
+		munmap(m_pCqRing, m_nCqRingSize);
+	if (m_pSqRing != MAP_FAILED)
+		munmap(m_pSqRing, m_nSqRingSize);
+	if (m_fd >= 0)
+		close(m_fd);
+
+	m_pSqes = (io_uring_sqe*)MAP_FAILED;
+	m_pCqRing = m_pSqRing = MAP_FAILED;
+	m_fd = -1;
+	m_nEntries = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CStreamIOUring::QueueRead(int fd, void* pBuffer, uint32 nSize, uint64 nOffset, uint64 nUserData)
+{
+	if (GetInFlight() >= m_nEntries)
+		return false;
+
+	const uint32 nTail = *m_pSqTail;
+	const uint32 nIndex = nTail & m_nSqMask;
+
+	io_uring_sqe* pSqe = &m_pSqes[nIndex];
+	memset(pSqe, 0, sizeof(io_uring_sqe));
+	pSqe->opcode = IORING_OP_READ;
+	pSqe->fd = fd;
+	pSqe->off = nOffset;
+	pSqe->addr = (uint64)(UINT_PTR)pBuffer;
+	pSqe->len = nSize;
+	pSqe->user_data = nUserData;
+
+	m_pSqArray[nIndex] = nIndex;
+	StoreRelease(m_pSqTail, nTail + 1);
+	++m_nToSubmit;
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CStreamIOUring::Submit(bool bWaitForCompletion)
+{
+	// nothing could ever complete
+	if (bWaitForCompletion && GetInFlight() == 0)
+		bWaitForCompletion = false;
+
+	while (m_nToSubmit || bWaitForCompletion)
+	{
+		const uint32 nMinComplete = bWaitForCompletion && LoadAcquire(m_pCqTail) == *m_pCqHead ? 1 : 0;
+		if (!m_nToSubmit && !nMinComplete)
+			break;
+
+		const int nSubmitted = IOUringEnter(m_fd, m_nToSubmit, nMinComplete, nMinComplete ? IORING_ENTER_GETEVENTS : 0);
+		if (nSubmitted < 0)
+		{
+			if (errno == EINTR || errno == EAGAIN || errno == EBUSY)
+				continue;
+			CryWarning(VALIDATOR_MODULE_SYSTEM, VALIDATOR_WARNING, "Streaming: io_uring_enter failed (errno %d)", errno);
+			return false;
+		}
+
+		m_nToSubmit -= (uint32)nSubmitted;
+		m_nInFlight += (uint32)nSubmitted;
+		if (nMinComplete)
+			break;
+	}
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CStreamIOUring::PopCompletion(SCompletion& completion)
+{
+	const uint32 nHead = *m_pCqHead;
+	if (nHead == LoadAcquire(m_pCqTail))
+		return false;
+
+	const io_uring_cqe& cqe = m_pCqes[nHead & m_nCqMask];
+	completion.nUserData = cqe.user_data;
+	completion.nResult = cqe.res;
+	StoreRelease(m_pCqHead, nHead + 1);
+
+	--m_nInFlight;
+	return true;
+}
+
+#endif // STREAMENGINE_SUPPORT_IO_URING
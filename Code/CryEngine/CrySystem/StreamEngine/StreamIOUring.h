@@ -0,0 +1,81 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+// -------------------------------------------------------------------------
+//  File name:   StreamIOUring.h
+//  Description: Minimal io_uring submission/completion ring used by the
+//               streaming IO threads on Linux to keep several reads in flight
+// -------------------------------------------------------------------------
+//  History:
+//
+////////////////////////////////////////////////////////////////////////////
+
+#ifndef __StreamIOUring_h__
+#define __StreamIOUring_h__
+#pragma once
+
+#if CRY_PLATFORM_LINUX && defined(__has_include)
+	#if __has_include(<linux/io_uring.h>)
+		#define STREAMENGINE_SUPPORT_IO_URING
+	#endif
+#endif
+
+#if defined(STREAMENGINE_SUPPORT_IO_URING)
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+//////////////////////////////////////////////////////////////////////////
+// Talks to the kernel through the raw syscalls, so there is no dependency on liburing.
+// Not thread safe, owned and used by a single IO thread.
+//////////////////////////////////////////////////////////////////////////
+class CStreamIOUring
+{
+public:
+	struct SCompletion
+	{
+		uint64 nUserData;
+		int    nResult;   // bytes read, or -errno
+	};
+
+	CStreamIOUring();
+	~CStreamIOUring();
+
+	// fails if the kernel doesn't support io_uring or IORING_OP_READ (5.6+)
+	bool   Init(uint32 nEntries);
+	void   Shutdown();
+
+	uint32 GetCapacity() const { return m_nEntries; }
+	uint32 GetInFlight() const { return m_nInFlight + m_nToSubmit; }
+
+	// queues a read, returns false if all entries are in use
+	bool QueueRead(int fd, void* pBuffer, uint32 nSize, uint64 nOffset, uint64 nUserData);
+	// hands the queued reads to the kernel, optionally waits until at least one read completed
+	bool Submit(bool bWaitForCompletion);
+	bool PopCompletion(SCompletion& completion);
+
+private:
+	int           m_fd;
+	uint32        m_nEntries;
+	uint32        m_nInFlight;
+	uint32        m_nToSubmit;
+
+	void*         m_pSqRing;
+	void*         m_pCqRing;
+	size_t        m_nSqRingSize;
+	size_t        m_nCqRingSize;
+	io_uring_sqe* m_pSqes;
+	size_t        m_nSqesSize;
+
+	uint32*       m_pSqHead;
+	uint32*       m_pSqTail;
+	uint32        m_nSqMask;
+	uint32*       m_pSqArray;
+	uint32*       m_pCqHead;
+	uint32*       m_pCqTail;
+	uint32        m_nCqMask;
+	io_uring_cqe* m_pCqes;
+};
+
+#endif // STREAMENGINE_SUPPORT_IO_URING
+
+#endif //__StreamIOUring_h__
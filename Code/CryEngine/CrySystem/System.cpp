@@ -39,6 +39,7 @@
 #include <CrySystem/ICodeCheckpointMgr.h>
 #include "TestSystemLegacy.h"             // CTestSystem
 #include "VisRegTest.h"
+#include "SpecBenchmark.h"
 #include <CryDynamicResponseSystem/IDynamicResponseSystem.h>
 #include <Cry3DEngine/ITimeOfDay.h>
 #include <CryMono/IMonoRuntime.h>
@@ -285,6 +286,7 @@ CSystem::CSystem(const SSystemInitParams& startupParams)
 	m_pIFont = nullptr;
 	m_pTestSystem = nullptr;
 	m_pVisRegTest = nullptr;
+	m_pSpecBenchmark = nullptr;
 	m_rWidth = nullptr;
 	m_rHeight = nullptr;
 	m_rColorBits = nullptr;
@@ -477,6 +479,7 @@ CSystem::~CSystem()
 	FreeLib(m_dll.hGame);
 	FreeLib(m_dll.hSound);
 	SAFE_DELETE(m_pVisRegTest);
+	SAFE_DELETE(m_pSpecBenchmark);
 	SAFE_DELETE(m_pThreadProfiler);
 #if defined(USE_DISK_PROFILER)
 	SAFE_DELETE(m_pDiskProfiler);
@@ -1508,6 +1511,9 @@ bool CSystem::Update(int updateFlags, int nPauseMode)
 	}
 #endif //CAPTURE_REPLAY_LOG
 
+	// transient allocations of two frames ago are released
+	CryGetIMemoryManager()->AdvanceFrameArenas();
+
 	gEnv->pOverloadSceneManager->Update();
 
 	m_pPlatformOS->Tick(m_Time.GetRealFrameTime());
@@ -1823,6 +1829,13 @@ bool CSystem::Update(int updateFlags, int nPauseMode)
 		PhysicsVars* pVars = m_env.pPhysicalWorld->GetPhysVars();
 		pVars->threadLag = 0;
 
+		// The view camera is the default physics LOD observer (see p_lod_dist)
+		if (!gEnv->IsDedicated())
+		{
+			const Vec3 camPos = GetViewCamera().GetPosition();
+			m_env.pPhysicalWorld->SetLODObserver(0, &camPos);
+		}
+
 		CPhysicsThreadTask* pPhysicsThreadTask = ((CPhysicsThreadTask*)m_PhysThread);
 		if (!pPhysicsThreadTask)
 		{
@@ -99,6 +99,7 @@ class CLUADbg;
 struct SDefaultValidator;
 class CPhysRenderer;
 class CVisRegTest;
+class CSpecBenchmark;
 class CThreadProfiler;
 class CImeManager;
 
@@ -123,6 +124,11 @@ struct SSystemCVars
 	ICVar* sys_localization_folder;
 	ICVar* sys_build_folder;
 	int    sys_streaming_in_blocks;
+#if CRY_PLATFORM_LINUX
+	int    sys_streaming_io_uring;
+	int    sys_streaming_io_uring_depth;
+	int    sys_streaming_io_uring_block_size;
+#endif
 
 	int    sys_float_exceptions;
 	int    sys_no_crash_dialog;
@@ -138,6 +144,7 @@ struct SSystemCVars
 	int    sys_vtune;
 	float  sys_update_profile_time;
 	int    sys_limit_phys_thread_count;
+	int    sys_job_system_work_stealing;
 	int    sys_usePlatformSavingAPI;
 #ifndef _RELEASE
 	int    sys_usePlatformSavingAPIEncryption;
@@ -176,8 +183,16 @@ struct SSystemCVars
 
 #if CRY_PLATFORM_WINDOWS
 	int sys_highrestimer;
+	int sys_download_connections;
+	int sys_download_max_active;
+	int sys_download_chunk_size;
 #endif
 
+	int    sys_specBenchmark;
+	float  sys_specBenchmarkDuration;
+	int    sys_specBenchmarkTargetFps;
+	ICVar* sys_specBenchmarkLevel;
+
 	int sys_vr_support;
 };
 extern SSystemCVars g_cvars;
@@ -542,6 +557,8 @@ private:
 	void InitLog();
 	void LoadPatchPaks();
 	bool InitFileSystem_LoadEngineFolders();
+	//! Starts reading the data of the systems initialized later on while the engine keeps initializing.
+	void StartInitPrefetch();
 	bool InitStreamEngine();
 	bool Init3DEngine();
 	bool InitAnimationSystem();
@@ -638,6 +655,7 @@ public:
 	string&           GetDelayedScreeenshot()         { return m_sDelayedScreeenshot; }
 
 	CVisRegTest*&     GetVisRegTestPtrRef()           { return m_pVisRegTest; }
+	CSpecBenchmark*&  GetSpecBenchmarkPtrRef()        { return m_pSpecBenchmark; }
 
 	const CTimeValue& GetLastTickTime(void) const     { return m_lastTickTime; }
 	const ICVar*      GetDedicatedMaxRate(void) const { return m_svDedicatedMaxRate; }
@@ -1008,6 +1026,7 @@ protected: // -------------------------------------------------------------
 	CCmdLine*                                 m_pCmdLine;
 	std::unique_ptr<ITestSystem>              m_pTestSystem; // needed for external test application (0 if not activated yet)
 	CVisRegTest*                              m_pVisRegTest;
+	CSpecBenchmark*                           m_pSpecBenchmark;
 	CThreadManager*                           m_pThreadManager;
 	CResourceManager*                         m_pResourceManager;
 	ITextModeConsole*                         m_pTextModeConsole;
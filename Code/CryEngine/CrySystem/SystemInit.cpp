@@ -6,6 +6,7 @@
 	#include "SystemScheduler.h"
 #endif // defined(MAP_LOADING_SLICING)
 #include <CryCore/CryCustomTypes.h>
+#include <CryCore/CryCrc32.h>
 #include <CryCore/Platform/CryLibrary.h>
 #include <CryString/StringUtils.h>
 #include "NullImplementation/NullInput.h"
@@ -50,6 +51,7 @@
 #include "XConsole.h"
 #include "Log.h"
 #include "XML/xml.h"
+#include "XML/XmlUtils.h"
 #include "StreamEngine/StreamEngine.h"
 #include "BudgetingSystem.h"
 #include "PhysRenderer.h"
@@ -67,11 +69,13 @@
 #include "ResourceManager.h"
 #include "LoadingProfiler.h"
 #include "BootProfiler.h"
+#include "SystemInitGraph.h"
 #include "DiskProfiler.h"
 #include "Watchdog.h"
 #include "Statoscope.h"
 #include "TestSystemLegacy.h"
 #include "VisRegTest.h"
+#include "SpecBenchmark.h"
 #include "MTSafeAllocator.h"
 #include "NotificationNetwork.h"
 #include "HotUpdate.h"
@@ -221,6 +225,7 @@ extern "C"
 //////////////////////////////////////////////////////////////////////////
 
 extern CMTSafeHeap* g_pPakHeap;
+extern int g_nXmlZeroCopyLoading;
 
 #if CRY_PLATFORM_WINDOWS
 extern HMODULE gDLLHandle;
@@ -246,6 +251,8 @@ static inline void InlineInitializationProcessing(const char* sDescription)
 	assert(IsHeapValid());
 	if (gEnv->pLog)
 		gEnv->pLog->UpdateLoadingScreen(0);
+
+	CSystemInitGraph::GetInstance().EndPhase(sDescription);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -418,6 +425,173 @@ static void CmdDumpJobManagerJobList(IConsoleCmdArgs* pArgs)
 	}
 }
 
+//////////////////////////////////////////////////////////////////////////
+static void CmdJobManagerTraceCapture(IConsoleCmdArgs* pArgs)
+{
+	if (gEnv->pJobManager)
+	{
+		const int nFrames = pArgs->GetArgCount() > 1 ? atoi(pArgs->GetArg(1)) : 30;
+		const char* szFileName = pArgs->GetArgCount() > 2 ? pArgs->GetArg(2) : "%USER%/TestResults/jobtrace.json";
+		gEnv->pJobManager->StartTraceCapture((uint32)max(nFrames, 1), szFileName);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+static void CmdPakBenchmarkFileIndex(IConsoleCmdArgs* pArgs)
+{
+	if (gEnv->pCryPak)
+	{
+		const int nIterations = pArgs->GetArgCount() > 1 ? atoi(pArgs->GetArg(1)) : 10;
+		static_cast<CCryPak*>(gEnv->pCryPak)->BenchmarkFileIndex(max(nIterations, 1));
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+static void CmdXmlBenchmark(IConsoleCmdArgs* pArgs)
+{
+	if (pArgs->GetArgCount() < 2)
+	{
+		CryLogAlways("Usage: sys_xml_benchmark <folder> [iterations] [wildcard]");
+		return;
+	}
+	const int nIterations = pArgs->GetArgCount() > 2 ? atoi(pArgs->GetArg(2)) : 10;
+	const char* szWildcard = pArgs->GetArgCount() > 3 ? pArgs->GetArg(3) : "*.xml";
+	static_cast<CXmlUtils*>(gEnv->pSystem->GetXmlUtils())->Benchmark(pArgs->GetArg(1), szWildcard, max(nIterations, 1));
+}
+
+//////////////////////////////////////////////////////////////////////////
+static uint32 PhysBenchmarkChecksum(IPhysicalWorld* pWorld)
+{
+	// Sum of per-entity hashes, so the result doesn't depend on the order of the entity lists
+	uint32 checksum = 0;
+	IPhysicalEntityIt* pIt = pWorld->GetEntitiesIterator();
+	for (pIt->MoveFirst(); IPhysicalEntity* pEntity = pIt->Next(); )
+	{
+		pe_status_pos sp;
+		pe_status_dynamics sd;
+		if (pEntity->GetType() == PE_STATIC || !pEntity->GetStatus(&sp))
+			continue;
+		pEntity->GetStatus(&sd);
+		const int id = pWorld->GetPhysicalEntityId(pEntity);
+		uint32 hash = CCrc32::Compute(&id, sizeof(id));
+		hash = CCrc32::Compute(&sp.pos, sizeof(sp.pos), hash);
+		hash = CCrc32::Compute(&sp.q, sizeof(sp.q), hash);
+		hash = CCrc32::Compute(&sd.v, sizeof(sd.v), hash);
+		hash = CCrc32::Compute(&sd.w, sizeof(sd.w), hash);
+		checksum += hash;
+	}
+	pIt->Release();
+	return checksum;
+}
+
+//////////////////////////////////////////////////////////////////////////
+static void CmdPhysBenchmark(IConsoleCmdArgs* pArgs)
+{
+	IPhysicalWorld* pWorld = gEnv->pPhysicalWorld;
+	if (pArgs->GetArgCount() < 2 || !pWorld)
+	{
+		CryLogAlways("Usage: p_benchmark <world dump> [steps] [time step] [actions file]");
+		return;
+	}
+	const int numSteps = pArgs->GetArgCount() > 2 ? max(1, atoi(pArgs->GetArg(2))) : 600;
+	const float timeStep = pArgs->GetArgCount() > 3 ? max(0.001f, (float)atof(pArgs->GetArg(3))) : 0.02f;
+
+	// Recorded external actions, one per line: <step> <entity id> <impulse x y z> [<point x y z>]
+	struct SAction
+	{
+		int  step, id;
+		Vec3 impulse, point;
+		bool bPoint;
+	};
+	std::vector<SAction> actions;
+	if (pArgs->GetArgCount() > 4)
+	{
+		FILE* f = fopen(pArgs->GetArg(4), "rt");
+		if (!f)
+		{
+			CryLogAlways("p_benchmark: can't open actions file %s", pArgs->GetArg(4));
+			return;
+		}
+		char line[256];
+		while (fgets(line, sizeof(line), f))
+		{
+			SAction action;
+			const int numRead = sscanf(line, "%d %d %f %f %f %f %f %f", &action.step, &action.id,
+			                           &action.impulse.x, &action.impulse.y, &action.impulse.z, &action.point.x, &action.point.y, &action.point.z);
+			if (numRead >= 5)
+			{
+				action.bPoint = numRead == 8;
+				actions.push_back(action);
+			}
+		}
+		fclose(f);
+		std::stable_sort(actions.begin(), actions.end(), [](const SAction& a, const SAction& b) { return a.step < b.step; });
+	}
+
+	// The dump is loaded into the running world, so this is meant for a headless launch without a level,
+	// e.g. "-dedicated +p_benchmark world.phump 1000"
+	gEnv->pSystem->SetThreadState(ESubsys_Physics, false);
+	if (!pWorld->SerializeWorld(pArgs->GetArg(1), 2))
+	{
+		CryLogAlways("p_benchmark: failed to load %s (missing file or a dump from a different build)", pArgs->GetArg(1));
+		gEnv->pSystem->SetThreadState(ESubsys_Physics, true);
+		return;
+	}
+	PhysicsVars* pVars = pWorld->GetPhysVars();
+	const int bProfileGroups = pVars->bProfileGroups;
+	pVars->bProfileGroups = 1;
+	pVars->bSingleStepMode = 0;
+	const uint32 checksumStart = PhysBenchmarkChecksum(pWorld);
+
+	enum { eStage_Entities, eStage_Solver, eStage_Queue, eStage_Step, eStage_Events, eStage_Count };
+	static const char* s_stageNames[eStage_Count] = { "Entities (colldet + integration)", "of which the Solver", "Queued requests", "World step total", "Events" };
+	static const int s_stageGroups[eStage_Count - 1] = { 12, 13, 14, 15 };
+	int64 ticksTotal[eStage_Count] = { 0 }, ticksMax[eStage_Count] = { 0 };
+	size_t iAction = 0;
+	const int64 timeStart = CryGetTicks();
+
+	for (int iStep = 0; iStep < numSteps; iStep++)
+	{
+		for (; iAction < actions.size() && actions[iAction].step <= iStep; iAction++)
+			if (IPhysicalEntity* pEntity = pWorld->GetPhysicalEntityById(actions[iAction].id))
+			{
+				pe_action_impulse ai;
+				ai.impulse = actions[iAction].impulse;
+				if (actions[iAction].bPoint)
+					ai.point = actions[iAction].point;
+				pEntity->Action(&ai);
+			}
+
+		pWorld->TimeStep(timeStep);
+		int64 ticks[eStage_Count];
+		const int64 timeEvents = CryGetTicks();
+		pWorld->PumpLoggedEvents();
+		ticks[eStage_Events] = CryGetTicks() - timeEvents;
+
+		phys_profile_info* pGroups;
+		pWorld->GetGroupProfileInfo(pGroups);
+		for (int i = 0; i < eStage_Count - 1; i++)
+			ticks[i] = pGroups[s_stageGroups[i]].nTicksLast;
+		for (int i = 0; i < eStage_Count; i++)
+		{
+			ticksTotal[i] += ticks[i];
+			ticksMax[i] = max(ticksMax[i], ticks[i]);
+		}
+	}
+
+	const float wallTime = gEnv->pTimer->TicksToSeconds(CryGetTicks() - timeStart);
+	CryLogAlways("p_benchmark: %s, %d steps of %.4fs, %d actions, %.3fs wall time", pArgs->GetArg(1), numSteps, timeStep, (int)iAction, wallTime);
+	for (int i = 0; i < eStage_Count; i++)
+	{
+		CryLogAlways("  %-34s avg %7.3fms  max %7.3fms", s_stageNames[i],
+		             gEnv->pTimer->TicksToSeconds(ticksTotal[i]) * 1000.0f / numSteps, gEnv->pTimer->TicksToSeconds(ticksMax[i]) * 1000.0f);
+	}
+	CryLogAlways("  checksum start %08x end %08x", checksumStart, PhysBenchmarkChecksum(pWorld));
+
+	pVars->bProfileGroups = bProfileGroups;
+	gEnv->pSystem->SetThreadState(ESubsys_Physics, true);
+}
+
 //////////////////////////////////////////////////////////////////////////
 static void CmdDumpThreadConfigList(IConsoleCmdArgs* pArgs)
 {
@@ -1488,7 +1662,8 @@ bool CSystem::InitPhysics()
 	REGISTER_CVAR2("p_profile_functions", &pVars->bProfileFunx, pVars->bProfileFunx, 0,
 	               "Enables detailed profiling of physical environment-sampling functions");
 	REGISTER_CVAR2("p_profile", &pVars->bProfileGroups, pVars->bProfileGroups, 0,
-	               "Enables group profiling of physical entities");
+	               "Enables group profiling of physical entities\n"
+	               "2 - also lists the most expensive rigid body islands");
 	REGISTER_CVAR2("p_GEB_max_cells", &pVars->nGEBMaxCells, pVars->nGEBMaxCells, 0,
 	               "Specifies the cell number threshold after which GetEntitiesInBox issues a warning");
 	REGISTER_CVAR2("p_max_velocity", &pVars->maxVel, pVars->maxVel, 0,
@@ -1596,6 +1771,17 @@ bool CSystem::InitPhysics()
 	               "Turns on explosions debug mode");
 	REGISTER_CVAR2("p_num_threads", &pVars->numThreads, pVars->numThreads, 0,
 	               "The number of internal physics threads");
+	REGISTER_CVAR2("p_island_batch_ents", &pVars->nIslandBatchEnts, pVars->nIslandBatchEnts, 0,
+	               "Consecutive small islands with up to this many entities in total are solved by one physics thread in one go\n"
+	               "(0 - take islands one by one)");
+	REGISTER_CVAR2("p_lod_dist", &pVars->lodDist, pVars->lodDist, 0,
+	               "Islands of rigid bodies and ragdolls farther than this from the view camera (and other LOD observers) step at half rate\n"
+	               "with the skipped time accumulated, twice as far - at quarter rate, and fall asleep sooner (0 - off)");
+	REGISTER_CVAR2("p_lod_sleep_scale", &pVars->lodSleepScale, pVars->lodSleepScale, 0,
+	               "Multiplier of the sleep energy threshold for each physics LOD level (see p_lod_dist)");
+	REGISTER_CVAR2("p_async_step", &pVars->bAsyncStep, pVars->bAsyncStep, 0,
+	               "PhysX only: the last simulation substep runs in the background until the next physics time step,\n"
+	               "overlapping with game logic (entity states lag one substep behind)");
 	REGISTER_CVAR2("p_joint_damage_accum", &pVars->jointDmgAccum, pVars->jointDmgAccum, 0,
 	               "Default fraction of damage (tension) accumulated on a breakable joint");
 	REGISTER_CVAR2("p_joint_damage_accum_threshold", &pVars->jointDmgAccumThresh, pVars->jointDmgAccumThresh, 0,
@@ -1630,6 +1816,12 @@ bool CSystem::InitPhysics()
 	REGISTER_CVAR2("p_num_startup_overload_checks", &pVars->nStartupOverloadChecks, pVars->nStartupOverloadChecks, 0,
 	               "For this many frames after loading a level, check if the physics gets overloaded and freezes non-player physicalized objects that are slow enough");
 
+	REGISTER_COMMAND("p_benchmark", CmdPhysBenchmark, VF_NULL,
+	                 "Loads a binary world dump (p_do_step 3), replays it for a number of fixed steps together with optional recorded impulses\n"
+	                 "and logs the average and peak timings of the step stages and checksums of the entity states before and after\n"
+	                 "Identical end checksums across runs mean the replay is deterministic\n"
+	                 "Usage: p_benchmark <world dump> [steps] [time step] [actions file]");
+
 	pVars->flagsColliderDebris = geom_colltype_debris;
 	pVars->flagsANDDebris = ~(geom_colltype_vehicle | geom_colltype6);
 	pVars->ticksPerSecond = gEnv->pTimer->GetTicksPerSecond();
@@ -2152,6 +2344,43 @@ bool CSystem::InitAnimationSystem()
 	return true;
 }
 
+//////////////////////////////////////////////////////////////////////////
+void CSystem::StartInitPrefetch()
+{
+	LOADING_TIME_PROFILE_SECTION;
+
+	// Same conditions as the initialization of the systems further down, each of them joins its task first.
+	CSystemInitGraph& initGraph = CSystemInitGraph::GetInstance();
+	if (!CSystemInitGraph::IsPrefetchEnabled())
+		return;
+
+	if (!m_startupParams.bMinimal)
+	{
+		ICVar* const pLanguage = m_env.pConsole ? m_env.pConsole->GetCVar("g_language") : nullptr;
+		stack_string languagePak = (pLanguage && *pLanguage->GetString()) ? pLanguage->GetString() : CRYENGINE_DEFAULT_LOCALIZATION_LANG;
+		languagePak += "_xml.pak";
+		initGraph.StartPrefetch("Localization", g_cvars.sys_localization_folder->GetString(), languagePak.c_str(), false);
+	}
+
+	if (!m_startupParams.bPreview && !m_bDedicatedServer && !m_bUIFrameworkMode && !m_startupParams.bShaderCacheGen &&
+	    (m_sys_audio_disable->GetIVal() == 0))
+	{
+		const string audioConfigPath = PathUtil::Make(PathUtil::GetGameFolder().c_str(), AUDIO_SYSTEM_DATA_ROOT CRY_NATIVE_PATH_SEPSTR "ace");
+		initGraph.StartPrefetch("Audio", audioConfigPath.c_str(), "*.xml", true);
+	}
+
+	if (!m_startupParams.bSkipRenderer && !m_bDedicatedServer && !m_startupParams.bShaderCacheGen)
+	{
+		initGraph.StartPrefetch("Shaders", "Shaders", "*.ext", false);
+	}
+
+	if (!m_startupParams.bPreview && !m_bUIFrameworkMode && !m_startupParams.bShaderCacheGen &&
+	    !(gEnv->IsDedicated() && m_svAISystem && !m_svAISystem->GetIVal()))
+	{
+		initGraph.StartPrefetch("AI", "Scripts/AI", "*.xml;*.lua", true);
+	}
+}
+
 //////////////////////////////////////////////////////////////////////////
 void CSystem::InitLocalization()
 {
@@ -2443,6 +2672,8 @@ bool CSystem::Init()
 {
 	LOADING_TIME_PROFILE_SECTION;
 
+	CSystemInitGraph::SScope initGraphScope;
+
 	SetSystemGlobalState(ESYSTEM_GLOBAL_STATE_INIT);
 	gEnv->mMainThreadId = GetCurrentThreadId();     //Set this ASAP on startup
 
@@ -2900,6 +3131,8 @@ bool CSystem::Init()
 		InitStreamEngine();
 		InlineInitializationProcessing("CSystem::Init StreamEngine");
 
+		StartInitPrefetch();
+
 		//	if (!g_sysSpecChanged)
 		//		OnSysSpecChange( m_sys_spec );
 
@@ -2995,6 +3228,7 @@ bool CSystem::Init()
 		//////////////////////////////////////////////////////////////////////////
 		if (!m_startupParams.bMinimal)
 		{
+			CSystemInitGraph::GetInstance().Join("Localization");
 			InitLocalization();
 		}
 		InlineInitializationProcessing("CSystem::Init InitLocalizations");
@@ -3010,6 +3244,8 @@ bool CSystem::Init()
 			CryLogAlways("<Audio>: AudioSystem initialization");
 			INDENT_LOG_DURING_SCOPE();
 
+			CSystemInitGraph::GetInstance().Join("Audio");
+
 			bAudioInitSuccess = InitializeEngineModule(DLL_AUDIOSYSTEM, cryiidof<CryAudio::ISystemModule>(), false);
 		}
 
@@ -3038,6 +3274,8 @@ bool CSystem::Init()
 			assert(IsHeapValid());
 			CryLogAlways("Renderer initialization");
 
+			CSystemInitGraph::GetInstance().Join("Shaders");
+
 			if (!InitRenderer((m_startupParams.bEditor) ? (WIN_HWND)1 : m_hWnd))
 				return false;
 			assert(IsHeapValid());
@@ -3496,6 +3734,8 @@ bool CSystem::Init()
 				CryLogAlways("AI initialization");
 				INDENT_LOG_DURING_SCOPE();
 
+				CSystemInitGraph::GetInstance().Join("AI");
+
 				if (!InitAISystem())
 					return false;
 			}
@@ -3658,6 +3898,13 @@ bool CSystem::Init()
 	// All CVars should be registered by this point, we must now flush the cvar groups
 	OnSysSpecChange(m_sys_spec);
 
+	// Apply the benchmarked spec profile (or schedule the benchmark when the hardware changed)
+	if (g_cvars.sys_specBenchmark && !m_bEditor && !m_env.IsDedicated() && m_env.pRenderer && !m_pSpecBenchmark)
+	{
+		m_pSpecBenchmark = new CSpecBenchmark();
+		m_pSpecBenchmark->Init();
+	}
+
 #if CRY_PLATFORM_WINDOWS
 	// This code works around a potential perf limit inside the engine due to excessive use of sleeps, etc. Increasing the system wide
 	// timer resolution will cause the OS scheduler to respond more instantly. However, it's not recommended to enable this cvar by
@@ -4713,6 +4960,19 @@ static void VisRegTest(IConsoleCmdArgs* pParams)
 	visRegTest->Init(pParams);
 }
 
+static void SpecBenchmark(IConsoleCmdArgs* pParams)
+{
+	CSystem* pCSystem = static_cast<CSystem*>(gEnv->pSystem);
+	CSpecBenchmark*& specBenchmark = pCSystem->GetSpecBenchmarkPtrRef();
+	if (!specBenchmark)
+	{
+		specBenchmark = new CSpecBenchmark();
+		specBenchmark->Init();
+	}
+
+	specBenchmark->Start();
+}
+
 void CSystem::WatchDogTimeOutChanged(ICVar* pCVar)
 {
 	CSystem* pCSystem = static_cast<CSystem*>(gEnv->pSystem);
@@ -4809,6 +5069,9 @@ void CSystem::CreateSystemVars()
 	attachVariable("sys_PakInMemorySizeLimit", &g_cvars.pakVars.nInMemoryPerPakSizeLimit, "Individual pak size limit for being loaded into memory (MB)");
 	attachVariable("sys_PakTotalInMemorySizeLimit", &g_cvars.pakVars.nTotalInMemoryPakSizeLimit, "Total limit (in MB) for all in memory paks");
 	attachVariable("sys_PakLoadCache", &g_cvars.pakVars.nLoadCache, "Load in memory paks from _LoadCache folder");
+	attachVariable("sys_PakLevelCacheInMemorySizeLimit", &g_cvars.pakVars.nLevelCacheInMemorySizeLimit,
+	               "Size limit (in MB) up to which a _LevelCache pak used only during level loading is read into memory in one sequential read.\n"
+	               "Larger paks are read file by file. Pack the paks in recorded access order (auto_resources_sequence.txt) to make the most of this");
 	attachVariable("sys_PakLoadModePaks", &g_cvars.pakVars.nLoadModePaks, "Load mode switching paks from modes folder");
 	attachVariable("sys_PakStreamCache", &g_cvars.pakVars.nStreamCache, "Load in memory paks for faster streaming (cgf_cache.pak,dds_cache.pak)");
 	attachVariable("sys_PakSaveTotalResourceList", &g_cvars.pakVars.nSaveTotalResourceList, "Save resource list");
@@ -4823,8 +5086,23 @@ void CSystem::CreateSystemVars()
 	attachVariable("sys_PakValidateFileHash", &g_cvars.pakVars.nValidateFileHashes, "Validate file hashes in pak files for collisions");
 	attachVariable("sys_LoadFrontendShaderCache", &g_cvars.pakVars.nLoadFrontendShaderCache, "Load frontend shader cache (on/off)");
 	attachVariable("sys_UncachedStreamReads", &g_cvars.pakVars.nUncachedStreamReads, "Enable stream reads via an uncached file handle");
+	attachVariable("sys_PakFileIndex", &g_cvars.pakVars.nFileIndex, "Find files in paks through a path hash index shared by all paks instead of searching the directory of every pak.\n"
+	               "Paks opened while it was disabled are always searched through their directory");
+	REGISTER_COMMAND("sys_PakBenchmarkFileIndex", CmdPakBenchmarkFileIndex, VF_NULL,
+	                 "Replays the file opens recorded by the disk profiler (profile_disk) through the pak file index and through\n"
+	                 "the directory search of every pak, and logs the timings of both\n"
+	                 "Usage: sys_PakBenchmarkFileIndex [iterations]");
+	attachVariable("sys_PakMapStoredFiles", &g_cvars.pakVars.nMapStoredFiles, "Memory map paks and hand out files stored without compression or encryption as views into the mapping instead of reading them into memory");
 	attachVariable("sys_PakDisableNonLevelRelatedPaks", &g_cvars.pakVars.nDisableNonLevelRelatedPaks, "Disables all paks that are not required by specific level; This is used with per level splitted assets.");
 
+	REGISTER_CVAR2("sys_xml_zero_copy", &g_nXmlZeroCopyLoading, g_nXmlZeroCopyLoading, VF_NULL,
+	               "Build binary XML documents stored uncompressed in mapped paks (sys_PakMapStoredFiles) or in large loose files\n"
+	               "directly on top of the file mapping instead of reading them into memory");
+	REGISTER_COMMAND("sys_xml_benchmark", CmdXmlBenchmark, VF_NULL,
+	                 "Loads the XML files in a folder (e.g. a level folder) as binary XML views, as binary XML copies and\n"
+	                 "as text XML parsed into CXmlNode trees, and logs the timings\n"
+	                 "Usage: sys_xml_benchmark <folder> [iterations] [wildcard]");
+
 	REGISTER_CVAR2("sys_intromoviesduringinit", &g_cvars.sys_intromoviesduringinit, 0, VF_NULL, "Render the intro movies during game initialization");
 
 	{
@@ -5006,7 +5284,20 @@ void CSystem::CreateSystemVars()
 	                                           "Defaults to 4 on consoles and 8 threads an PC"
 	                                           "Set to 0 to create as many threads as cores are available");
 
+	REGISTER_CVAR2("sys_job_system_work_stealing", &g_cvars.sys_job_system_work_stealing, 0, VF_REQUIRE_APP_RESTART,
+	               "Enables per worker job deques with work stealing in the thread backend.\n"
+	               "Usage: sys_job_system_work_stealing 0/1\n"
+	               "0: All jobs are pushed into the shared per priority job queues.\n"
+	               "1: Jobs added from a worker thread are pushed into that worker's deque, idle workers steal from other workers.\n"
+	               "Only read at startup.");
+
 	REGISTER_COMMAND("sys_job_system_dump_job_list", CmdDumpJobManagerJobList, VF_CHEAT, "Show a list of all registered job in the console");
+	REGISTER_COMMAND("sys_job_system_trace_capture", CmdJobManagerTraceCapture, VF_CHEAT,
+	                 "Captures the job system profiling data of the next frames as a Chrome trace event file,\n"
+	                 "to be opened with chrome://tracing or ui.perfetto.dev\n"
+	                 "Usage: sys_job_system_trace_capture [frames] [file]\n"
+	                 "Default is 30 frames written to %USER%/TestResults/jobtrace.json\n"
+	                 "The render pipeline profiler sections are added as CPU and GPU tracks");
 
 	m_sys_spec = REGISTER_INT_CB("sys_spec", CONFIG_CUSTOM, VF_ALWAYSONCHANGE,    // starts with CONFIG_CUSTOM so callback is called when setting initial value
 	                             "Tells the system cfg spec. (0=custom, 1=low, 2=med, 3=high, 4=very high, 5=XBoxOne, 6=PS4)",
@@ -5084,6 +5375,16 @@ void CSystem::CreateSystemVars()
 	REGISTER_CVAR2("sys_streaming_in_blocks", &g_cvars.sys_streaming_in_blocks, 1, VF_NULL,
 	               "Streaming of large files happens in blocks");
 
+#if CRY_PLATFORM_LINUX
+	REGISTER_CVAR2("sys_streaming_io_uring", &g_cvars.sys_streaming_io_uring, 1, VF_REQUIRE_APP_RESTART,
+	               "Use io_uring on the streaming IO threads to keep several reads of pak files in flight\n"
+	               "Falls back to blocking reads if the kernel doesn't support it (needs 5.6+)");
+	REGISTER_CVAR2("sys_streaming_io_uring_depth", &g_cvars.sys_streaming_io_uring_depth, 32, VF_REQUIRE_APP_RESTART,
+	               "Maximum number of reads in flight per streaming IO thread when using io_uring");
+	REGISTER_CVAR2("sys_streaming_io_uring_block_size", &g_cvars.sys_streaming_io_uring_block_size, 128, VF_NULL,
+	               "Size in KB of the individual reads issued with io_uring, streaming pages are split into reads of this size");
+#endif
+
 	REGISTER_CVAR2("sys_float_exceptions", &g_cvars.sys_float_exceptions, 0, 0,
 	               "Floating Point Exceptions:\n"
 	               "  0 = Disabled\n"
@@ -5244,6 +5545,16 @@ void CSystem::CreateSystemVars()
 
 	REGISTER_COMMAND("VisRegTest", &VisRegTest, 0, "Run visual regression test.\n"
 	                                               "Usage: VisRegTest [<name>=test] [<config>=visregtest.xml] [quit=false]");
+	REGISTER_COMMAND("sys_RunSpecBenchmark", &SpecBenchmark, 0, "Runs the spec benchmark on the current level and stores the resulting profile");
+
+	REGISTER_CVAR2("sys_specBenchmark", &g_cvars.sys_specBenchmark, 0, VF_NULL,
+	               "Benchmark based spec detection: 1 = apply the stored profile, run the benchmark when there is none or the hardware/driver changed");
+	REGISTER_CVAR2("sys_specBenchmarkDuration", &g_cvars.sys_specBenchmarkDuration, 20.0f, VF_NULL,
+	               "Measured duration of the spec benchmark in seconds (after a short warm up)");
+	REGISTER_CVAR2("sys_specBenchmarkTargetFps", &g_cvars.sys_specBenchmarkTargetFps, 60, VF_NULL,
+	               "Frame rate the spec benchmark picks the cvar group settings for");
+	g_cvars.sys_specBenchmarkLevel = REGISTER_STRING("sys_specBenchmarkLevel", "", VF_NULL,
+	                                                 "Level loaded for the spec benchmark when it has to run, empty = run on the first level loaded");
 
 #if CAPTURE_REPLAY_LOG
 	REGISTER_COMMAND("memDumpAllocs", &DumpAllocs, 0, "print allocs with stack traces");
@@ -5261,6 +5572,8 @@ void CSystem::CreateSystemVars()
 	CCryMemoryManager::RegisterCVars();
 #endif
 
+	CSystemInitGraph::RegisterCVars();
+
 #if CRY_PLATFORM_WINDOWS || CRY_PLATFORM_DURANGO
 	REGISTER_CVAR2("sys_display_threads", &g_cvars.sys_display_threads, 0, 0, "Displays Thread info");
 #endif
@@ -5327,6 +5640,12 @@ void CSystem::CreateSystemVars()
 
 #if CRY_PLATFORM_WINDOWS
 	REGISTER_CVAR2("sys_highrestimer", &g_cvars.sys_highrestimer, 0, VF_REQUIRE_APP_RESTART, "Enables high resolution system timer.");
+	REGISTER_CVAR2("sys_download_connections", &g_cvars.sys_download_connections, 4, VF_NULL,
+	               "Number of connections used per download when the server supports byte ranges (1-16).");
+	REGISTER_CVAR2("sys_download_max_active", &g_cvars.sys_download_max_active, 2, VF_NULL,
+	               "Number of downloads running at the same time, further downloads wait in the queue.");
+	REGISTER_CVAR2("sys_download_chunk_size", &g_cvars.sys_download_chunk_size, 4096, VF_NULL,
+	               "Size in KB of the ranges a download is split into. Resuming a download only fetches the missing ranges.");
 #endif
 
 	g_cvars.sys_intromoviesduringinit = 0;
@@ -0,0 +1,311 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "StdAfx.h"
+#include "SystemInitGraph.h"
+#include "BootProfiler.h"
+#include <CryString/CryPath.h>
+
+int CSystemInitGraph::s_sys_init_prefetch = 1;
+int CSystemInitGraph::s_sys_init_prefetch_max_mb = 64;
+
+//////////////////////////////////////////////////////////////////////////
+CSystemInitGraph& CSystemInitGraph::GetInstance()
+{
+	static CSystemInitGraph s_instance;
+	return s_instance;
+}
+
+//////////////////////////////////////////////////////////////////////////
+CSystemInitGraph::CSystemInitGraph()
+	: m_nCurrentPhase(-1)
+	, m_nLastPhase(-1)
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CSystemInitGraph::RegisterCVars()
+{
+	REGISTER_CVAR2("sys_init_prefetch", &s_sys_init_prefetch, 1, VF_REQUIRE_APP_RESTART,
+	               "Reads the data of the audio, localization, shader and AI initialization on the job system while the\n"
+	               "engine initializes the preceding systems.\n"
+	               "0: off\n"
+	               "1: on (default)");
+	REGISTER_CVAR2("sys_init_prefetch_max_mb", &s_sys_init_prefetch_max_mb, 64, VF_REQUIRE_APP_RESTART,
+	               "Maximum amount of data in MB each initialization prefetch task reads.");
+}
+
+//////////////////////////////////////////////////////////////////////////
+float CSystemInitGraph::ToMS(int64 nTicks) const
+{
+	return gEnv->pTimer ? gEnv->pTimer->TicksToSeconds(nTicks) * 1000.0f : 0.0f;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CSystemInitGraph::Begin()
+{
+	m_nodes.clear();
+	m_nodes.reserve(128);
+
+	SNode phase;
+	phase.name = "CSystem::Init start";
+	phase.threadName = "Main";
+	phase.nStart = phase.nEnd = CryGetTicks();
+	phase.nWait = 0;
+	m_nodes.push_back(phase);
+
+	m_nCurrentPhase = 0;
+	m_nLastPhase = -1;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CSystemInitGraph::EndPhase(const char* szName)
+{
+	if (m_nCurrentPhase < 0)
+		return;
+
+	const int64 nNow = CryGetTicks();
+
+	SNode& current = m_nodes[m_nCurrentPhase];
+	current.name = szName;
+	current.nEnd = nNow;
+	m_nLastPhase = m_nCurrentPhase;
+
+	SNode next;
+	next.threadName = "Main";
+	next.nStart = next.nEnd = nNow;
+	next.nWait = 0;
+	next.deps.push_back(m_nLastPhase);
+	m_nodes.push_back(next);
+	m_nCurrentPhase = (int)m_nodes.size() - 1;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CSystemInitGraph::StartPrefetch(const char* szName, const char* szFolder, const char* szWildcards, bool bRecursive)
+{
+	if (m_nCurrentPhase < 0 || !s_sys_init_prefetch || !gEnv->pJobManager || !gEnv->pCryPak)
+		return;
+
+	SNode node;
+	node.name = szName;
+	node.nStart = node.nEnd = CryGetTicks();
+	node.nWait = 0;
+	if (m_nLastPhase >= 0)
+		node.deps.push_back(m_nLastPhase);
+	m_nodes.push_back(node);
+
+	STask* const pTask = new STask;
+	pTask->nNode = (int)m_nodes.size() - 1;
+	pTask->nStart = pTask->nEnd = node.nStart;
+	pTask->folder = szFolder;
+	pTask->wildcards = szWildcards;
+	pTask->bRecursive = bRecursive;
+	pTask->bJoined = false;
+	pTask->nFiles = 0;
+	pTask->nBytes = 0;
+	m_tasks.push_back(pTask);
+
+	gEnv->pJobManager->AddLambdaJob("InitPrefetch", [this, pTask]() { RunPrefetch(pTask); }, JobManager::eRegularPriority, &pTask->jobState);
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CSystemInitGraph::Join(const char* szName)
+{
+	if (m_nCurrentPhase < 0)
+		return;
+
+	for (STask* pTask : m_tasks)
+	{
+		SNode& node = m_nodes[pTask->nNode];
+		if (pTask->bJoined || node.name != szName)
+			continue;
+
+		const int64 nWaitStart = CryGetTicks();
+		Wait(pTask);
+		m_nodes[m_nCurrentPhase].nWait += CryGetTicks() - nWaitStart;
+		m_nodes[m_nCurrentPhase].deps.push_back(pTask->nNode);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CSystemInitGraph::Wait(STask* pTask)
+{
+	pTask->jobState.Wait();
+	pTask->bJoined = true;
+
+	SNode& node = m_nodes[pTask->nNode];
+	node.nStart = pTask->nStart;
+	node.nEnd = pTask->nEnd;
+	node.threadName = pTask->threadName;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CSystemInitGraph::RunPrefetch(STask* pTask)
+{
+	LOADING_TIME_PROFILE_SECTION_NAMED_ARGS("InitPrefetch", pTask->folder.c_str());
+
+	pTask->nStart = CryGetTicks();
+	const char* szThreadName = gEnv->pThreadManager->GetThreadName(CryGetCurrentThreadId());
+	pTask->threadName = (szThreadName && *szThreadName) ? szThreadName : "Worker";
+
+	std::vector<char> buffer(256 * 1024);
+	PrefetchFolder(pTask, pTask->folder.c_str(), buffer, (uint64)max(s_sys_init_prefetch_max_mb, 0) << 20);
+
+	pTask->nEnd = CryGetTicks();
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CSystemInitGraph::PrefetchFolder(STask* pTask, const char* szFolder, std::vector<char>& buffer, uint64 nBudget)
+{
+	ICryPak* const pPak = gEnv->pCryPak;
+
+	_finddata_t fd;
+	const intptr_t handle = pPak->FindFirst(PathUtil::Make(szFolder, "*.*").c_str(), &fd);
+	if (handle == -1)
+		return true;
+
+	bool bContinue = true;
+	do
+	{
+		if (!strcmp(fd.name, ".") || !strcmp(fd.name, ".."))
+			continue;
+
+		const string path = PathUtil::Make(szFolder, fd.name);
+		if (fd.attrib & _A_SUBDIR)
+		{
+			if (pTask->bRecursive)
+				bContinue = PrefetchFolder(pTask, path.c_str(), buffer, nBudget);
+			continue;
+		}
+
+		bool bMatch = false;
+		const char* szWildcard = pTask->wildcards.c_str();
+		while (*szWildcard && !bMatch)
+		{
+			const char* szEnd = strchr(szWildcard, ';');
+			const CryFixedStringT<64> wildcard(szWildcard, szEnd ? szEnd - szWildcard : strlen(szWildcard));
+			bMatch = PathUtil::MatchWildcard(fd.name, wildcard.c_str());
+			szWildcard = szEnd ? szEnd + 1 : szWildcard + wildcard.length();
+		}
+		if (!bMatch)
+			continue;
+
+		FILE* const pFile = pPak->FOpen(path.c_str(), "rb");
+		if (!pFile)
+			continue;
+
+		++pTask->nFiles;
+		size_t nRead;
+		while ((nRead = pPak->FReadRaw(&buffer[0], 1, buffer.size(), pFile)) > 0)
+		{
+			pTask->nBytes += nRead;
+			if (pTask->nBytes >= nBudget)
+			{
+				bContinue = false;
+				break;
+			}
+		}
+		pPak->FClose(pFile);
+	}
+	while (bContinue && pPak->FindNext(handle, &fd) >= 0);
+
+	pPak->FindClose(handle);
+	return bContinue;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CSystemInitGraph::Finish()
+{
+	if (m_nCurrentPhase < 0)
+		return;
+
+	// the tasks nobody joined (their systems were skipped or the init failed) must be done before they are freed
+	for (STask* pTask : m_tasks)
+	{
+		if (!pTask->bJoined)
+			Wait(pTask);
+	}
+
+	SNode& last = m_nodes[m_nCurrentPhase];
+	last.name = "CSystem::Init end";
+	last.nEnd = CryGetTicks();
+
+	Report();
+
+	for (STask* pTask : m_tasks)
+		delete pTask;
+	m_tasks.clear();
+	m_nodes.clear();
+	m_nCurrentPhase = -1;
+	m_nLastPhase = -1;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CSystemInitGraph::Report()
+{
+	// walk back from the end of the init along the dependency that finished last
+	std::vector<int> path;
+	for (int nNode = m_nCurrentPhase; nNode >= 0; )
+	{
+		path.push_back(nNode);
+
+		int nCritical = -1;
+		for (int nDep : m_nodes[nNode].deps)
+		{
+			if (nCritical < 0 || m_nodes[nDep].nEnd > m_nodes[nCritical].nEnd)
+				nCritical = nDep;
+		}
+		nNode = nCritical;
+	}
+	std::reverse(path.begin(), path.end());
+
+	const int64 nBegin = m_nodes[0].nStart;
+	const float fTotalMS = ToMS(m_nodes[m_nCurrentPhase].nEnd - nBegin);
+
+	float fWaitMS = 0.0f;
+	for (const SNode& node : m_nodes)
+		fWaitMS += ToMS(node.nWait);
+
+	CryLogAlways("System initialization took %.1f ms, main thread waited %.1f ms for prefetch tasks. Critical path:", fTotalMS, fWaitMS);
+
+#if defined(ENABLE_LOADING_PROFILER)
+	std::vector<CBootProfiler::SCriticalPathStep> steps;
+	steps.reserve(path.size());
+#endif
+
+	for (int nNode : path)
+	{
+		const SNode& node = m_nodes[nNode];
+		const float fDurationMS = ToMS(node.nEnd - node.nStart);
+		const float fNodeWaitMS = ToMS(node.nWait);
+
+		// the long steps are what matters, the rest only clutters the log
+		if (fDurationMS >= 1.0f)
+		{
+			stack_string wait;
+			if (fNodeWaitMS >= 0.1f)
+				wait.Format(", waited %.1f ms", fNodeWaitMS);
+			CryLogAlways("  %8.1f ms  %s (%s)%s", fDurationMS, node.name.c_str(), node.threadName.c_str(), wait.c_str());
+		}
+
+#if defined(ENABLE_LOADING_PROFILER)
+		CBootProfiler::SCriticalPathStep step;
+		step.name = node.name.c_str();
+		step.threadName = node.threadName.c_str();
+		step.startMS = ToMS(node.nStart - nBegin);
+		step.durationMS = fDurationMS;
+		step.waitMS = fNodeWaitMS;
+		steps.push_back(step);
+#endif
+	}
+
+	for (const STask* pTask : m_tasks)
+	{
+		const SNode& node = m_nodes[pTask->nNode];
+		CryLog("Init prefetch '%s': %u files, %.1f MB in %.1f ms on %s", node.name.c_str(), pTask->nFiles, pTask->nBytes / (1024.0f * 1024.0f),
+		       ToMS(node.nEnd - node.nStart), node.threadName.c_str());
+	}
+
+#if defined(ENABLE_LOADING_PROFILER)
+	CBootProfiler::GetInstance().SetCriticalPath(steps.empty() ? nullptr : &steps[0], steps.size(), fTotalMS);
+#endif
+}
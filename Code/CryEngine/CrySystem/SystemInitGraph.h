@@ -0,0 +1,82 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#pragma once
+
+#include <CryThreading/IJobManager.h>
+
+//////////////////////////////////////////////////////////////////////////
+// Records CSystem::Init as a graph and runs the file I/O of later init steps concurrently on the job system.
+// The main thread phases are the steps between two InlineInitializationProcessing() calls and form a chain.
+// A prefetch task reads the files a later step is going to parse, so that the step finds them in the file cache.
+// It depends on the phase that completed before it was started, and the phase that joins it depends on the task.
+// The subsystem inits themselves stay sequential, they register console variables and publish themselves in gEnv.
+// Once the init is done the critical path through the graph is logged and added to the boot profile.
+//////////////////////////////////////////////////////////////////////////
+class CSystemInitGraph
+{
+public:
+	// Begins the graph on construction and finishes it when it goes out of scope, whichever way CSystem::Init returns.
+	struct SScope
+	{
+		SScope()  { CSystemInitGraph::GetInstance().Begin(); }
+		~SScope() { CSystemInitGraph::GetInstance().Finish(); }
+	};
+
+	static CSystemInitGraph& GetInstance();
+	static void              RegisterCVars();
+	static bool              IsPrefetchEnabled() { return s_sys_init_prefetch != 0; }
+
+	// Ends the current main thread phase, the next one starts right away.
+	void EndPhase(const char* szName);
+
+	// Reads the files in szFolder that match one of the ';' separated wildcards on a worker thread.
+	void StartPrefetch(const char* szName, const char* szFolder, const char* szWildcards, bool bRecursive);
+	// Waits for the prefetch task, the current phase depends on it. Nothing happens if it wasn't started.
+	void Join(const char* szName);
+
+private:
+	struct SNode
+	{
+		CryFixedStringT<64>  name;
+		CryFixedStringT<32>  threadName;
+		int64                nStart;
+		int64                nEnd;
+		int64                nWait;   // main thread time spent joining tasks
+		std::vector<int>     deps;
+	};
+
+	// written by the worker, copied into the task's node once it has been waited for
+	struct STask
+	{
+		int                  nNode;
+		int64                nStart;
+		int64                nEnd;
+		CryFixedStringT<32>  threadName;
+		CryFixedStringT<256> folder;
+		CryFixedStringT<128> wildcards;
+		bool                 bRecursive;
+		bool                 bJoined;
+		uint32               nFiles;
+		uint64               nBytes;
+		CryJobState          jobState;
+	};
+
+	CSystemInitGraph();
+
+	void        Begin();
+	void        Finish();
+	void        Wait(STask* pTask);
+	void        Report();
+
+	void        RunPrefetch(STask* pTask);
+	bool        PrefetchFolder(STask* pTask, const char* szFolder, std::vector<char>& buffer, uint64 nBudget);
+	float       ToMS(int64 nTicks) const;
+
+	static int  s_sys_init_prefetch;
+	static int  s_sys_init_prefetch_max_mb;
+
+	std::vector<SNode>  m_nodes;
+	std::vector<STask*> m_tasks;
+	int                 m_nCurrentPhase;   // index of the running main thread phase, -1 when not recording
+	int                 m_nLastPhase;
+};
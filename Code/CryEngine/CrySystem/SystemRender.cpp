@@ -35,6 +35,7 @@
 #include "CrySizerImpl.h"
 #include <CrySystem/ITestSystem.h>   // ITestSystem
 #include "VisRegTest.h"
+#include "SpecBenchmark.h"
 #include "ThreadProfiler.h"
 #include <CrySystem/Profilers/IDiskProfiler.h>
 #include <CrySystem/ITextModeConsole.h>
@@ -426,6 +427,17 @@ void CSystem::RenderPhysicsStatistics(IPhysicalWorld* pWorld)
 				if (j == nGroups - 3) ++i;
 			}
 		}
+		if (pVars->bProfileGroups == 2)
+		{
+			int nIslands    = pWorld->GetIslandProfileInfo(pInfos);
+			float fColor[4] = { 1.0f, 0.8f, 0.4f, 1.0f };
+			for (int j = 0; j < nIslands; j++, i++)
+			{
+				IRenderAuxText::Draw2dLabel(renderMarginX, renderMarginY + i * lineSize, fontSize, fColor, false,
+				  "Island %.2fms: %d entities, %d contacts - %s (id %d)", gEnv->pTimer->TicksToSeconds(pInfos[j].nTicksLast) * 1000.0f,
+				  pInfos[j].nCallsLast, pInfos[j].nCalls, pInfos[j].pName ? pInfos[j].pName : "", pInfos[j].id);
+			}
+		}
 		if (pVars->bProfileEntities == 2)
 		{
 			int nEnts = m_env.pPhysicalWorld->GetEntityProfileInfo(pInfos);
@@ -704,6 +716,10 @@ void CSystem::Render()
 
 	FUNCTION_PROFILER(GetISystem(), PROFILE_SYSTEM);
 
+	// the spec benchmark flies its own camera path
+	if (m_pSpecBenchmark)
+		m_pSpecBenchmark->BeforeRender(m_ViewCamera);
+
 	//////////////////////////////////////////////////////////////////////
 	//draw
 	m_env.p3DEngine->PreWorldStreamUpdate(m_ViewCamera);
@@ -735,6 +751,9 @@ void CSystem::Render()
 					}
 				}
 
+				if (m_pSpecBenchmark)
+					m_pSpecBenchmark->AfterRender();
+
 #if !defined(_RELEASE)
 				if (m_pVisRegTest)
 					m_pVisRegTest->AfterRender();
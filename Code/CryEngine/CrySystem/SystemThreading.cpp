@@ -3,6 +3,7 @@
 #include "StdAfx.h"
 #include "System.h"
 #include "ThreadConfigManager.h"
+#include "FrameArena.h"
 #include <CryThreading/IThreadManager.h>
 #include <CryCore/CryCustomTypes.h>
 
@@ -218,6 +219,9 @@ unsigned __stdcall CThreadManager::RunThread(void* thisPtr)
 	// Disable FPEs
 	gEnv->pThreadManager->EnableFloatExceptions(eFPE_None);
 
+	// Hand back the frame arena, else every thread that ever ran would keep one
+	CFrameArenaManager::GetInstance().ReleaseThreadArena();
+
 	// Signal imminent thread end
 	pThreadData->m_threadExitMutex.Lock();
 	pThreadData->m_isRunning = false;
@@ -25,6 +25,9 @@ CTestSystemLegacy::CTestSystemLegacy(ISystem* pSystem)
 /*static*/ void CTestSystemLegacy::InitCommands()
 {
 	REGISTER_COMMAND("RunUnitTests", RunUnitTests, VF_INVISIBLE | VF_CHEAT, "Execute a set of unit tests");
+	REGISTER_COMMAND("RunBenchmarks", RunBenchmarks, VF_INVISIBLE | VF_CHEAT,
+	                 "Usage: RunBenchmarks [filter] [output.json] [baseline.json]\n"
+	                 "Times the registered benchmarks, optionally writes the results and compares them against a previous run");
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -41,6 +44,20 @@ CTestSystemLegacy::CTestSystemLegacy(ISystem* pSystem)
 	exit(nExitCode);
 }
 
+//////////////////////////////////////////////////////////////////////////
+/*static*/ void CTestSystemLegacy::RunBenchmarks(IConsoleCmdArgs* pArgs)
+{
+	const char* szFilter = pArgs->GetArgCount() > 1 ? pArgs->GetArg(1) : "";
+	const char* szOutputFile = pArgs->GetArgCount() > 2 ? pArgs->GetArg(2) : "";
+	const char* szBaselineFile = pArgs->GetArgCount() > 3 ? pArgs->GetArg(3) : "";
+
+	// "*" selects all benchmarks while still allowing output and baseline files to be passed
+	if (!strcmp(szFilter, "*"))
+		szFilter = "";
+
+	gEnv->pSystem->GetITestSystem()->GetIUnitTestManager()->RunAllBenchmarks(szFilter, szOutputFile, szBaselineFile);
+}
+
 //////////////////////////////////////////////////////////////////////////
 void CTestSystemLegacy::QuitInNSeconds(const float fInNSeconds)
 {
@@ -44,6 +44,7 @@ private: // --------------------------------------------------------------
 	void        DeactivateCrashDialog();
 
 	static void RunUnitTests(IConsoleCmdArgs* pArgs);
+	static void RunBenchmarks(IConsoleCmdArgs* pArgs);
 
 private: // --------------------------------------------------------------
 	friend class CLevelListener;
@@ -0,0 +1,143 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "StdAfx.h"
+#include "UnitTestThread.h"
+#include <CrySystem/CryUnitTest.h>
+#include <CryMemory/BucketAllocator.h>
+
+#if defined(CRY_UNIT_TESTING) && defined(USE_GLOBAL_BUCKET_ALLOCATOR)
+
+CRY_UNIT_TEST_SUITE(BucketAllocator)
+{
+	enum
+	{
+		kThreadCount = 4,
+		kBlockCount  = 4000,
+	};
+
+	struct SBlock
+	{
+		uint8* pMemory;
+		size_t size;
+		uint8  pattern;
+	};
+
+	// all sizes are served by the buckets
+	size_t GetBlockSize(int nBlock)            { return 16 + (nBlock * 24) % 112; }
+	uint8  GetPattern(int nThread, int nBlock) { return (uint8)(nThread * 31 + nBlock); }
+
+	bool IsFilledWith(const uint8* pMemory, size_t size, uint8 pattern)
+	{
+		for (size_t i = 0; i < size; ++i)
+		{
+			if (pMemory[i] != pattern)
+				return false;
+		}
+		return true;
+	}
+
+	void RunOnThreads(const std::function<void(int)>& function)
+	{
+		std::unique_ptr<CUnitTestThread> threads[kThreadCount];
+		for (int i = 0; i < kThreadCount; ++i)
+		{
+			threads[i].reset(new CUnitTestThread("BucketAllocator", [&function, i]() { function(i); }, i));
+			CRY_UNIT_TEST_ASSERT(threads[i]->IsStarted());
+		}
+	}
+
+	CRY_UNIT_TEST(CUT_BucketThreadCachesCrossThreadFree)
+	{
+		SBucketThreadCacheStats statsBefore;
+		gEnv->pSystem->GetIMemoryManager()->GetBucketThreadCacheStats(statsBefore);
+
+		std::vector<SBlock> blocks[kThreadCount];
+		for (std::vector<SBlock>& threadBlocks : blocks)
+			threadBlocks.resize(kBlockCount, SBlock { nullptr, 0, 0 });
+		volatile int nFailures = 0;
+
+		// every thread allocates its blocks through its own cache
+		RunOnThreads([&](int nThread)
+		{
+			std::vector<SBlock>& threadBlocks = blocks[nThread];
+			for (int i = 0; i < kBlockCount; ++i)
+			{
+				size_t allocated = 0;
+				SBlock& block = threadBlocks[i];
+				block.size = GetBlockSize(i);
+				block.pattern = GetPattern(nThread, i);
+				block.pMemory = static_cast<uint8*>(CryMalloc(block.size, allocated, 0));
+				if (!block.pMemory)
+				{
+					CryInterlockedIncrement(&nFailures);
+					continue;
+				}
+				memset(block.pMemory, block.pattern, block.size);
+			}
+		});
+		CRY_UNIT_TEST_CHECK_EQUAL(int(nFailures), 0);
+
+		// no block was handed out twice: all are distinct and none was overwritten by another thread
+		std::set<uint8*> distinctBlocks;
+		for (int nThread = 0; nThread < kThreadCount; ++nThread)
+		{
+			for (const SBlock& block : blocks[nThread])
+			{
+				distinctBlocks.insert(block.pMemory);
+				CRY_UNIT_TEST_ASSERT(block.pMemory && IsFilledWith(block.pMemory, block.size, block.pattern));
+			}
+		}
+		CRY_UNIT_TEST_CHECK_EQUAL(distinctBlocks.size(), (size_t)(kThreadCount * kBlockCount));
+
+		// every thread frees the blocks of its neighbour into its own cache, and reuses them right away
+		RunOnThreads([&](int nThread)
+		{
+			std::vector<SBlock>& remoteBlocks = blocks[(nThread + 1) % kThreadCount];
+			for (int i = 0; i < kBlockCount; ++i)
+			{
+				SBlock& block = remoteBlocks[i];
+				if (!block.pMemory)
+					continue;
+				if (!IsFilledWith(block.pMemory, block.size, block.pattern))
+					CryInterlockedIncrement(&nFailures);
+				CryFree(block.pMemory, 0);
+				block.pMemory = nullptr;
+
+				if ((i & 3) == 0)
+				{
+					size_t allocated = 0;
+					const size_t size = GetBlockSize(i);
+					uint8* pLocal = static_cast<uint8*>(CryMalloc(size, allocated, 0));
+					if (!pLocal)
+					{
+						CryInterlockedIncrement(&nFailures);
+						continue;
+					}
+					memset(pLocal, GetPattern(nThread, i), size);
+					if (!IsFilledWith(pLocal, size, GetPattern(nThread, i)))
+						CryInterlockedIncrement(&nFailures);
+					CryFree(pLocal, 0);
+				}
+			}
+		});
+		CRY_UNIT_TEST_CHECK_EQUAL(int(nFailures), 0);
+
+	#if !CRY_PLATFORM_ORBIS
+		// the test threads have exited, their caches were flushed and their remote frees retired
+		SBucketThreadCacheStats statsAfter;
+		gEnv->pSystem->GetIMemoryManager()->GetBucketThreadCacheStats(statsAfter);
+
+		const uint64 numLocalAllocs = kThreadCount * (kBlockCount / 4);
+		CRY_UNIT_TEST_ASSERT(statsAfter.numAllocs - statsBefore.numAllocs >= kThreadCount * kBlockCount + numLocalAllocs);
+		CRY_UNIT_TEST_ASSERT(statsAfter.numFrees - statsBefore.numFrees >= kThreadCount * kBlockCount + numLocalAllocs);
+		CRY_UNIT_TEST_ASSERT(statsAfter.numAllocHits > statsBefore.numAllocHits);
+		CRY_UNIT_TEST_ASSERT(statsAfter.numRefills > statsBefore.numRefills);
+		CRY_UNIT_TEST_ASSERT(statsAfter.numFlushes > statsBefore.numFlushes);
+		// retired remote frees only grow, each test thread of the second phase freed a full set of remote blocks
+		// (minus whatever the thread manager allocated on it, hence the margin)
+		CRY_UNIT_TEST_ASSERT(statsAfter.numRemoteFrees >= (uint64)(kThreadCount * kBlockCount / 2));
+	#endif
+	}
+}
+
+#endif // CRY_UNIT_TESTING && USE_GLOBAL_BUCKET_ALLOCATOR
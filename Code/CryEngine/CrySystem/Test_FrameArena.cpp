@@ -0,0 +1,70 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "StdAfx.h"
+#include "FrameArena.h"
+#include <CrySystem/CryUnitTest.h>
+#include <CryThreading/IThreadManager.h>
+
+#if defined(CRY_UNIT_TESTING)
+
+CRY_UNIT_TEST_SUITE(FrameArena)
+{
+	CRY_UNIT_TEST(CUT_FrameArenaBuffers)
+	{
+		// own frame counter, the arenas of the engine threads are not advanced
+		volatile int frameId = 0;
+		CFrameArena arena(1024, &frameId, "UnitTest_FrameArena");
+
+		uint8* p0 = static_cast<uint8*>(arena.Allocate(100, 64));
+		CRY_UNIT_TEST_CHECK_EQUAL((UINT_PTR)p0 & 63, (UINT_PTR)0);
+		uint8* p1 = static_cast<uint8*>(arena.Allocate(100));
+		CRY_UNIT_TEST_ASSERT(p1 >= p0 + 100 && p1 < p0 + 1024);
+
+		// doesn't fit into the buffer, goes to the heap
+		uint8* pLarge = static_cast<uint8*>(arena.Allocate(4096));
+		memset(pLarge, 0xcd, 4096);
+
+		SFrameArenaStats stats;
+		arena.GetStats(stats);
+		CRY_UNIT_TEST_CHECK_EQUAL(stats.numOverflows, 1u);
+		CRY_UNIT_TEST_CHECK_EQUAL(stats.overflowBytes, (size_t)4096);
+
+		// the next frame uses the other buffer, the one after that reuses the first buffer from its start
+		frameId = 1;
+		uint8* pFrame1 = static_cast<uint8*>(arena.Allocate(16));
+		CRY_UNIT_TEST_ASSERT(pFrame1 < p0 || pFrame1 >= p0 + 1024);
+		frameId = 2;
+		uint8* pFrame2 = static_cast<uint8*>(arena.Allocate(100, 64));
+		CRY_UNIT_TEST_ASSERT(pFrame2 == p0);
+
+		arena.GetStats(stats);
+		CRY_UNIT_TEST_ASSERT(stats.peakUsed >= 4096 + 200);
+	}
+
+	#if CRY_FRAME_ARENA
+	class CAllocThread : public IThread
+	{
+	public:
+		CAllocThread() : m_pMemory(nullptr) {}
+		virtual void ThreadEntry() override { m_pMemory = CryFrameArenaAlloc(64); }
+
+		void* m_pMemory;
+	};
+
+	CRY_UNIT_TEST(CUT_FrameArenaThreadExit)
+	{
+		CFrameArenaManager& manager = CFrameArenaManager::GetInstance();
+		const uint32 numReleasedBefore = manager.GetNumReleasedArenas();
+
+		CAllocThread thread;
+		CRY_UNIT_TEST_ASSERT(gEnv->pThreadManager->SpawnThread(&thread, "UnitTest_FrameArenaThread"));
+		gEnv->pThreadManager->JoinThread(&thread, eJM_Join);
+		CRY_UNIT_TEST_ASSERT(thread.m_pMemory != nullptr);
+
+		// the exited thread handed its arena back, it is freed by CSystem::Update two frames later
+		CRY_UNIT_TEST_ASSERT(manager.GetNumReleasedArenas() > numReleasedBefore);
+	}
+	#endif
+}
+
+#endif // CRY_UNIT_TESTING
@@ -0,0 +1,114 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "StdAfx.h"
+#include "Log.h"
+#include <CrySystem/CryUnitTest.h>
+
+#if defined(CRY_UNIT_TESTING)
+
+CRY_UNIT_TEST_SUITE(LogAsyncWriter)
+{
+	const char* const k_szFileName = "UnitTest_LogAsyncWriter.log";
+
+	string ReadFile(const char* szFileName)
+	{
+		string content;
+		if (FILE* pFile = fxopen(szFileName, "rb"))
+		{
+			char buffer[4096];
+			size_t nRead;
+			while ((nRead = fread(buffer, 1, sizeof(buffer), pFile)) > 0)
+				content.append(buffer, nRead);
+			fclose(pFile);
+		}
+		return content;
+	}
+
+	// length of the longest run of c in the text
+	size_t GetLongestRun(const string& text, char c)
+	{
+		size_t nLongest = 0;
+		size_t nRun = 0;
+		for (size_t i = 0; i < text.length(); ++i)
+		{
+			nRun = text[i] == c ? nRun + 1 : 0;
+			nLongest = max(nLongest, nRun);
+		}
+		return nLongest;
+	}
+
+	size_t CountOccurrences(const string& text, const char* szPattern)
+	{
+		size_t nCount = 0;
+		for (size_t nPos = text.find(szPattern); nPos != string::npos; nPos = text.find(szPattern, nPos + 1))
+			++nCount;
+		return nCount;
+	}
+
+	CRY_UNIT_TEST(CUT_LogAsyncWriterRing)
+	{
+		remove(k_szFileName);
+
+		// no writer thread, the ring is only drained by Flush, which makes filling it up deterministic
+		SExclusiveThreadAccessLock exclusiveLock;
+		CLogAsyncWriter writer(&exclusiveLock);
+		writer.SetFileName(k_szFileName);
+		CRY_UNIT_TEST_ASSERT(writer.Start(false));
+
+		CLogAsyncWriter::SStats stats;
+		writer.GetStats(stats);
+		const uint32 nCapacity = stats.nCapacity;
+		CRY_UNIT_TEST_ASSERT(nCapacity > 0);
+
+		// drop: single record messages fill the ring, the next one doesn't fit
+		char szLine[64];
+		for (uint32 i = 0; i < nCapacity; ++i)
+		{
+			cry_sprintf(szLine, "line %u", i);
+			CRY_UNIT_TEST_ASSERT(writer.Push(szLine, strlen(szLine), false));
+		}
+		CRY_UNIT_TEST_ASSERT(!writer.Push("dropped", 7, false));
+		writer.GetStats(stats);
+		CRY_UNIT_TEST_CHECK_EQUAL(stats.nDropped, 1u);
+		CRY_UNIT_TEST_CHECK_EQUAL(stats.nPending, nCapacity);
+
+		writer.Flush();
+		writer.GetStats(stats);
+		CRY_UNIT_TEST_CHECK_EQUAL(stats.nWritten, nCapacity);
+		CRY_UNIT_TEST_CHECK_EQUAL(stats.nPending, 0u);
+
+		// wrap: leave one free record before the end of the ring, the next message spans the wrap around
+		for (uint32 i = 0; i < nCapacity - 1; ++i)
+			CRY_UNIT_TEST_ASSERT(writer.Push("x", 1, false));
+		writer.Flush();
+
+		const string sWrapped(2000, 'a');
+		CRY_UNIT_TEST_ASSERT(writer.Push(sWrapped.c_str(), sWrapped.length(), false));
+		writer.Flush();
+
+		// truncation: a message longer than the maximum span is cut
+		const string sTruncated(64 * 1024, 'b');
+		CRY_UNIT_TEST_ASSERT(writer.Push(sTruncated.c_str(), sTruncated.length(), false));
+		writer.GetStats(stats);
+		CRY_UNIT_TEST_CHECK_EQUAL(stats.nTruncated, 1u);
+
+		// the second shutdown (from the destructor) must not write the report again
+		writer.Shutdown();
+		writer.Shutdown();
+		CRY_UNIT_TEST_ASSERT(!writer.Start(false));
+
+		const string content = ReadFile(k_szFileName);
+		CRY_UNIT_TEST_ASSERT(content.find("line 0\n") != string::npos);
+		cry_sprintf(szLine, "line %u\n", nCapacity - 1);
+		CRY_UNIT_TEST_ASSERT(content.find(szLine) != string::npos);
+		CRY_UNIT_TEST_CHECK_EQUAL(CountOccurrences(content, "1 messages were dropped"), (size_t)1);
+		CRY_UNIT_TEST_CHECK_EQUAL(GetLongestRun(content, 'a'), sWrapped.length());
+		const size_t nTruncatedLength = GetLongestRun(content, 'b');
+		CRY_UNIT_TEST_ASSERT(nTruncatedLength > 0 && nTruncatedLength < sTruncated.length());
+		CRY_UNIT_TEST_CHECK_EQUAL(CountOccurrences(content, "Asynchronous log writer:"), (size_t)1);
+
+		remove(k_szFileName);
+	}
+}
+
+#endif // CRY_UNIT_TESTING
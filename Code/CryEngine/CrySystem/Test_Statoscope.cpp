@@ -0,0 +1,200 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "StdAfx.h"
+#include "Statoscope.h"
+#include "../../Tools/CryCommonTools/Statoscope/StatoscopeReader.h"
+#include <CrySystem/CryUnitTest.h>
+
+#if defined(CRY_UNIT_TESTING) && ENABLE_STATOSCOPE
+
+CRY_UNIT_TEST_SUITE(StatoscopeCompactFormat)
+{
+	// collects what the IO thread sends
+	class CMemoryDataWriter : public CDataWriter
+	{
+	public:
+		CMemoryDataWriter()
+			: CDataWriter(true, 5.0f)
+		{
+			m_DataThread.SetDataWriter(this);
+		}
+
+		virtual bool Open() override { return true; }
+		virtual void SendData(const char* pBuffer, int nBytes) override
+		{
+			CryAutoLock<CryCriticalSectionNonRecursive> lock(m_lock);
+			m_data.insert(m_data.end(), pBuffer, pBuffer + nBytes);
+		}
+
+		std::vector<char> GetData()
+		{
+			CryAutoLock<CryCriticalSectionNonRecursive> lock(m_lock);
+			return m_data;
+		}
+
+	private:
+		CryCriticalSectionNonRecursive m_lock;
+		std::vector<char>              m_data;
+	};
+
+	// a few counters that mostly stay the same, which the delta coding turns into zeros
+	struct SCounterDG : public IStatoscopeDataGroup
+	{
+		virtual SDescription GetDescription() const override
+		{
+			return SDescription('!', "unit test counters", "['/UnitTest/' (float time) (int frame) (int constant)]");
+		}
+
+		virtual void Write(IStatoscopeFrameRecord& fr) override
+		{
+			fr.AddValue(nFrame * 0.25f);
+			fr.AddValue(nFrame);
+			fr.AddValue(1234);
+		}
+
+		int nFrame = 0;
+	};
+
+	// a varying number of named instances with strings, so that a record has fewer values than the previous one
+	struct SInstanceDG : public IStatoscopeDataGroup
+	{
+		virtual SDescription GetDescription() const override
+		{
+			return SDescription('?', "unit test instances", "['/UnitTest/Instances/$' (string name) (int value)]");
+		}
+
+		virtual uint32 PrepareToWrite() override { return 1 + nFrame % 3; }
+
+		virtual void Write(IStatoscopeFrameRecord& fr) override
+		{
+			for (int i = 0, n = 1 + nFrame % 3; i < n; ++i)
+			{
+				fr.AddValue(i == 0 ? "instance0" : "instanceN");
+				fr.AddValue(i == 0 ? "first" : "other");
+				fr.AddValue(nFrame * 10 + i);
+			}
+		}
+
+		int nFrame = 0;
+	};
+
+	CRY_UNIT_TEST(CUT_StatoscopeCompactRoundTrip)
+	{
+		const int kFrameCount = 200;
+
+		CMemoryDataWriter writer;
+		writer.SetCompactFormat(true);
+		CRY_UNIT_TEST_ASSERT(writer.IsCompactFormat());
+
+		SCounterDG counters;
+		SInstanceDG instances;
+		CStatoscopeDataGroup groups[] = {
+			CStatoscopeDataGroup(counters.GetDescription(), &counters),
+			CStatoscopeDataGroup(instances.GetDescription(), &instances)
+		};
+		const int kGroupCount = CRY_ARRAY_COUNT(groups);
+
+		// the same record layout as CStatoscope::AddFrameRecord, without screenshots and events
+		CStatoscopeFrameRecordWriter fr(&writer);
+		for (int nFrame = 0; nFrame < kFrameCount; ++nFrame)
+		{
+			counters.nFrame = instances.nFrame = nFrame;
+
+			if (writer.m_bShouldOutputLogTopHeader)
+			{
+				writer.WriteData((char)StatoscopeDataWriter::EE_LittleEndian);
+				writer.WriteData(STATOSCOPE_BINARY_VERSION_DELTA);
+				writer.WriteData(writer.IsUsingStringPool());
+				writer.m_bShouldOutputLogTopHeader = false;
+			}
+
+			// a second header in the middle restarts the delta coding
+			const bool bHeader = nFrame == 0 || nFrame == kFrameCount / 2;
+			writer.WriteData(bHeader);
+			if (bHeader)
+			{
+				writer.WriteData(false);
+				writer.WriteData(kGroupCount);
+				for (CStatoscopeDataGroup& group : groups)
+				{
+					group.WriteHeader(&writer);
+					group.GetDeltaState().clear();
+				}
+			}
+
+			writer.WriteData((float)nFrame);
+			writer.WriteData(StatoscopeDataWriter::None);
+
+			for (CStatoscopeDataGroup& group : groups)
+			{
+				writer.WriteData((int)group.GetCallback()->PrepareToWrite());
+				fr.ResetWrittenElementCount();
+				fr.BeginDataGroup(&group.GetDeltaState());
+				group.GetCallback()->Write(fr);
+				fr.EndDataGroup();
+				CRY_UNIT_TEST_CHECK_EQUAL((size_t)fr.GetWrittenElementCount(), group.GetNumElements() * group.GetCallback()->PrepareToWrite());
+			}
+
+			writer.WriteData((uint32)0);
+			writer.WriteData(0xdeadbeef);
+
+			// flush now and then, so that some blocks go out partially filled
+			if (nFrame % 64 == 63)
+				writer.Flush();
+		}
+		writer.Close();
+
+		const std::vector<char> data = writer.GetData();
+		CRY_UNIT_TEST_ASSERT(data.size() > 8);
+		uint32 nMagic;
+		memcpy(&nMagic, &data[0], sizeof(nMagic));
+		CRY_UNIT_TEST_CHECK_EQUAL(nMagic, STATOSCOPE_COMPACT_MAGIC);
+
+		// feed it in odd sized chunks, like a socket would deliver it
+		Statoscope::CLogReader reader;
+		Statoscope::SFrame frame;
+		int nFramesRead = 0;
+		for (size_t nOffset = 0; nOffset < data.size(); nOffset += 777)
+		{
+			reader.Feed(&data[nOffset], min((size_t)777, data.size() - nOffset));
+
+			Statoscope::EReadResult result;
+			while ((result = reader.ReadFrame(frame)) == Statoscope::eRR_Frame)
+			{
+				const int nFrame = nFramesRead++;
+				CRY_UNIT_TEST_CHECK_EQUAL(frame.time, (float)nFrame);
+				CRY_UNIT_TEST_CHECK_EQUAL(frame.bHeader, nFrame == 0 || nFrame == kFrameCount / 2);
+				CRY_UNIT_TEST_ASSERT(frame.groups.size() == (size_t)kGroupCount);
+
+				const Statoscope::SGroupRecord& counterRecord = frame.groups[0];
+				CRY_UNIT_TEST_CHECK_EQUAL(counterRecord.numDataSets, 1u);
+				CRY_UNIT_TEST_CHECK_EQUAL(counterRecord.values[0].f, nFrame * 0.25f);
+				CRY_UNIT_TEST_CHECK_EQUAL(counterRecord.values[1].i, nFrame);
+				CRY_UNIT_TEST_CHECK_EQUAL(counterRecord.values[2].i, 1234);
+
+				const Statoscope::SGroupRecord& instanceRecord = frame.groups[1];
+				CRY_UNIT_TEST_CHECK_EQUAL(instanceRecord.numDataSets, (uint32)(1 + nFrame % 3));
+				for (uint32 i = 0; i < instanceRecord.numDataSets; ++i)
+				{
+					CRY_UNIT_TEST_ASSERT(*instanceRecord.values[i * 3].pString == (i == 0 ? "instance0" : "instanceN"));
+					CRY_UNIT_TEST_ASSERT(*instanceRecord.values[i * 3 + 1].pString == (i == 0 ? "first" : "other"));
+					CRY_UNIT_TEST_CHECK_EQUAL(instanceRecord.values[i * 3 + 2].i, nFrame * 10 + (int)i);
+				}
+			}
+			CRY_UNIT_TEST_ASSERT(result == Statoscope::eRR_NeedMoreData);
+		}
+
+		CRY_UNIT_TEST_ASSERT(reader.IsCompact());
+		CRY_UNIT_TEST_CHECK_EQUAL(reader.GetVersion(), STATOSCOPE_BINARY_VERSION_DELTA);
+		CRY_UNIT_TEST_CHECK_EQUAL(nFramesRead, kFrameCount);
+
+		const std::vector<Statoscope::SDataGroup>& readGroups = reader.GetDataGroups();
+		CRY_UNIT_TEST_ASSERT(readGroups.size() == (size_t)kGroupCount);
+		CRY_UNIT_TEST_ASSERT(readGroups[0].path == "/UnitTest/");
+		CRY_UNIT_TEST_ASSERT(readGroups[0].elements.size() == 3 && readGroups[0].elements[2].name == "constant");
+		CRY_UNIT_TEST_ASSERT(readGroups[1].elements.size() == 2 && readGroups[1].elements[0].type == Statoscope::eET_String);
+		CRY_UNIT_TEST_CHECK_EQUAL(readGroups[1].numPathNames, 1u);
+	}
+}
+
+#endif // CRY_UNIT_TESTING && ENABLE_STATOSCOPE
@@ -0,0 +1,8 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "StdAfx.h"
+
+// The reader belongs to the tools, CrySystem only builds it for the round trip test in Test_Statoscope.cpp
+#if defined(CRY_UNIT_TESTING) && ENABLE_STATOSCOPE
+	#include "../../Tools/CryCommonTools/Statoscope/StatoscopeReader.cpp"
+#endif
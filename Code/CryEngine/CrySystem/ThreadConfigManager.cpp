@@ -21,6 +21,7 @@ CThreadConfigManager::CThreadConfigManager()
 	m_defaultConfig.affinityFlag = -1;
 	m_defaultConfig.priority = THREAD_PRIORITY_NORMAL;
 	m_defaultConfig.bDisablePriorityBoost = false;
+	m_defaultConfig.affinityGroup = SThreadConfig::eAffinityGroup_None;
 	m_defaultConfig.paramActivityFlag = (SThreadConfig::TThreadParamFlag)~0;
 }
 
@@ -337,6 +338,41 @@ void CThreadConfigManager::LoadAffinity(const XmlNodeRef& rXmlThreadRef, uint32&
 	rAffinity = affinity;
 }
 
+//////////////////////////////////////////////////////////////////////////
+void CThreadConfigManager::LoadAffinityGroup(const XmlNodeRef& rXmlThreadRef, uint8& rAffinityGroup, SThreadConfig::TThreadParamFlag& rParamActivityFlag)
+{
+	// Validate node
+	if (!rXmlThreadRef->haveAttr("AffinityGroup"))
+		return;
+
+	CryFixedStringT<32> affinityGroupStr(rXmlThreadRef->getAttr("AffinityGroup"));
+	affinityGroupStr.Trim();
+
+	if (affinityGroupStr.compareNoCase("ignore") == 0)
+	{
+		// Param is inactive, clear bit
+		rParamActivityFlag &= ~SThreadConfig::eThreadParamFlag_AffinityGroup;
+		return;
+	}
+
+	if (affinityGroupStr.compareNoCase("none") == 0)
+	{
+		rAffinityGroup = SThreadConfig::eAffinityGroup_None;
+	}
+	else if (affinityGroupStr.compareNoCase("L3") == 0 || affinityGroupStr.compareNoCase("cache_cluster") == 0)
+	{
+		rAffinityGroup = SThreadConfig::eAffinityGroup_CacheCluster;
+	}
+	else if (affinityGroupStr.compareNoCase("NUMA") == 0 || affinityGroupStr.compareNoCase("numa_node") == 0)
+	{
+		rAffinityGroup = SThreadConfig::eAffinityGroup_NumaNode;
+	}
+	else
+	{
+		CryWarning(VALIDATOR_MODULE_SYSTEM, VALIDATOR_WARNING, "<ThreadConfigInfo>: [XML Parsing] Unknown value \"%s\" encountered for attribute \"AffinityGroup\". Valid values: \"none\", \"L3\", \"NUMA\"", affinityGroupStr.c_str());
+	}
+}
+
 //////////////////////////////////////////////////////////////////////////
 void CThreadConfigManager::LoadPriority(const XmlNodeRef& rXmlThreadRef, int32& rPriority, SThreadConfig::TThreadParamFlag& rParamActivityFlag)
 {
@@ -510,6 +546,7 @@ void CThreadConfigManager::LoadStackSize(const XmlNodeRef& rXmlThreadRef, uint32
 void CThreadConfigManager::LoadThreadConfig(const XmlNodeRef& rXmlThreadRef, SThreadConfig& rThreadConfig)
 {
 	LoadAffinity(rXmlThreadRef, rThreadConfig.affinityFlag, rThreadConfig.paramActivityFlag);
+	LoadAffinityGroup(rXmlThreadRef, rThreadConfig.affinityGroup, rThreadConfig.paramActivityFlag);
 	LoadPriority(rXmlThreadRef, rThreadConfig.priority, rThreadConfig.paramActivityFlag);
 	LoadDisablePriorityBoost(rXmlThreadRef, rThreadConfig.bDisablePriorityBoost, rThreadConfig.paramActivityFlag);
 	LoadStackSize(rXmlThreadRef, rThreadConfig.stackSizeBytes, rThreadConfig.paramActivityFlag);
@@ -561,6 +598,11 @@ void CThreadConfigManager::DumpThreadConfigurationsToLog()
 		             threadConfig.affinityFlag, (threadConfig.paramActivityFlag & SThreadConfig::eThreadParamFlag_Affinity) ? "" : "(ignored)",
 		             threadConfig.priority, (threadConfig.paramActivityFlag & SThreadConfig::eThreadParamFlag_Priority) ? "" : "(ignored)",
 		             !threadConfig.bDisablePriorityBoost ? "enabled" : "disabled", (threadConfig.paramActivityFlag & SThreadConfig::eThreadParamFlag_PriorityBoost) ? "" : "(ignored)");
+		if (threadConfig.affinityGroup != SThreadConfig::eAffinityGroup_None)
+		{
+			CryLogAlways("     AffinityGroup:\"%s\" %s", threadConfig.affinityGroup == SThreadConfig::eAffinityGroup_CacheCluster ? "L3" : "NUMA",
+			             (threadConfig.paramActivityFlag & SThreadConfig::eThreadParamFlag_AffinityGroup) ? "" : "(ignored)");
+		}
 	}
 #endif
 }
@@ -65,6 +65,11 @@
    "time_critical"		: Hint to CryEngine to run thread with pre-set priority
    "x" (number)			: User defined thread priority number
 
+   AffinityGroup: (only evaluated by thread pools which know their thread index, e.g. "JobSystem_Worker_*")
+   "none"         : Use the Affinity attribute - (default) -
+   "L3"           : Distribute the pool over the groups of logical cores sharing a L3 cache, each thread runs on all cores of its group
+   "NUMA"         : Distribute the pool over the NUMA nodes, each thread runs on all cores of its node
+
    StackSizeKB:
    "0"  : Let platform decide on the stack size - (default) -
    "x"  : Create thread with "x" KB of stack size
@@ -115,6 +120,7 @@ private:
 	void                 LoadThreadConfig(const XmlNodeRef& rXmlThreadRef, SThreadConfig& rThreadConfig);
 
 	void                 LoadAffinity(const XmlNodeRef& rXmlThreadRef, uint32& rAffinity, SThreadConfig::TThreadParamFlag& rParamActivityFlag);
+	void                 LoadAffinityGroup(const XmlNodeRef& rXmlThreadRef, uint8& rAffinityGroup, SThreadConfig::TThreadParamFlag& rParamActivityFlag);
 	void                 LoadPriority(const XmlNodeRef& rXmlThreadRef, int32& rPriority, SThreadConfig::TThreadParamFlag& rParamActivityFlag);
 	void                 LoadDisablePriorityBoost(const XmlNodeRef& rXmlThreadRef, bool& rPriorityBoost, SThreadConfig::TThreadParamFlag& rParamActivityFlag);
 	void                 LoadStackSize(const XmlNodeRef& rXmlThreadRef, uint32& rStackSize, SThreadConfig::TThreadParamFlag& rParamActivityFlag);
@@ -16,6 +16,10 @@
 #include <CrySystem/ISystem.h>
 #include <CrySystem/ITimer.h>
 #include <CrySystem/IConsole.h>
+#include <CrySystem/File/ICryPak.h>
+#include <CrySerialization/IArchiveHost.h>
+#include <CrySerialization/STL.h>
+#include <CryCore/Containers/VectorMap.h>
 #include "UnitTestExcelReporter.h"
 
 using namespace CryUnitTest;
@@ -335,6 +339,174 @@ void CryUnitTest::CUnitTestManager::OnFatalError(const char* szMessage)
 
 //////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+const int    kBenchmarkSampleCount = 31;
+const float  kBenchmarkMinSampleTimeMs = 2.0f;     // batches are grown until a sample takes at least this long
+const int    kBenchmarkMaxBatchSize = 1 << 24;
+const double kBenchmarkRegressionThreshold = 0.1;  // median slower than the baseline by this fraction counts as regression
+
+struct SBenchmarkResult
+{
+	string name;
+	int    iterationsPerSample = 0;
+	int    sampleCount = 0;
+	double minNs = 0.0;
+	double medianNs = 0.0;
+	double p95Ns = 0.0;
+	double meanNs = 0.0;
+	double rsdPercent = 0.0;
+
+	void Serialize(Serialization::IArchive& ar)
+	{
+		ar(name, "name");
+		ar(iterationsPerSample, "iterationsPerSample");
+		ar(sampleCount, "sampleCount");
+		ar(minNs, "minNs");
+		ar(medianNs, "medianNs");
+		ar(p95Ns, "p95Ns");
+		ar(meanNs, "meanNs");
+		ar(rsdPercent, "rsdPercent");
+	}
+};
+
+struct SBenchmarkReport
+{
+	std::vector<SBenchmarkResult> benchmarks;
+
+	void Serialize(Serialization::IArchive& ar)
+	{
+		ar(benchmarks, "benchmarks");
+	}
+
+	const SBenchmarkResult* Find(const string& name) const
+	{
+		for (const SBenchmarkResult& result : benchmarks)
+		{
+			if (result.name == name)
+				return &result;
+		}
+		return nullptr;
+	}
+};
+
+float TimeBenchmarkBatch(SBenchmark& benchmark, int iterations)
+{
+	const int64 startTicks = CryGetTicks();
+	for (int i = 0; i < iterations; ++i)
+	{
+		benchmark.Run();
+	}
+	return gEnv->pTimer->TicksToSeconds(CryGetTicks() - startTicks) * 1000.0f;
+}
+
+void MeasureBenchmark(SBenchmark& benchmark, SBenchmarkResult& result)
+{
+	// Warm up, doubling the batch until a sample is well above the timer resolution
+	int batchSize = 1;
+	while (TimeBenchmarkBatch(benchmark, batchSize) < kBenchmarkMinSampleTimeMs && batchSize < kBenchmarkMaxBatchSize)
+	{
+		batchSize *= 2;
+	}
+
+	double samples[kBenchmarkSampleCount];
+	for (double& sample : samples)
+	{
+		sample = TimeBenchmarkBatch(benchmark, batchSize) * 1.0e6 / batchSize;
+	}
+	std::sort(samples, samples + kBenchmarkSampleCount);
+
+	double sum = 0.0;
+	for (double sample : samples)
+	{
+		sum += sample;
+	}
+	const double mean = sum / kBenchmarkSampleCount;
+
+	double variance = 0.0;
+	for (double sample : samples)
+	{
+		variance += (sample - mean) * (sample - mean);
+	}
+	variance /= kBenchmarkSampleCount;
+
+	result.iterationsPerSample = batchSize;
+	result.sampleCount = kBenchmarkSampleCount;
+	result.minNs = samples[0];
+	result.medianNs = samples[kBenchmarkSampleCount / 2];
+	result.p95Ns = samples[(kBenchmarkSampleCount * 95 + 99) / 100 - 1];
+	result.meanNs = mean;
+	result.rsdPercent = mean > 0.0 ? 100.0 * sqrt(variance) / mean : 0.0;
+}
+}
+
+void CUnitTestManager::RegisterBenchmark(SBenchmark& benchmark)
+{
+	stl::push_back_unique(m_benchmarks, &benchmark);
+}
+
+int CUnitTestManager::RunAllBenchmarks(const char* szFilter, const char* szOutputFile, const char* szBaselineFile)
+{
+	CryLogAlways("Running benchmarks...");
+
+	SBenchmarkReport baseline;
+	const bool bHasBaseline = szBaselineFile && szBaselineFile[0] && gEnv->pSystem->GetArchiveHost()->LoadJsonFile(Serialization::SStruct(baseline), szBaselineFile, true);
+	if (szBaselineFile && szBaselineFile[0] && !bHasBaseline)
+	{
+		CryLogAlways("Failed to load benchmark baseline '%s'", szBaselineFile);
+	}
+
+	SBenchmarkReport report;
+	int regressionCount = 0;
+
+	for (SBenchmark* pBenchmark : m_benchmarks)
+	{
+		const SBenchmarkInfo& info = pBenchmark->m_benchmarkInfo;
+
+		SBenchmarkResult result;
+		result.name.Format("%s:%s:%s", info.module.c_str(), info.suite.c_str(), info.name.c_str());
+		if (szFilter && szFilter[0] && !strstr(result.name.c_str(), szFilter))
+		{
+			continue;
+		}
+
+		pBenchmark->Init();
+		MeasureBenchmark(*pBenchmark, result);
+		pBenchmark->Done();
+
+		CryLogAlways("Benchmark %s: median %.1fns p95 %.1fns rsd %.1f%% (%d x %d iterations)",
+		             result.name.c_str(), result.medianNs, result.p95Ns, result.rsdPercent, result.sampleCount, result.iterationsPerSample);
+
+		if (const SBenchmarkResult* pBaselineResult = bHasBaseline ? baseline.Find(result.name) : nullptr)
+		{
+			// Don't flag differences that are within the noise of the baseline run
+			const double threshold = max(kBenchmarkRegressionThreshold, 2.0 * pBaselineResult->rsdPercent / 100.0);
+			const double ratio = pBaselineResult->medianNs > 0.0 ? result.medianNs / pBaselineResult->medianNs : 1.0;
+			if (ratio > 1.0 + threshold)
+			{
+				++regressionCount;
+				CryLogAlways("-- REGRESSION: %s is %.1f%% slower than baseline (%.1fns -> %.1fns)",
+				             result.name.c_str(), (ratio - 1.0) * 100.0, pBaselineResult->medianNs, result.medianNs);
+			}
+		}
+
+		report.benchmarks.push_back(result);
+	}
+
+	if (szOutputFile && szOutputFile[0])
+	{
+		if (!Serialization::SaveJsonFile(szOutputFile, report))
+		{
+			CryLogAlways("Failed to write benchmark results to '%s'", szOutputFile);
+		}
+	}
+
+	CryLogAlways("Running benchmarks done. %d benchmarks, %d regressions.", (int)report.benchmarks.size(), regressionCount);
+	return regressionCount;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 void CryUnitTest::CLogUnitTestReporter::OnStartTesting(const SUnitTestRunContext& context)
 {
 	m_log.Log("UnitTesting Started");
@@ -1955,4 +2127,170 @@ CRY_UNIT_TEST(CUT_CRYGUID)
 	CRY_UNIT_TEST_CHECK_EQUAL(CryStringUtils::toUpper(guid.ToString()), "296708CE-F570-4263-B067-C6D8B15990BD");
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Core benchmarks, run with the RunBenchmarks console command
+
+CRY_UNIT_TEST_SUITE(CoreBenchmarks)
+{
+	struct SMathBenchmark : public CryUnitTest::SBenchmark
+	{
+		enum { kCount = 1024 };
+
+		virtual void Init() override
+		{
+			CRndGen rand(1234);
+			for (int i = 0; i < kCount; ++i)
+			{
+				m_points[i] = Vec3(rand.GetRandom(-100.0f, 100.0f), rand.GetRandom(-100.0f, 100.0f), rand.GetRandom(-100.0f, 100.0f));
+				m_rotations[i] = Quat::CreateRotationXYZ(Ang3(rand.GetRandom(-gf_PI, gf_PI), rand.GetRandom(-gf_PI, gf_PI), rand.GetRandom(-gf_PI, gf_PI)));
+				m_values[i] = rand.GetRandom(-1.0f, 1.0f);
+			}
+			m_transform = Matrix34::Create(Vec3(1.0f, 2.0f, 0.5f), m_rotations[0], Vec3(10.0f, -5.0f, 3.0f));
+		}
+
+		Matrix34 m_transform;
+		Vec3     m_points[kCount];
+		Quat     m_rotations[kCount];
+		float    m_values[kCount];
+	};
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_Matrix34TransformPoint, SMathBenchmark)
+	{
+		Vec3 sum(ZERO);
+		for (int i = 0; i < kCount; ++i)
+		{
+			sum += m_transform.TransformPoint(m_points[i]);
+		}
+		CRY_UNIT_BENCHMARK_KEEP(sum);
+	}
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_QuatSlerp, SMathBenchmark)
+	{
+		Quat result(IDENTITY);
+		for (int i = 1; i < kCount; ++i)
+		{
+			result = result * Quat::CreateSlerp(m_rotations[i - 1], m_rotations[i], 0.3f);
+		}
+		CRY_UNIT_BENCHMARK_KEEP(result);
+	}
+
+	#if CRY_PLATFORM_SSE2
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_SimdMultiplyAdd, SMathBenchmark)
+	{
+		f32v4 sum = convert<f32v4>();
+		for (int i = 0; i < kCount; i += 4)
+		{
+			const f32v4 a = convert<f32v4>(&m_values[i]);
+			sum = sum + a * a;
+		}
+		CRY_UNIT_BENCHMARK_KEEP(sum);
+	}
+	#endif
+
+	CRY_UNIT_BENCHMARK(BM_HeapAllocator)
+	{
+		typedef stl::HeapAllocator<stl::PSyncNone> THeap;
+		THeap heap;
+		const int kAllocationCount = 64;
+		void* allocations[kAllocationCount];
+		for (int i = 0; i < kAllocationCount; ++i)
+		{
+			allocations[i] = heap.Allocate(THeap::Lock(heap), 16 + (i % 8) * 24);
+		}
+		for (int i = 0; i < kAllocationCount; ++i)
+		{
+			heap.Deallocate(THeap::Lock(heap), allocations[i], 16 + (i % 8) * 24);
+		}
+	}
+
+	CRY_UNIT_BENCHMARK(BM_ModuleMalloc)
+	{
+		const int kAllocationCount = 64;
+		void* allocations[kAllocationCount];
+		for (int i = 0; i < kAllocationCount; ++i)
+		{
+			allocations[i] = CryModuleMalloc(16 + (i % 16) * 64);
+		}
+		for (int i = 0; i < kAllocationCount; ++i)
+		{
+			CryModuleFree(allocations[i]);
+		}
+	}
+
+	CRY_UNIT_BENCHMARK(BM_DynArrayPushBack)
+	{
+		DynArray<int> values;
+		for (int i = 0; i < 1024; ++i)
+		{
+			values.push_back(i);
+		}
+		CRY_UNIT_BENCHMARK_KEEP(values.back());
+	}
+
+	struct SVectorMapBenchmark : public CryUnitTest::SBenchmark
+	{
+		virtual void Init() override
+		{
+			for (uint32 i = 0; i < 1024; ++i)
+			{
+				m_map.insert(std::make_pair(i * 7919u, i));
+			}
+		}
+		virtual void Done() override { m_map.clear(); }
+
+		VectorMap<uint32, uint32> m_map;
+	};
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_VectorMapFind, SVectorMapBenchmark)
+	{
+		uint32 sum = 0;
+		for (uint32 i = 0; i < 1024; ++i)
+		{
+			auto it = m_map.find(i * 7919u);
+			sum += (it != m_map.end()) ? it->second : 0;
+		}
+		CRY_UNIT_BENCHMARK_KEEP(sum);
+	}
+
+	CRY_UNIT_BENCHMARK(BM_JobSystemLambdaJobs)
+	{
+		static volatile int s_counter;
+		JobManager::SJobState jobState;
+		for (int i = 0; i < 64; ++i)
+		{
+			gEnv->GetJobManager()->AddLambdaJob("BM_JobSystemLambdaJobs", [] { CryInterlockedIncrement(&s_counter); }, JobManager::eRegularPriority, &jobState);
+		}
+		gEnv->GetJobManager()->WaitForJob(jobState);
+	}
+
+	CRY_UNIT_BENCHMARK(BM_CryPakIsFileExist)
+	{
+		// Misses walk the same path normalization and pak directory search as hits
+		const bool bExists = gEnv->pCryPak->IsFileExist("Libs/UI/UIAction/BenchmarkDoesNotExist.xml");
+		CRY_UNIT_BENCHMARK_KEEP(bExists);
+	}
+
+	struct SXmlParseBenchmark : public CryUnitTest::SBenchmark
+	{
+		virtual void Init() override
+		{
+			m_xml = "<Root>";
+			for (int i = 0; i < 256; ++i)
+			{
+				m_xml.AppendFormat("<Entity Name=\"Entity%d\" Pos=\"%d,%d,0\" Layer=\"Main\"><Properties Health=\"100\" Armor=\"%d\"/></Entity>", i, i, i * 2, i % 50);
+			}
+			m_xml += "</Root>";
+		}
+		virtual void Done() override { m_xml.clear(); }
+
+		string m_xml;
+	};
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_XmlParse, SXmlParseBenchmark)
+	{
+		XmlNodeRef root = gEnv->pSystem->LoadXmlFromBuffer(m_xml.c_str(), m_xml.length());
+		CRY_UNIT_BENCHMARK_KEEP(root);
+	}
+}
+
 #endif //CRY_UNIT_TESTING
@@ -82,6 +82,9 @@ public:
 	virtual void       Update() override;                                                      //!< Currently not in use
 
 	virtual void       SetExceptionCause(const char* szExpression, const char* szFile, int line) override;
+
+	virtual void       RegisterBenchmark(SBenchmark& benchmark) override;
+	virtual int        RunAllBenchmarks(const char* szFilter, const char* szOutputFile, const char* szBaselineFile) override;
 private:
 	void               StartTesting(SUnitTestRunContext& context, EReporterType reporterToUse);
 	void               EndTesting(SUnitTestRunContext& context);
@@ -95,6 +98,7 @@ private:
 private:
 	ILog&                                   m_log;
 	std::vector<std::unique_ptr<CUnitTest>> m_tests;
+	std::vector<SBenchmark*>                m_benchmarks;
 	string                                  m_failureMsg;
 	std::unique_ptr<SAutoTestsContext>      m_pAutoTestsContext;
 	bool m_bRunningTest = false;
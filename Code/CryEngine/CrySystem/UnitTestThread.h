@@ -0,0 +1,32 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+//! Worker thread for multi-threaded unit tests
+
+#pragma once
+
+#include <CryThreading/IThreadManager.h>
+#include <functional>
+
+//! Runs a function on its own thread, joined in the destructor.
+//! The thread is named "UnitTest_<szSuite>_<nIndex>".
+class CUnitTestThread : public IThread
+{
+public:
+	CUnitTestThread(const char* szSuite, const std::function<void()>& function, int nIndex)
+		: m_function(function)
+	{
+		m_bStarted = gEnv->pThreadManager->SpawnThread(this, "UnitTest_%s_%d", szSuite, nIndex);
+	}
+	~CUnitTestThread()
+	{
+		if (m_bStarted)
+			gEnv->pThreadManager->JoinThread(this, eJM_Join);
+	}
+	virtual void ThreadEntry() override { m_function(); }
+
+	bool IsStarted() const { return m_bStarted; }
+
+private:
+	std::function<void()> m_function;
+	bool                  m_bStarted;
+};
@@ -296,6 +296,7 @@ CXConsole::CXConsole()
 	m_waitFrames = 0;
 	m_waitSeconds = 0.0f;
 	m_blockCounter = 0;
+	m_nUnregisterCount = 0;
 
 	m_currentLoadConfigType = eLoadConfigInit;
 	m_readOnly = false;
@@ -615,7 +616,8 @@ void CXConsole::RegisterVar(ICVar* pCVar, ConsoleVarFunc pChangeFunc)
 
 	ConsoleVariablesMapItor::value_type value = ConsoleVariablesMapItor::value_type(pCVar->GetName(), pCVar);
 
-	m_mapVariables.insert(value);
+	if (m_mapVariables.insert(value).second)
+		m_variableIndex.Insert(pCVar);
 
 	int flags = pCVar->GetFlags();
 
@@ -1059,6 +1061,8 @@ void CXConsole::UnregisterVariable(const char* sVarName, bool bDelete)
 		RemoveCheckedCVar(m_randomCheckedVariables, *itor);
 	}
 	m_mapVariables.erase(itor);
+	m_variableIndex.Remove(pCVar);
+	CryInterlockedIncrement(&m_nUnregisterCount);
 
 	for (auto& it : m_consoleVarSinks)
 	{
@@ -1184,12 +1188,9 @@ ICVar* CXConsole::GetCVar(const char* sName)
 		m_pSystem->debug_LogCallStack();
 	}
 
-	// Fast map lookup for case-sensitive match.
-	ConsoleVariablesMapItor it;
-
-	it = m_mapVariables.find(sName);
-	if (it != m_mapVariables.end())
-		return it->second;
+	// Hashed lookup, doesn't lock and doesn't touch m_mapVariables, which the main thread may be modifying.
+	if (ICVar* pCVar = m_variableIndex.Find(sName))
+		return pCVar;
 
 	/*
 	   if(!bCaseSensitive)
@@ -3691,6 +3692,7 @@ void CXConsole::GetMemoryUsage(class ICrySizer* pSizer) const
 	pSizer->AddObject(m_dqHistory);
 	pSizer->AddObject(m_mapCommands);
 	pSizer->AddObject(m_mapBinds);
+	m_variableIndex.GetMemoryUsage(pSizer);
 }
 
 //////////////////////////////////////////////////////////////////////////
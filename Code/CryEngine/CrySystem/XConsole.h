@@ -12,6 +12,7 @@
 #include <CryCore/CryCrc32.h>
 #include <CryCore/Containers/CryListenerSet.h>
 #include "Timer.h"
+#include "ConsoleVariableIndex.h"
 
 //forward declaration
 struct IIpnut;
@@ -152,6 +153,7 @@ public:
 	virtual bool                   GetLineNo(const int indwLineNo, char* outszBuffer, const int indwBufferSize) const;
 	virtual int                    GetLineCount() const;
 	virtual ICVar*                 GetCVar(const char* name);
+	virtual uint32                 GetUnregisterCount() const { return (uint32)m_nUnregisterCount; }
 	virtual char*                  GetVariable(const char* szVarName, const char* szFileName, const char* def_val);
 	virtual float                  GetVariable(const char* szVarName, const char* szFileName, float def_val);
 	virtual void                   PrintLine(const char* s);
@@ -350,6 +352,8 @@ private: // ----------------------------------------------------------
 	ConsoleCommandsMap             m_mapCommands;             //
 	ConsoleBindsMap                m_mapBinds;                //
 	ConsoleVariablesMap            m_mapVariables;            //
+	CConsoleVariableIndex          m_variableIndex;           // name hash index of m_mapVariables for GetCVar()
+	volatile int                   m_nUnregisterCount;
 	ConsoleVariablesVector         m_randomCheckedVariables;
 	ConsoleVariablesVector         m_alwaysCheckedVariables;
 	std::vector<IOutputPrintSink*> m_OutputSinks;             // objects in this vector are not released
@@ -44,7 +44,8 @@ CBinaryXmlData::~CBinaryXmlData()
 
 void CBinaryXmlData::GetMemoryUsage(ICrySizer* pSizer) const
 {
-	pSizer->AddObject(pFileContents, nFileSize);
+	if (bOwnsFileContentsMemory)
+		pSizer->AddObject(pFileContents, nFileSize);
 	const XMLBinary::BinaryFileHeader* pHeader = reinterpret_cast<const XMLBinary::BinaryFileHeader*>(pFileContents);
 	pSizer->AddObject(pBinaryNodes, sizeof(CBinaryXmlNode) * pHeader->nNodeCount);
 }
@@ -34,6 +34,8 @@ public:
 	const char*                 pFileContents;
 	size_t                      nFileSize;
 	bool                        bOwnsFileContentsMemory;
+	// keeps pFileContents alive if it is a view into memory owned by someone else (e.g. a memory mapped file)
+	_smart_ptr<_i_reference_target_t> pFileContentsOwner;
 
 	CBinaryXmlNode*             pBinaryNodes;
 
@@ -152,6 +152,45 @@ XmlNodeRef XMLBinary::XMLBinaryReader::LoadFromBuffer(
 	return &pData->pBinaryNodes[0];
 }
 
+XmlNodeRef XMLBinary::XMLBinaryReader::LoadFromView(
+  _i_reference_target_t* pOwner,
+  const char* buffer,
+  size_t size,
+  XMLBinary::XMLBinaryReader::EResult& result)
+{
+	m_errorDescription[0] = 0;
+	result = eResult_Error;
+
+	if (((UINT_PTR)buffer & (sizeof(uint32) - 1)) != 0)
+	{
+		result = eResult_NotBinXml;
+		SetErrorDescription("Binary XML data is not aligned.");
+		return 0;
+	}
+
+	Check(buffer, size, result);
+
+	if (result != eResult_Success)
+	{
+		return 0;
+	}
+
+	CBinaryXmlData* const pData = Create(buffer, size, result);
+
+	if (result != eResult_Success)
+	{
+		assert(pData == 0);
+		return 0;
+	}
+
+	assert(pData);
+	pData->bOwnsFileContentsMemory = false;
+	pData->pFileContentsOwner = pOwner;
+
+	// Return first node
+	return &pData->pBinaryNodes[0];
+}
+
 void XMLBinary::XMLBinaryReader::Check(const char* buffer, size_t size, EResult& result)
 {
 	m_errorDescription[0] = 0;
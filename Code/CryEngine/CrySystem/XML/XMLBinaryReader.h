@@ -41,6 +41,11 @@ public:
 	// Otherwise, the caller is responsible for releasing buffer's memory.
 	XmlNodeRef  LoadFromBuffer(EBufferMemoryHandling bufferMemoryHandling, const char* buffer, size_t size, EResult& result);
 
+	// Builds the document in place on top of buffer, without copying it. The nodes point into buffer,
+	// pOwner is referenced by the document and has to keep buffer alive until the document is released.
+	// Returns eResult_NotBinXml if buffer isn't binary XML or isn't aligned for reading the node tables in place.
+	XmlNodeRef  LoadFromView(_i_reference_target_t* pOwner, const char* buffer, size_t size, EResult& result);
+
 	const char* GetErrorDescription() const;
 
 private:
@@ -32,6 +32,7 @@ SXmlNodeStats* g_pCXmlNode_Stats = 0;
 #endif
 
 extern bool g_bEnableBinaryXmlLoading;
+extern int g_nXmlZeroCopyLoading;
 
 //////////////////////////////////////////////////////////////////////////
 CXmlUtils::CXmlUtils(ISystem* pSystem)
@@ -672,3 +673,140 @@ void CXmlUtils::SetXMLPatcher(XmlNodeRef* pPatcher)
 		m_pXMLPatcher = new CXMLPatcher(*pPatcher);
 	}
 }
+
+//////////////////////////////////////////////////////////////////////////
+namespace
+{
+void FindXmlFiles(const string& folder, const char* szWildcard, std::vector<string>& files)
+{
+	ICryPak* const pPak = gEnv->pCryPak;
+	_finddata_t fd;
+
+	intptr_t handle = pPak->FindFirst((folder + "/" + szWildcard).c_str(), &fd);
+	if (handle != -1)
+	{
+		do
+		{
+			if (!(fd.attrib & _A_SUBDIR))
+				files.push_back(folder + "/" + fd.name);
+		}
+		while (pPak->FindNext(handle, &fd) >= 0);
+		pPak->FindClose(handle);
+	}
+
+	handle = pPak->FindFirst((folder + "/*.*").c_str(), &fd);
+	if (handle != -1)
+	{
+		do
+		{
+			if ((fd.attrib & _A_SUBDIR) && strcmp(fd.name, ".") && strcmp(fd.name, ".."))
+				FindXmlFiles(folder + "/" + fd.name, szWildcard, files);
+		}
+		while (pPak->FindNext(handle, &fd) >= 0);
+		pPak->FindClose(handle);
+	}
+}
+
+// binary nodes can't write themselves back to text
+XmlNodeRef CopyToXmlNode(const XmlNodeRef& src, uint32& nNodes)
+{
+	++nNodes;
+	XmlNodeRef dst = GetISystem()->CreateXmlNode(src->getTag());
+	dst->setContent(src->getContent());
+	for (int i = 0, n = src->getNumAttributes(); i < n; ++i)
+	{
+		const char* szKey;
+		const char* szValue;
+		if (src->getAttributeByIndex(i, &szKey, &szValue))
+			dst->setAttr(szKey, szValue);
+	}
+	for (int i = 0, n = src->getChildCount(); i < n; ++i)
+		dst->addChild(CopyToXmlNode(src->getChild(i), nNodes));
+	return dst;
+}
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CXmlUtils::Benchmark(const char* szFolder, const char* szWildcard, int nIterations)
+{
+	std::vector<string> files;
+	FindXmlFiles(PathUtil::RemoveSlash(szFolder), szWildcard, files);
+
+	// the text version of every document, to parse the same data into CXmlNode trees
+	std::vector<string> binaryFiles;
+	std::vector<std::pair<IXmlStringData*, bool>> texts;
+	size_t nTextBytes = 0;
+	uint32 nNodes = 0;
+	for (const string& file : files)
+	{
+		CCryFile xmlFile;
+		XMLBinary::BinaryFileHeader header;
+		const bool bBinary = xmlFile.Open(file.c_str(), "rb") &&
+		                     xmlFile.ReadRaw(&header, sizeof(header)) == sizeof(header) &&
+		                     memcmp(header.szSignature, "CryXmlB", sizeof(header.szSignature)) == 0;
+		xmlFile.Close();
+
+		XmlParser parser(false);
+		XmlNodeRef root = parser.ParseFile(file.c_str(), true);
+		if (!root)
+			continue;
+
+		if (bBinary)
+			binaryFiles.push_back(file);
+
+		uint32 nDocNodes = 0;
+		IXmlStringData* const pText = CopyToXmlNode(root, nDocNodes)->getXMLData();
+		pText->AddRef();
+		texts.push_back(std::make_pair(pText, bBinary));
+		nTextBytes += pText->GetStringLength();
+		nNodes += nDocNodes;
+	}
+
+	if (texts.empty())
+	{
+		CryLogAlways("No XML files matching %s found in %s", szWildcard, szFolder);
+		return;
+	}
+
+	const int nPrevZeroCopy = g_nXmlZeroCopyLoading;
+	int64 nBinaryTicks[2] = { 0, 0 };
+	for (int nZeroCopy = 0; nZeroCopy < 2; ++nZeroCopy)
+	{
+		g_nXmlZeroCopyLoading = nZeroCopy;
+		const int64 nStartTicks = CryGetTicks();
+		for (int i = 0; i < nIterations; ++i)
+		{
+			for (const string& file : binaryFiles)
+			{
+				XmlParser parser(false);
+				parser.ParseFile(file.c_str(), true);
+			}
+		}
+		nBinaryTicks[nZeroCopy] = CryGetTicks() - nStartTicks;
+	}
+	g_nXmlZeroCopyLoading = nPrevZeroCopy;
+
+	// [0] documents stored as text, [1] the text version of the binary ones
+	int64 nTextTicks[2] = { 0, 0 };
+	for (int i = 0; i < nIterations; ++i)
+	{
+		for (const std::pair<IXmlStringData*, bool>& text : texts)
+		{
+			const int64 nStartTicks = CryGetTicks();
+			XmlParser parser(false);
+			parser.ParseBuffer(text.first->GetString(), (int)text.first->GetStringLength(), true);
+			nTextTicks[text.second] += CryGetTicks() - nStartTicks;
+		}
+	}
+
+	for (const std::pair<IXmlStringData*, bool>& text : texts)
+		text.first->Release();
+
+	const float fIterations = (float)nIterations;
+	CryLogAlways("XML benchmark: %" PRISIZE_T " documents (%" PRISIZE_T " binary), %u nodes, %" PRISIZE_T " KB as text, %d iterations",
+	             texts.size(), binaryFiles.size(), nNodes, nTextBytes / 1024, nIterations);
+	CryLogAlways("  binary documents, views from file:                 %8.2f ms per iteration", gEnv->pTimer->TicksToSeconds(nBinaryTicks[1]) * 1000.f / fIterations);
+	CryLogAlways("  binary documents, copies from file:                %8.2f ms per iteration", gEnv->pTimer->TicksToSeconds(nBinaryTicks[0]) * 1000.f / fIterations);
+	CryLogAlways("  binary documents as text, from memory to CXmlNode: %8.2f ms per iteration", gEnv->pTimer->TicksToSeconds(nTextTicks[1]) * 1000.f / fIterations);
+	CryLogAlways("  text documents, from memory to CXmlNode:           %8.2f ms per iteration", gEnv->pTimer->TicksToSeconds(nTextTicks[0]) * 1000.f / fIterations);
+}
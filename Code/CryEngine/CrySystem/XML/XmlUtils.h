@@ -89,6 +89,10 @@ public:
 	// EXCEPT for xml files loaded from a buffer, for which names aren't passed in
 	virtual void SetXMLPatcher(XmlNodeRef* pPatcher);
 
+	// Loads all files matching szWildcard under szFolder nIterations times as binary XML views (sys_xml_zero_copy 1),
+	// as copied binary XML (sys_xml_zero_copy 0) and as text XML parsed into CXmlNode trees, and logs the timings
+	void Benchmark(const char* szFolder, const char* szWildcard, int nIterations);
+
 private:
 	ISystem*           m_pSystem;
 	IReadWriteXMLSink* m_pReadWriteXMLSink;
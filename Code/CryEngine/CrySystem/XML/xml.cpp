@@ -24,6 +24,8 @@
 #include <stdio.h>
 #include <CrySystem/File/ICryPak.h>
 #include "XMLBinaryReader.h"
+#include "XMLBinaryNode.h"
+#include "../CryPak.h"
 
 #define FLOAT_FMT  "%.8g"
 #define DOUBLE_FMT "%.17g"
@@ -51,6 +53,7 @@ static int __cdecl ascii_stricmp(const char* dst, const char* src)
 //////////////////////////////////////////////////////////////////////////
 XmlStrCmpFunc g_pXmlStrCmp = &ascii_stricmp;
 bool g_bEnableBinaryXmlLoading = true;
+int g_nXmlZeroCopyLoading = 1;
 
 //////////////////////////////////////////////////////////////////////////
 class CXmlStringData : public IXmlStringData
@@ -1619,6 +1622,69 @@ XmlNodeRef XmlParserImp::ParseBuffer(const char* buffer, size_t bufLen, XmlStrin
 	return root;
 }
 
+//////////////////////////////////////////////////////////////////////////
+namespace
+{
+// loose files smaller than this are cheaper to read than to map
+const size_t k_nMinXmlFileMappingSize = 64 * 1024;
+
+// Keeps the mapping of a loose file alive while a binary XML document is built on top of it
+class CXmlFileMappingView : public _i_reference_target_t
+{
+public:
+	explicit CXmlFileMappingView(ZipDir::CFileMapping* pMapping) : m_pMapping(pMapping) { m_pMapping->AddView((size_t)m_pMapping->GetSize()); }
+	~CXmlFileMappingView() { m_pMapping->RemoveView((size_t)m_pMapping->GetSize()); }
+
+private:
+	ZipDir::CFileMappingPtr m_pMapping;
+};
+
+// Returns the contents of an opened binary XML file without reading them into a buffer, or NULL:
+// a file stored uncompressed in a memory mapped pak is used through the pak's mapping,
+// a large enough loose file is mapped on its own. pOwner keeps the memory alive.
+const char* GetXmlFileView(CCryFile& file, size_t fileSize, _smart_ptr<_i_reference_target_t>& pOwner)
+{
+	if (fileSize < sizeof(XMLBinary::BinaryFileHeader))
+		return 0;
+
+	if (file.IsInPak())
+	{
+		CCryPak* const pCryPak = static_cast<CCryPak*>(gEnv->pCryPak);
+		if (!pCryPak->GetPakVars()->nMapStoredFiles)
+			return 0;
+
+		// compressed files have to be unpacked anyway, those are left to the regular read
+		CCachedFileDataPtr pFileData = pCryPak->GetOpenedFileDataInZip(file.GetHandle());
+		if (!pFileData || !pFileData->GetFileEntry() || pFileData->GetFileEntry()->nMethod != ZipFile::METHOD_STORE)
+			return 0;
+
+		const char* const pData = static_cast<const char*>(pFileData->GetDataView());
+		if (!pData)
+			return 0;
+
+		pOwner = pFileData.get();
+		return pData;
+	}
+
+	if (fileSize < k_nMinXmlFileMappingSize)
+		return 0;
+
+	// text XML is parsed from a buffer anyway, don't map it
+	XMLBinary::BinaryFileHeader header;
+	const bool bHeaderRead = file.ReadRaw(&header, sizeof(header)) == sizeof(header);
+	file.Seek(0, SEEK_SET);
+	if (!bHeaderRead || memcmp(header.szSignature, "CryXmlB", sizeof(header.szSignature)) != 0)
+		return 0;
+
+	ZipDir::CFileMapping* const pMapping = ZipDir::CFileMapping::Create(file.GetHandle(), (int64)fileSize);
+	if (!pMapping)
+		return 0;
+
+	pOwner = new CXmlFileMappingView(pMapping);
+	return reinterpret_cast<const char*>(pMapping->GetData());
+}
+}
+
 //////////////////////////////////////////////////////////////////////////
 XmlNodeRef XmlParserImp::ParseFile(const char* filename, XmlString& errorString, bool bCleanPools)
 {
@@ -1696,6 +1762,28 @@ XmlNodeRef XmlParserImp::ParseFile(const char* filename, XmlString& errorString,
 			return 0;
 		}
 
+		if (g_bEnableBinaryXmlLoading && g_nXmlZeroCopyLoading)
+		{
+			LOADING_TIME_PROFILE_SECTION_NAMED("XMLBinaryReader::ParseView");
+
+			XMLBinary::XMLBinaryReader reader;
+			XMLBinary::XMLBinaryReader::EResult result;
+			_smart_ptr<_i_reference_target_t> pViewOwner;
+			const char* const pView = GetXmlFileView(xmlFile, fileSize, pViewOwner);
+			root = pView ? reader.LoadFromView(pViewOwner, pView, fileSize, result) : XmlNodeRef();
+			if (root)
+			{
+				return root;
+			}
+			if (pView && result == XMLBinary::XMLBinaryReader::eResult_Error)
+			{
+				cry_sprintf(str, "%s%s (%s)", errorPrefix, reader.GetErrorDescription(), filename);
+				errorString = str;
+				CryWarning(VALIDATOR_MODULE_SYSTEM, VALIDATOR_WARNING, "%s", str);
+				return 0;
+			}
+		}
+
 		pFileContents = new char[fileSize];
 		if (!pFileContents)
 		{
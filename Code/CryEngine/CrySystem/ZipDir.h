@@ -7,6 +7,7 @@
 #include <CryCore/smartptr.h>
 #include "ZipDirTree.h"
 #include "ZipDirList.h"
+#include "ZipDirFileMapping.h"
 #include "ZipDirCache.h"
 #include "ZipDirCacheRW.h"
 #include "ZipDirCacheFactory.h"
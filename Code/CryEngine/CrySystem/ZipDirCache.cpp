@@ -6,6 +6,7 @@
 #include "ZipFileFormat.h"
 #include "ZipDirStructures.h"
 #include "ZipDirTree.h"
+#include "ZipDirFileMapping.h"
 #include "ZipDirCache.h"
 #include "ZipDirFind.h"
 #include "ZipDirCacheFactory.h"
@@ -46,6 +47,8 @@ void ZipDir::Cache::Construct(CZipFile& fNew, CMTSafeHeap* pHeap, size_t nDataSi
 
 	m_nFileSize = 0;
 	m_nPakFileOffsetOnMedia = 0;
+	m_pFileMapping = NULL;
+	m_bFileMappingFailed = false;
 }
 
 // self-destruct when ref count drops to 0
@@ -53,6 +56,8 @@ void ZipDir::Cache::Delete()
 {
 	UnloadFromMemory();
 
+	// the views handed out still reference the mapping
+	SAFE_RELEASE(m_pFileMapping);
 	m_zipFile.Close();
 
 	CMTSafeHeap* pHeap = m_pCacheData->m_pHeap;
@@ -70,6 +75,9 @@ void ZipDir::Cache::PreloadToMemory(IMemoryBlock* pMemoryBlock)
 
 	m_zipFile.LoadToMemory(pMemoryBlock);
 	m_nPakFileOffsetOnMedia = 0;
+
+	// the files opened from now on are served from the in memory copy
+	SAFE_RELEASE(m_pFileMapping);
 }
 
 void ZipDir::Cache::UnloadFromMemory()
@@ -464,6 +472,14 @@ ZipDir::ErrorEnum ZipDir::Cache::DecompressFile(FileEntry* pFileEntry, void* pCo
 		memcpy(pBuffer, pCompressed, pFileEntry->desc.lSizeCompressed);
 	}
 
+	if (pFileEntry->IsBlockCompressed())
+	{
+		// the blocks don't share any state, no need to serialize them
+		if (Z_OK != ZipRawUncompressBlocks(pFileEntry->nMethod, pUncompressed, &nSizeUncompressed, pBuffer, pFileEntry->desc.lSizeCompressed))
+			return ZD_ERROR_CORRUPTED_DATA;
+		return ZD_ERROR_SUCCESS;
+	}
+
 	AUTO_LOCK_CS(csDecmopressLock);
 	if (Z_OK != ZipRawUncompress(m_pCacheData->m_pHeap, pUncompressed, &nSizeUncompressed, pBuffer, pFileEntry->desc.lSizeCompressed))
 		return ZD_ERROR_CORRUPTED_DATA;
@@ -508,6 +524,65 @@ ZipDir::ErrorEnum ZipDir::Cache::Refresh(FileEntry* pFileEntry)
 	return ZipDir::Refresh(&m_zipFile, pFileEntry);
 }
 
+#if CRY_PLATFORM_LINUX
+//////////////////////////////////////////////////////////////////////////
+bool ZipDir::Cache::GetFileDataLocation(FileEntry* pFileEntry, int& fd, int64& nDataOffset)
+{
+	if (!pFileEntry || m_zipFile.IsInMemory() || !m_zipFile.m_file)
+		return false;
+
+	#if !defined(SUPPORT_UNENCRYPTED_PAKS)
+	// let the regular read path report it
+	if (!pFileEntry->IsEncrypted())
+		return false;
+	#endif
+
+	if (Refresh(pFileEntry) != ZD_ERROR_SUCCESS)
+		return false;
+
+	fd = fileno(m_zipFile.m_file);
+	nDataOffset = pFileEntry->nFileDataOffset;
+	return fd >= 0;
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+const void* ZipDir::Cache::GetFileView(FileEntry* pFileEntry, CFileMappingPtr& pMapping)
+{
+#if defined(SUPPORT_PAK_FILE_MAPPING) && defined(SUPPORT_UNENCRYPTED_PAKS)
+	if (!pFileEntry || pFileEntry->nMethod != METHOD_STORE || pFileEntry->desc.lSizeUncompressed == 0)
+		return NULL;
+
+	if (Refresh(pFileEntry) != ZD_ERROR_SUCCESS)
+		return NULL;
+
+	CryAutoCriticalSection lock(m_pCacheData->m_csCacheIOLock);
+	if (!m_pFileMapping)
+	{
+		// in memory zips are already resident, and a failed mapping isn't retried for every file
+		if (m_bFileMappingFailed || m_zipFile.IsInMemory() || !m_zipFile.m_file)
+			return NULL;
+
+		m_pFileMapping = CFileMapping::Create(m_zipFile.m_file, (int64)m_nFileSize);
+		if (!m_pFileMapping)
+		{
+			CryWarning(VALIDATOR_MODULE_SYSTEM, VALIDATOR_WARNING, "Failed to memory map '%s', reading its files into memory instead", GetFilePath());
+			m_bFileMappingFailed = true;
+			return NULL;
+		}
+		m_pFileMapping->AddRef();
+	}
+
+	if ((int64)pFileEntry->nFileDataOffset + pFileEntry->desc.lSizeUncompressed > m_pFileMapping->GetSize())
+		return NULL;
+
+	pMapping = m_pFileMapping;
+	return m_pFileMapping->GetData() + pFileEntry->nFileDataOffset;
+#else
+	return NULL;
+#endif
+}
+
 //////////////////////////////////////////////////////////////////////////
 uint32 ZipDir::Cache::GetFileDataOffset(FileEntry* pFileEntry)
 {
@@ -15,6 +15,8 @@
 // the pool of names, followed by pad bytes to align the whole directory
 // record on 4-byte boundray.
 
+#include "ZipDirFileMapping.h"
+
 struct FileExt;
 
 namespace ZipDir
@@ -58,6 +60,18 @@ struct Cache
 	// refreshes information about the given file entry into this file entry
 	ErrorEnum Refresh(FileEntry* pFileEntry);
 
+#if CRY_PLATFORM_LINUX
+	// returns the file descriptor of the archive and the offset of the (compressed) file data in it, to read the data
+	// directly without going through the cache lock, fails if the archive is in memory
+	bool GetFileDataLocation(FileEntry* pFileEntry, int& fd, int64& nDataOffset);
+#endif
+
+	// returns a read-only view of a stored (not compressed, not encrypted) file inside the memory mapped zip file,
+	// the mapping is created on first use and pMapping keeps it alive for as long as the view is used.
+	// Returns NULL if the file isn't stored or the zip file can't be mapped
+	const void* GetFileView(FileEntry* pFileEntry, CFileMappingPtr& pMapping);
+	CFileMapping* GetFileMapping() const { return m_pFileMapping; }
+
 	// Return FileEntity data offset inside zip file.
 	uint32      GetFileDataOffset(FileEntry* pFileEntry);
 
@@ -164,6 +178,10 @@ protected:
 
 	DirHeader* m_pRootData;
 
+	// mapping of the whole zip file for the views of stored files, see GetFileView
+	CFileMapping* m_pFileMapping;
+	bool          m_bFileMappingFailed;
+
 	// cache internal data
 	// need to assemble into one struct to have pointer on it
 	struct CacheData
@@ -662,7 +662,10 @@ ZipDir::ErrorEnum ZipDir::CacheRW::ReadFile(FileEntry* pFileEntry, void* pCompre
 		else
 		{
 			unsigned long nSizeUncompressed = pFileEntry->desc.lSizeUncompressed;
-			if (Z_OK != ZipRawUncompress(m_pHeap, pUncompressed, &nSizeUncompressed, pBuffer, pFileEntry->desc.lSizeCompressed))
+			const int nError = pFileEntry->IsBlockCompressed()
+			                   ? ZipRawUncompressBlocks(pFileEntry->nMethod, pUncompressed, &nSizeUncompressed, pBuffer, pFileEntry->desc.lSizeCompressed)
+			                   : ZipRawUncompress(m_pHeap, pUncompressed, &nSizeUncompressed, pBuffer, pFileEntry->desc.lSizeCompressed);
+			if (Z_OK != nError)
 				return ZD_ERROR_CORRUPTED_DATA;
 		}
 	}
@@ -0,0 +1,89 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "StdAfx.h"
+#include "ZipDirFileMapping.h"
+
+#if defined(SUPPORT_PAK_FILE_MAPPING)
+	#if CRY_PLATFORM_WINDOWS
+		#include <io.h>
+	#else
+		#include <sys/mman.h>
+		#include <unistd.h>
+	#endif
+#endif
+
+ZipDir::CFileMapping::CFileMapping(uint8* pData, int64 nSize)
+	: m_pData(pData)
+	, m_nSize(nSize)
+	, m_nViews(0)
+	, m_nViewBytes(0)
+{
+}
+
+ZipDir::CFileMapping::~CFileMapping()
+{
+	assert(m_nViews == 0);
+#if defined(SUPPORT_PAK_FILE_MAPPING)
+	#if CRY_PLATFORM_WINDOWS
+	UnmapViewOfFile(m_pData);
+	#else
+	munmap(m_pData, (size_t)m_nSize);
+	#endif
+#endif
+}
+
+ZipDir::CFileMapping* ZipDir::CFileMapping::Create(FILE* pFile, int64 nFileSize)
+{
+#if defined(SUPPORT_PAK_FILE_MAPPING)
+	// mapped copy-on-write: the file data is exposed through the non-const ICryPak interface,
+	// a caller patching it in place must neither crash nor end up writing to the pak
+	if (!pFile || nFileSize <= 0 || (uint64)nFileSize > (uint64)SIZE_MAX)
+		return NULL;
+
+	#if CRY_PLATFORM_WINDOWS
+	HANDLE hFile = (HANDLE)_get_osfhandle(_fileno(pFile));
+	if (hFile == INVALID_HANDLE_VALUE)
+		return NULL;
+
+	// the view keeps the mapping object alive, the handle isn't needed anymore
+	HANDLE hMapping = CreateFileMapping(hFile, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+	if (!hMapping)
+		return NULL;
+	void* pData = MapViewOfFile(hMapping, FILE_MAP_COPY, 0, 0, 0);
+	CloseHandle(hMapping);
+	if (!pData)
+		return NULL;
+	#else
+	void* pData = mmap(NULL, (size_t)nFileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno(pFile), 0);
+	if (pData == MAP_FAILED)
+		return NULL;
+	#endif
+
+	return new CFileMapping((uint8*)pData, nFileSize);
+#else
+	return NULL;
+#endif
+}
+
+int64 ZipDir::CFileMapping::GetResidentSize() const
+{
+#if defined(SUPPORT_PAK_FILE_MAPPING) && !CRY_PLATFORM_WINDOWS
+	const size_t nPageSize = (size_t)sysconf(_SC_PAGESIZE);
+	const size_t nPages = ((size_t)m_nSize + nPageSize - 1) / nPageSize;
+
+	#if CRY_PLATFORM_APPLE
+	std::vector<char> residency(nPages);
+	#else
+	std::vector<unsigned char> residency(nPages);
+	#endif
+	if (mincore(m_pData, (size_t)m_nSize, &residency[0]) != 0)
+		return -1;
+
+	size_t nResidentPages = 0;
+	for (size_t i = 0; i < nPages; ++i)
+		nResidentPages += residency[i] & 1;
+	return (int64)(nResidentPages * nPageSize);
+#else
+	return -1;
+#endif
+}
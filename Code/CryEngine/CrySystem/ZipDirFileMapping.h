@@ -0,0 +1,48 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#ifndef _ZIP_DIR_FILE_MAPPING_HDR_
+#define _ZIP_DIR_FILE_MAPPING_HDR_
+
+#if CRY_PLATFORM_WINDOWS || (CRY_PLATFORM_POSIX && !(CRY_PLATFORM_ANDROID && defined(ANDROID_OBB)))
+	#define SUPPORT_PAK_FILE_MAPPING
+#endif
+
+namespace ZipDir
+{
+
+// Memory mapping of a whole zip file, never written back to disk.
+// Stored (not compressed, not encrypted) files can be handed out as views straight into the mapping
+// instead of being copied into a heap buffer. Every view holds a reference, so the mapping
+// stays valid after the cache which created it is closed.
+class CFileMapping : public CMultiThreadRefCount
+{
+public:
+	// returns NULL if the file couldn't be mapped
+	static CFileMapping* Create(FILE* pFile, int64 nFileSize);
+	~CFileMapping();
+
+	const uint8* GetData() const { return m_pData; }
+	int64        GetSize() const { return m_nSize; }
+
+	// bytes of the mapping currently in physical memory, -1 if the platform can't tell
+	int64 GetResidentSize() const;
+
+	void  AddView(size_t nSize)    { CryInterlockedIncrement(&m_nViews); CryInterlockedAdd(&m_nViewBytes, nSize); }
+	void  RemoveView(size_t nSize) { CryInterlockedDecrement(&m_nViews); CryInterlockedAdd(&m_nViewBytes, (size_t)0 - nSize); }
+	int   GetNumViews() const      { return m_nViews; }
+	size_t GetViewBytes() const    { return m_nViewBytes; }
+
+private:
+	CFileMapping(uint8* pData, int64 nSize);
+
+	uint8*          m_pData;
+	int64           m_nSize;
+	volatile int    m_nViews;
+	volatile size_t m_nViewBytes;
+};
+
+typedef _smart_ptr<CFileMapping> CFileMappingPtr;
+
+}
+
+#endif
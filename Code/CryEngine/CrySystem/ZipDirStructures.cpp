@@ -12,6 +12,10 @@
 #include <CryThreading/IJobManager.h>
 #include "CryPak.h"
 #include <CryThreading/IJobManager_JobDelegator.h>
+#include <lz4.h>
+#if defined(SUPPORT_ZSTD_PAKS)
+	#include <zstd.h>
+#endif
 
 #ifdef SUPPORT_UNBUFFERED_IO
 	#include <shlwapi.h>
@@ -536,6 +540,93 @@ int ZipDir::ZipRawCompress(CMTSafeHeap* pHeap, const void* pUncompressed, unsign
 	return err;
 }
 
+uint64 ZipDir::BlockTable::GetSize(const void* pCompressed)
+{
+	const ZipFile::BlockCompressionHeader* pHeader = (const ZipFile::BlockCompressionHeader*)pCompressed;
+	return sizeof(ZipFile::BlockCompressionHeader) + (uint64)pHeader->nNumBlocks * sizeof(uint32);
+}
+
+bool ZipDir::BlockTable::Init(const void* pCompressed, uint32 nSizeCompressed, uint32 nSizeUncompressed)
+{
+	if (nSizeCompressed < sizeof(ZipFile::BlockCompressionHeader))
+		return false;
+
+	const ZipFile::BlockCompressionHeader* pHeader = (const ZipFile::BlockCompressionHeader*)pCompressed;
+	nBlockSize = pHeader->nBlockSize;
+	nNumBlocks = pHeader->nNumBlocks;
+	pCompressedSizes = (const uint32*)(pHeader + 1);
+
+	if (!nBlockSize || nNumBlocks != (uint32)(((uint64)nSizeUncompressed + nBlockSize - 1) / nBlockSize))
+		return false;
+
+	const uint64 nTableSize = GetSize(pCompressed);
+	if (nTableSize > nSizeCompressed)
+		return false;
+	nDataOffset = (uint32)nTableSize;
+
+	uint64 nSizeBlocks = 0;
+	for (uint32 i = 0; i < nNumBlocks; ++i)
+	{
+		if (pCompressedSizes[i] > GetUncompressedSize(i, nSizeUncompressed))
+			return false;
+		nSizeBlocks += pCompressedSizes[i];
+	}
+	return nTableSize + nSizeBlocks == nSizeCompressed;
+}
+
+int ZipDir::ZipRawUncompressBlock(int nMethod, void* pUncompressed, unsigned long nDestSize, const void* pCompressed, unsigned long nSrcSize)
+{
+	if (nSrcSize == nDestSize)
+	{
+		memcpy(pUncompressed, pCompressed, nDestSize);
+		return Z_OK;
+	}
+
+	switch (nMethod)
+	{
+	case METHOD_LZ4_BLOCKS:
+		if (LZ4_decompress_safe((const char*)pCompressed, (char*)pUncompressed, (int)nSrcSize, (int)nDestSize) != (int)nDestSize)
+			return Z_DATA_ERROR;
+		return Z_OK;
+
+#if defined(SUPPORT_ZSTD_PAKS)
+	case METHOD_ZSTD_BLOCKS:
+		{
+			const size_t nResult = ZSTD_decompress(pUncompressed, nDestSize, pCompressed, nSrcSize);
+			if (ZSTD_isError(nResult) || nResult != nDestSize)
+				return Z_DATA_ERROR;
+			return Z_OK;
+		}
+#endif
+
+	default:
+		return Z_STREAM_ERROR;
+	}
+}
+
+int ZipDir::ZipRawUncompressBlocks(int nMethod, void* pUncompressed, unsigned long* pDestSize, const void* pCompressed, unsigned long nSrcSize)
+{
+	LOADING_TIME_PROFILE_SECTION(gEnv->pSystem);
+
+	BlockTable table;
+	if (!table.Init(pCompressed, nSrcSize, *pDestSize))
+		return Z_DATA_ERROR;
+
+	const uint8* pSrc = (const uint8*)pCompressed + table.nDataOffset;
+	uint8* pDst = (uint8*)pUncompressed;
+	for (uint32 i = 0; i < table.nNumBlocks; ++i)
+	{
+		const uint32 nBlockSizeUncompressed = table.GetUncompressedSize(i, *pDestSize);
+		const int nReturnCode = ZipRawUncompressBlock(nMethod, pDst, nBlockSizeUncompressed, pSrc, table.pCompressedSizes[i]);
+		if (nReturnCode != Z_OK)
+			return nReturnCode;
+
+		pSrc += table.pCompressedSizes[i];
+		pDst += nBlockSizeUncompressed;
+	}
+	return Z_OK;
+}
+
 // finds the subdirectory entry by the name, using the names from the name pool
 // assumes: all directories are sorted in alphabetical order.
 // case-sensitive (must be lower-case if case-insensitive search in Win32 is performed)
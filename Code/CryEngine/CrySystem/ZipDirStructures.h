@@ -270,6 +270,35 @@ extern int ZipRawUncompress(CMTSafeHeap* pHeap, void* pUncompressed, unsigned lo
 // returns one of the Z_* errors (Z_OK upon success), and the size in *pDestSize. the pCompressed buffer must be at least nSrcSize*1.001+12 size
 extern int ZipRawCompress(CMTSafeHeap* pHeap, const void* pUncompressed, unsigned long* pDestSize, void* pCompressed, unsigned long nSrcSize, int nLevel);
 
+// the block table at the start of the data of a METHOD_LZ4_BLOCKS or METHOD_ZSTD_BLOCKS file
+struct BlockTable
+{
+	uint32        nBlockSize;
+	uint32        nNumBlocks;
+	const uint32* pCompressedSizes;
+	uint32        nDataOffset;   // of the first block, from the start of the file data
+
+	// number of bytes of the file data holding the header and the table, the header must be available
+	static uint64 GetSize(const void* pCompressed);
+
+	// the header and the whole table must be available, returns false
+	// if the table doesn't match the sizes of the file
+	bool   Init(const void* pCompressed, uint32 nSizeCompressed, uint32 nSizeUncompressed);
+
+	uint32 GetUncompressedSize(uint32 nBlock, uint32 nSizeUncompressed) const
+	{
+		return nBlock + 1 < nNumBlocks ? nBlockSize : nSizeUncompressed - nBlock * nBlockSize;
+	}
+};
+
+// Uncompresses one block of a METHOD_LZ4_BLOCKS or METHOD_ZSTD_BLOCKS file, which must decompress to exactly nDestSize bytes
+// returns one of the Z_* errors (Z_OK upon success), src and dst must not overlap
+extern int ZipRawUncompressBlock(int nMethod, void* pUncompressed, unsigned long nDestSize, const void* pCompressed, unsigned long nSrcSize);
+
+// Uncompresses all blocks of a METHOD_LZ4_BLOCKS or METHOD_ZSTD_BLOCKS file, one after another
+// returns one of the Z_* errors (Z_OK upon success), src and dst must not overlap
+extern int ZipRawUncompressBlocks(int nMethod, void* pUncompressed, unsigned long* pDestSize, const void* pCompressed, unsigned long nSrcSize);
+
 // fseek wrapper with memory in file support.
 extern int64 FSeek(CZipFile* zipFile, int64 origin, int command);
 
@@ -351,6 +380,15 @@ struct FileEntry
 		  );
 	}
 
+	// compressed as independent blocks, see ZipFile::BlockCompressionHeader
+	bool IsBlockCompressed() const
+	{
+		return (
+		  nMethod == ZipFile::METHOD_LZ4_BLOCKS ||
+		  nMethod == ZipFile::METHOD_ZSTD_BLOCKS
+		  );
+	}
+
 	void GetMemoryUsage(ICrySizer* pSizer) const { /* nothing */ }
 };
 #else //OPTIMIZED_READONLY_ZIP_ENTRY
@@ -415,6 +453,15 @@ struct FileEntry
 		  );
 	}
 
+	// compressed as independent blocks, see ZipFile::BlockCompressionHeader
+	bool IsBlockCompressed() const
+	{
+		return (
+		  nMethod == ZipFile::METHOD_LZ4_BLOCKS ||
+		  nMethod == ZipFile::METHOD_ZSTD_BLOCKS
+		  );
+	}
+
 	void GetMemoryUsage(ICrySizer* pSizer) const { /* nothing */ }
 };
 #endif //OPTIMIZED_READONLY_ZIP_ENTRY
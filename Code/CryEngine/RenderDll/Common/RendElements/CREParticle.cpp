@@ -38,8 +38,9 @@ void CFillRateManager::ComputeMaxPixels()
 	FUNCTION_PROFILER(GetISystem(), PROFILE_PARTICLE);
 
 	// Find per-container maximum which will not exceed total.
-	// don't use static here, this function can be called before particle cvars are registered
-	ICVar* pVar = gEnv->pConsole->GetCVar("e_ParticlesMaxScreenFill");
+	// the handle is looked up again until the particle cvars are registered
+	static CVarHandle<float> s_maxScreenFill("e_ParticlesMaxScreenFill");
+	ICVar* pVar = s_maxScreenFill.GetCVar();
 	if (!pVar)
 		return;
 	float fMaxTotalPixels = pVar->GetFVal() * gRenDev->GetWidth() * gRenDev->GetHeight();
@@ -219,7 +219,8 @@ void CRenderItemDrawer::JobifyDrawSubmission(bool bForceImmediateExecution)
 	if (!bForceImmediateExecution)
 	{
 		int32 numTasksTentative = CRenderer::CV_r_multithreadedDrawing;
-		uint32 numTasks = std::min(numItems, uint32(numTasksTentative > 0 ? numTasksTentative : std::max(1U, gEnv->GetJobManager()->GetNumWorkerThreads() - 2U)));
+		const uint32 numWorkerThreads = gEnv->GetJobManager()->GetNumWorkerThreads();
+		uint32 numTasks = std::min(numItems, uint32(numTasksTentative > 0 ? numTasksTentative : (numWorkerThreads > 3U ? numWorkerThreads - 2U : 1U)));
 		uint32 numItemsPerTask = (numItems + (numTasks - 1)) / numTasks;
 
 		if (CRenderer::CV_r_multithreadedDrawingMinJobSize > 0)
@@ -235,12 +236,22 @@ void CRenderItemDrawer::JobifyDrawSubmission(bool bForceImmediateExecution)
 		{
 			m_CoalescedContexts.PrepareJobs(numTasks);
 
+			// Hand every job the first pass context it touches, so jobs don't all walk the context list from the start
+			SGraphicsPipelinePassContext* pTaskContext = pStart;
+			uint32 taskContextRIStart = 0;
+
 			for (uint32 curTask = 1; curTask < numTasks; ++curTask)
 			{
 				const uint32 taskRIStart = 0 + ((curTask + 0) * numItemsPerTask);
 				const uint32 taskRIEnd = 0 + ((curTask + 1) * numItemsPerTask);
 
-				TListDrawCommandRecorder job(pStart, &m_CoalescedContexts.pCommandLists[curTask], taskRIStart, taskRIEnd < numItems ? taskRIEnd : numItems);
+				while ((pTaskContext + 1 != pEnd) && (taskContextRIStart + pTaskContext->rendItems.Length() <= taskRIStart))
+				{
+					taskContextRIStart += pTaskContext->rendItems.Length();
+					pTaskContext += 1;
+				}
+
+				TListDrawCommandRecorder job(pTaskContext, &m_CoalescedContexts.pCommandLists[curTask], taskRIStart - taskContextRIStart, (taskRIEnd < numItems ? taskRIEnd : numItems) - taskContextRIStart);
 
 				job.RegisterJobState(&m_CoalescedContexts.jobState);
 				job.SetPriorityLevel(JobManager::eHighPriority);
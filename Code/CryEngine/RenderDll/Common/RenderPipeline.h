@@ -336,6 +336,8 @@ struct CRY_ALIGN(128) SPipeStat
 	int m_nDIPs[EFSLIST_NUM];
 	int m_nInsts;
 	int m_nInstCalls;
+	int m_nStaticInsts[2];     // instances drawn from the static instancing buffers of compiled objects, [0] scene passes, [1] shadow maps
+	int m_nStaticInstCalls[2];
 	int m_nPolygons[EFSLIST_NUM];
 	int m_nPolygonsByTypes[EFSLIST_NUM][EVCT_NUM][2];
 
@@ -345,6 +347,7 @@ struct CRY_ALIGN(128) SPipeStat
 	int m_nModifiedCompiledObjects;
 	int m_nTempCompiledObjects;
 	int m_nIncompleteCompiledObjects;
+	int m_nInstanceDataCompiledObjects;
 	int m_nNumPSOSwitches;
 	int m_nNumLayoutSwitches;
 	int m_nNumResourceSetSwitches;
@@ -3660,7 +3660,7 @@ void SRenderThread::WaitFlushFinishedCond()
 // Must be executed from render thread
 void SRenderThread::WaitFlushCond()
 {
-	FUNCTION_PROFILER(GetISystem(), PROFILE_RENDERER);
+	CRY_PROFILE_REGION_WAITING(PROFILE_RENDERER, "Wait - WaitFlushCond");
 
 	CTimeValue time = iTimer->GetAsyncTime();
 #ifdef USE_LOCKS_FOR_FLUSH_SYNC
@@ -50,6 +50,7 @@ AllocateConstIntCVar(CRendererCVars, CV_r_SyncToFrameFence);
 AllocateConstIntCVar(CRendererCVars, CV_e_DebugTexelDensity);
 AllocateConstIntCVar(CRendererCVars, CV_e_DebugDraw);
 int CRendererCVars::CV_r_minimizeLatency = 0;
+int CRendererCVars::CV_r_MaxFramesInFlight = MAX_FRAMES_IN_FLIGHT;
 AllocateConstIntCVar(CRendererCVars, CV_r_statsMinDrawcalls);
 AllocateConstIntCVar(CRendererCVars, CV_r_stats);
 AllocateConstIntCVar(CRendererCVars, CV_r_profiler);
@@ -465,10 +466,14 @@ AllocateConstIntCVar(CRendererCVars, CV_r_showbufferusage);
 ICVar* CRendererCVars::CV_r_ShaderCompilerServer;
 ICVar* CRendererCVars::CV_r_ShaderCompilerFolderName;
 ICVar* CRendererCVars::CV_r_ShaderCompilerFolderSuffix;
+ICVar* CRendererCVars::CV_r_ShaderListMergeFiles;
 ICVar* CRendererCVars::CV_r_ShaderEmailTags;
 ICVar* CRendererCVars::CV_r_ShaderEmailCCs;
 int CRendererCVars::CV_r_ShaderCompilerPort;
 int CRendererCVars::CV_r_ShaderCompilerDontCache;
+int CRendererCVars::CV_r_ShaderCompilerMaxRequests;
+int CRendererCVars::CV_r_ShaderCompilerMaxRequestsPrecache;
+int CRendererCVars::CV_r_ShaderCompilerLocalFallback;
 int CRendererCVars::CV_r_flares = FLARES_DEFAULT_VAL;
 AllocateConstIntCVar(CRendererCVars, CV_r_flareHqShafts);
 float CRendererCVars::CV_r_FlaresChromaShift;
@@ -759,6 +764,14 @@ static void OnChangeShadowJitteringCVar(ICVar* pCVar)
 	gRenDev->SetShadowJittering(pCVar->GetFVal());
 }
 
+uint32 CRendererCVars::GetMaxFramesInFlight()
+{
+	if (CV_r_minimizeLatency > 0)
+		return MAX_FRAMES_IN_FLIGHT;
+
+	return (uint32)clamp_tpl(CV_r_MaxFramesInFlight, (int)MAX_FRAMES_IN_FLIGHT, (int)MAX_FRAMES_IN_FLIGHT_LIMIT);
+}
+
 void CRendererCVars::OnChange_CachedShadows(ICVar* pCVar)
 {
 	if (gEnv->p3DEngine)  // 3DEngine not initialized during ShaderCacheGen
@@ -1917,6 +1930,28 @@ void CRendererCVars::InitCVars()
 	               "Usage: r_ShaderCompilerDontCache 0 #\n"
 	               "Default is 0");
 
+	REGISTER_CVAR3("r_ShaderCompilerMaxRequests", CV_r_ShaderCompilerMaxRequests, 1, VF_NULL,
+	               "Number of shader compile requests the async shader compiler keeps in flight.\n"
+	               "Above 1 the pending shaders are compiled in parallel on the job system and spread over the r_ShaderCompilerServer list.\n"
+	               "Usage: r_ShaderCompilerMaxRequests 1 #\n"
+	               "Default is 1");
+
+	CV_r_ShaderListMergeFiles = REGISTER_STRING("r_ShaderListMergeFiles", "", VF_NULL,
+	                                            "Additional recorded shader lists merged into ShaderList.txt when building shader caches.\n"
+	                                            "Combinations recorded on several machines or levels can be compiled in one r_PrecacheShaderList pass.\n"
+	                                            "Usage: r_ShaderListMergeFiles <file;file;file;...> \n"
+	                                            "Default is empty");
+
+	REGISTER_CVAR3("r_ShaderCompilerMaxRequestsPrecache", CV_r_ShaderCompilerMaxRequestsPrecache, 16, VF_NULL,
+	               "Number of shader compile requests in flight while r_PrecacheShaderList builds the shader cache.\n"
+	               "Usage: r_ShaderCompilerMaxRequestsPrecache 16 #\n"
+	               "Default is 16");
+
+	REGISTER_CVAR3("r_ShaderCompilerLocalFallback", CV_r_ShaderCompilerLocalFallback, 0, VF_NULL,
+	               "Compiles a shader with the local compiler when no shader compile server could be reached (D3D11 only).\n"
+	               "Usage: r_ShaderCompilerLocalFallback 0 #\n"
+	               "Default is 0");
+
 	REGISTER_CVAR3("r_RC_AutoInvoke", CV_r_rc_autoinvoke, (gEnv->pSystem->IsDevMode() ? 1 : 0), VF_NULL,
 	               "Enable calling the resource compiler (rc.exe) to compile assets at run-time if the date check\n"
 	               "shows that the destination is older or does not exist.\n"
@@ -2145,7 +2180,8 @@ void CRendererCVars::InitCVars()
 	                    "	0: Texture logging off\n"
 	                    "	1: Texture information logged to screen\n"
 	                    "	2: All loaded textures logged to 'UsedTextures.txt'\n"
-	                    "	3: Missing textures logged to 'MissingTextures.txt");
+	                    "	3: Missing textures logged to 'MissingTextures.txt'\n"
+	                    "	5: Render targets and UAV textures logged to 'RenderTargets.txt'");
 	DefineConstIntCVar3("r_TexNoLoad", CV_r_texnoload, 0, VF_NULL,
 	                    "Disables loading of textures.\n"
 	                    "Usage:	r_TexNoLoad [0/1]\n"
@@ -2378,6 +2414,14 @@ void CRendererCVars::InitCVars()
 	               "Maximum frame latency will be set to 1 on DXGI-supporting platforms\n"
 	               "as well as frames flushed after Present() if r_Flush is enabled.");
 
+	REGISTER_CVAR3("r_MaxFramesInFlight", CV_r_MaxFramesInFlight, MAX_FRAMES_IN_FLIGHT, VF_NULL,
+	               "Number of frames the CPU may be ahead of the GPU before the render thread waits on the frame fence.\n"
+	               "3 keeps the render thread from stalling on GPU spikes at the cost of one frame of latency.\n"
+	               "Per-frame device resources are only recycled once their frame fence has completed.\n"
+	               "The DXGI maximum frame latency follows this value at device creation.\n"
+	               "Ignored when r_minimizeLatency is set.\n"
+	               "Usage: r_MaxFramesInFlight [2/3]");
+
 	DefineConstIntCVar3("r_ShadersDebug", CV_r_shadersdebug, 0, VF_DUMPTODISK,
 	                    "Enable special logging when shaders become compiled\n"
 	                    "Usage: r_ShadersDebug [0/1/2/3/4]\n"
@@ -2857,8 +2901,9 @@ void CRendererCVars::InitCVars()
 	               "+1=GPU-Skinning (default off),\n"
 	               "+2=GPU-Particles (default off),\n"
 	               "+4=Tiled-Shading (default off),\n"
-	               "+8=Volumetric-Clouds (default off)\n"
-	               "Usage: r_D3D12SubmissionThread [0-15]");
+	               "+8=Volumetric-Clouds (default off),\n"
+	               "+16=Volumetric-Fog light binning and depth downscale (default off)\n"
+	               "Usage: r_D3D12AsynchronousCompute [0-31]");
 	REGISTER_CVAR3("r_D3D12HardwareComputeQueue", CV_r_D3D12HardwareComputeQueue, 0 /*1*/, VF_NULL,
 	               "Selects the hardware queue on which compute tasks run.\n"
 	               "0=Direct Queue,\n"
@@ -3272,6 +3317,7 @@ void CRendererCVars::InitCVars()
 	DefineConstIntCVar(r_ComputeSkinningMorphs, 1, VF_NULL, "Apply morphs before skinning");
 	DefineConstIntCVar(r_ComputeSkinningTangents, 1, VF_NULL, "Calculate new tangents after skinning is computed");
 	DefineConstIntCVar(r_ComputeSkinningDebugDraw, 0, VF_NULL, "Enable debug draw mode for geometry deformation");
+	DefineConstIntCVar(r_ComputeSkinningSharePoses, 1, VF_NULL, "Skin instances of the same mesh with an identical pose once per frame and share the output");
 
 	//////////////////////////////////////////////////////////////////////////
 	InitExternalCVars();
@@ -14,6 +14,9 @@ class CRendererCVars
 public:
 	void InitCVars();
 
+	// r_MaxFramesInFlight clamped to the supported range
+	static uint32 GetMaxFramesInFlight();
+
 protected:
 
 	// Helper methods.
@@ -34,6 +37,7 @@ public:
 	static ICVar* CV_r_ShaderCompilerServer;
 	static ICVar* CV_r_ShaderCompilerFolderName;
 	static ICVar* CV_r_ShaderCompilerFolderSuffix;
+	static ICVar* CV_r_ShaderListMergeFiles;
 	static ICVar* CV_r_ShaderEmailTags;
 	static ICVar* CV_r_ShaderEmailCCs;
 	static ICVar* CV_r_excludeshader;
@@ -71,6 +75,7 @@ public:
 	static float CV_r_MotionBlurThreshold;
 	static int   CV_r_UseMergedPosts;
 	static int   CV_r_minimizeLatency;
+	static int   CV_r_MaxFramesInFlight;
 	static int   CV_r_texatlassize;
 	static int   CV_r_DeferredShadingSortLights;
 	static int   CV_r_DeferredShadingAmbientSClear;
@@ -103,6 +108,9 @@ public:
 	static int   CV_r_ShaderCompilerPort;
 	static int   CV_r_ShowDynTexturesMaxCount;
 	static int   CV_r_ShaderCompilerDontCache;
+	static int   CV_r_ShaderCompilerMaxRequests;
+	static int   CV_r_ShaderCompilerMaxRequestsPrecache;
+	static int   CV_r_ShaderCompilerLocalFallback;
 	static int   CV_r_dyntexmaxsize;
 	static int   CV_r_dyntexatlascloudsmaxsize;
 	static int   CV_r_dyntexatlasspritesmaxsize;
@@ -202,6 +210,7 @@ public:
 	DeclareConstIntCVar(r_ComputeSkinningMorphs, 1);
 	DeclareConstIntCVar(r_ComputeSkinningTangents, 1);
 	DeclareConstIntCVar(r_ComputeSkinningDebugDraw, 0);
+	DeclareConstIntCVar(r_ComputeSkinningSharePoses, 1);
 
 	//declare in release mode constant cvars
 	DeclareStaticConstIntCVar(CV_r_stats, 0);
@@ -24,6 +24,8 @@
 #include "Textures/Image/CImage.h"
 #include "Textures/TextureManager.h"
 #include <CryRenderer/branchmask.h>
+#include <CryMemory/HeapAllocator.h>
+#include <CryMath/RadixSort.h>
 #include "PostProcess/PostEffects.h"
 #include "RendElements/CRELensOptics.h"
 
@@ -902,9 +904,49 @@ void SRendItem::mfSortByLight(SRendItem* First, int Num, bool bSort, const bool
 	}
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Maps a float onto an uint32 whose unsigned order matches the float order
+static inline uint32 SortableFloatBits(float f)
+{
+	union { float f; uint32 u; } bits;
+	bits.f = f + 0.0f;  // folds -0 into +0, they compare equal
+	return (bits.u & 0x80000000) ? ~bits.u : (bits.u | 0x80000000);
+}
+
+// Same order as std::stable_sort with SCompareDist / SCompareDistInverted, the distance and
+// particle counter are packed into one 64 bit key and sorted with a stable LSD radix sort
+static void RadixSortByDist(SRendItem* First, int Num, bool InvertedOrder)
+{
+	typedef stl::HeapAllocator<stl::PSyncNone> THeap;
+	THeap heap;
+
+	THeap::Array<uint64, uint> keys(heap, Num);
+	THeap::Array<uint32, uint> ranks(heap, Num);
+	for (int i = 0; i < Num; i++)
+	{
+		uint32 dist = SortableFloatBits(First[i].fDist);
+		uint32 counter = First[i].rendItemSorter.ParticleCounter();
+		if (InvertedOrder)
+			counter = ~counter;
+		else
+			dist = ~dist;
+		keys[i] = (uint64(dist) << 32) | counter;
+	}
+
+	RadixSort(ranks.begin(), ranks.end(), keys.begin(), keys.end(), heap);
+
+	THeap::Array<SRendItem, uint> sorted(heap, Num);
+	for (int i = 0; i < Num; i++)
+		sorted[i] = First[ranks[i]];
+	std::copy(sorted.begin(), sorted.end(), First);
+}
+
 //////////////////////////////////////////////////////////////////////////
 void SRendItem::mfSortByDist(SRendItem* First, int Num, bool bDecals, bool InvertedOrder)
 {
+	// Below this the comparison sort is cheaper than building the histograms
+	const int nRadixSortMinItems = 512;
+
 	//Note: Temporary use stable sort for flickering hair (meshes within the same skin attachment don't have a deterministic sort order)
 	CRenderer* r = gRenDev;
 	int i;
@@ -936,7 +978,9 @@ void SRendItem::mfSortByDist(SRendItem* First, int Num, bool bDecals, bool Inver
 			pRI->fDist = pObj->m_fDistance + fAddDist;
 		}
 
-		if (InvertedOrder)
+		if (Num >= nRadixSortMinItems)
+			RadixSortByDist(First, Num, InvertedOrder);
+		else if (InvertedOrder)
 			std::stable_sort(First, First + Num, SCompareDistInverted());
 		else
 			std::stable_sort(First, First + Num, SCompareDist());
@@ -542,6 +542,7 @@ public:
 	void              mfInitShadersCacheMissLog();
 
 	void              mfInitShadersCache(byte bForLevel, FXShaderCacheCombinations* Combinations = NULL, const char* pCombinations = NULL, int nType = 0);
+	void              mfMergeShaderLists(FXShaderCacheCombinations& Combinations, const char* szFileNames);
 	void              mfMergeShadersCombinations(FXShaderCacheCombinations* Combinations, int nType);
 	void              mfInsertNewCombination(SShaderCombIdent& Ident, EHWShaderClass eCL, const char* name, int nID, string* Str = NULL, byte bStore = 1);
 	string            mfGetShaderCompileFlags(EHWShaderClass eClass, UPipelineState pipelineState) const;
@@ -187,7 +187,8 @@ EServerError CShaderSrv::Compile(std::vector<uint8>& rVec,
                                  const char* pProgram,
                                  const char* pEntry,
                                  const char* pCompileFlags,
-                                 const char* pIdent) const
+                                 const char* pIdent,
+                                 int nServer) const
 {
 	EServerError errCompile = ESOK;
 
@@ -236,7 +237,7 @@ EServerError CShaderSrv::Compile(std::vector<uint8>& rVec,
 			return ESFailed;
 		}
 
-		errCompile = Send(CompileData);
+		errCompile = Send(CompileData, nServer);
 	}
 	while (errCompile == ESRecvFailed && nRetries-- > 0);
 
@@ -296,6 +297,36 @@ bool CShaderSrv::RequestLine(const string& rList, const string& rString) const
 	return (Send(CompileData) == ESOK);
 }
 
+bool CShaderSrv::RequestLines(const string& rList, const std::vector<string>& rLines) const
+{
+	// same batch size as CommitPLCombinations, the server splits the request at the semicolons
+	const uint32 STEPSIZE = 32;
+	bool bResult = true;
+	for (uint32 i = 0; i < rLines.size(); i += STEPSIZE)
+	{
+		string Line = rLines[i];
+		for (uint32 j = 1; j < STEPSIZE && i + j < rLines.size(); j++)
+		{
+			Line += ";";
+			Line += rLines[i + j];
+		}
+		bResult &= RequestLine(rList, Line);
+	}
+	return bResult;
+}
+
+uint32 CShaderSrv::GetServerCount() const
+{
+	tdEntryVec ServerVec;
+	if (gRenDev->CV_r_ShaderCompilerServer)
+		Tokenize(ServerVec, gRenDev->CV_r_ShaderCompilerServer->GetString(), ";");
+
+	uint32 nCount = 0;
+	for (size_t a = 0; a < ServerVec.size(); a++)
+		nCount += ServerVec[a].empty() ? 0 : 1;
+	return max(nCount, 1u);
+}
+
 bool CShaderSrv::Send(CRYSOCKET Socket, const char* pBuffer, uint32 Size)  const
 {
 	//size_t w;
@@ -459,7 +490,7 @@ void CShaderSrv::Tokenize(tdEntryVec& rRet, const string& Tokens, const string&
 	rRet.push_back(Tokens.substr(Start));
 }
 
-EServerError CShaderSrv::Send(std::vector<uint8>& rCompileData) const
+EServerError CShaderSrv::Send(std::vector<uint8>& rCompileData, int nServer) const
 {
 	CRYSOCKET Socket = CRY_SOCKET_ERROR;
 	int Err = CRY_SOCKET_ERROR;
@@ -476,7 +507,8 @@ EServerError CShaderSrv::Send(std::vector<uint8>& rCompileData) const
 #endif
 
 	//connect
-	for (uint32 nRetries = m_LastWorkingServer; nRetries < m_LastWorkingServer + ServerVec.size() + 6; nRetries++)
+	const uint32 nFirstServer = nServer >= 0 ? (uint32)nServer % ServerVec.size() : m_LastWorkingServer;
+	for (uint32 nRetries = nFirstServer; nRetries < nFirstServer + ServerVec.size() + 6; nRetries++)
 	{
 		string Server = ServerVec[nRetries % ServerVec.size()];
 		Socket = CrySock::socket(AF_INET, SOCK_STREAM, 0);
@@ -531,6 +563,10 @@ EServerError CShaderSrv::Send(std::vector<uint8>& rCompileData) const
 			CrySock::closesocket(Socket);
 			Socket = CRYSOCKET(CRY_INVALID_SOCKET);
 
+			// requests spread over the servers move on to the next one, the others stay on the last working server
+			if (nServer >= 0 && nRetries + 1 < nFirstServer + ServerVec.size())
+				continue;
+
 			return ESNetworkError;
 		}
 	}
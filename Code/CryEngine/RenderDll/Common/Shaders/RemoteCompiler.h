@@ -41,7 +41,8 @@ protected:
 	bool         Send(CRYSOCKET Socket, const char* pBuffer, uint32 Size) const;
 	bool         Send(CRYSOCKET Socket, std::vector<uint8>& rCompileData) const;
 	EServerError Recv(CRYSOCKET Socket, std::vector<uint8>& rCompileData) const;
-	EServerError Send(std::vector<uint8>& rCompileData) const;
+	// nServer picks the server of the r_ShaderCompilerServer list to try first, -1 for the last one that worked
+	EServerError Send(std::vector<uint8>& rCompileData, int nServer = -1) const;
 
 	void         Tokenize(tdEntryVec& rRet, const string& Tokens, const string& Separator) const;
 	string       TransformToXML(const string& rIn) const;
@@ -60,10 +61,15 @@ public:
 	                     const char* pProgram,
 	                     const char* pEntry,
 	                     const char* pCompileFlags,
-	                     const char* pIdent) const;
+	                     const char* pIdent,
+	                     int nServer = -1) const;
 	bool               CommitPLCombinations(std::vector<SCacheCombination>& rVec);
 	bool               RequestLine(const string& rList,
 	                               const string& rString)  const;
+	// Submits many request lines of the same list with as few round trips as possible.
+	bool               RequestLines(const string& rList,
+	                                const std::vector<string>& rLines)  const;
+	uint32             GetServerCount() const;
 	const char*        GetPlatform() const;
 
 	static CShaderSrv& Instance();
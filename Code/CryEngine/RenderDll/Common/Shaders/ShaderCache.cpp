@@ -623,6 +623,43 @@ end:
 	}
 }
 
+void CShaderMan::mfMergeShaderLists(FXShaderCacheCombinations& Combinations, const char* szFileNames)
+{
+	if (!szFileNames || !szFileNames[0])
+		return;
+
+	// mfInitShadersCache resets the export list, which belongs to the main shader list
+	FXShaderCacheCombinations exportCombinations;
+	exportCombinations.swap(m_ShaderCacheExportCombinations);
+
+	CryFixedStringT<256> fileName;
+	int nPos = 0;
+	const string fileNames = szFileNames;
+	for (string token = fileNames.Tokenize(";", nPos); !token.empty(); token = fileNames.Tokenize(";", nPos))
+	{
+		fileName = token.Trim();
+
+		FILE* fp = gEnv->pCryPak->FOpen(fileName.c_str(), "rb");
+		if (!fp)
+		{
+			iLog->LogWarning("Shader list '%s' not found, skipping", fileName.c_str());
+			continue;
+		}
+
+		const size_t nSize = gEnv->pCryPak->FGetSize(fp);
+		std::vector<char> buffer(nSize + 1);
+		const size_t nRead = gEnv->pCryPak->FReadRaw(&buffer[0], 1, nSize, fp);
+		gEnv->pCryPak->FClose(fp);
+		buffer[nRead] = 0;
+
+		const size_t nCountBefore = Combinations.size();
+		mfInitShadersCache(false, &Combinations, &buffer[0], 0);
+		iLog->Log("Merged %" PRISIZE_T " new shader combinations from '%s'", Combinations.size() - nCountBefore, fileName.c_str());
+	}
+
+	m_ShaderCacheExportCombinations.swap(exportCombinations);
+}
+
 #if CRY_PLATFORM_DESKTOP
 static void sResetDepend_r(SShaderGen* pGen, SShaderGenBit* pBit, SCacheCombination& cm)
 {
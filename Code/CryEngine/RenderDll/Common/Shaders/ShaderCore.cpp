@@ -1659,6 +1659,7 @@ int CShaderMan::mfInitShadersList(std::vector<string>* Names)
 		m_ShaderCacheExportCombinations.clear();
 
 		mfInitShadersCache(false, NULL, NULL, 0);
+		mfMergeShaderLists(m_ShaderCacheCombinations[0], CRenderer::CV_r_ShaderListMergeFiles->GetString());
 
 		if (CParserBin::m_nPlatform == SF_ORBIS)
 		{
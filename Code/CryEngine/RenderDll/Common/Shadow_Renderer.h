@@ -46,14 +46,18 @@ struct ShadowMapFrustum : public CMultiThreadRefCount
 			memset(mOctreePathNodeProcessed, 0x0, sizeof(mOctreePathNodeProcessed));
 			mProcessedCasters.clear();
 			mProcessedTerrainCasters.clear();
+			mDirtyRegions.clear();
 		}
 
 		static const int                 MAX_TRAVERSAL_PATH_LENGTH = 32;
+		static const int                 DIRTY_REGION_TILE_SIZE = 64; // texels, dirty regions are cleared in whole tiles
+		static const int                 MAX_DIRTY_REGIONS = 256;     // beyond this a full update is cheaper
 		uint8                            mOctreePath[MAX_TRAVERSAL_PATH_LENGTH];
 		uint8                            mOctreePathNodeProcessed[MAX_TRAVERSAL_PATH_LENGTH];
 
 		VectorSet<struct IShadowCaster*> mProcessedCasters;
 		VectorSet<uint64>                mProcessedTerrainCasters;
+		std::vector<AABB>                mDirtyRegions; // world space boxes of removed or moved casters, pending for the next incremental update
 	};
 
 public:
@@ -133,6 +137,7 @@ public:
 
 	PodArray<struct IShadowCaster*> castersList;
 	PodArray<struct IShadowCaster*> jobExecutedCastersList;
+	std::vector<AABB>               dirtyRegions; // world space regions of a cached map to clear before an incremental update
 
 	CCamera                         FrustumPlanes[OMNI_SIDES_NUM];
 	uint32                          nShadowGenID[RT_COMMAND_BUF_COUNT][OMNI_SIDES_NUM];
@@ -431,6 +436,7 @@ public:
 	{
 		castersList.Clear();
 		jobExecutedCastersList.Clear();
+		dirtyRegions.clear();
 	}
 
 	void                         GetMemoryUsage(ICrySizer* pSizer) const;
@@ -2301,6 +2301,53 @@ void CTexture::Update()
 			if (CRenderer::CV_r_texlog != 4)
 				CRenderer::CV_r_texlog = 0;
 		}
+		else if (CRenderer::CV_r_texlog == 5)
+		{
+			// Persistent render targets and UAV textures: the memory a transient allocator could alias
+			TArray<CTexture*> Texs;
+			for (itor = pRL->m_RMap.begin(); itor != pRL->m_RMap.end(); itor++)
+			{
+				CTexture* tp = (CTexture*)itor->second;
+				if (tp && !tp->IsNoTexture() && (tp->GetFlags() & (FT_USAGE_RENDERTARGET | FT_USAGE_DEPTHSTENCIL | FT_USAGE_UNORDERED_ACCESS)))
+				{
+					Texs.AddElem(tp);
+				}
+			}
+
+			if (Texs.Num())
+				qsort(&Texs[0], Texs.Num(), sizeof(CTexture*), TexCallback);
+
+			CryLogAlways("Logging to RenderTargets.txt...");
+			FILE* fp = fxopen("RenderTargets.txt", "w");
+			if (fp)
+			{
+				const int nFrameID = rd->m_RP.m_TI[rd->m_RP.m_nProcessThreadID].m_nFrameUpdateID;
+				int64 Size = 0;
+				int64 UsedSize = 0;
+
+				fprintf(fp, "*** Render targets: ***\n");
+				for (i = 0; i < Texs.Num(); i++)
+				{
+					const bool bUsed = Texs[i]->m_nAccessFrameID == nFrameID;
+					fprintf(fp, "%.3fKb\t\t%d x %d\t\tFormat: %s\t\t%s%s%s\t\t%s\t\t(%s)\n",
+					        Texs[i]->GetDeviceDataSize() / 1024.0f, Texs[i]->GetWidth(), Texs[i]->GetHeight(),
+					        CTexture::NameForTextureFormat(Texs[i]->GetDstFormat()),
+					        (Texs[i]->GetFlags() & FT_USAGE_RENDERTARGET) ? "RT " : "",
+					        (Texs[i]->GetFlags() & FT_USAGE_DEPTHSTENCIL) ? "DS " : "",
+					        (Texs[i]->GetFlags() & FT_USAGE_UNORDERED_ACCESS) ? "UAV" : "",
+					        bUsed ? "used" : "idle", Texs[i]->GetName());
+					Size += Texs[i]->GetDeviceDataSize();
+					if (bUsed)
+						UsedSize += Texs[i]->GetDeviceDataSize();
+				}
+				fprintf(fp, "*** Total Size: %.3fMb, Used this frame: %.3fMb, Idle this frame: %.3fMb\n\n",
+				        Size / (1024.0f * 1024.0f), UsedSize / (1024.0f * 1024.0f), (Size - UsedSize) / (1024.0f * 1024.0f));
+				fclose(fp);
+			}
+
+			Texs.Free();
+			CRenderer::CV_r_texlog = 0;
+		}
 		else if (CRenderer::CV_r_texlog == 1)
 		{
 			//char *str = GetTexturesStatusText();
@@ -755,6 +755,7 @@ typedef D3DBaseView     CDeviceResourceView;
 //////////////////////////////////////////////////////////////////////////
 #define MAX_FRAME_LATENCY    1
 #define MAX_FRAMES_IN_FLIGHT (MAX_FRAME_LATENCY + 1)    // Current and Last
+#define MAX_FRAMES_IN_FLIGHT_LIMIT 3                   // Upper bound for r_MaxFramesInFlight, sizes the frame fence ring
 
 #if CRY_PLATFORM_DURANGO
 	#include <xg.h>
@@ -471,12 +471,13 @@ bool CCompiledRenderObject::Compile(CRenderObject* pRenderObject)
 	m_pRO = pRenderObject;
 	const bool bMuteWarnings = gcpRendD3D->m_nGraphicsPipeline >= 1;  // @TODO: Remove later
 
-	m_bIncomplete = true;
-	m_bCustomRenderElement = false;
-
 	// Optimization to only update per instance constant buffer and not recompile PSO,
 	// Object must be fully compiled already for this flag to have a per instance only effect.
-	bool bInstanceDataUpdateOnly = pRenderObject->m_bInstanceDataDirty && !m_bIncomplete;
+	// Evaluated before m_bIncomplete is reset, otherwise the fast path can never be taken.
+	const bool bInstanceDataUpdateOnly = pRenderObject->m_bInstanceDataDirty && !m_bIncomplete;
+
+	m_bIncomplete = true;
+	m_bCustomRenderElement = false;
 
 	// Only objects with RenderElements can be compiled
 	if (!m_pRenderElement)
@@ -539,6 +540,11 @@ bool CCompiledRenderObject::Compile(CRenderObject* pRenderObject)
 		// Issue the barriers on the core command-list, which executes directly before the Draw()s in multi-threaded jobs
 		PrepareForUse(GetDeviceObjectFactory().GetCoreCommandList(), true);
 
+#if defined(ENABLE_PROFILING_CODE)
+		CryInterlockedIncrement(&SPipeStat::Out()->m_nInstanceDataCompiledObjects);
+#endif
+
+		m_bIncomplete = false;
 		return true;
 	}
 
@@ -742,6 +748,14 @@ void CCompiledRenderObject::DrawToCommandList(const SGraphicsPipelinePassContext
 				perInstanceCB   = pDynamicInstancingBuffer;
 				instancingCount = dynamicInstancingCount;
 			}
+#if defined(ENABLE_PROFILING_CODE)
+			else if (m_pInstancingConstBuffer && !m_bDynamicInstancingPossible)
+			{
+				const int nStatsPass = passContext.stageID == eStage_ShadowMap ? 1 : 0;
+				CryInterlockedAdd(&SPipeStat::Out()->m_nStaticInsts[nStatsPass], instancingCount);
+				CryInterlockedIncrement(&SPipeStat::Out()->m_nStaticInstCalls[nStatsPass]);
+			}
+#endif
 
 			commandInterface.SetInlineConstantBuffer(EResourceLayoutSlot_PerInstanceCB, perInstanceCB, eConstantBufferShaderSlot_PerInstance, perInstanceCBShaderStages);
 			commandInterface.DrawIndexed(drawParams.m_nNumIndices, instancingCount, drawParams.m_nStartIndex, 0, 0);
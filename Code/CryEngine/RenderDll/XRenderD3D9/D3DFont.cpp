@@ -14,6 +14,12 @@ bool CD3D9Renderer::FontUpdateTexture(int nTexId, int nX, int nY, int USize, int
 
 	if (tp)
 	{
+#if defined(ENABLE_RENDER_AUX_GEOM)
+		// queued text quads still reference the old glyphs
+		if (m_pRenderAuxGeomD3D)
+			m_pRenderAuxGeomD3D->FlushTextBatch();
+#endif
+
 		tp->UpdateTextureRegion(pSrcData, nX, nY, 0, USize, VSize, 0, eTF_A8);
 
 		return true;
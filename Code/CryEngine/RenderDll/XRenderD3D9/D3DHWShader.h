@@ -397,8 +397,12 @@ private:
 
 	CShaderThread m_thread;
 
-	bool CompileAsyncShader(SShaderAsyncInfo* pAsync);
-	void SubmitAsyncRequestLine(SShaderAsyncInfo* pAsync);
+	// nServer is the remote compile server to try first, -1 for the last one that worked
+	bool CompileAsyncShader(SShaderAsyncInfo* pAsync, int nServer = -1);
+	bool CompileAsyncShaderLocal(SShaderAsyncInfo* pAsync);
+	void CompileAsyncShaders(std::vector<SShaderAsyncInfo*>& batch, int nParallel);
+	void FinishAsyncShader(SShaderAsyncInfo* pAsync);
+	void SubmitAsyncRequestLines();
 	bool PostCompile(SShaderAsyncInfo* pAsync);
 };
 #endif
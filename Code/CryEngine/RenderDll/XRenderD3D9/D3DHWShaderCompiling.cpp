@@ -2232,8 +2232,15 @@ SShaderCacheHeaderItem* CHWShader_D3D::mfGetCacheItem(uint32& nFlags, int32& nSi
 			iLog->Log("---Cache: LoadedFromGlobal %s': 0x%x", rf->mfGetFileName(), de->Name.get());
 		pInst->m_nCache = i;
 		SShaderCacheHeaderItem* pIt = NULL;
+		const float fTime0 = iTimer->GetAsyncCurTime();
 		nSize = rf->mfFileRead(de);
 		pInst->m_bAsyncActivating = (nSize == -1);
+		if (!pInst->m_bAsyncActivating)
+		{
+			SShaderCacheStatistics& stats = gRenDev->m_cEF.m_ShaderCacheStats;
+			stats.m_nNumShaderCacheSyncReads++;
+			stats.m_fShaderCacheSyncReadTime += iTimer->GetAsyncCurTime() - fTime0;
+		}
 		pData = (byte*)rf->mfFileGetBuf(de);
 		if (pData && nSize > 0)
 		{
@@ -4242,27 +4249,74 @@ void CAsyncShaderTask::FlushPendingShaders()
 			}
 		}
 
+	SubmitAsyncRequestLines();
+
+	// while r_PrecacheShaderList builds the cache nobody waits for a particular shader, so keep the servers busy
+	const int nParallel = max(gRenDev->m_cEF.m_eCacheMode == eSC_BuildGlobalList ? CRenderer::CV_r_ShaderCompilerMaxRequestsPrecache : CRenderer::CV_r_ShaderCompilerMaxRequests, 1);
+
+	// the shaders are handed back in batches, the nearest ones don't have to wait for the whole list
+	std::vector<SShaderAsyncInfo*> batch;
+	batch.reserve(nParallel * 4);
 	for (pAI = m_flush_list.m_Next; pAI != &m_flush_list; pAI = pAINext)
 	{
 		pAINext = pAI->m_Next;
 		assert(pAI->m_bPending);
-		SubmitAsyncRequestLine(pAI);
-		if (pAI->m_Text.length() > 0)
-			CompileAsyncShader(pAI);
+		batch.push_back(pAI);
+		if (batch.size() < (size_t)nParallel * 4 && pAINext != &m_flush_list)
+			continue;
 
-		CryInterlockedDecrement(&SShaderAsyncInfo::s_nPendingAsyncShaders);
-		{
-			AUTO_LOCK(g_cAILock);
+		CompileAsyncShaders(batch, nParallel);
+		for (SShaderAsyncInfo* pAsync : batch)
+			FinishAsyncShader(pAsync);
+		batch.clear();
+	}
+}
 
-			pAI->Unlink();
-			pAI->m_bPending = 0;
-			pAI->Link(&SShaderAsyncInfo::PendingListT());
+void CAsyncShaderTask::CompileAsyncShaders(std::vector<SShaderAsyncInfo*>& batch, int nParallel)
+{
+	if (nParallel <= 1 || batch.size() <= 1 || !gEnv->pJobManager)
+	{
+		for (SShaderAsyncInfo* pAsync : batch)
+		{
+			if (pAsync->m_Text.length() > 0)
+				CompileAsyncShader(pAsync);
 		}
+		return;
+	}
 
-		if (pAI->m_bDeleteAfterRequest)
+	// every job pulls shaders off the batch until it's empty, job j starts with server j of r_ShaderCompilerServer
+	const int nServers = CRenderer::CV_r_shadersremotecompiler ? (int)NRemoteCompiler::CShaderSrv::Instance().GetServerCount() : 1;
+	const int nJobs = min(nParallel, (int)batch.size());
+	volatile int nNext = 0;
+	CryJobState jobState;
+	for (int j = 0; j < nJobs; ++j)
+	{
+		gEnv->pJobManager->AddLambdaJob("CompileAsyncShader", [this, &batch, &nNext, nServers, j]()
 		{
-			SAFE_DELETE(pAI);
-		}
+			for (int i = CryInterlockedIncrement(&nNext) - 1; i < (int)batch.size(); i = CryInterlockedIncrement(&nNext) - 1)
+			{
+				if (batch[i]->m_Text.length() > 0)
+					CompileAsyncShader(batch[i], j % nServers);
+			}
+		}, JobManager::eRegularPriority, &jobState);
+	}
+	jobState.Wait();
+}
+
+void CAsyncShaderTask::FinishAsyncShader(SShaderAsyncInfo* pAsync)
+{
+	CryInterlockedDecrement(&SShaderAsyncInfo::s_nPendingAsyncShaders);
+	{
+		AUTO_LOCK(g_cAILock);
+
+		pAsync->Unlink();
+		pAsync->m_bPending = 0;
+		pAsync->Link(&SShaderAsyncInfo::PendingListT());
+	}
+
+	if (pAsync->m_bDeleteAfterRequest)
+	{
+		SAFE_DELETE(pAsync);
 	}
 }
 
@@ -4284,34 +4338,42 @@ bool CAsyncShaderTask::PostCompile(SShaderAsyncInfo* pAsync)
 	return bResult;
 }
 
-void CAsyncShaderTask::SubmitAsyncRequestLine(SShaderAsyncInfo* pAsync)
+void CAsyncShaderTask::SubmitAsyncRequestLines()
 {
-	if (CRenderer::CV_r_shadersremotecompiler)
+	if (!CRenderer::CV_r_shadersremotecompiler)
+		return;
+
+	// one request per shader list and 32 lines instead of one per shader
+	std::map<string, std::vector<string>> listLines;
+	for (SShaderAsyncInfo* pAI = m_flush_list.m_Next; pAI != &m_flush_list; pAI = pAI->m_Next)
 	{
-		if (!pAsync->m_shaderList.empty())
+		if (!pAI->m_shaderList.empty())
 		{
-			NRemoteCompiler::CShaderSrv::Instance().RequestLine(pAsync->m_shaderList.c_str(), pAsync->m_RequestLine.c_str());
+			listLines[pAI->m_shaderList].push_back(pAI->m_RequestLine);
 		}
 		else
 		{
-			NRemoteCompiler::CShaderSrv::Instance().RequestLine(
+			listLines[
 	#if CRY_PLATFORM_ORBIS
-			  "ShaderList_Orbis.txt",
+			  "ShaderList_Orbis.txt"
 	#elif CRY_PLATFORM_DURANGO
-			  "ShaderList_Durango.txt",
+			  "ShaderList_Durango.txt"
 	#elif CRY_RENDERER_OPENGLES && DXGL_INPUT_GLSL
-			  "ShaderList_GLES3.txt",
+			  "ShaderList_GLES3.txt"
 	#elif CRY_RENDERER_OPENGL && DXGL_INPUT_GLSL
-			  "ShaderList_GL4.txt",
+			  "ShaderList_GL4.txt"
 	#else
-			  "ShaderList_PC.txt",
+			  "ShaderList_PC.txt"
 	#endif
-			  pAsync->m_RequestLine.c_str());
+			].push_back(pAI->m_RequestLine);
 		}
 	}
+
+	for (const auto& lines : listLines)
+		NRemoteCompiler::CShaderSrv::Instance().RequestLines(lines.first, lines.second);
 }
 
-bool CAsyncShaderTask::CompileAsyncShader(SShaderAsyncInfo* pAsync)
+bool CAsyncShaderTask::CompileAsyncShader(SShaderAsyncInfo* pAsync, int nServer)
 {
 	bool bResult = true;
 	if (CRenderer::CV_r_shadersremotecompiler)
@@ -4319,8 +4381,15 @@ bool CAsyncShaderTask::CompileAsyncShader(SShaderAsyncInfo* pAsync)
 		string sCompiler = gRenDev->m_cEF.mfGetShaderCompileFlags(pAsync->m_eClass, pAsync->m_pipelineState);
 
 		std::vector<uint8> Data;
-		if (NRemoteCompiler::ESOK != NRemoteCompiler::CShaderSrv::Instance().Compile(Data, pAsync->m_Profile, pAsync->m_Text.c_str(), pAsync->m_Name.c_str(), sCompiler.c_str(), pAsync->m_RequestLine.c_str()))
+		const NRemoteCompiler::EServerError errCompile = NRemoteCompiler::CShaderSrv::Instance().Compile(Data, pAsync->m_Profile, pAsync->m_Text.c_str(), pAsync->m_Name.c_str(), sCompiler.c_str(), pAsync->m_RequestLine.c_str(), nServer);
+		if (NRemoteCompiler::ESOK != errCompile)
 		{
+	#if CRY_PLATFORM_WINDOWS && !CRY_RENDERER_OPENGL
+			// the servers are down, not the shader broken
+			const bool bNetworkError = errCompile == NRemoteCompiler::ESNetworkError || errCompile == NRemoteCompiler::ESSendFailed || errCompile == NRemoteCompiler::ESRecvFailed;
+			if (bNetworkError && CRenderer::CV_r_ShaderCompilerLocalFallback && (CParserBin::m_nPlatform & (SF_D3D11 | SF_DURANGO)))
+				return CompileAsyncShaderLocal(pAsync);
+	#endif
 
 			D3DCreateBlob(sizeof("D3DXCompileShader failed"), (D3DBlob**)&pAsync->m_pErrors);
 			DWORD* pBuf = (DWORD*) pAsync->m_pErrors->GetBufferPointer();
@@ -4396,6 +4465,18 @@ bool CAsyncShaderTask::CompileAsyncShader(SShaderAsyncInfo* pAsync)
 			iLog->LogError("Trying to build non DX11 shader via internal compiler which is not supported. Please use remote compiler instead!");
 		}
 		#endif
+		bResult = CompileAsyncShaderLocal(pAsync);
+	}
+	#endif // #if CRY_PLATFORM_WINDOWS
+	return bResult;
+}
+
+bool CAsyncShaderTask::CompileAsyncShaderLocal(SShaderAsyncInfo* pAsync)
+{
+	bool bResult = false;
+	#if CRY_PLATFORM_WINDOWS && !CRY_RENDERER_OPENGL
+	{
+		bResult = true;
 		uint32 nFlags = D3D10_SHADER_PACK_MATRIX_ROW_MAJOR | D3D10_SHADER_ENABLE_BACKWARDS_COMPATIBILITY;
 		if (CRenderer::CV_r_shadersdebug == 3 || CRenderer::CV_r_shadersdebug == 4)
 			nFlags |= D3D10_SHADER_DEBUG | D3D10_SHADER_SKIP_OPTIMIZATION;
@@ -37,6 +37,9 @@ CRenderAuxGeomD3D::CRenderAuxGeomD3D(CD3D9Renderer& renderer)
 	: m_renderer(renderer)
 	, m_geomPass(false)
 	, m_textPass(false)
+	, m_textBatchBlendMode(0)
+	, m_textBatchTexID(0)
+	, m_bBatchText(false)
 	, m_wndXRes(0)
 	, m_wndYRes(0)
 	, m_aspect(1.0f)
@@ -82,6 +85,7 @@ void CRenderAuxGeomD3D::ReleaseResources()
 {
 	m_geomPrimitiveCache.clear();
 	m_textPrimitiveCache.clear();
+	m_objPrimitivePool.clear();
 
 	m_geomPass.Reset();
 	m_textPass.Reset();
@@ -573,6 +577,34 @@ CRenderPrimitive& CRenderAuxGeomD3D::PrepareTextPrimitive(int blendMode, SViewpo
 }
 
 void CRenderAuxGeomD3D::DrawBufferRT(const SAuxVertex* data, int numVertices, int blendMode, const Matrix44*, int texID)
+{
+	if( !m_bBatchText )
+	{
+		SubmitTextBuffer(data, numVertices, blendMode, texID);
+		return;
+	}
+
+	const size_t maxBatchVertices = 6 * 4096;
+	if( !m_textBatch.empty() && (blendMode != m_textBatchBlendMode || texID != m_textBatchTexID || m_textBatch.size() + numVertices > maxBatchVertices) )
+	{
+		FlushTextBatch();
+	}
+
+	m_textBatchBlendMode = blendMode;
+	m_textBatchTexID = texID;
+	m_textBatch.insert(m_textBatch.end(), data, data + numVertices);
+}
+
+void CRenderAuxGeomD3D::FlushTextBatch()
+{
+	if( !m_textBatch.empty() )
+	{
+		SubmitTextBuffer(m_textBatch.data(), (int)m_textBatch.size(), m_textBatchBlendMode, m_textBatchTexID);
+		m_textBatch.clear();
+	}
+}
+
+void CRenderAuxGeomD3D::SubmitTextBuffer(const SAuxVertex* data, int numVertices, int blendMode, int texID)
 {
 	if( !m_pAuxGeomShader )
 	{
@@ -636,10 +668,18 @@ void CRenderAuxGeomD3D::DrawBufferRT(const SAuxVertex* data, int numVertices, in
 CRenderPrimitive& CRenderAuxGeomD3D::PrepareGeomPrimitive(const SAuxGeomRenderFlags& flags, const CCryNameTSCRC& techique, ERenderPrimitiveType topology, InputLayoutHandle format, size_t stride, buffer_handle_t vb, buffer_handle_t ib)
 {
 	int32 gsFunc = PreparePass(m_geomPass) ? GS_DEPTHFUNC_GEQUAL : GS_DEPTHFUNC_LEQUAL;
-	const bool bThickLine = CAuxGeomCB::IsThickLine(flags);
 
 	auto& prim = m_geomPrimitiveCache[topology];
 
+	PrepareGeomPrimitive(prim, gsFunc, flags, techique, format, stride, vb, ib);
+
+	return prim;
+}
+
+void CRenderAuxGeomD3D::PrepareGeomPrimitive(CRenderPrimitive& prim, int32 gsFunc, const SAuxGeomRenderFlags& flags, const CCryNameTSCRC& techique, InputLayoutHandle format, size_t stride, buffer_handle_t vb, buffer_handle_t ib)
+{
+	const bool bThickLine = CAuxGeomCB::IsThickLine(flags);
+
 	CRenderPrimitive::EPrimitiveFlags primitiveFlags;
 	primitiveFlags  =              CRenderPrimitive::eFlags_ReflectShaderConstants_VS;
 	primitiveFlags |= bThickLine ? CRenderPrimitive::eFlags_ReflectShaderConstants_GS : CRenderPrimitive::eFlags_None;
@@ -680,8 +720,6 @@ CRenderPrimitive& CRenderAuxGeomD3D::PrepareGeomPrimitive(const SAuxGeomRenderFl
 	prim.SetCustomIndexStream (ib, indexbuffer_type<vtx_idx>::type);
 
 	prim.m_instances.resize(1);
-
-	return prim;
 }
 
 
@@ -816,6 +854,12 @@ void CRenderAuxGeomD3D::DrawAuxObjects(CAuxGeomCB::AuxSortedPushBuffer::const_it
 	// get draw params buffer
 	const CAuxGeomCB::AuxDrawObjParamBuffer& auxDrawObjParamBuffer(GetAuxDrawObjParamBuffer());
 
+	// all objects of the batch share the render flags, so the pass is set up once and executed once
+	const int32 gsFunc = PreparePass(m_geomPass) ? GS_DEPTHFUNC_GEQUAL : GS_DEPTHFUNC_LEQUAL;
+	size_t numObjPrimitives = 0;
+
+	m_geomPass.BeginAddingPrimitives();
+
 	// process each entry
 	for (CAuxGeomCB::AuxSortedPushBuffer::const_iterator it(itBegin); it != itEnd; ++it)
 	{
@@ -886,11 +930,14 @@ void CRenderAuxGeomD3D::DrawAuxObjects(CAuxGeomCB::AuxSortedPushBuffer::const_it
 
 		static CCryNameTSCRC techObj("AuxGeometryObj");
 
-		CRenderPrimitive& prim = PrepareGeomPrimitive(flags, techObj, eptTriangleList, EDefaultInputLayouts::P3F_T3F, sizeof(SVF_P3F_T3F), pMesh->m_pVB, pMesh->m_pIB);
+		if (numObjPrimitives == m_objPrimitivePool.size())
+			m_objPrimitivePool.emplace_back();
 
-		prim.SetDrawInfo(eptTriangleList, 0, 0, pMesh->m_numFaces * 3);
+		CRenderPrimitive& prim = m_objPrimitivePool[numObjPrimitives++];
+
+		PrepareGeomPrimitive(prim, gsFunc, flags, techObj, EDefaultInputLayouts::P3F_T3F, sizeof(SVF_P3F_T3F), pMesh->m_pVB, pMesh->m_pIB);
 
-		m_geomPass.BeginAddingPrimitives();
+		prim.SetDrawInfo(eptTriangleList, 0, 0, pMesh->m_numFaces * 3);
 
 		if (prim.Compile(m_geomPass) == CRenderPrimitive::eDirty_None)
 		{
@@ -949,10 +996,11 @@ void CRenderAuxGeomD3D::DrawAuxObjects(CAuxGeomCB::AuxSortedPushBuffer::const_it
 			}
 
 			m_geomPass.AddPrimitive(&prim);
-			m_geomPass.Execute();
 		}
 	}
 
+	m_geomPass.Execute();
+
 	// TODO: Workaround for viewport/displaycontext destruction, missing texture ref-counting
 	m_geomPass.SetRenderTarget(0, nullptr);
 }
@@ -1269,6 +1317,8 @@ void CRenderAuxGeomD3D::FlushTextMessagesInternal(CTextMessages& messages, bool
 	const float vw = static_cast<float>(viewport.nWidth);
 	const float vh = static_cast<float>(viewport.nHeight);
 
+	m_bBatchText = true;
+
 	while( const CTextMessages::CTextMessageHeader* pEntry = messages.GetNextEntry() )
 	{
 		const CTextMessages::SText* pText = pEntry->CastTo_Text();
@@ -1358,6 +1408,8 @@ void CRenderAuxGeomD3D::FlushTextMessagesInternal(CTextMessages& messages, bool
 
 			if( !pFont )
 			{
+				FlushTextBatch();
+				m_bBatchText = false;
 				return;
 			}
 
@@ -1426,6 +1478,9 @@ void CRenderAuxGeomD3D::FlushTextMessagesInternal(CTextMessages& messages, bool
 		}
 	}
 
+	FlushTextBatch();
+	m_bBatchText = false;
+
 	messages.Clear(!reset);
 }
 
@@ -24,6 +24,9 @@ public:
 
 	virtual void FlushTextMessages(CTextMessages& tMessages, bool reset) override;
 
+	// Submits the text quads gathered since the last flush, must be called before a batched font texture changes.
+	void         FlushTextBatch();
+
 	void         Process();
 
 public:
@@ -298,10 +301,12 @@ private:
 	CRenderAuxGeomD3D(CD3D9Renderer& renderer);
 
 	void              FlushTextMessagesInternal(CTextMessages& tMessages, bool reset);
+	void              SubmitTextBuffer(const SAuxVertex* data, int numVertices, int blendMode, int texID);
 
 	bool              PreparePass(CPrimitiveRenderPass& pass, SViewport* getViewport = nullptr);
 	CRenderPrimitive& PrepareTextPrimitive(int blendMode, SViewport* viewport, bool& depthreversed);
 	CRenderPrimitive& PrepareGeomPrimitive(const SAuxGeomRenderFlags& flags, const CCryNameTSCRC& techique, ERenderPrimitiveType topology, InputLayoutHandle format, size_t stride, buffer_handle_t vb, buffer_handle_t ib);
+	void              PrepareGeomPrimitive(CRenderPrimitive& prim, int32 gsFunc, const SAuxGeomRenderFlags& flags, const CCryNameTSCRC& techique, InputLayoutHandle format, size_t stride, buffer_handle_t vb, buffer_handle_t ib);
 
 	void              DrawAuxPrimitives(CAuxGeomCB::AuxSortedPushBuffer::const_iterator itBegin, CAuxGeomCB::AuxSortedPushBuffer::const_iterator itEnd, const Matrix44& mViewProj, int texID);
 	void              DrawAuxIndexedPrimitives(CAuxGeomCB::AuxSortedPushBuffer::const_iterator itBegin, CAuxGeomCB::AuxSortedPushBuffer::const_iterator itEnd, const Matrix44& mViewProj);
@@ -355,6 +360,13 @@ private:
 	CPrimitiveRenderPass                             m_textPass;
 	std::map<ERenderPrimitiveType, CRenderPrimitive> m_geomPrimitiveCache;
 	std::map<int, CRenderPrimitive>                  m_textPrimitiveCache;
+	std::deque<CRenderPrimitive>                     m_objPrimitivePool; // one primitive per aux object, so a whole object batch executes as a single pass
+
+	// while text messages are flushed, consecutive strings with the same font texture and blend mode are drawn with one draw call
+	std::vector<SAuxVertex>                          m_textBatch;
+	int                                              m_textBatchBlendMode;
+	int                                              m_textBatchTexID;
+	bool                                             m_bBatchText;
 
 	uint32                                    m_wndXRes;
 	uint32                                    m_wndYRes;
@@ -2047,7 +2047,7 @@ bool CD3D9Renderer::SetBaseResolution()
 			{
 				DXGIDevice* pDXGIDevice = 0;
 				if (SUCCEEDED(pD3D11Device->QueryInterface(__uuidof(DXGIDevice), (void**)&pDXGIDevice)) && pDXGIDevice)
-					pDXGIDevice->SetMaximumFrameLatency(MAX_FRAME_LATENCY);
+					pDXGIDevice->SetMaximumFrameLatency(CRendererCVars::GetMaxFramesInFlight() - 1);
 				SAFE_RELEASE(pDXGIDevice);
 			}
 
@@ -59,6 +59,14 @@ namespace
 {
 STiledLightCullInfo* tileLightsCull;
 STiledLightShadeInfo* tileLightsShade;
+
+// View space depth range of a cone light volume. The light doesn't reach past its radius, so the
+// bounds of the cone's base are clipped to the sphere around the tip.
+Vec2 GetConeDepthBounds(const Vec3& coneTipVS, const Vec3& coneDirVS, float radius, float baseRadius, float invCameraFar)
+{
+	AABB coneBounds = AABB::CreateAABBfromCone(Cone(coneTipVS, coneDirVS, radius, baseRadius));
+	return Vec2(max(coneBounds.min.z, coneTipVS.z - radius), min(coneBounds.max.z, coneTipVS.z + radius)) * invCameraFar;
+}
 }
 
 CTiledShading::CTiledShading()
@@ -556,9 +564,7 @@ void CTiledShading::PrepareLightList(CRenderView* pRenderView)
 
 					Vec3 coneTipVS = Vec3(posVS);
 					Vec3 coneDirVS = Vec3(Vec4(-lightDir.x, -lightDir.y, -lightDir.z, 0) * matView);
-					AABB coneBounds = AABB::CreateAABBfromCone(Cone(coneTipVS, coneDirVS, renderLight.m_fRadius, lightInfo.volumeParams0.w));
-					lightInfo.depthBoundsVS.x = std::min(lightInfo.depthBoundsVS.x, coneBounds.min.z * invCameraFar);
-					lightInfo.depthBoundsVS.y = std::min(lightInfo.depthBoundsVS.y, coneBounds.max.z * invCameraFar);
+					lightInfo.depthBoundsVS = GetConeDepthBounds(coneTipVS, coneDirVS, renderLight.m_fRadius, lightInfo.volumeParams0.w, invCameraFar);
 
 					Matrix44A projMatT;
 					CShadowUtils::GetProjectiveTexGen(&renderLight, 0, &projMatT);
@@ -636,8 +642,7 @@ void CTiledShading::PrepareLightList(CRenderView* pRenderView)
 
 							Vec3 coneTipVS = Vec3(posVS);
 							Vec3 coneDirVS = Vec3(Vec4(-spotParams.x, -spotParams.y, -spotParams.z, 0) * matView);
-							AABB coneBounds = AABB::CreateAABBfromCone(Cone(coneTipVS, coneDirVS, renderLight.m_fRadius, spotParams.w));
-							Vec2 depthBoundsVS = Vec2(coneBounds.min.z, coneBounds.max.z) * invCameraFar;
+							Vec2 depthBoundsVS = GetConeDepthBounds(coneTipVS, coneDirVS, renderLight.m_fRadius, spotParams.w, invCameraFar);
 							Vec2 sideShadowParams = (firstFrustum.nShadowGenMask & (1 << side)) ? shadowParams : Vec2(ZERO);
 
 							if (side == 0)
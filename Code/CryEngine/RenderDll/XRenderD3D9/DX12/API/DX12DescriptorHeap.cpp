@@ -58,4 +58,25 @@ CDescriptorBlock& CDescriptorBlock::operator=(const SDescriptorBlock& block)
 	return *this;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+UINT GatherDescriptorRanges(const D3D12_CPU_DESCRIPTOR_HANDLE* pDescriptors, UINT numDescriptors, UINT descriptorSize, D3D12_CPU_DESCRIPTOR_HANDLE* pRangeStarts, UINT* pRangeSizes)
+{
+	UINT numRanges = 0;
+	for (UINT i = 0; i < numDescriptors; ++i)
+	{
+		if (numRanges && pDescriptors[i].ptr == pRangeStarts[numRanges - 1].ptr + SIZE_T(pRangeSizes[numRanges - 1]) * descriptorSize)
+		{
+			++pRangeSizes[numRanges - 1];
+		}
+		else
+		{
+			pRangeStarts[numRanges] = pDescriptors[i];
+			pRangeSizes[numRanges] = 1;
+			++numRanges;
+		}
+	}
+
+	return numRanges;
+}
+
 }
@@ -168,4 +168,8 @@ private:
 	UINT m_Capacity;
 };
 
+// Merges runs of adjacent source descriptors into ranges for ID3D12Device::CopyDescriptors.
+// pRangeStarts and pRangeSizes need room for numDescriptors entries, returns the number of ranges written.
+UINT GatherDescriptorRanges(const D3D12_CPU_DESCRIPTOR_HANDLE* pDescriptors, UINT numDescriptors, UINT descriptorSize, D3D12_CPU_DESCRIPTOR_HANDLE* pRangeStarts, UINT* pRangeSizes);
+
 }
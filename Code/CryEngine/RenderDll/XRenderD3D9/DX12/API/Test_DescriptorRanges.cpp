@@ -0,0 +1,193 @@
+// Copyright 2001-2016 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "StdAfx.h"
+#include "DX12DescriptorHeap.hpp"
+#include "../../DeviceManager/DeviceObjects.h"
+#include <CrySystem/CryUnitTest.h>
+
+#if defined(CRY_UNIT_TESTING)
+
+CRY_UNIT_TEST_SUITE(DX12DescriptorRanges)
+{
+	using namespace NCryDX12;
+
+	enum
+	{
+		kSetCount    = 1024, // resource sets rebuilt at once, e.g. after a material reload
+		kSetSize     = 16,   // descriptors per set
+		kSourceCount = 8192, // cached shader resource views
+	};
+
+	// deterministic value in [0,1)
+	float Hash01(uint32 n)
+	{
+		n = (n ^ 61) ^ (n >> 16);
+		n *= 9;
+		n ^= n >> 4;
+		n *= 0x27d4eb2d;
+		n ^= n >> 15;
+		return (n & 0xffffff) * (1.0f / 0x1000000);
+	}
+
+	D3D12_CPU_DESCRIPTOR_HANDLE MakeHandle(SIZE_T ptr)
+	{
+		D3D12_CPU_DESCRIPTOR_HANDLE handle;
+		handle.ptr = ptr;
+		return handle;
+	}
+
+	CRY_UNIT_TEST(CUT_GatherDescriptorRanges)
+	{
+		const UINT descriptorSize = 32;
+		const D3D12_CPU_DESCRIPTOR_HANDLE descriptors[] =
+		{
+			MakeHandle(0), MakeHandle(32), MakeHandle(64), // one run
+			MakeHandle(200), MakeHandle(232),              // another heap position
+			MakeHandle(0),                                 // the same view twice in a set
+			MakeHandle(532), MakeHandle(500),              // adjacent, but in reverse order
+		};
+
+		D3D12_CPU_DESCRIPTOR_HANDLE rangeStarts[CRY_ARRAY_COUNT(descriptors)];
+		UINT rangeSizes[CRY_ARRAY_COUNT(descriptors)];
+		CRY_UNIT_TEST_CHECK_EQUAL(GatherDescriptorRanges(descriptors, 0, descriptorSize, rangeStarts, rangeSizes), 0u);
+
+		const UINT numRanges = GatherDescriptorRanges(descriptors, CRY_ARRAY_COUNT(descriptors), descriptorSize, rangeStarts, rangeSizes);
+		CRY_UNIT_TEST_CHECK_EQUAL(numRanges, 5u);
+
+		const SIZE_T expectedStarts[] = { 0, 200, 0, 532, 500 };
+		const UINT expectedSizes[] = { 3, 2, 1, 1, 1 };
+		UINT numDescriptors = 0;
+		for (UINT i = 0; i < numRanges; ++i)
+		{
+			CRY_UNIT_TEST_CHECK_EQUAL(rangeStarts[i].ptr, expectedStarts[i]);
+			CRY_UNIT_TEST_CHECK_EQUAL(rangeSizes[i], expectedSizes[i]);
+			numDescriptors += rangeSizes[i];
+		}
+		CRY_UNIT_TEST_CHECK_EQUAL(numDescriptors, (UINT)CRY_ARRAY_COUNT(descriptors));
+	}
+
+	// Rebuilding the descriptor tables of many resource sets the way CDeviceResourceSet_DX12::FillDescriptorBlock does it.
+	// The views of a set are either scattered over the view cache (textures loaded at different times) or adjacent
+	// (views created together, constant buffer views in the scratch space). Needs the DX12 renderer to run.
+	struct SDescriptorSetsBenchmark : public CryUnitTest::SBenchmark
+	{
+		SDescriptorSetsBenchmark(bool bAdjacent)
+			: m_bAdjacent(bAdjacent)
+			, m_pD3D12Device(nullptr)
+			, m_pSourceHeap(nullptr)
+			, m_pTableHeap(nullptr)
+			, m_descriptorSize(0)
+		{}
+
+		virtual void Init() override
+		{
+			NCryDX12::CDevice* pDevice = GetDeviceObjectFactory().GetDX12Device();
+			if (!pDevice)
+				return;
+
+			m_pD3D12Device = pDevice->GetD3D12Device();
+			m_descriptorSize = m_pD3D12Device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+
+			D3D12_DESCRIPTOR_HEAP_DESC sourceDesc = { D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, kSourceCount, D3D12_DESCRIPTOR_HEAP_FLAG_NONE, 0 };
+			D3D12_DESCRIPTOR_HEAP_DESC tableDesc = { D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, kSetCount * kSetSize, D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE, 0 };
+			m_pD3D12Device->CreateDescriptorHeap(&sourceDesc, IID_GFX_ARGS(&m_pSourceHeap));
+			m_pD3D12Device->CreateDescriptorHeap(&tableDesc, IID_GFX_ARGS(&m_pTableHeap));
+			if (!m_pSourceHeap || !m_pTableHeap)
+				return;
+
+			// null views, the copies don't look at the contents
+			D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc;
+			ZeroStruct(srvDesc);
+			srvDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+			srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+			srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+			srvDesc.Texture2D.MipLevels = 1;
+
+			const D3D12_CPU_DESCRIPTOR_HANDLE sourceStart = m_pSourceHeap->GetCPUDescriptorHandleForHeapStart();
+			for (UINT i = 0; i < kSourceCount; ++i)
+				m_pD3D12Device->CreateShaderResourceView(nullptr, &srvDesc, MakeHandle(sourceStart.ptr + SIZE_T(i) * m_descriptorSize));
+
+			m_descriptors.resize(kSetCount * kSetSize);
+			for (UINT i = 0; i < kSetCount * kSetSize; ++i)
+			{
+				const UINT index = m_bAdjacent ? (i / kSetSize * kSetSize) % kSourceCount + i % kSetSize : UINT(Hash01(i) * kSourceCount);
+				m_descriptors[i] = MakeHandle(sourceStart.ptr + SIZE_T(index) * m_descriptorSize);
+			}
+		}
+
+		virtual void Done() override
+		{
+			SAFE_RELEASE(m_pSourceHeap);
+			SAFE_RELEASE(m_pTableHeap);
+			stl::free_container(m_descriptors);
+		}
+
+		bool IsValid() const { return m_pSourceHeap && m_pTableHeap; }
+
+		// every descriptor as its own source range, how the tables were filled before the ranges were gathered
+		void CopySetsOneByOne()
+		{
+			static UINT s_rangesOfOnes[kSetSize] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+			D3D12_CPU_DESCRIPTOR_HANDLE dstHandle = m_pTableHeap->GetCPUDescriptorHandleForHeapStart();
+			const UINT dstRangeSize = kSetSize;
+			for (UINT set = 0; set < kSetCount; ++set, dstHandle.ptr += SIZE_T(kSetSize) * m_descriptorSize)
+				m_pD3D12Device->CopyDescriptors(1, &dstHandle, &dstRangeSize, kSetSize, &m_descriptors[set * kSetSize], s_rangesOfOnes, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+		}
+
+		void CopySetsInRanges()
+		{
+			D3D12_CPU_DESCRIPTOR_HANDLE srcRangeStarts[kSetSize];
+			UINT srcRangeSizes[kSetSize];
+			D3D12_CPU_DESCRIPTOR_HANDLE dstHandle = m_pTableHeap->GetCPUDescriptorHandleForHeapStart();
+			const UINT dstRangeSize = kSetSize;
+			for (UINT set = 0; set < kSetCount; ++set, dstHandle.ptr += SIZE_T(kSetSize) * m_descriptorSize)
+			{
+				const UINT srcRangeCount = GatherDescriptorRanges(&m_descriptors[set * kSetSize], kSetSize, m_descriptorSize, srcRangeStarts, srcRangeSizes);
+				m_pD3D12Device->CopyDescriptors(1, &dstHandle, &dstRangeSize, srcRangeCount, srcRangeStarts, srcRangeSizes, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+			}
+		}
+
+		bool                                     m_bAdjacent;
+		ID3D12Device*                            m_pD3D12Device;
+		ID3D12DescriptorHeap*                    m_pSourceHeap;
+		ID3D12DescriptorHeap*                    m_pTableHeap;
+		UINT                                     m_descriptorSize;
+		std::vector<D3D12_CPU_DESCRIPTOR_HANDLE> m_descriptors;
+	};
+
+	struct SDescriptorSetsBenchmarkScattered : public SDescriptorSetsBenchmark
+	{
+		SDescriptorSetsBenchmarkScattered() : SDescriptorSetsBenchmark(false) {}
+	};
+
+	struct SDescriptorSetsBenchmarkAdjacent : public SDescriptorSetsBenchmark
+	{
+		SDescriptorSetsBenchmarkAdjacent() : SDescriptorSetsBenchmark(true) {}
+	};
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_DescriptorSetsScatteredOneByOne, SDescriptorSetsBenchmarkScattered)
+	{
+		if (IsValid())
+			CopySetsOneByOne();
+	}
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_DescriptorSetsScatteredRanges, SDescriptorSetsBenchmarkScattered)
+	{
+		if (IsValid())
+			CopySetsInRanges();
+	}
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_DescriptorSetsAdjacentOneByOne, SDescriptorSetsBenchmarkAdjacent)
+	{
+		if (IsValid())
+			CopySetsOneByOne();
+	}
+
+	CRY_UNIT_BENCHMARK_WITH_FIXTURE(BM_DescriptorSetsAdjacentRanges, SDescriptorSetsBenchmarkAdjacent)
+	{
+		if (IsValid())
+			CopySetsInRanges();
+	}
+}
+
+#endif // CRY_UNIT_TESTING
@@ -1230,6 +1230,7 @@ struct CDynamicDefragAllocator
 			pol.maxAllocs = ((policy) ? s_PoolConfig.m_pool_max_allocs : 1024);
 			pol.maxSegments = 256;
 			pol.blockSearchKind = bestFit ? IDefragAllocator::eBSK_BestFit : IDefragAllocator::eBSK_FirstFit;
+			pol.szName = "Device Buffer Pool";
 			m_defrag_allocator->Init(0, SPoolConfig::POOL_ALIGNMENT, pol);
 		}
 		return m_defrag_allocator != NULL;
@@ -508,7 +508,7 @@ bool DeviceInfo::CreateDevice(bool windowed, int width, int height, int backbuff
 						{
 							DXGIDevice* pDXGIDevice = 0;
 							if (SUCCEEDED(pDevice->QueryInterface(__uuidof(DXGIDevice), (void**) &pDXGIDevice)) && pDXGIDevice)
-								pDXGIDevice->SetMaximumFrameLatency(MAX_FRAME_LATENCY);
+								pDXGIDevice->SetMaximumFrameLatency(CRendererCVars::GetMaxFramesInFlight() - 1);
 							SAFE_RELEASE(pDXGIDevice);
 						}
 
@@ -638,7 +638,7 @@ bool DeviceInfo::CreateDevice(bool windowed, int width, int height, int backbuff
 #if (CRY_RENDERER_DIRECT3D >= 120)
 		if (m_swapChainDesc.Flags & DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT)
 		{
-			m_pSwapChain->SetMaximumFrameLatency(MAX_FRAME_LATENCY);
+			m_pSwapChain->SetMaximumFrameLatency(CRendererCVars::GetMaxFramesInFlight() - 1);
 		}
 #endif
 	}
@@ -241,6 +241,7 @@ bool CDurangoGPUMemoryManager::Init(size_t size, size_t bankSize, size_t reserve
 	pol.maxSegments = m_banks.capacity();
 	pol.pDefragPolicy = this;
 	pol.maxAllocs = 65535;
+	pol.szName = "GPU Texture Pool";
 	m_pAllocator->Init(bankSize, AllocAlign, pol);
 
 	reserveSize = max(reserveSize, bankSize);
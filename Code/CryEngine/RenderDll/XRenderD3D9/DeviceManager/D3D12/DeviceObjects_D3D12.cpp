@@ -348,25 +348,6 @@ bool CDeviceResourceSet_DX12::GatherDescriptors(
 	return true;
 }
 
-static const UINT DescriptorRangesOfOnes[256] = {
-	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-};
-
 void CDeviceResourceSet_DX12::FillDescriptorBlock(
 	StackDescriptorVector& descriptors,
 	CDescriptorBlock& descriptorBlock) const
@@ -377,17 +358,24 @@ void CDeviceResourceSet_DX12::FillDescriptorBlock(
 	if (!descriptors.empty())
 	{
 		D3D12_CPU_DESCRIPTOR_HANDLE dstHandle = descriptorBlock.GetHandleOffsetCPU(0);
+		const UINT descriptorSize = descriptorBlock.GetDescriptorSize();
 
-		// Deal with unbound number of descriptors in chunks of 256
-		for (UINT i = 0, srcSize = UINT(descriptors.size()), chunkSize = CRY_ARRAY_COUNT(DescriptorRangesOfOnes); i < srcSize; i += chunkSize)
+		// Deal with unbound number of descriptors in chunks of 256, adjacent source descriptors (constant buffer
+		// views created in the scratch space, views cached one after the other) are copied as one range
+		D3D12_CPU_DESCRIPTOR_HANDLE srcRangeStarts[256];
+		UINT srcRangeSizes[256];
+		for (UINT i = 0, srcSize = UINT(descriptors.size()), chunkSize = CRY_ARRAY_COUNT(srcRangeSizes); i < srcSize; i += chunkSize)
 		{
 			const UINT dstRangeCount = 1;
-			const UINT srcRangeCount = std::min(srcSize - i, chunkSize);
+			const UINT dstRangeSize = std::min(srcSize - i, chunkSize);
+			const UINT srcRangeCount = GatherDescriptorRanges(&descriptors[i], dstRangeSize, descriptorSize, srcRangeStarts, srcRangeSizes);
 
 			pDevice->CopyDescriptors(
-				dstRangeCount, &dstHandle, &srcRangeCount,
-				srcRangeCount, &descriptors[i], &DescriptorRangesOfOnes[0],
+				dstRangeCount, &dstHandle, &dstRangeSize,
+				srcRangeCount, srcRangeStarts, srcRangeSizes,
 				D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+
+			dstHandle.ptr += SIZE_T(dstRangeSize) * descriptorSize;
 		}
 	}
 }
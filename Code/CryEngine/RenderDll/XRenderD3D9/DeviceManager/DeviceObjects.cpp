@@ -71,11 +71,11 @@ void CDeviceObjectFactory::SyncToGPU()
 
 void CDeviceObjectFactory::IssueFrameFences()
 {
-	static_assert(CRY_ARRAY_COUNT(m_frameFences) == MAX_FRAMES_IN_FLIGHT, "Unexpected size for m_frameFences");
+	static_assert(CRY_ARRAY_COUNT(m_frameFences) == MAX_FRAMES_IN_FLIGHT_LIMIT, "Unexpected size for m_frameFences");
 
 	if (!m_frameFences[0])
 	{
-		m_frameFenceCounter = MAX_FRAMES_IN_FLIGHT;
+		m_frameFenceCounter = MAX_FRAMES_IN_FLIGHT_LIMIT;
 		for (uint32 i = 0; i < CRY_ARRAY_COUNT(m_frameFences); i++)
 		{
 			HRESULT hr = CreateFence(m_frameFences[i]);
@@ -84,17 +84,23 @@ void CDeviceObjectFactory::IssueFrameFences()
 		return;
 	}
 
-	HRESULT hr = IssueFence(m_frameFences[m_frameFenceCounter % MAX_FRAMES_IN_FLIGHT]);
+	// The ring always holds MAX_FRAMES_IN_FLIGHT_LIMIT fences, so r_MaxFramesInFlight can change between frames
+	const uint32 framesInFlight = CRendererCVars::GetMaxFramesInFlight();
+
+	HRESULT hr = IssueFence(m_frameFences[m_frameFenceCounter % MAX_FRAMES_IN_FLIGHT_LIMIT]);
 	assert(hr == S_OK);
 
 	if (CRenderer::CV_r_SyncToFrameFence)
 	{
-		// Stall render thread until GPU has finished processing previous frame (in case max frame latency is 1)
-		PROFILE_FRAME("WAIT FOR GPU");
-		HRESULT hr = SyncFence(m_frameFences[(m_frameFenceCounter - (MAX_FRAMES_IN_FLIGHT - 1)) % MAX_FRAMES_IN_FLIGHT], true, true);
+		// Stall render thread until GPU has finished processing the frame (framesInFlight - 1) frames back
+		CRY_PROFILE_REGION_WAITING(PROFILE_RENDERER, "Renderer:WAIT FOR GPU");
+
+		const CTimeValue timeWaitBegin = gEnv->pTimer->GetAsyncTime();
+		HRESULT hr = SyncFence(m_frameFences[(m_frameFenceCounter - (framesInFlight - 1)) % MAX_FRAMES_IN_FLIGHT_LIMIT], true, true);
 		assert(hr == S_OK);
+		gRenDev->m_fTimeWaitForGPU[gRenDev->m_RP.m_nProcessThreadID] += gEnv->pTimer->GetAsyncTime().GetDifferenceInSeconds(timeWaitBegin);
 	}
-	m_completedFrameFenceCounter = m_frameFenceCounter - (MAX_FRAMES_IN_FLIGHT - 1);
+	m_completedFrameFenceCounter = m_frameFenceCounter - (framesInFlight - 1);
 	m_frameFenceCounter += 1;
 }
 
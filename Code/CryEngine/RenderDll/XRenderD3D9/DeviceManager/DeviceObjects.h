@@ -1275,7 +1275,7 @@ private:
 
 	uint32 m_frameFenceCounter;
 	uint32 m_completedFrameFenceCounter;
-	DeviceFenceHandle m_frameFences[MAX_FRAMES_IN_FLIGHT];
+	DeviceFenceHandle m_frameFences[MAX_FRAMES_IN_FLIGHT_LIMIT];
 
 	////////////////////////////////////////////////////////////////////////////
 	// SamplerState API
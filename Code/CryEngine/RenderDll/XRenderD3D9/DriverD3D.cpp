@@ -1542,10 +1542,10 @@ void CD3D9Renderer::RT_BeginFrame()
 	//////////////////////////////////////////////////////////////////////
 
 #ifndef CONSOLE_CONST_CVAR_MODE
-	ICVar* pCVDebugTexelDensity = gEnv->pConsole->GetCVar("e_texeldensity");
-	ICVar* pCVDebugDraw = gEnv->pConsole->GetCVar("e_debugdraw");
-	CRendererCVars::CV_e_DebugTexelDensity = pCVDebugTexelDensity ? pCVDebugTexelDensity->GetIVal() : 0;
-	CRendererCVars::CV_e_DebugDraw = pCVDebugDraw ? pCVDebugDraw->GetIVal() : 0;
+	static CVarHandle<int> s_debugTexelDensity("e_texeldensity");
+	static CVarHandle<int> s_debugDraw("e_debugdraw");
+	CRendererCVars::CV_e_DebugTexelDensity = s_debugTexelDensity.Get();
+	CRendererCVars::CV_e_DebugDraw = s_debugDraw.Get();
 #endif
 
 	CheckDeviceLost();
@@ -3087,7 +3087,10 @@ void CD3D9Renderer::DebugDrawStats8()
 {
 #if !defined(_RELEASE) && defined(ENABLE_PROFILING_CODE)
 	ColorF col = Col_White;
-	IRenderAuxText::Draw2dLabel(30, 50, 1.2f, &col.r, false, "%d total instanced DIPs in %d batches", m_RP.m_PS[m_RP.m_nProcessThreadID].m_nInsts, m_RP.m_PS[m_RP.m_nProcessThreadID].m_nInstCalls);
+	const SPipeStat& stats = m_RP.m_PS[m_RP.m_nProcessThreadID];
+	IRenderAuxText::Draw2dLabel(30, 50, 1.2f, &col.r, false, "%d total instanced DIPs in %d batches", stats.m_nInsts, stats.m_nInstCalls);
+	IRenderAuxText::Draw2dLabel(30, 65, 1.2f, &col.r, false, "Static instancing: %d instances in %d draws (scene), %d instances in %d draws (shadow maps)",
+	                            stats.m_nStaticInsts[0], stats.m_nStaticInstCalls[0], stats.m_nStaticInsts[1], stats.m_nStaticInstCalls[1]);
 #endif
 }
 
@@ -3162,10 +3165,11 @@ void CD3D9Renderer::DebugDrawStats20()
 #if !defined(_RELEASE) && defined(ENABLE_PROFILING_CODE)
 	ColorF col = Col_Yellow;
 	IRenderAuxText::Draw2dLabel(30, 50, 1.5f, &col.r, false, "Compiled Render Objects");
-	IRenderAuxText::Draw2dLabel(30, 80, 1.5f, &col.r, false, "Objects: Modified: %-5d  Temporary: %-5d  Incomplete: %-5d",
+	IRenderAuxText::Draw2dLabel(30, 80, 1.5f, &col.r, false, "Objects: Modified: %-5d  Temporary: %-5d  Incomplete: %-5d  Instance data only: %-5d",
 	                            m_RP.m_PS[m_RP.m_nProcessThreadID].m_nModifiedCompiledObjects,
 	                            m_RP.m_PS[m_RP.m_nProcessThreadID].m_nTempCompiledObjects,
-	                            m_RP.m_PS[m_RP.m_nProcessThreadID].m_nIncompleteCompiledObjects);
+	                            m_RP.m_PS[m_RP.m_nProcessThreadID].m_nIncompleteCompiledObjects,
+	                            m_RP.m_PS[m_RP.m_nProcessThreadID].m_nInstanceDataCompiledObjects);
 	IRenderAuxText::Draw2dLabel(30, 110, 1.5f, &col.r, false, "State Changes: PSO [%d] PT [%d] L [%d] I [%d] RS [%d]",
 	                            m_RP.m_PS[m_RP.m_nProcessThreadID].m_nNumPSOSwitches,
 	                            m_RP.m_PS[m_RP.m_nProcessThreadID].m_nNumTopologySets,
@@ -6832,7 +6836,8 @@ bool CD3D9Renderer::EF_PrecacheResource(SShaderItem* pSI, float fMipFactorSI, fl
 				}
 				if (ITexture* pITex = pResTex->m_Sampler.m_pITex)
 				{
-					float fMipFactor = fMipFactorSI * min(fabsf(pResTex->GetTiling(0)), fabsf(pResTex->GetTiling(1)));
+					// mip factors scale with the texel area, the same way the streaming checks in the 3D engine apply the tiling
+					float fMipFactor = fMipFactorSI * fabsf(pResTex->GetTiling(0) * pResTex->GetTiling(1));
 					CD3D9Renderer::EF_PrecacheResource(pITex, fMipFactor, 0.f, Flags, nUpdateId, nCounter);
 				}
 			}
@@ -180,11 +180,28 @@ void CStorage::DebugDraw()
 	IRenderAuxText::Draw2dLabel(1, 20.0f, 2.0f, c1, false, "[Compute Skinning]");
 	IRenderAuxText::Draw2dLabel(1, 40.0f, 1.5f, c1, false, " Instances: %i, Total GPU memory for Instance Buffers: (%iKB)", m_perInstanceResources.size(), totalPerInstance / 1024);
 	IRenderAuxText::Draw2dLabel(1, 60.0f, 1.5f, c1, false, " Meshes: %i, Total GPU memory for Mesh Buffers: (%iKB)", m_perMeshResources.size(), totalPerMesh / 1024);
+	IRenderAuxText::Draw2dLabel(1, 80.0f, 1.5f, c1, false, " Instances sharing the pose of another one: %i", m_sharedOutputs.size());
+}
+
+void CStorage::SetSharedOutput(const void* pCustomTag, const void* pSourceCustomTag)
+{
+	CryAutoLock<CryCriticalSectionNonRecursive> lock(m_csInstance);
+	m_sharedOutputs[pCustomTag] = pSourceCustomTag;
+}
+
+void CStorage::ClearSharedOutputs()
+{
+	CryAutoLock<CryCriticalSectionNonRecursive> lock(m_csInstance);
+	m_sharedOutputs.clear();
 }
 
 CGpuBuffer* CStorage::GetOutputVertices(const void* pCustomTag)
 {
 	CryAutoLock<CryCriticalSectionNonRecursive> lock(m_csInstance);
+	auto itShared = m_sharedOutputs.find(pCustomTag);
+	if (itShared != m_sharedOutputs.end())
+		pCustomTag = itShared->second;
+
 	auto it = m_perInstanceResources.find(pCustomTag);
 	if (it != m_perInstanceResources.end())
 		return &it->second->verticesOut.GetBuffer();
@@ -236,12 +253,16 @@ void CComputeSkinningStage::DispatchComputeShaders(CRenderView* pRenderView)
 	bool bDoPreMorphs = cvar_gdMorphs && cvar_gdMorphs->GetIVal();
 	bool bDoTangents = cvar_gdTangents && cvar_gdTangents->GetIVal();
 
-	// TODO:/NOTE: possibly multi-threadable recording
 	auto& list = gcpRendD3D.GetComputeSkinningDataListRT();
+
+	m_storage.ClearSharedOutputs();
+	m_skinnedPoses.clear();
+
+	// all characters of the frame are recorded into a single command list, instead of acquiring and submitting one per character
+	SScopedComputeCommandList pComputeInterface(bAsynchronousCompute);
+
 	for (auto iter = list.begin(); iter != list.end(); ++iter)
 	{
-		SScopedComputeCommandList pComputeInterface(bAsynchronousCompute);
-
 		SSkinningData* pSD = *iter;
 		CRenderMesh* pRenderMesh = static_cast<CRenderMesh*>(pSD->pRenderMesh);
 
@@ -255,7 +276,11 @@ void CComputeSkinningStage::DispatchComputeShaders(CRenderView* pRenderView)
 			continue;
 		}
 
-		auto ir = m_storage.GetOrCreatePerInstanceResources(pSD->pCustomTag, mr->indicesIn.GetSize(), mr->indicesIn.GetSize() / 3);
+		const bool bUsesMorphs = bDoPreMorphs && (pSD->nHWSkinningFlags & eHWS_DC_Deformation_PreMorphs) && pRenderMesh->m_nMorphs && pSD->nNumActiveMorphs;
+		if (ShareIdenticalPose(pSD, bUsesMorphs))
+			continue;
+
+		auto ir = m_storage.GetOrCreatePerInstanceResources(pSD->pCustomTag, mr->verticesIn.GetSize(), mr->indicesIn.GetSize() / 3);
 
 		// bind output skinning
 		ir->passDeform.SetOutputUAV(0, &ir->verticesOut.GetBuffer());
@@ -354,3 +379,43 @@ void CComputeSkinningStage::DispatchComputeShaders(CRenderView* pRenderView)
 	if (cvar_gdDebugDraw && cvar_gdDebugDraw->GetIVal())
 		m_storage.DebugDraw();
 }
+
+bool CComputeSkinningStage::ShareIdenticalPose(SSkinningData* pSD, bool bUsesMorphs)
+{
+	static ICVar* cvar_gdSharePoses = gEnv->pConsole->GetCVar("r_ComputeSkinningSharePoses");
+	if (!cvar_gdSharePoses || !cvar_gdSharePoses->GetIVal() || bUsesMorphs)
+		return false;
+
+	// the bone transforms in the constant buffer are the ones of the character, not of the attachment
+	const SSkinningData* pPose = alias_cast<CD3D9Renderer::SCharacterInstanceCB*>(pSD->pCharInstCB)->m_pSD;
+	const uint32 tangentFlags = pSD->nHWSkinningFlags & eHWS_DC_Deformation_Tangents;
+
+	uint32 hash = CCrc32::Compute(pPose->pBoneQuatsS, pPose->nNumBones * sizeof(DualQuat));
+	hash = CCrc32::Compute(&pSD->pRenderMesh, sizeof(pSD->pRenderMesh), hash);
+	hash = CCrc32::Compute(&pSD->remapGUID, sizeof(pSD->remapGUID), hash);
+	hash = CCrc32::Compute(&tangentFlags, sizeof(tangentFlags), hash);
+
+	auto it = m_skinnedPoses.find(hash);
+	if (it == m_skinnedPoses.end())
+	{
+		m_skinnedPoses[hash] = pSD;
+		return false;
+	}
+
+	// a hash collision is skinned on its own
+	const SSkinningData* pSkinned = it->second;
+	const SSkinningData* pSkinnedPose = alias_cast<CD3D9Renderer::SCharacterInstanceCB*>(pSkinned->pCharInstCB)->m_pSD;
+	if (pSkinned->pRenderMesh != pSD->pRenderMesh ||
+	    pSkinned->remapGUID != pSD->remapGUID ||
+	    (pSkinned->nHWSkinningFlags & eHWS_DC_Deformation_Tangents) != tangentFlags ||
+	    pSkinnedPose->nNumBones != pPose->nNumBones ||
+	    memcmp(pSkinnedPose->pBoneQuatsS, pPose->pBoneQuatsS, pPose->nNumBones * sizeof(DualQuat)) != 0)
+	{
+		return false;
+	}
+
+	// the same attachment can be queued more than once per frame, it was skinned already
+	if (pSkinned->pCustomTag != pSD->pCustomTag)
+		m_storage.SetSharedOutput(pSD->pCustomTag, pSkinned->pCustomTag);
+	return true;
+}
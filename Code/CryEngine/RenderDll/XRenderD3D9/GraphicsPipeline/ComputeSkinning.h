@@ -131,6 +131,8 @@ public:
 	void                                   RetirePerInstanceResources();
 	std::shared_ptr<SPerMeshResources>     GetPerMeshResources(CRenderMesh* pMesh);
 	std::shared_ptr<SPerInstanceResources> GetOrCreatePerInstanceResources(const void* pCustomTag, const int numVertices, const int numTriangles);
+	void                                   SetSharedOutput(const void* pCustomTag, const void* pSourceCustomTag);
+	void                                   ClearSharedOutputs();
 	void                                   DebugDraw();
 
 private:
@@ -139,6 +141,8 @@ private:
 	// this is addressed with the pCustomTag, identifying the Skin Attachment
 	// this is only accessed through the render thread, so a lock shouldn't be necessary
 	std::unordered_map<const void*, std::shared_ptr<SPerInstanceResources>> m_perInstanceResources;
+	// instances that were not skinned this frame, because another instance had the same mesh and pose, mapped to that instance
+	std::unordered_map<const void*, const void*>                            m_sharedOutputs;
 
 	CryCriticalSectionNonRecursive m_csMesh;
 	CryCriticalSectionNonRecursive m_csInstance;
@@ -159,6 +163,10 @@ public:
 private:
 	void                                       DispatchComputeShaders(CRenderView* pRenderView);
 	void                                       SetupDeformPass();
+	bool                                       ShareIdenticalPose(SSkinningData* pSD, bool bUsesMorphs);
+
+	// poses skinned this frame, by a hash of mesh and bones
+	std::unordered_map<uint32, SSkinningData*> m_skinnedPoses;
 
 	compute_skinning::CStorage m_storage;
 	int32                      m_oldFrameIdExecute = -1;
@@ -586,7 +586,10 @@ void CShadowMapStage::PrepareOutputsForFrustumWithCaching(const ShadowMapFrustum
 			pDepthTarget = CTexture::s_ptexHeightMapAODepth[0];
 		}
 
-		clearMode = frustum.bIncrementalUpdate ? CShadowMapPass::eClearMode_None : CShadowMapPass::eClearMode_Fill;
+		if (!frustum.bIncrementalUpdate)
+			clearMode = CShadowMapPass::eClearMode_Fill;
+		else
+			clearMode = frustum.dirtyRegions.empty() ? CShadowMapPass::eClearMode_None : CShadowMapPass::eClearMode_FillRect;
 	}
 	else if (frustum.m_eFrustumType == ShadowMapFrustum::eFrustumType::e_GsmDynamicDistance)
 	{
@@ -887,6 +890,45 @@ void CShadowMapStage::CopyShadowMap(const CShadowMapPass& sourcePass, CShadowMap
 	pDst->fDepthBiasClamp = pSrc->fDepthBiasClamp;
 }
 
+void CShadowMapStage::GetDirtyRegionRects(const CShadowMapPass& cachedPass, std::vector<D3DRectangle>& rects) const
+{
+	const ShadowMapFrustum& frustum = *cachedPass.m_pFrustumToRender->pFrustum;
+	const CTexture* pDepthTarget = cachedPass.GetPassDesc().GetDepthTarget().pTexture;
+
+	const int width = pDepthTarget->GetWidth();
+	const int height = pDepthTarget->GetHeight();
+	const int tileSize = ShadowMapFrustum::ShadowCacheData::DIRTY_REGION_TILE_SIZE;
+
+	for (const AABB& region : frustum.dirtyRegions)
+	{
+		Vec2 minUV(std::numeric_limits<float>::max());
+		Vec2 maxUV(-std::numeric_limits<float>::max());
+
+		for (int i = 0; i < 8; ++i)
+		{
+			const Vec3 corner((i & 1) ? region.max.x : region.min.x, (i & 2) ? region.max.y : region.min.y, (i & 4) ? region.max.z : region.min.z);
+			const Vec4 clipPos = Vec4(corner, 1.0f) * cachedPass.m_ViewProjMatrix;
+			const float invW = 1.0f / max(clipPos.w, FLT_EPSILON);
+			const Vec2 uv(clipPos.x * invW * 0.5f + 0.5f, 0.5f - clipPos.y * invW * 0.5f);
+
+			minUV.x = min(minUV.x, uv.x);
+			minUV.y = min(minUV.y, uv.y);
+			maxUV.x = max(maxUV.x, uv.x);
+			maxUV.y = max(maxUV.y, uv.y);
+		}
+
+		// snap outwards to whole tiles, the 3d engine re-renders all casters touching these tiles
+		D3DRectangle rect;
+		rect.left   = clamp_tpl(int(floorf(minUV.x * width  / tileSize)) * tileSize, 0, width);
+		rect.top    = clamp_tpl(int(floorf(minUV.y * height / tileSize)) * tileSize, 0, height);
+		rect.right  = clamp_tpl(int(ceilf (maxUV.x * width  / tileSize)) * tileSize, 0, width);
+		rect.bottom = clamp_tpl(int(ceilf (maxUV.y * height / tileSize)) * tileSize, 0, height);
+
+		if (rect.right > rect.left && rect.bottom > rect.top)
+			rects.push_back(rect);
+	}
+}
+
 void CShadowMapStage::ClearShadowMaps(PassGroupList& shadowMapPasses)
 {
 	CDeviceCommandListRef commandList = GetDeviceObjectFactory().GetCoreCommandList();
@@ -932,6 +974,31 @@ void CShadowMapStage::ClearShadowMaps(PassGroupList& shadowMapPasses)
 
 	}
 
+	// clear the regions of cached shadow maps which get re-rendered by an incremental update
+	{
+		std::vector<D3DRectangle> clearDepthRects;
+		uint32 nCachedMapIndex = 0;
+
+		for (auto& cachedPass : shadowMapPasses[ePass_DirectionalLightCached])
+		{
+			if (cachedPass.m_clearMode != CShadowMapPass::eClearMode_FillRect)
+				continue;
+
+			CRY_ASSERT(nCachedMapIndex < m_ClearCachedShadowMapRegionPasses.size());
+			if (nCachedMapIndex >= m_ClearCachedShadowMapRegionPasses.size())
+				break;
+
+			clearDepthRects.clear();
+			GetDirtyRegionRects(cachedPass, clearDepthRects);
+
+			if (!clearDepthRects.empty())
+			{
+				CTexture* pDepthTarget = cachedPass.GetPassDesc().GetDepthTarget().pTexture;
+				m_ClearCachedShadowMapRegionPasses[nCachedMapIndex++].Execute(pDepthTarget, CLEAR_ZBUFFER, 1.0f, 0, clearDepthRects.size(), clearDepthRects.data());
+			}
+		}
+	}
+
 	// clear remaining depth maps and prepare all passes for use
 	for (auto& passGroup : shadowMapPasses)
 	{
@@ -130,6 +130,7 @@ private:
 	void UpdateShadowFrustumFromPass(const CShadowMapPass& sourcePass, ShadowMapFrustum& targetFrustum) const;
 	void CopyShadowMap(const CShadowMapPass& sourcePass, CShadowMapPass& targetPass);
 	void ClearShadowMaps(PassGroupList& shadowMapPasses);
+	void GetDirtyRegionRects(const CShadowMapPass& cachedPass, std::vector<D3DRectangle>& rects) const;
 
 	ETEX_Format GetShadowTexFormat(EPass passID) const;
 
@@ -143,6 +144,7 @@ private:
 	CClearRegionPass         m_ClearShadowPoolDepthPass;
 	CClearRegionPass         m_ClearShadowPoolColorPass;
 	CClearRegionPass         m_ClearShadowPoolNormalsPass;
+	std::array<CClearRegionPass, MAX_GSM_LODS_NUM> m_ClearCachedShadowMapRegionPasses;
 	CDeviceResourceLayoutPtr m_pResourceLayout;
 	CDeviceResourceSetDesc   m_perPassResources;
 };
@@ -57,13 +57,13 @@ enum EStandardGraphicsPipelineStage
 	eStage_GpuParticles,
 	eStage_TiledShading,
 	eStage_VolumetricClouds,
+	eStage_VolumetricFog,
 
 	// Regular stages
 	eStage_HeightMapAO,
 	eStage_ScreenSpaceObscurance,
 	eStage_ScreenSpaceReflections,
 	eStage_ScreenSpaceSSS,
-	eStage_VolumetricFog,
 	eStage_Fog,
 	eStage_WaterRipples,
 	eStage_Water,
@@ -637,13 +637,20 @@ void CVolumetricFogStage::Execute()
 
 	RenderDownscaledShadowmap(pRenderView);
 
-	const bool bAsyncronous = false;
-	SScopedComputeCommandList commandList(bAsyncronous);
-
 	PrepareLightList(pRenderView);
-	BuildLightListGrid(commandList);
 
-	RenderDownscaledDepth(commandList);
+	{
+		// Light binning and depth downscaling only consume data produced earlier in the frame and are pure compute,
+		// the remaining passes interleave with graphics work and stay on the core command-list
+		const bool bAsynchronousCompute = CRenderer::CV_r_D3D12AsynchronousCompute & BIT((eStage_VolumetricFog - eStage_FIRST_ASYNC_COMPUTE)) ? true : false;
+		SScopedComputeCommandList computeCommandList(bAsynchronousCompute);
+
+		BuildLightListGrid(computeCommandList);
+
+		RenderDownscaledDepth(computeCommandList);
+	}
+
+	SScopedComputeCommandList commandList(false);
 
 	InjectParticipatingMedia(pRenderView, commandList);
 
@@ -1328,7 +1335,8 @@ void CVolumetricFogStage::PrepareLightList(CRenderView* pRenderView)
 					Vec3 coneTip = Vec3(lightCullInfo.posRad.x, lightCullInfo.posRad.y, lightCullInfo.posRad.z);
 					Vec3 coneDir = Vec3(-lightCullInfo.volumeParams0.x, -lightCullInfo.volumeParams0.y, -lightCullInfo.volumeParams0.z);
 					AABB coneBounds = AABB::CreateAABBfromCone(Cone(coneTip, coneDir, renderLight.m_fRadius, lightCullInfo.volumeParams0.w));
-					lightCullInfo.depthBounds = Vec2(coneBounds.min.z, coneBounds.max.z);
+					// the light doesn't reach past its radius, clip the bounds of the cone's base to it
+					lightCullInfo.depthBounds = Vec2(max(coneBounds.min.z, coneTip.z - renderLight.m_fRadius), min(coneBounds.max.z, coneTip.z + renderLight.m_fRadius));
 
 					Matrix44A projMatT;
 					CShadowUtils::GetProjectiveTexGen(&renderLight, 0, &projMatT);
@@ -1431,7 +1439,7 @@ void CVolumetricFogStage::PrepareLightList(CRenderView* pRenderView)
 							Vec3 coneTip = Vec3(lightCullInfo.posRad.x, lightCullInfo.posRad.y, lightCullInfo.posRad.z);
 							Vec3 coneDir = Vec3(-spotParamsVS.x, -spotParamsVS.y, -spotParamsVS.z);
 							AABB coneBounds = AABB::CreateAABBfromCone(Cone(coneTip, coneDir, renderLight.m_fRadius, spotParamsVS.w));
-							Vec2 depthBoundsVS = Vec2(coneBounds.min.z, coneBounds.max.z);
+							Vec2 depthBoundsVS = Vec2(max(coneBounds.min.z, coneTip.z - renderLight.m_fRadius), min(coneBounds.max.z, coneTip.z + renderLight.m_fRadius));
 							Vec2 sideShadowParams = (firstFrustum.nShadowGenMask & (1 << side)) ? shadowParams : Vec2(ZERO);
 
 							if (side == 0)
@@ -77,6 +77,7 @@ void CRenderPipelineProfiler::EndFrame()
 	UpdateGPUTimes(prevFrameIndex);
 	UpdateBasicStats(prevFrameIndex);
 	UpdateThreadTimings();
+	AddToTraceCapture(prevFrameIndex);
 
 	m_recordData = false;
 
@@ -265,6 +266,38 @@ void CRenderPipelineProfiler::UpdateGPUTimes(uint32 frameDataIndex)
 	}
 }
 
+void CRenderPipelineProfiler::AddToTraceCapture(uint32 frameDataIndex)
+{
+	JobManager::IJobManager* pJobManager = gEnv->GetJobManager();
+	if (!pJobManager->IsTraceCaptureRunning())
+		return;
+
+	const SFrameData& frameData = m_frameData[frameDataIndex];
+	if (frameData.m_numSections == 0 || frameData.m_sections[0].startTimestamp == ~0u)
+		return;
+
+	// GPU and CPU clocks are not correlated, the GPU track starts each frame at the CPU time its first timestamp was issued.
+	// Durations and the placement of passes within a frame are exact, the offset to the CPU tracks is not.
+	const SProfilerSection& frameSection = frameData.m_sections[0];
+
+	for (uint32 i = 0; i < frameData.m_numSections; ++i)
+	{
+		const SProfilerSection& section = frameData.m_sections[i];
+		if (section.recLevel < 0)
+			continue;
+
+		if (!(section.flags & eProfileSectionFlags_MultithreadedSection))
+			pJobManager->AddTraceEvent("Render Pipeline CPU", section.name, "render", section.startTimeCPU, section.endTimeCPU);
+
+		if (section.startTimestamp != ~0u && section.endTimestamp != ~0u)
+		{
+			const float startOffsetMS = frameData.m_timestampGroup.GetTimeMS(frameSection.startTimestamp, section.startTimestamp);
+			const CTimeValue gpuStart = frameSection.startTimeCPU + CTimeValue(startOffsetMS * 0.001f);
+			pJobManager->AddTraceEvent("Render Pipeline GPU", section.name, "gpu", gpuStart, gpuStart + CTimeValue(section.gpuTime * 0.001f));
+		}
+	}
+}
+
 void CRenderPipelineProfiler::UpdateThreadTimings()
 {
 	const float weight = 8.0f / 9.0f;
@@ -798,5 +831,5 @@ void CRenderPipelineProfiler::DisplayOverviewStats()
 
 bool CRenderPipelineProfiler::IsEnabled()
 {
-	return m_enabled || CRenderer::CV_r_profiler || gcpRendD3D->m_CVDisplayInfo->GetIVal() == 3;
+	return m_enabled || CRenderer::CV_r_profiler || gcpRendD3D->m_CVDisplayInfo->GetIVal() == 3 || gEnv->GetJobManager()->IsTraceCaptureRunning();
 }
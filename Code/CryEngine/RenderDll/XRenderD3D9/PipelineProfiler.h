@@ -104,12 +104,13 @@ protected:
 	void AddToStats(RPProfilerStats& outStats, SProfilerSection& section);
 	void SubtractFromStats(RPProfilerStats& outStats, SProfilerSection& section);
 	void UpdateBasicStats(uint32 frameDataIndex);
+	void AddToTraceCapture(uint32 frameDataIndex);
 
 	void DisplayOverviewStats();
 	void DisplayDetailedPassStats(uint32 frameDataIndex);
 
 protected:
-	enum { kNumPendingFrames = MAX_FRAMES_IN_FLIGHT + 1 };
+	enum { kNumPendingFrames = MAX_FRAMES_IN_FLIGHT_LIMIT + 1 };
 
 	std::vector<uint32> m_stack;
 	SFrameData          m_frameData[kNumPendingFrames];
@@ -9,6 +9,8 @@ namespace NCryVulkan
 
 static int g_cvar_vk_heap_summary;
 
+static const char* const kPipelineCacheFile = "%USER%/Shaders/Cache/VulkanPipelineCache.bin";
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 _smart_ptr<CDevice> CDevice::Create(const SPhysicalDeviceInfo* pDeviceInfo, VkAllocationCallbacks* hostAllocator, VkSurfaceKHR Surface, const std::vector<const char*>& layersToEnable, const std::vector<const char*>& extensionsToEnable)
@@ -134,6 +136,8 @@ CDevice::CDevice(const SPhysicalDeviceInfo* pDeviceInfo, VkAllocationCallbacks*
 	if (!m_occlusionQueries.Init(GetVkDevice()))
 		CRY_ASSERT_MESSAGE(false, "Failed to initialize occlusion queries");
 
+	InitPipelineCache();
+
 	m_Scheduler.BeginScheduling();
 }
 
@@ -146,12 +150,81 @@ CDevice::~CDevice()
 		TickDestruction();
 	}
 
+	if (m_pipelineCache != VK_NULL_HANDLE)
+	{
+		SavePipelineCache();
+		vkDestroyPipelineCache(m_device, m_pipelineCache, nullptr);
+	}
+
 	if (m_device != VK_NULL_HANDLE)
 	{
 		vkDestroyDevice(m_device, &m_Allocator);
 	}
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+void CDevice::InitPipelineCache()
+{
+	// Seed the pipeline cache with the data saved by the previous session, so pipelines seen before don't have to be compiled from scratch
+	std::vector<uint8> initialData;
+	if (FILE* pFile = gEnv->pCryPak->FOpen(kPipelineCacheFile, "rb"))
+	{
+		initialData.resize(gEnv->pCryPak->FGetSize(pFile));
+		if (gEnv->pCryPak->FReadRaw(initialData.data(), 1, initialData.size(), pFile) != initialData.size())
+			initialData.clear();
+		gEnv->pCryPak->FClose(pFile);
+	}
+
+	// The data is only valid for the exact same device and driver; drivers are supposed to reject foreign data but not all of them do
+	const VkPhysicalDeviceProperties& properties = m_pDeviceInfo->deviceProperties;
+	const size_t headerSize = 16 + VK_UUID_SIZE;
+	if (initialData.size() >= headerSize)
+	{
+		uint32 header[4];
+		memcpy(header, initialData.data(), sizeof(header));
+
+		if (header[0] < headerSize || header[1] != VK_PIPELINE_CACHE_HEADER_VERSION_ONE ||
+		    header[2] != properties.vendorID || header[3] != properties.deviceID ||
+		    memcmp(initialData.data() + 16, properties.pipelineCacheUUID, VK_UUID_SIZE) != 0)
+		{
+			CryLog("Discarding Vulkan pipeline cache from a different device or driver");
+			initialData.clear();
+		}
+	}
+	else
+	{
+		initialData.clear();
+	}
+
+	VkPipelineCacheCreateInfo pipelineCacheCreateInfo = {};
+	pipelineCacheCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+	pipelineCacheCreateInfo.initialDataSize = initialData.size();
+	pipelineCacheCreateInfo.pInitialData = initialData.empty() ? nullptr : initialData.data();
+
+	if (vkCreatePipelineCache(m_device, &pipelineCacheCreateInfo, nullptr, &m_pipelineCache) != VK_SUCCESS)
+	{
+		// Pipelines are still created without a cache, just slower
+		m_pipelineCache = VK_NULL_HANDLE;
+	}
+}
+
+void CDevice::SavePipelineCache()
+{
+	size_t dataSize = 0;
+	if (vkGetPipelineCacheData(m_device, m_pipelineCache, &dataSize, nullptr) != VK_SUCCESS || dataSize == 0)
+		return;
+
+	std::vector<uint8> data(dataSize);
+	if (vkGetPipelineCacheData(m_device, m_pipelineCache, &dataSize, data.data()) != VK_SUCCESS)
+		return;
+
+	if (FILE* pFile = gEnv->pCryPak->FOpen(kPipelineCacheFile, "wb"))
+	{
+		gEnv->pCryPak->FWrite(data.data(), 1, dataSize, pFile);
+		gEnv->pCryPak->FClose(pFile);
+	}
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void CDevice::DeferDestruction(CBufferView&& view)
 {
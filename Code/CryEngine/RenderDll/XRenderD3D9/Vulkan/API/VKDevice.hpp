@@ -94,6 +94,9 @@ public:
 	void FlushAndWaitForGPU();
 
 private:
+	void InitPipelineCache();
+	void SavePipelineCache();
+
 	const SPhysicalDeviceInfo* m_pDeviceInfo;
 	VkAllocationCallbacks m_Allocator;
 	VkSurfaceKHR m_surface;
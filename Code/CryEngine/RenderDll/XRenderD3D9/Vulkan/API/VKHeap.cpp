@@ -94,6 +94,11 @@ void NCryVulkan::CHeap::Init(VkPhysicalDevice physicalDevice, VkDevice device)
 	vkGetPhysicalDeviceMemoryProperties(physicalDevice, &m_heapProperties);
 	m_device = device;
 
+	VkPhysicalDeviceProperties deviceProperties;
+	vkGetPhysicalDeviceProperties(physicalDevice, &deviceProperties);
+	m_maxBlocks = deviceProperties.limits.maxMemoryAllocationCount;
+	m_numBlocks = 0;
+
 	// Collect largest heap information
 	VkDeviceSize largestDeviceHeap = -1;
 	VkDeviceSize largestHostHeap = -1;
@@ -386,6 +391,7 @@ void NCryVulkan::CHeap::LogHeapSummary() const
 		}
 	}
 	CryLog("Vulkan total GPU committed %s, allocated %s", FormatSize(buffer[0], gpuCommitted), FormatSize(buffer[1], gpuAllocated));
+	CryLog("Vulkan device memory allocations %d of %u allowed", m_numBlocks, m_maxBlocks);
 }
 
 NCryVulkan::CMemoryHandle NCryVulkan::CHeap::Allocate(const VkMemoryRequirements& requirements, EHeapType heapHint)
@@ -448,6 +454,14 @@ NCryVulkan::CHeap::TBlockHandle NCryVulkan::CHeap::AllocateBlock(uint32_t memory
 	VK_ASSERT(blockHandle < m_blocks.size() && "Bad block handle");
 	m_blockProbe = blockHandle;
 
+	// Exceeding the driver's allocation count limit is an error, and with the sub-allocator in front it means
+	// the pages are fragmented badly or the heap is leaking, so report it instead of calling into the driver.
+	if (static_cast<uint32_t>(m_numBlocks) >= m_maxBlocks)
+	{
+		CryWarning(VALIDATOR_MODULE_RENDERER, VALIDATOR_ERROR, "Vulkan: maxMemoryAllocationCount (%u) reached, cannot allocate %u bytes of memory type %u", m_maxBlocks, bytes, memoryType);
+		return 0;
+	}
+
 	VkMemoryAllocateInfo info;
 	info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
 	info.pNext = nullptr;
@@ -457,6 +471,7 @@ NCryVulkan::CHeap::TBlockHandle NCryVulkan::CHeap::AllocateBlock(uint32_t memory
 	VkDeviceMemory block;
 	if (vkAllocateMemory(m_device, &info, nullptr, &block) == VK_SUCCESS)
 	{
+		CryInterlockedIncrement(&m_numBlocks);
 		m_blocks[blockHandle] = block;
 		return blockHandle + 1;
 	}
@@ -469,6 +484,7 @@ void NCryVulkan::CHeap::DeallocateBlock(uint32_t memoryType, TBlockHandle blockH
 	VkDeviceMemory block = m_blocks[blockHandle - 1];
 	m_blocks[blockHandle - 1] = 0;
 	vkFreeMemory(m_device, block, nullptr);
+	CryInterlockedDecrement(&m_numBlocks);
 }
 
 void* NCryVulkan::CHeap::MapBlock(uint32_t memoryType, TBlockHandle blockHandle)
@@ -184,6 +184,8 @@ private:
 	VkDevice                         m_device;
 	std::vector<VkDeviceMemory>      m_blocks;
 	TBlockHandle                     m_blockProbe;
+	volatile int                     m_numBlocks;     // Live vkAllocateMemory allocations
+	uint32_t                         m_maxBlocks;     // VkPhysicalDeviceLimits::maxMemoryAllocationCount
 };
 
 }
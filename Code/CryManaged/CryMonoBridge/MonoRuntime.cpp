@@ -23,6 +23,7 @@
 
 #include "NativeToManagedInterfaces/IMonoNativeToManagedInterface.h"
 #include <CryInput/IHardwareMouse.h>
+#include <CryRenderer/IRenderAuxGeom.h>
 
 // Must be included only once in DLL module.
 #include <CryCore/Platform/platform_impl.inl>
@@ -73,6 +74,9 @@ CMonoRuntime::CMonoRuntime()
 	, m_pRootDomain(nullptr)
 	, m_pPluginDomain(nullptr)
 	, m_listeners(5)
+	, m_profileInvokes(0)
+	, m_numInvokes(0)
+	, m_invokeTimeMs(0.0f)
 {
 }
 
@@ -160,6 +164,7 @@ bool CMonoRuntime::Initialize(SSystemGlobalEnvironment& env, const SSystemInitPa
 	gEnv->pConsole->RegisterListener(this, "MonoRuntime::ManagedConsoleCommandListener");
 
 	REGISTER_COMMAND("mono_reload", OnReloadRequested, VF_NULL, "Used to reload all mono plug-ins");
+	REGISTER_CVAR2("mono_profileInvokes", &m_profileInvokes, 0, VF_NULL, "Displays the number and cost of native to managed method invocations per frame");
 
 	CryLog("[Mono] Initialization done.");
 	return true;
@@ -167,6 +172,8 @@ bool CMonoRuntime::Initialize(SSystemGlobalEnvironment& env, const SSystemInitPa
 
 void CMonoRuntime::Shutdown()
 {
+	gEnv->pConsole->UnregisterVariable("mono_profileInvokes", true);
+
 	if (m_pLibCore != nullptr)
 	{
 		// Get the equivalent of gEnv
@@ -197,6 +204,13 @@ void CMonoRuntime::Update(int updateFlags, int nPauseMode)
 	{
 		notifier->OnUpdate(updateFlags, nPauseMode);
 	}
+
+	if (m_profileInvokes != 0)
+	{
+		IRenderAuxText::Draw2dLabel(10, 10, 1.5f, Col_White, false, "[Mono] Managed invokes: %u (%.3f ms)", m_numInvokes, m_invokeTimeMs);
+	}
+	m_numInvokes = 0;
+	m_invokeTimeMs = 0.0f;
 }
 
 void CMonoRuntime::MonoLogCallback(const char* szLogDomain, const char* szLogLevel, const char* szMessage, MonoInternals::mono_bool is_fatal, void* pUserData)
@@ -131,6 +131,10 @@ public:
 
 	void         HandleException(MonoInternals::MonoException* pException);
 
+	// Native to managed invoke statistics, only gathered while mono_profileInvokes is set
+	bool         IsProfilingInvokes() const       { return m_profileInvokes != 0; }
+	void         AddInvokeCost(float timeMs)      { ++m_numInvokes; m_invokeTimeMs += timeMs; }
+
 private:
 	static void MonoLogCallback(const char* szLogDomain, const char* szLogLevel, const char* szMessage, MonoInternals::mono_bool is_fatal, void* pUserData);
 	static void MonoPrintCallback(const char* szMessage, MonoInternals::mono_bool is_stdout);
@@ -155,6 +159,10 @@ private:
 	CMonoLibrary*            m_pLibCore;
 
 	MonoListeners            m_listeners;
+
+	int                      m_profileInvokes;
+	uint32                   m_numInvokes;
+	float                    m_invokeTimeMs;
 };
 
 inline static CMonoRuntime* GetMonoRuntime()
@@ -225,6 +225,65 @@ static void SendComponentSignal(IEntity* pEntity, uint64 guidHipart, uint64 guid
 	}
 }
 
+// Batched transform access, managed code passes pinned spans of entity pointers and blittable math types
+// so a whole set of entities costs a single transition instead of one per entity.
+static void GetWorldTransforms(IEntity** ppEntities, Matrix34* pTransformsOut, int count)
+{
+	for (int i = 0; i < count; ++i)
+	{
+		pTransformsOut[i] = ppEntities[i] != nullptr ? ppEntities[i]->GetWorldTM() : Matrix34(IDENTITY);
+	}
+}
+
+static void SetWorldTransforms(IEntity** ppEntities, const Matrix34* pTransforms, int count)
+{
+	for (int i = 0; i < count; ++i)
+	{
+		if (ppEntities[i] != nullptr)
+		{
+			ppEntities[i]->SetWorldTM(pTransforms[i]);
+		}
+	}
+}
+
+static void GetWorldPositions(IEntity** ppEntities, Vec3* pPositionsOut, int count)
+{
+	for (int i = 0; i < count; ++i)
+	{
+		pPositionsOut[i] = ppEntities[i] != nullptr ? ppEntities[i]->GetWorldPos() : ZERO;
+	}
+}
+
+static void SetPositions(IEntity** ppEntities, const Vec3* pPositions, int count)
+{
+	for (int i = 0; i < count; ++i)
+	{
+		if (ppEntities[i] != nullptr)
+		{
+			ppEntities[i]->SetPos(pPositions[i]);
+		}
+	}
+}
+
+static void GetWorldRotations(IEntity** ppEntities, Quat* pRotationsOut, int count)
+{
+	for (int i = 0; i < count; ++i)
+	{
+		pRotationsOut[i] = ppEntities[i] != nullptr ? ppEntities[i]->GetWorldRotation() : Quat(IDENTITY);
+	}
+}
+
+static void SetRotations(IEntity** ppEntities, const Quat* pRotations, int count)
+{
+	for (int i = 0; i < count; ++i)
+	{
+		if (ppEntities[i] != nullptr)
+		{
+			ppEntities[i]->SetRotation(pRotations[i]);
+		}
+	}
+}
+
 void CManagedEntityInterface::RegisterFunctions(std::function<void(const void* pMethod, const char* methodName)> func)
 {
 	func(RegisterComponent, "RegisterComponent");
@@ -239,4 +298,10 @@ void CManagedEntityInterface::RegisterFunctions(std::function<void(const void* p
 	func(RegisterComponentSignal, "RegisterComponentSignal");
 	func(AddComponentSignalParameter, "AddComponentSignalParameter");
 	func(SendComponentSignal, "SendComponentSignal");
+	func(GetWorldTransforms, "GetWorldTransforms");
+	func(SetWorldTransforms, "SetWorldTransforms");
+	func(GetWorldPositions, "GetWorldPositions");
+	func(SetPositions, "SetPositions");
+	func(GetWorldRotations, "GetWorldRotations");
+	func(SetRotations, "SetRotations");
 }
\ No newline at end of file
@@ -26,7 +26,17 @@ std::shared_ptr<CMonoObject> CMonoMethod::InvokeInternal(MonoInternals::MonoObje
 {
 	MonoInternals::MonoObject* pException = nullptr;
 
+	CMonoRuntime* pRuntime = GetMonoRuntime();
+	const bool bProfile = pRuntime->IsProfilingInvokes();
+	const CTimeValue startTime = bProfile ? gEnv->pTimer->GetAsyncTime() : CTimeValue();
+
 	MonoInternals::MonoObject* pResult = MonoInternals::mono_runtime_invoke(m_pMethod, pMonoObject, pParameters, &pException);
+
+	if (bProfile)
+	{
+		pRuntime->AddInvokeCost((gEnv->pTimer->GetAsyncTime() - startTime).GetMilliSeconds());
+	}
+
 	bEncounteredException = pException != nullptr;
 
 	if (!bEncounteredException)
@@ -53,7 +63,17 @@ std::shared_ptr<CMonoObject> CMonoMethod::InvokeInternal(MonoInternals::MonoObje
 {
 	MonoInternals::MonoObject* pException = nullptr;
 
+	CMonoRuntime* pRuntime = GetMonoRuntime();
+	const bool bProfile = pRuntime->IsProfilingInvokes();
+	const CTimeValue startTime = bProfile ? gEnv->pTimer->GetAsyncTime() : CTimeValue();
+
 	MonoInternals::MonoObject* pResult = MonoInternals::mono_runtime_invoke_array(m_pMethod, pMonoObject, pParameters, &pException);
+
+	if (bProfile)
+	{
+		pRuntime->AddInvokeCost((gEnv->pTimer->GetAsyncTime() - startTime).GetMilliSeconds());
+	}
+
 	bEncounteredException = pException != nullptr;
 
 	if (!bEncounteredException)
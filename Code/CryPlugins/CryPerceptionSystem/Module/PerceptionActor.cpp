@@ -21,7 +21,8 @@ CPerceptionActor::CPerceptionActor(IAIActor* pAIActor) :
 	m_pAIActor(pAIActor),
 	m_closeContactTimeOut(0.0f),
 	m_meleeRange(2.0f),
-	m_perceptionDisabled(0)
+	m_perceptionDisabled(0),
+	m_reducedUpdateCounter(pAIActor ? pAIActor->CastToIAIObject()->GetAIObjectID() : 0)
 {}
 
 //-----------------------------------------------------------------------------------------------------------
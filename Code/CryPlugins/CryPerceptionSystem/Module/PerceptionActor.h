@@ -26,6 +26,9 @@ public:
 
 	void SetMeleeRange(float meleeRange) { m_meleeRange = meleeRange; }
 
+	// Returns true once every 'interval' calls. Used to throttle visibility checks of low importance actors.
+	bool TickReducedUpdate(uint32 interval) { return (++m_reducedUpdateCounter % interval) == 0; }
+
 private:
 	IAIActor* m_pAIActor;
 
@@ -33,4 +36,6 @@ private:
 
 	float m_meleeRange;
 	float m_closeContactTimeOut; // used to prevent the signal OnCloseContact being sent repeatedly to same object
+
+	uint32 m_reducedUpdateCounter; // seeded from the object id so throttled actors are spread across frames
 };
\ No newline at end of file
@@ -354,10 +354,16 @@ void CPerceptionManager::ActorUpdate(IAIObject* pAIObject, IAIObject::EUpdateTyp
 
 	perceptionActor->Update(frameDelta);
 
-	GatherProbableTargetsForActor(pAIActor);
-
 	const Vec3& actorPos = pAIObject->GetPos();
 
+	if (!IsVisibilityUpdateDue(*perceptionActor, pAIActor, actorPos))
+	{
+		m_stats.trackers[PERFTRACK_SKIPPED_UPDATES].Inc();
+		return;
+	}
+
+	GatherProbableTargetsForActor(pAIActor);
+
 	{
 		FRAME_PROFILER("AIPlayerVisibilityCheck", gEnv->pSystem, PROFILE_AI);
 
@@ -454,6 +460,24 @@ void CPerceptionManager::ActorUpdate(IAIObject* pAIObject, IAIObject::EUpdateTyp
 	}
 };
 
+//-----------------------------------------------------------------------------------------------------------
+bool CPerceptionManager::IsVisibilityUpdateDue(CPerceptionActor& perceptionActor, IAIActor* pAIActor, const Vec3& actorPos) const
+{
+	const int interval = m_cVars.ReducedUpdateInterval;
+	if (interval <= 1)
+		return true;
+
+	// Actors that are engaged or close to the camera are always updated at full rate.
+	if (pAIActor->GetAttentionTarget())
+		return true;
+
+	const Vec3& cameraPos = GetISystem()->GetViewCamera().GetPosition();
+	if (Distance::Point_PointSq(actorPos, cameraPos) < sqr(m_cVars.ReducedUpdateDistance))
+		return true;
+
+	return perceptionActor.TickReducedUpdate((uint32)interval);
+}
+
 //-----------------------------------------------------------------------------------------------------------
 void CPerceptionManager::GatherProbableTargetsForActor(IAIActor* pAIActor)
 {
@@ -1591,6 +1615,12 @@ void CPerceptionManager::CVars::Init()
 		"Debug draw the grenade events the AI system processes. 0=disable, 1=enable.");
 	DefineConstIntCVarName("ai_DrawExplosions", DrawExplosions, 0, VF_CHEAT | VF_CHEAT_NOCHECK,
 		"Debug draw the explosion events the AI system processes. 0=disable, 1=enable.");
+
+	REGISTER_CVAR2("ai_PerceptionReducedUpdateInterval", &ReducedUpdateInterval, 1, VF_NULL,
+		"Actors without an attention target that are further than ai_PerceptionReducedUpdateDistance from the camera\n"
+		"only run their visibility checks on every Nth full update. 0 or 1=always update.");
+	REGISTER_CVAR2("ai_PerceptionReducedUpdateDistance", &ReducedUpdateDistance, 60.0f, VF_NULL,
+		"Distance from the camera beyond which ai_PerceptionReducedUpdateInterval applies.");
 }
 
 #include <CryAISystem/IAIDebugRenderer.h>
@@ -1815,6 +1845,7 @@ void CPerceptionManager::DebugDrawPerformance(IAIDebugRenderer* pDebugRenderer,
 		const int visChecksMax = m_stats.trackers[PERFTRACK_VIS_CHECKS].GetCountMax();
 		const int updates = m_stats.trackers[PERFTRACK_UPDATES].GetCount();
 		const int updatesMax = m_stats.trackers[PERFTRACK_UPDATES].GetCountMax();
+		const int skippedUpdates = m_stats.trackers[PERFTRACK_SKIPPED_UPDATES].GetCount();
 
 		pDebugRenderer->Draw2dLabel(50, 200, 2, white, false, "Updates:");
 		pDebugRenderer->Draw2dLabel(175, 200, 2, white, false, "%d", updates);
@@ -1824,6 +1855,9 @@ void CPerceptionManager::DebugDrawPerformance(IAIDebugRenderer* pDebugRenderer,
 		pDebugRenderer->Draw2dLabel(175, 225, 2, white, false, "%d", visChecks);
 		pDebugRenderer->Draw2dLabel(215, 225 + 5, 1, white, false, "max:%d", visChecksMax);
 
+		pDebugRenderer->Draw2dLabel(50, 250, 2, white, false, "Skipped:");
+		pDebugRenderer->Draw2dLabel(175, 250, 2, white, false, "%d", skippedUpdates);
+
 		{
 			pDebugRenderer->Init2DMode();
 			pDebugRenderer->SetAlphaBlended(true);
@@ -96,6 +96,7 @@ private:
 
 	CPerceptionActor* GetPerceptionActor(IAIObject* pAIObject);
 	void              GatherProbableTargetsForActor(IAIActor* pAIActor);
+	bool              IsVisibilityUpdateDue(CPerceptionActor& perceptionActor, IAIActor* pAIActor, const Vec3& actorPos) const;
 
 	void              UpdateIncomingStimuli();
 	void              UpdateStimuli(float deltaTime);
@@ -186,6 +187,7 @@ private:
 		PERFTRACK_UPDATES,
 		PERFTRACK_INCOMING_STIMS,
 		PERFTRACK_STIMS,
+		PERFTRACK_SKIPPED_UPDATES,
 		COUNT_PERFTRACK // must be last
 	};
 
@@ -200,6 +202,9 @@ private:
 		DeclareConstIntCVar(DrawSoundEvents, 0);
 		DeclareConstIntCVar(DrawGrenadeEvents, 0);
 		DeclareConstIntCVar(DrawExplosions, 0);
+
+		int   ReducedUpdateInterval;
+		float ReducedUpdateDistance;
 	}
 	m_cVars;
 
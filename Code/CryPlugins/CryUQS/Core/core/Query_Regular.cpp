@@ -131,6 +131,7 @@ namespace UQS
 			, m_currentPhaseFn(&CQuery_Regular::Phase1_PrepareGenerationPhase)
 			, m_maxCandidates(0)
 			, m_remainingItemWorkingDatasIndexForCheapInstantEvaluators(0)
+			, m_survivingItemWorkingDatasCountForCheapInstantEvaluators(0)
 		{
 			m_elapsedTimePerPhase.resize(1);              // 1st phase is already active, so keep track of the elapsed time of that from the beginning
 			m_elapsedFramesPerPhase.resize(1);            // ditto for the elapsed frames
@@ -227,7 +228,7 @@ namespace UQS
 
 			out.numDesiredItems = (maxItemsToKeepInResultSet < 1) ? 0 : (size_t)maxItemsToKeepInResultSet;
 			out.numGeneratedItems = m_generatedItems.GetItemCount();
-			out.numRemainingItemsToInspect = m_remainingItemWorkingDatasToInspect.size();
+			out.numRemainingItemsToInspect = m_remainingItemWorkingDatasToInspect.size() - (m_remainingItemWorkingDatasIndexForCheapInstantEvaluators - m_survivingItemWorkingDatasCountForCheapInstantEvaluators);
 			out.numItemsInFinalResultSet = m_candidates.size();
 
 			// Instant-Evaluator runs
@@ -614,24 +615,26 @@ namespace UQS
 					}
 				}
 
-				if (bDiscardedItem)
-				{
-					m_remainingItemWorkingDatasToInspect.erase(m_remainingItemWorkingDatasToInspect.begin() + m_remainingItemWorkingDatasIndexForCheapInstantEvaluators);
-				}
-				else
+				// keep the surviving items at the front; the discarded ones get dropped all at once when all items have been examined
+				if (!bDiscardedItem)
 				{
-					++m_remainingItemWorkingDatasIndexForCheapInstantEvaluators;
+					m_remainingItemWorkingDatasToInspect[m_survivingItemWorkingDatasCountForCheapInstantEvaluators++] = pWorkingData;
 				}
 
+				++m_remainingItemWorkingDatasIndexForCheapInstantEvaluators;
+
 				if (m_timeBudgetForCurrentUpdate.IsExhausted())
 					break;
 			}
 
 			assert(m_remainingItemWorkingDatasIndexForCheapInstantEvaluators <= m_remainingItemWorkingDatasToInspect.size());
+			assert(m_survivingItemWorkingDatasCountForCheapInstantEvaluators <= m_remainingItemWorkingDatasIndexForCheapInstantEvaluators);
 
 			// examined all items? -> proceed to next phase
 			if (m_remainingItemWorkingDatasIndexForCheapInstantEvaluators == m_remainingItemWorkingDatasToInspect.size())
 			{
+				m_remainingItemWorkingDatasToInspect.resize(m_survivingItemWorkingDatasCountForCheapInstantEvaluators);
+				m_remainingItemWorkingDatasIndexForCheapInstantEvaluators = m_survivingItemWorkingDatasCountForCheapInstantEvaluators;
 				m_currentPhaseFn = &CQuery_Regular::Phase6_SortByScoreSoFar;
 			}
 
@@ -640,10 +643,10 @@ namespace UQS
 
 		CQuery_Regular::EPhaseStatus CQuery_Regular::Phase6_SortByScoreSoFar(const SPhaseUpdateContext& phaseUpdateContext)
 		{
-			// sort the remaining items such that the ones with higher scores come first
+			// sort the remaining items such that the ones with higher scores come last (phase 7 inspects them best-first by popping them off the back)
 			auto sorter = [](const SItemWorkingData* pLHS, const SItemWorkingData* pRHS)
 			{
-				return pLHS->accumulatedAndWeightedScoreSoFar > pRHS->accumulatedAndWeightedScoreSoFar;
+				return pLHS->accumulatedAndWeightedScoreSoFar < pRHS->accumulatedAndWeightedScoreSoFar;
 			};
 			std::sort(m_remainingItemWorkingDatasToInspect.begin(), m_remainingItemWorkingDatasToInspect.end(), sorter);
 
@@ -1016,8 +1019,7 @@ namespace UQS
 				if (!bRemainingCapacityAllowsToStartMoreEvaluators)
 					break;
 
-				auto itWorkingDataToInspectNext = m_remainingItemWorkingDatasToInspect.begin();
-				SItemWorkingData* pWorkingDataToInspectNext = *itWorkingDataToInspectNext;
+				SItemWorkingData* pWorkingDataToInspectNext = m_remainingItemWorkingDatasToInspect.back();
 
 				assert(pWorkingDataToInspectNext->bitsDiscardedByInstantEvaluators == 0);
 				assert(pWorkingDataToInspectNext->bitsDiscardedByDeferredEvaluators == 0);
@@ -1135,7 +1137,7 @@ namespace UQS
 					}
 				}
 
-				m_remainingItemWorkingDatasToInspect.erase(itWorkingDataToInspectNext);
+				m_remainingItemWorkingDatasToInspect.pop_back();
 
 				if (m_timeBudgetForCurrentUpdate.IsExhausted())
 					break;
@@ -202,7 +202,7 @@ namespace UQS
 
 			// used throughout several phases
 			std::vector<SItemWorkingData>                         m_itemWorkingDatas;                                      // items with their intermediate scores and states of all evaluators; the order of this list stays intact as we may decide to inspect/debug some of the outcomes or see which evaluators were running on which items
-			std::vector<SItemWorkingData*>                        m_remainingItemWorkingDatasToInspect;                    // pointers into m_itemWorkingDatas for items that haven't been discarded yet and for which some evaluators still need to run; gets sorted by score-so-far after all cheap instant-evaluators are run; shrinks as soon as an instant-evaluator discards an item or when all remaining deferred-evaluators are currently runnning on the item
+			std::vector<SItemWorkingData*>                        m_remainingItemWorkingDatasToInspect;                    // pointers into m_itemWorkingDatas for items that haven't been discarded yet and for which some evaluators still need to run; gets sorted by score-so-far after all cheap instant-evaluators are run (best items at the back); shrinks as soon as an instant-evaluator discards an item or when all remaining deferred-evaluators are currently runnning on the item
 			std::vector<SItemWorkingData*>                        m_candidates;                                            // candidates for the final result set; these ultimately point into m_itemWorkingData; this list grows as items survive all evaluators; once the desired result set size has been reached, the worst item might get kicked out by better ones
 
 			// phase 1
@@ -220,6 +220,7 @@ namespace UQS
 			// phase 5
 			std::vector<SInstantEvaluatorWithIndex>               m_cheapInstantEvaluators;
 			size_t                                                m_remainingItemWorkingDatasIndexForCheapInstantEvaluators;    // for continuing with cheap instant-evaluators in the next frame from where we left off when we ran out of time
+			size_t                                                m_survivingItemWorkingDatasCountForCheapInstantEvaluators;    // surviving items get compacted to the front of m_remainingItemWorkingDatasToInspect while the cheap instant-evaluators run (instead of erasing discarded ones one by one)
 
 			// phase 7
 			std::vector<SInstantEvaluatorWithIndex>               m_expensiveInstantEvaluators;
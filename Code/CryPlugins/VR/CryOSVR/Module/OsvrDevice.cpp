@@ -433,8 +433,8 @@ void Device::UpdatePose(const Quat& orientation, const Vec3& translation)
 	HMDQuatToWorldQuat(recenteredQuat, m_localTrackingState.pose.orientation);
 	HMDVec3ToWorldVec3(m_nativeTrackingState.pose.position, m_localTrackingState.pose.position);
 
-	const ICVar* pStereoScaleCoefficient = gEnv->pConsole ? gEnv->pConsole->GetCVar("r_stereoScaleCoefficient") : 0;
-	const float stereoScaleCoefficient = pStereoScaleCoefficient ? pStereoScaleCoefficient->GetFVal() : 1.f;
+	static CVarHandle<float> s_stereoScaleCoefficient("r_stereoScaleCoefficient");
+	const float stereoScaleCoefficient = s_stereoScaleCoefficient.Get(1.f);
 
 	m_nativeTrackingState.pose.position *= stereoScaleCoefficient;
 	m_localTrackingState.pose.position *= stereoScaleCoefficient;
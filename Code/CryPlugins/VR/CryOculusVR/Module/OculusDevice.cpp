@@ -445,8 +445,8 @@ void Device::UpdateTrackingState(EVRComponent type)
 		double sensorSampleTime;
 		ovr_GetEyePoses(m_pSession, frameId, kbLatencyMarker, bZeroEyeOffset ? hmdToEyeOffset : m_eyeRenderHmdToEyeOffset, eyePose, &sensorSampleTime);
 
-		const ICVar* pStereoScaleCoefficient = gEnv->pConsole ? gEnv->pConsole->GetCVar("r_stereoScaleCoefficient") : 0;
-		const float stereoScaleCoefficient = pStereoScaleCoefficient ? pStereoScaleCoefficient->GetFVal() : 1.f;
+		static CVarHandle<float> s_stereoScaleCoefficient("r_stereoScaleCoefficient");
+		const float stereoScaleCoefficient = s_stereoScaleCoefficient.Get(1.f);
 
 		CopyPoseState(m_nativeTrackingState.pose, m_localTrackingState.pose, trackingState.HeadPose);
 
@@ -1070,8 +1070,8 @@ bool Device::RequestAsyncCameraUpdate(AsyncCameraContext& context)
 	double sensorSampleTime;
 	ovr_GetEyePoses(m_pSession, frameId, kbLatencyMarker, bZeroEyeOffset ? hmdToEyeOffset : m_eyeRenderHmdToEyeOffset, eyePose, &sensorSampleTime);
 
-	const ICVar* pStereoScaleCoefficient = gEnv->pConsole ? gEnv->pConsole->GetCVar("r_stereoScaleCoefficient") : 0;
-	const float stereoScaleCoefficient = pStereoScaleCoefficient ? pStereoScaleCoefficient->GetFVal() : 1.f;
+	static CVarHandle<float> s_stereoScaleCoefficient("r_stereoScaleCoefficient");
+	const float stereoScaleCoefficient = s_stereoScaleCoefficient.Get(1.f);
 
 	HmdTrackingState nativeTrackingState;
 	HmdTrackingState localTrackingState;
@@ -302,6 +302,7 @@ CActor::CActor()
 , m_isClient(false)
 , m_isPlayer(false)
 , m_isMigrating(false)
+, m_updateTier(eUT_Full)
 , m_pMovementController(0)
 , m_stance(STANCE_NULL)
 , m_desiredStance(STANCE_NULL)
@@ -438,6 +438,18 @@ public:
 		eASM_Cutscene,												// HUDInterfaceEffects.cpp sets this
 	};
 
+	// Assigned every frame by CActorManager, lower tiers skip work that isn't noticeable for distant actors
+	enum EUpdateTier
+	{
+		eUT_Full = 0,		// close to the camera
+		eUT_Reduced,		// visible in the distance or close but not rendered
+		eUT_Minimal,		// far away and not rendered
+		eUT_Count
+	};
+
+	ILINE EUpdateTier GetUpdateTier() const { return (EUpdateTier)m_updateTier; }
+	ILINE void SetUpdateTier(EUpdateTier updateTier) { m_updateTier = (uint8)updateTier; }
+
 	DECLARE_SERVER_RMI_NOATTACH(SvRequestDropItem, DropItemParams, eNRT_ReliableOrdered);
 	DECLARE_SERVER_RMI_NOATTACH(SvRequestPickUpItem, ItemIdParam, eNRT_ReliableOrdered);
 	DECLARE_SERVER_RMI_NOATTACH(SvRequestExchangeItem, ExchangeItemParams, eNRT_ReliableOrdered);
@@ -1075,6 +1087,7 @@ protected:
 	bool	m_isClient;
 	bool	m_isPlayer;
 	bool	m_isMigrating;
+	uint8	m_updateTier;
 	CHealth m_health;
 
 	CActorPtr	m_pThis;
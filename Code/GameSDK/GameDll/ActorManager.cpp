@@ -34,6 +34,13 @@ void CActorManager::Reset(bool bReallocate)
 	m_iNumActorsTrackedIncLocalPlayer = 0;
 	m_iMaxTrackedActors								= 0;
 
+	for (int i = 0; i < CActor::eUT_Count; ++i)
+	{
+		m_updateTierCounts[i]			= 0;
+		m_updateTierCostCounts[i]	= 0;
+		m_updateTierCosts[i]			= 0.f;
+	}
+
 #if USE_ACTOR_PTR_LOOKUP
 	m_actorPtrToIndex.clear();
 #endif
@@ -156,6 +163,16 @@ void CActorManager::Update(float dt)
 	//			will require actor registration on creation as well as removal on destruction
 	int iNumActorsTracked = 0;
 	const bool bMultiplayer = gEnv->bMultiplayer;
+
+	// A dedicated server has no camera to measure relevance against, so it keeps every actor at full rate
+	const bool bUseUpdateTiers = g_pGameCVars->g_actorUpdateLod && !gEnv->IsDedicated() && gEnv->pRenderer;
+	const Vec3 cameraPos = gEnv->pSystem->GetViewCamera().GetPosition();
+	const int rendererFrameId = gEnv->pRenderer ? gEnv->pRenderer->GetFrameID() : 0;
+	for (int i = 0; i < CActor::eUT_Count; ++i)
+	{
+		m_updateTierCounts[i] = 0;
+	}
+
 	while (pActor != NULL)
 	{
 		if (pActor != pLocalPlayer)
@@ -163,6 +180,10 @@ void CActorManager::Update(float dt)
 			IEntity* pEntity = pActor->GetEntity();
 			const IAIObject* pAIObject = pEntity->GetAI();
 
+			const CActor::EUpdateTier updateTier = bUseUpdateTiers ? CalculateUpdateTier(pEntity, cameraPos, rendererFrameId) : CActor::eUT_Full;
+			static_cast<CActor*>(pActor)->SetUpdateTier(updateTier);
+			m_updateTierCounts[updateTier]++;
+
 			if(bMultiplayer || (pAIObject && pEntity->IsActivatedForUpdates()))
 			{
 				CacheDataFromActor(pActor, pEntity, pAIObject, kActorIndexMultiplier, playerFactionID, iNumActorsTracked);
@@ -184,6 +205,71 @@ void CActorManager::Update(float dt)
 	{
 		m_iNumActorsTrackedIncLocalPlayer = iNumActorsTracked;
 	}
+
+	if (g_pGameCVars->g_actorUpdateLodDebug)
+	{
+		DrawUpdateTierDebug();
+	}
+}
+
+CActor::EUpdateTier CActorManager::CalculateUpdateTier(const IEntity* pEntity, const Vec3& cameraPos, int rendererFrameId) const
+{
+	const float distanceSq = pEntity->GetWorldPos().GetSquaredDistance(cameraPos);
+	if (distanceSq < sqr(g_pGameCVars->g_actorUpdateLodReducedDistance))
+		return CActor::eUT_Full;
+
+	// Same visibility test as used elsewhere: the render node was drawn within the last couple of frames
+	bool bVisible = false;
+	if (IEntityRender* pIEntityRender = const_cast<IEntity*>(pEntity)->GetRenderInterface())
+	{
+		if (IRenderNode* pRenderNode = pIEntityRender->GetRenderNode())
+		{
+			bVisible = (rendererFrameId - pRenderNode->GetDrawFrame()) <= 2;
+		}
+	}
+
+	if (bVisible || distanceSq < sqr(g_pGameCVars->g_actorUpdateLodMinimalDistance))
+		return CActor::eUT_Reduced;
+
+	return CActor::eUT_Minimal;
+}
+
+void CActorManager::DrawUpdateTierDebug()
+{
+	static const char* s_tierNames[CActor::eUT_Count] = { "Full", "Reduced", "Minimal" };
+	static const ColorF s_color(1.f, 1.f, 1.f, 1.f);
+
+	float y = 100.f;
+	IRenderAuxText::Draw2dLabel(50.f, y, 1.5f, s_color, false, "Actor update tiers");
+	for (int i = 0; i < CActor::eUT_Count; ++i)
+	{
+		y += 15.f;
+		const float averageCostMs = m_updateTierCostCounts[i] ? (m_updateTierCosts[i] * 1000.f) / m_updateTierCostCounts[i] : 0.f;
+		IRenderAuxText::Draw2dLabel(50.f, y, 1.5f, s_color, false, "%-8s actors: %3d  update: %.3f ms total, %.3f ms avg",
+			s_tierNames[i], m_updateTierCounts[i], m_updateTierCosts[i] * 1000.f, averageCostMs);
+
+		m_updateTierCostCounts[i]	= 0;
+		m_updateTierCosts[i]			= 0.f;
+	}
+}
+
+CActorManager::SScopedUpdateCost::SScopedUpdateCost(CActor::EUpdateTier updateTier)
+	: m_updateTier(updateTier)
+{
+	if (g_pGameCVars->g_actorUpdateLodDebug)
+	{
+		m_startTime = gEnv->pTimer->GetAsyncTime();
+	}
+}
+
+CActorManager::SScopedUpdateCost::~SScopedUpdateCost()
+{
+	if (g_pGameCVars->g_actorUpdateLodDebug && m_startTime.GetValue() != 0)
+	{
+		CActorManager* pActorManager = GetActorManager();
+		pActorManager->m_updateTierCosts[m_updateTier] += (gEnv->pTimer->GetAsyncTime() - m_startTime).GetSeconds();
+		pActorManager->m_updateTierCostCounts[m_updateTier]++;
+	}
 }
 
 void CActorManager::ActorRemoved(IActor * pActor)
@@ -54,6 +54,16 @@ public:
 
 	static CActorManager * GetActorManager();
 
+	// Accumulates the update time of an actor per update tier for g_actorUpdateLodDebug
+	struct SScopedUpdateCost
+	{
+		SScopedUpdateCost(CActor::EUpdateTier updateTier);
+		~SScopedUpdateCost();
+
+		CActor::EUpdateTier	m_updateTier;
+		CTimeValue					m_startTime;
+	};
+
 	ILINE void PrepareForIteration() const
 	{
 		PrefetchLine(m_actorTeamNums, 0);
@@ -90,6 +100,8 @@ public:
 private:
 	void CacheDataFromActor(const IActor* pActor, IEntity* pEntity, const IAIObject* pAIObject, 
 		int kActorIndexMultiplier, uint8 playerFactionID, int iActorIndex);
+	CActor::EUpdateTier CalculateUpdateTier(const IEntity* pEntity, const Vec3& cameraPos, int rendererFrameId) const;
+	void DrawUpdateTierDebug();
 	void WriteCachedActorData(int from, int to);
 
 	size_t	GetMemoryRequiredForNActors(int iNumActors);
@@ -121,6 +133,10 @@ private:
 	int				m_iNumActorsTracked;
 	int				m_iNumActorsTrackedIncLocalPlayer;
 	int				m_iMaxTrackedActors;
+
+	int				m_updateTierCounts[CActor::eUT_Count];
+	int				m_updateTierCostCounts[CActor::eUT_Count];
+	float			m_updateTierCosts[CActor::eUT_Count];
 };
 
 #endif //__ACTOR_MANAGER_H__
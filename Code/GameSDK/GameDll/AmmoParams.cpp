@@ -718,6 +718,7 @@ SAmmoParams::SAmmoParams(const XmlNodeRef& ammoParamsNode, const IEntityClass* p
 , serverSpawn(false)
 , predictSpawn(false)
 , reusable(false)
+, poolSize(0)
 , lifetime(0.0f)
 , safeExplosion(0.0f)
 , mpProjectileDestructDelay(0.0f)
@@ -857,7 +858,11 @@ void SAmmoParams::LoadFlagsAndParams(const XmlNodeRef& ammoParamsNode)
 		if (serverSpawn)
 			flagsReader.ReadParamValue<bool>("PredictSpawn", predictSpawn);
 		else
+		{
 			flagsReader.ReadParamValue<bool>("Reusable", reusable);
+			if (reusable)
+				flagsReader.ReadParamValue<int>("PoolSize", poolSize);
+		}
 	}
 
 	XmlNodeRef paramsNode = reader.FindFilteredChild("params");
@@ -422,6 +422,7 @@ struct SAmmoParams
 	bool	serverSpawn;
 	bool	predictSpawn;
 	bool	reusable;
+	int		poolSize;	// reusable projectiles spawned into the pool when a level is loaded
 
 	// common parameters
 	float	lifetime;
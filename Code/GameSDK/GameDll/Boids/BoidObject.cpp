@@ -382,12 +382,11 @@ void CBoidObject::CalcFlockBehavior( SBoidContext &bc,Vec3 &vAlignment,Vec3 &vCo
 	Vec3 avgNeighborsCenter(0,0,0);
 	int numMates = 0;
 
-	int numBoids = m_flock->GetBoidsCount();
-	for (int i = 0; i < numBoids; i++)
+	// Mates are out of range beyond MaxAttractDistance, which is the cell size of the flock grid.
+	m_flock->GetBoidGrid().ForEachNear(m_pos,[&]( CBoidObject *boid )
 	{
-		CBoidObject *boid = m_flock->GetBoid(i);
-		if (!boid || boid == this) // skip myself.
-			continue;
+		if (boid == this) // skip myself.
+			return;
 
 		sight = boid->m_pos - m_pos;
 
@@ -413,7 +412,7 @@ void CBoidObject::CalcFlockBehavior( SBoidContext &bc,Vec3 &vAlignment,Vec3 &vCo
 			// Calculate average center of all neighbor boids.
 			avgNeighborsCenter += boid->m_pos;
 		}
-	}
+	});
 	if (numMates > 0)
 	{
 		avgAlignment = avgAlignment * (1.0f/numMates);
@@ -389,6 +389,8 @@ void CFlock::Update( CCamera *pCamera )
 
 	UpdateBoidCollisions();
 
+	m_boidGrid.Build(m_boids,m_bc.MaxAttractDistance);
+
 	Vec3 entityPos = m_pEntity->GetWorldPos();
 	Matrix34 boidTM;
 	int num = 0;
@@ -758,6 +760,7 @@ void CFlock::OnStimulusReceived(const SAIStimulusParams& params)
 void CFlock::GetMemoryUsage( ICrySizer *pSizer ) const
 {
 	pSizer->AddContainer(m_boids);		
+	pSizer->AddObject(m_boidGrid);
 	pSizer->AddObject(m_model);
 	pSizer->AddObject(m_boidEntityName);
 	pSizer->AddObject(m_boidDefaultAnimName);
@@ -791,6 +794,45 @@ void CFlock::UpdateAvgBoidPos(float dt)
 
 }
 
+//////////////////////////////////////////////////////////////////////////
+void CBoidGrid::Build( const std::vector<CBoidObject*> &boids,float fCellSize )
+{
+	m_fInvCellSize = 1.0f / max(fCellSize,0.01f);
+
+	uint32 numBuckets = 16;
+	while (numBuckets < boids.size()*2)
+		numBuckets <<= 1;
+	m_bucketMask = numBuckets - 1;
+
+	// Counting sort of the boids by bucket. After the prefix sum every bucket holds its end offset,
+	// which is counted down to its start offset while the boids are filled in.
+	m_cellStart.assign(numBuckets + 1,0);
+	for (std::vector<CBoidObject*>::const_iterator it = boids.begin(); it != boids.end(); ++it)
+	{
+		if (*it)
+		{
+			const Vec3i cell = GetCell((*it)->m_pos);
+			m_cellStart[GetBucket(cell.x,cell.y,cell.z)]++;
+		}
+	}
+	for (uint32 i = 1; i <= numBuckets; i++)
+		m_cellStart[i] += m_cellStart[i - 1];
+
+	m_entries.resize(m_cellStart[numBuckets]);
+	for (std::vector<CBoidObject*>::const_iterator it = boids.begin(); it != boids.end(); ++it)
+	{
+		if (*it)
+		{
+			const Vec3i cell = GetCell((*it)->m_pos);
+			SEntry &entry = m_entries[--m_cellStart[GetBucket(cell.x,cell.y,cell.z)]];
+			entry.x = cell.x;
+			entry.y = cell.y;
+			entry.z = cell.z;
+			entry.pBoid = *it;
+		}
+	}
+}
+
 //////////////////////////////////////////////////////////////////////////
 
 void CFlock::UpdateBoidCollisions()
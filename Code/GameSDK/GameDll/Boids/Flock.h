@@ -59,6 +59,74 @@ struct SFlockHit {
 	float dist;
 };
 
+//////////////////////////////////////////////////////////////////////////
+/*!
+ *	Spatial hash over the boids of one flock, rebuilt once per flock update.
+ *	Cells are as large as the attract distance, so the mates of a boid are found in the 27 cells around it
+ *	instead of by scanning the whole flock.
+ */
+class CBoidGrid
+{
+public:
+	CBoidGrid() : m_bucketMask(0),m_fInvCellSize(0) {}
+
+	void Build( const std::vector<CBoidObject*> &boids,float fCellSize );
+
+	void GetMemoryUsage( ICrySizer *pSizer ) const
+	{
+		pSizer->AddContainer(m_cellStart);
+		pSizer->AddContainer(m_entries);
+	}
+
+	//! Calls func(CBoidObject*) for every boid in the cells around pos.
+	template<typename TFunc>
+	void ForEachNear( const Vec3 &pos,TFunc func ) const
+	{
+		if (m_cellStart.empty())
+			return;
+
+		const Vec3i cell = GetCell(pos);
+		for (int z = cell.z - 1; z <= cell.z + 1; z++)
+		{
+			for (int y = cell.y - 1; y <= cell.y + 1; y++)
+			{
+				for (int x = cell.x - 1; x <= cell.x + 1; x++)
+				{
+					// Different cells can share a bucket, only visit the boids of this cell.
+					const uint32 bucket = GetBucket(x,y,z);
+					for (int i = m_cellStart[bucket], end = m_cellStart[bucket + 1]; i < end; i++)
+					{
+						const SEntry &entry = m_entries[i];
+						if (entry.x == x && entry.y == y && entry.z == z)
+							func(entry.pBoid);
+					}
+				}
+			}
+		}
+	}
+
+private:
+	struct SEntry
+	{
+		int x,y,z;
+		CBoidObject *pBoid;
+	};
+
+	Vec3i GetCell( const Vec3 &pos ) const
+	{
+		return Vec3i(int_floor(pos.x*m_fInvCellSize),int_floor(pos.y*m_fInvCellSize),int_floor(pos.z*m_fInvCellSize));
+	}
+	uint32 GetBucket( int x,int y,int z ) const
+	{
+		return ((uint32)x*73856093u ^ (uint32)y*19349663u ^ (uint32)z*83492791u) & m_bucketMask;
+	}
+
+	std::vector<int> m_cellStart; // Offset of every bucket in m_entries, plus the end.
+	std::vector<SEntry> m_entries;
+	uint32 m_bucketMask;
+	float m_fInvCellSize;
+};
+
 
 //////////////////////////////////////////////////////////////////////////
 
@@ -93,6 +161,7 @@ public:
 
 	void AddBoid( CBoidObject *boid );
 	int GetBoidsCount() { return m_boids.size(); }
+	const CBoidGrid& GetBoidGrid() const { return m_boidGrid; }
 	CBoidObject* GetBoid( int index ) { return m_boids[index]; }
 
 	float GetMaxVisibilityDistance() const { return m_bc.maxVisibleDistance; };
@@ -233,6 +302,8 @@ protected:
 	float m_lastUpdatePosTimePassed;
 
 	TTimeBoidMap m_BoidCollisionMap;
+
+	CBoidGrid m_boidGrid;
 };
 
 
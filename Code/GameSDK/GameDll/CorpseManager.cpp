@@ -26,7 +26,8 @@ static const float k_deleteTimeIfOverlap = 2.5f;       // If the corpse has been
 
 
 CCorpseManager::CCorpseManager() 
-: m_bThermalVisionOn(false) 
+: m_settledScanIdx(0)
+, m_bThermalVisionOn(false) 
 {
 	if(CGameRules* pGameRules = g_pGame->GetGameRules())
 	{
@@ -150,6 +151,11 @@ void CCorpseManager::KeepAwake( const EntityId corpseId, IPhysicalEntity* pCorps
 		{
 			if((m_activeCorpses[i].flags&eCF_NeverSleep)==0)
 			{
+				if(m_activeCorpses[i].flags&eCF_PhysicsDisabled)
+				{
+					SetCorpsePhysicsEnabled(m_activeCorpses[i], gEnv->pEntitySystem->GetEntity(corpseId), true);
+				}
+				m_activeCorpses[i].flags &= ~eCF_Settled;
 				m_activeCorpses[i].flags |= eCF_NeverSleep;
 				if(pCorpsePhys)
 				{
@@ -174,6 +180,7 @@ void CCorpseManager::ClearCorpses()
 	}
 
 	m_activeCorpses.clear();
+	m_settledScanIdx = 0;
 }
 
 void CCorpseManager::UpdateCorpses(float frameTime)
@@ -188,15 +195,22 @@ void CCorpseManager::UpdateCorpses(float frameTime)
 	float heatFadeDuration = g_pGameCVars->g_corpseManager_thermalHeatFadeDuration;
 	
 	int deleteIdx = -1;
-	IEntity* pCorpseEntities[MAX_CORPSES];
-	AABB corpseBBox[MAX_CORPSES];
+	const int numCorpses = m_activeCorpses.size();
+	const Vec3 cameraPos = gEnv->pSystem->GetViewCamera().GetPosition();
 
-	int numCorpses = m_activeCorpses.size();
+	// Settled corpses don't move, so only a few of them are revisited each frame
+	const int settledChecksPerFrame = max(1, g_pGameCVars->g_corpseManager_settledChecksPerFrame);
+	if(m_settledScanIdx >= numCorpses)
+	{
+		m_settledScanIdx = 0;
+	}
+
+	int numPhysicalized = 0;
 	for(int i = 0; i < numCorpses; i++)
 	{
-		if (pCorpseEntities[i] = gEnv->pEntitySystem->GetEntity(m_activeCorpses[i].corpseId))
+		if((m_activeCorpses[i].flags&eCF_PhysicsDisabled)==0)
 		{
-			pCorpseEntities[i]->GetWorldBounds(corpseBBox[i]);
+			numPhysicalized++;
 		}
 	}
 
@@ -206,9 +220,27 @@ void CCorpseManager::UpdateCorpses(float frameTime)
 		float corpseAgePrevFrame = m_activeCorpses[i].age;
 		m_activeCorpses[i].age += frameTime;
 
-		IEntity* pCorpseEntity = pCorpseEntities[i];
+		const bool settled = (m_activeCorpses[i].flags&eCF_Settled) != 0;
+		if(settled && ((i + numCorpses - m_settledScanIdx) % numCorpses) >= settledChecksPerFrame)
+		{
+			continue;
+		}
 
+		IEntity* pCorpseEntity = gEnv->pEntitySystem->GetEntity(m_activeCorpses[i].corpseId);
 		if(pCorpseEntity)
+		{
+			pCorpseEntity->GetWorldBounds(m_activeCorpses[i].bounds);
+		}
+		else
+		{
+			m_activeCorpses[i].bounds.Reset();
+		}
+
+		if(pCorpseEntity && settled)
+		{
+			UpdateSettledCorpse(m_activeCorpses[i], pCorpseEntity, cameraPos, numPhysicalized);
+		}
+		else if(pCorpseEntity)
 		{
 			// Update thermal vision heat for corpse
 			if(m_bThermalVisionOn && (corpseAgePrevFrame < heatFadeDuration))
@@ -299,6 +331,7 @@ void CCorpseManager::UpdateCorpses(float frameTime)
 						{
 							m_activeCorpses[i].awakeTime = 0.f;
 							m_activeCorpses[i].corpsePos = psd.centerOfMass;
+							m_activeCorpses[i].flags |= eCF_Settled;
 						}
 						else
 						{
@@ -315,7 +348,7 @@ void CCorpseManager::UpdateCorpses(float frameTime)
 		{
 			for (int j=i+1; j<numCorpses; j++)
 			{
-				if (pCorpseEntities[j] && Overlap::AABB_AABB(corpseBBox[i], corpseBBox[j]))
+				if (Overlap::AABB_AABB(m_activeCorpses[i].bounds, m_activeCorpses[j].bounds))
 				{
 					if ((m_activeCorpses[i].age > k_deleteAgeIfOverlap) || (m_activeCorpses[i].awakeTime>k_deleteTimeIfOverlap) || (m_activeCorpses[j].awakeTime>k_deleteTimeIfOverlap))
 					{
@@ -327,6 +360,10 @@ void CCorpseManager::UpdateCorpses(float frameTime)
 		}
 	}
 
+	m_settledScanIdx = (m_settledScanIdx + settledChecksPerFrame) % numCorpses;
+
+	EnforcePhysicsBudget(cameraPos, numPhysicalized);
+
 	if (deleteIdx>=0)
 	{
 		const EntityId corpseId = m_activeCorpses[deleteIdx].corpseId;
@@ -336,6 +373,98 @@ void CCorpseManager::UpdateCorpses(float frameTime)
 	}
 }
 
+void CCorpseManager::UpdateSettledCorpse(SCorpseInfo& corpse, IEntity* pCorpseEntity, const Vec3& cameraPos, int& numPhysicalized)
+{
+	const bool bFarAway = corpse.corpsePos.GetSquaredDistance(cameraPos) > sqr(g_pGameCVars->g_corpseManager_cullPhysicsDistance);
+
+	if((corpse.flags&eCF_PhysicsDisabled)==0)
+	{
+		if(bFarAway)
+		{
+			SetCorpsePhysicsEnabled(corpse, pCorpseEntity, false);
+			numPhysicalized--;
+		}
+		else if(IPhysicalEntity* pPhysEnt = pCorpseEntity->GetPhysics())
+		{
+			// Something woke it up since it settled, hand it back to the per frame sleep checks
+			pe_status_awake psa;
+			if(pPhysEnt->GetStatus(&psa))
+			{
+				corpse.flags &= ~eCF_Settled;
+			}
+		}
+	}
+	else if(!bFarAway)
+	{
+		const int maxPhysicalized = g_pGameCVars->g_corpseManager_maxPhysicalized;
+		if(maxPhysicalized <= 0 || numPhysicalized < maxPhysicalized)
+		{
+			SetCorpsePhysicsEnabled(corpse, pCorpseEntity, true);
+			numPhysicalized++;
+		}
+	}
+}
+
+void CCorpseManager::EnforcePhysicsBudget(const Vec3& cameraPos, int numPhysicalized)
+{
+	const int maxPhysicalized = g_pGameCVars->g_corpseManager_maxPhysicalized;
+	if(maxPhysicalized <= 0 || numPhysicalized <= maxPhysicalized)
+	{
+		return;
+	}
+
+	// Drop the physics of the farthest settled corpse, one per frame is enough to converge
+	int farthestCorpse = -1;
+	float farthestDistSq = -1.f;
+	const int numCorpses = m_activeCorpses.size();
+	for(int i = 0; i < numCorpses; i++)
+	{
+		const SCorpseInfo& corpse = m_activeCorpses[i];
+		if((corpse.flags&(eCF_Settled|eCF_PhysicsDisabled)) == eCF_Settled)
+		{
+			const float distSq = corpse.corpsePos.GetSquaredDistance(cameraPos);
+			if(distSq > farthestDistSq)
+			{
+				farthestDistSq = distSq;
+				farthestCorpse = i;
+			}
+		}
+	}
+
+	if(farthestCorpse >= 0)
+	{
+		SCorpseInfo& corpse = m_activeCorpses[farthestCorpse];
+		SetCorpsePhysicsEnabled(corpse, gEnv->pEntitySystem->GetEntity(corpse.corpseId), false);
+	}
+}
+
+void CCorpseManager::SetCorpsePhysicsEnabled(SCorpseInfo& corpse, IEntity* pCorpseEntity, bool bEnable)
+{
+	if(pCorpseEntity)
+	{
+		pCorpseEntity->EnablePhysics(bEnable);
+
+		if(bEnable)
+		{
+			if(IPhysicalEntity* pPhysEnt = pCorpseEntity->GetPhysics())
+			{
+				pe_action_awake paa;
+				paa.bAwake = 0;
+				pPhysEnt->Action(&paa);
+			}
+		}
+	}
+
+	if(bEnable)
+	{
+		corpse.flags &= ~eCF_PhysicsDisabled;
+	}
+	else
+	{
+		corpse.flags |= eCF_PhysicsDisabled;
+	}
+}
+
 void CCorpseManager::OnRemovedCorpse( const EntityId corpseId )
 {
 	if(CRecordingSystem *pRecordingSystem = g_pGame->GetRecordingSystem())
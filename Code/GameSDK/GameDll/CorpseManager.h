@@ -28,6 +28,8 @@ class CCorpseManager : IGameRulesRoundsListener
 	enum ECorpseFlags
 	{
 		eCF_NeverSleep		=BIT(0),
+		eCF_Settled				=BIT(1),	// Asleep after coming to rest, only revisited in the amortized scan
+		eCF_PhysicsDisabled	=BIT(2),	// Settled and far away or over the physics budget, kept as a render only pose
 	};
 
 	struct SCorpseInfo
@@ -35,6 +37,7 @@ class CCorpseManager : IGameRulesRoundsListener
 		SCorpseInfo(EntityId _id, Vec3 _pos, float _thermalVisionHeat)
 			:	corpseId(_id)
 			, corpsePos(_pos)
+			, bounds(AABB::RESET)
 			, age(0.0f)
 			, awakeTime(0.f)
 			, thermalVisionHeat(_thermalVisionHeat)
@@ -42,6 +45,7 @@ class CCorpseManager : IGameRulesRoundsListener
 		{}
 		
 		Vec3 corpsePos;
+		AABB bounds;
 		float age;
 		float awakeTime;
 		float thermalVisionHeat;
@@ -70,9 +74,13 @@ public:
 private:
 
 	void UpdateCorpses(float frameTime);
+	void UpdateSettledCorpse(SCorpseInfo& corpse, IEntity* pCorpseEntity, const Vec3& cameraPos, int& numPhysicalized);
+	void EnforcePhysicsBudget(const Vec3& cameraPos, int numPhysicalized);
+	void SetCorpsePhysicsEnabled(SCorpseInfo& corpse, IEntity* pCorpseEntity, bool bEnable);
 	void OnRemovedCorpse(const EntityId corpseId);
 
 	CryFixedArray<SCorpseInfo, MAX_CORPSES>  m_activeCorpses;
+	int m_settledScanIdx;
 
 	bool m_bThermalVisionOn;
 };
@@ -731,6 +731,9 @@ void SCVars::InitCVars(IConsole *pConsole)
 	REGISTER_CVAR(g_corpseManager_thermalHeatFadeDuration, 20.0f, VF_NULL, "Time Duration it takes for corpses heat to fade in thermal vision mode");
 	REGISTER_CVAR(g_corpseManager_thermalHeatMinValue, 0.22f, VF_NULL, "Min heat value in thermal vision mode");
 	REGISTER_CVAR(g_corpseManager_timeoutInSeconds, 0.0f, VF_NULL, "Number of seconds to keep corpses around before removing them. A value <= 0 means: never remove due to timeout.");
+	REGISTER_CVAR(g_corpseManager_cullPhysicsDistance, 40.0f, VF_NULL, "Settled corpses farther than this from the camera have their physics disabled and are kept as a static pose");
+	REGISTER_CVAR(g_corpseManager_maxPhysicalized, 8, VF_NULL, "Limit for number of corpses with physics enabled, the farthest settled ones are turned static first. A value <= 0 means no limit");
+	REGISTER_CVAR(g_corpseManager_settledChecksPerFrame, 2, VF_NULL, "Number of settled corpses revisited per frame for waking up, physics culling and overlap cleanup");
 
 	REGISTER_CVAR(g_explosion_materialFX_raycastLength, 1.f, VF_CHEAT, "Length of raycast for non-direct impact explosions to find appropriate surface effect");
 
@@ -1720,6 +1723,11 @@ void SCVars::InitCVars(IConsole *pConsole)
 	REGISTER_CVAR(g_itemsLodRatioScale, 1.0f, VF_NULL, "Sets the view dist ratio for items owned by AI/Player in SP.\n");
 	REGISTER_CVAR(g_itemsViewDistanceRatioScale, 2.0f, VF_NULL, "Sets the view dist ratio for items owned by AI/Player in SP.\n");
 
+	REGISTER_CVAR(g_actorUpdateLod, 1, VF_NULL, "Enables update tiers for actors other than the local player. Distant actors skip look/aim pose updates while not rendered and poll hit/death reactions less often");
+	REGISTER_CVAR(g_actorUpdateLodReducedDistance, 30.0f, VF_NULL, "Distance to the camera beyond which actors use the reduced update tier");
+	REGISTER_CVAR(g_actorUpdateLodMinimalDistance, 60.0f, VF_NULL, "Distance to the camera beyond which actors that aren't rendered use the minimal update tier");
+	REGISTER_CVAR(g_actorUpdateLodDebug, 0, VF_NULL, "Shows the number of actors and their update cost per update tier");
+
 	REGISTER_CVAR(g_hitDeathReactions_enable, 1, 0, "Enables/Disables Hit/Death reaction system");
 	REGISTER_CVAR(g_hitDeathReactions_useLuaDefaultFunctions, 0, 0, "If enabled, it'll use the default lua methods inside HitDeathReactions script instead of the default c++ version");
 	REGISTER_CVAR(g_hitDeathReactions_disable_ai, 1, 0, "If enabled, it'll not allow to execute any AI instruction during the hit/death reaction");
@@ -2593,6 +2601,9 @@ void SCVars::ReleaseCVars()
 	pConsole->UnregisterVariable("g_corpseManager_thermalHeatFadeDuration", true);
 	pConsole->UnregisterVariable("g_corpseManager_thermalHeatMinValue", true);
 	pConsole->UnregisterVariable("g_corpseManager_timeoutInSeconds", true);
+	pConsole->UnregisterVariable("g_corpseManager_cullPhysicsDistance", true);
+	pConsole->UnregisterVariable("g_corpseManager_maxPhysicalized", true);
+	pConsole->UnregisterVariable("g_corpseManager_settledChecksPerFrame", true);
 
 	pConsole->UnregisterVariable("g_explosion_materialFX_raycastLength", true);
 
@@ -3044,6 +3055,11 @@ void SCVars::ReleaseCVars()
 
 	NetInputChainUnregisterCVars();
 
+	pConsole->UnregisterVariable("g_actorUpdateLod", true);
+	pConsole->UnregisterVariable("g_actorUpdateLodReducedDistance", true);
+	pConsole->UnregisterVariable("g_actorUpdateLodMinimalDistance", true);
+	pConsole->UnregisterVariable("g_actorUpdateLodDebug", true);
+
 	pConsole->UnregisterVariable("g_hitDeathReactions_enable", true);
 	pConsole->UnregisterVariable("g_hitDeathReactions_useLuaDefaultFunctions", true);
 	pConsole->UnregisterVariable("g_hitDeathReactions_disable_ai", true);
@@ -708,6 +708,9 @@ struct SCVars
 	float g_corpseManager_thermalHeatFadeDuration;
 	float g_corpseManager_thermalHeatMinValue;
 	float g_corpseManager_timeoutInSeconds;
+	float g_corpseManager_cullPhysicsDistance;
+	int		g_corpseManager_maxPhysicalized;
+	int		g_corpseManager_settledChecksPerFrame;
 
 	float g_explosion_materialFX_raycastLength;
 
@@ -1294,6 +1297,11 @@ struct SCVars
 	float g_itemsLodRatioScale;
 	float g_itemsViewDistanceRatioScale;
 
+	int			g_actorUpdateLod;
+	float		g_actorUpdateLodReducedDistance;
+	float		g_actorUpdateLodMinimalDistance;
+	int			g_actorUpdateLodDebug;
+
 	// Hit Death Reactions CVars
 	int			g_hitDeathReactions_enable;
 	int			g_hitDeathReactions_useLuaDefaultFunctions;
@@ -92,6 +92,7 @@ History:
 #include "IForceFeedbackSystem.h"
 #include "PersistantStats.h"
 #include "AutoAimManager.h"
+#include "ActorManager.h"
 
 #include "Utility/DesignerWarning.h"
 #include "Utility/CryDebugLog.h"
@@ -492,6 +493,7 @@ void CPlayer::PostProcessAnimation(ICharacterInstance *pCharacter)
 
 CPlayer::CPlayer()
 : m_pLocalPlayerInteractionPlugin(NULL)
+, m_hitDeathReactionsPendingTime(0.0f)
 , m_deferredKnockDownPending(false)
 , m_deferredKnockDownImpulse(0.0f)
 , m_carryObjId(0)
@@ -1586,6 +1588,8 @@ void CPlayer::Update(SEntityUpdateContext& ctx, int updateSlot)
 {
 	FUNCTION_PROFILER(GetISystem(), PROFILE_GAME);
 
+	CActorManager::SScopedUpdateCost updateCost(GetUpdateTier());
+
 #if ENABLE_RMI_BENCHMARK
 	if ( gEnv->bMultiplayer && IsClient() && ( g_pGameCVars->g_RMIBenchmarkInterval > 0 ) )
 	{
@@ -1765,7 +1769,16 @@ void CPlayer::Update(SEntityUpdateContext& ctx, int updateSlot)
 
 	if (m_pHitDeathReactions)
 	{
-		m_pHitDeathReactions->Update(frameTime);
+		// Outside of a reaction the update only polls for finished custom animations,
+		// so lower update tiers do that every 2nd or 4th frame (staggered per actor)
+		m_hitDeathReactionsPendingTime += frameTime;
+
+		const uint32 frameMask = (1 << GetUpdateTier()) - 1;
+		if (m_pHitDeathReactions->IsInReaction() || ((gEnv->nMainFrameID + GetEntityId()) & frameMask) == 0)
+		{
+			m_pHitDeathReactions->Update(m_hitDeathReactionsPendingTime);
+			m_hitDeathReactionsPendingTime = 0.0f;
+		}
 	}
 
 	if (m_pSprintStamina)
@@ -2258,6 +2271,10 @@ void CPlayer::SetIK( const SActorFrameMovementParams& frameMovementParams )
 	if (!pCharacter)
 		return;
 
+	// Distant actors that aren't rendered keep their last look and aim targets
+	if (GetUpdateTier() == eUT_Minimal)
+		return;
+
 	SMovementState curMovementState;
 	m_pMovementController->GetMovementState(curMovementState);
 
@@ -1622,6 +1622,7 @@ protected:
 	CTimeValue						m_netXPSendTime;
 
 	CHitDeathReactionsPtr m_pHitDeathReactions;
+	float m_hitDeathReactionsPendingTime;
 
 	SSerializedPlayerInput	m_recvPlayerInput;
 
@@ -27,6 +27,7 @@
 #include "PlaylistManager.h"
 #include "Utility/StringUtils.h"
 #include <CrySystem/ZLib/IZLibCompressor.h>
+#include <CryCore/CryCrc32.h>
 #include "GameCVars.h"
 #include <CrySystem/Profilers/IStatoscope.h>
 #include "DataPatchDownloader.h"
@@ -273,6 +274,7 @@ CTelemetryCollector::CTelemetryCollector() :
 	m_telemetryCompressGameLog = REGISTER_INT("g_telemetry_compress_gamelog", k_defaultTelemetryCompressGameLogs, 0, "Usage: g_telemetry_compress_gamelog <1/0>\nWith 1, game.log is gzipped and uploaded as game.log.gz to the server, otherwise it is uploaded raw");
 
 	m_telemetryUploadInProgress = REGISTER_INT("g_telemetry_upload_in_progress", 0, VF_NULL, "Usage: only used to communicate with Amble scripts/stress tester");
+	m_telemetryEventSampleInterval = REGISTER_FLOAT("g_telemetry_event_sample_interval", 0.0f, VF_NULL, "Usage: g_telemetry_event_sample_interval <seconds>\nMinimum time between two recorded events of the same name, events in between are dropped\n0 records every event");
 
 	REGISTER_COMMAND(k_telemetry_submitLogCommand, (ConsoleCommandFunc)SubmitGameLog, 0, "Saves the Game.log to the gamelogger server");
 	REGISTER_COMMAND(k_telemetry_getSessionIdCommand, (ConsoleCommandFunc)OutputSessionId, 0, "Outputs the current telemetry session id to the console");
@@ -363,6 +365,7 @@ CTelemetryCollector::~CTelemetryCollector()
 		ic->UnregisterVariable(m_telemetryUploadGameLog->GetName());
 		ic->UnregisterVariable(m_telemetryCompressGameLog->GetName());
 		ic->UnregisterVariable(m_telemetryUploadInProgress->GetName());
+		ic->UnregisterVariable(m_telemetryEventSampleInterval->GetName());
 		ic->RemoveCommand(k_telemetry_submitLogCommand);
 		ic->RemoveCommand(k_telemetry_getSessionIdCommand);
 	}
@@ -2092,11 +2095,23 @@ ITelemetryProducer::EResult CTelemetryFileReader::ProduceTelemetry(
 ITelemetryProducer::EResult CStreamedTelemetryProducer::ProduceTelemetry(char *pOutBuffer, int inMinRequired, int inBufferSize, int *pOutWritten)
 {
 	CRY_ASSERT(inMinRequired == 0);
-	if (!m_proxy->m_pendingData.empty())
+	CryAutoLock<CryMutex> lock(m_proxy->m_lock);
+
+	m_proxy->FlushPendingEvents();
+
+	const int available = (int)(m_proxy->m_pendingData.size() - m_proxy->m_readOffset);
+	if (available > 0)
 	{
-		*pOutWritten = min(inBufferSize, (int)m_proxy->m_pendingData.size());
-		memcpy(pOutBuffer, m_proxy->m_pendingData.c_str(), *pOutWritten);
-		m_proxy->m_pendingData.erase(0, *pOutWritten);
+		*pOutWritten = min(inBufferSize, available);
+		memcpy(pOutBuffer, m_proxy->m_pendingData.c_str() + m_proxy->m_readOffset, *pOutWritten);
+		m_proxy->m_readOffset += *pOutWritten;
+
+		// consume by offset and only drop the buffer once it has been read completely, rather than shifting the remainder each chunk
+		if (m_proxy->m_readOffset == m_proxy->m_pendingData.size())
+		{
+			m_proxy->m_pendingData.clear();
+			m_proxy->m_readOffset = 0;
+		}
 	}
 	else
 	{
@@ -2118,10 +2133,67 @@ ITelemetryProducer::EResult CStreamedTelemetryProducer::ProduceTelemetry(char *p
 
 void CStreamedTelemetryProxy::WriteString(const char* string)
 {
+	CryAutoLock<CryMutex> lock(m_lock);
+	FlushPendingEvents();		// keep the order of events and strings
 	m_pendingData.append(string);
 	m_pendingData.append("\n");
 }
 
+void CStreamedTelemetryProxy::WriteEvent(const char *eventName, float value, float time, float minInterval)
+{
+	CryAutoLock<CryMutex> lock(m_lock);
+
+	const int nameIdx = InternEventName(eventName);
+	SEventName& name = m_eventNames[nameIdx];
+	if (minInterval > 0.0f && (time - name.lastTime) < minInterval)
+	{
+		return;
+	}
+	name.lastTime = time;
+
+	SEventRecord record;
+	record.value = value;
+	record.time = time;
+	record.nameIdx = (uint16)nameIdx;
+	m_pendingEvents.push_back(record);
+}
+
+// caller must hold m_lock
+int CStreamedTelemetryProxy::InternEventName(const char *eventName)
+{
+	const uint32 crc = CCrc32::Compute(eventName);
+	const int numNames = m_eventNames.size();
+	for (int i = 0; i < numNames; ++i)
+	{
+		if (m_eventNames[i].crc == crc && m_eventNames[i].name.compare(eventName) == 0)
+		{
+			return i;
+		}
+	}
+
+	CRY_ASSERT_MESSAGE(numNames < 0xffff, "Too many telemetry event names");
+	SEventName name;
+	name.name = eventName;
+	name.crc = crc;
+	name.lastTime = -FLT_MAX;
+	m_eventNames.push_back(name);
+	return numNames;
+}
+
+// caller must hold m_lock
+void CStreamedTelemetryProxy::FlushPendingEvents()
+{
+	const int numEvents = m_pendingEvents.size();
+	for (int i = 0; i < numEvents; ++i)
+	{
+		const SEventRecord& record = m_pendingEvents[i];
+		char temp[512];
+		cry_sprintf(temp, "<event name='%s' value='%f' time='%f'/>\n", m_eventNames[record.nameIdx].name.c_str(), record.value, record.time);
+		m_pendingData.append(temp);
+	}
+	m_pendingEvents.clear();
+}
+
 void CStreamedTelemetryProxy::FormatString(const char *format, ...)
 {
 	char temp[4096]; // Limited to 4096 characters!
@@ -2205,7 +2277,7 @@ void CTelemetryCollector::LogEvent(const char* eventName, float value)
 		{
 			serverTimeInSeconds = pGameRules->GetServerTime() / 1000.0f;
 		}
-		m_eventsStream->FormatString("<event name='%s' value='%f' time='%f'/>", eventName, value, serverTimeInSeconds);
+		m_eventsStream->WriteEvent(eventName, value, serverTimeInSeconds, m_telemetryEventSampleInterval->GetFVal());
 	}
 	else
 	{
@@ -69,6 +69,7 @@ class CTelemetryCollector : public ITelemetryCollector, public ILevelSystemListe
 		ICVar					*m_telemetryUploadGameLog;
 		ICVar					*m_telemetryCompressGameLog;
 		ICVar					*m_telemetryUploadInProgress;
+		ICVar					*m_telemetryEventSampleInterval;
 
 		string					m_curSessionId;
 		string					m_websafeClientName;
@@ -611,20 +612,44 @@ class CTelemetryStreamCipher : public ITelemetryProducer
 
 // The proxy class exists because ITelemetryProducer is not reference counted and is owned by the telemetry collector
 // It could be deleted at any time and is not safe to keep a pointer to it once it has been submitted
+// Events are queued as small binary records with an interned name and are only turned into text when the stream is read
 class CStreamedTelemetryProxy : public CMultiThreadRefCount
 {
 	friend class CStreamedTelemetryProducer;
 public:
-	CStreamedTelemetryProxy() : m_finished(false) {}
+	CStreamedTelemetryProxy() : m_readOffset(0), m_finished(false) {}
 	~CStreamedTelemetryProxy() {}
 
 	void WriteString(const char *string);
 	void FormatString(const char *format, ...);
+	// events of the same name closer together than minInterval seconds are dropped, 0 records all of them
+	void WriteEvent(const char *eventName, float value, float time, float minInterval);
 	void CloseStream() { m_finished = true; }
 
 protected:
-	string m_pendingData;
-	bool m_finished;
+	struct SEventName
+	{
+		string	name;
+		uint32	crc;
+		float		lastTime;
+	};
+
+	struct SEventRecord
+	{
+		float		value;
+		float		time;
+		uint16	nameIdx;
+	};
+
+	int  InternEventName(const char *eventName);
+	void FlushPendingEvents();
+
+	CryMutex									m_lock;
+	std::vector<SEventName>		m_eventNames;
+	std::vector<SEventRecord>	m_pendingEvents;
+	string										m_pendingData;
+	size_t										m_readOffset;
+	bool											m_finished;
 };
 
 class CStreamedTelemetryProducer : public ITelemetryProducer
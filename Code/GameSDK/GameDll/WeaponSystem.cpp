@@ -408,6 +408,11 @@ void CWeaponSystem::OnLoadingStart(ILevelInfo *pLevel)
 void CWeaponSystem::OnLoadingComplete(ILevelInfo* pLevel)
 {
 	CCCPOINT(WeaponSystem_OnLoadingComplete);
+
+	if (!gEnv->IsEditor())
+	{
+		PrewarmPools();
+	}
 }
 
 //------------------------------------------------------------------------
@@ -1067,6 +1072,42 @@ void CWeaponSystem::DumpPoolSizes()
 	}
 }
 
+//------------------------------------------------------------------------
+void CWeaponSystem::PrewarmPools()
+{
+	// Spawning projectile entities during the first firefight causes hitches, so ammo that
+	// asks for it gets its pool filled while the level loads
+	for (TAmmoTypeParams::iterator it = m_ammoparams.begin(); it != m_ammoparams.end(); ++it)
+	{
+		const SAmmoParams *pAmmoParams = it->second.params;
+		if (!pAmmoParams || !pAmmoParams->reusable || pAmmoParams->poolSize <= 0)
+			continue;
+
+		// Same condition as in SpawnAmmo for local projectiles
+		if (pAmmoParams->serverSpawn || !(pAmmoParams->flags&(ENTITY_FLAG_CLIENT_ONLY|ENTITY_FLAG_SERVER_ONLY)))
+			continue;
+
+		IEntityClass *pClass = const_cast<IEntityClass*>(it->first);
+
+		std::vector<CProjectile*> projectiles;
+		for (int i = GetPoolSize(pClass); i < pAmmoParams->poolSize; ++i)
+		{
+			CProjectile *pProjectile = UseFromPool(pClass, pAmmoParams);
+			if (!pProjectile)
+				break;
+			projectiles.push_back(pProjectile);
+		}
+
+		for (std::vector<CProjectile*>::iterator projIt = projectiles.begin(); projIt != projectiles.end(); ++projIt)
+		{
+			// The lifetime and showtime timers started on spawn are restarted by ReInitFromPool
+			(*projIt)->GetEntity()->KillTimer(IEntity::KILL_ALL_TIMER);
+			ReturnToPool(*projIt);
+		}
+	}
+}
+
+//------------------------------------------------------------------------
 void CWeaponSystem::FreePools()
 {
 	while (!m_pools.empty())
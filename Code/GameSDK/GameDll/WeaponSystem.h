@@ -237,6 +237,7 @@ public:
 	bool ReturnToPool(CProjectile *pProjectile);
 	void RemoveFromPool(CProjectile *pProjectile);
 	void DumpPoolSizes();
+	void PrewarmPools();
 	void FreePools();
 
 	void OnResumeAfterHostMigration();
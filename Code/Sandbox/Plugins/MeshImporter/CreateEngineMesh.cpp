@@ -695,11 +695,153 @@ void CreateMesh(const SVertex* vertices, int nIndices, CMesh& outputMesh, SCreat
 	}
 }
 
-const char* CreateEngineMesh(
+// Vertex data of an FbxMesh, gathered by GatherEngineMeshSource().
+struct SEngineMeshSource
+{
+	std::vector<SVertex> vertices;
+	uint64               hash;
+
+	SEngineMeshSource()
+		: hash(0)
+	{}
+
+	bool operator==(const SEngineMeshSource& other) const
+	{
+		return hash == other.hash
+		       && vertices.size() == other.vertices.size()
+		       && (vertices.empty() || !memcmp(&vertices[0], &other.vertices[0], vertices.size() * sizeof(SVertex)));
+	}
+};
+
+void SEngineMeshSourceDeleter::operator()(SEngineMeshSource* pSource) const
+{
+	delete pSource;
+}
+
+namespace
+{
+
+// 64-bit FNV-1a.
+uint64 ComputeHash(const void* pData, size_t size)
+{
+	const uint8* const pBytes = static_cast<const uint8*>(pData);
+	uint64 hash = 14695981039346656037ULL;
+	for (size_t i = 0; i < size; ++i)
+	{
+		hash ^= pBytes[i];
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+// Engine meshes built by the last imports, so re-importing a file only rebuilds the meshes whose source data changed.
+// Entries that were not used since the previous call to Trim() are dropped.
+class CEngineMeshCache
+{
+public:
+	struct SEntry
+	{
+		SEngineMeshSource                   source;
+		std::vector<std::unique_ptr<CMesh>> meshes;
+		std::vector<int>                    uberMaterials;
+	};
+
+	static CEngineMeshCache& GetInstance()
+	{
+		static CEngineMeshCache theInstance;
+		return theInstance;
+	}
+
+	bool Find(const SEngineMeshSource& source, std::vector<std::unique_ptr<FbxTool::SDisplayMesh>>& outputMeshes)
+	{
+		AUTO_LOCK(m_lock);
+
+		const SEntry* pEntry = FindEntry(m_current, source);
+		if (!pEntry)
+		{
+			// Keep the entry alive for the next import.
+			const auto range = m_previous.equal_range(source.hash);
+			for (auto it = range.first; it != range.second; ++it)
+			{
+				if (it->second->source == source)
+				{
+					pEntry = it->second.get();
+					m_current.emplace(source.hash, std::move(it->second));
+					m_previous.erase(it);
+					break;
+				}
+			}
+		}
+
+		if (!pEntry)
+		{
+			return false;
+		}
+
+		for (size_t i = 0; i < pEntry->meshes.size(); ++i)
+		{
+			std::unique_ptr<FbxTool::SDisplayMesh> pDisplayMesh(new FbxTool::SDisplayMesh());
+			pDisplayMesh->pEngineMesh.reset(new CMesh());
+			pDisplayMesh->pEngineMesh->CopyFrom(*pEntry->meshes[i]);
+			pDisplayMesh->uberMaterial = pEntry->uberMaterials[i];
+			outputMeshes.emplace_back(std::move(pDisplayMesh));
+		}
+		return true;
+	}
+
+	void Store(const SEngineMeshSource& source, const std::vector<std::unique_ptr<FbxTool::SDisplayMesh>>& meshes)
+	{
+		std::unique_ptr<SEntry> pEntry(new SEntry());
+		pEntry->source = source;
+		for (const auto& pDisplayMesh : meshes)
+		{
+			pEntry->meshes.emplace_back(new CMesh());
+			pEntry->meshes.back()->CopyFrom(*pDisplayMesh->pEngineMesh);
+			pEntry->uberMaterials.push_back(pDisplayMesh->uberMaterial);
+		}
+
+		AUTO_LOCK(m_lock);
+		if (!FindEntry(m_current, source))
+		{
+			m_current.emplace(source.hash, std::move(pEntry));
+		}
+	}
+
+	void Trim()
+	{
+		AUTO_LOCK(m_lock);
+		m_previous = std::move(m_current);
+		m_current.clear();
+	}
+
+private:
+	typedef std::unordered_multimap<uint64, std::unique_ptr<SEntry>> TEntries;
+
+	static const SEntry* FindEntry(const TEntries& entries, const SEngineMeshSource& source)
+	{
+		const auto range = entries.equal_range(source.hash);
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			if (it->second->source == source)
+			{
+				return it->second.get();
+			}
+		}
+		return nullptr;
+	}
+
+	CryCriticalSection m_lock;
+	TEntries           m_current;
+	TEntries           m_previous;
+};
+
+} // namespace
+
+const char* GatherEngineMeshSource(
   const FbxMesh& inputMesh,
-  std::vector<std::unique_ptr<FbxTool::SDisplayMesh>>& outputMeshes,
   const FbxNode* pNode,
   const std::vector<std::unique_ptr<FbxTool::SMaterial>>& materials,
+  TEngineMeshSourcePtr& outputSource,
   SCreateEngineMeshStats* pStats)
 {
 	if (inputMesh.GetControlPointsCount() == 0)
@@ -713,10 +855,10 @@ const char* CreateEngineMesh(
 	}
 
 	ITimer* const pTimer = gEnv->pSystem->GetITimer();
-	const float totalStartTime = pTimer->GetAsyncCurTime();
 	float startTime, endTime;
 
-	std::vector<SVertex> vertices;
+	TEngineMeshSourcePtr pSource(new SEngineMeshSource());
+	std::vector<SVertex>& vertices = pSource->vertices;
 
 	startTime = pTimer->GetAsyncCurTime();
 	CreateDirectMesh(inputMesh, vertices);
@@ -724,6 +866,7 @@ const char* CreateEngineMesh(
 	if (pStats)
 	{
 		pStats->elapsedCreateDirectMesh += endTime - startTime;
+		pStats->elapsedTotal += endTime - startTime;
 	}
 
 	startTime = pTimer->GetAsyncCurTime();
@@ -732,9 +875,39 @@ const char* CreateEngineMesh(
 	if (pStats)
 	{
 		pStats->elapsedTranslateMaterialIndices += endTime - startTime;
+		pStats->elapsedTotal += endTime - startTime;
+	}
+
+	if (!vertices.empty())
+	{
+		pSource->hash = ComputeHash(&vertices[0], vertices.size() * sizeof(SVertex));
+	}
+
+	outputSource = std::move(pSource);
+	return nullptr;
+}
+
+void BuildEngineMeshes(
+  const SEngineMeshSource& source,
+  std::vector<std::unique_ptr<FbxTool::SDisplayMesh>>& outputMeshes,
+  SCreateEngineMeshStats* pStats)
+{
+	if (source.vertices.empty())
+	{
+		return;
+	}
+
+	CEngineMeshCache& cache = CEngineMeshCache::GetInstance();
+	if (cache.Find(source, outputMeshes))
+	{
+		return;
 	}
 
+	ITimer* const pTimer = gEnv->pSystem->GetITimer();
+	const float startTime = pTimer->GetAsyncCurTime();
+
 	// Group vertices by uber-material.
+	std::vector<SVertex> vertices(source.vertices);
 	std::sort(vertices.begin(), vertices.end(), CompareUberMaterial());
 
 	// All vertices of a sub-mesh share the same uber-material.
@@ -752,7 +925,6 @@ const char* CreateEngineMesh(
 	}
 	subMeshes.push_back(std::make_pair(firstVertex, (int)(vertices.size())));
 
-	startTime = pTimer->GetAsyncCurTime();
 	for (size_t i = 0; i < subMeshes.size(); ++i)
 	{
 		const int nIndices = subMeshes[i].second - subMeshes[i].first;
@@ -763,18 +935,37 @@ const char* CreateEngineMesh(
 		pDisplayMesh->uberMaterial = pFirstVertex->uberMaterial;
 		outputMeshes.emplace_back(std::move(pDisplayMesh));
 	}
-	endTime = pTimer->GetAsyncCurTime();
+
+	const float endTime = pTimer->GetAsyncCurTime();
 	if (pStats)
 	{
 		pStats->elapsedCreateMesh += endTime - startTime;
+		pStats->elapsedTotal += endTime - startTime;
 	}
 
-	const float totalEndTime = pTimer->GetAsyncCurTime();
-	if (pStats)
+	cache.Store(source, outputMeshes);
+}
+
+void TrimEngineMeshCache()
+{
+	CEngineMeshCache::GetInstance().Trim();
+}
+
+const char* CreateEngineMesh(
+  const FbxMesh& inputMesh,
+  std::vector<std::unique_ptr<FbxTool::SDisplayMesh>>& outputMeshes,
+  const FbxNode* pNode,
+  const std::vector<std::unique_ptr<FbxTool::SMaterial>>& materials,
+  SCreateEngineMeshStats* pStats)
+{
+	TEngineMeshSourcePtr pSource;
+	const char* const szError = GatherEngineMeshSource(inputMesh, pNode, materials, pSource, pStats);
+	if (szError)
 	{
-		pStats->elapsedTotal += totalEndTime - totalStartTime;
+		return szError;
 	}
 
+	BuildEngineMeshes(*pSource, outputMeshes, pStats);
 	return nullptr;
 }
 
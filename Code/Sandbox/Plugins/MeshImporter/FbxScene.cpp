@@ -7,6 +7,7 @@
 #include <CryMath/Cry_Geo.h>
 #include <Cry3DEngine/IIndexedMesh.h>
 #include <CrySystem/ITimer.h>
+#include <CryThreading/IJobManager.h>
 
 // To check for .mtl files in the current project root.
 #include <CrySystem/ISystem.h>
@@ -1204,26 +1205,61 @@ SNode* CScene::Initialize(const SFileImportDescriptor& desc)
 	}
 
 	// Create engine meshes.
+	// The FBX SDK is not thread-safe, so the mesh data is gathered here first.
 
-	for (auto& meshIt : m_meshes)
+	const int numMeshes = (int)m_meshes.size();
+	std::vector<TEngineMeshSourcePtr> meshSources(numMeshes);
+	for (int i = 0; i < numMeshes; ++i)
 	{
-		SMesh* const pMesh = meshIt.get();
+		SMesh* const pMesh = m_meshes[i].get();
 		const SNode* const pNode = pMesh->pNode;
 		FbxNode* const pFbxNode = associatedNodes[pNode->id];
 		FbxMesh* const pFbxMesh = associatedMeshes[pMesh->id];
 
-		std::vector<std::unique_ptr<SDisplayMesh>> displayMeshes;
-		const char* szError = CreateEngineMesh(*pFbxMesh, displayMeshes, pFbxNode, m_materials, &stats.createEngineMesh);
+		const char* szError = GatherEngineMeshSource(*pFbxMesh, pFbxNode, m_materials, meshSources[i], &stats.createEngineMesh);
 		if (szError)
 		{
 			LogPrintf("CreateEngineMesh() failed, %s\n", szError);
 		}
+	}
+
+	// Build the engine meshes in parallel, every job pulls meshes off the list until it's empty.
+	{
+		const float buildStartTime = pTimer->GetAsyncCurTime();
+
+		volatile int nextMesh = 0;
+		auto buildMeshes = [this, &meshSources, &nextMesh, numMeshes]()
+		{
+			for (int i = CryInterlockedIncrement(&nextMesh) - 1; i < numMeshes; i = CryInterlockedIncrement(&nextMesh) - 1)
+			{
+				if (meshSources[i])
+				{
+					BuildEngineMeshes(*meshSources[i], m_meshes[i]->displayMeshes);
+				}
+			}
+		};
+
+		const int numJobs = gEnv->pJobManager ? std::min((int)gEnv->pJobManager->GetNumWorkerThreads(), numMeshes) : 0;
+		if (numJobs > 1)
+		{
+			CryJobState jobState;
+			for (int j = 0; j < numJobs; ++j)
+			{
+				gEnv->pJobManager->AddLambdaJob("BuildEngineMeshes", buildMeshes, JobManager::eRegularPriority, &jobState);
+			}
+			jobState.Wait();
+		}
 		else
 		{
-			pMesh->displayMeshes = std::move(displayMeshes);
+			buildMeshes();
 		}
+
+		stats.createEngineMesh.elapsedCreateMesh += pTimer->GetAsyncCurTime() - buildStartTime;
 	}
 
+	// Meshes of previously imported scenes that are not part of this one are not needed anymore.
+	TrimEngineMeshCache();
+
 	desc.pCallbacks->OnProgressMessage("Indexing for user pointers...");
 
 	// Indexing for user pointers
@@ -757,6 +757,36 @@ struct SCreateMeshStats
 	static void Log(const SCreateMeshStats& stats);
 };
 
+// Vertex data gathered from an FbxMesh, input of BuildEngineMeshes().
+struct SEngineMeshSource;
+
+struct SEngineMeshSourceDeleter
+{
+	void operator()(SEngineMeshSource* pSource) const;
+};
+
+typedef std::unique_ptr<SEngineMeshSource, SEngineMeshSourceDeleter> TEngineMeshSourcePtr;
+
+// First stage of CreateEngineMesh(), reads the FBX mesh.
+// Must be called with exclusive access to the FBX SDK.
+// Returns nullptr on success, and error string otherwise.
+const char* GatherEngineMeshSource(
+  const FbxMesh& inputMesh,
+  const FbxNode* pNode,
+  const std::vector<std::unique_ptr<FbxTool::SMaterial>>& materials,
+  TEngineMeshSourcePtr& outputSource,
+  SCreateEngineMeshStats* pStats = nullptr);
+
+// Second stage of CreateEngineMesh(), does not touch the FBX SDK and can run on any thread.
+// Meshes built from the same source data during the current or previous import are copied from a cache.
+void BuildEngineMeshes(
+  const SEngineMeshSource& source,
+  std::vector<std::unique_ptr<FbxTool::SDisplayMesh>>& outputMeshes,
+  SCreateEngineMeshStats* pStats = nullptr);
+
+// Drops the cached engine meshes that were not used since the previous call.
+void TrimEngineMeshCache();
+
 // Returns nullptr on success, and error string otherwise.
 const char* CreateEngineMesh(
   const FbxMesh& inputMesh,
@@ -0,0 +1,544 @@
+// Copyright 2001-2017 Crytek GmbH / Crytek Group. All rights reserved.
+
+#include "StdAfx.h"
+#include "StatoscopeReader.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <lz4.h>
+
+namespace Statoscope
+{
+
+namespace
+{
+enum
+{
+	k_compactMagic     = 0x345a5453, // 'STZ4'
+	k_compactVersion   = 1,
+	k_maxBlockSize     = 64 * 1024,
+	k_endOfFrameMarker = 0xdeadbeef,
+	k_maxStringLength  = 64 * 1024 * 1024,
+};
+
+uint32_t ReadLE32(const char* p)
+{
+	const uint8_t* b = (const uint8_t*)p;
+	return b[0] | (b[1] << 8) | (b[2] << 16) | ((uint32_t)b[3] << 24);
+}
+
+uint32_t SwapEndian32(uint32_t v)
+{
+	return (v >> 24) | ((v >> 8) & 0xff00) | ((v << 8) & 0xff0000) | (v << 24);
+}
+}
+
+//////////////////////////////////////////////////////////////////////////
+CCompactStreamDecoder::CCompactStreamDecoder()
+	: m_state(eS_Detect)
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CCompactStreamDecoder::Feed(const void* pData, size_t size, std::vector<char>& out)
+{
+	const char* const pBytes = (const char*)pData;
+
+	switch (m_state)
+	{
+	case eS_Plain:
+		out.insert(out.end(), pBytes, pBytes + size);
+		return true;
+	case eS_Error:
+		return false;
+	default:
+		break;
+	}
+
+	m_pending.insert(m_pending.end(), pBytes, pBytes + size);
+
+	if (m_state == eS_Detect)
+	{
+		// a plain log starts with the endian flag, which is 0 or 1
+		if (m_pending.size() < 4)
+			return true;
+
+		if (ReadLE32(&m_pending[0]) != k_compactMagic)
+		{
+			m_state = eS_Plain;
+			out.insert(out.end(), m_pending.begin(), m_pending.end());
+			m_pending.clear();
+			return true;
+		}
+
+		if (m_pending.size() < 8)
+			return true;
+
+		if (ReadLE32(&m_pending[4]) != k_compactVersion)
+		{
+			m_state = eS_Error;
+			return false;
+		}
+
+		m_state = eS_Blocks;
+		m_pending.erase(m_pending.begin(), m_pending.begin() + 8);
+	}
+
+	size_t pos = 0;
+	while (m_pending.size() - pos >= 8)
+	{
+		const uint32_t uncompressedSize = ReadLE32(&m_pending[pos]);
+		const uint32_t storedSize = ReadLE32(&m_pending[pos + 4]);
+
+		if (uncompressedSize == 0 || uncompressedSize > k_maxBlockSize || storedSize > uncompressedSize)
+		{
+			m_state = eS_Error;
+			return false;
+		}
+
+		if (m_pending.size() - pos - 8 < storedSize)
+			break;
+
+		const char* const pBlock = &m_pending[pos + 8];
+		if (storedSize == uncompressedSize)
+		{
+			out.insert(out.end(), pBlock, pBlock + storedSize);
+		}
+		else
+		{
+			const size_t outPos = out.size();
+			out.resize(outPos + uncompressedSize);
+			if (LZ4_decompress_safe(pBlock, &out[outPos], (int)storedSize, (int)uncompressedSize) != (int)uncompressedSize)
+			{
+				out.resize(outPos);
+				m_state = eS_Error;
+				return false;
+			}
+		}
+
+		pos += 8 + storedSize;
+	}
+
+	m_pending.erase(m_pending.begin(), m_pending.begin() + pos);
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+struct CLogReader::SCursor
+{
+	const char* pPos;
+	const char* pEnd;
+	bool        bSwapEndian;
+	bool        bUnderrun;
+
+	bool Read(void* pOut, size_t size)
+	{
+		if ((size_t)(pEnd - pPos) < size)
+		{
+			bUnderrun = true;
+			return false;
+		}
+		memcpy(pOut, pPos, size);
+		pPos += size;
+		return true;
+	}
+
+	bool Read32(uint32_t& value)
+	{
+		if (!Read(&value, 4))
+			return false;
+		if (bSwapEndian)
+			value = SwapEndian32(value);
+		return true;
+	}
+
+	bool ReadInt(int32_t& value)
+	{
+		uint32_t v;
+		if (!Read32(v))
+			return false;
+		value = (int32_t)v;
+		return true;
+	}
+
+	bool ReadBool(bool& value)
+	{
+		uint8_t v;
+		if (!Read(&v, 1))
+			return false;
+		value = v != 0;
+		return true;
+	}
+
+	bool ReadBytes(std::vector<uint8_t>& out, uint32_t size)
+	{
+		if ((size_t)(pEnd - pPos) < size)
+		{
+			bUnderrun = true;
+			return false;
+		}
+		out.assign((const uint8_t*)pPos, (const uint8_t*)pPos + size);
+		pPos += size;
+		return true;
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////
+CLogReader::CLogReader()
+	: m_readPos(0)
+	, m_bHaveLogHeader(false)
+	, m_bSwapEndian(false)
+	, m_bStringPool(false)
+	, m_version(0)
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLogReader::Feed(const void* pData, size_t size)
+{
+	// drop what has been parsed already before the buffer grows again
+	if (m_readPos > 1024 * 1024)
+	{
+		m_data.erase(m_data.begin(), m_data.begin() + m_readPos);
+		m_readPos = 0;
+	}
+
+	if (!m_decoder.Feed(pData, size, m_data) && m_error.empty())
+		m_error = "corrupt compact stream";
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CLogReader::Fail(const char* szError)
+{
+	if (m_error.empty())
+		m_error = szError;
+	return false;
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CLogReader::ReadLogHeader(SCursor& cursor)
+{
+	uint8_t endian;
+	if (!cursor.Read(&endian, 1))
+		return false;
+	if (endian > 1)
+		return Fail("not a Statoscope log");
+
+	const bool bBigEndianHost = (*(const uint16_t*)"\0\1") == 1;
+	cursor.bSwapEndian = (endian == 1) != bBigEndianHost;
+
+	uint32_t version;
+	if (!cursor.Read32(version))
+		return false;
+	if (version != 2 && version != 3)
+		return Fail("unsupported Statoscope log version");
+
+	bool bStringPool;
+	if (!cursor.ReadBool(bStringPool))
+		return false;
+
+	m_bSwapEndian = cursor.bSwapEndian;
+	m_version = version;
+	m_bStringPool = bStringPool;
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CLogReader::ReadString(SCursor& cursor, const std::string*& pString, TNewStrings& newStrings)
+{
+	uint32_t crc = 0;
+	if (m_bStringPool)
+	{
+		if (!cursor.Read32(crc))
+			return false;
+
+		auto it = m_stringPool.find(crc);
+		if (it != m_stringPool.end())
+		{
+			pString = it->second.get();
+			return true;
+		}
+		for (const auto& entry : newStrings)
+		{
+			if (entry.first == crc)
+			{
+				pString = entry.second.get();
+				return true;
+			}
+		}
+	}
+
+	int32_t length;
+	if (!cursor.ReadInt(length))
+		return false;
+	if (length < 0 || length > (int32_t)k_maxStringLength)
+		return Fail("corrupt string");
+	if ((size_t)(cursor.pEnd - cursor.pPos) < (size_t)length)
+	{
+		cursor.bUnderrun = true;
+		return false;
+	}
+
+	newStrings.emplace_back(crc, std::unique_ptr<std::string>(new std::string(cursor.pPos, cursor.pPos + length)));
+	cursor.pPos += length;
+	pString = newStrings.back().second.get();
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+EReadResult CLogReader::ReadFrame(SFrame& frame)
+{
+	if (!m_error.empty())
+		return eRR_Error;
+
+	SCursor cursor;
+	cursor.pPos = m_data.data() + m_readPos;
+	cursor.pEnd = m_data.data() + m_data.size();
+	cursor.bSwapEndian = m_bSwapEndian;
+	cursor.bUnderrun = false;
+
+	const bool bHadLogHeader = m_bHaveLogHeader;
+	if (!m_bHaveLogHeader)
+	{
+		if (!ReadLogHeader(cursor))
+			return cursor.bUnderrun ? eRR_NeedMoreData : eRR_Error;
+		m_bHaveLogHeader = true;
+	}
+
+	// everything the frame changes is staged and only committed once the whole record has been read, so that a
+	// frame which isn't complete yet can be retried after the next Feed()
+	TNewStrings newStrings;
+	std::vector<SDataGroup> newGroups;
+	std::vector<std::vector<uint32_t>> deltaState;
+
+	auto fail = [&](const char* szError)
+	{
+		if (!bHadLogHeader)
+			m_bHaveLogHeader = false;
+		if (cursor.bUnderrun)
+			return eRR_NeedMoreData;
+		Fail(szError);
+		return eRR_Error;
+	};
+
+	frame.screenshot.clear();
+	frame.events.clear();
+
+	if (!cursor.ReadBool(frame.bHeader))
+		return fail("");
+
+	if (frame.bHeader)
+	{
+		bool bModuleInfo;
+		if (!cursor.ReadBool(bModuleInfo))
+			return fail("");
+		if (bModuleInfo)
+		{
+			int32_t numModules;
+			if (!cursor.ReadInt(numModules))
+				return fail("");
+			if (numModules != 0)
+				return fail("module information is not supported");
+		}
+
+		int32_t numGroups;
+		if (!cursor.ReadInt(numGroups))
+			return fail("");
+		if (numGroups < 0 || numGroups > 64)
+			return fail("corrupt data group header");
+
+		newGroups.resize(numGroups);
+		for (SDataGroup& group : newGroups)
+		{
+			const std::string* pPath;
+			if (!ReadString(cursor, pPath, newStrings))
+				return fail("corrupt data group path");
+			group.path = *pPath;
+
+			int32_t numElements;
+			if (!cursor.ReadInt(numElements))
+				return fail("");
+			if (numElements < 0 || numElements > 4096)
+				return fail("corrupt data group header");
+
+			group.numPathNames = (uint32_t)std::count(group.path.begin(), group.path.end(), '$');
+			group.elements.resize(numElements);
+			for (SElement& element : group.elements)
+			{
+				int32_t type;
+				if (!cursor.ReadInt(type))
+					return fail("");
+				if (type != eET_Float && type != eET_Int && type != eET_String)
+					return fail("unsupported data group element type");
+				element.type = (EElementType)type;
+
+				const std::string* pName;
+				if (!ReadString(cursor, pName, newStrings))
+					return fail("corrupt data group element name");
+				element.name = *pName;
+			}
+		}
+		deltaState.resize(numGroups);
+	}
+	else
+	{
+		deltaState = m_deltaState;
+	}
+
+	const std::vector<SDataGroup>& groups = frame.bHeader ? newGroups : m_groups;
+
+	uint32_t timeBits;
+	if (!cursor.Read32(timeBits))
+		return fail("");
+	memcpy(&frame.time, &timeBits, sizeof(frame.time));
+
+	int32_t screenshotType;
+	if (!cursor.ReadInt(screenshotType))
+		return fail("");
+	if (screenshotType == eET_B64Texture)
+	{
+		int32_t screenshotSize;
+		if (!cursor.ReadInt(screenshotSize))
+			return fail("");
+		if (screenshotSize < 0)
+			return fail("corrupt screenshot");
+		if (!cursor.ReadBytes(frame.screenshot, (uint32_t)screenshotSize))
+			return fail("");
+	}
+	else if (screenshotType != eET_None)
+	{
+		return fail("corrupt screenshot");
+	}
+
+	frame.groups.resize(groups.size());
+	for (size_t g = 0; g < groups.size(); ++g)
+	{
+		const SDataGroup& group = groups[g];
+		SGroupRecord& record = frame.groups[g];
+		std::vector<uint32_t>& state = deltaState[g];
+
+		int32_t numDataSets;
+		if (!cursor.ReadInt(numDataSets))
+			return fail("");
+		if (numDataSets < 0)
+			return fail("corrupt data group record");
+		const size_t valuesPerDataSet = group.GetValuesPerDataSet();
+		if (numDataSets > 0 && valuesPerDataSet == 0)
+			return fail("corrupt data group record");
+
+		record.numDataSets = numDataSets;
+		record.values.resize((size_t)numDataSets * valuesPerDataSet);
+
+		size_t deltaIndex = 0;
+		for (size_t v = 0; v < record.values.size(); ++v)
+		{
+			SValue& value = record.values[v];
+			value.pString = NULL;
+
+			const size_t index = v % valuesPerDataSet;
+			if (index < group.numPathNames || group.elements[index - group.numPathNames].type == eET_String)
+			{
+				value.i = 0;
+				if (!ReadString(cursor, value.pString, newStrings))
+					return fail("corrupt string value");
+				continue;
+			}
+
+			uint32_t bits;
+			if (!cursor.Read32(bits))
+				return fail("");
+
+			if (m_version >= 3)
+			{
+				if (deltaIndex < state.size())
+				{
+					bits ^= state[deltaIndex];
+					state[deltaIndex] = bits;
+				}
+				else
+				{
+					state.push_back(bits);
+				}
+				++deltaIndex;
+			}
+
+			memcpy(&value.i, &bits, sizeof(bits));
+		}
+
+		if (m_version >= 3)
+			state.resize(deltaIndex);
+	}
+
+	uint32_t eventsSize;
+	if (!cursor.Read32(eventsSize))
+		return fail("");
+	if (!cursor.ReadBytes(frame.events, eventsSize))
+		return fail("");
+
+	uint32_t marker;
+	if (!cursor.Read32(marker))
+		return fail("");
+	if (marker != k_endOfFrameMarker)
+		return fail("missing end of frame marker");
+
+	// commit, the frame's string values already point at the staged strings
+	for (auto& entry : newStrings)
+	{
+		if (m_bStringPool)
+			m_stringPool[entry.first] = std::move(entry.second);
+		else
+			m_plainStrings.push_back(std::move(entry.second));
+	}
+
+	if (frame.bHeader)
+		m_groups.swap(newGroups);
+	m_deltaState.swap(deltaState);
+	m_readPos = cursor.pPos - m_data.data();
+	return eRR_Frame;
+}
+
+//////////////////////////////////////////////////////////////////////////
+int ReadLogFile(const char* szFileName, const std::function<bool(const CLogReader&, const SFrame&)>& callback)
+{
+	FILE* const pFile = fopen(szFileName, "rb");
+	if (!pFile)
+		return -1;
+
+	CLogReader reader;
+	SFrame frame;
+	std::vector<char> buffer(256 * 1024);
+	int numFrames = 0;
+	bool bStop = false;
+
+	while (!bStop)
+	{
+		const size_t numRead = fread(buffer.data(), 1, buffer.size(), pFile);
+		if (numRead == 0)
+			break;
+		reader.Feed(buffer.data(), numRead);
+
+		for (;; )
+		{
+			const EReadResult result = reader.ReadFrame(frame);
+			if (result == eRR_NeedMoreData)
+				break;
+			if (result == eRR_Error)
+			{
+				fclose(pFile);
+				return -1;
+			}
+			++numFrames;
+			if (!callback(reader, frame))
+			{
+				bStop = true;
+				break;
+			}
+		}
+	}
+
+	fclose(pFile);
+	return numFrames;
+}
+
+}
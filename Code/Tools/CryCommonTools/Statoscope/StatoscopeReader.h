@@ -0,0 +1,178 @@
+// Copyright 2001-2017 Crytek GmbH / Crytek Group. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Reader for Statoscope logs (CrySystem/Statoscope.cpp), for offline analysis of captures written to file or
+// streamed from a socket (e_StatoscopeLogDestination 1, port 29527 by default). Only depends on lz4, so it can
+// be dropped into any tool.
+//
+// Plain logs and compact logs (e_StatoscopeCompactFormat 1) are both understood, the reader tells them apart by
+// the first four bytes.
+//
+// Compact stream container, little endian:
+//   uint32 magic 'STZ4' (0x345a5453), uint32 container version (1)
+//   blocks of { uint32 uncompressedSize, uint32 storedSize, storedSize bytes }, each at most 64 KB uncompressed.
+//   storedSize == uncompressedSize means the block is stored, otherwise it's a single LZ4 block.
+//   Every block is independent and the concatenated blocks form the plain log.
+//
+// Plain log, written in the endianness given by its first byte:
+//   char endian (0 = little, 1 = big), uint32 version (2 = plain, 3 = delta coded values), bool stringPool
+//   then frame records until the end of the stream:
+//     bool header
+//       if header: bool moduleInfo (+ int 0), int numGroups, per group { str path, int numElements,
+//       per element { int type, str name } }; a header also restarts the delta coding of all groups
+//     float time
+//     int screenshotType; if B64Texture: int size, size bytes (width, height, scale, RGB8 pixels)
+//     per data group of the last header: int numDataSets, per data set one str for every '$' in the group path
+//     (the instance names, e.g. '/UserMarkers/$') followed by numElements values
+//       Float / Int: 4 bytes; with version 3 XORed with the value at the same position of the group's previous record
+//       String: str
+//     uint32 eventStreamSize, eventStreamSize bytes (interval events)
+//     uint32 0xdeadbeef
+//   str is { int length, chars } or, with the string pool, { uint32 crc32 } followed by { int length, chars } the
+//   first time the crc appears in the log.
+//
+// Usage:
+//   Statoscope::ReadLogFile("perf.bin", [](const Statoscope::CLogReader& reader, const Statoscope::SFrame& frame)
+//   {
+//     const std::vector<Statoscope::SDataGroup>& groups = reader.GetDataGroups();
+//     ... frame.groups[i] holds the values of groups[i] ...
+//     return true; // keep reading
+//   });
+// or, for a socket, Feed() whatever recv() returned and call ReadFrame() until it returns eRR_NeedMoreData.
+namespace Statoscope
+{
+
+// must match StatoscopeDataWriter::EFrameElementType
+enum EElementType
+{
+	eET_None = 0,
+	eET_Float,
+	eET_Int,
+	eET_String,
+	eET_B64Texture,
+	eET_Int64
+};
+
+struct SElement
+{
+	EElementType type;
+	std::string  name;
+};
+
+struct SDataGroup
+{
+	std::string           path;
+	std::vector<SElement> elements;
+	uint32_t              numPathNames; // '$' in the path, every data set starts with a string for each
+
+	size_t                GetValuesPerDataSet() const { return numPathNames + elements.size(); }
+};
+
+struct SValue
+{
+	union
+	{
+		float   f;
+		int32_t i;
+	};
+	const std::string* pString; // eET_String only, owned by the reader's string pool
+};
+
+struct SGroupRecord
+{
+	uint32_t            numDataSets;
+	std::vector<SValue> values; // numDataSets * SDataGroup::GetValuesPerDataSet(), path names first
+};
+
+struct SFrame
+{
+	float                     time;
+	bool                      bHeader;    // the data group layout was (re)defined by this frame
+	std::vector<uint8_t>      screenshot; // empty if the frame has none
+	std::vector<SGroupRecord> groups;     // parallel to CLogReader::GetDataGroups()
+	std::vector<uint8_t>      events;     // raw interval event stream
+};
+
+// Undoes the compact stream container, plain streams are passed through unchanged.
+class CCompactStreamDecoder
+{
+public:
+	CCompactStreamDecoder();
+
+	// Appends the decoded bytes to out, returns false on a corrupt stream.
+	bool Feed(const void* pData, size_t size, std::vector<char>& out);
+	bool IsCompact() const { return m_state == eS_Blocks; }
+
+private:
+	enum EState
+	{
+		eS_Detect,
+		eS_Plain,
+		eS_Blocks,
+		eS_Error
+	};
+
+	EState            m_state;
+	std::vector<char> m_pending;
+};
+
+enum EReadResult
+{
+	eRR_Frame,
+	eRR_NeedMoreData,
+	eRR_Error
+};
+
+class CLogReader
+{
+public:
+	CLogReader();
+
+	// Bytes as written by the engine, in any chunk size.
+	void                           Feed(const void* pData, size_t size);
+
+	// Parses the next complete frame record. Nothing is consumed unless the result is eRR_Frame.
+	EReadResult                    ReadFrame(SFrame& frame);
+
+	const std::vector<SDataGroup>& GetDataGroups() const { return m_groups; }
+	uint32_t                       GetVersion() const    { return m_version; }
+	bool                           IsCompact() const     { return m_decoder.IsCompact(); }
+	const char*                    GetError() const      { return m_error.c_str(); }
+
+private:
+	struct SCursor;
+	typedef std::vector<std::pair<uint32_t, std::unique_ptr<std::string>>> TNewStrings;
+
+	bool ReadLogHeader(SCursor& cursor);
+	bool ReadString(SCursor& cursor, const std::string*& pString, TNewStrings& newStrings);
+	bool Fail(const char* szError);
+
+	CCompactStreamDecoder                                         m_decoder;
+	std::vector<char>                                             m_data;
+	size_t                                                        m_readPos;
+
+	bool                                                          m_bHaveLogHeader;
+	bool                                                          m_bSwapEndian;
+	bool                                                          m_bStringPool;
+	uint32_t                                                      m_version;
+
+	std::vector<SDataGroup>                                       m_groups;
+	std::vector<std::vector<uint32_t>>                            m_deltaState;
+	std::unordered_map<uint32_t, std::unique_ptr<std::string>>    m_stringPool;
+	std::vector<std::unique_ptr<std::string>>                     m_plainStrings;
+	std::string                                                   m_error;
+};
+
+// Reads a log file frame by frame, the callback returns false to stop. Returns the number of frames read or -1
+// if the log couldn't be opened or is corrupt. A log cut off in the middle of a frame (crash) is not an error.
+int ReadLogFile(const char* szFileName, const std::function<bool(const CLogReader&, const SFrame&)>& callback);
+
+}
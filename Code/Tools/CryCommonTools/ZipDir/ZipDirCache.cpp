@@ -120,7 +120,10 @@ ZipDir::ErrorEnum ZipDir::Cache::ReadFile (FileEntry* pFileEntry, void* pCompres
 		else
 		{
 			unsigned long nSizeUncompressed = pFileEntry->desc.lSizeUncompressed;
-			if (Z_OK != ZipRawUncompress(pUncompressed, &nSizeUncompressed, pBuffer, pFileEntry->desc.lSizeCompressed))
+			const int nError = pFileEntry->IsBlockCompressed()
+				? ZipRawUncompressBlocks(pFileEntry->nMethod, pUncompressed, &nSizeUncompressed, pBuffer, pFileEntry->desc.lSizeCompressed)
+				: ZipRawUncompress(pUncompressed, &nSizeUncompressed, pBuffer, pFileEntry->desc.lSizeCompressed);
+			if (Z_OK != nError)
 				return ZD_ERROR_CORRUPTED_DATA;
 		}
 	}
@@ -659,7 +659,11 @@ void ZipDir::CacheFactory::Validate(const FileEntry& fileEntry)
 
 	unsigned long nDestSize = fileEntry.desc.lSizeUncompressed;
 	int nError = Z_OK;
-	if (fileEntry.nMethod)
+	if (fileEntry.IsBlockCompressed())
+	{
+		nError = ZipRawUncompressBlocks (fileEntry.nMethod, pUncompressed, &nDestSize, pCompressed, fileEntry.desc.lSizeCompressed);
+	}
+	else if (fileEntry.nMethod)
 	{
 		nError = ZipRawUncompress (pUncompressed, &nDestSize, pCompressed, fileEntry.desc.lSizeCompressed);
 	}
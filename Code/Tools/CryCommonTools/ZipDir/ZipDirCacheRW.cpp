@@ -39,6 +39,7 @@ struct PackFileBatch
 	int sourceMaxSize;
 	int compressionMethod;
 	int compressionLevel;
+	unsigned blockSize; // METHOD_LZ4_BLOCKS and METHOD_ZSTD_BLOCKS
 
 	PackFileBatch()
 	: pool(0)
@@ -47,6 +48,7 @@ struct PackFileBatch
 	, zipMaxSize(0)
 	, compressionMethod(0)
 	, compressionLevel(0)
+	, blockSize(0)
 	{
 	}
 };
@@ -457,6 +459,24 @@ static void PackFileFromMemory(PackFileJob* job)
 		}
 		break;
 	}
+	case METHOD_LZ4_BLOCKS:
+	case METHOD_ZSTD_BLOCKS:
+	{
+		job->compressedSize = ZipDir::ZipRawCompressBlocksBound(job->uncompressedSize, job->batch->blockSize);
+		job->compressedData = malloc(job->compressedSize);
+		int error = ZipDir::ZipRawCompressBlocks(job->batch->compressionMethod, job->uncompressedData, &job->compressedSize, job->compressedData, job->uncompressedSize, job->batch->compressionLevel, job->batch->blockSize);
+		if (error == Z_OK)
+		{
+			job->status = PACKFILE_COMPRESSED;
+			job->zdError = ZipDir::ZD_ERROR_SUCCESS;
+		}
+		else
+		{
+			job->status = PACKFILE_FAILED;
+			job->zdError = error == Z_STREAM_ERROR ? ZipDir::ZD_ERROR_UNSUPPORTED : ZipDir::ZD_ERROR_ZLIB_FAILED;
+		}
+		break;
+	}
 	case METHOD_STORE:
 		job->compressedData = job->uncompressedData;
 		job->compressedSize = job->uncompressedSize;
@@ -792,13 +812,16 @@ static void PackFileFromDisc(PackFileJob* job)
 
 bool ZipDir::CacheRW::UpdateMultipleFiles(const char** realFilenames, const char** filenamesInZip, size_t fileCount,
 																					int compressionLevel, bool encryptContent, size_t zipMaxSize, int sourceMinSize, int sourceMaxSize,
-																					int numExtraThreads, ZipDir::IReporter* reporter, ZipDir::ISplitter* splitter)
+																					int numExtraThreads, ZipDir::IReporter* reporter, ZipDir::ISplitter* splitter,
+																					int blockCompressionMethod, unsigned blockSize)
 {
 	int compressionMethod = METHOD_DEFLATE;
 	if (encryptContent)
 		compressionMethod = METHOD_DEFLATE_AND_ENCRYPT;
 	else if (compressionLevel == 0)
 		compressionMethod = METHOD_STORE;
+	else if (blockCompressionMethod != METHOD_STORE && blockSize > 0)
+		compressionMethod = blockCompressionMethod;
 
 	uint64 totalSize = 0;
 
@@ -807,6 +830,7 @@ bool ZipDir::CacheRW::UpdateMultipleFiles(const char** realFilenames, const char
 	PackFileBatch batch;
 	batch.compressionLevel = compressionLevel;
 	batch.compressionMethod = compressionMethod;
+	batch.blockSize = blockSize;
 	batch.pool = 0;
 	batch.sourceMinSize = sourceMinSize;
 	batch.sourceMaxSize = sourceMaxSize;
@@ -1377,7 +1401,10 @@ ZipDir::ErrorEnum ZipDir::CacheRW::ReadFile (FileEntry* pFileEntry, void* pCompr
 			unsigned long nSizeUncompressed = pFileEntry->desc.lSizeUncompressed;
 			if (nSizeUncompressed > 0)
 			{
-				if (Z_OK != ZipRawUncompress(pUncompressed, &nSizeUncompressed, pBuffer, pFileEntry->desc.lSizeCompressed))
+				const int nError = pFileEntry->IsBlockCompressed()
+					? ZipRawUncompressBlocks(pFileEntry->nMethod, pUncompressed, &nSizeUncompressed, pBuffer, pFileEntry->desc.lSizeCompressed)
+					: ZipRawUncompress(pUncompressed, &nSizeUncompressed, pBuffer, pFileEntry->desc.lSizeCompressed);
+				if (Z_OK != nError)
 					return ZD_ERROR_CORRUPTED_DATA;
 			}
 		}
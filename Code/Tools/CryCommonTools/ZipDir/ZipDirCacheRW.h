@@ -97,9 +97,12 @@ public:
 	bool EncryptArchive(EncryptionChange change, IEncryptPredicate* encryptContentPredicate, int* numChanged, int* numSkipped);
 
 	// Adds or updates a bunch of files. Creates directories if needed. Multithreaded when numExtraThreads > 0
+	// The files are compressed as independent blocks of blockSize bytes when blockCompressionMethod
+	// is METHOD_LZ4_BLOCKS or METHOD_ZSTD_BLOCKS, unless they are stored or encrypted
 	bool UpdateMultipleFiles(const char** realFilenames, const char** filenamesInZip, size_t fileCount,
 													 int compressionLevel, bool encryptContent, size_t zipMaxSize, int sourceMinSize, int sourceMaxSize,
-													 int numExtraThreads, ZipDir::IReporter* reporter, ZipDir::ISplitter* splitter = NULL);
+													 int numExtraThreads, ZipDir::IReporter* reporter, ZipDir::ISplitter* splitter = NULL,
+													 int blockCompressionMethod = ZipFile::METHOD_STORE, unsigned blockSize = 0);
 
 	//   Adds a new file to the zip or update an existing one if it is not compressed - just stored  - start a big file
 	ErrorEnum StartContinuousFileUpdate(const char* szRelativePath, unsigned nSize);
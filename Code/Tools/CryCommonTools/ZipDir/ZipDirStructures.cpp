@@ -1,7 +1,13 @@
 // Copyright 2001-2017 Crytek GmbH / Crytek Group. All rights reserved.
 
 #include "StdAfx.h"
+#include "Util.h"
 #include <zlib.h>
+#include <lz4.h>
+#include <lz4hc.h>
+#if defined(SUPPORT_ZSTD_PAKS)
+	#include <zstd.h>
+#endif
 #include "ZipFileFormat.h"
 #include "ZipDirStructures.h"
 #include <time.h>
@@ -98,6 +104,132 @@ int ZipDir::ZipRawCompress (const void* pUncompressed, unsigned long* pDestSize,
 	return err;
 }
 
+unsigned long ZipDir::ZipRawCompressBlocksBound (unsigned long nSrcSize, unsigned nBlockSize)
+{
+	const unsigned long nNumBlocks = (nSrcSize + nBlockSize - 1) / nBlockSize;
+	return sizeof(ZipFile::BlockCompressionHeader) + nNumBlocks * sizeof(uint32) + nSrcSize;
+}
+
+int ZipDir::ZipRawCompressBlocks (int nMethod, const void* pUncompressed, unsigned long* pDestSize, void* pCompressed, unsigned long nSrcSize, int nLevel, unsigned nBlockSize)
+{
+	if (nBlockSize == 0 || *pDestSize < ZipRawCompressBlocksBound(nSrcSize, nBlockSize))
+		return Z_BUF_ERROR;
+
+	ZipFile::BlockCompressionHeader* pHeader = (ZipFile::BlockCompressionHeader*)pCompressed;
+	pHeader->nBlockSize = nBlockSize;
+	pHeader->nNumBlocks = (uint32)((nSrcSize + nBlockSize - 1) / nBlockSize);
+
+	uint32* pBlockSizes = (uint32*)(pHeader + 1);
+	char* pDst = (char*)(pBlockSizes + pHeader->nNumBlocks);
+	const char* pSrc = (const char*)pUncompressed;
+
+	std::vector<char> block;
+	for (uint32 i = 0; i < pHeader->nNumBlocks; ++i)
+	{
+		const int nSize = (int)Util::getMin((unsigned long)nBlockSize, nSrcSize - i * nBlockSize);
+		int nCompressedSize = 0;
+
+		switch (nMethod)
+		{
+		case METHOD_LZ4_BLOCKS:
+			block.resize(LZ4_compressBound(nSize));
+			nCompressedSize = nLevel > 1
+				? LZ4_compress_HC(pSrc, &block[0], nSize, (int)block.size(), nLevel)
+				: LZ4_compress_default(pSrc, &block[0], nSize, (int)block.size());
+			break;
+
+#if defined(SUPPORT_ZSTD_PAKS)
+		case METHOD_ZSTD_BLOCKS:
+			{
+				block.resize(ZSTD_compressBound(nSize));
+				const size_t nResult = ZSTD_compress(&block[0], block.size(), pSrc, nSize, nLevel);
+				if (ZSTD_isError(nResult))
+					return Z_DATA_ERROR;
+				nCompressedSize = (int)nResult;
+			}
+			break;
+#endif
+
+		default:
+			return Z_STREAM_ERROR;
+		}
+
+		// the reader takes a block of the uncompressed size as stored
+		if (nCompressedSize <= 0 || nCompressedSize >= nSize)
+		{
+			memcpy(pDst, pSrc, nSize);
+			nCompressedSize = nSize;
+		}
+		else
+		{
+			memcpy(pDst, &block[0], nCompressedSize);
+		}
+
+		pBlockSizes[i] = nCompressedSize;
+		pDst += nCompressedSize;
+		pSrc += nSize;
+	}
+
+	*pDestSize = (unsigned long)(pDst - (char*)pCompressed);
+	return Z_OK;
+}
+
+int ZipDir::ZipRawUncompressBlocks (int nMethod, void* pUncompressed, unsigned long* pDestSize, const void* pCompressed, unsigned long nSrcSize)
+{
+	if (nSrcSize < sizeof(ZipFile::BlockCompressionHeader))
+		return Z_DATA_ERROR;
+
+	const ZipFile::BlockCompressionHeader* pHeader = (const ZipFile::BlockCompressionHeader*)pCompressed;
+	const uint64 nTableSize = sizeof(ZipFile::BlockCompressionHeader) + (uint64)pHeader->nNumBlocks * sizeof(uint32);
+	if (pHeader->nBlockSize == 0 || nTableSize > nSrcSize || (uint64)pHeader->nNumBlocks * pHeader->nBlockSize < *pDestSize)
+		return Z_DATA_ERROR;
+
+	const uint32* pBlockSizes = (const uint32*)(pHeader + 1);
+	const char* pSrc = (const char*)pCompressed + nTableSize;
+	const char* pSrcEnd = (const char*)pCompressed + nSrcSize;
+	char* pDst = (char*)pUncompressed;
+	unsigned long nLeft = *pDestSize;
+
+	for (uint32 i = 0; i < pHeader->nNumBlocks && nLeft; ++i)
+	{
+		const int nSize = (int)Util::getMin((unsigned long)pHeader->nBlockSize, nLeft);
+		const int nCompressedSize = (int)pBlockSizes[i];
+		if (nCompressedSize > pSrcEnd - pSrc)
+			return Z_DATA_ERROR;
+
+		if (nCompressedSize == nSize)
+		{
+			memcpy(pDst, pSrc, nSize);
+		}
+		else
+		{
+			switch (nMethod)
+			{
+			case METHOD_LZ4_BLOCKS:
+				if (LZ4_decompress_safe(pSrc, pDst, nCompressedSize, nSize) != nSize)
+					return Z_DATA_ERROR;
+				break;
+
+#if defined(SUPPORT_ZSTD_PAKS)
+			case METHOD_ZSTD_BLOCKS:
+				if (ZSTD_decompress(pDst, nSize, pSrc, nCompressedSize) != (size_t)nSize)
+					return Z_DATA_ERROR;
+				break;
+#endif
+
+			default:
+				return Z_STREAM_ERROR;
+			}
+		}
+
+		pSrc += nCompressedSize;
+		pDst += nSize;
+		nLeft -= nSize;
+	}
+
+	return nLeft ? Z_DATA_ERROR : Z_OK;
+}
+
 // finds the subdirectory entry by the name, using the names from the name pool
 // assumes: all directories are sorted in alphabetical order.
 // case-sensitive (must be lower-case if case-insensitive search in Win32 is performed)
@@ -56,6 +56,8 @@ namespace ZipFile
 		METHOD_DEFLATE_AND_STREAMCIPHER          = 12, // Deflate + stream cipher encryption on a per file basis
 		METHOD_STORE_AND_STREAMCIPHER_KEYTABLE   = 13, // Store + Timur's encryption technique on a per file basis
 		METHOD_DEFLATE_AND_STREAMCIPHER_KEYTABLE = 14, // Deflate + Timur's encryption technique on a per file basis
+		METHOD_LZ4_BLOCKS                        = 15, // Independent LZ4 blocks, see BlockCompressionHeader (CryEngine specific)
+		METHOD_ZSTD_BLOCKS                       = 16, // Independent Zstandard blocks, see BlockCompressionHeader (CryEngine specific)
 	};
 
 	// version numbers
@@ -415,6 +417,18 @@ namespace ZipFile
 		CryCustomExtendedHeader() : nHeaderSize(0), nEncryption(0) {}
 	} PACK_GCC;
 
+	// the data of a METHOD_LZ4_BLOCKS or METHOD_ZSTD_BLOCKS file starts with this header
+	// followed by:
+	//    compressed size of every block (nNumBlocks * uint32)
+	//    the blocks, each of them can be decompressed on its own
+	// every block except the last one decompresses to nBlockSize bytes, a block with a compressed
+	// size equal to its uncompressed size didn't compress and is stored as is
+	struct BlockCompressionHeader
+	{
+		uint32 nBlockSize;
+		uint32 nNumBlocks;
+	} PACK_GCC;
+
 }
 
 #undef PACK_GCC
@@ -188,6 +188,18 @@ extern int ZipRawUncompress (void* pUncompressed, unsigned long* pDestSize, cons
 // returns one of the Z_* errors (Z_OK upon success), and the size in *pDestSize. the pCompressed buffer must be at least nSrcSize*1.001+12 size
 extern int ZipRawCompress (const void* pUncompressed, unsigned long* pDestSize, void* pCompressed, unsigned long nSrcSize, int nLevel);
 
+// size of the buffer ZipRawCompressBlocks() needs in the worst case
+extern unsigned long ZipRawCompressBlocksBound (unsigned long nSrcSize, unsigned nBlockSize);
+
+// compresses the raw data into independent blocks of nBlockSize bytes with METHOD_LZ4_BLOCKS or METHOD_ZSTD_BLOCKS,
+// see ZipFile::BlockCompressionHeader. Blocks which don't compress are stored as is.
+// returns one of the Z_* errors (Z_OK upon success), and the size in *pDestSize. the pCompressed buffer must be at least ZipRawCompressBlocksBound() size
+extern int ZipRawCompressBlocks (int nMethod, const void* pUncompressed, unsigned long* pDestSize, void* pCompressed, unsigned long nSrcSize, int nLevel, unsigned nBlockSize);
+
+// Uncompresses data compressed with ZipRawCompressBlocks()
+// returns one of the Z_* errors (Z_OK upon success)
+extern int ZipRawUncompressBlocks (int nMethod, void* pUncompressed, unsigned long* pDestSize, const void* pCompressed, unsigned long nSrcSize);
+
 //////////////////////////////////////////////////////////////////////////
 struct SExtraZipFileData
 {
@@ -242,6 +254,11 @@ struct FileEntry
 	{
 		return pNamePool + nNameOffset;
 	}
+	// compressed as independent blocks, see ZipFile::BlockCompressionHeader
+	bool IsBlockCompressed() const
+	{
+		return nMethod == ZipFile::METHOD_LZ4_BLOCKS || nMethod == ZipFile::METHOD_ZSTD_BLOCKS;
+	}
 
 	// sets the current time to modification time
 	// calculates CRC32 for the new data
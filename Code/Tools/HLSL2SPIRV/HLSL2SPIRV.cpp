@@ -2,6 +2,10 @@
 
 #include <windows.h>
 #include <vector>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <algorithm>
 #include "Log.h"
 #include "DXBC.h"
 #include "CompilerData.h"
@@ -124,7 +128,8 @@ bool RunHLSLcc(const SCompilerData& compilerData, bool remoteCompile)
 	}
 	else
 	{
-		std::string parameters = std::string("-lang=440 -flags=") + flags + " -fxc=\"..\\..\\Tools\\RemoteShaderCompiler\\Compiler\\PCD3D11\\v007\\fxc.exe /nologo /E " + compilerData.request.entryName + " /T " + compilerData.request.profileName + " /Zpr /Gec /Fo\" -out=" + outputFilename + " -in=" + sourceFilename;
+		// Local batch runs translate the same permutations over and over, so let HLSLcc reuse earlier results
+		std::string parameters = std::string("-lang=440 -flags=") + flags + " -fxc=\"..\\..\\Tools\\RemoteShaderCompiler\\Compiler\\PCD3D11\\v007\\fxc.exe /nologo /E " + compilerData.request.entryName + " /T " + compilerData.request.profileName + " /Zpr /Gec /Fo\" -cache=..\\..\\Tools\\RemoteShaderCompiler\\Compiler\\PCGL\\V013\\TranslationCache -out=" + outputFilename + " -in=" + sourceFilename;
 		return ShellExecute("..\\..\\Tools\\RemoteShaderCompiler\\Compiler\\PCGL\\V013\\HLSLcc.exe", parameters);
 	}
 }
@@ -196,7 +201,7 @@ bool ProcessFile(const std::string& dataFilename, const std::string& outputFilen
 	return true;
 }
 
-bool ProcessFiles(const std::string& path, const std::string& name)
+void CollectFiles(const std::string& path, const std::string& name, std::vector<std::string>& files)
 {
 	WIN32_FIND_DATA findFileData;
 	HANDLE hFindFile = FindFirstFile((path + "\\" + name).c_str(), &findFileData);
@@ -207,22 +212,66 @@ bool ProcessFiles(const std::string& path, const std::string& name)
 		{
 			if (findFileData.dwFileAttributes == FILE_ATTRIBUTE_DIRECTORY && strcmp(findFileData.cFileName, "..") && strcmp(findFileData.cFileName, "."))
 			{
-				if (!ProcessFiles(path + "\\" + findFileData.cFileName, name))
-					return false;
+				CollectFiles(path + "\\" + findFileData.cFileName, name, files);
 			}
 			else if (strlen(findFileData.cFileName) > SourceFileExtension.length() && !strcmp(findFileData.cFileName + strlen(findFileData.cFileName) - SourceFileExtension.length(), SourceFileExtension.c_str()))
 			{
-				if (!ProcessFile(path + "\\" + findFileData.cFileName, ""))
-					return false;
+				files.push_back(path + "\\" + findFileData.cFileName);
 			}
 		}
 		while (FindNextFile(hFindFile, &findFileData));
 
 		FindClose(hFindFile);
-		return true;
 	}
+}
+
+// Each file is translated by external processes (HLSLcc, fxc, glslangValidator), so files are spread over
+// one worker per hardware thread. The first failure stops workers from picking up further files.
+bool ProcessFiles(const std::string& path, const std::string& name)
+{
+	typedef std::chrono::high_resolution_clock Clock;
+
+	std::vector<std::string> files;
+	CollectFiles(path, name, files);
+	if (files.empty())
+		return true;
+
+	std::vector<double> fileSeconds(files.size(), 0.0);
+	std::atomic<size_t> nextFile(0);
+	std::atomic<bool> failed(false);
+
+	const auto processFiles = [&]()
+	{
+		for (size_t i = nextFile++; i < files.size() && !failed; i = nextFile++)
+		{
+			const Clock::time_point fileStart = Clock::now();
+			if (!ProcessFile(files[i], ""))
+				failed = true;
+			fileSeconds[i] = std::chrono::duration<double>(Clock::now() - fileStart).count();
+		}
+	};
+
+	const Clock::time_point start = Clock::now();
+
+	const size_t threadCount = std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), files.size());
+	std::vector<std::thread> threads;
+	for (size_t i = 1; i < threadCount; ++i)
+		threads.emplace_back(processFiles);
+	processFiles();
+	for (std::thread& thread : threads)
+		thread.join();
+
+	const double elapsedSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+	const size_t slowestFile = std::max_element(fileSeconds.begin(), fileSeconds.end()) - fileSeconds.begin();
+	double totalSeconds = 0.0;
+	for (double seconds : fileSeconds)
+		totalSeconds += seconds;
+
+	printf("Translated %u files on %u threads in %.2f s (%.2f s summed, %.2f s average, slowest %.2f s: %s)\n",
+		(unsigned)files.size(), (unsigned)threadCount, elapsedSeconds, totalSeconds, totalSeconds / files.size(),
+		fileSeconds[slowestFile], files[slowestFile].c_str());
 
-	return false;
+	return !failed;
 }
 
 #define ERROR_COMPILATION_FAILED 1
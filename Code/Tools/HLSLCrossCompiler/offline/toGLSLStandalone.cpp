@@ -320,6 +320,7 @@ typedef struct
 	char* reflectPath;
 
 	char cacheKey[MAX_PATH_CHARS];
+	char cacheDir[MAX_PATH_CHARS];
 
 	int bGenerateDXBC;
 	int bUseFxc;
@@ -337,6 +338,7 @@ void InitOptions(Options* psOptions)
 	psOptions->shaderFile = NULL;
 
 	psOptions->bUseFxc = 0;
+	psOptions->cacheDir[0] = 0;
 	psOptions->linkIn[0][0] = 0;
 	psOptions->linkIn[1][0] = 0;
 	psOptions->linkIn[2][0] = 0;
@@ -369,6 +371,7 @@ void PrintHelp()
 	printf("\t-hashout=[dir/]out-file-name \t Output file name is a hash of 'out-file-name', put in the directory 'dir'.\n");
 
 	printf("\t-fxc=\"CMD\" HLSL compiler command line. If specified the input shader will be first compiled through this command first and then the resulting bytecode translated.\n");
+	printf("\t-cache=DIR \t Translation cache directory used with -fxc. Results are stored under a hash of the shader source, the fxc command line, -lang, -flags and -dxbc.\n");
 
 	printf("\n");
 }
@@ -627,6 +630,17 @@ int GetOptions(int argc, char** argv, Options* psOptions)
 			psOptions->bUseFxc = 1;
 		}
 
+		option = strstr(argv[i], "-cache=");
+		if (option != NULL)
+		{
+			char* cacheDir = option + strlen("-cache=");
+			size_t cacheDirLen = strlen(cacheDir);
+			if (cacheDirLen == 0 || cacheDirLen + 1 >= MAX_PATH_CHARS)
+				return 0;
+			memcpy(psOptions->cacheDir, cacheDir, cacheDirLen);
+			psOptions->cacheDir[cacheDirLen] = '\0';
+		}
+
 		option = strstr(argv[i], "-dxbc");
 		if (option != NULL)
 		{
@@ -810,6 +824,78 @@ int CopyCODEToGLSL(char* glslFileName, char* outputFileName)
 #define sprintf_s(dest, size, ...) sprintf(dest, __VA_ARGS__)
 #endif
 
+uint64_t HashFileContents(const char* fileName, uint64_t hash, int* pSuccess)
+{
+	FILE* pFile = fopen(fileName, "rb");
+	*pSuccess = pFile != NULL;
+	if (pFile != NULL)
+	{
+		uint8_t buf[65536];
+		size_t readBytes;
+		while ((readBytes = fread(buf, 1, sizeof(buf), pFile)) != 0)
+			hash = hash64(buf, (uint32_t)readBytes, hash);
+		fclose(pFile);
+	}
+	return hash;
+}
+
+int CopyFileContents(const char* srcFileName, const char* dstFileName)
+{
+	SDXBCFile srcFile = { fopen(srcFileName, "rb") };
+	if (srcFile.m_pFile == NULL)
+		return 0;
+
+	SDXBCFile dstFile = { fopen(dstFileName, "wb") };
+	int result = dstFile.m_pFile != NULL;
+
+	char buf[65536];
+	size_t readBytes;
+	while (result && (readBytes = fread(buf, 1, sizeof(buf), srcFile.m_pFile)) != 0)
+		result = dstFile.Write(buf, readBytes);
+
+	fclose(srcFile.m_pFile);
+	if (dstFile.m_pFile != NULL)
+		fclose(dstFile.m_pFile);
+
+	return result;
+}
+
+// The key covers everything that affects the output of the -fxc path: the source shader, the fxc command line
+// (entry point, profile, fxc flags) and the translation settings. Point -cache at a directory per HLSLcc
+// version so that translator changes do not pick up stale results.
+int GetTranslationCacheFileName(const Options* psOptions, char* cacheFileName, size_t cacheFileNameSize)
+{
+	int success;
+	uint64_t hash = HashFileContents(psOptions->shaderFile, 0, &success);
+	if (!success)
+		return 0;
+
+	const int32_t settings[3] = { (int32_t)psOptions->language, (int32_t)psOptions->flags, (int32_t)psOptions->bGenerateDXBC };
+	hash = hash64((const uint8_t*)psOptions->fxcCmdLine, (uint32_t)strlen(psOptions->fxcCmdLine), hash);
+	hash = hash64((const uint8_t*)settings, (uint32_t)sizeof(settings), hash);
+
+	sprintf_s(cacheFileName, cacheFileNameSize, "%s/%016llX.hlslcc", psOptions->cacheDir, (unsigned long long)hash);
+	return 1;
+}
+
+void StoreInTranslationCache(const Options* psOptions, const char* cacheFileName)
+{
+#if defined(_WIN32)
+	_mkdir(psOptions->cacheDir);
+#else
+	mkdir(psOptions->cacheDir, 0777);
+#endif
+
+	// Several compiler processes can translate the same permutation at once, so write to a name unique to
+	// this output and move it into place. Losing the race just leaves the other process's identical result.
+	char tempFileName[MAX_PATH_CHARS * 8];
+	const uint64_t outputHash = hash64((const uint8_t*)psOptions->outputShaderFile, (uint32_t)strlen(psOptions->outputShaderFile), 0);
+	sprintf_s(tempFileName, sizeof(tempFileName), "%s.%016llX.tmp", cacheFileName, (unsigned long long)outputHash);
+
+	if (!CopyFileContents(psOptions->outputShaderFile, tempFileName) || rename(tempFileName, cacheFileName) != 0)
+		remove(tempFileName);
+}
+
 #if defined(_WIN32) && defined(PORTABLE)
 
 DWORD FilterException(DWORD uExceptionCode)
@@ -901,13 +987,28 @@ int main(int argc, char** argv)
 			char dxbcFileName  [MAX_PATH_CHARS    * 4];
 			char glslFileName  [MAX_PATH_CHARS    * 4];
 			char fullFxcCmdLine[MAX_FXC_CMD_CHARS * 4];
+			char cacheFileName [MAX_PATH_CHARS    * 4];
 			int retValue;
 
+			// Reflection output is not cached, so only use the cache when just the shader is requested
+			const int bUseCache = options.cacheDir[0] != '\0' && options.reflectPath == NULL &&
+				GetTranslationCacheFileName(&options, cacheFileName, sizeof(cacheFileName));
+
+			if (bUseCache && CopyFileContents(cacheFileName, options.outputShaderFile))
+			{
+				printf("cache hit: %s\n", cacheFileName);
+				return 0;
+			}
+
 			sprintf_s(dxbcFileName, sizeof(glslFileName), "%s.dxbc", options.outputShaderFile);
 			sprintf_s(glslFileName, sizeof(glslFileName), "%s.code", options.outputShaderFile);
 
 			sprintf_s(fullFxcCmdLine, sizeof(fullFxcCmdLine), "%s %s %s", options.fxcCmdLine, dxbcFileName, options.shaderFile);
+			Timer_t timer;
+			InitTimer(&timer);
+			ResetTimer(&timer);
 			retValue = system(fullFxcCmdLine);
+			printf("fxc time: %.2f us\n", ReadTimer(&timer));
 
 			if (retValue == 0)
 			{
@@ -928,6 +1029,9 @@ int main(int argc, char** argv)
 			remove(dxbcFileName);
 			remove(glslFileName);
 
+			if (retValue == 0 && bUseCache)
+				StoreInTranslationCache(&options, cacheFileName);
+
 			return retValue;
 		}
 
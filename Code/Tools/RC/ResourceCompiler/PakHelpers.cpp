@@ -8,6 +8,7 @@
 #include <CryString/StringUtils.h>
 #include "FileUtil.h"
 #include "IRCLog.h"
+#include "TextFileReader.h"
 
 //////////////////////////////////////////////////////////////////////////
 bool PakHelpers::PakEntry::MakeSortableStreamingSuffix(const string& suffix, string* sortable, int nDigits, int nIncrement)
@@ -313,6 +314,21 @@ namespace
 		}
 	};
 
+	struct AccessLogFileOrder : public AlphabeticalFileOrder
+	{
+		bool operator()(const PakHelpers::PakEntry& left, const PakHelpers::PakEntry& right) const
+		{
+			// files read first come first, so loading streams through the pak
+			if (left.m_accessOrder != right.m_accessOrder)
+			{
+				return left.m_accessOrder < right.m_accessOrder;
+			}
+
+			// unlisted files go to the end
+			return AlphabeticalFileOrder::operator()(left, right);
+		}
+	};
+
 	struct StreamingSuffixFileOrder : public AlphabeticalFileOrder
 	{
 		bool operator()(const PakHelpers::PakEntry& left, const PakHelpers::PakEntry& right) const
@@ -373,7 +389,8 @@ size_t PakHelpers::CreatePakEntryList(
 	std::map<string, std::vector<PakHelpers::PakEntry> >& pakEntries, 
 	PakHelpers::ESortType eSortType,
 	PakHelpers::ESplitType eSplitType,
-	const string& sPakName)
+	const string& sPakName,
+	const std::map<string, int>* pAccessOrder)
 {
 	const string sPakBase = PathHelpers::RemoveExtension(PathHelpers::GetFilename(sPakName));
 	string sPakDir;
@@ -399,6 +416,15 @@ size_t PakHelpers::CreatePakEntryList(
 		entry.m_innerDir = entry.GetDirnameWithoutFile(false);
 		entry.m_sourceFileSize = FileUtil::GetFileSize(entry.GetRealFilename());
 
+		if (pAccessOrder)
+		{
+			const std::map<string, int>::const_iterator itOrder = pAccessOrder->find(StringHelpers::MakeLowerCase(entry.m_rcFile.m_sourceInnerPathAndName));
+			if (itOrder != pAccessOrder->end())
+			{
+				entry.m_accessOrder = itOrder->second;
+			}
+		}
+
 		if (eSplitType == eSplitType_ExtensionMipmap)
 		{
 			if (entry.m_sourceFileSize >= 0)
@@ -519,6 +545,12 @@ size_t PakHelpers::CreatePakEntryList(
 				std::sort(files.begin(), files.end(), AlphabeticalFileOrder());
 				break;
 			}	
+		case PakHelpers::eSortType_AccessLog:
+			{
+				RCLog("Using sort method to add to pack : accesslog");
+				std::sort(files.begin(), files.end(), AccessLogFileOrder());
+				break;
+			}
 		default:
 			{
 				assert(0);
@@ -531,4 +563,36 @@ size_t PakHelpers::CreatePakEntryList(
 	return entryCount;
 }
 
-//////////////////////////////////////////////////////////////////////////
\ No newline at end of file
+//////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+
+bool PakHelpers::LoadAccessOrder(const char* filename, std::map<string, int>& accessOrder)
+{
+	TextFileReader reader;
+	std::vector<char*> lines;
+	if (!reader.Load(filename, lines))
+	{
+		return false;
+	}
+
+	for (size_t i = 0; i < lines.size(); ++i)
+	{
+		string line = StringHelpers::Trim(string(lines[i]));
+		if (line.empty())
+		{
+			continue;
+		}
+
+		line = StringHelpers::MakeLowerCase(PathHelpers::RemoveDuplicateSeparators(PathHelpers::ToDosPath(line)));
+		if (StringHelpers::StartsWith(line, ".\\"))
+		{
+			line.erase(0, 2);
+		}
+
+		// keep the first access only
+		accessOrder.insert(std::make_pair(line, (int)accessOrder.size()));
+	}
+
+	return true;
+}
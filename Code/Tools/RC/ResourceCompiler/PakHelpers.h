@@ -17,6 +17,7 @@ namespace PakHelpers
 		eSortType_Streaming,            // sort files by extension+type+name+size
 		eSortType_Suffix,               // sort files by suffix+name+extension
 		eSortType_Alphabetically,       // sort files by full path
+		eSortType_AccessLog,            // sort files by first access in a recorded resource list, then by full path
 	};
 
 	enum ESplitType
@@ -47,6 +48,7 @@ namespace PakHelpers
 			: m_sourceFileSize(-1)
 			, m_bIsLastMip(false)
 			, m_textureType(eTextureType_Undefined)
+			, m_accessOrder(INT_MAX)
 		{
 		}
 
@@ -59,6 +61,7 @@ namespace PakHelpers
 		ETextureType m_textureType;
 		string m_baseName;
 		string m_innerDir;
+		int m_accessOrder;              // index in the resource list, INT_MAX if not listed
 
 		static bool MakeSortableStreamingSuffix(const string& suffix, string* sortable = NULL, int nDigits = 2, int nIncrement = 0);
 
@@ -76,7 +79,13 @@ namespace PakHelpers
 		std::map<string, std::vector<PakEntry> >& pakEntries, 
 		ESortType eSortType,
 		ESplitType eSplitType,
-		const string& sPakName);	
+		const string& sPakName,
+		const std::map<string, int>* pAccessOrder = nullptr);
+
+	// Reads a resource list (one file per line, as recorded by the engine's file open recording) and
+	// maps lower-case DOS paths to their first position in the list. Entries already in accessOrder
+	// keep their position, so several lists can be merged by calling this repeatedly.
+	bool LoadAccessOrder(const char* filename, std::map<string, int>& accessOrder);
 }
 
 #endif // __pakhelpers_h__
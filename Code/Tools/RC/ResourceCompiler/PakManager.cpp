@@ -21,6 +21,32 @@ string CreateTempFileName(const string& filepath)
 	return PathHelpers::ReplaceExtension(filepath, string().Format("$%s", ext.c_str()));
 }
 
+// Merges several ';' separated resource lists into one access order. Lists are read in the given
+// order and each file keeps its first position, so a boot list followed by per-level lists places
+// startup files first and every level's files in the order the level streams them.
+bool LoadAccessOrderLists(const string& sortLists, std::map<string, int>& accessOrder)
+{
+	int pos = 0;
+	for (string listFilename = sortLists.Tokenize(";", pos); !listFilename.empty(); listFilename = sortLists.Tokenize(";", pos))
+	{
+		listFilename.Trim();
+		if (listFilename.empty())
+		{
+			continue;
+		}
+
+		const size_t nPrevCount = accessOrder.size();
+		if (!PakHelpers::LoadAccessOrder(listFilename.c_str(), accessOrder))
+		{
+			RCLogError("Failed to read resource list '%s'.", listFilename.c_str());
+			return false;
+		}
+		RCLog("Read %u new entries from resource list %s", accessOrder.size() - nPrevCount, listFilename.c_str());
+	}
+
+	return true;
+}
+
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -42,8 +68,17 @@ void PakManager::RegisterKeys(IResourceCompiler* pRC)
 	pRC->RegisterKey("zip_encrypt_key", "Specifies a 128-bit key in hexadecimal format: 32-character string. Low endian format.");
 	pRC->RegisterKey("zip_encrypt_content", "Encrypts files inside of zip. Works only when zip_encrypt enabled. Disabled by default.");
 	pRC->RegisterKey("zip_compression", "Specify compression level for zipped files. [0-9] 0=no compression, 9=max compression. Default is 6.");
+	pRC->RegisterKey("zip_format", "Define compression format of zipped files, currently supported:\n"
+	                               "deflate, lz4, zstd. lz4 and zstd compress files as independent blocks which are decompressed in parallel. Default is deflate.");
+	pRC->RegisterKey("zip_blocksize", "Size of the independently compressed blocks in KBs, used when zip_format is lz4 or zstd. Default is 64.");
 	pRC->RegisterKey("zip_sort", "Define sorting type when adding files to the pak, currently supported:\n"
-	                             "nosort, size, streaming, suffix, alphabetically. Alphabetically is default.");
+	                             "nosort, size, streaming, suffix, alphabetically, accesslog. Alphabetically is default.\n"
+	                             "accesslog orders files by their first appearance in the resource list given by zip_sortlist.");
+	pRC->RegisterKey("zip_sortlist", "Resource list recorded by the engine (one file per line) used by zip_sort=accesslog.\n"
+	                                 "Several lists can be separated by ';' (e.g. boot list first, then level lists), files keep their first appearance.");
+	pRC->RegisterKey("zip_bootpak", "Additionally write the files of the 'zip' job that appear in zip_bootlist into this pak, in access order.\n"
+	                                "Used to keep startup assets together in one pak that is read sequentially at boot.");
+	pRC->RegisterKey("zip_bootlist", "Resource list(s) recorded during engine startup, ';' separated. Required by zip_bootpak.");
 	pRC->RegisterKey("zip_split", "Define split type for distributing files into different paks automatically, currently supported:\n"
 	                              "original, basedir, streaming, suffix. 'original' is default, except for streaming for which it is streaming.");
 	pRC->RegisterKey("zip_maxsize", "Maximum compressed size of the zip in KBs");
@@ -102,7 +137,19 @@ PakManager::ECallResult PakManager::CompileFilesIntoPaks(
 			const string folderInPak = config->GetAsString("FolderInZip", "", "");
 			const bool bUpdate = !config->GetAsBool("zip_new", false, true); // forces to recreate pak-file
 
-			return CreatePakFile(config, m_allFiles, folderInPak, pakFilename, bUpdate);
+			const ECallResult result = CreatePakFile(config, m_allFiles, folderInPak, pakFilename, bUpdate);
+			if (result != eCallResult_Succeeded)
+			{
+				return result;
+			}
+
+			const string bootPakFilename = config->GetAsString("zip_bootpak", "", "");
+			if (!bootPakFilename.empty())
+			{
+				return CreateBootPakFile(config, m_allFiles, folderInPak, bootPakFilename, bUpdate);
+			}
+
+			return result;
 		}
 	}
 
@@ -148,6 +195,47 @@ PakManager::ECallResult PakManager::SplitListFileToPaks(
 	return eCallResult_Succeeded;
 }
 
+//////////////////////////////////////////////////////////////////////////
+PakManager::ECallResult PakManager::CreateBootPakFile(
+  const IConfig* config,
+  const std::vector<RcFile>& files,
+  const string& folderInPak,
+  const string& bootPakFilename,
+  bool bUpdate)
+{
+	const string bootLists = config->GetAsString("zip_bootlist", "", "");
+	if (bootLists.empty())
+	{
+		RCLogError("zip_bootpak requires a resource list specified with zip_bootlist. Creating of boot pak failed.");
+		return eCallResult_BadArgs;
+	}
+
+	std::map<string, int> bootOrder;
+	if (!LoadAccessOrderLists(bootLists, bootOrder))
+	{
+		return eCallResult_BadArgs;
+	}
+
+	// the files stay in their regular pak as well, the boot pak only duplicates them
+	std::vector<RcFile> bootFiles;
+	for (size_t i = 0; i < files.size(); ++i)
+	{
+		if (bootOrder.find(StringHelpers::MakeLowerCase(files[i].m_sourceInnerPathAndName)) != bootOrder.end())
+		{
+			bootFiles.push_back(files[i]);
+		}
+	}
+
+	if (bootFiles.empty())
+	{
+		RCLog("No files of this job are listed in the boot list, skipping boot pak %s", bootPakFilename.c_str());
+		return eCallResult_Succeeded;
+	}
+
+	RCLog("Duplicating %u startup files into boot pak %s", bootFiles.size(), bootPakFilename.c_str());
+	return CreatePakFile(config, bootFiles, folderInPak, bootPakFilename, bUpdate, bootLists);
+}
+
 //////////////////////////////////////////////////////////////////////////
 PakManager::ECallResult PakManager::DeleteFilesFromPaks(
   const IConfig* config,
@@ -216,7 +304,8 @@ PakManager::ECallResult PakManager::CreatePakFile(
   const std::vector<RcFile>& sourceFiles,
   const string& folderInPak,
   const string& requestedPakFilename,
-  bool bUpdate)
+  bool bUpdate,
+  const string& forcedSortLists)
 {
 	const bool bVerbose = config->GetAsInt("verbose", 0, 1) > 0;
 
@@ -244,6 +333,10 @@ PakManager::ECallResult PakManager::CreatePakFile(
 		{
 			eSortType = PakHelpers::eSortType_Alphabetically;
 		}
+		else if (StringHelpers::EqualsIgnoreCase(sortType, "accesslog"))
+		{
+			eSortType = PakHelpers::eSortType_AccessLog;
+		}
 		else
 		{
 			RCLogError("Invalid zip_sort argument: '%s'. Creating of pak failed.", sortType.c_str());
@@ -258,7 +351,13 @@ PakManager::ECallResult PakManager::CreatePakFile(
 	}
 
 	const string splitType = config->GetAsString("zip_split", "", "");
-	if (!splitType.empty())
+	if (!forcedSortLists.empty())
+	{
+		// boot paks are ordered by their own list and never split
+		eSortType = PakHelpers::eSortType_AccessLog;
+		eSplitType = PakHelpers::eSplitType_Original;
+	}
+	else if (!splitType.empty())
 	{
 		if (StringHelpers::EqualsIgnoreCase(splitType, "original"))
 		{
@@ -289,10 +388,26 @@ PakManager::ECallResult PakManager::CreatePakFile(
 		return eCallResult_Failed;
 	}
 
+	std::map<string, int> accessOrder;
+	if (eSortType == PakHelpers::eSortType_AccessLog)
+	{
+		const string sortLists = forcedSortLists.empty() ? config->GetAsString("zip_sortlist", "", "") : forcedSortLists;
+		if (sortLists.empty())
+		{
+			RCLogError("zip_sort=accesslog requires a resource list specified with zip_sortlist. Creating of pak failed.");
+			return eCallResult_BadArgs;
+		}
+		if (!LoadAccessOrderLists(sortLists, accessOrder))
+		{
+			RCLogError("Failed to read zip_sortlist '%s'. Creating of pak failed.", sortLists.c_str());
+			return eCallResult_BadArgs;
+		}
+	}
+
 	std::map<string, std::vector<PakHelpers::PakEntry>> fileMap;
 
 	{
-		const size_t nCount = PakHelpers::CreatePakEntryList(sourceFiles, fileMap, eSortType, eSplitType, PathHelpers::ReplaceExtension(requestedPakFilename, "pak"));
+		const size_t nCount = PakHelpers::CreatePakEntryList(sourceFiles, fileMap, eSortType, eSplitType, PathHelpers::ReplaceExtension(requestedPakFilename, "pak"), accessOrder.empty() ? nullptr : &accessOrder);
 		if (nCount == 0)
 		{
 			return eCallResult_Failed;
@@ -314,6 +429,41 @@ PakManager::ECallResult PakManager::CreatePakFile(
 
 	const int zipCompressionLevel = config->GetAsInt("zip_compression", 6, 6);
 
+	int zipBlockCompressionMethod = ZipFile::METHOD_STORE;
+	const string zipFormat = config->GetAsString("zip_format", "", "");
+	if (!zipFormat.empty() && !StringHelpers::EqualsIgnoreCase(zipFormat, "deflate"))
+	{
+		if (StringHelpers::EqualsIgnoreCase(zipFormat, "lz4"))
+		{
+			zipBlockCompressionMethod = ZipFile::METHOD_LZ4_BLOCKS;
+		}
+		else if (StringHelpers::EqualsIgnoreCase(zipFormat, "zstd"))
+		{
+#if defined(SUPPORT_ZSTD_PAKS)
+			zipBlockCompressionMethod = ZipFile::METHOD_ZSTD_BLOCKS;
+#else
+			RCLogError("zip_format 'zstd' is not supported by this build. Creating of pak failed.");
+			return eCallResult_Failed;
+#endif
+		}
+		else
+		{
+			RCLogError("Invalid zip_format argument: '%s'. Creating of pak failed.", zipFormat.c_str());
+			return eCallResult_Failed;
+		}
+	}
+
+	const int zipBlockSize = config->GetAsInt("zip_blocksize", 64, 64) * 1024;
+	if (zipBlockSize <= 0)
+	{
+		RCLogError("Invalid zip_blocksize argument: %d. Creating of pak failed.", zipBlockSize / 1024);
+		return eCallResult_Failed;
+	}
+
+	const clock_t packingStartTime = clock();
+	__int64 totalSourceBytes = 0;
+	size_t totalFilesAdded = 0;
+
 	ECallResult bResult = eCallResult_Succeeded;
 	for (std::map<string, std::vector<PakHelpers::PakEntry>>::iterator it = fileMap.begin(); it != fileMap.end(); ++it)
 	{
@@ -581,7 +731,8 @@ PakManager::ECallResult PakManager::CreatePakFile(
 				const int threadCount = GetMaxThreads() == 1 ? 0 : GetMaxThreads();
 				pPakFile->zip->UpdateMultipleFiles(&realFilenamePtrs[0], &filenameInZipPtrs[0], filenameCount,
 				                                   zipCompressionLevel, zipEncrypt && zipEncryptContent, nMaxZipSize, nMinSrcSize, nMaxSrcSize,
-				                                   threadCount, &errorReporter, bSplitOnSizeOverflow ? &sizeSplitter : nullptr);
+				                                   threadCount, &errorReporter, bSplitOnSizeOverflow ? &sizeSplitter : nullptr,
+				                                   zipBlockCompressionMethod, (unsigned)zipBlockSize);
 
 				// divide files in case it has overflown the maximum allowed file-size
 				if (bSplitOnSizeOverflow)
@@ -828,6 +979,20 @@ PakManager::ECallResult PakManager::CreatePakFile(
 		      numFiles, pakFilename.c_str());
 		RCLog("    %d added, %d up-to-date, %d skipped, %d missing, %d failed",
 		      numFilesAdded, numFilesUpToDate, numFilesSkipped, numFilesMissing, numFilesFailed);
+
+		for (size_t i = 0; i < numFiles; ++i)
+		{
+			totalSourceBytes += max(files[i].m_sourceFileSize, (__int64)0);
+		}
+		totalFilesAdded += numFilesAdded;
+	}
+
+	if (fileMap.size() > 1 || bVerbose)
+	{
+		const double secondsElapsed = double(clock() - packingStartTime) / CLOCKS_PER_SEC;
+		const double sourceMegabytes = double(totalSourceBytes) / (1024.0 * 1024.0);
+		RCLog("Packed %u files into %u zip files in %.1f sec (%.1f MB of source data, %.2f MB/sec)",
+		      totalFilesAdded, fileMap.size(), secondsElapsed, sourceMegabytes, secondsElapsed > 0.0 ? sourceMegabytes / secondsElapsed : 0.0);
 	}
 
 	return bResult;
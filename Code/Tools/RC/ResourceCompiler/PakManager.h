@@ -53,6 +53,15 @@ private:
 		const std::vector<RcFile>& sourceFiles,
 		const string& folderInPak,
 		const string& requestedPakFilename,
+		bool bUpdate,
+		const string& forcedSortLists = string());
+
+	// Duplicates the files listed in zip_bootlist into the pak given by zip_bootpak, ordered by the list.
+	ECallResult CreateBootPakFile(
+		const IConfig* config,
+		const std::vector<RcFile>& files,
+		const string& folderInPak,
+		const string& bootPakFilename,
 		bool bUpdate);
 
 	ECallResult SynchronizePaks(
@@ -63,6 +63,42 @@ namespace
 	typedef CScopeTimer<2> CCacheAddFilesTimer;
 	typedef CScopeTimer<3> CCacheGetFilesTimer;
 	typedef CScopeTimer<4> CComputeDigestTimer;
+
+	// Feeds the conversion relevant configuration keys into a digest, so cached outputs of
+	// different platforms or conversion settings never collide.
+	// Keys that only affect logging, paths or scheduling are skipped so that the cache can be shared between machines.
+	class CConfigDigestSink : public IConfigSink
+	{
+	public:
+		explicit CConfigDigestSink(CDigest& digest) : m_digest(digest) {}
+
+		virtual void SetKeyValue(EConfigPriority ePri, const char* key, const char* value) override
+		{
+			static const char* const s_ignoredKeys[] =
+			{
+				"_debug", "wait", "wx", "recursive", "refresh", "statistics", "dependencies", "clean_targetroot",
+				"verbose", "quiet", "skipmissing", "logfiles", "logprefix", "logtime", "sourceroot", "targetroot",
+				"filesperprocess", "threads", "failonwarnings", "help", "version", "listfile", "listformat",
+				"exclude", "exclude_listfile", "validate", "cc_email", "job", "jobtarget", "cachefolder"
+			};
+
+			for (const char* const ignoredKey : s_ignoredKeys)
+			{
+				if (stricmp(key, ignoredKey) == 0)
+				{
+					return;
+				}
+			}
+
+			string keyValue;
+			keyValue.Format("%s=%s;", key, value ? value : "");
+			keyValue.MakeLower();
+			m_digest.UpdateFromData((uint8*)keyValue.data(), keyValue.size());
+		}
+
+	private:
+		CDigest& m_digest;
+	};
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -88,6 +124,8 @@ ResourceCompiler::ResourceCompiler()
 	m_pPakManager = 0;
 	m_numWarnings = 0;
 	m_numErrors = 0;
+	m_numCacheLookups = 0;
+	m_numCacheHits = 0;
 	m_tlsIndex_pThreadData = 0;
 	m_pAssetManager.reset(new CAssetManager(this));
 
@@ -232,6 +270,9 @@ public:
 	std::vector<RcFile> m_failedFiles;
 	std::vector<RcFile> m_convertedFiles;
 
+	// Wall clock conversion time of each processed file, in seconds.
+	std::vector<std::pair<float, string>> m_fileDurations;
+
 private:
 	ThreadUtils::CriticalSection m_lock;
 
@@ -282,6 +323,32 @@ static void CompileFilesMultiThreaded(
 
 	bool bLogMemory = false;
 
+	// Threads take files from the back of the list. Sorting by source size puts the largest (and usually slowest)
+	// files first, so they don't end up running alone on one thread at the end of the batch.
+	if (threadCount > 1 && a_files.m_inputFiles.size() > 1)
+	{
+		std::vector<std::pair<__int64, size_t>> fileSizes;
+		fileSizes.reserve(a_files.m_inputFiles.size());
+		for (size_t i = 0; i < a_files.m_inputFiles.size(); ++i)
+		{
+			const RcFile& file = a_files.m_inputFiles[i];
+			const string sourceFullFileName = PathHelpers::Join(file.m_sourceLeftPath, file.m_sourceInnerPathAndName);
+			fileSizes.emplace_back(FileUtil::GetFileSize(sourceFullFileName.c_str()), i);
+		}
+		std::stable_sort(fileSizes.begin(), fileSizes.end(), [](const std::pair<__int64, size_t>& a, const std::pair<__int64, size_t>& b)
+		{
+			return a.first < b.first;
+		});
+
+		std::vector<RcFile> sortedFiles;
+		sortedFiles.reserve(fileSizes.size());
+		for (const auto& fileSize : fileSizes)
+		{
+			sortedFiles.push_back(a_files.m_inputFiles[fileSize.second]);
+		}
+		a_files.m_inputFiles.swap(sortedFiles);
+	}
+
 	while (!a_files.m_inputFiles.empty())
 	{
 		// Never create more threads than needed
@@ -881,7 +948,7 @@ bool ResourceCompiler::CompileFiles(const std::vector<RcFile>& files, const ICon
 
 		if (!m_cacheFolder.empty() && converter->IsCacheable())
 		{
-			TryToGetFilesFromCache(filesToConvert, converter);
+			TryToGetFilesFromCache(filesToConvert, converter, config);
 		}
 
 		compileFiles(this, m_tlsIndex_pThreadData, filesToConvert, threadCount, converter, config);
@@ -927,6 +994,8 @@ bool ResourceCompiler::CompileFiles(const std::vector<RcFile>& files, const ICon
 		RCLog("");
 	}
 
+	LogCriticalPathStatistics(filesToConvert.m_fileDurations, secondsElapsed);
+
 	SetTimeLogging(savedTimeLogging);
 
 	if (!m_cacheFolder.empty())
@@ -937,6 +1006,40 @@ bool ResourceCompiler::CompileFiles(const std::vector<RcFile>& files, const ICon
 	return numFilesConverted > 0;
 }
 
+void ResourceCompiler::LogCriticalPathStatistics(std::vector<std::pair<float, string>>& fileDurations, float secondsElapsed) const
+{
+	if (fileDurations.empty())
+	{
+		return;
+	}
+
+	std::sort(fileDurations.begin(), fileDurations.end(), [](const std::pair<float, string>& a, const std::pair<float, string>& b)
+	{
+		return a.first > b.first;
+	});
+
+	float totalSeconds = 0.0f;
+	for (const auto& fileDuration : fileDurations)
+	{
+		totalSeconds += fileDuration.first;
+	}
+
+	// The slowest file is a lower bound of the wall time, no matter how many threads are used.
+	RCLog("Conversion time: %.1f sec summed over all files, %.1f sec wall, slowest file %.1f sec (%s).",
+		totalSeconds, secondsElapsed, fileDurations.front().first, fileDurations.front().second.c_str());
+
+	if (GetVerbosityLevel() >= 1)
+	{
+		const size_t numFilesToShow = std::min(fileDurations.size(), size_t(10));
+		RCLog("Slowest files:");
+		for (size_t i = 0; i < numFilesToShow; ++i)
+		{
+			RCLog("  %8.2f sec  %s", fileDurations[i].first, fileDurations[i].second.c_str());
+		}
+	}
+	RCLog("");
+}
+
 bool ResourceCompiler::CompileSingleFileBySingleProcess(const char* filename)
 {
 	std::vector<RcFile> list;
@@ -982,6 +1085,8 @@ unsigned int WINAPI ThreadFunc(void* threadDataMemory)
 		};
 		EResult eResult;
 
+		const clock_t fileStartTime = clock();
+
 		try
 		{
 			if (data->rc->CompileFile(sourceFullFileName.c_str(), fileToConvert.m_targetLeftPath.c_str(), sourceInnerPath.c_str(), data->compiler))
@@ -1002,7 +1107,10 @@ unsigned int WINAPI ThreadFunc(void* threadDataMemory)
 			eResult = eResult_Exception;
 		}
 
+		const float fileSeconds = float(clock() - fileStartTime) / CLOCKS_PER_SEC;
+
 		data->pFilesToConvert->lock();
+		data->pFilesToConvert->m_fileDurations.emplace_back(fileSeconds, fileToConvert.m_sourceInnerPathAndName);
 		switch (eResult)
 		{
 		case eResult_Ok:
@@ -2308,6 +2416,12 @@ void ResourceCompiler::PostBuild()
 		RCLog("Getting files from the cachefolder: %f sec.", CCacheGetFilesTimer::Total());
 		RCLog("Adding files to the cachefolder: %f sec.", CCacheAddFilesTimer::Total());
 		RCLog("");
+		RCLog("Cache hits: %" PRISIZE_T " of %" PRISIZE_T " file%s (%.1f%%).",
+			m_numCacheHits,
+			m_numCacheLookups,
+			(m_numCacheLookups != 1 ? "s" : ""),
+			m_numCacheLookups ? 100.0 * m_numCacheHits / m_numCacheLookups : 0.0);
+		RCLog("");
 	}
 
 	switch (config->GetAsInt("clean_targetroot", 0, 1))
@@ -2458,16 +2572,37 @@ void ResourceCompiler::InitFileCache(Config & config)
 }
 
 //////////////////////////////////////////////////////////////////////////
-void ResourceCompiler::TryToGetFilesFromCache(FilesToConvert & files, IConverter * converter)
+void ResourceCompiler::TryToGetFilesFromCache(FilesToConvert & files, IConverter * converter, const IConfig* config)
 {
 	assert(m_pDigest);
 	assert(!m_cacheFolder.empty());
 
-	auto computeFileDigest = [this](const string& path)
+	// The key of a cached file is made of the RC binaries and rc.ini (m_pDigest), the active platform,
+	// the job and command line settings and the source file content.
+	CDigest configDigest = m_pDigest.get()->Clone();
+	{
+		CComputeDigestTimer accumulateDuration;
+
+		const PlatformInfo* const pPlatformInfo = GetPlatformInfo(m_multiConfig.getActivePlatform());
+		if (pPlatformInfo)
+		{
+			string platformName = pPlatformInfo->GetCommaSeparatedNames();
+			configDigest.UpdateFromData((uint8*)platformName.data(), platformName.size());
+		}
+
+		CConfigDigestSink configSink(configDigest);
+		const int digestedPriorities[] = { eCP_PriorityPreset, eCP_PriorityCmdline, eCP_PriorityProperty, eCP_PriorityJob };
+		for (const int priority : digestedPriorities)
+		{
+			config->CopyToConfig((EConfigPriority)priority, &configSink);
+		}
+	}
+
+	auto computeFileDigest = [&configDigest](const string& path)
 	{
 		CComputeDigestTimer accumulateDuration;
 
-		CDigest digest = m_pDigest.get()->Clone();
+		CDigest digest = configDigest.Clone();
 		digest.UpdateFromFile(path);
 		return digest.Final();
 	};
@@ -2530,6 +2665,9 @@ void ResourceCompiler::TryToGetFilesFromCache(FilesToConvert & files, IConverter
 
 	size_t numFilesRestored = numFiles - files.m_inputFiles.size();
 	RCLog("%d file%s restored from the cache.", numFilesRestored, (numFilesRestored > 1 ? "s" : ""));
+
+	m_numCacheLookups += numFiles;
+	m_numCacheHits += numFilesRestored;
 	RCLog("");
 }
 
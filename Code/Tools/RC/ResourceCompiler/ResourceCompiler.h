@@ -207,7 +207,8 @@ private:
 	void LogMultiLine(const char* szText);
 
 	void InitFileCache(Config& config);
-	void TryToGetFilesFromCache(FilesToConvert& files, IConverter* converter);
+	void TryToGetFilesFromCache(FilesToConvert& files, IConverter* converter, const IConfig* config);
+	void LogCriticalPathStatistics(std::vector<std::pair<float, string>>& fileDurations, float secondsElapsed) const;
 	void AddFilesToTheCache(const FilesToConvert& files);
 
 	// -----------------------------------------------------------------------
@@ -282,6 +283,8 @@ private:
 
 	string                  m_cacheFolder;
 	std::unique_ptr<CDigest> m_pDigest;
+	size_t                  m_numCacheLookups;
+	size_t                  m_numCacheHits;
 	std::unique_ptr<IAssetManager> m_pAssetManager;
 
 	int                     m_numWarnings;
@@ -546,6 +546,7 @@ bool AlembicCompiler::Process()
 	geomCacheWriter.WriteStaticData(normalizedFrameTimes, m_meshes, m_rootNode);
 	
 	// Export animated data (frames)
+	const LONGLONG animationStartTicks = GeomCache::StageTimer::GetTicks();
 	geomCacheEncoder.Init();
 	if (!CompileAnimationData(archive, geomCacheEncoder, threadPool))
 	{
@@ -578,6 +579,20 @@ bool AlembicCompiler::Process()
 		RCLog("  Average data rate: %.2f MiB/s", (double)animationDataMegaBytes / sequenceLength);
 	}	
 
+	// Stage times are summed over all worker threads. Sampling is serialized by m_abcLock, so if it comes
+	// close to the wall time the archive reads are the bottleneck and more threads won't help.
+	GeomCache::StageTimer animationTimer;
+	animationTimer.Add(animationStartTicks);
+	const double animationSeconds = animationTimer.GetSeconds();
+	const double uncompressedMegaBytes = static_cast<double>(stats.m_uncompressedAnimationSize) / (1024.0 * 1024.0);
+	const double samplingSeconds = m_samplingTimer.GetSeconds();
+	const double encodingSeconds = geomCacheEncoder.GetEncodingSeconds();
+
+	RCLog("  Animation compiled in %.1f s (%.1f frames/s)", animationSeconds, animationSeconds > 0.0 ? m_frameTimes.size() / animationSeconds : 0.0);
+	RCLog("  Sampling: %.1f s (%.1f frames/s)", samplingSeconds, samplingSeconds > 0.0 ? m_frameTimes.size() / samplingSeconds : 0.0);
+	RCLog("  Encoding: %.1f s (%.1f frames/s)", encodingSeconds, encodingSeconds > 0.0 ? m_frameTimes.size() / encodingSeconds : 0.0);
+	RCLog("  Compression: %.1f s (%.2f MiB/s)", stats.m_compressionSeconds, stats.m_compressionSeconds > 0.0 ? uncompressedMegaBytes / stats.m_compressionSeconds : 0.0);
+
 	RCLog("Writing build configuration file...");
 	pXMLSerializer->Write(config, configPath);
 
@@ -1581,10 +1596,12 @@ void AlembicCompiler::UpdateTransformsJob(FrameJobGroupData *pData)
 	try
 	{
 		ThreadUtils::AutoLock lock(pSelf->m_abcLock);
+		const LONGLONG startTicks = GeomCache::StageTimer::GetTicks();
 		TMatrixMap matrixMap;
 		TVisibilityMap visibilityMap;
 		pSelf->UpdateTransformsRec(pSelf->m_rootNode, pData->m_jobIndex, pData->m_frameTime, 
 			pData->m_frameAABB, QuatTNS(IDENTITY), matrixMap, visibilityMap, currentObjectPath);
+		pSelf->m_samplingTimer.Add(startTicks);
 	}
 	catch(const Alembic::Util::Exception &alembicException)
 	{
@@ -1712,10 +1729,12 @@ void AlembicCompiler::UpdateVertexDataJob(struct CompileMeshJobData *pData)
 	try
 	{
 		ThreadUtils::AutoLock lock(pSelf->m_abcLock);
+		const LONGLONG startTicks = GeomCache::StageTimer::GetTicks();
 		if (!pSelf->UpdateVertexData(pData->m_mesh, pJobGroupData->m_jobIndex, pJobGroupData->m_frameIndex))
 		{
 			InterlockedIncrement(&pJobGroupData->m_errorCount);
 		}
+		pSelf->m_samplingTimer.Add(startTicks);
 	}
 	catch(const Alembic::Util::Exception &alembicException)
 	{
@@ -309,6 +309,9 @@ private:
 	// Transform update lock (ABC library is sometimes not thread safe)
 	ThreadUtils::CriticalSection m_abcLock;
 
+	// Time spent sampling the Alembic archive
+	GeomCache::StageTimer m_samplingTimer;
+
 	// Error count
 	volatile uint m_errorCount;
 
@@ -167,4 +167,33 @@ namespace GeomCache
 		// For debug output
 		string m_name;
 	};
+
+	// Accumulates the time spent in one stage of the compilation pipeline over all worker threads
+	class StageTimer
+	{
+	public:
+		StageTimer() : m_ticks(0) {}
+
+		void Add(const LONGLONG startTicks)
+		{
+			InterlockedExchangeAdd64(&m_ticks, GetTicks() - startTicks);
+		}
+
+		double GetSeconds() const
+		{
+			LARGE_INTEGER frequency;
+			QueryPerformanceFrequency(&frequency);
+			return static_cast<double>(m_ticks) / static_cast<double>(frequency.QuadPart);
+		}
+
+		static LONGLONG GetTicks()
+		{
+			LARGE_INTEGER ticks;
+			QueryPerformanceCounter(&ticks);
+			return ticks.QuadPart;
+		}
+
+	private:
+		volatile LONGLONG m_ticks;
+	};
 }
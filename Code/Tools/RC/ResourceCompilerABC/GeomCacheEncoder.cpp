@@ -213,7 +213,9 @@ void GeomCacheEncoder::FrameGroupFinished(GeomCacheEncoderFrameInfo *pFrame)
 void GeomCacheEncoder::EncodeNodesJob(GeomCacheEncoderFrameInfo *pFrame)
 {
 	GeomCacheEncoder *pEncoder = pFrame->m_pEncoder;
+	const LONGLONG startTicks = GeomCache::StageTimer::GetTicks();
 	pEncoder->EncodeNodesRec(pEncoder->m_rootNode, pFrame);
+	pEncoder->m_encodingTimer.Add(startTicks);
 }
 
 void GeomCacheEncoder::EncodeNodesRec(GeomCache::Node &currentNode, GeomCacheEncoderFrameInfo *pFrame)
@@ -275,7 +277,9 @@ void GeomCacheEncoder::EncodeMeshJob(std::pair<GeomCache::Mesh*, GeomCacheEncode
 	GeomCacheEncoder *pEncoder = pFrame->m_pEncoder;
 	delete pData;
 
+	const LONGLONG startTicks = GeomCache::StageTimer::GetTicks();
 	pEncoder->EncodeMesh(pMesh, pFrame);	
+	pEncoder->m_encodingTimer.Add(startTicks);
 }
 
 void GeomCacheEncoder::EncodeMesh(GeomCache::Mesh *pMesh, GeomCacheEncoderFrameInfo *pFrame)
@@ -64,6 +64,9 @@ public:
 
 	static bool OptimizeMeshForCompression(GeomCache::Mesh &mesh, const bool bUseMeshPrediction);
 
+	// Time spent in encoding jobs
+	double GetEncodingSeconds() const { return m_encodingTimer.GetSeconds(); }
+
 private:
 	GeomCacheEncoderFrameInfo &GetInfoFromFrameIndex(const uint index);
 
@@ -110,4 +113,6 @@ private:
 	// Global scene structure handles from alembic compiler
 	GeomCache::Node &m_rootNode;
 	const std::vector<GeomCache::Mesh*> &m_meshes;
+
+	GeomCache::StageTimer m_encodingTimer;
 };
@@ -340,6 +340,8 @@ void GeomCacheBlockCompressionWriter::RunJob(JobData *pJobData)
 
 void GeomCacheBlockCompressionWriter::CompressJob(JobData *pJobData)
 {	
+	const LONGLONG startTicks = GeomCache::StageTimer::GetTicks();
+
 	// Remember uncompressed size
 	const uint32 uncompressedSize = pJobData->m_data.size();
 
@@ -359,6 +361,8 @@ void GeomCacheBlockCompressionWriter::CompressJob(JobData *pJobData)
 	dataBuffer.insert(dataBuffer.begin() + sizeof(GeomCacheFile::SCompressedBlockHeader), compressedData.begin(), compressedData.end());
 
 	pJobData->m_data = dataBuffer;
+	m_compressionTimer.Add(startTicks);
+
 	m_jobFinishedCS.Lock();
 	pJobData->m_bFinished = true;
 	m_jobFinishedCS.Unlock();
@@ -423,6 +427,8 @@ GeomCacheWriterStats GeomCacheWriter::FinishWriting()
 	m_pCompressionWriter->PushData((void*)&m_fileHeader, sizeof(GeomCacheFile::SHeader));	
 	m_pCompressionWriter->WriteBlock(false, nullptr, 0, SEEK_SET);
 
+	stats.m_compressionSeconds = m_pCompressionWriter->GetCompressionSeconds();
+
 	// Destroy compression writer and block compressor
 	m_pCompressionWriter.reset(nullptr);
 	m_pBlockCompressor.reset(nullptr);
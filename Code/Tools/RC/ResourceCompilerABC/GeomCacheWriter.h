@@ -130,6 +130,9 @@ public:
 	// Flush to write thread
 	void Flush();
 
+	// Time spent in compression jobs
+	double GetCompressionSeconds() const { return m_compressionTimer.GetSeconds(); }
+
 private:
 	static unsigned int __stdcall ThreadFunc(void *pParam);
 	void Run();
@@ -166,6 +169,8 @@ private:
 
 	// The job data
 	std::vector<JobData> m_jobData;
+
+	GeomCache::StageTimer m_compressionTimer;
 };
 
 struct GeomCacheWriterStats
@@ -174,6 +179,7 @@ struct GeomCacheWriterStats
 	uint64 m_staticDataSize;
 	uint64 m_animationDataSize;
 	uint64 m_uncompressedAnimationSize;
+	double m_compressionSeconds;
 };
 
 class GeomCacheWriter
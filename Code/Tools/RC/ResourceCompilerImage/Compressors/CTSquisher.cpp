@@ -136,7 +136,11 @@ ImageToProcess::EResult ImageToProcess::ConvertFormatWithCTSquisher(const CImage
 			assert(bSrcSimple);      // A8R8G8B8 or X8R8G8B8
 			assert(bDstCompressed);	 // DXT1, DXT1a, DXT3, DXT5, ...
 
+			// the parameters of all mips are gathered first, so the mips can be compressed concurrently
 			const uint32 mipCount = pRet->GetMipCount();
+			std::vector<CrySquisherCallbackUserData> mipUserData(mipCount);
+			std::vector<CryTextureSquisher::CompressorParameters> mipCompress(mipCount);
+
 			for(uint32 dwMip = 0; dwMip < mipCount; ++dwMip)
 			{
 				uint32 dwLocalWidth = get()->GetWidth(dwMip);
@@ -151,12 +155,12 @@ ImageToProcess::EResult ImageToProcess::ConvertFormatWithCTSquisher(const CImage
 				pRet->GetImagePointer(dwMip, pDstMem, dwDstPitch);
 
 				{
-					CrySquisherCallbackUserData userData;
+					CrySquisherCallbackUserData& userData = mipUserData[dwMip];
 					userData.m_pImageObject = pRet.get();
 					userData.m_dstOffset = 0;
 					userData.m_dstMem = pDstMem;
 
-					CryTextureSquisher::CompressorParameters compress;
+					CryTextureSquisher::CompressorParameters& compress = mipCompress[dwMip];
 
 					compress.srcBuffer = pSrcMem;
 					compress.width = dwLocalWidth;
@@ -290,11 +294,21 @@ ImageToProcess::EResult ImageToProcess::ConvertFormatWithCTSquisher(const CImage
 						return eResult_Failed;
 					}
 
-					CryTextureSquisher::Compress(compress); 
-
-					assert(userData.m_dstOffset == dwDstPitch * ((dwLocalHeight + 3) / 4));
 				}
 			} // for: all mips
+
+			CryTextureSquisher::CompressMips(mipCompress.data(), mipCount);
+
+#if defined(_DEBUG)
+			for(uint32 dwMip = 0; dwMip < mipCount; ++dwMip)
+			{
+				char *pDstMem;
+				uint32 dwDstPitch;
+				pRet->GetImagePointer(dwMip, pDstMem, dwDstPitch);
+
+				assert(mipUserData[dwMip].m_dstOffset == dwDstPitch * ((get()->GetHeight(dwMip) + 3) / 4));
+			}
+#endif
 		}
 		else
 		{
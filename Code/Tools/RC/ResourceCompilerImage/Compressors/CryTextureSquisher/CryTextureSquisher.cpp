@@ -8,6 +8,9 @@
 #include "ColorBlockRGBA4x4f.h"
 #include "CryTextureSquisher.h"
 
+#include <atomic>
+#include <chrono>
+
 // we can't build debug-builds with the concurrency-runtime,
 // as _CRT_DBG_MALLOC interferes with concurrency-runtime's alloca/freea
 #if	!defined(_DEBUG) && !defined(_CRT_DBG_MALLOC)
@@ -20,6 +23,10 @@
 
 static ThreadUtils::CriticalSection s_squishLock;
 
+static std::atomic<uint64> s_statsBlocks(0);
+static std::atomic<uint64> s_statsBytes(0);
+static std::atomic<std::chrono::steady_clock::duration::rep> s_statsTicks(0);
+
 // preserve the ability to link with the old squish (which is in NvTT)
 #define squish	squishccr
 #define	SQUISH_USE_CPP
@@ -314,8 +321,17 @@ static struct ParameterMatrix
 /* -------------------------------------------------------------------------------------------------------------
  * compression functions
  */
+static bool UsesPerceptualWeights(const CryTextureSquisher::CompressorParameters& compress)
+{
+	const int flags = P2P[compress.preset].flagsBaseline + P2P[compress.preset].flagsQuality[compress.quality] + P2P[compress.preset].flagsPerceptual;
+
+	return compress.perceptual && (flags & squish::kColourMetricPerceptual);
+}
+
 void CryTextureSquisher::Compress(const CryTextureSquisher::CompressorParameters& compress)
 {
+	const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
 	const unsigned int w = compress.width;
 	const unsigned int h = compress.height;
 	const size_t offset = P2P[compress.preset].offset;
@@ -481,6 +497,50 @@ void CryTextureSquisher::Compress(const CryTextureSquisher::CompressorParameters
 		s_squishLock.Unlock();
 
 	MathHelpers::EnableFloatingPointExceptions(savedFpeMask);
+
+	const uint64 numBlocks = uint64((w + 3) >> 2) * ((h + 3) >> 2);
+	s_statsBlocks += numBlocks;
+	s_statsBytes += numBlocks * sqio.blocksize;
+	s_statsTicks += (std::chrono::steady_clock::now() - startTime).count();
+}
+
+void CryTextureSquisher::CompressMips(const CryTextureSquisher::CompressorParameters* pCompress, unsigned int count)
+{
+	if (count == 0)
+		return;
+
+	// the squish colour-metric weights are global, images using custom weights serialize on
+	// s_squishLock anyway and are compressed one after the other
+#ifdef PROCESS_IN_PARALLEL
+	if (count > 1 && !UsesPerceptualWeights(pCompress[0]))
+	{
+		// the large mips are split into rows by Compress(), the small ones fill the idle cores
+		Concurrency::parallel_for(0U, count, [pCompress](unsigned int i)
+		{
+			Compress(pCompress[i]);
+		});
+		return;
+	}
+#endif
+
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		Compress(pCompress[i]);
+	}
+}
+
+void CryTextureSquisher::GetStatistics(Statistics& stats)
+{
+	stats.numBlocks = s_statsBlocks;
+	stats.numBytes = s_statsBytes;
+	stats.seconds = std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::steady_clock::duration(s_statsTicks)).count();
+}
+
+void CryTextureSquisher::ResetStatistics()
+{
+	s_statsBlocks = 0;
+	s_statsBytes = 0;
+	s_statsTicks = 0;
 }
 
 void CryTextureSquisher::Decompress(const DecompressorParameters& decompress)
@@ -111,10 +111,24 @@ public:
 		void (*userInputFunction)(const DecompressorParameters& decompress, void* compressedData, unsigned int compressedSize, unsigned int oy, unsigned int ox);
 	};
 
+	// accumulated over all Compress() calls since the last ResetStatistics()
+	struct Statistics
+	{
+		uint64 numBlocks;
+		uint64 numBytes;
+		double seconds;
+	};
+
 public:
 	static void Compress(const CompressorParameters& compress);
 	static void Decompress(const DecompressorParameters& decompress);
 
+	// compresses independent images (f.e. the mips of a texture), concurrently if possible
+	static void CompressMips(const CompressorParameters* pCompress, unsigned int count);
+
+	static void GetStatistics(Statistics& stats);
+	static void ResetStatistics();
+
 };
 
 #endif
@@ -8,6 +8,7 @@
 #include "ImageCompiler.h"
 #include "IAssetManager.h"
 #include "ImageDetails.h"
+#include "Compressors/CryTextureSquisher/CryTextureSquisher.h"
 
 #include "../../../SDKs/tiff-4.0.4/libtiff/tiffio.h"
 
@@ -106,6 +107,22 @@ void CImageConverter::Init(const ConverterInitContext& context)
 {
 	TIFFSetErrorHandler(TiffErrorHandler);
 	TIFFSetWarningHandler(TiffWarningHandler);
+
+	CryTextureSquisher::ResetStatistics();
+}
+
+void CImageConverter::DeInit()
+{
+	CryTextureSquisher::Statistics stats;
+	CryTextureSquisher::GetStatistics(stats);
+
+	if (stats.numBlocks > 0)
+	{
+		// the time is summed over all threads compressing concurrently
+		RCLog("Block compression: %.0f blocks (%.1f MB) in %.2f sec. of compressor time, %.1f MB/sec.",
+			(double)stats.numBlocks, stats.numBytes / (1024.0 * 1024.0), stats.seconds,
+			stats.seconds > 0.0 ? stats.numBytes / (1024.0 * 1024.0) / stats.seconds : 0.0);
+	}
 }
 
 ICompiler* CImageConverter::CreateCompiler()
@@ -21,6 +21,7 @@ public:
 	// interface IConverter ----------------------------------------------------
 	virtual void Release();
 	virtual void Init(const ConverterInitContext& context);
+	virtual void DeInit() override;
 	virtual ICompiler* CreateCompiler();
 	virtual bool SupportsMultithreading() const;
 	virtual const char* GetExt(int index) const;
@@ -4,6 +4,7 @@
 
 #include "VisualChangeCalculatorView.h"
 #include "VisualChangeCalculatorViewJob.h"
+#include <unordered_map>
 namespace LODGenerator
 {
 	class VisualChangeCalculator
@@ -31,6 +32,75 @@ namespace LODGenerator
 			int v[3];
 		};
 
+		// Uniform grid over the welded vertices, so finding a vertex within the weld distance only has to
+		// look at the 27 surrounding cells instead of every vertex created so far.
+		class WeldGrid
+		{
+		public:
+			WeldGrid(const std::vector<Vertex>& vertices, float weldDistance)
+				: m_vertices(vertices)
+				, m_epsilon(weldDistance*weldDistance)
+				, m_invCellSize(1.0f/max(weldDistance, 0.001f))
+			{
+			}
+
+			// Returns the lowest id of a vertex within the weld distance, or -1
+			int Find(const Vec3 &pos) const
+			{
+				int ix, iy, iz;
+				GetCell(pos, ix, iy, iz);
+				int found=-1;
+				for (int z=iz-1; z<=iz+1; z++)
+				{
+					for (int y=iy-1; y<=iy+1; y++)
+					{
+						for (int x=ix-1; x<=ix+1; x++)
+						{
+							TCells::const_iterator cell=m_cells.find(GetKey(x, y, z));
+							if (cell==m_cells.end())
+								continue;
+							for (std::vector<int>::const_iterator it=cell->second.begin(), end=cell->second.end(); it!=end; ++it)
+							{
+								if ((found<0 || *it<found) && pos.GetSquaredDistance(m_vertices[*it].pos)<=m_epsilon)
+								{
+									found=*it;
+									break; // ids in a cell are ascending
+								}
+							}
+						}
+					}
+				}
+				return found;
+			}
+
+			void Add(int id)
+			{
+				int ix, iy, iz;
+				GetCell(m_vertices[id].pos, ix, iy, iz);
+				m_cells[GetKey(ix, iy, iz)].push_back(id);
+			}
+
+		private:
+			typedef std::unordered_map<uint64, std::vector<int>> TCells;
+
+			void GetCell(const Vec3 &pos, int &ix, int &iy, int &iz) const
+			{
+				ix=(int)floorf(pos.x*m_invCellSize);
+				iy=(int)floorf(pos.y*m_invCellSize);
+				iz=(int)floorf(pos.z*m_invCellSize);
+			}
+
+			static uint64 GetKey(int x, int y, int z)
+			{
+				return ((uint64)(x & 0x1FFFFF) << 42) | ((uint64)(y & 0x1FFFFF) << 21) | (uint64)(z & 0x1FFFFF);
+			}
+
+			const std::vector<Vertex>& m_vertices;
+			float m_epsilon;
+			float m_invCellSize;
+			TCells m_cells;
+		};
+
 		CLODGeneratorLib::SLODSequenceGenerationOutput * m_pReturnValues;
 
 		std::vector<Move> m_moves;
@@ -343,7 +413,6 @@ namespace LODGenerator
 					int faces = pMesh->GetIndexCount()/3;
 				
 					// Set polys/vertices
-					float epsilon=m_weldDistance*m_weldDistance; // Weld very close vertices together
 					int numMoves=0;
 					m_polys.clear();
 					m_polys.reserve(faces+1);
@@ -353,6 +422,7 @@ namespace LODGenerator
 					m_moveList.clear();
 					m_vertices.clear();
 					m_noMoveList.clear();
+					WeldGrid weldGrid(m_vertices, m_weldDistance); // Weld very close vertices together
 
 					const int subsets = pMesh->GetSubSetCount();
 					for (int subsetidx = 0; subsetidx < subsets; ++subsetidx)
@@ -373,19 +443,12 @@ namespace LODGenerator
 							{
 								Vec3 &o=pVertices[pIndices[indexFirst + (3*i+k)]];
 								Vec3 v=o;
-								std::vector<Vertex>::iterator it=m_vertices.begin(), end=m_vertices.end();
-								for (; it!=end; ++it)
-								{
-									if (v.GetSquaredDistance(it->pos)<=epsilon)
-									{
-										p.v[k]=(int)(it-m_vertices.begin());
-										break;
-									}
-								}
-								if (it==end)
+								p.v[k]=weldGrid.Find(v);
+								if (p.v[k]<0)
 								{
 									p.v[k]=m_vertices.size();
 									m_vertices.push_back(Vertex(v));
+									weldGrid.Add(p.v[k]);
 								}
 							}
 
@@ -421,15 +484,10 @@ namespace LODGenerator
 					std::vector<int> noMoveIds;
 					for (std::vector<Vec3>::iterator nit=m_noMoveList.begin(), nend=m_noMoveList.end(); nit!=nend; ++nit)
 					{
-						Vec3 v=*nit;
-						std::vector<Vertex>::iterator it=m_vertices.begin(), end=m_vertices.end();
-						for (; it!=end; ++it)
+						const int id=weldGrid.Find(*nit);
+						if (id>=0)
 						{
-							if (v.GetSquaredDistance(it->pos)<=epsilon)
-							{
-								noMoveIds.push_back((int)(it-m_vertices.begin()));
-								break;
-							}
+							noMoveIds.push_back(id);
 						}
 					}
 					std::sort(noMoveIds.begin(), noMoveIds.end());
@@ -403,6 +403,16 @@ bool CStaticObjectCompiler::CompileMeshes( CContentCGF *pCGF, bool bIgnoreTangen
 				RCLogError("Failed to compile geometry in node '%s' in file %s - %s",pNodeCGF->name,pCGF->GetFilename(),meshCompiler.GetLastError());
 				return false;
 			}
+
+			if ((nMeshCompileFlags & mesh_compiler::MESH_COMPILE_OPTIMIZE) && m_logVerbosityLevel > 1)
+			{
+				const mesh_compiler::SVertexCacheStats& stats = meshCompiler.GetVertexCacheStats();
+				RCLog("Vertex cache in node '%s': ACMR %.3f -> %.3f, ATVR %.3f -> %.3f (%d triangles, %d vertices)",
+					pNodeCGF->name,
+					stats.GetAcmrBefore(), stats.GetAcmrAfter(),
+					stats.GetAtvrBefore(), stats.GetAtvrAfter(),
+					stats.numIndices / 3, stats.numVertices);
+			}
 		}
 	}
 	return true;